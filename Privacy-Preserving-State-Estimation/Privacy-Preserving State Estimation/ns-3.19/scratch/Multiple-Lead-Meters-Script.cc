@@ -62,6 +62,7 @@
 #include "ns3/hwmp-protocol.h"
 #include "ns3/arp-l3-protocol.h"
 #include "ns3/flow-probe.h"
+#include "ns3/result-sink.h"
 
 #include <iostream>
 #include <sstream>
@@ -72,11 +73,6 @@
 #include <string.h>
 
 #include "n_eq_coord.h"
-#include "n_eq_25.h"
-#include "n_eq_36.h"
-#include "n_eq_49.h"
-#include "n_eq_64.h"
-#include "n_eq_81.h"
 
 using namespace ns3;
 
@@ -129,6 +125,7 @@ class MeshTest{
         std::string m_sinkIpAddress;
         bool        m_ActivateSecurityModule;
         std::string m_filename;
+        std::string m_outputDir;
         bool        m_gridtopology;
         bool        m_randomTopology;
         std::string m_UdpTcpMode;
@@ -137,6 +134,11 @@ class MeshTest{
         double      m_arpwait;
         bool        m_randomAppStart;
         int         m_typeOfOperation;
+        double      m_snapshotInterval;
+        double      m_preqInterval;
+        double      m_warmUp;
+        bool        m_tabulatedError;
+        bool        m_packetStats;
         int*        m_obfVector01;
         int*        m_obfVector10;
         int*        m_obfVector10_plus_obfVector01;
@@ -183,6 +185,12 @@ class MeshTest{
         void InstallSecureArp ();
         
         void InitializeSinkArpTable ();
+
+        /// Create the sink of the statistics of each flow, written to m_filename + suffix
+        Ptr<ResultSink> CreateFlowSink (std::string suffix, bool step);
+
+        /// Have the root refresh the paths towards it m_warmUp seconds before start
+        void WarmUpRootPaths (double start);
 };
 
 MeshTest::MeshTest () :
@@ -208,15 +216,25 @@ MeshTest::MeshTest () :
     m_sink (0),
     m_sinkIpAddress ("10.1.1.1"),
     m_ActivateSecurityModule (false),
+    m_outputDir ("."),
     m_gridtopology (true),
     m_UdpTcpMode ("tcp"),
     m_arpOp (1),
     m_arpwait (4), // default 1 s, 4s better since no failed node
     m_randomAppStart (false),
-    m_typeOfOperation (1)
+    m_typeOfOperation (1),
+    m_snapshotInterval (0),
+    m_preqInterval (0),
+    m_warmUp (0),
+    m_tabulatedError (false),
+    m_packetStats (false)
 {}
 
 void MeshTest::Configure (int argc, char *argv[]){
+    // The meters never move and the default propagation models are
+    // deterministic, so the link budgets between them are computed once.
+    Config::SetDefault ("ns3::YansWifiChannel::StaticLinkBudget", BooleanValue (true));
+
     CommandLine cmd;
     
     cmd.AddValue ("init-lead0tolead1", "Initial Starting time from Sink to SMs [5.4]", m_initstartLead0ToLead1);
@@ -253,11 +271,17 @@ void MeshTest::Configure (int argc, char *argv[]){
     cmd.AddValue ("security","Activate Security Module [false]", m_ActivateSecurityModule);
     cmd.AddValue ("UdpTcp", "UDP or TCP mode [udp]", m_UdpTcpMode);
     cmd.AddValue ("topology", "Topology file to read in node positions", m_input);
+    cmd.AddValue ("output-dir", "Directory of the output files [.]", m_outputDir);
     cmd.AddValue ("arp-op", "ARP operations : 1. Normal [default], 2. Creation only, 3. Maintenance ony, 4. All pre-install arp table", m_arpOp);
     cmd.AddValue ("wait-arp", "When this timeout expires, the cache entries will be scanned and entries in WaitReply state will resend ArpRequest unless MaxRetries has been exceeded, in which case the entry is marked dead [1s]", m_arpwait);
     cmd.AddValue ("random-start", "Random start of the application [false]", m_randomAppStart);
     cmd.AddValue ("random-topology", "Random start of the application [false]", m_randomTopology);
     cmd.AddValue ("type-op", "1 = sink to SM and SM to sink, 2 = sink to SM only, 3=SM to sink only", m_typeOfOperation);
+    cmd.AddValue ("snapshot-interval", "Interval of the per-window flow statistics, seconds, zero for none [0]", m_snapshotInterval);
+    cmd.AddValue ("preq-interval", "Interval of the proactive PREQs of the root, seconds, zero for the HWMP default [0]", m_preqInterval);
+    cmd.AddValue ("warm-up", "Proactive PREQ of the root this many seconds before each traffic start, zero for none [0]", m_warmUp);
+    cmd.AddValue ("tabulated-error", "Look up the chunk success rates of the NIST error model in tables [false]", m_tabulatedError);
+    cmd.AddValue ("packet-stats", "Print the allocations of the packets during the run [false]", m_packetStats);
 
     cmd.Parse (argc, argv);
     
@@ -275,6 +299,9 @@ void MeshTest::CreateNodes (){
     
     // Configure YansWifiChannel, default ns3::NistErrorRateModel
     YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default ();
+    if (m_tabulatedError) {
+        wifiPhy.SetErrorRateModel ("ns3::TabulatedErrorRateModel");
+    }
 
     wifiPhy.Set ("EnergyDetectionThreshold", DoubleValue (-89.0) );
     wifiPhy.Set ("CcaMode1Threshold", DoubleValue (-62.0) );
@@ -305,6 +332,9 @@ void MeshTest::CreateNodes (){
     Config::SetDefault ("ns3::dot11s::HwmpProtocol::UnicastDataThreshold",UintegerValue (5));
     Config::SetDefault ("ns3::dot11s::HwmpProtocol::DoFlag", BooleanValue (true));
     Config::SetDefault ("ns3::dot11s::HwmpProtocol::RfFlag", BooleanValue (false));
+    if (m_preqInterval > 0) {
+        Config::SetDefault ("ns3::dot11s::HwmpProtocol::Dot11MeshHWMPpathToRootInterval", TimeValue (Seconds (m_preqInterval)));
+    }
 
     if (m_arpwait != 1.0) {
         Config::SetDefault ("ns3::ArpCache::WaitReplyTimeout", TimeValue (Seconds (m_arpwait)));
@@ -407,42 +437,12 @@ void MeshTest::CreateNodes (){
           exit (EXIT_FAILURE);    
         }
          mobility.SetPositionAllocator (position);
-        /*int topoId = m_shuffle-1; 
-        switch (m_xSize) {
-            case 5:
-                //  for (unsigned int i = 0; i < m_xSize*m_ySize; i++)
-                for (unsigned int i = 0; i < sizeof array(n_eq_25[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_25[topoId][i]);
-                break;
-            case 6:
-                for (unsigned int i = 0; i < sizeof array(n_eq_36[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_36[topoId][i]);
-                break;
-            case 7:
-                for (unsigned int i = 0; i < sizeof array(n_eq_49[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_49[topoId][i]);
-                break;
-            case 8:
-                for (unsigned int i = 0; i < sizeof array(n_eq_64[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_64[topoId][i]);
-                break;
-            case 9:
-                for (unsigned int i = 0; i < sizeof array(n_eq_81[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_81[topoId][i]);
-                break;
-        }
-        
-        Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
-        for (vector< coordinates >::iterator j = nodeCoords.begin (); j != nodeCoords.end (); j++){
-            positionAlloc->Add (Vector ((*j).X, (*j).Y, 0.0));
-        }
-        mobility.SetPositionAllocator (positionAlloc);*/
     }
     mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
     mobility.Install (nodes);
     
     if (m_pcap)
-        wifiPhy.EnablePcapAll (std::string ("mp-"));
+        wifiPhy.EnablePcapAll (SystemPath::Append (m_outputDir, "mp-"));
 }
 
 void MeshTest::InstallInternetStack (){
@@ -455,6 +455,7 @@ void MeshTest::InstallInternetStack (){
 }
 
 void MeshTest::InstallApplicationLead0ToLead1 (){
+    WarmUpRootPaths (m_initstartLead0ToLead1);
     NS_LOG_INFO ("InstallApplicationLead0ToLead1---girdi 1");
     /*
     int i =0;
@@ -537,23 +538,15 @@ void MeshTest::InstallApplicationLead0ToLead1 (){
             int meterSize= m_ySize*m_xSize;
             int obfsVector[meterSize];
              
-            srand(time(0));
+            // Seeded by the run number, so that runs started together differ
+            // and a run can be repeated
+            srand (RngSeedManager::GetRun ());
             for(int z = 0; z < meterSize; z++){
                 obfsVector[z] = rand() % 40 + (-20); //-20 and 20  
                 m_obfVector01[z] = obfsVector[z];
             } 
             
-            std::stringstream values;
-            values << meterSize<<"$";
-            std::string star ="*";
-            
-            for(int z=0; z<meterSize; z++){
-                values<< obfsVector[z]<<star;
-            }
-            
-            std::string obfsValue = values.str();
- 
-            onoff.SetAttribute ("ObfsValues", StringValue (obfsValue));             
+            onoff.SetObfuscationVector (Create<ObfuscationVector> (obfsVector, meterSize), 0, meterSize);
              
             apps[i] = onoff.Install (nodes.Get(0));
               
@@ -588,6 +581,7 @@ void MeshTest::InstallApplicationLead0ToLead1 (){
 }
 
 void MeshTest::InstallApplicationLead1ToLead0 (){
+    WarmUpRootPaths (m_initstartLead1ToLead0);
     /*
     int i =0;
     int displacement = 0;
@@ -680,16 +674,7 @@ void MeshTest::InstallApplicationLead1ToLead0 (){
                 NS_LOG_INFO("FINAL VALUE("<<y<<"): "<< m_obfVector10_plus_obfVector01[y]);
             }
 
-            std::stringstream values;
-            values << meterSize<<"$";
-            std::string star ="*";
-            
-            for(int z=0; z<meterSize; z++){
-                values<< obfsVector[z]<<star;
-            }
-             
-            std::string obfsValue = values.str();
-            onoff.SetAttribute ("ObfsValues", StringValue (obfsValue));
+            onoff.SetObfuscationVector (Create<ObfuscationVector> (obfsVector, meterSize), 0, meterSize);
              
             apps[i] = onoff.Install (nodes.Get(1));       
         }
@@ -727,6 +712,7 @@ void MeshTest::InstallApplicationLead1ToLead0 (){
    then pair each packetsink of each node with onoff apps from sink
 */
 void MeshTest::InstallApplicationLead1ToOddMeters (){
+    WarmUpRootPaths (m_initstartLead1ToOdds);
     NS_LOG_INFO ("InstallApplicationLead1ToOddMeters Girdi 1");
 
     /*int i =0;
@@ -766,6 +752,9 @@ void MeshTest::InstallApplicationLead1ToOddMeters (){
     lead1_odds_first_sent = 30*((m_ySize*m_xSize/2)-1);
     lead1_odds_stop_time = m_initstartLead1ToOdds + lead1_odds_first_sent + 20*((m_ySize*m_xSize/2)-1);
     
+
+    // Every meter is sent its own slice of one shared vector
+    Ptr<ObfuscationVector> obfs = Create<ObfuscationVector> (m_obfVector10_plus_obfVector01, m_ySize*m_xSize);
     for (i = 3; i < m_ySize*m_xSize; i+=2){ 
         //m_dest = array[i]; 
         m_dest_port = rand_port.GetValue(); // pick a random port number
@@ -805,11 +794,7 @@ void MeshTest::InstallApplicationLead1ToOddMeters (){
             onoff.SetAttribute("TransMode", UintegerValue(1));
             onoff.SetAttribute("MeterSize",UintegerValue(m_ySize*m_xSize));                    
 
-            std::stringstream val;
-            val<<1<<"$"<<m_obfVector10_plus_obfVector01[i]<<"*";
-            std::string lead1_To_OddMeter_ObfsValue = val.str();
-
-            onoff.SetAttribute ("ObfsValues", StringValue (lead1_To_OddMeter_ObfsValue));
+            onoff.SetObfuscationVector (obfs, i, 1);
 
             apps[i] = onoff.Install (nodes.Get(1));       
         }
@@ -846,6 +831,7 @@ void MeshTest::InstallApplicationLead1ToOddMeters (){
 }
 
 void MeshTest::InstallApplicationOddMetersToLead1 (){
+    WarmUpRootPaths (m_initstartOddsToLead1);
     /*int i =0;
     int displacement = 0;
     int *array = new int[m_ySize*m_xSize];
@@ -923,10 +909,7 @@ void MeshTest::InstallApplicationOddMetersToLead1 (){
             NS_LOG_INFO("---------OddMeters To Lead1--------");
             int number = rand() % 50 + (50);
             m_finalObfVector[i]= m_obfVector10_plus_obfVector01[i] + number;
-            std::stringstream val;
-            val<<1<<"$"<<m_finalObfVector[i]<<"*";
-            std::string OddMetersToLead1 = val.str();
-            onoff.SetAttribute ("ObfsValues", StringValue (OddMetersToLead1)); 
+            onoff.SetObfuscationVector (Create<ObfuscationVector> (&m_finalObfVector[i], 1), 0, 1);
 
             apps[i] = onoff.Install (nodes.Get(i /*m_source*/));
             
@@ -960,6 +943,7 @@ void MeshTest::InstallApplicationOddMetersToLead1 (){
 }
 
 void MeshTest::InstallApplicationEvenMetersToLead0 (){
+    WarmUpRootPaths (m_initstartEvensToLead0);
     /*int i =0;
     int displacement = 0;
     int *array = new int[m_ySize*m_xSize];
@@ -1037,10 +1021,7 @@ void MeshTest::InstallApplicationEvenMetersToLead0 (){
             NS_LOG_INFO("---------EvenMeters To Lead0--------");
             int number = rand() % 50 + (50);
             m_finalObfVector[i]= m_obfVector10_plus_obfVector01[i] + number;
-            std::stringstream val;
-            val<<1<<"$"<<m_finalObfVector[i]<<"*";
-            std::string EvenMetersToLead0 = val.str();
-            onoff.SetAttribute ("ObfsValues", StringValue (EvenMetersToLead0)); 
+            onoff.SetObfuscationVector (Create<ObfuscationVector> (&m_finalObfVector[i], 1), 0, 1);
 
             apps[i] = onoff.Install (nodes.Get(i)); 
            
@@ -1090,6 +1071,7 @@ void MeshTest::InstallApplicationEvenMetersToLead0 (){
 }
 
 void MeshTest::InstallApplicationLead0ToEvenMeters (){
+    WarmUpRootPaths (m_initstartLead0ToEvens);
     NS_LOG_INFO ("InstallApplicationLead0ToEvenMeters Girdi 1");
     
     /*
@@ -1129,6 +1111,9 @@ void MeshTest::InstallApplicationLead0ToEvenMeters (){
     os << m_filename <<"-time.txt";
     std::ofstream of (os.str().c_str(), std::ios::out | std::ios::app);
     
+
+    // Every meter is sent its own slice of one shared vector
+    Ptr<ObfuscationVector> obfs = Create<ObfuscationVector> (m_obfVector10_plus_obfVector01, m_ySize*m_xSize);
     for (i = 2; i < m_ySize*m_xSize; i+=2){ 
         //m_dest = array[i]; 
         m_dest_port = rand_port.GetValue(); // pick a random port number
@@ -1170,11 +1155,7 @@ void MeshTest::InstallApplicationLead0ToEvenMeters (){
             onoff.SetAttribute("TransMode", UintegerValue(1));
             onoff.SetAttribute("MeterSize",UintegerValue(m_ySize*m_xSize));                    
 
-            std::stringstream val;
-            val<<1<<"$"<<m_obfVector10_plus_obfVector01[i]<<"*";
-            std::string leadO_To_EvenMeter_ObfsValue = val.str();
-
-            onoff.SetAttribute ("ObfsValues", StringValue (leadO_To_EvenMeter_ObfsValue));
+            onoff.SetObfuscationVector (obfs, i, 1);
 
             apps[i] = onoff.Install (nodes.Get(0));       
         }
@@ -1212,100 +1193,32 @@ void MeshTest::InstallApplicationLead0ToEvenMeters (){
 }
 
 void MeshTest::InitializeSinkArpTable (){
-    typedef std::pair<Mac48Address, Ipv4Address> AddressMapping;
-    int x = 0;
-    Mac48Address mac;
-    Ptr<NetDevice> nd_sink;
-    Ptr<MeshPointDevice> mp_sink;
-    std::vector <AddressMapping> m_initArp;
-    std::vector <AddressMapping> m_ArpSink;
+    // The root is the gateway, every other mesh point is a meter
+    NodeContainer gateway;
+    NodeContainer meters;
     for (NetDeviceContainer::Iterator i = meshDevices.Begin (); i != meshDevices.End (); ++i){
-        Ptr<MeshPointDevice> mp = (*i)->GetObject<MeshPointDevice> ();
-        Ptr<NetDevice> nd = *i;
-        mac = Mac48Address::ConvertFrom (mp->GetAddress () );
-        AddressMapping arp;
-        if (mac != Mac48Address (m_root.c_str () ) ) {
-            arp = std::make_pair (Mac48Address::ConvertFrom (mp->GetAddress () ), interfaces.GetAddress (x) );
-            m_initArp.push_back (arp);
-            //   std::cout << Mac48Address::ConvertFrom (mp->GetAddress ()) << "," << interfaces.GetAddress (x) << std::endl;
+        if (Mac48Address::ConvertFrom ((*i)->GetAddress ()) == Mac48Address (m_root.c_str ())) {
+            gateway.Add ((*i)->GetNode ());
         }
-        else{
-            mp_sink = mp;
-            nd_sink = nd;
-            arp = std::make_pair (Mac48Address::ConvertFrom (mp->GetAddress () ), interfaces.GetAddress (x) );
-            m_ArpSink.push_back (arp);
+        else {
+            meters.Add ((*i)->GetNode ());
         }
-        x++;
     }
-    
-    // initialize arp table of sink
-    Ptr<Node> node = mp_sink->GetNode () ;
-    Ptr<ArpL3Protocol> arpL3 = node->GetObject<ArpL3Protocol> ();
-    Ptr<ArpCache> arpcache = arpL3->FindCache (nd_sink);
-    
+
     switch (m_arpOp) {
-        case 2:  // creation phase only
-            arpcache->SetAliveTimeout(Seconds (1000));
-            break;
-        case 3: // maintenance phase only
-            for (long index = 0; index < (long) m_initArp.size (); index++ ){
-                ArpCache::Entry *entry = arpcache->Lookup (m_initArp.at(index).second);
-                if (entry == 0 ){
-                    NS_LOG_LOGIC ("Add new entry to the ARP cache" );
-                    entry = arpcache->Add (m_initArp.at(index).second);
-                }
-                entry->SetMacAddress (m_initArp.at(index).first);
-            }
-            break;
+        case 2: // creation phase only
         case 4: // all pre-install, no arp broadcast request
-            arpcache->SetAliveTimeout(Seconds (1000));
-            for (long index = 0; index < (long) m_initArp.size (); index++ ){
-                ArpCache::Entry *entry = arpcache->Lookup (m_initArp.at(index).second);
-                if (entry == 0 ){
-                    NS_LOG_LOGIC ("Add new entry to the ARP cache" );
-                    entry = arpcache->Add (m_initArp.at(index).second);
-                }
-                entry->SetMacAddress (m_initArp.at(index).first);
-            }     
+            Config::Set ("/NodeList/*/$ns3::ArpL3Protocol/CacheList/*/AliveTimeout", TimeValue (Seconds (1000)));
             break;
     }
-    
-    // initialize arp table on every SMs
-    for (NetDeviceContainer::Iterator i = meshDevices.Begin (); i != meshDevices.End (); ++i) {
-        Ptr<MeshPointDevice> mp = (*i)->GetObject<MeshPointDevice> ();    
-        if (Mac48Address::ConvertFrom (mp->GetAddress () ) != Mac48Address (m_root.c_str () ) ) {
-            Ptr<NetDevice> nd = *i;
-            Ptr<Node> node = mp->GetNode ();
-            Ptr<ArpL3Protocol> arpL3 = node->GetObject<ArpL3Protocol> ();
-            Ptr<ArpCache> arpcache = arpL3->FindCache (nd);
-            
-            switch (m_arpOp) {
-                case 2: //creation phase only
-                    arpcache->SetAliveTimeout(Seconds (1000));
-                    break;
-                case 3: // maintenance phase only
-                    for (long index = 0; index < (long) m_ArpSink.size (); index++ ) {
-                        ArpCache::Entry *entry = arpcache->Lookup (m_ArpSink.at(index).second);
-                        if (entry == 0 ) {
-                            NS_LOG_LOGIC ("Add new entry to the ARP cache" );
-                            entry = arpcache->Add (m_ArpSink.at(index).second);
-                        }
-                        entry->SetMacAddress (m_ArpSink.at(index).first);
-                    }
-                    break;
-                case 4: // pre-configure all
-                    arpcache->SetAliveTimeout(Seconds (1000));
-                    for (long index = 0; index < (long) m_ArpSink.size (); index++ ) {
-                        ArpCache::Entry *entry = arpcache->Lookup (m_ArpSink.at(index).second);
-                        if (entry == 0 ) {
-                            NS_LOG_LOGIC ("Add new entry to the ARP cache" );
-                            entry = arpcache->Add (m_ArpSink.at(index).second);
-                        }
-                        entry->SetMacAddress (m_ArpSink.at(index).first);
-                    }
-                    break;
-            }         
-        }
+    if (m_arpOp == 3 || m_arpOp == 4) {
+        // The gateway and the meters know each other: the entries are
+        // refreshed by ARP in the maintenance phase only, and never
+        // expire when all are pre-installed
+        ArpCacheHelper arp;
+        arp.SetPermanent (m_arpOp == 4);
+        arp.PopulateStatic (gateway, meters);
+        arp.PopulateStatic (meters, gateway);
     }
 }
 
@@ -1336,7 +1249,7 @@ int MeshTest::Run (){
             break;
     } 
   
-    m_filename = tmp.str () ;
+    m_filename = SystemPath::Append (m_outputDir, tmp.str ());
     CreateNodes ();
 
     if (!m_gridtopology) {
@@ -1386,11 +1299,21 @@ int MeshTest::Run (){
 
     // Install FlowMonitor on all nodes
     FlowMonitorHelper flowmon;
+    flowmon.SetMonitorAttribute ("SnapshotInterval", TimeValue (Seconds (m_snapshotInterval)));
     Ptr<FlowMonitor> monitor = flowmon.InstallAll();
+    if (m_snapshotInterval > 0) {
+        monitor->SetWindowSink (CreateObject<ResultSink> (m_filename + "-window.txt"));
+    }
     m_timeStart=clock();
     Simulator::Schedule (Seconds (m_totalTime), &MeshTest::Report, this);
     Simulator::Stop (Seconds (m_totalTime));
+    if (m_packetStats) {
+        PacketArena::ResetStats ();
+    }
     Simulator::Run ();
+    if (m_packetStats) {
+        PacketArena::PrintStats (std::cout);
+    }
     
     if (m_UdpTcpMode=="udp") {
         // Define variables to calculate the metrics
@@ -1413,6 +1336,10 @@ int MeshTest::Run (){
 	Ptr<Ipv4FlowClassifier> classifier = DynamicCast<Ipv4FlowClassifier>
 	(flowmon.GetClassifier ());
 	std::map<FlowId, FlowMonitor::FlowStats> stats = monitor->GetFlowStats ();
+        // The rows of the flows are written at once, after the loop
+        std::ostringstream grid;
+        grid << m_xSize << "x" << m_ySize;
+        Ptr<ResultSink> detSink = CreateFlowSink ("-det.txt", false);
         std::vector< Ptr<FlowProbe> > probes = monitor->GetAllProbes ();
 
 	for (std::map<FlowId, FlowMonitor::FlowStats>::const_iterator i = stats.begin ();i != stats.end (); ++i){
@@ -1456,12 +1383,9 @@ int MeshTest::Run (){
                 std::cout << "Throughput: " << throughput_value << " kbps\n";
                 std::cout << "Throughput2:" << throughput_value2 << " kbps\n";
 
-                //print all nodes statistics in files              
-                std::ostringstream os1;
-                os1 << m_filename << "-det.txt";
-                std::ofstream of1 (os1.str().c_str(), std::ios::out | std::ios::app);
-                of1 << m_xSize << "x" << m_ySize << " " << m_ac << " " << m_root << " " << t.sourceAddress << " -> " << t.destinationAddress << " " << pdf_value << " " << delay_value << " " << rxbitrate_value << " " << txbitrate_value << " " << throughput_value << " " << throughput_value2 << " " << i->second.txPackets << " " << i->second.rxPackets << " " << i->second.lostPackets << " " << i->second.packetsDropped.size() << " " << m_sink << " " << m_shuffle << " " <<m_arpwait <<"\n";
-                of1.close ();
+                //print all nodes statistics in files
+                detSink->Add (grid.str ()).Add (m_ac).Add (m_root).AddText (t.sourceAddress).Add ("->").AddText (t.destinationAddress).Add (pdf_value).Add (delay_value).Add (rxbitrate_value).Add (txbitrate_value).Add (throughput_value).Add (throughput_value2).Add (i->second.txPackets).Add (i->second.rxPackets).Add (i->second.lostPackets).Add (i->second.packetsDropped.size()).Add (m_sink).Add (m_shuffle).Add (m_arpwait);
+                detSink->EndRow ();
                 
                 // Accumulate for average statistics
                 totaltxPackets += i->second.txPackets;
@@ -1475,6 +1399,8 @@ int MeshTest::Run (){
             }
 	}
         
+        detSink->Write ();
+
 	// Average all nodes statistics
 	if (totaltxPackets != 0){
             pdf_total = (double) totalrxPackets / (double) totaltxPackets * 100;
@@ -1535,6 +1461,11 @@ int MeshTest::Run (){
         //monitor->CheckForLostPackets(Seconds(0.001));
 	Ptr<Ipv4FlowClassifier> classifier = DynamicCast<Ipv4FlowClassifier>(flowmon.GetClassifier ());
 	std::map<FlowId, FlowMonitor::FlowStats> stats = monitor->GetFlowStats ();
+        // The rows of the flows are written at once, after the loop
+        std::ostringstream grid;
+        grid << m_xSize << "x" << m_ySize;
+        Ptr<ResultSink> detSink = CreateFlowSink ("-det.txt", true);
+        Ptr<ResultSink> ackSink = CreateFlowSink ("-det-ack.txt", true);
 	for (std::map<FlowId, FlowMonitor::FlowStats>::const_iterator i = stats.begin ();i != stats.end (); ++i){
             // destination address, destination port, protocol, source address, source port
             Ipv4FlowClassifier::FiveTuple t = classifier->FindFlow (i->first); 
@@ -1577,12 +1508,9 @@ int MeshTest::Run (){
                 std::cout << "Throughput2:" << throughput_value2 << " kbps\n";
                 
                 if (t.sourceAddress != "10.1.1.1") {
-                    //print all nodes statistics in files              
-                    std::ostringstream os1;
-                    os1 << m_filename << "-det.txt";
-                    std::ofstream of1 (os1.str().c_str(), std::ios::out | std::ios::app);
-                    of1 << m_xSize << "x" << m_ySize << " " << m_ac << " " << m_root << " " << t.sourceAddress << " -> " << t.destinationAddress << " " << pdf_value << " " << delay_value << " " << rxbitrate_value << " " << txbitrate_value << " " << throughput_value << " " << throughput_value2 << " " << i->second.txPackets << " " << i->second.rxPackets << " " << i->second.lostPackets << " " << i->second.packetsDropped.size() << " " << m_sink << " " << m_shuffle << " " << m_step << " " << m_arpwait << " \n";
-                    of1.close ();
+                    //print all nodes statistics in files
+                    detSink->Add (grid.str ()).Add (m_ac).Add (m_root).AddText (t.sourceAddress).Add ("->").AddText (t.destinationAddress).Add (pdf_value).Add (delay_value).Add (rxbitrate_value).Add (txbitrate_value).Add (throughput_value).Add (throughput_value2).Add (i->second.txPackets).Add (i->second.rxPackets).Add (i->second.lostPackets).Add (i->second.packetsDropped.size()).Add (m_sink).Add (m_shuffle).Add (m_step).Add (m_arpwait);
+                    detSink->EndRow ();
 
                     // Accumulate for average statistics
                     totaltxPackets += i->second.txPackets;
@@ -1595,11 +1523,8 @@ int MeshTest::Run (){
                     throughput_total2 += throughput_value2;
                 } 
                 else { 
-                    std::ostringstream osx1;
-                    osx1 << m_filename << "-det-ack.txt";
-                    std::ofstream ofx1 (osx1.str().c_str(), std::ios::out | std::ios::app);
-                    ofx1 << m_xSize << "x" << m_ySize << " " << m_ac << " " << m_root << " " << t.sourceAddress << " -> " << t.destinationAddress << " " << pdf_value << " " << delay_value << " " << rxbitrate_value << " " << txbitrate_value << " " << throughput_value << " " << throughput_value2 << " " << i->second.txPackets << " " << i->second.rxPackets << " " << i->second.lostPackets << " " << i->second.packetsDropped.size() << " " << m_sink << " " << m_shuffle << " " << m_step << " " << m_arpwait <<" \n";
-                    ofx1.close ();
+                    ackSink->Add (grid.str ()).Add (m_ac).Add (m_root).AddText (t.sourceAddress).Add ("->").AddText (t.destinationAddress).Add (pdf_value).Add (delay_value).Add (rxbitrate_value).Add (txbitrate_value).Add (throughput_value).Add (throughput_value2).Add (i->second.txPackets).Add (i->second.rxPackets).Add (i->second.lostPackets).Add (i->second.packetsDropped.size()).Add (m_sink).Add (m_shuffle).Add (m_step).Add (m_arpwait);
+                    ackSink->EndRow ();
 
                     // Accumulate for average statistics
                     totaltxPacketsAck += i->second.txPackets;
@@ -1614,6 +1539,9 @@ int MeshTest::Run (){
             }
 	}
         
+        detSink->Write ();
+        ackSink->Write ();
+
 	// Average all nodes statistics
 	if (totaltxPackets != 0){
             pdf_total = (double) totalrxPackets / (double) totaltxPackets * 100;
@@ -1673,10 +1601,43 @@ int MeshTest::Run (){
     return 0;
 }
 
+Ptr<ResultSink> MeshTest::CreateFlowSink (std::string suffix, bool step){
+    const char *columns[] = {"grid", "ac", "root", "source", "->", "destination", "pdf", "delay", "rx-bitrate", "tx-bitrate", "throughput", "throughput2",
+                             "tx-packets", "rx-packets", "lost-packets", "dropped-packets", "sink", "shuffle", "step", "arp-wait"};
+    Ptr<ResultSink> sink = CreateObject<ResultSink> (m_filename + suffix);
+    for (unsigned int i = 0; i < sizeof (columns) / sizeof (columns[0]); i++) {
+        if (step || std::string (columns[i]) != "step") {
+            sink->AddColumn (columns[i]);
+        }
+    }
+    return sink;
+}
+
+void MeshTest::WarmUpRootPaths (double start){
+    if (m_warmUp <= 0) {
+        return;
+    }
+    for (NetDeviceContainer::Iterator i = meshDevices.Begin (); i != meshDevices.End (); ++i){
+        Ptr<ns3::dot11s::HwmpProtocol> hwmp = (*i)->GetObject<ns3::dot11s::HwmpProtocol> ();
+        if (hwmp != 0 && Mac48Address::ConvertFrom ((*i)->GetAddress ()) == Mac48Address (m_root.c_str ())) {
+            hwmp->ScheduleProactivePreq (Seconds (std::max (start - m_warmUp, 0.0)));
+        }
+    }
+}
 void MeshTest::Report (){
     std::ostringstream osf;
     osf << m_filename << "-stat.txt";
     std::ofstream osf1 (osf.str().c_str(), std::ios::out | std::ios::app);
+
+    // The path selection frames of each mesh point
+    Ptr<ResultSink> hwmpSink = CreateObject<ResultSink> (m_filename + "-hwmp.txt");
+    const char *columns[] = {"grid", "address", "root", "shuffle", "initiated-preq", "proactive-preq", "initiated-prep", "initiated-perr",
+                             "tx-preq", "tx-prep", "tx-perr", "tx-mgt-bytes"};
+    for (unsigned int i = 0; i < sizeof (columns) / sizeof (columns[0]); i++) {
+        hwmpSink->AddColumn (columns[i]);
+    }
+    std::ostringstream grid;
+    grid << m_xSize << "x" << m_ySize;
   
     for (NetDeviceContainer::Iterator i = meshDevices.Begin (); i != meshDevices.End (); ++i){
         Ptr<MeshPointDevice> mp = (*i)->GetObject<MeshPointDevice> ();
@@ -1684,8 +1645,13 @@ void MeshTest::Report (){
         osf1 << m_xSize<<"x"<<m_ySize<< " " << Mac48Address::ConvertFrom (mp->GetAddress ()) << " " << m_shuffle << " " << m_arpwait <<" ";
         mp->Report (osf1);
         hwmp->Report (osf1);
+        ns3::dot11s::HwmpProtocol::Overhead overhead = hwmp->GetOverhead ();
+        hwmpSink->Add (grid.str ()).AddText (Mac48Address::ConvertFrom (mp->GetAddress ())).Add (m_root).Add (m_shuffle)
+            .Add (overhead.initiatedPreq).Add (overhead.initiatedProactivePreq).Add (overhead.initiatedPrep).Add (overhead.initiatedPerr)
+            .Add (overhead.txPreq).Add (overhead.txPrep).Add (overhead.txPerr).Add (overhead.txMgtBytes).EndRow ();
     }
     osf1.close ();
+    hwmpSink->Dispose ();
 }
 
 int main (int argc, char *argv[]){
@@ -51,6 +51,7 @@
 #include "ns3/wifi-module.h"
 #include "ns3/mesh-module.h"
 #include "ns3/mobility-module.h"
+#include "ns3/topology-read-module.h"
 #include "ns3/mesh-helper.h"
 #include "ns3/mesh-module.h"
 #include "ns3/wifi-phy.h"
@@ -62,6 +63,7 @@
 #include "ns3/hwmp-protocol.h"
 #include "ns3/arp-l3-protocol.h"
 #include "ns3/flow-probe.h"
+#include "ns3/result-sink.h"
 
 // Crypto++ Includes
 #include "cryptopp/cryptlib.h"
@@ -102,12 +104,6 @@
 #include <string.h>
 
 #include "n_eq_coord.h"
-#include "n_eq_25.h"
-#include "n_eq_36.h"
-#include "n_eq_49.h"
-#include "n_eq_64.h"
-#include "n_eq_81.h"
-#include "n_eq_100.h"
 
 using namespace ns3;
 
@@ -142,6 +138,7 @@ class MeshTest{
         std::string m_root;
         std::string m_txrate;
         std::string m_input;
+        std::string m_topologyBank;
         int         m_node_num;
         int         m_ac;
         int         m_conn;
@@ -152,6 +149,7 @@ class MeshTest{
         std::string m_sinkIpAddress;
         bool        m_ActivateSecurityModule;
         std::string m_filename;
+        std::string m_outputDir;
         bool        m_randomTopology;
         std::string m_UdpTcpMode;
         int         m_arpOp;
@@ -159,6 +157,12 @@ class MeshTest{
         double      m_arpwait;
         bool        m_randomAppStart;
         int         m_typeOfOperation;
+        bool        m_aggregate;
+        double      m_snapshotInterval;
+        double      m_preqInterval;
+        double      m_warmUp;
+        bool        m_tabulatedError;
+        bool        m_packetStats;
         int*        m_obfVector01;
         int*        m_obfVector10;
         int*        m_obfVector10_plus_obfVector01;
@@ -186,6 +190,9 @@ class MeshTest{
 
         vector< vector< int > > meshNeighbors; 
 
+        /// The aggregation rounds, written when the run ends
+        Ptr<ResultSink> m_estimationSink;
+
     private:
         /// Create nodes and setup their mobility
         void CreateNodes ();
@@ -204,6 +211,15 @@ class MeshTest{
         void InstallSecureArp ();
         
         void InitializeSinkArpTable ();
+
+        /// Create the sink of the statistics of each flow, written to m_filename + suffix
+        Ptr<ResultSink> CreateFlowSink (std::string suffix, bool step);
+
+        /// Have the root refresh the paths towards it m_warmUp seconds before start
+        void WarmUpRootPaths (double start);
+
+        /// Record the estimation latency of an aggregation round
+        void RoundComplete (uint32_t round, Time latency, uint32_t received, uint32_t missing, uint32_t duplicates);
 };
 
 MeshTest::MeshTest () :
@@ -222,6 +238,7 @@ MeshTest::MeshTest () :
     m_root ("00:00:00:00:00:01"),
     //  m_root ("ff:ff:ff:ff:ff:ff"),
     m_txrate ("150kbps"),
+    m_topologyBank ("scratch/n_eq_topologies.csv"),
     m_node_num (0),
     m_ac (6),
     m_conn (0),
@@ -229,14 +246,25 @@ MeshTest::MeshTest () :
     m_sink (0),
     m_sinkIpAddress ("10.1.1.1"),
     m_ActivateSecurityModule (false),
+    m_outputDir ("."),
     m_UdpTcpMode ("tcp"),
     m_arpOp (1),
     m_arpwait (4), // default 1 s, 4s better since no failed node
     m_randomAppStart (false),
-    m_typeOfOperation (1)
+    m_typeOfOperation (1),
+    m_aggregate (false),
+    m_snapshotInterval (0),
+    m_preqInterval (0),
+    m_warmUp (0),
+    m_tabulatedError (false),
+    m_packetStats (false)
 {}
 
 void MeshTest::Configure (int argc, char *argv[]){
+    // The meters never move and the default propagation models are
+    // deterministic, so the link budgets between them are computed once.
+    Config::SetDefault ("ns3::YansWifiChannel::StaticLinkBudget", BooleanValue (true));
+
     CommandLine cmd;
     
     cmd.AddValue ("init-GatewaytoSMs", "Initial Starting time from Sink to SMs [5.4]", m_initstartGatewayToSMs);
@@ -266,11 +294,19 @@ void MeshTest::Configure (int argc, char *argv[]){
     cmd.AddValue ("security","Activate Security Module [false]", m_ActivateSecurityModule);
     cmd.AddValue ("UdpTcp", "UDP or TCP mode [udp]", m_UdpTcpMode);
     cmd.AddValue ("topology", "Topology file to read in node positions", m_input);
+    cmd.AddValue ("output-dir", "Directory of the output files [.]", m_outputDir);
+    cmd.AddValue ("topology-bank", "Bank of random topologies, CSV or binary [scratch/n_eq_topologies.csv]", m_topologyBank);
     cmd.AddValue ("arp-op", "ARP operations : 1. Normal [default], 2. Creation only, 3. Maintenance ony, 4. All pre-install arp table", m_arpOp);
     cmd.AddValue ("wait-arp", "When this timeout expires, the cache entries will be scanned and entries in WaitReply state will resend ArpRequest unless MaxRetries has been exceeded, in which case the entry is marked dead [1s]", m_arpwait);
     cmd.AddValue ("random-start", "Random start of the application [false]", m_randomAppStart);
     cmd.AddValue ("random-topology", "Random start of the application [false]", m_randomTopology);
     cmd.AddValue ("type-op", "1 = sink to SM and SM to sink, 2 = sink to SM only, 3=SM to sink only", m_typeOfOperation);
+    cmd.AddValue ("aggregate", "Aggregate the SM reports at the gateway instead of only receiving them, over UDP whatever the mode [false]", m_aggregate);
+    cmd.AddValue ("snapshot-interval", "Interval of the per-window flow statistics, seconds, zero for none [0]", m_snapshotInterval);
+    cmd.AddValue ("preq-interval", "Interval of the proactive PREQs of the root, seconds, zero for the HWMP default [0]", m_preqInterval);
+    cmd.AddValue ("warm-up", "Proactive PREQ of the root this many seconds before each traffic start, zero for none [0]", m_warmUp);
+    cmd.AddValue ("tabulated-error", "Look up the chunk success rates of the NIST error model in tables [false]", m_tabulatedError);
+    cmd.AddValue ("packet-stats", "Print the allocations of the packets during the run [false]", m_packetStats);
 
     cmd.Parse (argc, argv);
     
@@ -288,6 +324,9 @@ void MeshTest::CreateNodes (){
     
     // Configure YansWifiChannel, default ns3::NistErrorRateModel
     YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default ();
+    if (m_tabulatedError) {
+        wifiPhy.SetErrorRateModel ("ns3::TabulatedErrorRateModel");
+    }
 
     wifiPhy.Set ("EnergyDetectionThreshold", DoubleValue (-89.0) );
     wifiPhy.Set ("CcaMode1Threshold", DoubleValue (-62.0) );
@@ -318,6 +357,9 @@ void MeshTest::CreateNodes (){
     Config::SetDefault ("ns3::dot11s::HwmpProtocol::UnicastDataThreshold",UintegerValue (5));
     Config::SetDefault ("ns3::dot11s::HwmpProtocol::DoFlag", BooleanValue (true));
     Config::SetDefault ("ns3::dot11s::HwmpProtocol::RfFlag", BooleanValue (false));
+    if (m_preqInterval > 0) {
+        Config::SetDefault ("ns3::dot11s::HwmpProtocol::Dot11MeshHWMPpathToRootInterval", TimeValue (Seconds (m_preqInterval)));
+    }
 
     if (m_arpwait != 1.0) {
         Config::SetDefault ("ns3::ArpCache::WaitReplyTimeout", TimeValue (Seconds (m_arpwait)));
@@ -424,38 +466,21 @@ void MeshTest::CreateNodes (){
          mobility.SetPositionAllocator (position);*/
          
         int topoId = m_sink;//m_shuffle-1; 
-        switch (m_xSize) {
-            case 5:
-                //  for (unsigned int i = 0; i < m_xSize*m_ySize; i++)
-                for (unsigned int i = 0; i < sizeof array(n_eq_25[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_25[topoId][i]);
-                break;
-            case 6:
-                for (unsigned int i = 0; i < sizeof array(n_eq_36[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_36[topoId][i]);
-                break;
-            case 7:
-                for (unsigned int i = 0; i < sizeof array(n_eq_49[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_49[topoId][i]);
-                break;
-            case 8:
-                for (unsigned int i = 0; i < sizeof array(n_eq_64[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_64[topoId][i]);
-                break;
-            case 9:
-                for (unsigned int i = 0; i < sizeof array(n_eq_81[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_81[topoId][i]);
-                break;
-            case 10:
-                //  for (unsigned int i = 0; i < m_xSize*m_ySize; i++)
-                for (unsigned int i = 0; i < sizeof array(n_eq_100[topoId]); i++)           
-                    nodeCoords.push_back (n_eq_100[topoId][i]);
-                break;
+        Ptr<TopologyBank> bank = CreateObject<TopologyBank> ();
+        bank->SetFileName (m_topologyBank);
+        std::vector<Vector> positions;
+        if (!bank->GetPositions (m_xSize*m_ySize, topoId, positions)) {
+            std::cerr << "Error: no topology " << topoId << " of " << m_xSize*m_ySize << " nodes in " << m_topologyBank << "\n";
+            exit (EXIT_FAILURE);
         }
         
         Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
-        for (vector< coordinates >::iterator j = nodeCoords.begin (); j != nodeCoords.end (); j++){
-            positionAlloc->Add (Vector ((*j).X, (*j).Y, 0.0));
+        for (vector< Vector >::iterator j = positions.begin (); j != positions.end (); j++){
+            coordinates position;
+            position.X = (*j).x;
+            position.Y = (*j).y;
+            nodeCoords.push_back (position);
+            positionAlloc->Add (*j);
         }
         mobility.SetPositionAllocator (positionAlloc);
     }
@@ -463,7 +488,7 @@ void MeshTest::CreateNodes (){
     mobility.Install (nodes);
     
     if (m_pcap)
-        wifiPhy.EnablePcapAll (std::string ("mp-"));
+        wifiPhy.EnablePcapAll (SystemPath::Append (m_outputDir, "mp-"));
 }
 
 void MeshTest::InstallInternetStack (){
@@ -479,6 +504,7 @@ void MeshTest::InstallInternetStack (){
    then pair each packetsink of each node with onoff apps from sink
 */
 void MeshTest::InstallApplicationGatewayToSMs (){
+    WarmUpRootPaths (m_initstartGatewayToSMs);
     NS_LOG_INFO ("InstallApplicationGatewayToSMs");
     
     CryptoPP::AutoSeededRandomPool rng;
@@ -533,6 +559,9 @@ void MeshTest::InstallApplicationGatewayToSMs (){
     std::ofstream of (os.str().c_str(), std::ios::out | std::ios::app);
     
     m_dest_port = 9125;
+
+    // Every meter sends its own slice of one shared vector
+    Ptr<ObfuscationVector> obfs = Create<ObfuscationVector> (m_obfVector10_plus_obfVector01, m_size);
     
     for (i = 1; i < m_size; i++){
           
@@ -570,13 +599,7 @@ void MeshTest::InstallApplicationGatewayToSMs (){
             onoff.SetAttribute("TransMode", UintegerValue(0));
             onoff.SetAttribute("MeterSize", UintegerValue(m_size));
 
-            std::stringstream val;
-            val<<1<<"$"<<m_obfVector10_plus_obfVector01[i-1]<<"*";
-            std::string lead1_To_OddMeter_ObfsValue = val.str();
-
-            onoff.SetAttribute ("ObfsValues", StringValue (lead1_To_OddMeter_ObfsValue));
-            
-            //NS_LOG_INFO("Obfuscation Values String: " << lead1_To_OddMeter_ObfsValue);
+            onoff.SetObfuscationVector (obfs, i-1, 1);
 
             apps[i-1] = onoff.Install (nodes.Get(0));
         }
@@ -613,6 +636,7 @@ void MeshTest::InstallApplicationGatewayToSMs (){
 }
 
 void MeshTest::InstallApplicationSMsToGateway (){
+    WarmUpRootPaths (m_initstartSMsToGateway);
     /*int i =0;
     int displacement = 0;
     int *array = new int[m_ySize*m_xSize];
@@ -641,6 +665,13 @@ void MeshTest::InstallApplicationSMsToGateway (){
     UniformVariable rand_nodes (1,m_ySize*m_xSize-1);
     UniformVariable rand_port (9000,9100);
     UniformVariable rand_start (0.001, 0.009);
+    // Drawn from the ns-3 generator, so that the readings follow --RngRun.
+    // Only created to aggregate, so that the streams of the other
+    // variables of the run stay the same without --aggregate
+    Ptr<UniformRandomVariable> rand_reading;
+    if (m_aggregate) {
+        rand_reading = CreateObject<UniformRandomVariable> ();
+    }
     
     std::ostringstream os;
     os << m_filename <<"-time.txt";
@@ -677,7 +708,9 @@ void MeshTest::InstallApplicationSMsToGateway (){
             apps[i].Stop (Seconds (m_totalTime));
         }
         else {
-            OnOffHelperSGO onoff ("ns3::TcpSocketFactory", Address (InetSocketAddress(interfaces.GetAddress (0), m_dest_port)));
+            // The aggregator needs one report per packet, so the reports go over UDP
+            std::string protocol = m_aggregate ? "ns3::UdpSocketFactory" : "ns3::TcpSocketFactory";
+            OnOffHelperSGO onoff (protocol, Address (InetSocketAddress(interfaces.GetAddress (0), m_dest_port)));
             onoff.SetAttribute ("OnTime", StringValue ("ns3::ConstantRandomVariable[Constant=1.0]"));
             onoff.SetAttribute ("OffTime", StringValue ("ns3::ConstantRandomVariable[Constant=0.0]"));
             //onoff.SetAttribute ("DataRate", StringValue (m_drateSMsToSink));
@@ -688,14 +721,13 @@ void MeshTest::InstallApplicationSMsToGateway (){
             onoff.SetAttribute("MeterSize",UintegerValue(m_size));
 
             NS_LOG_INFO("---------SMs To Gateway--------");
-            /*int number = rand() % 50 + (50);
-            m_finalObfVector[i-1]= m_obfVector10_plus_obfVector01[i-1] + number;
-            std::stringstream val;
-            val<<1<<"$"<<m_finalObfVector[i-1]<<"*";
-            std::string OddMetersToLead1 = val.str();
-            onoff.SetAttribute ("ObfsValues", StringValue (OddMetersToLead1)); */
-            
-            //NS_LOG_INFO("Obfuscation Values String: " << OddMetersToLead1);
+            if (m_aggregate) {
+                // the reading of the meter masked with its obfuscation
+                // value, for the aggregator to sum
+                int number = rand_reading->GetInteger (50, 99);
+                m_finalObfVector[i-1]= m_obfVector10_plus_obfVector01[i-1] + number;
+                onoff.SetObfuscationVector (Create<ObfuscationVector> (&m_finalObfVector[i-1], 1), 0, 1);
+            }
 
             apps[i-1] = onoff.Install (nodes.Get(i /*m_source*/));
             
@@ -713,7 +745,20 @@ void MeshTest::InstallApplicationSMsToGateway (){
     }
   
     of.close ();
-    if (m_UdpTcpMode=="udp") {
+    if (m_aggregate) {
+        StateEstimationAggregatorHelper aggregator ("ns3::UdpSocketFactory", InetSocketAddress (interfaces.GetAddress (0), m_dest_port));
+        aggregator.SetAttribute ("Meters", UintegerValue (m_size-1));
+        ApplicationContainer receiver = aggregator.Install (nodes.Get (0));
+        m_estimationSink = CreateObject<ResultSink> (m_filename + "-estimation.txt");
+        const char *columns[] = {"round", "latency", "received", "missing", "duplicates"};
+        for (unsigned int c = 0; c < sizeof (columns) / sizeof (columns[0]); c++) {
+            m_estimationSink->AddColumn (columns[c]);
+        }
+        receiver.Get (0)->TraceConnectWithoutContext ("RoundComplete", MakeCallback (&MeshTest::RoundComplete, this));
+        receiver.Start (Seconds (0.1));
+        receiver.Stop (Seconds (m_totalTime+20));
+    }
+    else if (m_UdpTcpMode=="udp") {
         PacketSinkHelperTs sink ("ns3::UdpSocketFactory",InetSocketAddress (interfaces.GetAddress (0), m_dest_port));
         ApplicationContainer receiver = sink.Install (nodes.Get (0));
         receiver.Start (Seconds (0.1));
@@ -729,100 +774,32 @@ void MeshTest::InstallApplicationSMsToGateway (){
 }
 
 void MeshTest::InitializeSinkArpTable (){
-    typedef std::pair<Mac48Address, Ipv4Address> AddressMapping;
-    int x = 0;
-    Mac48Address mac;
-    Ptr<NetDevice> nd_sink;
-    Ptr<MeshPointDevice> mp_sink;
-    std::vector <AddressMapping> m_initArp;
-    std::vector <AddressMapping> m_ArpSink;
+    // The root is the gateway, every other mesh point is a meter
+    NodeContainer gateway;
+    NodeContainer meters;
     for (NetDeviceContainer::Iterator i = meshDevices.Begin (); i != meshDevices.End (); ++i){
-        Ptr<MeshPointDevice> mp = (*i)->GetObject<MeshPointDevice> ();
-        Ptr<NetDevice> nd = *i;
-        mac = Mac48Address::ConvertFrom (mp->GetAddress () );
-        AddressMapping arp;
-        if (mac != Mac48Address (m_root.c_str () ) ) {
-            arp = std::make_pair (Mac48Address::ConvertFrom (mp->GetAddress () ), interfaces.GetAddress (x) );
-            m_initArp.push_back (arp);
-            //   std::cout << Mac48Address::ConvertFrom (mp->GetAddress ()) << "," << interfaces.GetAddress (x) << std::endl;
+        if (Mac48Address::ConvertFrom ((*i)->GetAddress ()) == Mac48Address (m_root.c_str ())) {
+            gateway.Add ((*i)->GetNode ());
         }
-        else{
-            mp_sink = mp;
-            nd_sink = nd;
-            arp = std::make_pair (Mac48Address::ConvertFrom (mp->GetAddress () ), interfaces.GetAddress (x) );
-            m_ArpSink.push_back (arp);
+        else {
+            meters.Add ((*i)->GetNode ());
         }
-        x++;
     }
-    
-    // initialize arp table of sink
-    Ptr<Node> node = mp_sink->GetNode () ;
-    Ptr<ArpL3Protocol> arpL3 = node->GetObject<ArpL3Protocol> ();
-    Ptr<ArpCache> arpcache = arpL3->FindCache (nd_sink);
-    
+
     switch (m_arpOp) {
-        case 2:  // creation phase only
-            arpcache->SetAliveTimeout(Seconds (1000));
-            break;
-        case 3: // maintenance phase only
-            for (long index = 0; index < (long) m_initArp.size (); index++ ){
-                ArpCache::Entry *entry = arpcache->Lookup (m_initArp.at(index).second);
-                if (entry == 0 ){
-                    NS_LOG_LOGIC ("Add new entry to the ARP cache" );
-                    entry = arpcache->Add (m_initArp.at(index).second);
-                }
-                entry->SetMacAddress (m_initArp.at(index).first);
-            }
-            break;
+        case 2: // creation phase only
         case 4: // all pre-install, no arp broadcast request
-            arpcache->SetAliveTimeout(Seconds (1000));
-            for (long index = 0; index < (long) m_initArp.size (); index++ ){
-                ArpCache::Entry *entry = arpcache->Lookup (m_initArp.at(index).second);
-                if (entry == 0 ){
-                    NS_LOG_LOGIC ("Add new entry to the ARP cache" );
-                    entry = arpcache->Add (m_initArp.at(index).second);
-                }
-                entry->SetMacAddress (m_initArp.at(index).first);
-            }     
+            Config::Set ("/NodeList/*/$ns3::ArpL3Protocol/CacheList/*/AliveTimeout", TimeValue (Seconds (1000)));
             break;
     }
-    
-    // initialize arp table on every SMs
-    for (NetDeviceContainer::Iterator i = meshDevices.Begin (); i != meshDevices.End (); ++i) {
-        Ptr<MeshPointDevice> mp = (*i)->GetObject<MeshPointDevice> ();    
-        if (Mac48Address::ConvertFrom (mp->GetAddress () ) != Mac48Address (m_root.c_str () ) ) {
-            Ptr<NetDevice> nd = *i;
-            Ptr<Node> node = mp->GetNode ();
-            Ptr<ArpL3Protocol> arpL3 = node->GetObject<ArpL3Protocol> ();
-            Ptr<ArpCache> arpcache = arpL3->FindCache (nd);
-            
-            switch (m_arpOp) {
-                case 2: //creation phase only
-                    arpcache->SetAliveTimeout(Seconds (1000));
-                    break;
-                case 3: // maintenance phase only
-                    for (long index = 0; index < (long) m_ArpSink.size (); index++ ) {
-                        ArpCache::Entry *entry = arpcache->Lookup (m_ArpSink.at(index).second);
-                        if (entry == 0 ) {
-                            NS_LOG_LOGIC ("Add new entry to the ARP cache" );
-                            entry = arpcache->Add (m_ArpSink.at(index).second);
-                        }
-                        entry->SetMacAddress (m_ArpSink.at(index).first);
-                    }
-                    break;
-                case 4: // pre-configure all
-                    arpcache->SetAliveTimeout(Seconds (1000));
-                    for (long index = 0; index < (long) m_ArpSink.size (); index++ ) {
-                        ArpCache::Entry *entry = arpcache->Lookup (m_ArpSink.at(index).second);
-                        if (entry == 0 ) {
-                            NS_LOG_LOGIC ("Add new entry to the ARP cache" );
-                            entry = arpcache->Add (m_ArpSink.at(index).second);
-                        }
-                        entry->SetMacAddress (m_ArpSink.at(index).first);
-                    }
-                    break;
-            }         
-        }
+    if (m_arpOp == 3 || m_arpOp == 4) {
+        // The gateway and the meters know each other: the entries are
+        // refreshed by ARP in the maintenance phase only, and never
+        // expire when all are pre-installed
+        ArpCacheHelper arp;
+        arp.SetPermanent (m_arpOp == 4);
+        arp.PopulateStatic (gateway, meters);
+        arp.PopulateStatic (meters, gateway);
     }
 }
 
@@ -857,8 +834,10 @@ int MeshTest::Run (){
     m_finalObfVector = (int*) calloc(m_size, sizeof(int));
     m_obfVector10_plus_obfVector01 = (int*) calloc(m_size, sizeof(int));
     
+    // Drawn from the ns-3 generator, so that the values follow --RngRun
+    Ptr<UniformRandomVariable> rand_obfuscation = CreateObject<UniformRandomVariable> ();
     for(int z = 0; z < m_size; z++){
-        m_obfVector10_plus_obfVector01[z] = rand() % 40 + (-20); //-20 and 20        
+        m_obfVector10_plus_obfVector01[z] = (int) rand_obfuscation->GetInteger (0, 39) - 20; //-20 and 20
         //NS_LOG_INFO("FINAL VALUE("<<z<<"): "<< m_obfVector10_plus_obfVector01[z]);
     }
     
@@ -873,15 +852,15 @@ int MeshTest::Run (){
     privateKey.Initialize (prng, ECC_CURVE);    
     privateKey.MakePublicKey (publicKey);
     
-    CryptoPP::FileSink private_fs("private.ec.der", true);
+    CryptoPP::FileSink private_fs(SystemPath::Append (m_outputDir, "private.ec.der").c_str (), true);
     privateKey.Save(private_fs);
     
-    CryptoPP::FileSink public_fs("public.ec.der", true);
+    CryptoPP::FileSink public_fs(SystemPath::Append (m_outputDir, "public.ec.der").c_str (), true);
     publicKey.Save(public_fs);
     
 ////////////////////////////////////////////////////////////////////////////////
   
-    m_filename = tmp.str () ;
+    m_filename = SystemPath::Append (m_outputDir, tmp.str ());
     CreateNodes ();
 
     if (m_randomTopology) {
@@ -923,11 +902,21 @@ int MeshTest::Run (){
 
     // Install FlowMonitor on all nodes
     FlowMonitorHelper flowmon;
+    flowmon.SetMonitorAttribute ("SnapshotInterval", TimeValue (Seconds (m_snapshotInterval)));
     Ptr<FlowMonitor> monitor = flowmon.InstallAll();
+    if (m_snapshotInterval > 0) {
+        monitor->SetWindowSink (CreateObject<ResultSink> (m_filename + "-window.txt"));
+    }
     m_timeStart=clock();
     Simulator::Schedule (Seconds (m_totalTime), &MeshTest::Report, this);
     Simulator::Stop (Seconds (m_totalTime));
+    if (m_packetStats) {
+        PacketArena::ResetStats ();
+    }
     Simulator::Run ();
+    if (m_packetStats) {
+        PacketArena::PrintStats (std::cout);
+    }
     
     if (m_UdpTcpMode=="udp") {
         // Define variables to calculate the metrics
@@ -950,6 +939,10 @@ int MeshTest::Run (){
 	Ptr<Ipv4FlowClassifier> classifier = DynamicCast<Ipv4FlowClassifier>
 	(flowmon.GetClassifier ());
 	std::map<FlowId, FlowMonitor::FlowStats> stats = monitor->GetFlowStats ();
+        // The rows of the flows are written at once, after the loop
+        std::ostringstream grid;
+        grid << m_xSize << "x" << m_ySize;
+        Ptr<ResultSink> detSink = CreateFlowSink ("-det.txt", false);
         std::vector< Ptr<FlowProbe> > probes = monitor->GetAllProbes ();
 
 	for (std::map<FlowId, FlowMonitor::FlowStats>::const_iterator i = stats.begin ();i != stats.end (); ++i){
@@ -993,12 +986,9 @@ int MeshTest::Run (){
                 std::cout << "Throughput: " << throughput_value << " kbps\n";
                 std::cout << "Throughput2:" << throughput_value2 << " kbps\n";
 
-                //print all nodes statistics in files              
-                std::ostringstream os1;
-                os1 << m_filename << "-det.txt";
-                std::ofstream of1 (os1.str().c_str(), std::ios::out | std::ios::app);
-                of1 << m_xSize << "x" << m_ySize << " " << m_ac << " " << m_root << " " << t.sourceAddress << " -> " << t.destinationAddress << " " << pdf_value << " " << delay_value << " " << rxbitrate_value << " " << txbitrate_value << " " << throughput_value << " " << throughput_value2 << " " << i->second.txPackets << " " << i->second.rxPackets << " " << i->second.lostPackets << " " << i->second.packetsDropped.size() << " " << m_sink << " " << m_shuffle << " " <<m_arpwait <<"\n";
-                of1.close ();
+                //print all nodes statistics in files
+                detSink->Add (grid.str ()).Add (m_ac).Add (m_root).AddText (t.sourceAddress).Add ("->").AddText (t.destinationAddress).Add (pdf_value).Add (delay_value).Add (rxbitrate_value).Add (txbitrate_value).Add (throughput_value).Add (throughput_value2).Add (i->second.txPackets).Add (i->second.rxPackets).Add (i->second.lostPackets).Add (i->second.packetsDropped.size()).Add (m_sink).Add (m_shuffle).Add (m_arpwait);
+                detSink->EndRow ();
                 
                 // Accumulate for average statistics
                 totaltxPackets += i->second.txPackets;
@@ -1012,6 +1002,8 @@ int MeshTest::Run (){
             }
 	}
         
+        detSink->Write ();
+
 	// Average all nodes statistics
 	if (totaltxPackets != 0){
             pdf_total = (double) totalrxPackets / (double) totaltxPackets * 100;
@@ -1072,6 +1064,11 @@ int MeshTest::Run (){
         //monitor->CheckForLostPackets(Seconds(0.001));
 	Ptr<Ipv4FlowClassifier> classifier = DynamicCast<Ipv4FlowClassifier>(flowmon.GetClassifier ());
 	std::map<FlowId, FlowMonitor::FlowStats> stats = monitor->GetFlowStats ();
+        // The rows of the flows are written at once, after the loop
+        std::ostringstream grid;
+        grid << m_xSize << "x" << m_ySize;
+        Ptr<ResultSink> detSink = CreateFlowSink ("-det.txt", true);
+        Ptr<ResultSink> ackSink = CreateFlowSink ("-det-ack.txt", true);
 	for (std::map<FlowId, FlowMonitor::FlowStats>::const_iterator i = stats.begin ();i != stats.end (); ++i){
             // destination address, destination port, protocol, source address, source port
             Ipv4FlowClassifier::FiveTuple t = classifier->FindFlow (i->first); 
@@ -1114,12 +1111,9 @@ int MeshTest::Run (){
                 std::cout << "Throughput2:" << throughput_value2 << " kbps\n";
                 
                 if (t.sourceAddress != Ipv4Address (m_sinkIpAddress.c_str())) {
-                    //print all nodes statistics in files              
-                    std::ostringstream os1;
-                    os1 << m_filename << "-det.txt";
-                    std::ofstream of1 (os1.str().c_str(), std::ios::out | std::ios::app);
-                    of1 << m_xSize << "x" << m_ySize << " " << m_ac << " " << m_root << " " << t.sourceAddress << " -> " << t.destinationAddress << " " << pdf_value << " " << delay_value << " " << rxbitrate_value << " " << txbitrate_value << " " << throughput_value << " " << throughput_value2 << " " << i->second.txPackets << " " << i->second.rxPackets << " " << i->second.lostPackets << " " << i->second.packetsDropped.size() << " " << m_sink << " " << m_shuffle << " " << m_step << " " << m_arpwait << " \n";
-                    of1.close ();
+                    //print all nodes statistics in files
+                    detSink->Add (grid.str ()).Add (m_ac).Add (m_root).AddText (t.sourceAddress).Add ("->").AddText (t.destinationAddress).Add (pdf_value).Add (delay_value).Add (rxbitrate_value).Add (txbitrate_value).Add (throughput_value).Add (throughput_value2).Add (i->second.txPackets).Add (i->second.rxPackets).Add (i->second.lostPackets).Add (i->second.packetsDropped.size()).Add (m_sink).Add (m_shuffle).Add (m_step).Add (m_arpwait);
+                    detSink->EndRow ();
 
                     // Accumulate for average statistics
                     totaltxPackets += i->second.txPackets;
@@ -1132,11 +1126,8 @@ int MeshTest::Run (){
                     throughput_total2 += throughput_value2;
                 } 
                 else { 
-                    std::ostringstream osx1;
-                    osx1 << m_filename << "-det-ack.txt";
-                    std::ofstream ofx1 (osx1.str().c_str(), std::ios::out | std::ios::app);
-                    ofx1 << m_xSize << "x" << m_ySize << " " << m_ac << " " << m_root << " " << t.sourceAddress << " -> " << t.destinationAddress << " " << pdf_value << " " << delay_value << " " << rxbitrate_value << " " << txbitrate_value << " " << throughput_value << " " << throughput_value2 << " " << i->second.txPackets << " " << i->second.rxPackets << " " << i->second.lostPackets << " " << i->second.packetsDropped.size() << " " << m_sink << " " << m_shuffle << " " << m_step << " " << m_arpwait <<" \n";
-                    ofx1.close ();
+                    ackSink->Add (grid.str ()).Add (m_ac).Add (m_root).AddText (t.sourceAddress).Add ("->").AddText (t.destinationAddress).Add (pdf_value).Add (delay_value).Add (rxbitrate_value).Add (txbitrate_value).Add (throughput_value).Add (throughput_value2).Add (i->second.txPackets).Add (i->second.rxPackets).Add (i->second.lostPackets).Add (i->second.packetsDropped.size()).Add (m_sink).Add (m_shuffle).Add (m_step).Add (m_arpwait);
+                    ackSink->EndRow ();
 
                     // Accumulate for average statistics
                     totaltxPacketsAck += i->second.txPackets;
@@ -1151,6 +1142,9 @@ int MeshTest::Run (){
             }
 	}
         
+        detSink->Write ();
+        ackSink->Write ();
+
 	// Average all nodes statistics
 	if (totaltxPackets != 0){
             pdf_total = (double) totalrxPackets / (double) totaltxPackets * 100;
@@ -1203,6 +1197,9 @@ int MeshTest::Run (){
     }
     
     Simulator::Destroy ();
+    if (m_estimationSink != 0) {
+        m_estimationSink->Dispose ();
+    }
     m_timeEnd=clock();
     m_timeTotal=(m_timeEnd - m_timeStart)/(double) CLOCKS_PER_SEC;
     std::cout << "\n*** Simulation time: " << m_timeTotal << "s\n\n";
@@ -1210,10 +1207,43 @@ int MeshTest::Run (){
     return 0;
 }
 
+Ptr<ResultSink> MeshTest::CreateFlowSink (std::string suffix, bool step){
+    const char *columns[] = {"grid", "ac", "root", "source", "->", "destination", "pdf", "delay", "rx-bitrate", "tx-bitrate", "throughput", "throughput2",
+                             "tx-packets", "rx-packets", "lost-packets", "dropped-packets", "sink", "shuffle", "step", "arp-wait"};
+    Ptr<ResultSink> sink = CreateObject<ResultSink> (m_filename + suffix);
+    for (unsigned int i = 0; i < sizeof (columns) / sizeof (columns[0]); i++) {
+        if (step || std::string (columns[i]) != "step") {
+            sink->AddColumn (columns[i]);
+        }
+    }
+    return sink;
+}
+
+void MeshTest::WarmUpRootPaths (double start){
+    if (m_warmUp <= 0) {
+        return;
+    }
+    for (NetDeviceContainer::Iterator i = meshDevices.Begin (); i != meshDevices.End (); ++i){
+        Ptr<ns3::dot11s::HwmpProtocol> hwmp = (*i)->GetObject<ns3::dot11s::HwmpProtocol> ();
+        if (hwmp != 0 && Mac48Address::ConvertFrom ((*i)->GetAddress ()) == Mac48Address (m_root.c_str ())) {
+            hwmp->ScheduleProactivePreq (Seconds (std::max (start - m_warmUp, 0.0)));
+        }
+    }
+}
 void MeshTest::Report (){
     std::ostringstream osf;
     osf << m_filename << "-stat.txt";
     std::ofstream osf1 (osf.str().c_str(), std::ios::out | std::ios::app);
+
+    // The path selection frames of each mesh point
+    Ptr<ResultSink> hwmpSink = CreateObject<ResultSink> (m_filename + "-hwmp.txt");
+    const char *columns[] = {"grid", "address", "root", "shuffle", "initiated-preq", "proactive-preq", "initiated-prep", "initiated-perr",
+                             "tx-preq", "tx-prep", "tx-perr", "tx-mgt-bytes"};
+    for (unsigned int i = 0; i < sizeof (columns) / sizeof (columns[0]); i++) {
+        hwmpSink->AddColumn (columns[i]);
+    }
+    std::ostringstream grid;
+    grid << m_xSize << "x" << m_ySize;
   
     for (NetDeviceContainer::Iterator i = meshDevices.Begin (); i != meshDevices.End (); ++i){
         Ptr<MeshPointDevice> mp = (*i)->GetObject<MeshPointDevice> ();
@@ -1221,8 +1251,17 @@ void MeshTest::Report (){
         osf1 << m_xSize<<"x"<<m_ySize<< " " << Mac48Address::ConvertFrom (mp->GetAddress ()) << " " << m_shuffle << " " << m_arpwait <<" ";
         mp->Report (osf1);
         hwmp->Report (osf1);
+        ns3::dot11s::HwmpProtocol::Overhead overhead = hwmp->GetOverhead ();
+        hwmpSink->Add (grid.str ()).AddText (Mac48Address::ConvertFrom (mp->GetAddress ())).Add (m_root).Add (m_shuffle)
+            .Add (overhead.initiatedPreq).Add (overhead.initiatedProactivePreq).Add (overhead.initiatedPrep).Add (overhead.initiatedPerr)
+            .Add (overhead.txPreq).Add (overhead.txPrep).Add (overhead.txPerr).Add (overhead.txMgtBytes).EndRow ();
     }
     osf1.close ();
+    hwmpSink->Dispose ();
+}
+
+void MeshTest::RoundComplete (uint32_t round, Time latency, uint32_t received, uint32_t missing, uint32_t duplicates){
+    m_estimationSink->Add (round).Add (latency.GetSeconds ()).Add (received).Add (missing).Add (duplicates).EndRow ();
 }
 
 int main (int argc, char *argv[]){
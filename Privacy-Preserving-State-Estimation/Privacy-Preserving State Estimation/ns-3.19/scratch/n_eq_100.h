@@ -1,3074 +0,0 @@
-using namespace std;
-
-/*
-struct coordinates {
-	double X;
-	double Y;
-};
-
-
-template <typename T, int N> char (&array(T(&)[N]))[N];
-*/
-
-struct coordinates n_eq_100[30][100] = {
-{ //#1
-  { 629.0739902914321 , 151.6292413723873 },
-  { 665.8439224521071 , 38.46302649842697 },
-  { 776.1695293070092 , 83.03746504898635 },
-  { 875.9629401868351 , 18.230866272548298 },
-  { 256.0256274951217 , 592.1342413723873 },
-  { 721.5465882451971 , 596.51207470340745 },
-  { 597.742726523454 , 3.4176141983458166 },
-  { 658.491494994088 , 327.4213176650606 },
-  { 51.8880487510149 , 597.196175446671 },
-  { 3.7223969594454 , 359.43848051151971 },
-  { 752.343466421946 , 341.44758877354366 },
-  { 993.4879758342505 , 36.84500326768537 },
-  { 401.0373236756691 , 538.25643737825297 },
-  { 232.0654464290101 , 120.33309922022534 },
-  { 989.8693211752285 , 421.69623009501473 },
-  { 831.3885016362757 , 428.55647312745032 },
-  { 300.4036067588809 , 127.89525737600725 },
-  { 481.4860922518787 , 132.04794848863781 },
-  { 294.5628346210585 , 342.50490320193114 },
-  { 216.4679401868351 , 521.27922906885865 },
-  { 147.8283427598101 , 423.9631014030475 },
-  { 266.0445801158362 , 194.353428784234 },
-  { 983.9568236224522 , 359.15664341862235 },
-  { 749.6431232808152 , 250.93601998845924 },
-  { 510.9086067588809 , 630.9436201723176 },
-  { 451.4633932524066 , 621.26111546709176 },
-  { 880.9807205236878 , 75.58435796654248 },
-  { 198.8755409192368 , 31.308933809115118 },
-  { 196.9663247231524 , 645.56894066514134 },
-  { 702.3091138919904 , 3.8642325954552774 },
-  { 157.19556497967284 , 107.32965182856886 },
-  { 865.098611750396 , 279.7223063458637 },
-  { 674.4193738137667 , 221.25250545883495 },
-  { 299.5837610660581 , 25.29984461813244 },
-  { 638.3795085088279 , 599.19348033372853 },
-  { 245.5152719497531 , 416.27033280122393 },
-  { 433.5530295413568 , 167.0170747034075 },
-  { 50.4394792711868 , 277.4367171512563 },
-  { 368.76876219611773 , 186.9495026792094 },
-  { 179.2503397890781 , 316.21089997150534 },
-  { 969.981501196214 , 523.5249605727107 },
-  { 756.9910629401761 , 16.15420443057597 },
-  { 104.7157883630127 , 5.643790796261115 },
-  { 980.2404847534873 , 624.1061574093054 },
-  { 863.0219499084236 , 160.75042909920467 },
-  { 900.3093026054376 , 393.51300925790525 },
-  { 65.839434653449 , 652.63950210717731 },
-  { 524.7076487454053 , 29.24636427132326 },
-  { 718.2356042584403 , 144.45546465924542 },
-  { 551.8911898712277 , 684.57923285918943 },
-  { 379.9963452602507 , 290.5233086862857 },
-  { 571.3864935783205 , 255.700240324904 },
-  { 8.1232557231547 , 36.215703167010545 },
-  { 501.60384290670174 , 546.73766927969848 },
-  { 361.8942108322266 , 390.34510862045573 },
-  { 770.4951872064364 , 517.80382417694676 },
-  { 996.5737645883111 , 132.01762281502735 },
-  { 719.5453774532813 , 455.8281179732442 },
-  { 938.6682172367994 , 179.65535691905916 },
-  { 908.7484992765324 , 512.13154550370689 },
-  { 516.6740841074482 , 185.05181837913335 },
-  { 548.8755409192368 , 445.20394094739083 },
-  { 811.7983872019432 , 8.869296454096464 },
-  { 270.1122507685093 , 297.429116967398 },
-  { 653.8134023818372 , 268.0190243837028 },
-  { 435.70932604527644 , 338.43400878671582 },
-  { 424.6884497896123 , 479.6632790628424 },
-  { 613.7672606101347 , 477.43490374508596 },
-  { 570.4922492125652 , 60.713248369584804 },
-  { 524.1361288288316 , 288.05385963735637 },
-  { 334.7183937730042 , 531.3348187310877 },
-  { 554.7599416703508 , 580.5693670615116 },
-  { 659.8804840055399 , 533.02028201428996 },
-  { 467.5662268092167 , 225.86685895450566 },
-  { 952.7346029438978 , 268.59199267869565 },
-  { 71.9422162012735 , 459.90697040092346 },
-  { 613.5853479909883 , 682.06906391897402 },
-  { 657.551040342737 , 394.5437374396969 },
-  { 940.0912756411687 , 80.15887996786086 },
-  { 307.2671969809135 , 481.83001236265443 },
-  { 205.5931581392623 , 216.03242583346193 },
-  { 832.3190905081907 , 223.56597044136888 },
-  { 103.0839020536627 , 213.5101716823462 },
-  { 824.3599409840481 , 367.5174376195099 },
-  { 401.5728285752536 , 110.01155952028805 },
-  { 443.1940644918101 , 398.64543143126923 },
-  { 606.5630376323484 , 349.2749398999075 },
-  { 122.9403201277452 , 579.38372680812637 },
-  { 913.2099906720567 , 578.85790548340583 },
-  { 43.7792068279591 , 116.60818581173336 },
-  { 840.0210364784749 , 533.11699333507501 },
-  { 336.6013923376671 , 626.74640804136712 },
-  { 5.0290669893701 , 214.0790875616805 },
-  { 785.107808486289 , 146.18042037428745 },
-  { 782.705381237835 , 681.99626584421215 },
-  { 800.7500108026842 , 597.2671553231895 },
-  { 80.849209072984 , 369.9427718390388 },
-  { 880.0482473633542 , 676.34019820404359 },
-  { 512.1056087585617 , 358.37015582135115 },
-  { 410.8048011278671 , 27.82584390966261 }
-},
-{ //#2
-  { 638.7134264545841 , 382.0995083047004 },
-  { 722.8520623479714 , 297.9608724113131 },
-  { 934.3076692968802 , 494.7569078056165 },
-  { 115.0104987684804 , 287.67352544678732 },
-  { 623.3108215792938 , 128.97337910637083 },
-  { 931.186024408349 , 587.2166749736802 },
-  { 523.5174106994679 , 64.16678032993276 },
-  { 257.3230020553688 , 383.60252649427062 },
-  { 648.13093115724 , 488.12591793533335 },
-  { 349.965204371764 , 554.68926144317265 },
-  { 590.1210910240335 , 9.221997294570073 },
-  { 517.2899552661199 , 182.9937086703795 },
-  { 588.0454635715333 , 598.1674615314871 },
-  { 163.3486590983512 , 585.23568360256925 },
-  { 730.7731334736352 , 500.2126528842354 },
-  { 473.73130801271793 , 53.961409384975255 },
-  { 588.0918492500273 , 204.4923871848348 },
-  { 361.91728306540267 , 94.65838623929659 },
-  { 823.1515520490588 , 157.1712197429888 },
-  { 531.7911884378984 , 301.0967752541804 },
-  { 77.9523519267079 , 5.81143413945686 },
-  { 546.0762416235244 , 678.44919713996035 },
-  { 794.9117693670225 , 603.3512887776226 },
-  { 762.1349454557557 , 350.69117207215004 },
-  { 981.3556287709794 , 271.01277335579834 },
-  { 702.0342757241455 , 166.52254058295065 },
-  { 741.4138881630947 , 14.47214593459225 },
-  { 722.8520623479714 , 416.9508724113131 },
-  { 988.94106002106776 , 175.8093711031333 },
-  { 836.3970218946615 , 294.73068360256923 },
-  { 898.8348637388796 , 116.39252327269838 },
-  { 982.6619540553365 , 364.6712507728506 },
-  { 298.4739102657091 , 625.76036087855424 },
-  { 22.9997685584005 , 9.50569512666601 },
-  { 481.62704404189316 , 242.2514195989546 },
-  { 835.2570233608657 , 449.52917826056859 },
-  { 582.5267904772672 , 476.1370409943589 },
-  { 345.5818913499401 , 346.307466109222 },
-  { 234.32028668795124 , 432.84691509276945 },
-  { 41.93148561353405 , 419.83176370346554 },
-  { 393.19213091467697 , 7.324508392902828 },
-  { 324.1507534222372 , 177.5294720823311 },
-  { 365.7448785795053 , 498.51373346298834 },
-  { 402.4873196305052 , 592.2791330346522 },
-  { 245.97698905660752 , 121.42531219567306 },
-  { 663.3438683685426 , 197.6228560582793 },
-  { 54.473834783114 , 649.7464231350673 },
-  { 718.5650243951021 , 598.17047631933104 },
-  { 893.9225993564795 , 252.16399546228791 },
-  { 50.034552197335 , 534.33299687524405 },
-  { 790.92123181316 , 235.23568360256922 },
-  { 622.4238881630947 , 84.47214593459226 },
-  { 363.1592635875302 , 222.0877088562611 },
-  { 779.3946021049726 , 694.5911123348523 },
-  { 49.23007484093944 , 172.06447596877615 },
-  { 318.7780727915025 , 289.0118284690771 },
-  { 50.07498469834417 , 278.4704036235363 },
-  { 133.4268407877798 , 456.0420806848483 },
-  { 681.3718790635575 , 49.34026605202803 },
-  { 539.3145407550048 , 536.3224185514713 },
-  { 427.37609528310793 , 290.1488743291469 },
-  { 124.46256143246369 , 80.13503329712219 },
-  { 454.65814363060326 , 155.87153114659304 },
-  { 610.0123552779206 , 301.66499603951513 },
-  { 994.5380939375177 , 86.11019821270301 },
-  { 799.2038765631169 , 65.90047333526621 },
-  { 303.8030581899623 , 518.87568689455674 },
-  { 204.08241228310422 , 168.56183608067732 },
-  { 150.390193770926 , 384.1495944693277 },
-  { 719.0805530965421 , 214.85871645610047 },
-  { 568.7806039833795 , 400.25301569839786 },
-  { 3.9651426802644 , 102.12390879849478 },
-  { 497.99832285637183 , 597.4422808701953 },
-  { 687.8409264475807 , 662.16440164252555 },
-  { 191.80626790981404 , 524.84954404031826 },
-  { 244.1027831158708 , 549.62732736888893 },
-  { 242.9997685584005 , 209.49569512666602 },
-  { 237.8929190969893 , 662.07636630013184 },
-  { 511.3651745195962 , 450.2033596234993 },
-  { 758.37350770907 , 126.01288645341708 },
-  { 879.8314619114251 , 359.85478511547063 },
-  { 534.1027831158708 , 10.637327368888933 },
-  { 156.655125931601 , 654.09016163960905 },
-  { 433.9957469700152 , 553.0538056775157 },
-  { 448.4306881972554 , 474.69845948703977 },
-  { 375.2143125266756 , 397.0963778982848 },
-  { 309.35077881301737 , 21.163320416310548 },
-  { 836.3970218946615 , 294.73068360256923 },
-  { 230.48342774563758 , 26.1147037331135 },
-  { 100.1141346831403 , 372.75893770859474 },
-  { 881.9355463226876 , 684.5022736414593 },
-  { 478.4907258269767 , 396.8533920485681 },
-  { 986.6126014829389 , 431.81322298163605 },
-  { 898.6090928900344 , 28.42270149959139 },
-  { 147.16692379231876 , 196.93885185555973 },
-  { 672.6995178734273 , 562.28295542030581 },
-  { 302.4058720641264 , 422.07256337796369 },
-  { 210.2220170434278 , 297.8480948172129 },
-  { 894.9922307656767 , 177.5481868894576 },
-  { 824.8463994585156 , 538.23525294486046 }
-},
-{ //#3
-  { 646.1187146128465 , 273.72235057701755 },
-  { 727.9327395601617 , 253.02537372269626 },
-  { 205.7709568037294 , 126.07787015355841 },
-  { 62.8155728911819 , 325.4979716764612 },
-  { 724.1831784724269 , 363.5252435277252 },
-  { 683.4862016181056 , 475.3392684750404 },
-  { 309.3487824521715 , 160.55613570305724 },
-  { 167.8183918020329 , 455.02220423660106 },
-  { 13.386300295678 , 248.58972945758896 },
-  { 274.5883239627079 , 268.18841911056137 },
-  { 690.6931531634059 , 384.0479574319196 },
-  { 732.8480311425603 , 83.41223463173884 },
-  { 824.1091171336002 , 913.64002830934032 },
-  { 211.0514658456564 , 39.081910227805935 },
-  { 846.638734054602 , 48.62292548678045 },
-  { 410.64600844727835 , 112.15854254346782 },
-  { 813.2796124979316 , 540.1458672514784 },
-  { 225.8865543869679 , 483.8413683117456 },
-  { 33.9813345536859 , 534.21716832907657 },
-  { 311.0514658456564 , 39.081910227805935 },
-  { 324.3081639296662 , 115.70720832401454 },
-  { 327.447729972489 , 327.55941136253784 },
-  { 611.6759231618641 , 402.2645982265823 },
-  { 744.4237615129047 , 824.21203014128946 },
-  { 653.6091740472971 , 19.130366584420557 },
-  { 566.4562989062705 , 852.83130532421364 },
-  { 502.40127888303357 , 748.39435294662496 },
-  { 467.5383444177573 , 507.326532300866 },
-  { 992.4112305134671 , 101.20597515223596 },
-  { 950.3406085385973 , 506.8838346813241 },
-  { 309.307290158543 , 501.57299307933505 },
-  { 873.8730335689569 , 259.79229967907276 },
-  { 743.9896209707688 , 498.3426014835241 },
-  { 99.4782686292115 , 418.70176107844647 },
-  { 429.5886729715932 , 28.71124839826207 },
-  { 362.8484718324572 , 226.14728361990302 },
-  { 854.3421629761949 , 484.62216994101095 },
-  { 477.2212694574306 , 595.2798356453218 },
-  { 821.2264452733102 , 97.29158379615393 },
-  { 799.8398197811698 , 657.9778647510378 },
-  { 729.786524428919 , 594.0394148154569 },
-  { 541.3429853015997 , 223.97256749078304 },
-  { 547.6780370247375 , 551.0303611818999 },
-  { 372.0221685230483 , 383.8850182174399 },
-  { 592.3247935137497 , 91.1247036949649 },
-  { 853.4779695517699 , 823.31569714553854 },
-  { 940.0494111423953 , 26.87310235296378 },
-  { 236.1306920513684 , 697.40574387477304 },
-  { 839.4534008534321 , 722.60206053642725 },
-  { 549.0436016068678 , 3.455768538574759 },
-  { 198.7907719160999 , 342.77276003096318 },
-  { 209.16820483941 , 224.3346469554201 },
-  { 792.6123082781731 , 184.81661944356935 },
-  { 920.6512169462526 , 735.38510180084273 },
-  { 755.8592569721892 , 16.16912655939322 },
-  { 407.5826689376457 , 746.42658904843154 },
-  { 458.4349831000261 , 429.82434717574097 },
-  { 396.0410360693975 , 666.352506962311 },
-  { 553.3639691325448 , 143.15290918032264 },
-  { 554.7740910346055 , 321.7641230127072 },
-  { 264.2270111220822 , 835.65553010798968 },
-  { 269.0010246430544 , 399.24408502751874 },
-  { 512.2950921862849 , 72.943051455019 },
-  { 632.2310924823794 , 176.07787015355842 },
-  { 132.7360924823794 , 669.30351785723735 },
-  { 866.6355135650548 , 184.6277805631068 },
-  { 308.7880556900504 , 635.90784417186495 },
-  { 89.5026724854133 , 757.70532620398663 },
-  { 936.8865718436986 , 267.8104749633496 },
-  { 661.96327012639 , 710.10616180607326 },
-  { 374.0988303650207 , 562.8568954640989 },
-  { 993.6091740472971 , 733.02537372269626 },
-  { 68.7286228603318 , 52.17277633253994 },
-  { 108.4395394905183 , 523.61122895416628 },
-  { 894.3817348425339 , 633.38182033412332 },
-  { 111.4302580064457 , 246.99457912076699 },
-  { 102.009927795976 , 138.96597150512946 },
-  { 561.825061473756 , 461.9494820770203 },
-  { 451.34138290641 , 311.19644678681465 },
-  { 429.5377014589301 , 814.96669323912147 },
-  { 659.2512342411824 , 630.6502120325405 },
-  { 694.7993638266347 , 142.50195131030367 },
-  { 930.2040447856008 , 417.54557309173384 },
-  { 802.5071781107212 , 424.7449342862409 },
-  { 597.9384076831041 , 653.4785160352247 },
-  { 47.8116382292737 , 658.75243046695448 },
-  { 210.8582995092488 , 615.4512691817308 },
-  { 1060.749390843338 , 88.76813330801788 },
-  { 613.042357997868 , 551.5135602496164 },
-  { 729.9575533394845 , 741.5288650248573 },
-  { 542.6468309068712 , 655.6054425002238 },
-  { 865.5867310163889 , 344.5882236240938 },
-  { 454.90409498281997 , 185.86372514047557 },
-  { 660.0012056428334 , 926.1799093027881 },
-  { 915.8006307080176 , 104.17666236017106 },
-  { 993.865094567598 , 193.9795553108787 },
-  { 769.0830722607934 , 299.4048425689031 },
-  { 345.3229954951449 , 802.02637162687593 },
-  { 972.5202143272813 , 326.3306632630569 },
-  { 657.924543800861 , 827.20803205612911 }
-},
-{ //#4
-  { 760.5956507036733 , 78.2428740105936 },
-  { 819.305313639067 , 195.28352875314744 },
-  { 769.7461321347499 , 182.83335536324597 },
-  { 855.7489052646512 , 122.61356531074964 },
-  { 868.5439676287576 , 226.82098577157203 },
-  { 856.50878830157 , 35.53959385406534 },
-  { 769.7461321347499 , 287.823355363246 },
-  { 813.0204819912026 , 359.75316808606215 },
-  { 961.49878830157 , 35.53959385406534 },
-  { 682.5181115296497 , 521.5123133094901 },  //
-  { 747.1564098240906 , 438.77906428832034 },
-  { 664.2867893563987 , 418.11734732073836 },
-  { 588.9713365551129 , 473.84785074183515 },
-  { 619.667441833953 , 373.44541441327607 },
-  { 558.2752312762727 , 373.44541441327607 },
-  { 764.1382130022268 , 385.67365308131264 },
-  { 701.9118403791597 , 320.1007383427971 },
-  { 652.6396181972223 , 327.42082771189087 },
-  { 226.88068907353474 , 377.0970410122321 },  //
-  { 277.7808511031976 , 285.27071795966697 },
-  { 311.9622516396545 , 186.00072270749467 },
-  { 346.14365217611135 , 285.27071795966697 },
-  { 381.74909564037506 , 270.65893408986966 },
-  { 342.4191493976385 , 368.00396698083665 },
-  { 486.33957699302744 , 361.50845265879303 },
-  { 407.1026181654386 , 192.62881520507966 },
-  { 486.483345277154 , 277.98266626826535 },
-  { 578.9083072709155 , 170.4306710787948 }, //
-  { 495.05956507105026 , 233.6152303595283 },
-  { 676.9249162488568 , 132.80562005603366 },
-  { 584.4030593168623 , 275.27678593267746 },
-  { 407.0075421424602 , 290.796882645756 },
-  { 547.5545650710503 , 142.6912232162001 },
-  { 596.4979101657952 , 65.31934891504392 },
-  { 676.9249162488568 , 237.79562005603367 },
-  { 505.2442091121198 , 65.50462815005994 },
-  { 39.002147876209214 , 600.1225439719858 },  //
-  { 138.27214312838146 , 565.9411434355288 },
-  { 83.37283917636525 , 695.2757985329637 },
-  { 818.69914921144294 , 498.45487229453903 },
-  { 71.44584211563492 , 500.27112032615764 },
-  { 189.1723051580443 , 474.11482038296367 },
-  { 82.42028547410581 , 395.85626653144266 },
-  { 132.7773910824348 , 670.7872582894115 },
-  { 9.488103159615719 , 471.3797521689977 },
-  { 39.002147876209214 , 300.1225439719858 }, //
-  { 138.27214312838146 , 265.9411434355288 },
-  { 140.37283917636525 , 445.2757985329637 },
-  { 218.69914921144294 , 198.45487229453903 },
-  { 71.44584211563492 , 200.27112032615764 },
-  { 189.1723051580443 , 174.11482038296367 },
-  { 82.42028547410581 , 95.85626653144266 },
-  { 132.7773910824348 , 370.7872582894115 },
-  { 9.488103159615719 , 171.3797521689977 },
-  { 479.6616519972285 , 562.5956641809709 }, //
-  { 584.5077668511112 , 557.1009121350242 },
-  { 691.7127044870048 , 42.8934916742018 },
-  { 555.1851376347835 , 635.52784649546106 },
-  { 553.8116615722711 , 456.6984758064651 },
-  { 452.48824045191486 , 461.18311167888163 },
-  { 411.465379271826 , 364.53930711490995 },
-  { 395.8129097973632 , 509.4111049002374 },
-  { 498.7805221725146 , 377.37000603664686 },
-  { 279.6616519972285 , 562.5956641809709 }, //
-  { 384.5077668511112 , 557.1009121350242 },
-  { 441.7127044870048 , 652.8934916742018 },
-  { 355.1851376347835 , 635.52784649546106 },
-  { 353.8116615722711 , 456.6984758064651 },
-  { 252.48824045191486 , 461.18311167888163 },
-  { 191.465379271826 , 314.53930711490995 },
-  { 195.8129097973632 , 509.4111049002374 },
-  { 298.7805221725146 , 377.37000603664686 },
-  { 799.6616519972285 , 762.5956641809709 }, //
-  { 904.5077668511112 , 757.1009121350242 },
-  { 961.7127044870048 , 652.8934916742018 },
-  { 875.1851376347835 , 835.52784649546106 },
-  { 873.8116615722711 , 656.6984758064651 },
-  { 772.48824045191486 , 661.18311167888163 },
-  { 731.465379271826 , 564.53930711490995 },
-  { 715.8129097973632 , 709.4111049002374 },
-  { 818.7805221725146 , 577.37000603664686 },
-  { 201.6827605439991 , 18.65190143046844 }, //
-  { 259.6845681394777 , 68.58631649682118 },
-  { 363.6821562696465 , 32.77707518807843 },
-  { 327.4011738105468 , 145.25961928602453 },
-  { 442.3179968517056 , 25.57084837830341 },
-  { 413.6165713359992 , 120.77888278355698 },
-  { 261.60415832351447 , 168.55956448707263 },
-  { 167.65374204688624 , 79.57339789828734 },
-  { 287.52463554081174 , 2.575809768118532 },
-  { 960.5956507036733 , 198.2428740105936 }, //
-  { 919.305313639067 , 285.28352875314744 },
-  { 869.7461321347499 , 302.83335536324597 },
-  { 895.7489052646512 , 542.61356531074964 },
-  { 968.5439676287576 , 346.82098577157203 },
-  { 956.50878830157 , 455.53959385406534 },
-  { 869.7461321347499 , 407.823355363246 },
-  { 993.0204819912026 , 539.75316808606215 },
-  { 999.49878830157 , 255.53959385406534 },
-  { 969.7461321347499 , 125.83335536324597 }
-},
-{ //#5
-  { 649.8280600672575 , 52.156438388207334 }, //#11
-  { 749.6794837130857 , 19.71274414878159 },
-  { 583.7557122109351 , 133.74899288157474 },
-  { 844.8327382740636 , 64.08343544893762 },
-  { 684.0094606037144 , 221.4264336403796 },
-  { 688.6018270648178 , 139.24374492752142 },
-  { 787.2601553211304 , 175.15243977528337 },
-  { 592.1831375511492 , 202.32659567004254 },
-  { 782.6677888600269 , 115.51773879261765 },
-  { 896.8687148098113 , 110.86610132360104 },
-  { 378.1155628900633 , 368.4430264392819 }, //#10
-  { 483.0416058187982 , 364.7789282804863 },
-  { 419.465660303372 , 261.0815294014028 },
-  { 499.465660303372 , 156.09152940140281 },
-  { 284.5687879155266 , 416.10748900693693 },
-  { 385.9813404176159 , 443.28090055225056 },
-  { 646.7390046978817 , 390.20298276506014 },
-  { 521.2943087223287 , 258.78724600244504 },
-  { 606.7720411224651 , 484.2640207552304 },
-  { 560.6242549650652 , 356.13227889341204 },
-  { 306.6211022630397 , 127.74208487555487 }, //#8
-  { 409.31681886408194 , 105.91343645659826 },
-  { 368.2939576839931 , 9.269631892626563 },
-  { 469.2168231405572 , 38.20879787985331 },
-  { 211.4678477020618 , 83.37139357539886 },
-  { 34.80196934584217 , 49.18324123832427 },
-  { 567.2334321184984 , 75.83384890261438 },
-  { 378.2241100860014 , 204.52691000855157 },
-  { 252.5472547782331 , 37.74808997484011 },
-  { 889.062080537455 , 178.5295655036566 },
-  { 193.60468336224767 , 51.595142461046265 },  //#9
-  { 101.7783603096825 , 102.4953044907092 },
-  { 130.4201240815141 , 135.44388466091152 },
-  { 224.78451100246366 , 181.46847136229675 },
-  { 287.9690702831972 , 5.570555759661069 },
-  { 265.8073721825525 , 638.11227592626847 },
-  { 343.8301474094241 , 207.86025356465194 },
-  { 351.15387958781986 , 312.5945032014309 },
-  { 12.74179069421936 , 158.13152804255338 },
-  { 346.6787332185909 , 92.6112105022149 },
-  { 678.1155628900633 , 518.4430264392819 }, //#10
-  { 783.0416058187982 , 514.7789282804863 },
-  { 919.465660303372 , 411.0815294014028 },
-  { 799.465660303372 , 666.09152940140281 },
-  { 584.5687879155266 , 566.10748900693693 },
-  { 685.9813404176159 , 593.28090055225056 },
-  { 946.7390046978817 , 541.20298276506014 },
-  { 821.2943087223287 , 408.78724600244504 },
-  { 906.7720411224651 , 634.2640207552304 },
-  { 860.6242549650652 , 506.13227889341204 },
-  { 378.1155628900633 , 518.4430264392819 }, //#10
-  { 483.0416058187982 , 514.7789282804863 },
-  { 419.465660303372 , 411.0815294014028 },
-  { 619.465660303372 , 306.09152940140281 },
-  { 284.5687879155266 , 566.10748900693693 },
-  { 385.9813404176159 , 593.28090055225056 },
-  { 646.7390046978817 , 651.20298276506014 },
-  { 521.2943087223287 , 408.78724600244504 },
-  { 606.7720411224651 , 634.2640207552304 },
-  { 560.6242549650652 , 506.13227889341204 },
-  { 70.04445423959194 , 382.88302768492144 }, //#7
-  { 133.22901352032545 , 299.03428548505616 },
-  { 231.88734177663798 , 334.94298033281814 },
-  { 42.305006376997255 , 246.53928548505615 },
-  { 287.52356532848216 , 245.90641071735496 },
-  { 117.82849201455221 , 173.607103170566 },
-  { 281.85430535205455 , 508.0040183229884 },
-  { 495.4302508674807 , 621.7014172020719 },
-  { 46.42684304402958 , 485.18214078672327 },
-  { 186.11101282639288 , 218.73299917204136 },
-  { 30.04445423959194 , 582.88302768492144 }, //#7
-  { 93.22901352032545 , 499.03428548505616 },
-  { 191.88734177663798 , 534.94298033281814 },
-  { 2.305006376997255 , 446.53928548505615 },
-  { 247.52356532848216 , 445.90641071735496 },
-  { 7.82849201455221 , 323.607103170566 },
-  { 171.85430535205455 , 638.0040183229884 },
-  { 155.4302508674807 , 741.7014172020719 },
-  { 6.42684304402958 , 685.18214078672327 },
-  { 146.11101282639288 , 418.73299917204136 },
-  { 792.2104503863111 , 280.1494440652378 }, //#2
-  { 730.4988767481243 , 365.0881383046635 },
-  { 679.5987147184613 , 456.9144613572287 },
-  { 896.8009317389634 , 270.99896263416116 },
-  { 691.287584929747 , 291.2102780780111 },
-  { 991.826922224494 , 272.83129078601155 },
-  { 784.1891960711137 , 466.0649427883053 },
-  { 968.6332598908137 , 166.02495311969165 },
-  { 862.7245650430518 , 364.6832813760042 },
-  { 821.8142470938748 , 564.0815517662465 },
-  { 538.2434668064981 , 727.89863025832824 }, //#3
-  { 523.6316829367008 , 623.93038572115077 },
-  { 476.5318931683113 , 642.95993601890252 },
-  { 607.1231042602114 , 807.1355890859171 },
-  { 616.2735856912881 , 702.54510773326473 },
-  { 514.1569441910723 , 544.94332704096128 },
-  { 716.6760220198472 , 671.84900245442464 },
-  { 816.5274456656754 , 704.29269669385036 },
-  { 385.6078860249831 , 695.45493601890252 },
-  { 632.8272798199819 , 735.03356173515817 }
-},
-{ //#6
-  { 82.64384548608064 , 531.0842828893349 },
-  { 97.244465667071516 , 419.212934587618 },
-  { 446.28103528253462 , 173.5767110357737 },
-  { 986.2479988579511 , 200.5156730456035 },
-  { 842.4952691319088 , 263.5279771287605 },
-  { 128.84747349003322 , 105.9977597206147 },
-  { 259.28009426490553 , 491.92496930579887 },
-  { 187.63384548608065 , 961.0842828893349 },
-  { 672.48926403262357 , 617.6018246135671 },
-  { 869.24705784032201 , 388.86393131562863 },
-  { 20.932271847893894 , 616.0229771287607 },
-  { 177.7971000470585 , 575.4549741894909 },
-  { 54.60833253325761 , 880.2369006773903 },
-  { 123.23138494969572 , 639.6405883243231 },
-  { 281.494498926142 , 891.8790286740648 },
-  { 106.80733046512186 , 743.3379872034066 },
-  { 771.66582120380554 , 41.9457367920246 },
-  { 42.72665521657882 , 717.02287133546054 },
-  { 547.5727700704615 , 51.5281192895138 },
-  { 844.35541912426737 , 841.0229771287607 },
-  { 246.57681410837728 , 96.01183170790216 },
-  { 243.6254143764396 , 581.8415765923037 },
-  { 905.91121449731236 , 200.8716135353258 },
-  { 348.31666388036865 , 226.2887457539546 },
-  { 782.24431602404627 , 354.69619126058717 },
-  { 75.3478368282882 , 178.68934999303832 },
-  { 486.3406137800247 , 597.3737807200115 },
-  { 124.63765620517887 , 271.3900177672971 },
-  { 16.6381738928945 , 265.73000473559216 },
-  { 100.74721664729728 , 76.81800169132144 },
-  { 799.08707051154389 , 133.41982032167994 },
-  { 187.23433654818334 , 875.8517160624168 },
-  { 214.25424612978458 , 736.2843928882947 },
-  { 903.75022565369096 , 294.5992792058129 },
-  { 12.974075734098948 , 370.65604766432705 },
-  { 563.263176752891 , 888.48406268531306 },
-  { 869.78859625836486 , 666.8916439904579 },
-  { 589.2616379282838 , 670.8781462077668 },
-  { 450.1880121820855 , 410.88936593494543 },
-  { 181.4611982058541 , 680.3810171182258 },
-  { 452.02034033393585 , 305.9153564204759 },
-  { 333.61144476127157 , 342.83934461424343 },
-  { 367.64251859360144 , 661.9725159137232 },
-  { 297.91855341071584 , 695.5764275531483 },
-  { 492.04928443290653 , 208.59593697502368 },
-  { 730.45219319985296 , 733.0322599607448 },
-  { 84.25032507252178 , 963.119436757146 },
-  { 730.98224849473004 , 277.83940522399917 },
-  { 529.4249710096743 , 549.7690033886588 },
-  { 695.07777007046145 , 220.60411214618563 },
-  { 955.32185758659514 , 664.9405296308498 },
-  { 681.87730755779509 , 365.66892760658135 },
-  { 190.7100040615013 , 189.79746327392974 },
-  { 940.5887295840095 , 112.9552364678667 },
-  { 272.3852053491823 , 627.8860171182258 },
-  { 552.4871252838874 , 434.50697713050783 },
-  { 963.1984082933781 , 514.3553054513139 },
-  { 726.21134035621927 , 503.45207554439355 },
-  { 224.2646078358923 , 232.89062202284236 },
-  { 798.78242184025248 , 448.6405886499091 },
-  { 633.08462604262604 , 299.45906103323654 },
-  { 221.80452092008957 , 300.64452872128356 },
-  { 547.9290351816978 , 234.57368467678845 },
-  { 607.447746236546 , 409.5169810270423 },
-  { 351.57017073727906 , 955.3799614203558 },
-  { 803.2787816545393 , 544.4448124628341 },
-  { 23.167644622401397 , 452.7095823491352 },
-  { 434.3412505817539 , 530.6531326749041 },
-  { 381.5461882176475 , 386.4457122140817 },
-  { 421.71636607840804 , 751.9665108144379 },
-  { 271.48258768594593 , 167.89972360860133 },
-  { 255.6159961061099 , 386.99892637706404 },
-  { 545.1106874679256 , 492.62570760537847 },
-  { 769.5142907274595 , 648.2739427496745 },
-  { 729.1384417838937 , 413.5675237429904 },
-  { 893.40080650359837 , 758.5289554044937 },
-  { 231.329731446726 , 814.4252005498092 },
-  { 308.21206494226243 , 444.7106929159603 },
-  { 412.94631457904137 , 242.034425094356 },
-  { 522.4463708262358 , 717.7851102779811 },
-  { 555.0107688618167 , 149.5407953985502 },
-  { 323.0580378220955 , 787.8752056621998 },
-  { 664.3664889780643 , 137.2355561689153 },
-  { 121.88276396151241 , 846.4796855664483 },
-  { 299.46684789281835 , 302.8611581857274 },
-  { 372.8503632367033 , 527.44394193713 },
-  { 411.9094638213459 , 461.13474740053414 },
-  { 898.4325557339919 , 431.99480441859157 },
-  { 391.96230570254255 , 621.5883268308761 },
-  { 331.73382374583946 , 850.6308441700357 },
-  { 83.22609809571543 , 292.6332724374554 },
-  { 169.0957737780459 , 484.7203557351911 },
-  { 624.91989082726977 , 527.4013627056231 },
-  { 516.0807529993576 , 797.9910975158232 },
-  { 175.7879061991543 , 395.3721986311332 },
-  { 195.12763631166445 , 29.27871421801464 },
-  { 592.21103456168777 , 301.7764102106137 },
-  { 912.95819926612077 , 560.3997459772361 },
-  { 758.81575299408001 , 193.0319630414967 },
-  { 381.63240399041146 , 106.564742512089 }
-},
-{ //#7
-  { 619.0739902914321 , 141.6292413723873 },
-  { 665.8439224521071 , 68.46302649842697 },
-  { 776.1695293070092 , 83.03746504898635 },
-  { 875.9629401868351 , 18.230866272548298 },
-  { 256.0256274951217 , 592.1342413723873 },
-  { 721.5465882451971 , 596.51207470340745 },
-  { 597.742726523454 , 3.4176141983458166 },
-  { 658.491494994088 , 777.4213176650606 },
-  { 51.8880487510149 , 537.196175446671 },
-  { 3.7223969594454 , 359.43848051151971 },
-  { 752.343466421946 , 341.44758877354366 },
-  { 999.4879758342505 , 36.84500326768537 },
-  { 401.0373236756691 , 588.25643737825297 },
-  { 232.0654464290101 , 120.33309922022534 },
-  { 989.8693211752285 , 421.69623009501473 },
-  { 811.3885016362757 , 438.55647312745032 },
-  { 300.4036067588809 , 127.89525737600725 },
-  { 481.4860922518787 , 112.04794848863781 },
-  { 294.5628346210585 , 342.50490320193114 },
-  { 216.4679401868351 , 521.27922906885865 },
-  { 147.8283427598101 , 423.9631014030475 },
-  { 266.0445801158362 , 194.353428784234 },
-  { 983.9568236224522 , 359.15664341862235 },
-  { 749.6431232808152 , 250.93601998845924 },
-  { 510.9086067588809 , 790.9436201723176 },
-  { 451.4633932524066 , 681.26111546709176 },
-  { 880.9807205236878 , 75.58435796654248 },
-  { 198.8755409192368 , 31.308933809115118 },
-  { 196.9663247231524 , 645.56894066514134 },
-  { 702.3091138919904 , 3.8642325954552774 },
-  { 157.19556497967284 , 107.32965182856886 },
-  { 865.098611750396 , 279.7223063458637 },
-  { 674.4193738137667 , 221.25250545883495 },
-  { 299.5837610660581 , 25.29984461813244 },
-  { 638.3795085088279 , 599.19348033372853 },
-  { 245.5152719497531 , 416.27033280122393 },
-  { 413.5530295413568 , 747.0170747034075 },
-  { 50.4394792711868 , 277.4367171512563 },
-  { 368.76876219611773 , 186.9495026792094 },
-  { 179.2503397890781 , 316.21089997150534 },
-  { 969.981501196214 , 523.5249605727107 },
-  { 756.9910629401761 , 16.15420443057597 },
-  { 104.7157883630127 , 5.643790796261115 },
-  { 980.2404847534873 , 624.1061574093054 },
-  { 863.0219499084236 , 160.75042909920467 },
-  { 900.3093026054376 , 393.51300925790525 },
-  { 65.839434653449 , 652.63950210717731 },
-  { 52.7076487454053 , 739.24636427132326 },
-  { 718.2356042584403 , 144.45546465924542 },
-  { 551.8911898712277 , 684.57923285918943 },
-  { 379.9963452602507 , 290.5233086862857 },
-  { 571.3864935783205 , 255.700240324904 },
-  { 8.1232557231547 , 36.215703167010545 },
-  { 501.60384290670174 , 546.73766927969848 },
-  { 361.8942108322266 , 390.34510862045573 },
-  { 760.4951872064364 , 797.80382417694676 },
-  { 996.5737645883111 , 132.01762281502735 },
-  { 719.5453774532813 , 455.8281179732442 },
-  { 938.6682172367994 , 179.65535691905916 },
-  { 908.7484992765324 , 492.13154550370689 },
-  { 526.6740841074482 , 185.05181837913335 },
-  { 548.8755409192368 , 445.20394094739083 },
-  { 841.7983872019432 , 748.869296454096464 },
-  { 270.1122507685093 , 297.429116967398 },
-  { 653.8134023818372 , 268.0190243837028 },
-  { 435.70932604527644 , 838.43400878671582 },
-  { 424.6884497896123 , 479.6632790628424 },
-  { 613.7672606101347 , 477.43490374508596 },
-  { 570.4922492125652 , 60.713248369584804 },
-  { 224.1361288288316 , 738.05385963735637 },
-  { 334.7183937730042 , 531.3348187310877 },
-  { 554.7599416703508 , 580.5693670615116 },
-  { 659.8804840055399 , 533.02028201428996 },
-  { 457.5662268092167 , 225.86685895450566 },
-  { 952.7346029438978 , 268.59199267869565 },
-  { 71.9422162012735 , 459.90697040092346 },
-  { 613.5853479909883 , 682.06906391897402 },
-  { 657.551040342737 , 394.5437374396969 },
-  { 940.0912756411687 , 80.15887996786086 },
-  { 307.2671969809135 , 481.83001236265443 },
-  { 205.5931581392623 , 216.03242583346193 },
-  { 832.3190905081907 , 223.56597044136888 },
-  { 103.0839020536627 , 213.5101716823462 },
-  { 824.3599409840481 , 367.5174376195099 },
-  { 401.5728285752536 , 110.01155952028805 },
-  { 443.1940644918101 , 398.64543143126923 },
-  { 606.5630376323484 , 349.2749398999075 },
-  { 122.9403201277452 , 579.38372680812637 },
-  { 913.2099906720567 , 578.85790548340583 },
-  { 43.7792068279591 , 116.60818581173336 },
-  { 840.0210364784749 , 533.11699333507501 },
-  { 336.6013923376671 , 676.74640804136712 },
-  { 5.0290669893701 , 214.0790875616805 },
-  { 785.107808486289 , 146.18042037428745 },
-  { 782.705381237835 , 681.99626584421215 },
-  { 800.7500108026842 , 597.2671553231895 },
-  { 80.849209072984 , 369.9427718390388 },
-  { 880.0482473633542 , 676.34019820404359 },
-  { 512.1056087585617 , 358.37015582135115 },
-  { 410.8048011278671 , 27.82584390966261 }
-},
-{ //#8
-  { 648.37389253972 , 410.80936486045294 },
-  { 658.37389253972 , 305.81936486045294 },
-  { 938.3408561151365 , 202.7583268702827 },
-  { 596.6623189015332 , 220.8806706210272 },
-  { 607.6367622600042 , 116.46581682631219 },
-  { 992.9643738923724 , 121.6588834293763 },
-  { 571.2629390825241 , 322.75201892274407 },
-  { 326.8991626343683 , 611.78858853820725 },
-  { 457.7161641079873 , 255.08755635508913 },
-  { 256.6471402727518 , 489.81136376507885 },
-  { 537.8625930189052 , 467.42481209005143 },
-  { 818.6005974442165 , 112.62231381391314 },
-  { 722.812300232265 , 454.4918686947355 },
-  { 546.5145330625713 , 151.8581648406198 },
-  { 820.157333123232 , 493.8218149374721 },
-  { 835.0246519287904 , 416.31971269299663 },
-  { 390.6755093654335 , 333.7972192904829 },
-  { 67.8736059928392 , 15.78029505654877 },
-  { 580.4633507146905 , 15.053264324222908 },
-  { 390.6755093654335 , 448.7872192904829 },
-  { 168.5543253002702 , 17.0369898044754 },
-  { 104.580978059014 , 351.0969027059838 },
-  { 475.8728693620381 , 5.902782893146302 },
-  { 665.8210762791005 , 481.67528809891627 },
-  { 326.6511552127268 , 426.7202634599215 },
-  { 991.4189451579889 , 640.6743367425032 },
-  { 6.6808160293511 , 399.2705796534186 },
-  { 834.567381715334 , 324.87405829637953 },
-  { 307.171633930286 , 224.09369066643154 },
-  { 494.8829298262559 , 321.00215692637636 },
-  { 246.3117329172777 , 349.7506496750197 },
-  { 903.5392916836422 , 374.3338874520999 },
-  { 718.7491737983884 , 280.17861957448736 },
-  { 759.7864450418093 , 32.99277640576656 },
-  { 665.6976247181158 , 746.075115223674 },
-  { 597.6740163928157 , 730.07645889594977 },
-  { 37.5295582292164 , 322.45513893415216 },
-  { 205.0224877730386 , 223.36188480565667 },
-  { 850.7104521851376 , 585.48777640576657 },
-  { 692.1103281697117 , 125.8052643046183 },
-  { 551.2299026579407 , 425.8130569129143 },
-  { 26.8991626343683 , 111.78858853820714 },
-  { 665.8668642627529 , 59.97663037795289 },
-  { 446.93858587557696 , 414.9298120900514 },
-  { 65.680816029351 , 259.2705796534186 },
-  { 483.6120994267011 , 583.4931242383103 },
-  { 65.0470175381529 , 191.3677425544595 },
-  { 262.7600382889302 , 581.7083245234997 },
-  { 999.1976199399547 , 338.42519260433795 },
-  { 945.9762025483586 , 32.8115085841623 },
-  { 423.37786936203815 , 96.8267900364745 },
-  { 893.5871539907124 , 472.779739052478 },
-  { 585.3940701960389 , 549.1615592399061 },
-  { 32.4797791707622 , 501.5972021990673 },
-  { 792.4928705555769 , 640.27503996293535 },
-  { 748.5543253002702 , 546.3135863933571 },
-  { 140.6832410899971 , 80.40431216992266 },
-  { 367.2336287811897 , 554.50187655360264 },
-  { 158.9502683145287 , 713.1026522643591 },
-  { 939.301631352113 , 317.5503261179839 },
-  { 267.3055215057158 , 15.234235543107118 },
-  { 472.2892387518689 , 158.72358651121584 },
-  { 652.2519551740464 , 187.1603220936371 },
-  { 777.9515409116619 , 126.7551523510928 },
-  { 182.8692418602402 , 308.47728985221744 },
-  { 789.5895108771131 , 737.92890790973115 },
-  { 293.8689762991593 , 678.77083182471625 },
-  { 5.80579528282 , 719.9413229136031 },
-  { 165.0193585971718 , 532.2786379886478 },
-  { 694.4804778154636 , 656.31959149264236 },
-  { 861.3038776007448 , 196.7091762160165 },
-  { 462.2867682917773 , 522.7448501613067 },
-  { 951.2974579102918 , 430.2515156569031 },
-  { 757.3782149084345 , 205.69463413799247 },
-  { 337.9319945577755 , 353.1512442129923 },
-  { 866.2650600118716 , 705.1795846965565 },
-  { 199.506344544666 , 435.0504684104193 },
-  { 898.2092112095239 , 102.47097049313135 },
-  { 371.6654489012157 , 18.697845257252744 },
-  { 239.518475158184 , 98.0993425834901 },
-  { 148.5086302026916 , 269.5043482126164 },
-  { 90.4906621326413 , 571.4905495356678 },
-  { 840.6433030958004 , 281.641631270222 },
-  { 38.7532585935905 , 646.1518024613612 },
-  { 523.598476514869 , 229.20524394820734 },
-  { 411.4181592960697 , 660.6246245107734 },
-  { 945.0748391060871 , 531.5123631071518 },
-  { 333.4940973201723 , 121.39356185829499 },
-  { 174.44744139088 , 623.2585535024721 },
-  { 132.8461040691899 , 167.6044417241654 },
-  { 407.00587879509743 , 195.7368337828956 },
-  { 746.5030317243152 , 372.6927140416601 },
-  { 109.6343629615809 , 450.8248394466957 },
-  { 845.1981298642419 , 26.01412862438644 },
-  { 563.7146033536347 , 635.63733073807236 },
-  { 321.1388332639782 , 293.8128529355173 },
-  { 541.1334044719539 , 112.39829721518991 },
-  { 926.5065689880065 , 621.7577465788063 },
-  { 993.8154384942577 , 245.1165518465204 },
-  { 652.393914680315 , 586.6347033920898 }
-},
-{ //#9
-  { 636.4868533599981 , 214.3681645562342 },
-  { 663.6602649053118 , 315.7807170583235 },
-  { 197.6574917754106 , 55.56092700582718 },
-  { 254.7181755332491 , 417.7631305449859 },
-  { 709.4190356744882 , 138.84467891867916 },
-  { 595.4639921799093 , 117.7243599922625 },
-  { 910.1151409533284 , 249.24711524723824 },
-  { 737.4514245544188 , 382.4014288394268 },
-  { 572.2477124032225 , 480.1290235994586 },
-  { 514.472932494677 , 539.40966920569247 },
-  { 579.4898199272609 , 360.5349365202967 },
-  { 375.2823994664385 , 373.32999888440315 },
-  { 151.0540773744534 , 412.8370876162511 },
-  { 535.2442021274129 , 31.721586862361292 },
-  { 507.72609370586423 , 473.1814225302313 },
-  { 672.813126259978 , 599.66817981825704 },
-  { 537.8285251036856 , 178.45946970847226 },
-  { 405.4269806040624 , 496.79903372579366 },
-  { 651.7939846517271 , 686.86128789662035 },
-  { 151.235503499615 , 538.48407407482705 },
-  { 693.0807332542628 , 477.55468340040466 },
-  { 494.55112568783517 , 298.82336288210996 },
-  { 950.4724623272039 , 387.3637115285404 },
-  { 651.0895843117993 , 534.83226145252323 },
-  { 611.8880466644831 , 14.026961113178999 },
-  { 242.6752705427077 , 134.08877840831624 },
-  { 713.730503499615 , 237.56006693149885 },
-  { 218.6103831350277 , 312.68851126207926 },
-  { 136.4510427945327 , 134.3210723185034 },
-  { 741.3219808961272 , 511.9541928811928 },
-  { 380.02760078505327 , 598.6703820275105 },
-  { 875.8718421462129 , 295.49236322682356 },
-  { 972.3597376422946 , 35.66274406219088 },
-  { 813.3872802116657 , 724.23289504888184 },
-  { 52.0218786963601 , 259.53634030444198 },
-  { 474.4525372455915 , 601.2138875205087 },
-  { 599.3972405417179 , 304.3181149280566 },
-  { 552.6381111601329 , 277.55272383696774 },
-  { 922.6480560017043 , 591.3106625295134 },
-  { 961.7879795524418 , 670.93513538142696 },
-  { 252.68127564199295 , 188.16262589312285 },
-  { 389.57711617336565 , 300.65569103396035 },
-  { 357.736576303282 , 195.800352046503 },
-  { 277.331884184011 , 576.841733608554 },
-  { 302.0522076507509 , 343.64806117079326 },
-  { 816.721302895482 , 335.8137534829069 },
-  { 459.1866744130523 , 160.16206002404206 },
-  { 304.4585423448767 , 655.2877350053153 },
-  { 899.1629981926056 , 467.3401230788525 },
-  { 63.5291928779443 , 427.74928908536293 },
-  { 938.8837580605929 , 183.18937563134276 },
-  { 860.2680778700188 , 383.4782160505619 },
-  { 126.9138594430597 , 281.85443569722395 },
-  { 752.1095190256848 , 639.7819980200844 },
-  { 407.8868121042992 , 437.3197616532934 },
-  { 525.1624917754106 , 686.4849341491554 },
-  { 831.5165903948608 , 202.318532593513 },
-  { 147.545364333915 , 36.60415798995183 },
-  { 39.4838148279756 , 336.4610890354901 },
-  { 158.7842380844932 , 190.8581653028822 },
-  { 160.6234735441576 , 727.23080838874262 },
-  { 839.1467593955749 , 636.14972073745997 },
-  { 485.4929876713406 , 84.9126947339355 },
-  { 228.93505670732173 , 728.2199173198054 },
-  { 796.1610874898125 , 469.4420835819806 },
-  { 489.0563736418885 , 403.66947773599264 },
-  { 579.091078762858 , 601.7250766545285 },
-  { 893.3281599320318 , 96.87972548528769 },
-  { 982.9159073643644 , 103.93209942286032 },
-  { 5.8430487960264 , 173.34530337614538 },
-  { 797.9934156416629 , 574.4160930964501 },
-  { 751.0947364669848 , 98.96806845123228 },
-  { 123.4571285740499 , 657.0592025622353 },
-  { 977.6458738725175 , 285.95115902645114 },
-  { 610.0757760497065 , 421.69260452943996 },
-  { 97.5542056588054 , 1.1988504016906063 },
-  { 642.6746399575684 , 122.96471766252554 },
-  { 409.84905389531167 , 59.2714558913388 },
-  { 862.2459880394555 , 544.4491928811927 },
-  { 53.5516071243824 , 620.53145992801768 },
-  { 459.41604271296495 , 240.83157451713515 },
-  { 334.5135364702387 , 664.8937565371441 },
-  { 93.2868004752545 , 160.40767244484934 },
-  { 718.6901898599851 , 733.54438615541363 },
-  { 974.7782407746596 , 502.81308527348847 },
-  { 754.7514762535369 , 229.26114210082494 },
-  { 788.0975133499649 , 289.3471025505992 },
-  { 327.9885986648985 , 273.8231272733746 },
-  { 777.4150223341351 , 14.17644532875947 },
-  { 204.8229339140772 , 482.2577276249025 },
-  { 65.5992799477708 , 529.4475044593639 },
-  { 806.3541883213618 , 115.09931078532357 },
-  { 175.47288172768486 , 606.1840936017504 },
-  { 306.1319180353619 , 477.92048023705553 },
-  { 340.2182116418824 , 13.55391501421169 },
-  { 866.5739783738582 , 29.096537655422324 },
-  { 332.9033012444992 , 742.8317011896027 },
-  { 316.71371512319314 , 99.15654748253131 },
-  { 361.8416415220853 , 120.83211378130545 },
-  { 691.0895843117993 , 33.0319373931974 }
-},
-{ //#10
-  { 409.17054076845096 , 238.53720169498294 },
-  { 496.21119551100475 , 179.82753875958917 },
-  { 841.6142350078767 , 478.38862534081113 },
-  { 794.0965836971858 , 672.20129985377852 },
-  { 893.1725765538576 , 9.70629985377852 },
-  { 500.32389794327037 , 425.429280083365 },
-  { 483.40047841834564 , 342.6037361823376 },
-  { 506.5529292473024 , 276.67705170262434 },
-  { 793.0357496844125 , 141.27843439721443 },
-  { 49.4889747098758 , 158.94289696486945 },
-  { 346.4609804468988 , 382.7593166409672 },
-  { 139.494979809161 , 134.86904948006287 },
-  { 246.6402254934072 , 14.2209534926615 },
-  { 32.32441563098604 , 431.0892931150699 },
-  { 247.603655877944 , 284.58472994081734 },
-  { 980.5283425459171 , 12.3126647816748 },
-  { 949.4079799996305 , 103.07570595408598 },
-  { 102.550012700046 , 28.97593338945288 },
-  { 262.61223824703353 , 445.94387592170074 },
-  { 327.25943895596095 , 147.0030196972503 },
-  { 992.1896424841345 , 538.23271634176012 },
-  { 316.80092999343105 , 658.15711080057974 },
-  { 952.34550878647997 , 599.4721140667308 },
-  { 968.8520423491042 , 300.29466289818674 },
-  { 277.90242531579366 , 200.94139733638534 },
-  { 193.0271780997987 , 429.5161424854683 },
-  { 619.2535970215611 , 325.96687107951504 },
-  { 546.1327792738474 , 147.9200357847805 },
-  { 122.1198903587667 , 478.4858670159017 },
-  { 395.78558658892007 , 635.69290873976888 },
-  { 335.4865370884279 , 487.1741704356822 },
-  { 685.3259448778836 , 244.3743165861477 },
-  { 685.9780114560325 , 649.35205572534798 },
-  { 322.2731166159497 , 296.0946518973632 },
-  { 895.4570763603524 , 418.52598507143773 },
-  { 625.3697381014363 , 79.04039833106714 },
-  { 354.7168108553754 , 735.94607554319134 },
-  { 30.73153064564514 , 241.56262523634902 },
-  { 695.7314662854548 , 109.44978597825782 },
-  { 608.1176429350242 , 16.035051211532107 },
-  { 435.96763891796405 , 85.49887939295613 },
-  { 29.52935326687964 , 526.8818726542475 },
-  { 671.4241702768369 , 552.73131735247165 },
-  { 396.75667385437396 , 541.58087500224883 },
-  { 35.6872504487904 , 642.54440515934704 },
-  { 177.4999889872346 , 231.6375026152255 },
-  { 894.02472754569567 , 675.45376778299322 },
-  { 453.04175478369774 , 7.20458691240785 },
-  { 857.7654928080114 , 575.2040660600776 },
-  { 600.6207201758532 , 596.89969690943502 },
-  { 228.78869454854845 , 608.63549164516016 },
-  { 520.7333994548383 , 46.048687483063645 },
-  { 633.0427558153308 , 479.5467010286749 },
-  { 44.4819370708956 , 76.73980411288153 },
-  { 133.03064374744696 , 665.1802364319114 },
-  { 712.5324967297391 , 5.060607853061175 },
-  { 180.5610269774048 , 51.67053903980892 },
-  { 344.32273355960837 , 219.22009170511427 },
-  { 790.0601945146625 , 237.05058440775204 },
-  { 366.5893851986975 , 9.65798680628329 },
-  { 283.5263518512358 , 349.4432070168532 },
-  { 989.6348094024312 , 694.13024369110684 },
-  { 333.2719223169218 , 63.67023097399961 },
-  { 792.998217264285 , 54.811487683817006 },
-  { 525.7232777622795 , 527.3006283850818 },
-  { 893.757593393746 , 253.47463889232588 },
-  { 646.0967876745827 , 161.31147082179785 },
-  { 764.16686725726294 , 508.48473870337665 },
-  { 962.7395023224809 , 203.3717379082271 },
-  { 824.7206010954519 , 381.65106121709385 },
-  { 145.09591756659466 , 297.58721193773425 },
-  { 206.97601469518935 , 534.9804455371639 },
-  { 831.6082299085914 , 294.3147778560045 },
-  { 880.3925960474616 , 80.5575435074169 },
-  { 967.88020370384464 , 385.57785643753675 },
-  { 467.5432678540136 , 584.8595544147564 },
-  { 594.8695237673172 , 215.73623360735112 },
-  { 111.7514177190914 , 574.24524165496166 },
-  { 212.2420071704564 , 348.1362483745677 },
-  { 663.6242883217171 , 421.1201256404929 },
-  { 402.664420536468 , 132.1630761919342 },
-  { 766.1935107090823 , 591.67849835230726 },
-  { 231.27120760051415 , 128.96987126555018 },
-  { 568.4351295034216 , 693.1497826989313 },
-  { 727.3240207788222 , 185.52213383458025 },
-  { 550.8867495593354 , 423.0307422653991 },
-  { 745.3116338869602 , 321.9645708562373 },
-  { 666.4725315902789 , 329.5210587403478 },
-  { 895.1105256989784 , 535.87411981734095 },
-  { 104.436291131672 , 245.86093387337868 },
-  { 456.8220993371651 , 650.93542557791523 },
-  { 130.30382179937453 , 362.8966763715938 },
-  { 999.98696209343933 , 465.00813076892825 },
-  { 409.17054076845096 , 438.2400489866393 },
-  { 745.0044028729271 , 429.2641201238518 },
-  { 541.261717958108 , 344.5623352010206 },
-  { 306.8274383410175 , 567.4241397765895 },
-  { 860.6881232308604 , 156.46623835517886 },
-  { 419.4966465944733 , 336.3284623816231 },
-  { 38.98047603741117 , 352.5827409982998 }
-},
-{ //#11
-  { 507.34016260389126 , 487.75657617690484 },
-  { 406.4172971473272 , 458.8174101896781 },
-  { 35.44285378885627 , 563.2322639843932 },
-  { 106.5933352199329 , 328.6417826317408 },
-  { 851.7108539040473 , 392.603321615927 },
-  { 511.00426076268684 , 382.83053324817 },
-  { 611.7550163986062 , 838.73101953537576 },
-  { 716.1698701933212 , 509.7054628938467 },
-  { 429.992715038942 , 356.77043433002393 },
-  { 437.38839758403935 , 562.8492030925631 },
-  { 479.28253441583263 , 264.06976655576517 },
-  { 846.7368443895778 , 39.43564976777736 },
-  { 391.00600877960176 , 665.148316194365 },
-  { 750.3342070054234 , 285.485500357203 },
-  { 307.2483023289659 , 857.97172887447744 },
-  { 582.6072685856485 , 306.0457081151733 },
-  { 597.143232528809 , 394.7627749981983 },
-  { 929.1688110228478 , 385.0608595758626 },
-  { 860.9161081193174 , 184.05917729782135 },
-  { 839.5551921033501 , 782.48767269636744 },
-  { 776.3896602458176 , 423.70268976394544 },
-  { 626.3587937068087 , 37.84988727815255 },
-  { 359.74069267732546 , 278.74765910315233 },
-  { 47.45723738466097 , 300.12216533643686 },
-  { 333.73128015066953 , 648.1709582238188 },
-  { 541.6963783414366 , 45.8830243796612 },
-  { 923.1192331940154 , 92.13653666597554 },
-  { 304.74191157410473 , 66.198088392315 },
-  { 672.3959316240866 , 238.41059169825007 },
-  { 438.51807139743426 , 41.04503079300093 },
-  { 541.4084451081609 , 814.4522109155249 },
-  { 425.8130405336479 , 197.15510460978498 },
-  { 568.5818566534746 , 533.0396584134356 },
-  { 672.1822397849952 , 436.4977521280519 },
-  { 476.09806051943303 , 649.8898578351169 },
-  { 394.481235032085 , 86.151770855163 },
-  { 528.0466635221555 , 606.4386532589712 },
-  { 547.7010683423947 , 726.6746829681136 },
-  { 107.75896889101466 , 494.7261050374401 },
-  { 437.9387006114919 , 830.9660205879253 },
-  { 659.7385455455694 , 336.64632848222374 },
-  { 764.1913783414366 , 336.8070315229894 },
-  { 307.2456926773254 , 187.82365195982413 },
-  { 579.4930265081848 , 668.1211800083679 },
-  { 207.97830707679364 , 463.7903283380206 },
-  { 431.727369219277 , 745.0431123960948 },
-  { 683.1904253872683 , 684.5452344929417 },
-  { 313.69824372608605 , 545.1099202336486 },
-  { 330.34774284148557 , 721.5588660279568 },
-  { 924.31490549104325 , 639.6843595333048 },
-  { 922.2603300271328 , 301.5034674532872 },
-  { 57.38072753186407 , 214.4536337415223 },
-  { 657.7910455682592 , 786.4165827946586 },
-  { 238.8491566495499 , 286.0750542659051 },
-  { 763.6174314703297 , 617.058963351952 },
-  { 304.11818404552537 , 482.4350213852405 },
-  { 362.41521497393694 , 588.0338382734352 },
-  { 480.2230312560125 , 892.3025805448248 },
-  { 534.9428060179935 , 212.49893314063655 },
-  { 261.93995651380425 , 195.66775055536357 },
-  { 677.6760550391632 , 147.86063484619564 },
-  { 257.680965337158 , 595.357570451831 },
-  { 113.5256213332466 , 697.06188810000015 },
-  { 147.54981677020396 , 232.91583965230342 },
-  { 134.5669278526598 , 871.7071347601765 },
-  { 331.33438678262945 , 320.861739482262 },
-  { 209.23169335102472 , 535.5967798972385 },
-  { 720.9756048489927 , 870.2653249945238 },
-  { 205.1944882805077 , 777.1881747278007 },
-  { 937.09464649263015 , 736.50092358692507 },
-  { 795.5173423632611 , 111.1367826317408 },
-  { 159.6766071966024 , 576.4176085544746 },
-  { 36.46814324858906 , 734.3506789527533 },
-  { 236.6319129045356 , 402.008015302179 },
-  { 524.3571019598916 , 310.7458476286387 },
-  { 189.04475981760055 , 109.45855711683043 },
-  { 673.3770449790748 , 929.5055823394259 },
-  { 631.2311759538956 , 571.4170365320334 },
-  { 220.03569464089708 , 853.7835799842588 },
-  { 582.7192395215254 , 129.23921981568947 },
-  { 488.8931228835395 , 754.0972782959393 },
-  { 133.93619630349335 , 380.1793668832225 },
-  { 71.62458426801231 , 633.5992608407022 },
-  { 795.4068290209101 , 698.58510034756 },
-  { 760.1122685856485 , 196.9697152585015 },
-  { 292.38181579868603 , 783.2653004089766 },
-  { 808.8333544852434 , 523.5541134097737 },
-  { 610.4012005940615 , 467.7235397523214 },
-  { 738.6456586062561 , 772.9202921035568 },
-  { 315.31605114657447 , 408.24853173959184 },
-  { 476.414869706565 , 110.54566077392764 },
-  { 368.31285794261515 , 164.03620219859005 },
-  { 332.25829450812273 , 948.3835217845279 },
-  { 913.4622385842317 , 447.690503327738 },
-  { 32.47389507645846 , 861.48295906964034 },
-  { 190.19469419616823 , 675.7845765348925 },
-  { 44.17595447264353 , 416.37917438111003 },
-  { 910.7047027869603 , 548.9534932287828 },
-  { 91.3349144064408 , 121.0287061583566 },
-  { 851.32386993009914 , 249.0927067076157 }
-},
-{ //#12
-  { 480.83804653272006 , 637.8008761514815 },
-  { 549.7176839864334 , 558.5639173238926 },
-  { 144.7916410576985 , 232.2280154826882 },
-  { 42.1366739486655 , 691.5579617254248 },
-  { 830.17985718790123 , 166.1962600198657 },
-  { 358.7936768431052 , 21.0589173238926 },
-  { 442.8666786964932 , 275.7393622618816 },
-  { 645.834072827749 , 585.1339072408509 },
-  { 707.8443197555563 , 259.7430349944025 },
-  { 618.5973214401467 , 179.32695849630375 },
-  { 345.5216458055262 , 528.0466149462313 },
-  { 519.6515038294899 , 707.3423700848433 },
-  { 226.9508360552312 , 568.0525507079526 },
-  { 735.5785019761018 , 182.6619251468543 },
-  { 597.7728975005097 , 690.5945313408879 },
-  { 814.1567517835432 , 262.4962552309606 },
-  { 246.86331754921366 , 492.1379200984694 },
-  { 309.61295095776416 , 429.3882866899188 },
-  { 143.5382547834674 , 565.6716659689924 },
-  { 498.81752195677046 , 466.73759427132745 },
-  { 618.6606612824353 , 283.72135473876165 },
-  { 943.5337565437341 , 576.3553903841123 },
-  { 745.1040680799213 , 619.3153077773078 },
-  { 309.1569960078124 , 362.8400645838374 },
-  { 786.1269292600101 , 715.9591123412795 },
-  { 389.7922968269662 , 816.9246872806301 },
-  { 728.9452769737825 , 804.0111352698696 },
-  { 62.7093948344369 , 292.4014963324723 },
-  { 721.293038041189 , 457.4983100773471 },
-  { 581.3488430159358 , 794.2919302199714 },
-  { 873.1675840025639 , 774.6687752766732 },
-  { 522.68418384225 , 236.62367833977555 },
-  { 284.3108811539297 , 768.3348166297841 },
-  { 15.397101439645 , 841.9319203990266 },
-  { 752.8543948868959 , 346.4160100992635 },
-  { 107.44308054396834 , 656.0321983247325 },
-  { 603.6636368106532 , 91.24284222538074 },
-  { 494.2071506216812 , 805.9502439221592 },
-  { 439.8151853526312 , 541.1570715875098 },
-  { 647.08745910198 , 656.9403588000689 },
-  { 818.638070932156 , 496.8282563200837 },
-  { 222.672605307265 , 345.965915441598 },
-  { 413.82037141858655 , 442.18334905402526 },
-  { 510.3529498374829 , 886.1663683449432 },
-  { 981.1678634892614 , 708.8258535141389 },
-  { 647.0538970844134 , 383.2591691205715 },
-  { 182.2250192547728 , 409.40467107729967 },
-  { 369.2197512375957 , 224.0546973557421 },
-  { 623.2764290632477 , 419.873259054586 },
-  { 576.0287565437341 , 897.2793975274406 },
-  { 423.8228305982944 , 199.4959072714023 },
-  { 698.2491716949423 , 703.6086989413104 },
-  { 793.2386911131468 , 394.95690801836685 },
-  { 867.4778320699224 , 320.7177670615912 },
-  { 308.19974233359886 , 910.8523394243076 },
-  { 219.1631727181357 , 836.4885629761518 },
-  { 119.455984497637 , 488.20793575541046 },
-  { 549.0372881064721 , 494.1124000113616 },
-  { 323.889798065061 , 638.0195142833692 },
-  { 452.0085056068578 , 68.8919766209079 },
-  { 837.0369922282146 , 599.9413287402128 },
-  { 399.7922968269662 , 894.9758005636883 },
-  { 698.1068254990912 , 88.7928170895555 },
-  { 306.5210391928453 , 291.47316843091596 },
-  { 428.4321552883838 , 338.21510451684776 },
-  { 329.9845489375557 , 94.758508853713 },
-  { 426.44262421191934 , 739.4367611409651 },
-  { 888.5987578224584 , 555.9719205408833 },
-  { 180.1034606931073 , 755.5397542656776 },
-  { 130.6500446727417 , 926.6416987768587 },
-  { 379.6389708821297 , 342.91335380185296 },
-  { 525.7126194640916 , 47.8605628463413 },
-  { 452.9665661815233 , 128.9643806392226 },
-  { 542.6520629392847 , 139.7839795405056 },
-  { 532.657888152534 , 423.50156468626534 },
-  { 14.9632624033518 , 500.1454092233355 },
-  { 920.0732137845246 , 659.3730481976265 },
-  { 410.12114586572613 , 681.7777118048227 },
-  { 904.2021214976837 , 450.593131570211 },
-  { 220.9978211962501 , 207.4628020930467 },
-  { 530.0079160206458 , 331.8894287029966 },
-  { 337.3484029358788 , 569.4540771747512 },
-  { 75.90062923179704 , 774.46995061987 },
-  { 307.1910581823518 , 734.0549735516041 },
-  { 85.58121469080109 , 368.3818098972108 },
-  { 130.37714359424206 , 847.4021329343601 },
-  { 293.57915597316753 , 158.9349245782107 },
-  { 635.7204571163346 , 498.34412727139625 },
-  { 84.62473283019597 , 167.9801753961424 },
-  { 351.5617494825078 , 829.208228112582 },
-  { 28.0484960065281 , 590.5575449518467 },
-  { 165.3264796144853 , 130.684700373726 },
-  { 927.2414314873705 , 864.6627701773879 },
-  { 809.8925711949622 , 77.7997242308728 },
-  { 260.6932699583673 , 666.0357035279823 },
-  { 685.5562634767582 , 781.4968678558649 },
-  { 200.46213895406441 , 705.1502573490505 },
-  { 730.7776051256328 , 908.9851447843391 },
-  { 713.7919560782733 , 522.32300836603036 },
-  { 212.6147172263474 , 285.823375182491 }
-},
-{ //13
-  { 397.7825580065946 , 338.3118306718429 },
-  { 390.4588258281989 , 253.577581035064 },
-  { 286.49058129102144 , 268.1893649048613 },
-  { 877.6637634640925 , 327.7850014958864 },
-  { 484.8232127491484 , 799.6021677364492 },
-  { 481.361162343176 , 341.36094701131253 },
-  { 193.78991351676274 , 317.479184281752 },
-  { 542.004865035376 , 211.5501448078591 },
-  { 173.7568770921793 , 420.54022227192223 },
-  { 73.90545344635115 , 752.98391651134796 },
-  { 278.1212640131289 , 394.51563557053703 },
-  { 448.91746810375025 , 241.50952336548437 },
-  { 256.6011700473934 , 474.8125649303045 },
-  { 120.8577312022726 , 241.95569864419704 },
-  { 784.8232127491484 , 494.5921677364492 },
-  { 297.48731239584623 , 333.90323876632584 },
-  { 843.06077181333913 , 680.13778594336316 },
-  { 733.9230507194855 , 571.42849078901435 },
-  { 938.510173575935 , 177.2594342023541 },
-  { 237.09840283304004 , 127.87183100656534 },
-  { 38.645918018624116 , 629.16334258489223 },
-  { 36.81358986677372 , 204.18933307042272 },
-  { 377.97268765895706 , 416.95932980996275 },
-  { 828.63991291933888 , 83.23719006969884 },
-  { 894.51991826459049 , 591.66058481820886 },
-  { 207.69907010778002 , 237.40453692219344 },
-  { 24.018527502667297 , 108.3967535312451 },
-  { 691.02362807100954 , 35.90192397748143 },
-  { 149.73329100640325 , 722.94257872003527 },
-  { 751.82142985882234 , 343.7747705292292 },
-  { 184.2791698093094 , 158.77627434431463 },
-  { 191.98819926543032 , 523.935188260674 },
-  { 597.5822889020467 , 589.5356295724536 },
-  { 815.6727313180718 , 404.19264908910156 },
-  { 644.7005816364183 , 233.37879322681567 },
-  { 691.21977056295725 , 835.5153531911177 },
-  { 628.4408239447108 , 506.891280838251 },
-  { 433.9847789566673 , 787.6427859433631 },
-  { 14.27054986428378 , 830.37397830437345 },
-  { 207.5195503730522 , 784.00023124211 },
-  { 300.29576341962905 , 843.0203531911177 },
-  { 16.247774637412178 , 300.62600066599 },
-  { 290.6465275217428 , 559.8438831084359 },
-  { 299.76594902865344 , 655.936881694604 },
-  { 677.5440796197886 , 378.7932692700924 },
-  { 373.8013830163549 , 629.5920289081107 },
-  { 793.83620260249546 , 300.0864801827888 },
-  { 303.343147945271 , 195.29648861567802 },
-  { 917.9409321961345 , 392.34754594016545 },
-  { 963.8071447079799 , 263.9474437508934 },
-  { 195.44964856574637 , 77.52560114517104 },
-  { 86.1034092436644 , 296.8900008446815 },
-  { 604.5763372101793 , 712.96395483427426 },
-  { 504.4546610551447 , 701.92053985710396 },
-  { 328.7425277642801 , 93.42514031396114 },
-  { 139.57547655572245 , 629.8102175240945 },
-  { 9.56051530483958 , 533.5222278656983 },
-  { 695.14609920427074 , 745.54677730787347 },
-  { 748.7458389474056 , 202.2358701127066 },
-  { 83.29610650581286 , 894.7888320990885 },
-  { 383.90034729258434 , 733.53133372367597 },
-  { 674.4485592748017 , 155.35601799994407 },
-  { 435.7075509042123 , 674.6871003637797 },
-  { 695.1691306425496 , 280.7766602921512 },
-  { 124.82944964008811 , 823.5327519321149 },
-  { 46.035892127319755 , 459.3666332046091 },
-  { 116.46471362787535 , 451.0030059461838 },
-  { 500.8477994505337 , 25.23778081549963 },
-  { 873.1674351073317 , 258.56118621398275 },
-  { 63.9122372050672 , 394.1727756405267 },
-  { 616.2440059921516 , 285.7892857646347 },
-  { 543.1590024590615 , 484.61965517216305 },
-  { 499.1695338473416 , 120.9114114549509 },
-  { 426.9824499658377 , 62.86313674641798 },
-  { 687.18791007631444 , 646.5588381515448 },
-  { 364.8856684785184 , 485.6047421516602 },
-  { 279.76235511768886 , 740.0804750835036 },
-  { 399.6276487268596 , 148.8088555912256 },
-  { 97.52306464191352 , 555.2830296131498 },
-  { 683.52232350295344 , 483.7804411896136 },
-  { 509.422452064062 , 407.46920278832755 },
-  { 893.61732041389598 , 492.49961065964055 },
-  { 235.76143958759786 , 869.42760532025386 },
-  { 94.27054986428378 , 130.37397830437345 },
-  { 219.11561913528084 , 619.2106817568273 },
-  { 380.95872601461696 , 575.2630679360761 },
-  { 830.3081710852032 , 172.8157520620628 },
-  { 243.12335789277472 , 21.2992617455793 },
-  { 835.34036807125324 , 565.76963829839485 },
-  { 539.6829100763144 , 285.6348310082166 },
-  { 344.53123555290074 , 8.17816243378114 },
-  { 592.2055816364183 , 42.45478608348748 },
-  { 575.6026966984872 , 384.7682315263349 },
-  { 501.24726723372225 , 598.2895666155327 },
-  { 459.4238329301393 , 506.46351603816606 },
-  { 624.44343572400703 , 817.2017772493019 },
-  { 372.69445495733191 , 871.4387766468673 },
-  { 71.2359693834629 , 28.43852600374777 },
-  { 990.47924775652996 , 406.2849267780535 },
-  { 598.3340705915234 , 124.81077473243812 }
-},
-{ //14
-  { 128.6717560318843 , 390.77021550712215 },
-  { 229.59462148844838 , 361.8310495198953 },
-  { 251.42326990740494 , 464.52676612093757 },
-  { 703.64576554635383 , 688.93788735527164 },
-  { 864.5804508796463 , 489.4285437634347 },
-  { 353.29461820912184 , 489.92614593994665 },
-  { 832.42120994313473 , 100.41849701780603 },
-  { 367.9064020789191 , 385.95790140276915 },
-  { 183.57003478706312 , 267.4666625989458 },
-  { 918.55586417826103 , 425.06415684248515 },
-  { 735.9448786481557 , 105.32027615970924 },
-  { 732.2283630433756 , 303.37535744670777 },
-  { 456.99201708820533 , 806.3502004245205 },
-  { 837.86458659521975 , 214.3387878312446 },
-  { 80.731708679781 , 876.24398448270114 },
-  { 698.69002088623523 , 529.1650644153784 },
-  { 438.2670229237789 , 183.6426825524045 },
-  { 540.8407592880706 , 569.534759705254 },
-  { 874.52747614517745 , 309.75774625114536 },
-  { 288.496077715798 , 863.8025644401502 },
-  { 789.94059725840765 , 477.7084366526889 },
-  { 616.7254223914043 , 549.3114444756505 },
-  { 591.01883571942082 , 61.65617800091366 },
-  { 284.41498075540846 , 410.68918711235784 },
-  { 445.5699059582516 , 382.555182091711 },
-  { 332.43138822151013 , 334.48276645560003 },
-  { 289.9097328013552 , 655.5353019662406 },
-  { 273.68002088623524 , 529.1650644153784 },
-  { 281.8317595441352 , 257.92909783218886 },
-  { 584.9567445646553 , 445.9164784868988 },
-  { 785.7876568283545 , 728.50217941955236 },
-  { 418.6781276693254 , 429.9585744541501 },
-  { 365.2809028487947 , 192.19955661718853 },
-  { 98.21378948231234 , 273.2135593819125 },
-  { 77.53979613709245 , 950.718880828041 },
-  { 683.6499628619153 , 258.30781239420355 },
-  { 505.7187824118792 , 351.24891151875636 },
-  { 420.9171264006389 , 281.2361262326517 },
-  { 758.0670013005606 , 380.50735315698523 },
-  { 485.2045357362264 , 890.4981900897909 },
-  { 171.0865711116292 , 478.383343395696 },
-  { 653.2415984916274 , 159.40713856181253 },
-  { 992.261399467959 , 200.31431945653753 },
-  { 847.20645264482692 , 589.6221643683439 },
-  { 471.1731276693254 , 710.8825815974783 },
-  { 64.72177634905778 , 784.5532805455812 },
-  { 378.21384624411064 , 15.32298863475503 },
-  { 2.08347805461691848 , 717.2865295667509 },
-  { 505.47861128087177 , 155.6120957931613 },
-  { 453.8001045455168 , 628.2444226406477 },
-  { 739.39285629176214 , 602.59169784254607 },
-  { 597.4215276702445 , 649.7138808042097 },
-  { 80.74436164409282 , 98.28836361476564 },
-  { 273.45457979622955 , 14.29939458752563 },
-  { 956.6286304039571 , 273.2135593819125 },
-  { 439.4282067859813 , 542.3613481599405 },
-  { 755.845167577198 , 9.35766300503286 },
-  { 521.8399918572029 , 252.2969602454249 },
-  { 379.5609635887411 , 554.0052816838721 },
-  { 87.12413279717072 , 538.5768666313571 },
-  { 8.56186927754628 , 209.13800432729175 },
-  { 257.79997243695783 , 163.40012811159113 },
-  { 674.95073946537 , 391.8426310020922 },
-  { 191.9702476510534 , 544.0716186773038 },
-  { 493.13042151209015 , 55.0163164572359 },
-  { 597.99161366548662 , 285.04622438689864 },
-  { 281.90362894901784 , 746.1776914552655 },
-  { 32.02795146791263 , 431.79307668721106 },
-  { 594.5429740141794 , 367.8429049119223 },
-  { 941.8933025363287 , 358.35556663118837 },
-  { 177.37296635389632 , 95.91385697060137 },
-  { 316.50963537235145 , 76.35947336903726 },
-  { 173.6031561504014 , 173.74308882695135 },
-  { 336.0836102785018 , 818.1324041797463 },
-  { 380.2784928074915 , 736.8340919309953 },
-  { 76.38514106335573 , 170.51784278087024 },
-  { 81.78973499773848 , 19.516160502829 },
-  { 376.724926629453 , 638.2744857578372 },
-  { 649.5733959343426 , 764.0454112039711 },
-  { 173.95123023709255 , 10.2155688308576 },
-  { 9.02013504159425 , 811.18267872212687 },
-  { 4.854539922598967 , 533.2056291893003 },
-  { 195.8634324315489 , 630.5776169174677 },
-  { 19.466323792396263 , 637.1738737264778 },
-  { 96.59343717937662 , 664.7590174539246 },
-  { 181.48851971812024 , 884.6014533327424 },
-  { 566.7254223914044 , 706.1054288297272 },
-  { 10.5846445044179 , 378.8859819656752 },
-  { 751.0370645126919 , 200.83989989933622 },
-  { 192.50657477727327 , 707.4622976104529 },
-  { 405.3508577362095 , 894.7657939143061 },
-  { 793.7437148553252 , 282.648678734741 },
-  { 228.41526962503525 , 806.1206258667654 },
-  { 574.2341656594956 , 500.84954517289486 },
-  { 163.43498883630926 , 802.1571220805978 },
-  { 836.19565299884374 , 355.10797333797615 },
-  { 377.7868401610491 , 117.83671749376528 },
-  { 15.07617705216774 , 299.7484432605427 },
-  { 897.72311508932233 , 178.22147230059045 },
-  { 479.08091109851773 , 456.47885387273885 }
-},
-{ //15
-  { 441.09345639723784 , 234.75054131530567 },
-  { 189.7517846535503 , 10.65923616306765 },
-  { 376.455158102797 , 152.01729229413593 },
-  { 437.4293582384423 , 339.67658424404055 },
-  { 118.2788768073657 , 235.08610289138818 },
-  { 200.1056260600466 , 244.4108338808195 },
-  { 302.0890170821054 , 682.03588490358055 },
-  { 345.1803187993412 , 192.04726115877745 },
-  { 577.3768356763114 , 368.67584514100884 },
-  { 771.3450802134889 , 393.2876290108061 },
-  { 724.0483603700172 , 479.20076660870274 },
-  { 109.32477857048883 , 631.35557532655395 },
-  { 628.1352227721206 , 821.904046765231 },
-  { 776.85759443135606 , 182.71339757297605 },
-  { 335.75311524090097 , 586.9619278323154 },
-  { 500.35764842166304 , 366.38805865394784 },
-  { 41.6479854862693 , 679.34740391139405 },
-  { 804.4753664530788 , 546.6870377496925 },
-  { 89.9904504455524 , 820.0247971308139 },
-  { 827.6155014683135 , 718.0414061087551 },
-  { 498.1398768487226 , 299.79620768729546 },
-  { 506.9892411381438 , 224.90235030109068 },
-  { 494.8628963757164 , 471.2341735078305 },
-  { 241.4681408285494 , 690.0175168846963 },
-  { 831.583746005491 , 432.65318997855235 },
-  { 792.64541755458544 , 797.6948508880773 },
-  { 271.72090846601805 , 64.69356011574027 },
-  { 52.21841147152395 , 213.20857974708758 },
-  { 302.4170137448582 , 245.09599644429937 },
-  { 902.9023787360405 , 267.60563045761893 },
-  { 135.7651864460607 , 740.8730423147426 },
-  { 415.6259375481276 , 540.1138109615439 },
-  { 866.0869380167741 , 351.4543726574842 },
-  { 296.0147977796729 , 859.31720409580566 },
-  { 967.3553201324599 , 243.84361534670109 },
-  { 541.0945680295667 , 663.1943838298373 },
-  { 491.99361842690075 , 161.11036632553137 },
-  { 875.8503281675423 , 488.13374386468877 },
-  { 451.26216109997176 , 951.0772413460807 },
-  { 893.47663390522575 , 616.6516873103518 },
-  { 278.79940254929585 , 347.3951095461012 },
-  { 403.775889958982 , 731.5042474291422 },
-  { 568.2263542452348 , 264.08536378835646 },
-  { 397.66193182062085 , 644.2622575266477 },
-  { 43.03424795675977 , 308.53845690678827 },
-  { 582.4550648100786 , 174.746098565171 },
-  { 253.12719436796752 , 152.3953286700406 },
-  { 577.8337191896011 , 450.50869284192765 },
-  { 128.75766593099513 , 531.17015304974484 },
-  { 375.44320711326753 , 306.37224836601223 },
-  { 178.5290000027065 , 323.6923420529056 },
-  { 43.1058362017186 , 499.1592145381752 },
-  { 52.9153936533372 , 114.89634520180545 },
-  { 308.62263539800415 , 487.1335561289862 },
-  { 971.76795957596187 , 40.6532522622462 },
-  { 690.2934089408847 , 345.6125352359985 },
-  { 679.0353848017836 , 613.7303698177961 },
-  { 490.16129027505036 , 56.13635681106186 },
-  { 19.15843825932524 , 747.93042989203258 },
-  { 581.6903519108166 , 574.4004235750596 },
-  { 152.17288213602023 , 454.7194222961455 },
-  { 625.6551106464437 , 428.34578425716825 },
-  { 159.77923502614226 , 193.07574179492565 },
-  { 775.5672573667497 , 95.67274283042218 },
-  { 679.8000977010456 , 135.41615232243436 },
-  { 751.9675671162737 , 689.2538554553511 },
-  { 238.54224210756863 , 434.3714223359256 },
-  { 866.3827169537561 , 93.1535440718036 },
-  { 951.4143284629085 , 526.6540013251091 },
-  { 239.2706693683331 , 570.0879078321706 },
-  { 489.9904504455524 , 716.0580150866963 },
-  { 350.0438272942584 , 408.2435966677291 },
-  { 491.8171996982333 , 569.3495281202452 },
-  { 506.266343269425 , 865.04638691026037 },
-  { 415.6259375481276 , 435.1238109615439 },
-  { 673.1523971739697 , 237.74946194715204 },
-  { 947.47584520167544 , 142.45142821350385 },
-  { 652.2134084793971 , 75.10759319563013 },
-  { 653.9509581383325 , 726.8789064781122 },
-  { 810.1109795321292 , 642.7116244510778 },
-  { 576.3652912695532 , 891.046452031427 },
-  { 123.4809363469943 , 372.6598486977388 },
-  { 942.0175709095741 , 389.53699414830197 },
-  { 995.5109029826409 , 322.01736735379177 },
-  { 411.3927169537561 , 93.15354407180361 },
-  { 412.59087993518165 , 831.74533999878344 },
-  { 653.6360049827745 , 511.8590215160793 },
-  { 846.8679153865555 , 210.93963795998937 },
-  { 35.66329014055793 , 428.42389319359245 },
-  { 195.69211693038585 , 820.89692974784927 },
-  { 152.36198483356895 , 107.55128743505587 },
-  { 514.5312997685844 , 799.96400023136346 },
-  { 613.8588090724992 , 302.8606229277446 },
-  { 607.4323769788219 , 690.5151949507929 },
-  { 580.6227366582282 , 69.77208905070148 },
-  { 343.2460826669478 , 775.72352091122104 },
-  { 176.5877359307352 , 643.7449789376746 },
-  { 950.6970736065645 , 443.76305256453276 },
-  { 772.0000756146708 , 278.75109250095596 },
-  { 394.2481526771537 , 13.433076654533636 }
-},
-{ //#16
-  { 52.68314742047045 , 12.067444176618842 },
-  { 884.8151675762018 , 5.088405984651736 },
-  { 809.74625006493673 , 9.937667027077444 },
-  { 213.38529005247003 , 1.16742431163780047 },
-  { 310.2207962591235 , 2.3928590521495785 },
-  { 387.5779110418667 , 21.26947748434783 },
-  { 473.6221119229758 , 3.291505841445348 },
-  { 564.589476518806 , 3.895633335213331 },
-  { 749.319495623066 , 15.993698458276553 },
-  { 655.9609332930937 , 17.247241499509308 },
-  { 11.33943627072541 , 92.54676907659662 },
-  { 80.73873637425748 , 82.55588988182126 },
-  { 169.44296188163736 , 61.62011304511 },
-  { 263.5326617323611 , 76.51609626268007 },
-  { 974.16043903461826 , 50.434818780627566 },
-  { 383.41055560814397 , 84.11640770503251 },
-  { 582.1296298574844 , 71.16192318345796 },
-  { 478.1803267537497 , 73.07683333712114 },
-  { 689.7572209944454 , 82.29213757075641 },
-  { 833.997481230225 , 98.82651176667022 },
-  { 87.48063809470776 , 180.8992967241186 },
-  { 8.321070284179193 , 168.23075526464365 },
-  { 239.11791445128182 , 146.7070019409361 },
-  { 172.6553707300608 , 155.23139346028867 },
-  { 394.32308025373004 , 162.59465170026843 },
-  { 314.3667680532008 , 147.09743960684648 },
-  { 549.7163468397027 , 166.2234221925111 },
-  { 483.3374948874257 , 159.7563909857624 },
-  { 767.7580802906318 , 174.95560197008655 },
-  { 634.4337621467284 , 162.86512134597828 },
-  { 90.8093039282306 , 261.4093372206195 },
-  { 8.632189680743227 , 260.1578153142402 },
-  { 310.6458175903142 , 245.71925168403888 },
-  { 408.4004401894222 , 234.9356420268258 },
-  { 211.04362426149584 , 251.66910181685572 },
-  { 837.06401136174648 , 253.5866268127497 },
-  { 628.4016506602519 , 240.4362467375811 },
-  { 719.6227332881763 , 220.91397283061934 },
-  { 470.32762477272684 , 251.90735703863555 },
-  { 560.5801521334095 , 239.9887032508085 },
-  { 174.86512483694375 , 314.0918527415362 },
-  { 227.47323805739305 , 328.57054005702213 },
-  { 38.76174260984895 , 345.9914201272114 },
-  { 892.4183567548663 , 319.8578815783421 },
-  { 473.23942067753484 , 334.4730047046652 },
-  { 541.9277830095039 , 312.7241377257203 },
-  { 318.8491352187856 , 314.69400783045154 },
-  { 383.6232393493554 , 326.0317722011824 },
-  { 106.86408182142884 , 397.1016451192753 },
-  { 898.185827470520017 , 392.4765886130061 },
-  { 669.7839765793916 , 324.77271574328046 },
-  { 760.7127841528503 , 282.0040070510481 },
-  { 415.9588209660527 , 417.18799118435845 },
-  { 313.083889192715 , 421.5351835133522 },
-  { 241.0528342621765 , 398.93643244674564 },
-  { 165.77407081859508 , 380.3549244593657 },
-  { 701.1268535363232 , 436.778952082165 },
-  { 628.3527278573414 , 387.9595364631777 },
-  { 566.9698783388847 , 400.6086409435291 },
-  { 791.8526679805222 , 377.61253515423346 },
-  { 246.28724853108383 , 484.16859865281367 },
-  { 170.19102887318624 , 474.88125395375374 },
-  { 84.31125712542669 , 464.2993563334044 },
-  { 28.305386481879324 , 453.87429964552365 },
-  { 939.1837571940557 , 474.47697718651705 },
-  { 763.849260689457 , 478.3401584700349 },
-  { 4.071144722471898 , 537.8333562015231 },
-  { 83.94742114743548 , 564.786616465626 },
-  { 854.17306274414733 , 465.0074449011093 },
-  { 396.2924391744598 , 482.4964369083443 },
-  { 509.04843212168373 , 454.87599963578845 },
-  { 574.6835066780678 , 500.9998359909675 },
-  { 480.74235007629335 , 551.5268144611408 },
-  { 556.2152249294438 , 570.0040158947296 },
-  { 649.3284556268385 , 562.202327240295 },
-  { 718.6272943917878 , 572.2217979441095 },
-  { 137.68663682029043 , 553.0642668617737 },
-  { 225.47560654144266 , 586.2384601895562 },
-  { 305.8969939989283 , 571.1081591796433 },
-  { 379.65678195437323 , 544.119867993055 },
-  { 398.52340560070735 , 652.3320368040761 },
-  { 328.77873514646075 , 649.9941259030584 },
-  { 868.924956307867 , 612.0679362343654 },
-  { 485.31445879954725 , 660.8488836456459 },
-  { 81.16300417646019 , 637.5844771758938 },
-  { 7.997841098156195 , 614.4584688678896 },
-  { 799.23428508158202 , 621.1357134825641 },
-  { 168.61672305872185 , 647.6521647914526 },
-  { 242.01173713021865 , 685.786672045791 },
-  { 196.0704864833943 , 719.1763708483467 },
-  { 399.18624090576986 , 714.5260060959049 },
-  { 313.81578004147804 , 706.2394397859211 },
-  { 693.0175482011526 , 640.2581719009253 },
-  { 602.9449881954117 , 641.6153518587499 },
-  { 73.67787724693639 , 699.1976958380849 },
-  { 25.169863278202182 , 664.2588749213778 },
-  { 645.5914047275037 , 713.703196408076 },
-  { 694.3447912653058 , 711.033222469419 },
-  { 483.4854823827751 , 678.5505129093355 },
-  { 598.9637472065249 , 700.4336707298365 }
-},
-{ //#17
-  { 27.097432010451712 , 13.313316374288773 },
-  { 112.62494851583253 , 1.3654859931892016 },
-  { 142.10308230643136 , 16.284205514695227 },
-  { 235.23400901871656 , 13.728570710048347 },
-  { 332.18681342285834 , 20.03622764800733 },
-  { 410.14249392311154 , 2.57117260414513 },
-  { 484.26409922348415 , 2.9288369419040983 },
-  { 791.1299378222002 , 17.825658673271914 },
-  { 872.0593848579358 , 35.5039018502825 },
-  { 713.6984035692234 , 8.754784379847909 },
-  { 19.05123867952753 , 78.21277751797696 },
-  { 98.51911672931479 , 77.2734545007456 },
-  { 185.67866438194676 , 89.75963002760787 },
-  { 238.1627914339733 , 83.30676710009196 },
-  { 333.7356022188812 , 85.90295903737074 },
-  { 381.2888371824581 , 81.73468119399118 },
-  { 552.0992828574604 , 70.08039444967336 },
-  { 456.7894909869092 , 85.72972766107955 },
-  { 716.5545255188644 , 80.55733083889835 },
-  { 636.7559230568568 , 74.4404565356432 },
-  { 86.14699239498364 , 138.1171977745602 },
-  { 27.34173465799282 , 159.00389883284888 },
-  { 245.3699750811338 , 145.6220985062816 },
-  { 136.01045544634974 , 153.06118558973128 },
-  { 429.0310507689706 , 159.41815175648748 },
-  { 312.0581632638414 , 150.71408649665295 },
-  { 542.6321052007846 , 157.3505187512397 },
-  { 495.6658545954798 , 139.64979238293103 },
-  { 768.4732152274955 , 155.32616708767216 },
-  { 645.9533539693642 , 147.40583817229052 },
-  { 75.22825267772637 , 253.31898204340507 },
-  { 9.81420423713347 , 245.5680711735315 },
-  { 335.24092751036585 , 239.3060352559465 },
-  { 383.0403400545666 , 250.10866280002077 },
-  { 161.0991104590296 , 235.22977729191206 },
-  { 244.55118382401085 , 239.57080123793082 },
-  { 659.9331558558326 , 240.11014065802607 },
-  { 709.639338174137 , 206.6347189947904 },
-  { 474.9532280929677 , 258.24963155285224 },
-  { 580.1877094840148 , 232.4879831069212 },
-  { 174.5659977251534 , 331.24736003939074 },
-  { 222.17995104593152 , 314.7834504128383 },
-  { 5.191835714880693 , 342.6028786913298 },
-  { 74.45608132145934 , 314.97167332262956 },
-  { 464.8412186296971 , 334.9646631522094 },
-  { 564.9679288248603 , 318.21879084113687 },
-  { 338.12676207339416 , 332.61226594297943 },
-  { 395.9771208576805 , 313.9711157958159 },
-  { 74.60224279539156 , 405.63554347976736 },
-  { 818.97881064068061 , 329.34302856069087 },
-  { 709.6906379281543 , 324.48835893740903 },
-  { 623.4869236735659 , 342.2116035681558 },
-  { 394.48002572097744 , 412.38476566193344 },
-  { 317.50271513672226 , 389.0657419810162 },
-  { 216.23066680436423 , 401.9700380445256 },
-  { 868.9868584388128 , 410.7041600803493 },
-  { 777.3442367667584 , 417.7277618465221 },
-  { 645.0776950015584 , 410.9067825825439 },
-  { 541.6786319949978 , 395.69975501218755 },
-  { 493.64758999577106 , 427.809024618446 },
-  { 248.32655842798096 , 487.7024678431008 },
-  { 164.54892149997013 , 487.33756948041264 },
-  { 93.67979946327435 , 460.80295786218153 },
-  { 0.9144751927302774 , 509.47653154637015 },
-  { 948.3379098947894 , 456.8029602404277 },
-  { 709.8045712937618 , 457.7400493531432 },
-  { 817.619254288824315 , 571.1455212498416 },
-  { 64.56872328381034 , 577.9520352005276 },
-  { 331.7799932848697 , 483.5367794151436 },
-  { 389.5743432676402 , 480.6866734390813 },
-  { 488.5224591455262 , 486.96764230925965 },
-  { 573.1164080128328 , 475.46809218121757 },
-  { 463.0338854109373 , 564.11870334244 },
-  { 564.9542490172327 , 569.3448608442714 },
-  { 648.5435207341344 , 543.1691874913008 },
-  { 716.7895185231253 , 545.9909597444815 },
-  { 153.27572508578683 , 563.5474299762778 },
-  { 229.99436834870605 , 560.7207612022472 },
-  { 342.41451886481343 , 551.1249879827841 },
-  { 386.68496277020597 , 569.1921319629303 },
-  { 380.7663223332663 , 633.5410179000684 },
-  { 301.42629342787563 , 631.4652765663345 },
-  { 550.9551346599393 , 643.6425012138178 },
-  { 479.7623873909281 , 634.3143811639101 },
-  { 88.0840837472437 , 634.3039696542854 },
-  { 8.723164110409174 , 590.4081035945469 },
-  { 263.3812142785506 , 648.9239938182693 },
-  { 153.76575512402619 , 638.2767980020038 },
-  { 249.07360439853554 , 702.162300205169 },
-  { 174.60356553632118 , 718.7485648300557 },
-  { 388.055531700643 , 712.3129172842253 },
-  { 376.92925640265713 , 698.3237148396419 },
-  { 709.9016205848077 , 626.2484656983053 },
-  { 638.8963588942662 , 612.0719062138909 },
-  { 96.20221635301536 , 682.778577566199 },
-  { 13.603465023370838 , 682.27584994871 },
-  { 614.5231457466907 , 692.3199247623622 },
-  { 702.3534867463829 , 698.2579990665782 },
-  { 481.9280754863338 , 707.4787615220183 },
-  { 560.7469633760437 , 709.8352266021358 }
-},
-{ //#18
-  { 31.25653698994112 , 18.65199244415794 },
-  { 943.37863843220981 , 12.755883926099223 },
-  { 156.25208101563018 , 2.911252349431077 },
-  { 836.8733944223093 , 6.9470490937717955 },
-  { 307.29814104340414 , 12.389253144307064 },
-  { 371.0025670608074 , 21.09665394699863 },
-  { 905.8335983904911 , 155.175868139627404 },
-  { 546.8058371007203 , 2.0591995460246437 },
-  { 634.3594771064327 , 8.087910598748307 },
-  { 733.7397547674656 , 24.51506167011071 },
-  { 16.026750864584145 , 74.94794963073608 },
-  { 92.16746896251298 , 72.36496094230218 },
-  { 182.0742343878887 , 78.08309789379638 },
-  { 254.639580172782 , 66.81340317468666 },
-  { 330.52446218540666 , 96.68480782780208 },
-  { 870.8205476863151 , 81.99152433584015 },
-  { 546.7685258593726 , 113.8406311428596 },
-  { 458.65735333181345 , 60.44806745469545 },
-  { 782.3449076828657 , 74.89835769616504 },
-  { 659.3118936088603 , 72.97801791930053 },
-  { 71.25967798297624 , 178.56805602746448 },
-  { 3.4584144329394384 , 140.54567999049763 },
-  { 241.1244152145658 , 160.05590599487914 },
-  { 156.37488026943413 , 150.69979224954466 },
-  { 397.2115652091597 , 142.61131663501683 },
-  { 320.2036874170323 , 157.32207090350622 },
-  { 575.6484495330637 , 157.07371609754742 },
-  { 465.92874396618714 , 165.377230665546 },
-  { 713.9344476781515 , 150.73687344312515 },
-  { 646.1417468339926 , 164.75908288030263 },
-  { 878.76537568312183 , 241.754261840581 },
-  { 2.551695394784481 , 250.26010889735284 },
-  { 311.0993457093359 , 253.59389069856604 },
-  { 388.87412232010354 , 228.4508879588589 },
-  { 144.1354379819403 , 239.89983507371937 },
-  { 221.71574872455594 , 238.7268412231561 },
-  { 636.693998474863 , 258.27262777691027 },
-  { 782.1695614356354 , 226.47326618995237 },
-  { 481.9813318274301 , 230.33764881730656 },
-  { 565.5773803101636 , 253.1749887631316 },
-  { 161.11187584466958 , 325.70004198196364 },
-  { 247.66805117869654 , 306.41485304944223 },
-  { 19.148459064169423 , 337.16294532954817 },
-  { 83.40871172964032 , 303.8237914660084 },
-  { 478.80757680564545 , 327.3638881264718 },
-  { 544.769278561752 , 319.36716215692087 },
-  { 299.48689570887205 , 327.68785663493696 },
-  { 388.5630403723483 , 333.8986354270756 },
-  { 63.254628828063545 , 402.1315636928129 },
-  { 863.983744270538683 , 386.8809414767978 },
-  { 792.9697780466926 , 325.0058309690507 },
-  { 662.9146581608715 , 313.7732822706656 },
-  { 416.1051236143844 , 413.1159741111637 },
-  { 316.0995609490145 , 411.7219673957397 },
-  { 247.6267301217231 , 413.1688861815616 },
-  { 143.92955391339393 , 425.711333144458 },
-  { 719.5579470325733 , 357.97689866685334 },
-  { 639.7429894301879 , 388.09970182340453 },
-  { 552.1000230431589 , 395.0415741304821 },
-  { 969.5413520066565 , 415.86201601950404 },
-  { 232.29119309504375 , 464.9216138010241 },
-  { 158.42924123557287 , 499.80975796531715 },
-  { 98.21523859593184 , 453.1322661310794 },
-  { 24.65111782662192 , 481.51765960438297 },
-  { 632.5677922376865 , 471.679285785452 },
-  { 702.9957209431329 , 460.44976093607863 },
-  { 8.9122562206847 , 543.965266165914 },
-  { 96.09067396908814 , 565.3045565359388 },
-  { 336.2983770574523 , 472.3019724052767 },
-  { 891.26059343325045 , 474.15476417204064 },
-  { 476.13423618330563 , 470.5599381697106 },
-  { 561.968649027434 , 484.4080025396326 },
-  { 824.801696725151 , 525.6228906592206 },
-  { 552.9900868889328 , 543.6051372923711 },
-  { 648.2602839812363 , 586.414521159503 },
-  { 739.3586969292334 , 566.6339429802474 },
-  { 885.12690649245374 , 593.2050869668794 },
-  { 245.79225400044763 , 558.7538351477872 },
-  { 327.697189446342 , 558.8074522760195 },
-  { 414.94935697377474 , 563.1372999023432 },
-  { 403.99269239834325 , 654.2520100827414 },
-  { 337.58166629356333 , 649.835785312516 },
-  { 544.1140244195396 , 631.8163390038466 },
-  { 463.755519062446 , 641.8515057714588 },
-  { 102.49351679025042 , 636.7810614193106 },
-  { 10.265778673056296 , 631.6457997350216 },
-  { 241.3437139694819 , 630.9121829103094 },
-  { 167.31339372706586 , 641.1201576304201 },
-  { 229.1044085205555 , 717.9384162567317 },
-  { 171.57113461661604 , 703.7793149989203 },
-  { 388.0070514817039 , 692.0476990401684 },
-  { 328.6394069846434 , 706.5206847644637 },
-  { 758.3533412243372 , 629.9998606971054 },
-  { 641.5948967007769 , 648.7047618566751 },
-  { 69.94855519299794 , 715.5514849405672 },
-  { 22.654043514499254 , 700.7247060935099 },
-  { 623.0060910401888 , 708.7909133032474 },
-  { 706.275551608308 , 703.3599438417127 },
-  { 491.2475700568203 , 719.6030381939677 },
-  { 571.2112262492027 , 668.8298826491205 }
-},
-{ //#19
-  { 343.96498163456675 , 439.5279086778453 },
-  { 361.7646947064044 , 318.68858916676703 },
-  { 160.67935905483915 , 43.5574527844152 },
-  { 138.02937025019105 , 305.84899744076597 },
-  { 163.3648922773672 , 141.298044798904 },
-  { 361.9338647400634 , 374.9348448631407 },
-  { 263.17844698846136 , 63.72326006430467 },
-  { 293.6236981790237 , 284.91934239366105 },
-  { 307.943211206362 , 456.21347182457635 },
-  { 440.4944862930436 , 213.34698953212103 },
-  { 357.2218669626264 , 526.558197774858 },
-  { 90.02049574726493 , 125.0767996175284 },
-  { 290.9292502907131 , 381.1606909953805 },
-  { 393.2407234220278 , 536.6598637178394 },
-  { 469.63564039994594 , 510.69573638914557 },
-  { 261.5927548932416 , 507.5301122559459 },
-  { 493.02241800401407 , 336.326491252658 },
-  { 465.27184492135063 , 407.7247207697618 },
-  { 589.6362949416132 , 357.0728379745563 },
-  { 549.9133009422153 , 395.40069162804144 },
-  { 217.0687404600487 , 370.924826452383 },
-  { 512.3414643171952 , 795.84330148817463 },
-  { 442.9374512214631 , 592.3535326582252 },
-  { 640.3512559537273 , 320.4289152391243 },
-  { 790.7395176012897 , 388.67838719787517 },
-  { 336.1984474570661 , 593.6661570558125 },
-  { 545.9762635961338 , 256.8172292441963 },
-  { 519.4672114062171 , 200.62835307670196 },
-  { 500.1892225705847 , 718.6399939266746 },
-  { 966.9887801827933 , 387.0940408012579 },
-  { 744.4823823234401 , 296.6887033121783 },
-  { 247.1444801330705 , 569.307018716685 },
-  { 688.1680838850865 , 382.29968030871925 },
-  { 597.1739205475817 , 548.2845423514407 },
-  { 692.1700298621973 , 279.81380461777303 },
-  { 572.7057196925598 , 489.1671184104885 },
-  { 640.2568437007444 , 739.5851668894288 },
-  { 23.1335649128138 , 560.8205143974085 },
-  { 261.3262669267322 , 616.5348003423278 },
-  { 635.163320647934 , 430.1625735135724 },
-  { 620.3889204140476 , 633.9948772386306 },
-  { 195.14045802572107 , 510.0349546632017 },
-  { 707.5351140772557 , 479.394652326922 },
-  { 310.49283838403875 , 655.286474407887 },
-  { 192.6562284546567 , 690.1024487310104 },
-  { 390.1772869019428 , 742.2619512254644 },
-  { 825.0588517710878 , 38.418884421443 },
-  { 363.6102573637211 , 788.8617855167597 },
-  { 792.3370693245413 , 496.84454876360934 },
-  { 691.3577523325819 , 37.092243608861 },
-  { 793.861580004316 , 542.29385386272 },
-  { 202.80178979971035 , 459.27935472735675 },
-  { 896.25867348048 , 577.5241282243805 },
-  { 170.4520734990503 , 622.9514457396735 },
-  { 668.486172846362 , 655.3632805760783 },
-  { 498.57080827996026 , 613.1820038941516 },
-  { 908.3283819994135 , 208.64447030199617 },
-  { 781.0677284001265 , 639.910134179225 },
-  { 860.0384353711217 , 626.6914765408949 },
-  { 403.49471703974336 , 669.4338082598886 },
-  { 350.1309345451302 , 171.21473558095352 },
-  { 799.1376743344513 , 718.7110699565935 },
-  { 257.4250862413382 , 171.3530862250496 },
-  { 690.8929612445854 , 189.75043470957837 },
-  { 89.3168317614998 , 628.5216831167679 },
-  { 544.2563572583915 , 108.93566942929777 },
-  { 583.8507488218277 , 20.585004775684126 },
-  { 497.64405913172925 , 67.91933988178658 },
-  { 598.3094531910058 , 142.7650476045086 },
-  { 136.84105258462097 , 408.1634181951243 },
-  { 97.06921567239158 , 432.583326288026 },
-  { 96.62124765594581 , 518.2881880662905 },
-  { 998.0657140127034 , 541.3998871992735 },
-  { 928.2044524663766 , 492.85608958439235 },
-  { 919.4105588148541 , 402.4486441618919 },
-  { 939.6922559893344 , 326.4549625842754 },
-  { 867.5015121915474 , 725.7756242923424 },
-  { 945.2677410854185 , 748.3722774842274 },
-  { 993.6651643202347 , 668.8567700351332 },
-  { 998.9580736986654 , 606.8204636334622 },
-  { 290.93079926161386 , 729.5450404519281 },
-  { 831.0053314803313 , 103.21688264577324 },
-  { 731.3494068362177 , 94.21603825292755 },
-  { 225.24640351762872 , 789.371064167748 },
-  { 825.3974168320776 , 220.44561414442614 },
-  { 848.9974527345371 , 285.6946892876132 },
-  { 412.15525161065136 , 114.02585213353848 },
-  { 771.8508511675523 , 756.5078116017307 },
-  { 693.6636411684506 , 561.3070478016832 },
-  { 0.0 , 454.6911075294109 },
-  { 492.92596905276673 , 0.0 },
-  { 568.6420162070978 , 677.9536121582557 },
-  { 49.84660789974981 , 350.2511604365631 },
-  { 418.14072928341557 , 281.4270091055474 },
-  { 12.052826383304307 , 331.2154714801547 },
-  { 988.1627503952382 , 266.0509804566038 },
-  { 750.9742423773508 , 839.312629997848 },
-  { 434.8574740427986 , 410.6799049113421 },
-  { 350.986079783872 , 36.730430229166416 },
-  { 636.1700996550081 , 840.2369920084748 }
-},
-{ //#20
-  { 598.5610724273561 , 165.76862290484308 },
-  { 219.5335648062664 , 109.26516921120285 },
-  { 528.804340458738 , 13.93341118918434 },
-  { 690.4456056027392 , 142.30273153105279 },
-  { 779.2279792702407 , 136.74315178165045 },
-  { 131.5888877352974 , 137.58777904443681 },
-  { 513.9820790959774 , 130.13931307653021 },
-  { 884.488725863177 , 135.6529341325619 },
-  { 537.9766984570037 , 218.7056321268004 },
-  { 455.02790244578534 , 148.03444423162554 },
-  { 621.8142582996036 , 71.2374726424613 },
-  { 476.11897468424917 , 221.8690934230559 },
-  { 650.8622135468862 , 232.27724703072374 },
-  { 508.90103994516 , 63.48127161836618 },
-  { 435.0528934913502 , 275.49262388274775 },
-  { 387.5356374729332 , 189.18581131021077 },
-  { 769.4011951894795 , 211.82077624571585 },
-  { 145.3812637327737 , 274.5058554401865 },
-  { 284.1391002352493 , 312.3125204454402 },
-  { 345.48633246068783 , 280.1304038392905 },
-  { 286.4197174376949 , 233.4126877577487 },
-  { 397.25938972184827 , 312.47095084630445 },
-  { 223.1339256751557 , 282.0912728722826 },
-  { 616.25190879715757 , 284.7654858781029 },
-  { 347.31638519196423 , 384.77828408767016 },
-  { 434.33149321710704 , 372.47831114448127 },
-  { 509.04984386611824 , 408.3194563506598 },
-  { 720.96269788569543 , 397.6671623210755 },
-  { 326.00158024183327 , 118.93917975657158 },
-  { 376.7825705102821 , 91.54701866907942 },
-  { 251.40349696628732 , 179.25829585206066 },
-  { 366.3122454610774 , 408.015852370633 },
-  { 314.6617898662617 , 504.1686516850331 },
-  { 327.524597873273 , 551.468810558237 },
-  { 285.90009024052154 , 439.1969726727864 },
-  { 343.28566528098986 , 499.7326254133846 },
-  { 450.1790997910556 , 559.7005138327966 },
-  { 519.0943071449434 , 542.864905467537 },
-  { 354.66034062929225 , 564.5013515342025 },
-  { 430.058563680822 , 503.5887419132376 },
-  { 414.38341123618386 , 626.1924440892797 },
-  { 352.49810162101136 , 641.132425198022 },
-  { 536.3828428214986 , 591.7062941172142 },
-  { 582.6848301969013 , 613.456097849795 },
-  { 237.40784985719927 , 4.0 },
-  { 411.8416695298463 , 2.405387853022887 },
-  { 316.6109759199663 , 36.373883884248926 },
-  { 245.59279310354464 , 548.8065556849051 },
-  { 573.5003021188453 , 733.1413032631096 },
-  { 574.8584495273255 , 470.89799089640894 },
-  { 602.2050592909454 , 693.0877262973431 },
-  { 547.8061725373436 , 669.5391363327674 },
-  { 672.5417436176757 , 765.3071118235932 },
-  { 472.34642051931445 , 696.2829098326363 },
-  { 583.3334327164919 , 806.4545402432329 },
-  { 844.0569379571599 , 736.5612532887499 },
-  { 674.467212400408 , 864.5867815013071 },
-  { 758.1782342766946 , 704.0771041516928 },
-  { 750.6258171770661 , 758.6599421772066 },
-  { 712.617663282677 , 827.1177335903806 },
-  { 818.693468953648 , 943.3202132344381 },
-  { 626.4856153807666 , 355.4322079303762 },
-  { 591.1662040152868 , 418.75583277092835 },
-  { 732.6205687633525 , 493.7397476708143 },
-  { 632.7983219777361 , 963.4810655361828 },
-  { 618.7512474022876 , 860.3876737159032 },
-  { 522.9722569898785 , 873.1851740896898 },
-  { 481.84269808836007 , 814.8392071935893 },
-  { 804.91092020036 , 811.7266383279405 },
-  { 735.1189488174588 , 977.0796916221843 },
-  { 178.13966940878265 , 614.554674660016 },
-  { 699.3881336489397 , 630.3392335549286 },
-  { 538.278044365921 , 948.3260908629352 },
-  { 795.1111558474009 , 863.1199101500683 },
-  { 861.9465275859887 , 878.5702966030417 },
-  { 236.42126182594387 , 671.4604666541682 },
-  { 447.2685736894694 , 923.9636119055601 },
-  { 740.289806341363 , 879.226608759875 },
-  { 378.6735708050555 , 765.9585135445652 },
-  { 136.71209817416832 , 702.2794431728182 },
-  { 324.4235225234494 , 832.4848357413803 },
-  { 128.3602962644011 , 863.9844811799353 },
-  { 893.230925054799 , 792.3442134704567 },
-  { 171.16480730484068 , 958.8668793492272 },
-  { 196.3102700157284 , 826.9603356699035 },
-  { 184.90073778439006 , 749.9019535211262 },
-  { 350.7816621938751 , 897.3072299946969 },
-  { 404.5056869977061 , 829.2069298632682 },
-  { 89.11452043030789 , 617.4269427151717 },
-  { 5.0 , 784.0259179760303 },
-  { 160.01794414046515 , 541.0515270978121 },
-  { 256.4046470976123 , 356.32160942366147 },
-  { 38.542873153513256 , 864.4535560270092 },
-  { 659.3021952642125 , 580.5950494440826 },
-  { 254.216489629722 , 858.1540435168661 },
-  { 291.08990631829397 , 943.0018450055438 },
-  { 40.1465847132656 , 642.4548756654274 },
-  { 513.0319505269074 , 334.12507929072905 },
-  { 672.8179973609539 , 456.194424125905 },
-  { 240.1439079031124 , 422.1405293985473 }
-},
-{ //#21
-  { 359.6636331637245 , 492.25562032871164 },
-  { 348.86359027588287 , 572.0871965971719 },
-  { 357.86821560135246 , 292.72947405471626 },
-  { 286.0298800234751 , 116.2169308763303 },
-  { 347.1720131547594 , 105.8925870099462 },
-  { 325.05795629632553 , 222.2897619358689 },
-  { 321.40486070567954 , 40.7434482003159 },
-  { 646.4748741665941 , 535.6465697990513 },
-  { 200.8578825054285 , 476.6652605134249 },
-  { 297.3338579837084 , 444.84944011547384 },
-  { 437.4044361407855 , 549.873786743588 },
-  { 454.94239536999015 , 495.0169850613242 },
-  { 261.4262499757221 , 513.9240741494093 },
-  { 369.00609201073803 , 418.63239982856015 },
-  { 496.4210631527479 , 490.34604392065364 },
-  { 354.29846953598576 , 658.0623460440172 },
-  { 240.40573595206126 , 609.5131243635876 },
-  { 335.3765552468478 , 360.56026859896537 },
-  { 483.25310654137303 , 184.1141075539157 },
-  { 387.1291127322826 , 65.4527236468248 },
-  { 509.2697853874135 , 410.38064240044014 },
-  { 312.3296542881958 , 705.7642225412585 },
-  { 585.9289204497741 , 476.41960780644257 },
-  { 585.7041188491111 , 167.0434418991248 },
-  { 520.0740345007521 , 89.9177372820483 },
-  { 416.29450999324854 , 652.9638264764269 },
-  { 162.50395006880655 , 620.7698067731851 },
-  { 179.1191168781358 , 570.691357445503 },
-  { 746.7228100181601 , 673.629913072811 },
-  { 448.78404580478514 , 359.4074315559328 },
-  { 483.5876788268506 , 680.585207944898 },
-  { 141.02677824562844 , 261.4190505158188 },
-  { 956.4223010552221 , 437.3116560469555 },
-  { 670.1291797039637 , 414.28872798691555 },
-  { 110.89818514627808 , 900.7395049644791 },
-  { 265.25446808911386 , 689.3225259428764 },
-  { 454.59072743648335 , 753.040097582607 },
-  { 538.2427248653269 , 733.2874883036156 },
-  { 103.86515342326521 , 525.5980670969994 },
-  { 805.81385670787006 , 393.9989783437874 },
-  { 688.589387667083 , 271.66632315019706 },
-  { 731.6500377833847 , 490.8062963322491 },
-  { 278.5432587669762 , 325.08617403492076 },
-  { 555.9444124584759 , 588.520600837956 },
-  { 57.298760581711235 , 627.3758855934386 },
-  { 10.6365773179067 , 487.4508436817173 },
-  { 490.85305367393437 , 273.82962865363413 },
-  { 122.653227211948 , 796.8736118360732 },
-  { 627.7610770609319 , 368.07933041286566 },
-  { 714.0715522187203 , 741.8479050220648 },
-  { 760.9327905833111 , 569.0449439902277 },
-  { 933.4849684095534 , 527.6136439308863 },
-  { 521.5311271984602 , 810.7401676027268 },
-  { 148.6197940846303 , 330.21817760804413 },
-  { 554.9209978262825 , 641.0428208505201 },
-  { 709.3117930675998 , 330.4485769076358 },
-  { 834.268897782718 , 509.4023934910183 },
-  { 697.2274469412023 , 596.35222392341 },
-  { 636.2874140706559 , 632.9623126455982 },
-  { 401.2293392539332 , 799.8012917794645 },
-  { 873.1251481902802 , 455.3777535114333 },
-  { 225.8605808120164 , 784.8420554677592 },
-  { 575.8138340610142 , 934.4817332910872 },
-  { 629.4588855503305 , 748.3964697998463 },
-  { 481.8284098386272 , 963.3530609533534 },
-  { 12.802217152690105 , 571.590993332004 },
-  { 3.0 , 706.8141758375544 },
-  { 786.8905777575732 , 310.8040666069476 },
-  { 328.898000924958 , 804.3996652582215 },
-  { 284.98637518731107 , 854.4702838689111 },
-  { 585.1092977454265 , 273.0675912496423 },
-  { 115.85302439524699 , 714.2715317231828 },
-  { 886.0293123467158 , 152.83692719087696 },
-  { 769.28669372989737 , 813.1377214739255 },
-  { 977.0546010813489 , 133.86843010215307 },
-  { 735.57819475402584 , 859.5653207755124 },
-  { 464.12336698509716 , 860.2712908593181 },
-  { 873.5713172902514 , 303.1800707022282 },
-  { 170.7160657857712 , 857.9496500140679 },
-  { 867.2729373248739 , 215.23437942349005 },
-  { 418.97816045552986 , 210.95049438389202 },
-  { 283.6946571844742 , 951.9301062140412 },
-  { 984.5876593424168 , 2.0 },
-  { 555.6622806819023 , 858.68667267442 },
-  { 963.844486218618 , 70.07670037921866 },
-  { 881.194143660708 , 93.84422991074223 },
-  { 379.41434766200933 , 875.3607735843862 },
-  { 232.9981029701099 , 866.740334495375 },
-  { 662.6811190003922 , 815.8490646816673 },
-  { 828.7472588558741 , 628.5070567213248 },
-  { 453.26672719162866 , 606.4161061009653 },
-  { 864.77128564182834 , 805.2522752033772 },
-  { 613.1645376251773 , 847.4218947753554 },
-  { 73.98703757558371 , 410.17843933837105 },
-  { 402.15920316561727 , 140.22668224178648 },
-  { 989.529065041846 , 213.35231448197175 },
-  { 270.8517101096647 , 172.4425630954178 },
-  { 907.0827793434918 , 647.2778252063754 },
-  { 836.78294106221813 , 706.948674444473 },
-  { 217.69425842764338 , 404.66449082492255 }
-},
-{ //#22
-  { 731.3064400286684 , 506.93190422317406 },
-  { 673.8457646266417 , 532.0345225633706 },
-  { 403.0997231660456 , 311.6906193553825 },
-  { 787.720194279116 , 250.7288533652113 },
-  { 937.5618108163583 , 549.5808123497084 },
-  { 729.462797906891 , 590.1288349320826 },
-  { 709.5574940164919 , 894.3603715907514 },
-  { 861.5433587829942 , 218.6875534008798 },
-  { 64.838723291176 , 448.896844802646 },
-  { 783.9283931520749 , 530.9708630935335 },
-  { 622.1885649288208 , 211.4937131151371 },
-  { 612.773707654656 , 540.0673959369149 },
-  { 743.2778303413716 , 446.9187212730456 },
-  { 687.1600501724796 , 624.7921244913649 },
-  { 928.529910562576 , 646.8921146727253 },
-  { 562.562680639976 , 601.1634959384374 },
-  { 506.82310037038576 , 545.6872647465121 },
-  { 849.0474190329252 , 569.0003017805037 },
-  { 441.8072919139919 , 555.9812188966397 },
-  { 612.7138648774464 , 884.4497909305237 },
-  { 503.9283673402209 , 655.3235360136495 },
-  { 120.0795759965555 , 718.011794578911 },
-  { 569.3609268342169 , 660.0526450101262 },
-  { 644.3724546775381 , 711.6516074231415 },
-  { 393.73780218659067 , 535.221591319507 },
-  { 626.075080911651 , 770.3227083974537 },
-  { 803.0865643044847 , 770.5021064377485 },
-  { 814.2831850075825 , 629.10269704138 },
-  { 468.8562226835942 , 679.3902585240303 },
-  { 340.46746952459694 , 521.3383383412702 },
-  { 906.26158160549363 , 487.0780479015021 },
-  { 367.4616037557394 , 451.2984642981467 },
-  { 494.23812951658255 , 431.01212351622206 },
-  { 296.37817987713953 , 382.84511183550893 },
-  { 541.2200048231741 , 456.01932518479026 },
-  { 838.1706742702253 , 426.8091384296861 },
-  { 564.8369980585351 , 306.50018292839235 },
-  { 384.6868116527792 , 345.80523855331666 },
-  { 376.7699637642211 , 930.8762643748998 },
-  { 482.45572301374614 , 491.9524712470429 },
-  { 239.4792573251416 , 653.136268862241 },
-  { 227.7849437438975 , 558.9600516834873 },
-  { 308.3178882207949 , 609.1908154096326 },
-  { 333.05435087790784 , 628.9451875653018 },
-  { 599.3657001761112 , 358.11958980473315 },
-  { 192.5859110509507 , 650.448341227348 },
-  { 609.3236512427823 , 436.69999346279826 },
-  { 248.7430596506003 , 427.8440720024246 },
-  { 248.51387600068335 , 725.1435017017521 },
-  { 143.13923117590934 , 504.14601749507307 },
-  { 27.41996208211992 , 549.6914617014779 },
-  { 150.6724854995192 , 570.2563340611056 },
-  { 349.7355574880708 , 40.4287447110742 },
-  { 330.72652474409193 , 328.1039501015856 },
-  { 565.1166405028733 , 835.0171543606602 },
-  { 266.3049118576724 , 528.39232623359715 },
-  { 369.2446276848086 , 697.7473682513303 },
-  { 470.59093749642585 , 379.2383096556932 },
-  { 680.9452368355797 , 811.4618530074315 },
-  { 708.0546323465962 , 751.9166700261126 },
-  { 692.2635277525637 , 398.83798608682 },
-  { 161.13673036684122 , 413.3379925458861 },
-  { 268.866034181033 , 831.6732915174439 },
-  { 296.824132037544 , 763.5229329397207 },
-  { 202.68642115869045 , 269.1828476565044 },
-  { 218.80847456820766 , 204.4385437230057 },
-  { 292.2539249672586 , 273.42297550232644 },
-  { 314.24726708533785 , 135.72909630459412 },
-  { 679.1567415698453 , 314.23029239513704 },
-  { 713.1840566235205 , 336.5641022031379 },
-  { 513.9938294218376 , 743.5511466775652 },
-  { 143.1225683708799 , 343.31801904680424 },
-  { 63.097876933300086 , 296.598006219502 },
-  { 469.408397024872 , 795.4998608360131 },
-  { 572.4614393022928 , 245.4562473819089 },
-  { 243.77264777229664 , 71.25580070448342 },
-  { 394.10950361476785 , 128.01527121195176 },
-  { 451.28979775914075 , 103.89799536924113 },
-  { 513.1467924807793 , 138.30135436689892 },
-  { 474.62929577563153 , 226.46867865694418 },
-  { 4.0 , 358.24366223180834 },
-  { 391.49641720698776 , 850.2409507962318 },
-  { 89.19202256748918 , 607.0057836250369 },
-  { 339.55293336911313 , 809.7714969896349 },
-  { 702.532465776446 , 211.28638284646024 },
-  { 622.00431443804 , 167.52942498281203 },
-  { 744.2073538776276 , 157.52302593718736 },
-  { 553.7043246878164 , 76.26616759561949 },
-  { 216.35196838353045 , 106.96550304803617 },
-  { 207.03564721106648 , 0.0 },
-  { 580.162553415021 , 399.78749139196674 },
-  { 7.493775173420659 , 447.51187238881937 },
-  { 127.74924974785824 , 192.86233042324199 },
-  { 509.4335149437296 , 910.3144381886457 },
-  { 405.9969112071149 , 230.84001852037608 },
-  { 740.2657940346894 , 95.83566544178228 },
-  { 418.236997713164 , 621.8171016796579 },
-  { 70.61813287028167 , 128.7864164664224 },
-  { 624.5399614868008 , 21.045928288235984 },
-  { 292.645420957541 , 207.13687893884497 }
-},
-{ //#23
-  { 860.4029408734743 , 221.24446971446017 },
-  { 867.6535813635206 , 160.9857253884399 },
-  { 955.718199469497 , 204.00269576088982 },
-  { 930.6598374729679 , 271.7298415614499 },
-  { 787.336665297617 , 185.18072567572352 },
-  { 335.5617898765347 , 565.29691421003974 },
-  { 210.1648140008691 , 138.83768862992622 },
-  { 860.3161049637037 , 72.16525597574693 },
-  { 926.51278145253 , 123.8064063950745 },
-  { 775.1815732371789 , 257.59499300409277 },
-  { 864.7631786883676 , 317.06639159261886 },
-  { 735.4453546141107 , 169.32295832939135 },
-  { 714.3910998455071 , 222.1556498769665 },
-  { 779.0253973131223 , 334.98615323999525 },
-  { 429.960035633248 , 397.05892293058287 },
-  { 767.3825019772995 , 109.75237581894135 },
-  { 752.1858803151094 , 405.8378647495292 },
-  { 304.4764300879879 , 170.30843040330865 },
-  { 684.9654925193447 , 342.12731401914107 },
-  { 844.0066463693288 , 411.63357843544 },
-  { 675.2910374208079 , 273.72454867624515 },
-  { 928.7231020069851 , 372.1621081278196 },
-  { 785.1671542358768 , 844.3113604047626 },
-  { 613.4273376269512 , 332.64159077011846 },
-  { 810.0902923435942 , 527.4624427285033 },
-  { 880.74094438215 , 467.59573466855795 },
-  { 955.511117570123 , 438.1562950347852 },
-  { 906.6032433452513 , 526.001684793017 },
-  { 51.1898607204253 , 229.28457097173305 },
-  { 992.7097793297394 , 494.7456153548411 },
-  { 904.0453579541672 , 589.0305972460028 },
-  { 73.8610615217904 , 626.2303709384818 },
-  { 780.9560065539254 , 599.3250088701677 },
-  { 160.1254081517802 , 642.3146444400056 },
-  { 742.7331960220472 , 546.3667978112068 },
-  { 94.067946228592 , 96.6851133496716 },
-  { 711.7494431802628 , 662.6276398995597 },
-  { 661.1656715026332 , 679.7792076506414 },
-  { 989.5865275697271 , 667.1002917605354 },
-  { 682.4916151727217 , 583.8983685847406 },
-  { 528.2895854944472 , 298.1135053640621 },
-  { 469.9489515591959 , 261.0835340673541 },
-  { 714.3057909238019 , 724.3281072797295 },
-  { 627.5300058326222 , 730.6591543139393 },
-  { 340.929040502474 , 372.30629696733274 },
-  { 262.5493745925842 , 335.0573825367326 },
-  { 483.2039206415326 , 342.35013872189575 },
-  { 405.63260639918724 , 327.2335867756052 },
-  { 96.19698473973517 , 463.2623146864705 },
-  { 144.38993727777904 , 375.66506325371563 },
-  { 202.14120466140685 , 310.1647062282369 },
-  { 256.82699881186943 , 386.59943534156116 },
-  { 673.4641524573162 , 456.28107704395813 },
-  { 679.5865683468735 , 801.4032545154271 },
-  { 842.8620794698135 , 611.9040738595501 },
-  { 73.40457922094902 , 396.0849713083544 },
-  { 433.6112617981327 , 482.020447518031 },
-  { 483.82810407769034 , 458.46794588152613 },
-  { 567.583614572509 , 457.4015507667134 },
-  { 623.4977401826633 , 522.67981907780586 },
-  { 370.75766433081037 , 727.0185702672104 },
-  { 350.9555143694172 , 655.7156856064128 },
-  { 437.71368898540925 , 625.5390821703097 },
-  { 448.9670461239009 , 558.8329623690186 },
-  { 316.85701813562946 , 798.8523855749947 },
-  { 117.1228265433015 , 703.5534913579461 },
-  { 595.9481364426427 , 222.9482555255078 },
-  { 657.6847505067934 , 115.10250678694592 },
-  { 421.41656181335 , 752.2279347720776 },
-  { 507.9279086344985 , 777.4192530999067 },
-  { 558.5671386517051 , 827.0272961006388 },
-  { 527.8029976460954 , 900.1733908781298 },
-  { 169.5371052444689 , 765.3057740708637 },
-  { 155.13295781778947 , 226.01194567845036 },
-  { 287.09572795184454 , 670.9425907960326 },
-  { 48.7064325687736 , 501.1706878097217 },
-  { 435.4533323213269 , 896.83726531668 },
-  { 372.3251203033499 , 481.09741323978346 },
-  { 998.4910955134317 , 98.56321966552363 },
-  { 792.6804137378829 , 735.0398543437204 },
-  { 523.480302694038 , 665.2467696539572 },
-  { 2.0 , 482.67394973780586 },
-  { 195.05145213883338 , 682.6508095064435 },
-  { 613.7054064717622 , 584.4231772746866 },
-  { 471.8803586839356 , 168.50063738290007 },
-  { 81.14528635865179 , 285.63430486759364 },
-  { 172.750295613705 , 863.813762303768 },
-  { 137.7437196705763 , 543.3777754131122 },
-  { 944.489632878207 , 643.3418596597741 },
-  { 170.9779297162474 , 961.233490255566 },
-  { 50.96231756356 , 51.4134724260331 },
-  { 381.86213588366087 , 244.55051853455024 },
-  { 856.7652577707826 , 3.0 },
-  { 134.5001142023693 , 155.67409957979632 },
-  { 997.8172280284507 , 556.67441273565 },
-  { 569.0926103148067 , 989.477767421042 },
-  { 878.1695118287266 , 769.2070292131964 },
-  { 742.5316256237637 , 794.5370506241686 },
-  { 724.3241587494078 , 464.37617309327914 },
-  { 219.19807887435013 , 518.9622190759268 }
-},
-{ //#24
-  { 589.9513601603343 , 428.5697757750328 },
-  { 649.5589135671307 , 436.0893609780723 },
-  { 243.3219276155007 , 380.3927780756299 },
-  { 596.5897305856311 , 356.6152090716713 },
-  { 214.8060020194407 , 472.61186727946796 },
-  { 695.9522795510935 , 461.49860404847067 },
-  { 660.7189870975433 , 519.9898844517899 },
-  { 681.4968401231068 , 343.1926478216382 },
-  { 575.9882526541973 , 774.7149969397789 },
-  { 642.1975013243655 , 286.37030048442773 },
-  { 738.3170160266179 , 416.8744131874007 },
-  { 506.3197956289865 , 450.45088521108926 },
-  { 445.0832076311435 , 341.4278046752415 },
-  { 602.6211963040913 , 210.77548982336165 },
-  { 554.1934641448582 , 245.76090393862495 },
-  { 538.6764305156099 , 330.06112406950695 },
-  { 624.9833846089253 , 565.3671195018404 },
-  { 527.4287934230267 , 500.55333856636196 },
-  { 491.30286096171005 , 581.4961350337652 },
-  { 809.6438598426093 , 454.6082926586888 },
-  { 669.1357888751834 , 168.91542809006194 },
-  { 745.2701897489511 , 303.1032721019802 },
-  { 416.92018435280045 , 609.5828784615379 },
-  { 716.6093896510805 , 231.49269185862195 },
-  { 381.7092247765028 , 651.8064740022136 },
-  { 672.5813615380791 , 114.40070260344271 },
-  { 485.2761906471967 , 189.127997531129 },
-  { 840.3927069108272 , 546.4172599012193 },
-  { 358.4766031991146 , 535.3461597397065 },
-  { 426.2248176112041 , 676.6943682493393 },
-  { 825.9130695281052 , 598.9866667386905 },
-  { 445.9407309750927 , 759.5524248192141 },
-  { 840.9174047465177 , 393.00032915824653 },
-  { 747.4299870763266 , 679.6589613274256 },
-  { 391.9301173131555 , 741.877200099121 },
-  { 780.0377374361465 , 641.1562213078378 },
-  { 970.2272362360782 , 246.65044033922305 },
-  { 722.7095159536037 , 766.8274160295344 },
-  { 301.61016169905827 , 698.6192188646462 },
-  { 910.0936257930856 , 511.60027575059684 },
-  { 743.7975066142794 , 587.3973984095999 },
-  { 943.6965228207587 , 829.8421566936062 },
-  { 814.9688142671927 , 799.5175022378518 },
-  { 886.5993522770125 , 825.7013661830786 },
-  { 235.05764386166567 , 650.490595264176 },
-  { 831.0526323307811 , 700.3352117434687 },
-  { 651.6643402936836 , 663.9072072481681 },
-  { 663.4626864890342 , 777.9858708361938 },
-  { 577.9182898036768 , 67.69168651067463 },
-  { 529.1827124966449 , 155.00081457282067 },
-  { 416.9367642756888 , 844.842872159861 },
-  { 732.7104135775678 , 64.36711757312759 },
-  { 315.2396028954049 , 885.3266126216937 },
-  { 163.2020727674116 , 662.3117847186429 },
-  { 404.47558935458073 , 895.1794243866842 },
-  { 237.5433777316303 , 565.7476558595779 },
-  { 89.45820194458196 , 687.7641668926192 },
-  { 780.988820794521 , 183.56968159979812 },
-  { 832.5706922908025 , 899.6840341546778 },
-  { 999.732789992965 , 553.9044559145218 },
-  { 907.6109565979646 , 634.1335567975918 },
-  { 682.1954324765702 , 866.2009656122101 },
-  { 234.48030194412343 , 865.1841096336362 },
-  { 252.60449795663635 , 782.7462556536341 },
-  { 306.7913792390687 , 496.00481107569243 },
-  { 145.51087447511918 , 840.1467305480382 },
-  { 485.07621438296366 , 893.1395425862223 },
-  { 494.13863331036015 , 963.5166356711906 },
-  { 488.599504336965 , 696.1174760777099 },
-  { 592.1532407239929 , 846.7827678217809 },
-  { 798.3381438613367 , 945.9751956798176 },
-  { 130.6887191431806 , 577.9334779836684 },
-  { 936.6724512325136 , 928.5342227736454 },
-  { 999.9985406698024 , 483.52393948910145 },
-  { 405.41181749053476 , 433.3947150307934 },
-  { 969.2554592523347 , 991.1658924209349 },
-  { 407.8318185828313 , 507.26648802784536 },
-  { 372.6478727763276 , 816.0036667927106 },
-  { 144.1794327237768 , 761.9023950534104 },
-  { 97.77220087056997 , 783.3979324448107 },
-  { 491.80764315294994 , 828.6533008640711 },
-  { 999.4179620267994 , 610.6140610378632 },
-  { 549.6869543787944 , 683.8465447284946 },
-  { 474.96860303463177 , 85.322302444314 },
-  { 999.5456401909269 , 814.5145952375792 },
-  { 4.0 , 697.3557095424765 },
-  { 302.92524588176275 , 976.8069007544217 },
-  { 404.7575871867703 , 158.163062222316 },
-  { 344.4597139054572 , 352.8147626282479 },
-  { 356.41322829577075 , 930.7039552482177 },
-  { 47.58740648816513 , 808.0637478031653 },
-  { 494.5405503530494 , 292.22957473790586 },
-  { 651.4464590915957 , 237.12558694492463 },
-  { 116.40239132064812 , 486.1194438721922 },
-  { 413.607008688237 , 91.04308019277084 },
-  { 494.7323916404915 , 5.0 },
-  { 20.265041185442897 , 624.8297259548269 },
-  { 932.3788502550216 , 728.497856037156 },
-  { 800.0874588628889 , 269.0619219337134 },
-  { 870.2198316560068 , 212.8957398438685 }
-},
-{ //#25
-  { 488.73201219465744 , 632.8112371095567 },
-  { 572.7614515642431 , 588.6336757817879 },
-  { 485.4926703830479 , 579.6032433451766 },
-  { 215.4400330428427 , 558.2979602758088 },
-  { 560.6072045076185 , 516.0151809352307 },
-  { 555.2680587563327 , 646.3231209894814 },
-  { 471.41420496667246 , 513.8008163128541 },
-  { 100.7713751160952 , 563.0120366348679 },
-  { 610.4883191429528 , 551.9959129814325 },
-  { 457.07782443743486 , 457.41177243540875 },
-  { 384.8259644387146 , 469.35668316415547 },
-  { 428.3548118767584 , 211.70189545933835 },
-  { 524.0119569300595 , 415.38601673940326 },
-  { 597.5605301304441 , 704.2931295018062 },
-  { 396.96697598365006 , 633.6682908361013 },
-  { 372.2206508530995 , 570.8624619865714 },
-  { 695.3110205340233 , 499.3072803607631 },
-  { 664.5588255036691 , 558.6447538003747 },
-  { 666.8298627543766 , 647.2659580003913 },
-  { 574.5671018538239 , 451.1400488321956 },
-  { 40.7517720550948 , 545.3470184788044 },
-  { 134.1838600488182 , 706.9019871931143 },
-  { 490.1867723945491 , 709.1334067759614 },
-  { 721.1304368341943 , 673.9287540019675 },
-  { 691.3927567885969 , 768.3803908176394 },
-  { 437.805592884611 , 693.0214367905935 },
-  { 776.3324006762879 , 606.7137176725373 },
-  { 632.6982497488594 , 792.4941155312958 },
-  { 749.7165379684977 , 457.4762073020361 },
-  { 792.9460389665094 , 547.9673758787001 },
-  { 824.730365008827 , 628.4961008321127 },
-  { 820.7612057855212 , 487.9348060432959 },
-  { 836.4086009303511 , 436.82468821997986 },
-  { 905.2280915805582 , 445.0381964554906 },
-  { 715.6734020155293 , 417.3230710404191 },
-  { 786.5481175012894 , 370.36759560980545 },
-  { 433.336837899054 , 361.14897176425734 },
-  { 153.32767043539815 , 512.9047886460085 },
-  { 878.6872411127842 , 572.6850945452702 },
-  { 896.6004425980068 , 657.4551256303366 },
-  { 920.4321824822225 , 389.0189242277153 },
-  { 737.9953515842853 , 736.950213941885 },
-  { 300.779858442441 , 459.3583097686617 },
-  { 569.0910607179097 , 360.15752619727306 },
-  { 978.3539556408139 , 588.4187554871191 },
-  { 810.6732983667337 , 725.3243319475913 },
-  { 316.58403907409064 , 399.2005650341456 },
-  { 663.4875700198086 , 378.8213884288318 },
-  { 264.08638141375576 , 212.5312594272508 },
-  { 199.5932814356327 , 644.8450672828379 },
-  { 284.1230325544484 , 302.76165187591187 },
-  { 255.98466961957524 , 344.60705269498817 },
-  { 999.7190712653855 , 784.8394154370712 },
-  { 980.4311206618509 , 705.9937310134269 },
-  { 990.2580596928394 , 630.9979818992476 },
-  { 678.1284166310131 , 316.8974925205697 },
-  { 951.923346941702 , 832.6237431646657 },
-  { 126.32581779412862 , 247.1105445748188 },
-  { 314.6817723622901 , 198.10359869844677 },
-  { 200.47922993612167 , 216.22458346369717 },
-  { 999.2952050557899 , 906.0193078987029 },
-  { 906.4798688076373 , 885.1759359583693 },
-  { 131.29696128370352 , 321.15994121321154 },
-  { 189.7933554531856 , 346.540922208215 },
-  { 965.9054478306516 , 979.9445333359348 },
-  { 92.61718348146542 , 176.96731609734354 },
-  { 615.4480116193656 , 74.11416932429324 },
-  { 73.91860674894906 , 386.13370780628264 },
-  { 622.0127573445351 , 270.3087641171419 },
-  { 562.043812911265 , 199.73558432112327 },
-  { 303.0579214331692 , 771.373176465328 },
-  { 592.2980894690222 , 122.35773215451525 },
-  { 318.4819654744592 , 677.7750847070158 },
-  { 697.6622429561471 , 105.71580692684142 },
-  { 362.9946919692182 , 116.1293699081748 },
-  { 421.71694413039637 , 789.6011771330312 },
-  { 396.9539368426779 , 868.7953961116305 },
-  { 842.3874245006896 , 854.9011036953589 },
-  { 595.4074328887905 , 3.0 },
-  { 997.3461553443506 , 506.71818788718224 },
-  { 480.3464804755885 , 814.8965371628321 },
-  { 501.30021283829717 , 270.7324088894794 },
-  { 380.39605878520507 , 262.2694297243858 },
-  { 479.93948605870594 , 143.22990839015677 },
-  { 911.259531970348 , 966.0561941273743 },
-  { 745.3651464420954 , 844.9841272415042 },
-  { 895.2093179193117 , 780.585751074567 },
-  { 356.4420902691511 , 30.399473556941643 },
-  { 369.7762259650498 , 717.2571087784078 },
-  { 238.45170699656836 , 120.93980275733878 },
-  { 228.25086389382153 , 476.05133057304306 },
-  { 644.3844372012363 , 853.1271364143677 },
-  { 736.4731994059458 , 278.36338357389144 },
-  { 6.0 , 397.61971362439573 },
-  { 661.756894687562 , 205.80251287948226 },
-  { 287.609559731015 , 617.9771484160101 },
-  { 319.70570009349063 , 835.7509336240103 },
-  { 220.8419213336074 , 751.1462166188257 },
-  { 221.5909600362544 , 40.7021627853577 },
-  { 133.3113243047453 , 434.96271221486484 }
-},
-{ //#26
-  { 467.73724901646267 , 495.46627018509434 },
-  { 301.54362120984416 , 450.8178452543954 },
-  { 899.3447198781288 , 540.5659862500165 },
-  { 544.1129562130504 , 508.8984037883223 },
-  { 894.6344487996361 , 439.84877134475647 },
-  { 587.0170729007255 , 476.3130441506869 },
-  { 548.8056258142941 , 383.9608909351843 },
-  { 830.6510343548262 , 568.2199939409716 },
-  { 489.8741156781525 , 367.12098149015446 },
-  { 442.4435997644699 , 440.0860528050547 },
-  { 642.0663638065607 , 506.82057959850465 },
-  { 438.06711854653355 , 366.9789150881297 },
-  { 403.15404264299275 , 483.7820914876388 },
-  { 433.70963030350686 , 562.6590894795307 },
-  { 537.0974886314496 , 593.8689548987427 },
-  { 466.458734456711 , 630.7322783387071 },
-  { 685.2525790284067 , 568.353020338807 },
-  { 630.9371307063137 , 608.4470635808942 },
-  { 734.6203404752373 , 491.1100632255244 },
-  { 569.5058910744972 , 655.4503949968395 },
-  { 450.61625055644663 , 297.56190283499893 },
-  { 740.1657094498112 , 578.3302877185025 },
-  { 645.8435390200486 , 375.1619733998299 },
-  { 94.6651621671197 , 408.65455468565426 },
-  { 357.5926332692159 , 264.37132993476865 },
-  { 358.03838795910843 , 315.31966539740966 },
-  { 486.3884686980897 , 214.85109777212256 },
-  { 416.72809801514006 , 221.166275885902 },
-  { 691.7275905406227 , 395.17284886863575 },
-  { 351.0736996834154 , 386.82718339274635 },
-  { 781.9750366295492 , 361.6818485041468 },
-  { 712.4444382031338 , 307.3125002720351 },
-  { 743.0743100821164 , 629.8673738653582 },
-  { 364.8232698706432 , 182.8213728843316 },
-  { 667.8390729436703 , 279.7249630740489 },
-  { 712.9727078487872 , 254.7106831975016 },
-  { 285.5708303137635 , 223.03694407844102 },
-  { 808.0555527082909 , 271.9962148299968 },
-  { 491.828801608674 , 162.01899327270002 },
-  { 548.3276058149133 , 240.68112705169196 },
-  { 844.9177118851779 , 188.8428315364224 },
-  { 679.3577185934432 , 194.25594335038016 },
-  { 876.6926733101725 , 332.5906284637407 },
-  { 885.2732417153168 , 253.94359696463465 },
-  { 676.5038851211664 , 142.7476645414195 },
-  { 738.0651587710755 , 728.9255898604049 },
-  { 324.46193132063604 , 152.4917457922055 },
-  { 608.8971731120675 , 196.89248506962434 },
-  { 676.883710061366 , 906.7114084787495 },
-  { 658.0653994145868 , 843.7046642459113 },
-  { 677.3122579009936 , 750.4332409622252 },
-  { 738.2178360099433 , 823.4729154589811 },
-  { 450.8667058666932 , 852.3729076465338 },
-  { 530.4850132404398 , 874.2701488339021 },
-  { 758.7029331906664 , 117.78434788924193 },
-  { 582.8990360385013 , 939.2689829233539 },
-  { 249.40272188885842 , 846.1697821193557 },
-  { 346.9223833145114 , 848.7362667176981 },
-  { 543.6717419557381 , 999.6973398502107 },
-  { 382.34084558464286 , 782.1858199258652 },
-  { 131.0452352251691 , 789.2522413969243 },
-  { 141.91625101357886 , 883.6578396631032 },
-  { 192.6755314445071 , 887.3740282763597 },
-  { 353.21736850246634 , 695.4126182624502 },
-  { 219.45215183671527 , 597.6413248922061 },
-  { 169.68844250560193 , 567.6666305205363 },
-  { 179.1830073039955 , 485.45363720735503 },
-  { 976.4882803691909 , 288.0490464997211 },
-  { 102.06339675084348 , 709.2654173964299 },
-  { 326.5985572312135 , 626.4137797088181 },
-  { 298.15554102602414 , 554.5595064194654 },
-  { 92.98489943685286 , 637.9332772600619 },
-  { 233.83070277402197 , 978.2498710833008 },
-  { 825.284027613605 , 896.286395752111 },
-  { 680.2261590210323 , 44.27542057496174 },
-  { 703.0117283385163 , 999.9555927217573 },
-  { 813.5567007962079 , 413.2341937665748 },
-  { 340.76671791345797 , 937.3204153728718 },
-  { 183.59655487769942 , 389.68622954426866 },
-  { 784.9403789146714 , 847.001887812251 },
-  { 248.0122203731798 , 772.1888087386551 },
-  { 604.694816900893 , 758.1661120881886 },
-  { 838.6686287997004 , 633.7612065097587 },
-  { 325.51366341121536 , 999.0869769807266 },
-  { 833.076322112848 , 749.4741094305839 },
-  { 5.0 , 647.7491677586552 },
-  { 768.2288549849949 , 1.894839078939583 },
-  { 300.6175500686009 , 500.55631012006614 },
-  { 36.23033855474068 , 958.5089389804189 },
-  { 90.11771107744539 , 961.5556250064515 },
-  { 75.14862189105418 , 814.5426330036676 },
-  { 371.71115397810973 , 88.92521638876963 },
-  { 522.5138111594961 , 773.7610912887287 },
-  { 88.42196507734138 , 445.9250262734486 },
-  { 205.7845904124153 , 234.9271799283144 },
-  { 590.6695442385491 , 94.05587981205537 },
-  { 657.1560552732354 , 447.40046567930153 },
-  { 286.9389578429549 , 376.8686694567027 },
-  { 561.7779853602153 , 324.4872608852098 },
-  { 850.0935943513266 , 4.0 }
-},
-{ //#27
-  { 54.66277947792076 , 231.69590523369476 },
-  { 55.8083681970588 , 300.790716898756 },
-  { 474.1416810893764 , 215.58005467838234 },
-  { 394.65241034491896 , 275.9191045372255 },
-  { 402.13780165775455 , 181.60799372212475 },
-  { 349.0740166425188 , 523.43694691476557 },
-  { 508.9246201008932 , 259.1481449134204 },
-  { 483.2431772481131 , 150.6805523578175 },
-  { 370.91493133121423 , 339.65142186105527 },
-  { 431.62203557119057 , 351.5800162124099 },
-  { 501.6963261575246 , 332.88365499425163 },
-  { 337.606963909271 , 193.59238828254522 },
-  { 568.1779847616813 , 200.22163221961247 },
-  { 635.2947426164421 , 253.13494979436155 },
-  { 301.89103980169165 , 301.500143112887 },
-  { 393.1053229283309 , 122.50559393490838 },
-  { 536.0437922108588 , 106.475572466601 },
-  { 581.2659809590466 , 315.3520777131746 },
-  { 86.1997679269725 , 371.3257140258985 },
-  { 515.2901770256616 , 385.1032688204767 },
-  { 667.5439088362875 , 365.78931127681847 },
-  { 623.6102617709334 , 405.3052796232144 },
-  { 293.03178001113645 , 236.22875619295178 },
-  { 344.6818650702595 , 108.74815766861501 },
-  { 502.83492046944673 , 464.5491999515418 },
-  { 560.2121629545553 , 455.28948133624766 },
-  { 138.7712067177416 , 225.60144513145605 },
-  { 284.1888838067572 , 857.0005931332127 },
-  { 212.65568460219706 , 179.68455380214567 },
-  { 231.8903317259614 , 316.95582498609195 },
-  { 55.3666703065522 , 125.8334217534498 },
-  { 264.68771764543817 , 117.56414552573911 },
-  { 274.8960790152073 , 29.1802870383072 },
-  { 210.12445801914888 , 3.0 },
-  { 144.96270871789443 , 139.0850411103226 },
-  { 191.20289804793637 , 79.1599669710061 },
-  { 504.6508522231422 , 633.4431998993573 },
-  { 590.3022689543482 , 656.9504443589612 },
-  { 517.4298440482191 , 936.4408984513221 },
-  { 720.4111624658298 , 611.2037252843353 },
-  { 633.5868802280364 , 788.1248375035123 },
-  { 610.5822938406369 , 845.7715731080884 },
-  { 544.3681132949362 , 688.8466089582621 },
-  { 563.1661443685173 , 779.0645668899394 },
-  { 839.1418190077704 , 905.0794475006469 },
-  { 847.5540888238734 , 722.2290483080919 },
-  { 679.9939766681848 , 821.9574587426825 },
-  { 761.1746205601156 , 878.1404067494607 },
-  { 134.6156320423556 , 810.2587585629794 },
-  { 962.4758945579965 , 870.0272183456611 },
-  { 984.6013080059411 , 807.2782114154147 },
-  { 213.3665434986542 , 919.2192890122906 },
-  { 870.7275382403855 , 554.7668254585219 },
-  { 953.4338311592678 , 557.5521283164862 },
-  { 945.5654793412202 , 468.4785342833868 },
-  { 999.690515522292 , 958.1032609445022 },
-  { 239.9059855488823 , 744.2375606841522 },
-  { 681.1165553685279 , 540.711626343458 },
-  { 743.3840963392639 , 991.1226868320095 },
-  { 790.8113369235924 , 527.9484464912284 },
-  { 324.1629876469026 , 973.201814637489 },
-  { 389.0784717679174 , 975.7198564447751 },
-  { 439.39796846342455 , 963.0928387748713 },
-  { 478.6827505612421 , 528.6402054010794 },
-  { 63.340091745715654 , 592.9789616487024 },
-  { 97.04022312066223 , 554.7647993671783 },
-  { 941.0048771816112 , 904.4832055131428 },
-  { 665.0745644856216 , 497.5310895064174 },
-  { 237.5920923982735 , 495.2546174395025 },
-  { 202.6024118816401 , 591.3258098641481 },
-  { 128.69422984385807 , 647.2542557879342 },
-  { 73.90977829863857 , 466.4671547376167 },
-  { 427.06529325580993 , 611.0437802399708 },
-  { 313.6593651604335 , 902.8748508341321 },
-  { 793.0276042510468 , 777.556420965901 },
-  { 663.7870998718661 , 174.24034710156502 },
-  { 327.22416724292066 , 388.5221860571657 },
-  { 586.3360079150356 , 523.2207098401789 },
-  { 947.3317032313214 , 704.4758478908032 },
-  { 298.4876656214581 , 776.4973496436874 },
-  { 53.72609808369447 , 11.518582629720186 },
-  { 277.21502326423996 , 540.2482316168728 },
-  { 734.3124283923732 , 358.65683200201374 },
-  { 409.6998698498006 , 452.41426621898165 },
-  { 431.57377620967094 , 48.02322433996915 },
-  { 735.6024367854887 , 442.47106939133073 },
-  { 509.52586540788695 , 854.5867820250867 },
-  { 102.77685364543157 , 42.30058542330451 },
-  { 180.23741949834522 , 275.42375824026334 },
-  { 677.0415265695977 , 709.0262341298749 },
-  { 403.2740228273091 , 780.7546464972106 },
-  { 202.3417177335302 , 838.8122792385118 },
-  { 374.10997160777146 , 686.7921289887586 },
-  { 868.5524095972296 , 638.4327109282328 },
-  { 293.2050302564355 , 644.9025229353404 },
-  { 0.0 , 553.5354826390392 },
-  { 260.0523104985642 , 364.41132235331355 },
-  { 183.6854619147894 , 411.3886421753139 },
-  { 559.6419944923016 , 577.994795613269 },
-  { 885.9260145568308 , 814.1370554924019 }
-},
-{ //#28
-  { 750.2861140813617 , 459.45118604419855 },
-  { 834.6750566799432 , 407.56396733451976 },
-  { 378.6663266248294 , 429.7504497512614 },
-  { 763.0503399744722 , 409.01331418291517 },
-  { 291.9782048838213 , 405.828678555976 },
-  { 888.9131843626494 , 485.288189232886 },
-  { 398.8614120968743 , 363.5395829921134 },
-  { 830.9596395675219 , 536.4378545205716 },
-  { 928.4954729617112 , 536.5781805186332 },
-  { 395.8682411457119 , 291.8832565847532 },
-  { 743.353383320952 , 545.238940985334 },
-  { 807.471926078497 , 598.1497309418187 },
-  { 934.1915935553002 , 440.2279624519422 },
-  { 695.5895499082748 , 497.6836596399543 },
-  { 902.6280030521517 , 614.7948784894884 },
-  { 304.9713602567389 , 328.52463826866705 },
-  { 375.1187570191094 , 647.2763948740021 },
-  { 992.0617265275675 , 509.27618213409386 },
-  { 492.7148365675233 , 150.1800180928235 },
-  { 656.1693048651049 , 459.71185272369956 },
-  { 721.7781235594881 , 595.4622998702449 },
-  { 203.3878794699476 , 610.4893379408172 },
-  { 953.4548709824282 , 685.6420370906433 },
-  { 736.5917801407138 , 354.96002765669834 },
-  { 836.2942929840673 , 704.6911233085623 },
-  { 597.8831303751917 , 507.1789998169072 },
-  { 862.5421835250329 , 315.64186415023175 },
-  { 99.5331220880087 , 599.9529830488557 },
-  { 973.7964764045894 , 347.40350261352074 },
-  { 923.9582977453003 , 297.5874987311096 },
-  { 685.5922947349691 , 312.8161668219632 },
-  { 652.7701505756371 , 598.392129463546 },
-  { 830.930742931431 , 272.01322488485624 },
-  { 566.9618770703911 , 576.7638333724149 },
-  { 903.4508618014619 , 746.7368714933725 },
-  { 983.15858056488 , 777.5039626191581 },
-  { 773.3506906509931 , 269.39243798873576 },
-  { 834.8244201768664 , 191.90569959434612 },
-  { 681.6127763898392 , 684.884976371349 },
-  { 169.6629430531239 , 710.3664469509381 },
-  { 634.0436618939846 , 667.8196352673789 },
-  { 743.1161880287927 , 676.295067054547 },
-  { 999.2361210287188 , 300.17444519553413 },
-  { 155.2491668628254 , 173.47597203423845 },
-  { 540.3777000192708 , 653.2118399849769 },
-  { 547.2351217317041 , 301.5204529285462 },
-  { 629.34045152061 , 756.8576888507187 },
-  { 446.8549386382319 , 426.282231389481 },
-  { 499.5064353119121 , 595.5860465726969 },
-  { 538.2696489293191 , 748.724498090802 },
-  { 540.5738209469826 , 388.96484371896645 },
-  { 516.9273898611021 , 487.15645053638815 },
-  { 107.8062228741639 , 700.1189610566859 },
-  { 929.8714593869529 , 203.29018283034583 },
-  { 716.7602379421678 , 211.17766978857236 },
-  { 465.46511859229275 , 237.7835825011004 },
-  { 898.8111708937597 , 116.0888267485829 },
-  { 918.3113100141493 , 824.7065079094698 },
-  { 712.1183758063455 , 86.61056332861176 },
-  { 706.7044992006829 , 155.3069797319497 },
-  { 293.98818529915764 , 484.7456597764532 },
-  { 389.40738765417115 , 496.69361347732314 },
-  { 674.2593231302678 , 808.4452221650369 },
-  { 433.663563898274 , 569.3906721945414 },
-  { 843.1370277645597 , 865.0450604818542 },
-  { 770.3931780162058 , 807.0606811674403 },
-  { 118.69095361513882 , 242.7233436055746 },
-  { 55.293215939382435 , 193.98261680929107 },
-  { 228.94231467363556 , 451.72104774285674 },
-  { 676.4238927615316 , 0.0 },
-  { 187.1907286304098 , 375.24025496617884 },
-  { 121.72644549287827 , 311.5142698338936 },
-  { 363.5015262831702 , 751.1368743342739 },
-  { 357.8238640882681 , 846.8716659942094 },
-  { 734.217122523262 , 893.9003936205124 },
-  { 979.5523730771185 , 894.8038948284366 },
-  { 282.45085947235765 , 557.253315407241 },
-  { 292.9258836758093 , 633.016860961663 },
-  { 71.70564836078529 , 119.31579444698741 },
-  { 421.06624010945615 , 697.8627413192644 },
-  { 619.3729127918863 , 860.5749670959276 },
-  { 264.7034706162872 , 795.822133578201 },
-  { 121.97022034766235 , 42.00182505099133 },
-  { 212.0942695171069 , 293.38831438230034 },
-  { 70.58154919320964 , 394.4713599895249 },
-  { 105.6092517631917 , 459.7810200541785 },
-  { 18.5317722180598 , 550.1441830386422 },
-  { 0.0 , 351.4022875710782 },
-  { 125.1469299461448 , 518.5237362240663 },
-  { 656.8049591830876 , 180.7187081368266 },
-  { 560.0197126368525 , 191.08284072999584 },
-  { 192.11273905775806 , 535.9618724882721 },
-  { 250.6765844052846 , 700.7624673108229 },
-  { 669.0068595268923 , 938.0160293495876 },
-  { 458.64840126048966 , 794.0802879898014 },
-  { 797.0451236040007 , 145.4249846247854 },
-  { 283.7942319585957 , 841.334654696736 },
-  { 555.8932683128397 , 831.5754169570038 },
-  { 816.5454887202228 , 64.9160195108156 },
-  { 640.2460166870948 , 371.95218569241285 }
-},
-{ //#29
-  { 547.1618565188003 , 154.063444166905 },
-  { 517.0050899810262 , 499.12594930534 },
-  { 609.3382585640768 , 493.6635717397558 },
-  { 564.4458507098972 , 459.61563574153854 },
-  { 568.1837569195854 , 55.9793189560534 },
-  { 521.2051549915022 , 597.9605731589463 },
-  { 282.7801522098019 , 646.0226289253703 },
-  { 365.26518277239387 , 141.421562884063 },
-  { 631.5352071709228 , 597.2925766250224 },
-  { 283.99409396534946 , 200.54714222889913 },
-  { 547.9240773580383 , 380.9942537974636 },
-  { 423.5345505646885 , 579.134321500665 },
-  { 508.4897211974855 , 678.8910395814999 },
-  { 482.29611580498874 , 360.6766025488457 },
-  { 387.67931361248117 , 526.9891067745373 },
-  { 572.4617933868457 , 319.9153914157667 },
-  { 495.3525610094622 , 292.1888686658428 },
-  { 391.6970108635338 , 435.5858456219611 },
-  { 571.3961413251366 , 699.0809959167061 },
-  { 648.7760051321789 , 388.0385316527246 },
-  { 149.5400781100303 , 782.3588069993186 },
-  { 483.6952181335042 , 730.2241478480948 },
-  { 650.7398070764754 , 652.6849394341441 },
-  { 640.8717918067015 , 721.1398179130315 },
-  { 697.2531168405345 , 544.8002767894864 },
-  { 722.987926240128 , 634.8266375261039 },
-  { 817.8675360493692 , 627.4761133580756 },
-  { 769.0894716449124 , 549.0584836800463 },
-  { 49.7163610549692 , 693.3738576825585 },
-  { 772.5383551460815 , 703.0306499927567 },
-  { 734.5305409689472 , 442.9070111983103 },
-  { 612.1801015570081 , 777.7632015283239 },
-  { 709.2952746008007 , 747.0931979073987 },
-  { 827.7443295659536 , 712.9278747587905 },
-  { 811.3984329655598 , 505.384194738653 },
-  { 421.9651581316706 , 696.4988781261727 },
-  { 887.5191471607809 , 499.67768479604786 },
-  { 880.4742474228913 , 606.2942472924503 },
-  { 743.1186789694489 , 788.381002564138 },
-  { 857.9844307182464 , 145.7802053436458 },
-  { 384.2124827954941 , 354.92039053148295 },
-  { 951.2845942462973 , 531.9694458806669 },
-  { 306.7021517301327 , 474.9494791510469 },
-  { 829.3549724330508 , 791.6070182680626 },
-  { 840.903736781484 , 429.43888759696534 },
-  { 790.2335056554552 , 854.1432251789984 },
-  { 732.0560428418071 , 933.3512787972236 },
-  { 915.1510880451215 , 649.2918474251769 },
-  { 687.1641313773987 , 345.75344034390264 },
-  { 573.6991120570669 , 237.14735731246583 },
-  { 845.8307181244413 , 374.0517101842789 },
-  { 913.7065061084538 , 405.40337005197284 },
-  { 553.1234331740419 , 875.1644949386633 },
-  { 489.2362478111279 , 792.9618019778447 },
-  { 606.7373249265695 , 835.395299215481 },
-  { 670.8025064027196 , 237.36275412580835 },
-  { 952.35630979898 , 345.2421360055877 },
-  { 786.8535299822715 , 323.2908555222031 },
-  { 322.37018593989836 , 371.7501197852208 },
-  { 872.0442835491945 , 325.17253684987236 },
-  { 478.8637566003326 , 891.9371676931505 },
-  { 946.0260751981449 , 697.475271527375 },
-  { 901.4451466547421 , 761.2153518128287 },
-  { 257.20293474032496 , 444.13330765408506 },
-  { 661.44989665923 , 850.8754660594276 },
-  { 210.7112860591628 , 738.9181300691183 },
-  { 211.4604273723844 , 659.0797954636495 },
-  { 116.2388807143313 , 672.581837771955 },
-  { 320.8330319048252 , 569.6010970309974 },
-  { 392.49683971405614 , 765.9708083794347 },
-  { 381.58363745376766 , 658.6365146268347 },
-  { 975.1866448958967 , 432.9590159331858 },
-  { 272.23631734754485 , 303.962461587271 },
-  { 163.64046338176496 , 151.19469475539665 },
-  { 91.6373770595858 , 304.5255373257793 },
-  { 895.0426661619431 , 232.76136969987158 },
-  { 68.2658473356003 , 567.4016862078012 },
-  { 168.1448984009853 , 480.9294945260554 },
-  { 194.359609203828 , 242.4777657686542 },
-  { 146.6377589514736 , 356.7742447204579 },
-  { 148.9949351368505 , 581.058594066764 },
-  { 588.605444380855 , 939.584593168265 },
-  { 295.3355254990825 , 778.3912548525338 },
-  { 438.1874486271985 , 81.52848717847036 },
-  { 449.2627986125232 , 244.43866908090843 },
-  { 451.8102997022511 , 469.4001601830931 },
-  { 455.722590448975 , 167.1608283448699 },
-  { 999.42622048421 , 623.1135784752676 },
-  { 433.769206464831 , 384.8434081617285 },
-  { 875.0745910060342 , 928.6210203899096 },
-  { 8.0 , 332.6207636686231 },
-  { 7.831440083667417 , 431.87178451699504 },
-  { 262.3729166456937 , 877.8856672287795 },
-  { 106.45761282664057 , 425.81246390484824 },
-  { 439.83146455350914 , 3.056747723026888 },
-  { 359.931989625877 , 252.27582498895504 },
-  { 218.3693532807585 , 400.02874985079114 },
-  { 502.11834323283483 , 3.0 },
-  { 925.5804620077133 , 840.3224068659686 },
-  { 241.08738100787804 , 548.8841742418185 }
-},
-{ //#30
-  { 293.4516681578684 , 394.2702049942162 },
-  { 619.9235674359982 , 446.4179559487309 },
-  { 546.7632325046268 , 413.95683325947203 },
-  { 524.1564359317786 , 664.0938859709113 },
-  { 390.1844618315224 , 368.6700481620144 },
-  { 618.1290814811293 , 148.7213216765259 },
-  { 643.9604065435551 , 399.2741131629888 },
-  { 274.7745762526197 , 511.0580675602498 },
-  { 559.0417939290427 , 316.1751518861048 },
-  { 644.0934894295608 , 299.90435080430143 },
-  { 702.4106302962598 , 320.3940461109262 },
-  { 590.5625089538185 , 269.4754693211488 },
-  { 732.2584871728548 , 365.8681479289848 },
-  { 670.4125537229525 , 243.82973282439664 },
-  { 728.0903514688077 , 443.64082278314595 },
-  { 649.5985330736078 , 501.46646629028044 },
-  { 709.9165029853995 , 524.2737032504144 },
-  { 746.8532527502304 , 894.2078926500433 },
-  { 749.7659197700681 , 243.5488597114883 },
-  { 475.25556191216276 , 439.9303487552893 },
-  { 468.19710775554364 , 362.98326152461533 },
-  { 793.6308998141164 , 326.4902233590832 },
-  { 544.4336968336694 , 229.88374587370419 },
-  { 594.1537434559061 , 530.4885823411557 },
-  { 804.0804375672524 , 216.0385120462863 },
-  { 766.2725768975067 , 486.81182139123985 },
-  { 534.2697382854063 , 513.1552259920746 },
-  { 861.9603288974068 , 135.73629636746026 },
-  { 798.6024001632313 , 543.7758265730622 },
-  { 800.4312861484515 , 433.654117409862 },
-  { 454.24224498548557 , 534.4346969689814 },
-  { 871.1958621317258 , 485.2113819657842 },
-  { 615.1897828170818 , 585.8211597762413 },
-  { 857.1101640907889 , 404.00863053392504 },
-  { 406.5110589088559 , 292.6940781470508 },
-  { 428.09530188666065 , 471.8727724300172 },
-  { 923.1491760242029 , 435.32203046374354 },
-  { 868.5266841505443 , 268.9078056701921 },
-  { 699.2323319526033 , 596.3635664276053 },
-  { 769.4366872275574 , 622.6696362872975 },
-  { 929.7595452647979 , 23.75647231477393 },
-  { 959.9059032098279 , 232.48996225557232 },
-  { 935.2459370963282 , 340.6697780659715 },
-  { 958.9814057931246 , 625.7342727338009 },
-  { 863.6983443289572 , 634.5614442766913 },
-  { 982.4032655142582 , 363.8899382818431 },
-  { 907.3555633038669 , 556.9989919823481 },
-  { 600.4388744135479 , 648.8660366154777 },
-  { 811.6432748596419 , 671.2919980922054 },
-  { 979.621145316328 , 481.98980220602874 },
-  { 352.5961249068207 , 152.26969462017536 },
-  { 686.3316208310991 , 193.17319191601933 },
-  { 994.2324049912239 , 430.37407602008324 },
-  { 473.06315286470397 , 591.8996413618413 },
-  { 28.628317043058 , 445.63768057681096 },
-  { 744.0702894282826 , 706.8231612119853 },
-  { 791.6489003591591 , 81.3310780561875 },
-  { 671.4266848572681 , 725.4786600274222 },
-  { 370.1122284731885 , 487.90441270027907 },
-  { 1012.0267316168311 , 538.3539037647074 },
-  { 118.4092310142003 , 299.1903419153083 },
-  { 999.888300308274 , 271.5327233265098 },
-  { 817.9028115659894 , 760.4100817455276 },
-  { 351.7805298003205 , 416.0372136429764 },
-  { 666.4510738460712 , 830.1418535757683 },
-  { 583.0753633300044 , 901.4128436349132 },
-  { 711.253589754384 , 761.7200870097804 },
-  { 727.9857907437399 , 96.85099665566787 },
-  { 339.028379905953 , 236.84132652291427 },
-  { 479.63850470418583 , 246.83721242674238 },
-  { 600.0314285873878 , 747.1532773484776 },
-  { 568.1195318032287 , 824.8087954587452 },
-  { 153.85881549807124 , 503.9475943130984 },
-  { 88.44712004324549 , 603.282453133659 },
-  { 9.0 , 615.709971772808 },
-  { 488.0614196460132 , 900.7412304760736 },
-  { 372.28676540546803 , 589.8810894764476 },
-  { 307.1818074766764 , 661.5271751973492 },
-  { 257.0128596699707 , 589.6732368282875 },
-  { 168.80935879989102 , 566.9845176015793 },
-  { 182.7999969472548 , 239.0756093328572 },
-  { 901.6372523479898 , 751.3338409120927 },
-  { 753.5334582091313 , 0.0 },
-  { 977.9677231370733 , 845.1127648553522 },
-  { 119.915053181544 , 393.78839486186644 },
-  { 203.2698251979898 , 337.07523067065785 },
-  { 853.3351243631998 , 31.883031698070113 },
-  { 219.7890400364881 , 431.59088821188976 },
-  { 486.66356332813007 , 989.0236379086232 },
-  { 1403.6470821773719 , 307.76587556263235 },
-  { 567.1106829611095 , 999.8721364194535 },
-  { 661.1052898046044 , 886.4055577824196 },
-  { 265.409751532593 , 289.6013638349314 },
-  { 541.4323534616643 , 132.179791995718 },
-  { 956.3668083764355 , 140.2431632662565 },
-  { 29.4200416767274 , 354.6561946507356 },
-  { 999.875112132992 , 744.4014804286895 },
-  { 849.5173937423824 , 848.3180476608488 },
-  { 1010.339669175901 , 152.14637326598498 },
-  { 72.9991528608607 , 218.68262845280788 }
-}
-};
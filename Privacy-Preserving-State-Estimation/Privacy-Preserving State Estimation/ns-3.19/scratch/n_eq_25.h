@@ -1,1748 +0,0 @@
-using namespace std;
-
-
-/*
-struct coordinates {
-
-	double X;
-
-	double Y;
-
-};
-
-
-
-template <typename T, int N> char (&array(T(&)[N]))[N];
-
-*/
-
-struct coordinates n_eq_25[64][25] = {
-{ //#0
-  { 318.47771677784675 , 53.851167292794685 },
-  { 252.28408238135296 , 141.69308704289642 },
-  { 162.1855490300067 , 78.6054148086449 },
-  { 211.30675335211873 , 29.108800825512976 },
-  { 55.943367396472084 , 50.13790803781868 },
-  { 267.369509138381 , 110.76337861109872 },
-  { 368.4121318441995 , 151.85297488827325 },
-  { 464.6115534324616 , 98.52876475737867 },
-  { 502.23034899685194 , 201.88555611762072 },
-  { 396.50117506059627 , 171.568203351309 },
-  { 356.29254867864887 , 79.42920169579298 },
-  { 477.0479724262587 , 169.05920169804824 },
-  { 357.4680424897272 , 173.85105084535024 },
-  { 317.5489349856533 , 0.6412940546867283 },
-  { 417.97312069819554 , 131.18534692819827 },
-  { 544.7645780973279 , 82.38589890884492 },
-  { 149.22017749271737 , 108.42372791082889 },
-  { 435.3771148257715 , 93.88298458365415 },
-  { 436.73414231974147 , 4.4162020725188 },
-  { 313.4906683318936 , 99.40827075264309 },
-  { 548.868781731118 , 169.22897394680112 },
-  { 172.08838436576264 , 0.837273306117595 },
-  { 428.4007138416771 , 50.01257165048662 },
-  { 334.99554760784883 , 262.75404595663804 },
-  { 506.07262990370737 , 161.98194320649407 }
-},
-{ //#1
-  { 594.5259388110716 , 434.46853903728237 },
-  { 492.5449866472706 , 393.2655598274662 },
-  { 518.1204646442865 , 355.3483543980342 },
-  { 647.8501489419662 , 530.6679606255445 },
-  { 412.9365045359122 , 323.1903905955804 },
-  { 408.7330013727301 , 366.8454400728434 },
-  { 517.6525862536154 , 382.153089447441 },
-  { 549.1940245066274 , 298.98572842324086 },
-  { 555.6047731736489 , 470.7631131642417 },
-  { 470.0738398673792 , 222.58025425645576 },
-  { 503.9675959828288 , 567.8785189027951 },
-  { 757.0203001609951 , 517.2635515444123 },
-  { 617.5327961756544 , 636.3971345618003 },
-  { 508.1906386981626 , 378.18539059558043 },
-  { 600.8639914010834 , 374.16599676588044 },
-  { 539.3583639483359 , 282.9801541605514 },
-  { 533.7479658570868 , 495.24651199126714 },
-  { 429.81066650351363 , 315.9594550509472 },
-  { 527.8124740989922 , 266.02503998459446 },
-  { 511.896154426454 , 491.9923519750966 },
-  { 557.5243633576857 , 360.7898651739902 },
-  { 583.087780622077 , 491.47304473600997 },
-  { 739.8140733512201 , 625.8993921264714 },
-  { 664.7749243926779 , 577.1683990057151 },
-  { 419.176633516933 , 248.81881317481947 }
-},
-{ //#2
-  { 21.427012416014435 , 246.79113155322005 },
-  { 95.0246878094252 , 165.05263219896142 },
-  { 131.4002604062659 , 248.71072173725688 },
-  { 131.41701241601442 , 246.79113155322005 },
-  { 154.92953527072797 , 72.8072564306442 },
-  { 240.9884672591255 , 237.20487140840513 },
-  { 262.8987091781365 , 51.82017502917806 },
-  { 348.9576411665341 , 258.1919528098713 },
-  { 102.93275363543961 , 354.9529033707915 },
-  { 151.0909396284199 , 182.73025349447454 },
-  { 41.11769163816844 , 184.64984367851133 },
-  { 50.97541877492185 , 171.77813192994586 },
-  { 117.10216041711945 , 287.3369597217785 },
-  { 252.75821957827196 , 311.5161629407659 },
-  { 132.71391812918046 , 98.18045653653506 },
-  { 129.01346702072573 , 269.6593384262654 },
-  { 35.59851239062709 , 46.54327934571493 },
-  { 204.41215108098157 , 176.54971787377062 },
-  { 168.73933760793955 , 190.2215539832251 },
-  { 139.119499233647 , 134.71542861215858 },
-  { 149.4171510809815 , 81.29558371152024 },
-  { 151.0909396284199 , 186.56943386254815 },
-  { 137.68653054728776 , 295.73958508157716 },
-  { 132.30353424349747 , 246.15547113125876 },
-  { 246.11537787605698 , 11.301628977896705 }
-},
-{ //#3
-  { 146.53144911566164 , 63.92602294329579 },
-  { 176.84880188197337 , 169.65519687955148 },
-  { 236.75364934327615 , 77.40982111123427 },
-  { 137.89529219083076 , 29.19337867590368 },
-  { 256.454446179492 , 67.76461858560387 },
-  { 336.8960398205845 , 142.77761820887807 },
-  { 35.91434002702982 , 70.39635788571987 },
-  { 135.97570200679394 , 139.16662666615514 },
-  { 82.90029219083078 , 124.4475128381541 },
-  { 93.15832881892351 , 129.67424356201334 },
-  { 86.7388878331389 , 14.52451577432376 },
-  { 232.2893335932806 , 108.78883899757757 },
-  { 141.6435139632855 , 100.71371065203161 },
-  { 43.58685457414618 , 180.11842777379792 },
-  { 155.10151900060575 , 137.82921925796288 },
-  { 40.77988645227741 , 80.83055586672384 },
-  { 190.48674679554205 , 147.31571971119945 },
-  { 340.2585075006891 , 129.77592039904374 },
-  { 288.6795973852539 , 241.63597536132343 },
-  { 338.3389173166523 , 239.74916838929522 },
-  { 359.35807056227475 , 21.45691564523098 },
-  { 125.21162469115325 , 72.5397911409981 },
-  { 53.80159421318375 , 34.520076255537845 },
-  { 151.82061398816072 , 179.26261807409495 },
-  { 155.04792304441764 , 77.49659307807306 }
-},
-{ //#4
-  { 504.65235573388406 , 80.50055465242838 },
-  { 609.8363158422584 , 48.34259084997462 },
-  { 476.1848489630578 , 186.742736285963 },
-  { 438.4587213373903 , 168.34247440253012 },
-  { 582.4270305965924 , 158.27522951513674 },
-  { 517.3878281728739 , 84.76178412216204 },
-  { 426.25043389670503 , 284.7445438814416 },
-  { 536.1734309605354 , 288.58313952374965 },
-  { 500.2648609991473 , 57.92885099478959 },
-  { 518.4958096650222 , 224.83969642013878 },
-  { 520.1972206916489 , 94.74479900911932 },
-  { 561.4399491951262 , 266.2444034225453 },
-  { 643.1784485493848 , 192.64672802913452 },
-  { 405.7939985814387 , 128.71699708775898 },
-  { 347.27287873206126 , 106.83684694978268 },
-  { 313.2840995207608 , 2.230140722478751 },
-  { 491.4924983376554 , 77.82315140507767 },
-  { 641.258858365348 , 302.619976019386 },
-  { 396.9080696389052 , 20.310055430399295 },
-  { 390.6934061560362 , 67.51511113960457 },
-  { 393.09389757341927 , 82.67121746207128 },
-  { 524.1412107235823 , 251.55203961138204 },
-  { 573.8625363925581 , 139.66735034904818 },
-  { 354.88416484729356 , 171.5126992697734 },
-  { 633.5998817937922 , 349.254910151248 }
-},
-{ //#5
-  { 590.6608789759457 , 434.75253414210624 },
-  { 620.9782317422574 , 329.02336020585057 },
-  { 578.0017149197222 , 227.77703137461668 },
-  { 604.0652880570779 , 543.9226853611352 },
-  { 647.2206647312938 , 313.2553156752689 },
-  { 558.2368855199934 , 377.90581557491805 },
-  { 687.9749629099737 , 229.6966215586535 },
-  { 483.9380520428489 , 461.3615234391137 },
-  { 729.2972364960701 , 309.92379714426477 },
-  { 494.67782478552147 , 532.4255996863261 },
-  { 496.0961141496693 , 522.935603959669 },
-  { 676.4778772351644 , 339.0840848302099 },
-  { 498.3361141208222 , 513.6053325948235 },
-  { 514.7360501087228 , 357.49086697667684 },
-  { 495.42944747501866 , 526.7164585513602 },
-  { 688.3225163557343 , 614.6228945505577 },
-  { 661.3659736129662 , 336.41944849175036 },
-  { 616.1625837570683 , 697.6334012792604 },
-  { 647.5872210392648 , 222.3005332727537 },
-  { 541.4914907950381 , 282.93796290895716 },
-  { 534.3049289530541 , 396.7399658769197 },
-  { 669.4867938879629 , 601.4339796909983 },
-  { 615.4292572368109 , 117.11657316437946 },
-  { 672.2815463239475 , 284.4260692339735 },
-  { 531.1720289381545 , 187.81678235380195 }
-},
-{ //#6
-  { 306.38414387856045 , 369.34461988968883 },
-  { 204.4031917147595 , 328.1416406798727 },
-  { 270.5968261112533 , 415.98356042997443 },
-  { 306.4060674199959 , 311.98597229980555 },
-  { 359.7302775508905 , 408.18539388806767 },
-  { 207.54771026755054 , 360.20241473513613 },
-  { 240.19050948206666 , 281.5027001395871 },
-  { 404.385951474039 , 319.4102048233361 },
-  { 427.44688322195964 , 321.51209109886435 },
-  { 411.36745474171056 , 311.0699881495143 },
-  { 379.230440786629 , 222.65373394641898 },
-  { 528.6932120531935 , 364.48860792139953 },
-  { 169.49030029264418 , 365.7599284382435 },
-  { 220.95211934868274 , 251.03226351610715 },
-  { 418.8539495255379 , 358.7321760942382 },
-  { 334.4934774147217 , 122.17286906030931 },
-  { 141.33215232962127 , 233.2862577042565 },
-  { 449.8288109022367 , 345.09772165381605 },
-  { 61.9038456879329 , 388.6281353112888 },
-  { 322.1984481799166 , 208.05574669357182 },
-  { 200.77361871157908 , 384.1872112500143 },
-  { 394.11158305825626 , 465.9031395199662 },
-  { 217.13397041236544 , 250.63095989202503 },
-  { 507.7427428342811 , 281.7914092589458 },
-  { 131.02035826303768 , 268.0982910584549 }
-},
-{ //#7
-  { 324.69354841014876 , 592.5461574559455 },
-  { 279.95658503824154 , 492.06529256983583 },
-  { 252.53361581148283 , 509.53565072724285 },
-  { 297.16281184801653 , 383.42945198777664 },
-  { 353.7799446427167 , 552.512167549778 },
-  { 292.2743171899692 , 461.326324944449 },
-  { 307.2961620338572 , 652.1969610459391 },
-  { 392.4169460102669 , 328.4344519877766 },
-  { 160.28824004316562 , 569.4404981885457 },
-  { 404.41156777241054 , 703.8341382367593 },
-  { 314.3690386577915 , 492.06529256983583 },
-  { 361.4350509498753 , 602.5878094055254 },
-  { 290.35472700593243 , 351.35307695419755 },
-  { 51.368655162280305 , 554.132848813948 },
-  { 249.27201925446607 , 504.7899982888965 },
-  { 237.77493357965687 , 395.40253501734014 },
-  { 220.19308750446845 , 661.6858739568629 },
-  { 148.536027681314 , 545.3448920359856 },
-  { 262.67642833559825 , 395.61984706986755 },
-  { 290.7348417604528 , 518.330581106869 },
-  { 330.1517325309403 , 415.6460699964417 },
-  { 264.59601851963504 , 505.593095060119 },
-  { 411.9028682611611 , 618.2081818346386 },
-  { 234.08580390109594 , 612.6104125110943 },
-  { 397.52569043166045 , 326.6107104869158 }
-},
-{ //#8
-  { 226.78015967770594 , 121.63391658157398 },
-  { 297.4803688671284 , 37.376688282917584 },
-  { 219.70569400442002 , 115.15136314562595 },
-  { 406.3999537480137 , 22.06903890831994 },
-  { 215.7418695128698 , 110.97436367632841 },
-  { 406.1162094491876 , 20.170461473142563 },
-  { 407.0518237102395 , 46.962948427732506 },
-  { 259.1225847749075 , 12.466852035198698 },
-  { 169.2580869040102 , 11.289570180167317 },
-  { 87.51958754975163 , 84.88724557357814 },
-  { 118.46115492389319 , 102.5343535199883 },
-  { 513.7746506433364 , 20.353959130725038 },
-  { 46.30122232522727 , 185.54486024869095 },
-  { 205.7930782762397 , 13.664742674165439 },
-  { 142.70540604198817 , 103.76327602551167 },
-  { 366.29354820063554 , 37.20921850248041 },
-  { 454.3326518845182 , 119.02881862558795 },
-  { 179.76496331806882 , 144.79209303488096 },
-  { 342.1330915036102 , 84.62678463386457 },
-  { 50.744549252824044 , 189.20765630919163 },
-  { 262.9367568403935 , 74.82801406687074 },
-  { 170.1787031732539 , 35.22063819176988 },
-  { 481.41295337128787 , 102.51063254941249 },
-  { 69.84196625423849 , 148.63068867718903 },
-  { 301.4441933586786 , 41.553687752215154 }
-},
-{ //#9
-  { 207.01098245513163 , 533.3534386095785 },
-  { 314.5974370598429 , 556.2216454826238 },
-  { 204.67443999601255 , 552.3830498403157 },
-  { 193.60657337399948 , 642.5235898286074 },
-  { 138.48080559951876 , 640.2249695904175 },
-  { 120.41721169735615 , 481.68284065089324 },
-  { 189.76797773169133 , 532.6005927647772 },
-  { 216.47478024704483 , 750.1100444333188 },
-  { 79.92871520403575 , 526.8441609376158 },
-  { 150.62892439345822 , 611.1013892362722 },
-  { 98.35243921174909 , 587.5285898286074 },
-  { 28.557808535688423 , 644.0635652327255 },
-  { 130.99649594639263 , 819.3289942448904 },
-  { 238.16559909567985 , 593.7411869815579 },
-  { 163.28922060768775 , 748.2527637648632 },
-  { 201.2545506279702 , 423.51417608192287 },
-  { 188.03158707496945 , 855.4237271905912 },
-  { 111.39762989976725 , 494.0972299673055 },
-  { 316.5170272438797 , 666.1948934728753 },
-  { 23.41004134168135 , 796.4607873718451 },
-  { 17.910845570656534 , 662.5415894518817 },
-  { 270.875675212399 , 725.3845568918177 },
-  { 134.2869824719441 , 674.3809179990373 },
-  { 91.76617013621276 , 582.5350078311299 },
-  { 99.81551550846646 , 875.5809720110933 }
-},
-{ //#10
-  { 187.23244049612714 , 461.37368743807485 },
-  { 79.64598589141586 , 484.2418943111202 },
-  { 256.4513903076988 , 546.8519717387271 },
-  { 78.91343574231439 , 442.27412437648917 },
-  { 188.08358696134337 , 428.8697152953569 },
-  { 156.68811060502276 , 520.0487992391975 },
-  { 180.89438790611536 , 483.47710358630536 },
-  { 176.91524333779296 , 492.2085394428419 },
-  { 107.29671251270452 , 401.7386042320468 },
-  { 21.818428212052297 , 332.51965442047515 },
-  { 265.15161620477176 , 554.1773127757278 },
-  { 88.97150493395361 , 606.7221020284009 },
-  { 120.70112159383672 , 292.5684530130178 },
-  { 73.5584519775509 , 529.8273350072323 },
-  { 276.1485220683657 , 428.4821035863053 },
-  { 60.812929903845 , 501.42339772820793 },
-  { 173.0766476954849 , 602.1315365066723 },
-  { 168.78210381125356 , 522.4104791296741 },
-  { 76.97935974639282 , 296.0094302957911 },
-  { 21.81842821205231 , 470.9575540436184 },
-  { 89.53503388312144 , 419.1929572096785 },
-  { 110.80220742335275 , 267.869154520826 },
-  { 155.31235367711616 , 548.4208809485665 },
-  { 134.41060529725584 , 583.1618970824665 },
-  { 2.2982021447502348 , 539.0054963573317 }
-},
-{ //#11
-  { 98.93013647102818 , 462.5316168204592 },
-  { 205.65296340412502 , 489.14060611746663 },
-  { 123.91446404986644 , 562.7382815108774 },
-  { 213.32547795124134 , 379.41853622938856 },
-  { 140.13311568084433 , 360.5506646566582 },
-  { 206.10109989675618 , 437.78925035317747 },
-  { 72.27728685904631 , 465.62287577232405 },
-  { 206.10109989675615 , 327.79925035317746 },
-  { 16.32800944515516 , 585.6064883839227 },
-  { 244.13070381101315 , 324.7414233479155 },
-  { 165.01051917176494 , 248.3359491811304 },
-  { 269.97451581059823 , 473.6983676336139 },
-  { 307.60530935546666 , 436.0675740887454 },
-  { 230.84346636403788 , 544.9602137789054 },
-  { 221.25720621922295 , 435.3887589357943 },
-  { 111.26720621922296 , 435.3887589357943 },
-  { 240.4297265088528 , 654.5316686220165 },
-  { 145.88954750800573 , 470.3899271843138 },
-  { 164.79055570222397 , 505.85633143606776 },
-  { 352.44970856482587 , 305.6418602863297 },
-  { 70.59025391897185 , 466.5388599226153 },
-  { 226.99799898806305 , 574.9446964648478 },
-  { 167.75579412978635 , 635.0587471302516 },
-  { 259.8092605601009 , 279.7337427332275 },
-  { 230.2316490321905 , 297.4629924224066 }
-},
-{ //#12
-  { 243.6744208359635 , 269.37125151406354 },
-  { 330.3477236251668 , 201.65464584299434 },
-  { 136.0879662312522 , 246.50304464101822 },
-  { 122.68355715012005 , 355.67319586004726 },
-  { 51.983347960697586 , 439.93042415870366 },
-  { 175.95781516489436 , 356.04455430326686 },
-  { 236.56883111736187 , 291.2400080129255 },
-  { 127.39867989833287 , 304.6444170940577 },
-  { 330.3477236251668 , 311.64464584299435 },
-  { 180.96937702313025 , 448.95000595629256 },
-  { 312.9743052841469 , 212.1198233736772 },
-  { 342.29800505361754 , 260.9226552466137 },
-  { 252.36328933167948 , 435.1647389425151 },
-  { 353.79509072842677 , 370.3101185181701 },
-  { 251.11057961799958 , 330.8932277476825 },
-  { 268.2373419122397 , 312.60068825978686 },
-  { 419.21648691768155 , 183.65231660285096 },
-  { 196.27702639772784 , 340.0304210754072 },
-  { 356.12881468342994 , 93.55378325150478 },
-  { 246.15556669317846 , 91.634193067468 },
-  { 26.516511388141126 , 236.91678449620332 },
-  { 165.8686219279394 , 206.98277971426913 },
-  { 142.70632927293047 , 195.72483221317236 },
-  { 38.42632885146365 , 284.9729866706248 },
-  { 154.96972408784941 , 30.12856561472058 }
-},
-{ //#13
-  { 288.04081858183076 , 9.189147698530519 },
-  { 299.53790425664 , 118.57661097008689 },
-  { 406.2607311897368 , 91.96762167307942 },
-  { 368.7568540682116 , 204.0548952707391 },
-  { 380.286194350148 , 69.09399515983336 },
-  { 274.5570204138923 , 38.77664239352164 },
-  { 363.05381820510496 , 89.63074133962307 },
-  { 332.663055796326 , 10.229122318820856 },
-  { 454.23513836886383 , 273.2738450823107 },
-  { 277.6016832397208 , 108.51088593032092 },
-  { 344.01448760092995 , 311.2258586964671 },
-  { 434.7282379605631 , 198.20980330661405 },
-  { 355.53126266937136 , 117.81557692353212 },
-  { 234.6612482008474 , 60.16353738517361 },
-  { 238.1847924692332 , 211.19539704074813 },
-  { 445.9954397647309 , 352.4288379062833 },
-  { 301.27246470348473 , 121.09686368940193 },
-  { 408.9253675281964 , 130.0736966448961 },
-  { 454.23513836886383 , 163.28384508231068 },
-  { 169.95031418658837 , 72.76542160482211 },
-  { 180.86985515610274 , 33.9315141658122 },
-  { 264.34542006404234 , 179.32120437627958 },
-  { 440.9167866668775 , 121.0443885420364 },
-  { 448.47870654170237 , 163.4345825546551 },
-  { 326.02671221933497 , 145.00176264425434 }
-},
-{ //#14
-  { 135.37032849445632 , 479.910996695709 },
-  { 241.099502430712 , 510.22834946202073 },
-  { 137.10191430054317 , 546.0375907707635 },
-  { 40.11619433220591 , 534.905996695709 },
-  { 51.62362999989095 , 476.81864095919184 },
-  { 189.46232523989187 , 413.11294372346737 },
-  { 292.7366796215321 , 607.3437552005742 },
-  { 191.16508736435924 , 412.22654186654216 },
-  { 149.687649175317 , 525.319736550894 },
-  { 146.428123992452 , 311.7456769804325 },
-  { 25.798873651345232 , 489.49725684052396 },
-  { 122.91427938989861 , 541.1344340313441 },
-  { 2.9306667782999085 , 597.0837114452353 },
-  { 311.7997116201344 , 425.97112116336433 },
-  { 21.6679505586647 , 498.1579172088089 },
-  { 237.52956892541874 , 591.5133709473878 },
-  { 242.95678309916758 , 457.0427898226636 },
-  { 98.40201420521612 , 628.1828067919542 },
-  { 137.10191430054317 , 656.0275907707635 },
-  { 276.9087437394547 , 614.2259375921896 },
-  { 105.6151778887271 , 557.6668206747477 },
-  { 254.7357957351937 , 482.8775303653286 },
-  { 337.4736429934394 , 506.8628903144645 },
-  { 167.94378347589338 , 537.4843834637562 },
-  { 38.458950085043426 , 290.7585955789664 }
-},
-{ //#15
-  { 152.5985981360869 , 583.5562778059679 },
-  { 242.69713148743307 , 520.4686055717162 },
-  { 221.8175479476585 , 669.0345621066201 },
-  { 182.91595090239863 , 689.2854517422236 },
-  { 134.7279575800245 , 541.4556869731824 },
-  { 255.2831092465141 , 544.1393870354802 },
-  { 280.0254757137958 , 436.9684236097522 },
-  { 180.34068221763468 , 483.45220621861176 },
-  { 265.81896651828686 , 414.23325640704013 },
-  { 206.88789017869044 , 624.4661937018851 },
-  { 259.43634351204884 , 772.3913534668621 },
-  { 174.98052581636392 , 433.79530278251286 },
-  { 343.69357181070524 , 843.0915626562846 },
-  { 125.98960883907945 , 690.2791047390647 },
-  { 340.83196614156105 , 494.67485004813267 },
-  { 105.76157600479232 , 519.2735870831651 },
-  { 346.4689518518431 , 482.63375958273275 },
-  { 347.5284850148313 , 484.2345395741774 },
-  { 351.29725081893906 , 483.45220621861176 },
-  { 230.96883674122256 , 878.6335351003968 },
-  { 284.33827034780353 , 519.2614475273544 },
-  { 157.7742990065889 , 542.4311433645721 },
-  { 364.4532604655431 , 557.5437961166124 },
-  { 244.21623440505314 , 332.97083547958334 },
-  { 336.0210572635889 , 733.3694927682066 }
-},
-{ //#16
-  { 285.01091081288877 , 107.32027024322777 },
-  { 333.2273532482194 , 206.17862739567315 },
-  { 301.0693894457656 , 311.36258750404744 },
-  { 233.37373362206864 , 10.20486450467439 },
-  { 381.2103324011509 , 160.6444803741224 },
-  { 123.38373362206865 , 10.204864504674404 },
-  { 471.30886575249707 , 223.73215260837395 },
-  { 255.45267838551104 , 128.4039525329648 },
-  { 200.45767838551106 , 223.65808669521522 },
-  { 110.35914503416483 , 160.5704144609637 },
-  { 249.20166950414614 , 211.31785837339663 },
-  { 211.41323541947796 , 189.05876959748636 },
-  { 171.99017161468478 , 329.9002683287498 },
-  { 163.68335516505942 , 256.76983604922583 },
-  { 153.002247915884 , 157.99364824250205 },
-  { 227.49817931196372 , 236.49598016198493 },
-  { 246.2790580121292 , 99.70782836949175 },
-  { 323.69760090022584 , 289.82019029287954 },
-  { 176.37507023082958 , 124.52649705300277 },
-  { 335.89427202660363 , 53.390952909690625 },
-  { 163.19679298414732 , 287.91712674993175 },
-  { 339.1029075583243 , 40.522217270986125 },
-  { 519.5253081878277 , 124.87379545592857 },
-  { 365.45250445398136 , 32.307270619953584 },
-  { 108.72872430905075 , 228.47566036797394 }
-},
-{ //#17
-  { 303.56203392793896 , 247.92342191015305 },
-  { 267.75279261919627 , 143.9258337799842 },
-  { 278.81966746065723 , 140.75245848442506 },
-  { 214.42858248830169 , 47.72641219172206 },
-  { 234.34308411636735 , 333.4017062108053 },
-  { 334.02787761252847 , 379.88548881966483 },
-  { 244.7459352546134 , 153.45558612797777 },
-  { 202.31570509670507 , 290.8999387326883 },
-  { 153.90149047527478 , 258.3887065875311 },
-  { 439.21183772090274 , 347.72752501721106 },
-  { 105.7927419062425 , 64.93263900149707 },
-  { 170.18382687859804 , 157.95868529420005 },
-  { 92.34245710645361 , 288.98034854865153 },
-  { 364.29795176130943 , 209.97140829599667 },
-  { 205.3290444841258 , 50.77107501755056 },
-  { 96.40945960324049 , 35.463425642952956 },
-  { 352.5385349316994 , 415.4441306882802 },
-  { 9.593320317980371 , 118.2568491323917 },
-  { 394.4748743489955 , 247.2466601311014 },
-  { 171.46264174570183 , 212.57487438186638 },
-  { 524.6901220215549 , 278.50857520563943 },
-  { 474.137214288965 , 204.2149764688352 },
-  { 343.61413775734337 , 489.4569436627759 },
-  { 29.387267739457414 , 144.05282364074532 },
-  { 139.01676131835774 , 183.77293889428955 }
-},
-{ //#18
-  { 161.18124245931872 , 479.19067292756637 },
-  { 87.58356706590791 , 560.929172281825 },
-  { 93.33999889306932 , 670.7684348094806 },
-  { 132.32053043781522 , 460.44830739571535 },
-  { 85.83674782895571 , 560.1331008918764 },
-  { 190.2680781763351 , 521.5122815113374 },
-  { 149.06509896651895 , 623.4932336751383 },
-  { 201.76516385114425 , 412.124818239781 },
-  { 253.4266182276359 , 539.0955203888692 },
-  { 226.07731948507774 , 417.5146933811685 },
-  { 49.31002370911254 , 388.2883747970494 },
-  { 114.30425459978201 , 453.89091925834185 },
-  { 19.866961394838768 , 647.6024750710284 },
-  { 48.60303552116207 , 570.2875699233709 },
-  { 136.4449552712638 , 636.4812043198647 },
-  { 188.82989589714182 , 603.9056891043602 },
-  { 336.4371249563386 , 611.2554529875351 },
-  { 265.49421025556535 , 520.1992044915958 },
-  { 215.55058343101587 , 410.91440243580655 },
-  { 294.5590698333975 , 573.5883363380484 },
-  { 34.19957063813561 , 657.2485066304298 },
-  { 13.985891672497104 , 642.6676716360836 },
-  { 148.24265811926165 , 571.2534841913231 },
-  { 158.88147855222363 , 378.70211465223446 },
-  { 143.58735569998032 , 544.8519522160306 }
-},
-{ //#19
-  { 473.3504126211034 , 157.0652830869356 },
-  { 539.5440470175971 , 69.22336333683386 },
-  { 648.9315102891535 , 57.72627766202466 },
-  { 540.962336381745 , 36.7391962605585 },
-  { 755.1736919226881 , 29.25877089119841 },
-  { 470.2621271923225 , 120.99642455921489 },
-  { 441.79462042149623 , 227.2386061927495 },
-  { 574.2597153224914 , 156.80566586795754 },
-  { 549.7637943289049 , 248.22568759421566 },
-  { 567.1930109348949 , 131.32395305543548 },
-  { 576.7715776904877 , 140.73678439072734 },
-  { 484.3132985223881 , 131.01902766478383 },
-  { 506.7872775063696 , 146.97935876298175 },
-  { 552.4594220565542 , 146.12665953211487 },
-  { 528.3454126211034 , 252.31941724918602 },
-  { 497.9858195592098 , 137.9855250917924 },
-  { 505.477205748058 , 144.73296264447475 },
-  { 434.23950944864816 , 10.130206963551071 },
-  { 498.0927790883851 , 49.89431966120759 },
-  { 493.1303340653679 , 228.58287916392615 },
-  { 542.5991183953982 , 37.742217568538535 },
-  { 492.5545745952514 , 238.37203530043206 },
-  { 597.8298668906073 , 162.50017343307917 },
-  { 437.8295159135285 , 31.334234168622743 },
-  { 602.04141166862 , 201.97435876298175 }
-},
-{ //#20
-  { 98.59456301939353 , 459.8653857197273 },
-  { 70.12705624856729 , 353.6232040861927 },
-  { 23.581563396119336 , 540.3069793608199 },
-  { 192.87439442361884 , 403.21634786037043 },
-  { 189.78040562472256 , 521.3710131724748 },
-  { 146.5325304153523 , 274.5030194469444 },
-  { 94.87258682814027 , 453.1507629267232 },
-  { 292.5591879197799 , 356.73256525151083 },
-  { 256.45552747918265 , 278.34161508925246 },
-  { 98.59456301939355 , 459.8653857197273 },
-  { 62.7853217106509 , 563.8629738498962 },
-  { 107.52228508255817 , 664.3438387360059 },
-  { 171.70490659153623 , 579.1706232244939 },
-  { 206.9135677732063 , 440.7658226581416 },
-  { 119.78098498438146 , 593.6311894917145 },
-  { 118.3434986838979 , 452.48156123863805 },
-  { 127.92975882871279 , 342.91010639552695 },
-  { 36.74391622338376 , 404.4157338482744 },
-  { 158.98474329891303 , 617.1871839807908 },
-  { 72.37158185546579 , 454.2915190067851 },
-  { 215.10873968726946 , 687.2120456090512 },
-  { 140.7199333767125 , 352.92390290803985 },
-  { 232.58241869232384 , 698.9256833350494 },
-  { 166.14211307089298 , 601.4817694142865 },
-  { 14.245474986312871 , 606.0580188629957 }
-},
-{ //#21
-  { 247.4272345641169 , 298.52559415693884 },
-  { 159.58531481401513 , 364.71922855343263 },
-  { 208.01034379362926 , 195.84108304651164 },
-  { 77.84681545975656 , 438.31690394684347 },
-  { 277.2292936052009 , 110.36279874585942 },
-  { 98.2882739055512 , 188.16856849939535 },
-  { 221.0909422667625 , 273.53338594810356 },
-  { 299.1961863989583 , 134.33545559376415 },
-  { 307.5466463715126 , 216.0919726821151 },
-  { 7.146606270334075 , 354.05967564818707 },
-  { 307.5466463715126 , 216.0919726821151 },
-  { 98.0370958033778 , 197.76067323054843 },
-  { 408.91825628703634 , 126.66294104664787 },
-  { 301.7472928613083 , 101.92057457936616 },
-  { 357.2810790962162 , 223.77834678520128 },
-  { 124.89726320255866 , 294.8913954324922 },
-  { 417.5198943617641 , 218.01156286615193 },
-  { 156.4404423671134 , 362.51716515940404 },
-  { 459.9655902066434 , 184.36145601471367 },
-  { 204.27927743691242 , 226.22818000137468 },
-  { 165.34174664117654 , 254.87996602577704 },
-  { 217.49006456265192 , 31.22036538994371 },
-  { 199.57747246410406 , 237.0790540835813 },
-  { 94.934814914366 , 275.73544934213214 },
-  { 49.884263579284465 , 375.3329890735847 }
-},
-{ //#22
-  { 102.95866093172611 , 231.1226208971645 },
-  { 191.94244014302657 , 166.47212099751533 },
-  { 182.07884557097435 , 307.5280950639496 },
-  { 0.27414982129890575 , 191.7057301266769 },
-  { 84.3559855383153 , 189.34032787056069 },
-  { 103.63094118154098 , 154.08693456228661 },
-  { 207.25008951762416 , 57.55253611663001 },
-  { 82.64385978007473 , 46.11776065487807 },
-  { 93.94224568313018 , 79.7688730274496 },
-  { 189.53994564668955 , 221.4982916730145 },
-  { 83.85909787014046 , 339.44162565097724 },
-  { 118.83973645726707 , 137.24106337435813 },
-  { 91.98031221962817 , 370.6157672982012 },
-  { 110.96497483532276 , 296.06315480365754 },
-  { 22.85035808556787 , 280.5261704758897 },
-  { 16.639379867246163 , 102.66702508135732 },
-  { 314.83654412233545 , 80.42074298967535 },
-  { 182.92602489443067 , 144.41937292709872 },
-  { 301.8654372068569 , 170.31071663982343 },
-  { 9.685017384473781 , 9.068663838027149 },
-  { 199.1809260964297 , 209.727607410311 },
-  { 38.152524155300036 , 115.31084547156176 },
-  { 245.61759431076385 , 165.89902729032758 },
-  { 208.63950870827523 , 329.8172964268273 },
-  { 306.10844667006955 , 9.336093681299431 }
-},
-{ //#23
-  { 60.38869239326712 , 143.15386321194396 },
-  { 108.60513482859774 , 44.29550605949858 },
-  { 160.07348588942824 , 189.63764582080347 },
-  { 170.22795492092268 , 137.3974313847825 },
-  { 99.52774573150022 , 221.65465968343887 },
-  { 23.122271564715135 , 300.77484432268716 },
-  { 80.12942156957651 , 200.48510361903408 },
-  { 226.87699278027952 , 43.11759998055716 },
-  { 64.81935172717785 , 134.64264582080347 },
-  { 60.98075608486969 , 24.719648756973143 },
-  { 176.32884315783863 , 253.8093137499287 },
-  { 278.51416997109965 , 140.2330057191105 },
-  { 146.43539913918698 , 118.13059960383137 },
-  { 267.34336065947605 , 85.76025419396237 },
-  { 62.53916233520272 , 403.45935543311435 },
-  { 60.95711483853478 , 187.34954941540303 },
-  { 255.64596309805432 , 247.81946032382177 },
-  { 159.09918313140318 , 191.2916836801603 },
-  { 375.3125345668846 , 64.77317279249623 },
-  { 276.63304449952045 , 139.8502864164132 },
-  { 27.20055616278747 , 31.285854460561424 },
-  { 369.70001257642866 , 78.72737826636302 },
-  { 251.61935924756125 , 150.2885634062852 },
-  { 8.100993101201809 , 139.6048592143742 },
-  { 151.9345657514001 , 103.80478079742568 }
-},
-{ //#24
-  { 226.36927214658772 , 254.45371099608397 },
-  { 154.2093395479218 , 337.46421772478664 },
-  { 222.53067650427965 , 364.37670805991434 },
-  { 148.4529077207604 , 447.3034802524422 },
-  { 165.70642522273093 , 228.07675445323025 },
-  { 248.1377012169215 , 400.81969764358263 },
-  { 109.47237617601454 , 236.98335283867698 },
-  { 200.65821878134352 , 175.4777253859295 },
-  { 133.54846142027708 , 122.892794344856 },
-  { 139.52016977557696 , 436.5366406585802 },
-  { 143.35876541788508 , 326.6136435947499 },
-  { 23.826391532199025 , 130.56530889197236 },
-  { 314.33133561341526 , 488.66161739368437 },
-  { 67.70461762725236 , 278.011169519583 },
-  { 205.8465167387419 , 434.57962346334 },
-  { 252.37972801193428 , 295.7933601242994 },
-  { 48.104631255634686 , 271.61864359474987 },
-  { 325.82842128822443 , 379.274154122128 },
-  { 233.23325491643817 , 76.40901173599642 },
-  { 72.04283396752959 , 31.706951739527 },
-  { 33.27798814204233 , 408.069133887754 },
-  { 79.19633992464753 , 257.0226240836941 },
-  { 168.08345227357754 , 347.73052109232924 },
-  { 258.1118156171553 , 292.6008513329246 },
-  { 334.11822736619285 , 369.3910355177102 }
-},
-{ //#25
-  { 291.2171526456458 , 41.69952761615843 },
-  { 400.3873038646748 , 55.1039366972906 },
-  { 185.48797870939012 , 11.38217484984671 },
-  { 503.071814975102 , 94.52082746777818 },
-  { 209.47865329138722 , 115.29720300956924 },
-  { 422.63022133400943 , 169.5338270910524 },
-  { 285.9688435954998 , 56.11913822175397 },
-  { 508.8282468022634 , 204.36008999543375 },
-  { 394.15223009421663 , 109.8284768423758 },
-  { 386.98289478354263 , 164.27408791631962 },
-  { 259.41306835774 , 17.29539541409065 },
-  { 345.8736910568026 , 148.36451399007115 },
-  { 103.74947935513156 , 145.61455577588103 },
-  { 405.4714554420213 , 166.74129443104346 },
-  { 460.34586449071037 , 21.986557092274055 },
-  { 189.97082381441192 , 84.67604443869368 },
-  { 455.4451458999137 , 138.77825384525622 },
-  { 393.1398070212278 , 31.376771754472223 },
-  { 130.35846865213904 , 252.33738270897788 },
-  { 1.064968244704346 , 106.19766500539345 },
-  { 366.06603308648505 , 78.63559495163094 },
-  { 618.667509329919 , 210.11652182259513 },
-  { 232.8040790607325 , 124.01822234718749 },
-  { 157.8128600119581 , 189.86000454706794 },
-  { 293.45501352506665 , 77.86055436333176 }
-},
-{ //#26
-  { 496.4797646446287 , 27.48269836556223 },
-  { 597.7260934758626 , 70.45921518809745 },
-  { 517.4668460460948 , 135.45187227297077 },
-  { 519.3479715176741 , 135.06915297027348 },
-  { 707.6993414661141 , 72.37880537213425 },
-  { 474.4903292235596 , 236.69820110420468 },
-  { 450.1290217061025 , 49.59086866962123 },
-  { 666.496362256298 , 174.35975753593522 },
-  { 522.7067716588903 , 137.8398439517593 },
-  { 340.4069518180244 , 57.263383216737594 },
-  { 617.9477109322045 , 180.18883564487803 },
-  { 509.0281260513192 , 164.8811862702804 },
-  { 571.2422280940476 , 119.36475753593521 },
-  { 302.78815625363416 , 160.62017457697965 },
-  { 562.3244883402093 , 236.31548180150736 },
-  { 376.38583164704494 , 242.35867393123823 },
-  { 631.3426122409494 , 120.63361714198427 },
-  { 508.7423142645622 , 135.10971508774657 },
-  { 625.6202254793208 , 70.46676575679996 },
-  { 641.9424372834701 , 203.6219858345916 },
-  { 480.4463744724142 , 155.32004260587692 },
-  { 450.1290217061025 , 64.93589776385393 },
-  { 627.0383008892059 , 145.0381324177857 },
-  { 521.8543407808315 , 112.88016861533194 },
-  { 544.6962070799593 , 126.34105551800761 }
-},
-{ //#27
-  { 306.65304459739906 , 169.7233898789748 },
-  { 380.25071999080984 , 87.98489052471619 },
-  { 400.9328760016244 , 226.37242773833168 },
-  { 324.5274018348393 , 305.4926123775799 },
-  { 214.5541538445878 , 303.5730221935431 },
-  { 344.2718401617894 , 273.08018123921687 },
-  { 383.7266491918494 , 117.73658715627249 },
-  { 414.97204935121187 , 357.33740953787327 },
-  { 272.839973717598 , 210.29621209729783 },
-  { 289.2768401617893 , 177.8260470769665 },
-  { 455.9278760016244 , 131.11829357608127 },
-  { 136.77947898187944 , 225.79834733083476 },
-  { 153.04852639184037 , 394.7588647988722 },
-  { 229.3719927004865 , 270.0714228452837 },
-  { 228.32798024657714 , 252.16840224668533 },
-  { 243.0216606154141 , 197.33084056000854 },
-  { 245.94963020090842 , 239.20275641196693 },
-  { 283.7848377243537 , 62.13693527426355 },
-  { 80.88859379317442 , 311.74835807016956 },
-  { 140.33714950498688 , 236.7477313304961 },
-  { 193.71978907834978 , 286.7016862640829 },
-  { 175.46583297054093 , 81.2364983358492 },
-  { 211.50216529908096 , 255.60072193967486 },
-  { 247.8692203849452 , 349.1760044022184 },
-  { 312.55596144006637 , 353.5074372598959 }
-},
-{ //#28
-  { 14.490001927233308 , 142.49425657519828 },
-  { 66.12717911805345 , 239.60966231375164 },
-  { 48.92095230827844 , 348.24550289581083 },
-  { 174.4461838718662 , 220.51009925216587 },
-  { 158.6430221963565 , 355.9180174429272 },
-  { 104.58853527857949 , 79.40658434094668 },
-  { 39.93803537893038 , 168.39036355224715 },
-  { 99.43318424859194 , 140.06850561107336 },
-  { 80.33362118700629 , 248.3875103648861 },
-  { 132.32081351454724 , 327.4515820638534 },
-  { 170.73388534535738 , 273.5984415250521 },
-  { 12.570411743196496 , 32.52100858494681 },
-  { 204.72266455665783 , 168.99173529774816 },
-  { 214.42779780623505 , 85.16301616810807 },
-  { 149.36759931494467 , 42.06669801559477 },
-  { 135.77481532331117 , 463.50447204763844 },
-  { 203.0210227039697 , 243.19435376519698 },
-  { 108.76983333145861 , 85.84521871584138 },
-  { 217.79909781519945 , 396.670531875425 },
-  { 29.64964869221039 , 9.439744549056272 },
-  { 242.16278954293537 , 133.83679646296255 },
-  { 122.45917583464187 , 121.50717517373214 },
-  { 163.2425848566068 , 291.24683950457177 },
-  { 106.0551228589955 , 88.5599291883045 },
-  { 15.956589507649326 , 151.64760142255608 }
-},
-{ //#29
-  { 189.93169276203494 , 550.0085294989583 },
-  { 161.46418599120867 , 656.2507111324929 },
-  { 295.11565287040924 , 517.8505656965045 },
-  { 54.29322256548065 , 680.9930775997747 },
-  { 396.3619817016431 , 560.8270825190398 },
-  { 185.39358298233117 , 525.5230802436209 },
-  { 68.18737589496337 , 597.9648912594828 },
-  { 291.17802159326885 , 528.669118716586 },
-  { 386.30149547573825 , 579.356193149252 },
-  { 386.30149547573825 , 689.346193149252 },
-  { 76.0061197107748 , 537.0201659184302 },
-  { 171.26025387302516 , 482.0251659184301 },
-  { 89.52175451876657 , 408.42749052501927 },
-  { 96.4098037710307 , 460.87258034397183 },
-  { 293.3627568897397 , 546.5101616450871 },
-  { 54.29322256548065 , 680.9930775997747 },
-  { 200.4073919011995 , 425.0633390352291 },
-  { 214.2367706955604 , 583.271494749664 },
-  { 496.29149547573826 , 689.346193149252 },
-  { 166.02032826022975 , 484.4131375972187 },
-  { 140.6390953021496 , 665.0099941039226 },
-  { 138.71950511811278 , 555.0367461136711 },
-  { 299.3191560335913 , 561.5056151737675 },
-  { 23.97586979916894 , 575.2639036635189 },
-  { 163.46337378450966 , 667.5886685186424 }
-},
-{ //#30
-  { 212.35135721067957 , 540.6019602149216 },
-  { 111.87049232456991 , 585.338923586829 },
-  { 30.131992970311316 , 511.7412481934182 },
-  { 125.67805442147623 , 608.3185658859908 },
-  { 216.47719855187384 , 551.3501443755284 },
-  { 106.10917557714497 , 569.0694669857479 },
-  { 221.86049232456992 , 585.338923586829 },
-  { 319.16170966230106 , 590.767035146016 },
-  { 228.36256553190344 , 647.7354566564784 },
-  { 321.92281205379066 , 550.1882203597365 },
-  { 220.6900509847871 , 757.4575265445565 },
-  { 3.5514875707571605 , 604.4384866484146 },
-  { 113.78169012426133 , 678.791536873826 },
-  { 280.7198328439745 , 652.1691725235374 },
-  { 147.09237559137628 , 839.196025898815 },
-  { 369.0961247286538 , 688.7688427414946 },
-  { 222.70127500514664 , 663.4838874992283 },
-  { 126.41021958056177 , 814.1065644039134 },
-  { 2.0312297969143316 , 591.0953554139903 },
-  { 67.13352895266266 , 484.8580587007193 },
-  { 297.18044558650894 , 443.0172569340085 },
-  { 290.3060929887894 , 761.7406273666485 },
-  { 160.71418001985947 , 637.717365953475 },
-  { 172.06750999727151 , 585.5147267775807 },
-  { 80.88166739194247 , 524.0090993248333 }
-},
-{//#31
-  { 587.5285873227333 , 531.8349449530747 },
-  { 692.1352935500372 , 497.8461657417742 },
-  { 656.7475371343049 , 446.3566606524225 },
-  { 478.1411240511769 , 543.3320306278839 },
-  { 666.6487719619815 , 608.2404191198598 },
-  { 511.1231131559482 , 610.9551295923229 },
-  { 766.318991977416 , 436.7704005076075 },
-  { 501.5368530111333 , 720.526584435434 },
-  { 581.7345375110307 , 365.91506701132994 },
-  { 466.386149784041 , 711.4359944784326 },
-  { 874.2881658848246 , 457.7574819090737 },
-  { 718.7442828470446 , 391.1233388086773 },
-  { 866.0037854735771 , 483.25418311646706 },
-  { 522.8780874230843 , 442.85116574177425 },
-  { 613.324561831087 , 704.4398407081219 },
-  { 935.7937933375721 , 548.9433245144028 },
-  { 698.6023863063468 , 350.09709771840414 },
-  { 383.8612926469516 , 599.9810684872408 },
-  { 587.0151373117855 , 651.3076346238623 },
-  { 579.342622764669 , 541.5855647357843 },
-  { 630.6296660972897 , 406.6603231364452 },
-  { 899.9925646848775 , 378.6474768891631 },
-  { 682.2154023971403 , 410.6520303832372 },
-  { 790.6051014133211 , 367.15039121435393 },
-  { 829.5516117040374 , 577.410831285229 }
-},
-{ //#32
-  { 420.27255034785384 , 395.6301189959982 },
-  { 408.77546467304467 , 286.2426557244418 },
-  { 529.4427015668829 , 382.22570991486594 },
-  { 467.9370741141354 , 291.03986730953693 },
-  { 441.60078181678114 , 316.03207551837215 },
-  { 298.78546467304466 , 286.2426557244418 },
-  { 395.900870411598 , 234.6054785336217 },
-  { 517.9456158920736 , 272.83824664330956 },
-  { 486.3377451886884 , 215.5512106322625 },
-  { 488.2397223570667 , 280.244757751065 },
-  { 393.0609350924431 , 157.2653907592523 },
-  { 382.4964613304659 , 125.43532731459268 },
-  { 247.14828748222456 , 383.35806146299524 },
-  { 396.8638184448739 , 416.5129404044818 },
-  { 482.49914954638024 , 105.62821356843217 },
-  { 496.6173844231464 , 220.04902132794803 },
-  { 467.9370741141354 , 291.03986730953693 },
-  { 476.7426366822575 , 170.8572944795086 },
-  { 491.78597140174736 , 358.4025883231077 },
-  { 312.57604308478255 , 339.56686585533646 },
-  { 224.73412333468082 , 405.76050025183025 },
-  { 286.98128553071274 , 219.29782915902408 },
-  { 437.76218617447296 , 206.10907845454184 },
-  { 446.8815396448613 , 288.9072920629013 },
-  { 461.47552955767 , 293.64916683219724 }
-},
-{ //#33
-  { 173.76812854680398 , 522.348134716525 },
-  { 275.0144573780379 , 565.3246515390603 },
-  { 165.09146031420755 , 561.4860558967522 },
-  { 372.12986311659125 , 616.9618287298804 },
-  { 318.80565298569667 , 713.1612503181425 },
-  { 209.23419814258557 , 722.7475104629575 },
-  { 208.06797713674274 , 460.23972706551825 },
-  { 166.3786167959787 , 548.1184247292853 },
-  { 382.60091198274915 , 588.1928584121056 },
-  { 272.3218703768372 , 812.8460438143036 },
-  { 305.93622872009746 , 529.1199089797786 },
-  { 369.43727611539055 , 864.4832210051237 },
-  { 238.3640593446041 , 638.1482506948682 },
-  { 184.49183167530387 , 829.9184738886855 },
-  { 226.81604408084922 , 452.71443481299355 },
-  { 122.11494349167234 , 460.2397270655183 },
-  { 293.009678477343 , 540.5563545630953 },
-  { 286.5115430528471 , 674.7121148106166 },
-  { 82.51087951150294 , 871.1214530985017 },
-  { 74.83836496438659 , 980.8435229865797 },
-  { 235.84318743959298 , 616.0246835298607 },
-  { 270.14147160429764 , 432.969899958384 },
-  { 130.56937548723607 , 652.1160128594541 },
-  { 357.6601783769921 , 629.5401337743957 },
-  { 238.4186284464531 , 611.3319139278254 }
-},
-{ //#34
-  { 169.8600557904362 , 129.09014475332123 },
-  { 93.45458162365108 , 49.96996011407302 },
-  { 199.6967632571857 , 21.50245334324677 },
-  { 251.33394044800582 , 118.61785908180013 },
-  { 264.3472631568348 , 110.48623255454724 },
-  { 281.65129321431755 , 224.3470330180558 },
-  { 186.68344054835669 , 29.634079870499676 },
-  { 361.0560103360839 , 126.29037362891647 },
-  { 239.83685477319662 , 228.00532235335652 },
-  { 248.98024042968441 , 52.684670586536086 },
-  { 296.4055104364347 , 37.30659441761602 },
-  { 283.7988462869101 , 81.2712570613198 },
-  { 295.603025429242 , 14.32643049590203 },
-  { 154.5080006291792 , 104.72980072738588 },
-  { 130.9172698923113 , 243.31297172795416 },
-  { 68.61372695920232 , 172.06666157585647 },
-  { 374.4604194172161 , 17.120222409887475 },
-  { 346.58807461025623 , 173.61285908180014 },
-  { 358.8118459101843 , 161.71285070241237 },
-  { 368.70398759005474 , 126.95948493754305 },
-  { 187.06628260021117 , 20.454304171262024 },
-  { 216.13082072150414 , 11.627875402101893 },
-  { 128.28890097140237 , 77.82150979859567 },
-  { 144.37353420238048 , 86.67344979783655 },
-  { 3.3560482723049034 , 113.0576323483246 }
-},
-{ //#35
-  { 340.07906145400875 , 508.24801579671765 },
-  { 240.3942679578476 , 461.76423318785817 },
-  { 311.0944771472701 , 546.0214614865146 },
-  { 448.9986463348941 , 523.5556651713152 },
-  { 403.1667336882603 , 418.14948244537146 },
-  { 312.5542005565135 , 544.7747399165609 },
-  { 449.46652472556514 , 496.7509301219085 },
-  { 424.2562798676124 , 630.7266285970433 },
-  { 436.062115644433 , 387.5807789028795 },
-  { 339.74445483748707 , 489.0784155747922 },
-  { 286.87805056670715 , 362.0794396916971 },
-  { 550.712853556799 , 453.7744132993732 },
-  { 322.87283464423376 , 616.8838563787768 },
-  { 537.3084444756669 , 562.9445645184022 },
-  { 338.94670990587963 , 439.2179560936997 },
-  { 205.13955121244857 , 435.6771150851079 },
-  { 247.83368568569156 , 448.3431683354148 },
-  { 261.7885890718054 , 341.3972836808826 },
-  { 476.7644090816711 , 336.4109830911128 },
-  { 306.5255524437127 , 441.87814856699225 },
-  { 573.1176857844094 , 458.94697638823334 },
-  { 237.30660263214108 , 527.3564328676445 },
-  { 442.06001361780966 , 467.04503658690146 },
-  { 138.1116157976135 , 440.6706537882985 },
-  { 320.3171093608438 , 599.5163654663104 }
-},
-{ //#36
-  { 217.73241508344623 , 576.3696297082862 },
-  { 251.72119429474668 , 471.76292348098224 },
-  { 289.33998985913695 , 368.40613212074015 },
-  { 298.92625000395185 , 477.97758696385125 },
-  { 108.01034519536817 , 584.0421442554026 },
-  { 92.70269582077059 , 692.9617291362879 },
-  { 154.64474284919464 , 486.27109635694 },
-  { 354.4057054051739 , 511.1798142514698 },
-  { 205.23741168588717 , 571.4477169771434 },
-  { 195.0721564353898 , 377.4830920767569 },
-  { 123.49891233162857 , 497.8500415837326 },
-  { 153.08191518379712 , 665.3534089195866 },
-  { 190.9570760965433 , 456.9905055623851 },
-  { 242.85620725027746 , 674.8045083373854 },
-  { 111.4902334499116 , 547.90212293746 },
-  { 176.76990491506092 , 465.20553534360874 },
-  { 149.57939715403216 , 616.5186884643753 },
-  { 123.02004858708233 , 798.6909030725436 },
-  { 79.65449917650757 , 516.8427125344289 },
-  { 265.7723656248122 , 293.2258637781005 },
-  { 106.26348847351504 , 623.5655394675257 },
-  { 181.3708159517284 , 347.419050719274 },
-  { 176.76990491506092 , 575.1955353436088 },
-  { 210.17221512083194 , 565.5666472548018 },
-  { 239.80911980729707 , 477.9639569628666 }
-},
-{ //#37
-  { 408.3443375767121 , 466.68643772125483 },
-  { 312.14491598845 , 520.0106478521494 },
-  { 395.1554227171527 , 447.8507152534835 },
-  { 287.18624880974414 , 468.83779665494967 },
-  { 365.36782075417693 , 567.9327665524887 },
-  { 429.33141897817825 , 358.7172638138463 },
-  { 444.1535788854548 , 570.6840258514237 },
-  { 255.98035748262055 , 579.4298522272979 },
-  { 550.8764058185517 , 597.2930151484312 },
-  { 511.7011289369542 , 504.30523328564516 },
-  { 502.92909437158903 , 276.97876445958764 },
-  { 297.1833366924367 , 477.448900063497 },
-  { 610.8982682789976 , 297.9658458610538 },
-  { 500.5897133450293 , 406.781590259952 },
-  { 327.43881704608356 , 361.1774124642801 },
-  { 469.8499650294595 , 375.50059511592576 },
-  { 533.9381252054822 , 392.70604302514676 },
-  { 559.9484983808057 , 438.5882673501773 },
-  { 375.6552594814142 , 460.0357696167255 },
-  { 398.8182187776533 , 587.7272535232186 },
-  { 194.4988255820095 , 438.03200929300937 },
-  { 400.94814220778807 , 235.77578524977147 },
-  { 557.6918847795612 , 309.30696071943197 },
-  { 507.20269472915754 , 418.46999528592426 },
-  { 619.1975122323086 , 218.1211181141029 }
-},
-{ //#38
-  { 22.592175162028937 , 29.557521780280837 },
-  { 39.79840197180394 , 138.19336236234005 },
-  { 130.56134906943748 , 50.544603181747 },
-  { 131.51176004291426 , 14.249872405683192 },
-  { 240.28341895751555 , 42.872088634630714 },
-  { 181.99759908450537 , 136.148898730876 },
-  { 132.51517222585926 , 33.396117422588915 },
-  { 350.25666694776703 , 44.79167881866753 },
-  { 201.26155825885996 , 134.8018314804034 },
-  { 136.92662759727347 , 5.253293070240417 },
-  { 414.90716684741614 , 133.775458029968 },
-  { 255.00253278551662 , 99.78667881866753 },
-  { 349.85487380062665 , 52.458348779445636 },
-  { 146.68352803170387 , 118.88624188025318 },
-  { 103.0337688031215 , 104.57052140355503 },
-  { 190.3520328858675 , 10.802899607367067 },
-  { 154.52166789940696 , 144.5236421905748 },
-  { 338.3577881258175 , 161.845812051002 },
-  { 454.25425507793585 , 8.982437509924772 },
-  { 116.20411066831667 , 123.16945728656852 },
-  { 172.71473925273042 , 116.23082456948414 },
-  { 521.9708607490049 , 95.65574029912813 },
-  { 264.7783826471148 , 114.01062863023918 },
-  { 448.2807851896478 , 165.6844076933101 },
-  { 152.60207771537014 , 254.49689018082626 }
-},
-{ //#39
-  { 276.6961676351501 , 154.61342742164865 },
-  { 307.0135204014619 , 48.884253485392975 },
-  { 204.3290092910347 , 9.467362714905384 },
-  { 287.9139573398762 , 157.20325823920572 },
-  { 316.1130584056376 , 51.9289163112214 },
-  { 339.7838398694017 , 244.71196077299487 },
-  { 379.1734530001278 , 131.89476021409567 },
-  { 241.94780485542503 , 112.82415407514745 },
-  { 198.93017812857573 , 92.55275833955662 },
-  { 350.2668096092378 , 131.9237171367331 },
-  { 120.07178099237834 , 80.16757190432787 },
-  { 253.8279607621047 , 47.02697281693739 },
-  { 435.0379740316521 , 299.7069607729949 },
-  { 458.293637639376 , 55.48928604731053 },
-  { 205.03256823766097 , 90.08723269520917 },
-  { 380.61119579487274 , 130.62275283965158 },
-  { 177.72001999402724 , 116.19018964800222 },
-  { 429.10786806648053 , 33.89295261861707 },
-  { 252.1047160311336 , 261.2008463693746 },
-  { 262.6148291640449 , 102.74417281115069 },
-  { 333.13364746075405 , 174.3297815278949 },
-  { 325.8678228126231 , 286.3025516918627 },
-  { 448.1028446232144 , 225.6123977114091 },
-  { 448.3278014659419 , 217.29605562885493 },
-  { 346.09736133777784 , 106.05288521728296 }
-},
-{ //#0 40
-  { 318.47771677784675 , 53.851167292794685 },
-  { 222.28408238135296 , 161.69308704289642 },
-  { 162.1855490300067 , 178.6054148086449 },
-  { 211.30675335211873 , 29.108800825512976 },
-  { 55.943367396472084 , 50.13790803781868 },
-  { 267.369509138381 , 110.76337861109872 },
-  { 68.4121318441995 , 151.85297488827325 },
-  { 464.6115534324616 , 98.52876475737867 },
-  { 502.23034899685194 , 201.88555611762072 },
-  { 396.50117506059627 , 171.568203351309 },
-  { 356.29254867864887 , 99.42920169579298 },
-  { 617.0479724262587 , 169.05920169804824 },
-  { 357.4680424897272 , 173.85105084535024 },
-  { 317.5489349856533 , 0.6412940546867283 },
-  { 417.97312069819554 , 251.18534692819827 },
-  { 544.7645780973279 , 82.38589890884492 },
-  { 149.22017749271737 , 108.42372791082889 },
-  { 615.3771148257715 , 93.88298458365415 },
-  { 436.73414231974147 , 4.4162020725188 },
-  { 283.4906683318936 , 199.40827075264309 },
-  { 548.868781731118 , 169.22897394680112 },
-  { 152.08838436576264 , 5.837273306117595 },
-  { 428.4007138416771 , 50.01257165048662 },
-  { 334.99554760784883 , 262.75404595663804 },
-  { 536.07262990370737 , 21.98194320649407 }
-},
-{ //#1 41
-  { 594.5259388110716 , 434.46853903728237 },
-  { 492.5449866472706 , 393.2655598274662 },
-  { 518.1204646442865 , 285.3483543980342 },
-  { 647.8501489419662 , 530.6679606255445 },
-  { 322.9365045359122 , 363.1903905955804 },
-  { 408.7330013727301 , 366.8454400728434 },
-  { 697.6525862536154 , 382.153089447441 },
-  { 649.1940245066274 , 298.98572842324086 },
-  { 695.6047731736489 , 470.7631131642417 },
-  { 470.0738398673792 , 222.58025425645576 },
-  { 453.9675959828288 , 567.8785189027951 },
-  { 757.0203001609951 , 517.2635515444123 },
-  { 617.5327961756544 , 636.3971345618003 },
-  { 508.1906386981626 , 178.18539059558043 },
-  { 600.8639914010834 , 374.16599676588044 },
-  { 339.3583639483359 , 282.9801541605514 },
-  { 533.7479658570868 , 595.24651199126714 },
-  { 429.81066650351363 , 315.9594550509472 },
-  { 577.8124740989922 , 266.02503998459446 },
-  { 511.896154426454 , 491.9923519750966 },
-  { 577.5243633576857 , 160.7898651739902 },
-  { 583.087780622077 , 510.47304473600997 },
-  { 739.8140733512201 , 625.8993921264714 },
-  { 664.7749243926779 , 597.1683990057151 },
-  { 409.176633516933 , 238.81881317481947 }
-},
-{ //#4 42
-  { 504.65235573388406 , 80.50055465242838 },
-  { 609.8363158422584 , 48.34259084997462 },
-  { 476.1848489630578 , 186.742736285963 },
-  { 268.4587213373903 , 168.34247440253012 },
-  { 732.4270305965924 , 158.27522951513674 },
-  { 717.3878281728739 , 84.76178412216204 },
-  { 426.25043389670503 , 284.7445438814416 },
-  { 536.1734309605354 , 318.58313952374965 },
-  { 500.2648609991473 , 7.92885099478959 },
-  { 518.4958096650222 , 224.83969642013878 },
-  { 670.1972206916489 , 94.74479900911932 },
-  { 561.4399491951262 , 266.2444034225453 },
-  { 643.1784485493848 , 192.64672802913452 },
-  { 405.7939985814387 , 128.71699708775898 },
-  { 347.27287873206126 , 106.83684694978268 },
-  { 313.2840995207608 , 2.230140722478751 },
-  { 741.4924983376554 , 17.82315140507767 },
-  { 641.258858365348 , 302.619976019386 },
-  { 396.9080696389052 , 20.310055430399295 },
-  { 240.6934061560362 , 67.51511113960457 },
-  { 163.09389757341927 , 82.67121746207128 },
-  { 344.1412107235823 , 251.55203961138204 },
-  { 573.8625363925581 , 139.66735034904818 },
-  { 354.88416484729356 , 171.5126992697734 },
-  { 633.5998817937922 , 349.254910151248 }
-},
-{ //#5 43
-  { 590.6608789759457 , 334.75253414210624 },
-  { 620.9782317422574 , 229.02336020585057 },
-  { 578.0017149197222 , 127.77703137461668 },
-  { 604.0652880570779 , 443.9226853611352 },
-  { 447.2206647312938 , 213.2553156752689 },
-  { 678.2368855199934 , 277.90581557491805 },
-  { 727.9749629099737 , 129.6966215586535 },
-  { 483.9380520428489 , 361.3615234391137 },
-  { 729.2972364960701 , 209.92379714426477 },
-  { 494.67782478552147 , 432.4255996863261 },
-  { 336.0961141496693 , 422.935603959669 },
-  { 676.4778772351644 , 339.0840848302099 },
-  { 698.3361141208222 , 413.6053325948235 },
-  { 514.7360501087228 , 257.49086697667684 },
-  { 415.42944747501866 , 426.7164585513602 },
-  { 688.3225163557343 , 514.6228945505577 },
-  { 761.3659736129662 , 296.41944849175036 },
-  { 616.1625837570683 , 597.6334012792604 },
-  { 647.5872210392648 , 122.3005332727537 },
-  { 541.4914907950381 , 182.93796290895716 },
-  { 534.3049289530541 , 296.7399658769197 },
-  { 579.4867938879629 , 501.4339796909983 },
-  { 615.4292572368109 , 17.11657316437946 },
-  { 792.2815463239475 , 184.4260692339735 },
-  { 531.1720289381545 , 87.81678235380195 }
-},
-{ //#6 44
-  { 306.38414387856045 , 369.34461988968883 },
-  { 54.4031917147595 , 328.1416406798727 },
-  { 270.5968261112533 , 415.98356042997443 },
-  { 306.4060674199959 , 311.98597229980555 },
-  { 359.7302775508905 , 408.18539388806767 },
-  { 207.54771026755054 , 460.20241473513613 },
-  { 240.19050948206666 , 281.5027001395871 },
-  { 404.385951474039 , 319.4102048233361 },
-  { 427.44688322195964 , 121.51209109886435 },
-  { 411.36745474171056 , 41.0699881495143 },
-  { 379.230440786629 , 222.65373394641898 },
-  { 528.6932120531935 , 364.48860792139953 },
-  { 169.49030029264418 , 365.7599284382435 },
-  { 220.95211934868274 , 175.03226351610715 },
-  { 418.8539495255379 , 358.7321760942382 },
-  { 334.4934774147217 , 122.17286906030931 },
-  { 141.33215232962127 , 233.2862577042565 },
-  { 459.8288109022367 , 155.09772165381605 },
-  { 61.9038456879329 , 388.6281353112888 },
-  { 322.1984481799166 , 208.05574669357182 },
-  { 200.77361871157908 , 384.1872112500143 },
-  { 394.11158305825626 , 465.9031395199662 },
-  { 247.13397041236544 , 110.63095989202503 },
-  { 507.7427428342811 , 281.7914092589458 },
-  { 131.02035826303768 , 268.0982910584549 }
-},
-{ //#14 45
-  { 135.37032849445632 , 479.910996695709 },
-  { 241.099502430712 , 510.22834946202073 },
-  { 137.10191430054317 , 546.0375907707635 },
-  { 40.11619433220591 , 534.905996695709 },
-  { 521.62362999989095 , 476.81864095919184 },
-  { 99.46232523989187 , 413.11294372346737 },
-  { 292.7366796215321 , 607.3437552005742 },
-  { 191.16508736435924 , 412.22654186654216 },
-  { 619.687649175317 , 525.319736550894 },
-  { 146.428123992452 , 311.7456769804325 },
-  { 25.798873651345232 , 489.49725684052396 },
-  { 542.91427938989861 , 541.1344340313441 },
-  { 2.9306667782999085 , 597.0837114452353 },
-  { 311.7997116201344 , 425.97112116336433 },
-  { 21.6679505586647 , 398.1579172088089 },
-  { 237.52956892541874 , 591.5133709473878 },
-  { 242.95678309916758 , 457.0427898226636 },
-  { 98.40201420521612 , 628.1828067919542 },
-  { 137.10191430054317 , 656.0275907707635 },
-  { 356.9087437394547 , 614.2259375921896 },
-  { 405.6151778887271 , 557.6668206747477 },
-  { 414.7357957351937 , 482.8775303653286 },
-  { 337.4736429934394 , 506.8628903144645 },
-  { 467.94378347589338 , 537.4843834637562 },
-  { 38.458950085043426 , 290.7585955789664 }
-},
-{ //#15 46
-  { 152.5985981360869 , 383.5562778059679 },
-  { 232.69713148743307 , 325.4686055717162 },
-  { 221.8175479476585 , 469.0345621066201 },
-  { 182.91595090239863 , 529.2854517422236 },
-  { 64.7279575800245 , 341.4556869731824 },
-  { 275.2831092465141 , 394.1393870354802 },
-  { 480.0254757137958 , 236.9684236097522 },
-  { 180.34068221763468 , 283.45220621861176 },
-  { 265.81896651828686 , 214.23325640704013 },
-  { 86.88789017869044 , 424.4661937018851 },
-  { 259.43634351204884 , 572.3913534668621 },
-  { 174.98052581636392 , 233.79530278251286 },
-  { 343.69357181070524 , 643.0915626562846 },
-  { 125.98960883907945 , 490.2791047390647 },
-  { 420.83196614156105 , 294.67485004813267 },
-  { 105.76157600479232 , 319.2735870831651 },
-  { 366.4689518518431 , 182.63375958273275 },
-  { 397.5284850148313 , 464.2345395741774 },
-  { 351.29725081893906 , 283.45220621861176 },
-  { 230.96883674122256 , 658.6335351003968 },
-  { 284.33827034780353 , 319.2614475273544 },
-  { 157.7742990065889 , 142.4311433645721 },
-  { 364.4532604655431 , 357.5437961166124 },
-  { 244.21623440505314 , 132.97083547958334 },
-  { 336.0210572635889 , 533.3694927682066 }
-},
-{ //#18 47
-  { 361.18124245931872 , 379.19067292756637 },
-  { 287.58356706590791 , 460.929172281825 },
-  { 293.33999889306932 , 570.7684348094806 },
-  { 212.32053043781522 , 360.44830739571535 },
-  { 285.83674782895571 , 206.1331008918764 },
-  { 190.2680781763351 , 421.5122815113374 },
-  { 349.06509896651895 , 623.4932336751383 },
-  { 401.76516385114425 , 212.124818239781 },
-  { 453.4266182276359 , 439.0955203888692 },
-  { 426.07731948507774 , 317.5146933811685 },
-  { 249.31002370911254 , 288.2883747970494 },
-  { 314.30425459978201 , 353.89091925834185 },
-  { 599.866961394838768 , 547.6024750710284 },
-  { 148.60303552116207 , 470.2875699233709 },
-  { 336.4449552712638 , 536.4812043198647 },
-  { 398.82989589714182 , 523.9056891043602 },
-  { 536.4371249563386 , 511.2554529875351 },
-  { 515.49421025556535 , 400.1992044915958 },
-  { 515.55058343101587 , 310.91440243580655 },
-  { 494.5590698333975 , 533.5883363380484 },
-  { 634.19957063813561 , 627.2485066304298 },
-  { 213.985891672497104 , 542.6676716360836 },
-  { 348.24265811926165 , 471.2534841913231 },
-  { 358.88147855222363 , 278.70211465223446 },
-  { 583.58735569998032 , 444.8519522160306 }
-},
-{ //#20 48
-  { 98.59456301939353 , 359.8653857197273 },
-  { 30.12705624856729 , 213.6232040861927 },
-  { 23.581563396119336 , 440.3069793608199 },
-  { 172.87439442361884 , 303.21634786037043 },
-  { 189.78040562472256 , 421.3710131724748 },
-  { 146.5325304153523 , 174.5030194469444 },
-  { 394.87258682814027 , 353.1507629267232 },
-  { 292.5591879197799 , 256.73256525151083 },
-  { 256.45552747918265 , 178.34161508925246 },
-  { 98.59456301939355 , 359.8653857197273 },
-  { 62.7853217106509 , 463.8629738498962 },
-  { 107.52228508255817 , 564.3438387360059 },
-  { 391.70490659153623 , 479.1706232244939 },
-  { 206.9135677732063 , 340.7658226581416 },
-  { 219.78098498438146 , 493.6311894917145 },
-  { 308.3434986838979 , 352.48156123863805 },
-  { 127.92975882871279 , 242.91010639552695 },
-  { 36.74391622338376 , 304.4157338482744 },
-  { 158.98474329891303 , 517.1871839807908 },
-  { 52.37158185546579 , 354.2915190067851 },
-  { 315.10873968726946 , 587.2120456090512 },
-  { 210.7199333767125 , 252.92390290803985 },
-  { 232.58241869232384 , 598.9256833350494 },
-  { 326.14211307089298 , 501.4817694142865 },
-  { 14.245474986312871 , 506.0580188629957 }
-},
-{ //#24 49
-  { 226.36927214658772 , 254.45371099608397 },
-  { 54.2093395479218 , 337.46421772478664 },
-  { 222.53067650427965 , 364.37670805991434 },
-  { 148.4529077207604 , 597.3034802524422 },
-  { 165.70642522273093 , 228.07675445323025 },
-  { 248.1377012169215 , 400.81969764358263 },
-  { 109.47237617601454 , 236.98335283867698 },
-  { 200.65821878134352 , 175.4777253859295 },
-  { 133.54846142027708 , 122.892794344856 },
-  { 139.52016977557696 , 436.5366406585802 },
-  { 143.35876541788508 , 326.6136435947499 },
-  { 23.826391532199025 , 130.56530889197236 },
-  { 314.33133561341526 , 488.66161739368437 },
-  { 67.70461762725236 , 178.011169519583 },
-  { 205.8465167387419 , 434.57962346334 },
-  { 425.37972801193428 , 295.7933601242994 },
-  { 48.104631255634686 , 271.61864359474987 },
-  { 453.82842128822443 , 379.274154122128 },
-  { 233.23325491643817 , 76.40901173599642 },
-  { 72.04283396752959 , 31.706951739527 },
-  { 33.27798814204233 , 408.069133887754 },
-  { 327.19633992464753 , 257.0226240836941 },
-  { 168.08345227357754 , 517.73052109232924 },
-  { 258.1118156171553 , 292.6008513329246 },
-  { 334.11822736619285 , 369.3910355177102 }
-},
-{ //#29 50
-  { 189.93169276203494 , 350.0085294989583 },
-  { 261.46418599120867 , 476.2507111324929 },
-  { 295.11565287040924 , 237.8505656965045 },
-  { 54.29322256548065 , 480.9930775997747 },
-  { 396.3619817016431 , 320.8270825190398 },
-  { 485.39358298233117 , 325.5230802436209 },
-  { 68.18737589496337 , 397.9648912594828 },
-  { 291.17802159326885 , 328.669118716586 },
-  { 386.30149547573825 , 399.356193149252 },
-  { 386.30149547573825 , 489.346193149252 },
-  { 76.0061197107748 , 337.0201659184302 },
-  { 171.26025387302516 , 282.0251659184301 },
-  { 89.52175451876657 , 208.42749052501927 },
-  { 96.4098037710307 , 260.87258034397183 },
-  { 293.3627568897397 , 146.5101616450871 },
-  { 54.29322256548065 , 480.9930775997747 },
-  { 200.4073919011995 , 225.0633390352291 },
-  { 234.2367706955604 , 413.271494749664 },
-  { 466.29149547573826 , 489.346193149252 },
-  { 166.02032826022975 , 144.4131375972187 },
-  { 140.6390953021496 , 465.0099941039226 },
-  { 138.71950511811278 , 355.0367461136711 },
-  { 299.3191560335913 , 391.5056151737675 },
-  { 23.97586979916894 , 375.2639036635189 },
-  { 163.46337378450966 , 547.5886685186424 }
-},
-{ //#35 51
-  { 340.07906145400875 , 508.24801579671765 },
-  { 50.3942679578476 , 461.76423318785817 },
-  { 81.0944771472701 , 546.0214614865146 },
-  { 448.9986463348941 , 523.5556651713152 },
-  { 583.1667336882603 , 358.14948244537146 },
-  { 152.5542005565135 , 544.7747399165609 },
-  { 679.46652472556514 , 496.7509301219085 },
-  { 424.2562798676124 , 630.7266285970433 },
-  { 436.062115644433 , 387.5807789028795 },
-  { 359.74445483748707 , 319.0784155747922 },
-  { 286.87805056670715 , 362.0794396916971 },
-  { 550.712853556799 , 453.7744132993732 },
-  { 322.87283464423376 , 616.8838563787768 },
-  { 537.3084444756669 , 562.9445645184022 },
-  { 338.94670990587963 , 429.2179560936997 },
-  { 185.13955121244857 , 405.6771150851079 },
-  { 247.83368568569156 , 448.3431683354148 },
-  { 231.7885890718054 , 301.3972836808826 },
-  { 476.7644090816711 , 336.4109830911128 },
-  { 306.5255524437127 , 241.87814856699225 },
-  { 599.1176857844094 , 438.94697638823334 },
-  { 237.30660263214108 , 527.3564328676445 },
-  { 442.06001361780966 , 467.04503658690146 },
-  { 138.1116157976135 , 440.6706537882985 },
-  { 220.3171093608438 , 599.5163654663104 }
-},
-{ //#36 52
-  { 217.73241508344623 , 476.3696297082862 },
-  { 251.72119429474668 , 371.76292348098224 },
-  { 289.33998985913695 , 268.40613212074015 },
-  { 318.92625000395185 , 347.97758696385125 },
-  { 108.01034519536817 , 484.0421442554026 },
-  { 92.70269582077059 , 592.9617291362879 },
-  { 15.64474284919464 , 386.27109635694 },
-  { 354.4057054051739 , 411.1798142514698 },
-  { 325.23741168588717 , 471.4477169771434 },
-  { 195.0721564353898 , 277.4830920767569 },
-  { 513.49891233162857 , 397.8500415837326 },
-  { 153.08191518379712 , 565.3534089195866 },
-  { 90.9570760965433 , 356.9905055623851 },
-  { 242.85620725027746 , 574.8045083373854 },
-  { 111.4902334499116 , 447.90212293746 },
-  { 176.76990491506092 , 365.20553534360874 },
-  { 449.57939715403216 , 516.5186884643753 },
-  { 123.02004858708233 , 668.6909030725436 },
-  { 79.65449917650757 , 416.8427125344289 },
-  { 265.7723656248122 , 193.2258637781005 },
-  { 10.26348847351504 , 523.5655394675257 },
-  { 181.3708159517284 , 247.419050719274 },
-  { 176.76990491506092 , 155.1955353436088 },
-  { 510.17221512083194 , 465.5666472548018 },
-  { 419.80911980729707 , 377.9639569628666 }
-},
-{ //#38 53
-  { 22.592175162028937 , 29.557521780280837 },
-  { 39.79840197180394 , 138.19336236234005 },
-  { 130.56134906943748 , 395.544603181747 },
-  { 131.51176004291426 , 14.249872405683192 },
-  { 240.28341895751555 , 42.872088634630714 },
-  { 551.99759908450537 , 136.148898730876 },
-  { 562.51517222585926 , 33.396117422588915 },
-  { 350.25666694776703 , 44.79167881866753 },
-  { 221.26155825885996 , 274.8018314804034 },
-  { 636.92662759727347 , 5.253293070240417 },
-  { 414.90716684741614 , 133.775458029968 },
-  { 255.00253278551662 , 199.78667881866753 },
-  { 349.85487380062665 , 252.458348779445636 },
-  { 146.68352803170387 , 328.88624188025318 },
-  { 43.0337688031215 , 314.57052140355503 },
-  { 190.3520328858675 , 10.802899607367067 },
-  { 154.52166789940696 , 184.5236421905748 },
-  { 338.3577881258175 , 161.845812051002 },
-  { 454.25425507793585 , 8.982437509924772 },
-  { 116.20411066831667 , 123.16945728656852 },
-  { 172.71473925273042 , 116.23082456948414 },
-  { 501.9708607490049 , 95.65574029912813 },
-  { 264.7783826471148 , 114.01062863023918 },
-  { 448.2807851896478 , 165.6844076933101 },
-  { 152.60207771537014 , 254.49689018082626 }
-},
-{ //#39 54
-  { 276.6961676351501 , 154.61342742164865 },
-  { 347.0135204014619 , 378.884253485392975 },
-  { 204.3290092910347 , 9.467362714905384 },
-  { 287.9139573398762 , 357.20325823920572 },
-  { 316.1130584056376 , 51.9289163112214 },
-  { 339.7838398694017 , 244.71196077299487 },
-  { 379.1734530001278 , 131.89476021409567 },
-  { 641.94780485542503 , 112.82415407514745 },
-  { 198.93017812857573 , 392.55275833955662 },
-  { 550.2668096092378 , 131.9237171367331 },
-  { 120.07178099237834 , 80.16757190432787 },
-  { 253.8279607621047 , 47.02697281693739 },
-  { 435.0379740316521 , 299.7069607729949 },
-  { 478.293637639376 , 95.48928604731053 },
-  { 155.03256823766097 , 290.08723269520917 },
-  { 80.61119579487274 , 130.62275283965158 },
-  { 177.72001999402724 , 116.19018964800222 },
-  { 429.10786806648053 , 33.89295261861707 },
-  { 252.1047160311336 , 261.2008463693746 },
-  { 162.6148291640449 , 192.74417281115069 },
-  { 333.13364746075405 , 174.3297815278949 },
-  { 325.8678228126231 , 286.3025516918627 },
-  { 518.1028446232144 , 225.6123977114091 },
-  { 448.3278014659419 , 217.29605562885493 },
-  { 346.09736133777784 , 10.05288521728296 }
-},
-{  //05/25/2014 #55
-  { 485.6101266596167 , 427.6707514640408 },
-  { 386.95179840330417 , 401.76205661627887 },
-  { 491.79791325718685 , 196.26730457033216 },
-  { 514.5492926468435 , 336.7478860074767 },
-  { 596.6440281110696 , 390.77255252438545 },
-  { 450.775052077098 , 492.91110913430384 },
-  { 605.7945095421462 , 286.18207117173307 },
-  { 668.9790688228798 , 202.3333289718678 },
-  { 298.3179951797013 , 359.1142534862232 },
-  { 771.674785423922 , 180.50468055291117 },
-  { 670.6218899008611 , 298.71181715766414 },
-  { 696.6464766022464 , 353.07620407861367 },
-  { 594.8200661836753 , 181.76721737701806 },
-  { 784.7129611684529 , 340.8829313129721 },
-  { 483.7777985077663 , 542.6447609785102 },
-  { 624.493629858229 , 498.0959529892887 },
-  { 545.8717607419935 , 486.2612994710469 },
-  { 382.91441005857445 , 459.49939988299735 },
-  { 758.0156384383429 , 257.96955252371197 },
-  { 646.4206409485603 , 441.3485061884676 },
-  { 533.6873919273905 , 246.71020789402678 },
-  { 317.81973781340344 , 429.07964718481924 },
-  { 679.8484623713568 , 129.60451852324826 },
-  { 399.1100748780097 , 342.03899244226545 },
-  { 451.49279768189 , 282.76033505492927 }
-},
-{ //#56
-  { 257.791128749602 , 300.3507531543281 },
-  { 274.21518323417587 , 404.0481520334116 },
-  { 154.09372987051853 , 283.9266986697543 },
-  { 180.44609585863503 , 339.68069939706476 },
-  { 467.79713384888726 , 246.27690566952154 },
-  { 259.6234569014524 , 105.32476266879763 },
-  { 179.4931096895276 , 182.0553503680374 },
-  { 375.62773573626515 , 431.22156357872524 },
-  { 435.84752578876146 , 517.2243367086264 },
-  { 189.27648899475014 , 465.7597256715984 },
-  { 301.38859477948955 , 302.6355995313223 },
-  { 92.63268443077845 , 506.7825868516873 },
-  { 216.60022117314588 , 560.4939753083773 },
-  { 292.5133587710426 , 527.790695151849 },
-  { 384.33968182360775 , 578.690857181512 },
-  { 116.46867884775746 , 381.94330764769546 },
-  { 447.2307435592268 , 354.43673844572845 },
-  { 384.09187493601786 , 206.72246193342568 },
-  { 190.36644103431058 , 395.8635927526781 },
-  { 360.5463223580165 , 334.26392865602435 },
-  { 408.7301732304587 , 123.98921291225597 },
-  { 321.68951848790493 , 182.69887584764967 },
-  { 235.96248033064543 , 197.65503655328587 },
-  { 168.15617006833344 , 579.7147691661775 },
-  { 531.18534997909 , 350.245150206699 }
-},
-{ //#57
-  { 424.96487280724494 , 310.4289561000269 },
-  { 378.96209967734376 , 391.64874615252324 },
-  { 646.00275441989754 , 292.9390832171295 },
-  { 483.55258102999613 , 460.7992275835999 },
-  { 379.9999812899963 , 232.7192931646332 },
-  { 585.851694131798 , 384.4168387791623 },
-  { 566.2858300511658 , 296.16092928915896 },
-  { 485.8588239681043 , 228.67465814816921 },
-  { 199.85605083820303 , 238.8944482006656 },
-  { 578.559491742363 , 179.38483877127854 },
-  { 298.5350935942823 , 419.135017293513 },
-  { 689.8199386689755 , 369.80505490936497 },
-  { 539.9326714529109 , 138.68066324745445 },
-  { 388.5137910771373 , 158.00460439090585 },
-  { 280.14855764416814 , 265.1629874040589 },
-  { 489.52292212689986 , 333.6007010769041 },
-  { 344.5596802956675 , 324.77063037256346 },
-  { 211.49864230549724 , 344.8036667971469 },
-  { 438.061323151194 , 113.28128342844536 },
-  { 144.85483774152556 , 385.8265279772358 },
-  { 573.0566317676916 , 488.62425923998467 },
-  { 525.262968871077 , 392.80473385313064 },
-  { 644.6318395986855 , 97.79228427791118 },
-  { 445.695443363365 , 415.0566273194959 },
-  { 280.14855764416814 , 370.15298740405893 }
-},
-{ //#58
-  { 791.6810002037096 , 375.0756607747688 },
-  { 762.7418342164829 , 475.9985262313329 },
-  { 666.8286966185862 , 433.2952460748047 },
-  { 371.2435504133011 , 422.3208027163338 },
-  { 820.6201661909363 , 274.1527953182047 },
-  { 782.9951151681752 , 176.13618634026352 },
-  { 714.4993479174818 , 543.12768370335885 },
-  { 682.0722497116111 , 147.1970203530368 },
-  { 714.0618981270735 , 334.2687797877437 },
-  { 530.0132558993197 , 517.1439882746699 },
-  { 659.7612335377032 , 595.1667635015416 },
-  { 641.5299113644522 , 491.7717975127899 },
-  { 871.6162637222814 , 440.3591631416732 },
-  { 622.4580053184301 , 338.14199151382684 },
-  { 785.3995099471448 , 554.954006755924 },
-  { 468.3016822611329 , 432.2052940352442 },
-  { 559.064723433544 , 363.32565658153084 },
-  { 878.7216549462634 , 316.36599783937504 },
-  { 558.7939071596345 , 443.0680344425617 },
-  { 710.0629328536851 , 251.65967197781853 },
-  { 712.3406821341712 , 395.4035718749067 },
-  { 825.3173978981077 , 512.3147976170485 },
-  { 445.4826913700767 , 348.08166175955813 },
-  { 700.4608157077191 , 616.6655803941107 },
-  { 649.4235998326327 , 251.53553076657397 }
-},
-{ //#59
-  { 206.44622191094163 , 409.3386812848619 },
-  { 145.52221476761343 , 481.8336812848619 },
-  { 314.46899713781323 , 359.08665892324535 },
-  { 418.1663960168967 , 375.5107134078192 },
-  { 237.3485378201786 , 532.7338433145248 },
-  { 514.0795336147934 , 418.21399356434745 },
-  { 371.65064942404086 , 271.0346359946553 },
-  { 503.10509025632246 , 522.6288473590624 },
-  { 275.7761681536782 , 331.9936483938949 },
-  { 47.50560578967223 , 444.20863026210077 },
-  { 130.23885481084193 , 379.57033196765985 },
-  { 38.17718187664644 , 521.1636275275985 },
-  { 52.71513016350798 , 352.0266848184783 },
-  { 371.6506494240409 , 447.1386818518354 },
-  { 100.20171106851237 , 594.6110665906599 },
-  { 476.0655032187559 , 260.06019263618435 },
-  { 263.53882374555462 , 444.20863026210077 },
-  { 194.87715310528282 , 296.8370829464901 },
-  { 216.7058015242393 , 194.14136634544786 },
-  { 338.96072743441175 , 475.8423905937602 },
-  { 136.22920480523652 , 543.9819752413708 },
-  { 579.4604692075076 , 241.82887046293325 },
-  { 276.497394863063 , 235.4053272948113 },
-  { 398.4234377917978 , 319.06942545360687 },
-  { 42.29301622075041 , 623.2693948469724 }
-},
-{ //60
-  { 382.6179511909264 , 369.06329010753905 },
-  { 465.35120021209616 , 133.7015884019799 },
-  { 438.01733100993556 , 230.9346384092559 },
-  { 373.4674697598498 , 264.47280875488667 },
-  { 186.11424138450735 , 364.82195094826653 },
-  { 438.60924138450736 , 455.74595809159473 },
-  { 312.1041934120389 , 513.6379185657842 },
-  { 479.9629840818934 , 329.73334386480246 },
-  { 262.81437403514826 , 420.9372507915254 },
-  { 364.28559296555085 , 467.5176675493088 },
-  { 435.8886007885126 , 544.3024926823055 },
-  { 209.5513433287719 , 484.8413997277045 },
-  { 269.7700708807663 , 280.8968632394605 },
-  { 230.51163891867157 , 579.7102664221067 },
-  { 308.3788102341508 , 373.30243106431465 },
-  { 283.1650274248122 , 614.5607840223482 },
-  { 235.1168692280107 , 335.2280959107491 },
-  { 136.78263862037454 , 512.2616709205464 },
-  { 490.8484910212863 , 277.4982187698709 },
-  { 595.7782062951577 , 511.18785954296965 },
-  { 516.632016611379 , 385.4939357299782 },
-  { 285.4154468312597 , 207.29115646865898 },
-  { 356.6516419609237 , 613.1821301360188 },
-  { 524.9251704039757 , 488.66626913046116 },
-  { 500.3208150226941 , 590.6846523310205 }
-},
-{ //#61
-  { 693.6584169588641 , 197.7731554365479 },
-  { 796.3541335599064 , 175.9445070175913 },
-  { 619.4192760020885 , 272.01229639332354 },
-  { 413.6208845387366 , 240.58280531203218 },
-  { 837.3769947399952 , 272.588311581563 },
-  { 774.0097573547408 , 261.16277782440017 },
-  { 642.0178767157748 , 163.7979801790355 },
-  { 709.3134788173525 , 117.2348440821976 },
-  { 559.6454712401219 , 334.9471922329817 },
-  { 517.1201629002867 , 248.39468519776116 },
-  { 787.3769947399952 , 67.598311581563 },
-  { 464.4673639634698 , 132.72959612814427 },
-  { 763.1378537832196 , 346.82745253833866 },
-  { 883.4015814413805 , 73.23392466061345 },
-  { 557.7077023639017 , 187.0736021538978 },
-  { 505.1973687112975 , 88.54819559168737 },
-  { 708.4356085006473 , 57.34137999794154 },
-  { 631.6507833676505 , 65.73837217497984 },
-  { 720.8318285041778 , 299.18570793863717 },
-  { 761.6742199223959 , 397.7095527989369 },
-  { 839.9226789162163 , 418.4304603613004 },
-  { 548.9175343464808 , 130.37667046942073 },
-  { 893.861181000569 , 248.7190835849744 },
-  { 870.1720571041017 , 168.3808911207406 },
-  { 653.345557363188 , 379.61271402169865 }
-},
-{ //#62
-  { 559.4453009150401 , 357.56790136831916 },
-  { 618.5451388853772 , 149.3942244208843 },
-  { 457.6449768557143 , 357.56790136831916 },
-  { 403.9546575327248 , 358.544705851961 },
-  { 421.50448414282334 , 508.10388735627805 },
-  { 234.65076281156496 , 358.1422695234019 },
-  { 538.6190073487425 , 172.7540533931992 },
-  { 334.2483264830059 , 327.4461642445618 },
-  { 539.4122644904567 , 460.6289393584894 },
-  { 359.79291050463655 , 423.1651931168523 },
-  { 299.1085426788421 , 453.04995380601434 },
-  { 226.17636036435204 , 598.5734394435693 },
-  { 480.702601555063 , 547.6695941010432 },
-  { 321.10204781426427 , 538.7999926351182 },
-  { 644.2583793443393 , 455.1341873125427 },
-  { 476.26074163430656 , 441.41664356818444 },
-  { 123.48064376330979 , 550.4020878625258 },
-  { 663.1426997941236 , 373.991955852893 },
-  { 223.33206740913795 , 517.9583936231 },
-  { 635.9692882488099 , 272.5794033508037 },
-  { 128.17881284816008 , 473.58770232294404 },
-  { 479.4736252746707 , 254.8721847672769 },
-  { 254.81890099016704 , 424.9975212687027 },
-  { 542.7265394218341 , 548.6642196730566 },
-  { 560.4458026112549 , 255.5115856652938 }
-},
-{ //#63
-  { 559.700001431121 , 136.88969121659431 },
-  { 637.6744447895919 , 32.4748374218793 },
-  { 688.9057669628429 , 135.86980341063102 },
-  { 168.80309648787505 , 57.87421724088841 },
-  { 576.1691968355386 , 397.320952275762 },
-  { 499.8691973473798 , 191.5060269624752 },
-  { 552.3641973473798 , 302.43003410580343 },
-  { 143.4037166688659 , 159.74556554260528 },
-  { 422.7785097864898 , 152.23860416183794 },
-  { 347.2550241489348 , 79.3064218473478 },
-  { 463.32762773191666 , 338.0662576576476 },
-  { 483.4685290612799 , 88.03113289887133 },
-  { 370.4715343543758 , 235.2690511801603 },
-  { 543.2759469465472 , 33.19229233751082 },
-  { 642.4332504522907 , 201.52798951103517 },
-  { 563.3741344714322 , 241.5283727365844 },
-  { 417.3030410305314 , 432.43064457859714 },
-  { 656.5716178082022 , 295.2250964699099 },
-  { 236.7757366565885 , 112.01881410934163 },
-  { 331.1037663488001 , 142.49098112808136 },
-  { 634.1858058134799 , 99.69590125300088 },
-  { 252.10176958795694 , 34.93573054719179 },
-  { 709.6688081352541 , 66.99016595691765 },
-  { 642.4332504522907 , 201.52798951103517 },
-  { 433.25779727883605 , 19.086631794851435 }
-}
-};
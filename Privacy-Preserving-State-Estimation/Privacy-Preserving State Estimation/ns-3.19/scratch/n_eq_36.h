@@ -1,3431 +0,0 @@
-using namespace std;
-
-/*struct coordinates {
-	double X;
-	double Y;
-};
-
-template <typename T, int N> char (&array(T(&)[N]))[N];
-*/
-struct coordinates n_eq_36[90][36] = {
-{  //#0
-  { 319.22471111702737 , 376.549245143718 },
-  { 351.3826749194812 , 271.36528503534373 },
-  { 306.6457115475739 , 170.88442014923407 },
-  { 255.18325333121908 , 324.6894951662384 },
-  { 180.17025370794488 , 405.1310888073309 },
-  { 106.57257831453407 , 486.8695881615895 },
-  { 217.66193233627342 , 106.23392024958497 },
-  { 169.70496903056687 , 255.47054535466674 },
-  { 19.899275525330737 , 554.5861938326586 },
-  { 45.06695086178659 , 395.6837455562605 },
-  { 274.48774774512003 , 65.70046004085982 },
-  { 168.75857380886436 , 96.01781280717162 },
-  { 6.8877848183729355 , 440.38580555272995 },
-  { 113.12996645190755 , 468.8533123235562 },
-  { 125.50854450287918 , 320.6707459329863 },
-  { 381.65871117084805 , 90.44282650814154 },
-  { 264.14571494513297 , 205.9187137457461 },
-  { 96.30474969211585 , 633.7063784719069 },
-  { 279.4533643197306 , 314.8382986266314 },
-  { 252.71547575926957 , 183.31061275600084 },
-  { 275.00075544239894 , 124.48531957799787 },
-  { 138.7305421169879 , 592.0535482699638 },
-  { 62.875792347865925 , 453.3398650014247 },
-  { 120.38014041144041 , 599.3231572045659 },
-  { 95.91302540928851 , 475.8312979967534 },
-  { 49.429242800428995 , 575.5160914929145 },
-  { 205.26879793354843 , 151.17874434151207 },
-  { 385.1825382559863 , 345.1556513929431 },
-  { 216.29464820261214 , 479.1970736144732 },
-  { 253.48524036887903 , 52.32038718906669 },
-  { 186.01697623109848 , 189.135819477647 },
-  { 424.5994290264739 , 447.8401625033703 },
-  { 286.70425497057005 , 287.91731898330477 },
-  { 29.7559916914183 , 547.9722601574413 },
-  { 308.40615809694594 , 170.11895620410985 },
-  { 229.55029163046942 , 585.9187481234336 }
-},
-{ //#1
-  { 264.359521649183 , 523.9465939133772 },
-  { 359.6136558114334 , 468.95159391337717 },
-  { 469.5366528752637 , 472.79018955568523 },
-  { 154.38627365893154 , 522.0270037293404 },
-  { 245.57211626426056 , 460.52137627659295 },
-  { 354.74226748328954 , 447.1169671954607 },
-  { 53.905408772821886 , 566.7639671012478 },
-  { 261.10910059202837 , 548.6359930263479 },
-  { 246.63164942724873 , 581.9318511906432 },
-  { 354.74226748328954 , 557.1069671954607 },
-  { 385.0596202496013 , 341.387793259205 },
-  { 356.6216494272487 , 581.9318511906432 },
-  { 454.6234570227273 , 531.9974361242904 },
-  { 288.8601986613392 , 394.71200339009965 },
-  { 188.375052870232 , 417.4202975020365 },
-  { 356.35371931532677 , 589.6043657377595 },
-  { 288.8601986613392 , 284.72200339009964 },
-  { 494.0403477932149 , 634.6819472347177 },
-  { 246.63164942724873 , 691.9218511906432 },
-  { 300.56711626426056 , 555.7755104388433 },
-  { 331.05040056491276 , 391.3024264650213 },
-  { 463.94017392003803 , 612.4725726108048 },
-  { 380.5528736639633 , 537.4406894553343 },
-  { 109.64931028702429 , 622.5078686154501 },
-  { 277.19608230372125 , 575.0594850197247 },
-  { 318.93302617454685 , 343.1193790652918 },
-  { 489.18871424602247 , 520.2344626455593 },
-  { 347.0697529361732 , 666.8290370835388 },
-  { 567.2969652802801 , 574.8537770464145 },
-  { 277.69890939121524 , 663.3619650435546 },
-  { 309.71932166150026 , 782.0203845419894 },
-  { 282.95251413088266 , 684.8987475473803 },
-  { 270.1135522244906 , 491.0179728954473 },
-  { 335.81591029205606 , 637.921554341444 },
-  { 350.79375769713204 , 656.7979843739832 },
-  { 377.218846047557 , 249.8425689690465 }
-},
-{ //#2
-  { 486.7567544294248 , 370.05881602380447 },
-  { 398.91483467932306 , 303.8651816273107 },
-  { 552.9503888259186 , 457.9007357739062 },
-  { 652.6351823220797 , 504.38451838276575 },
-  { 445.7794254001906 , 433.1583693066245 },
-  { 596.5960169570803 , 375.8152478509659 },
-  { 703.7669803828084 , 351.07288138368415 },
-  { 658.1343489342929 , 425.74277197145244 },
-  { 790.4402831720116 , 283.35627571261494 },
-  { 706.1674718001914 , 385.4015079957808 },
-  { 898.4094570794202 , 304.34335711408113 },
-  { 798.7246635832591 , 257.85957450522164 },
-  { 448.3436825986147 , 491.8895149852067 },
-  { 778.3274043988573 , 468.41201472448347 },
-  { 861.1404923614341 , 199.09904741395854 },
-  { 652.6351823220797 , 411.4169531650466 },
-  { 798.7246635832591 , 367.84957450522165 },
-  { 745.9762686843947 , 491.93640636794623 },
-  { 813.7402283730598 , 349.15329119964724 },
-  { 473.35234534829266 , 479.2289672428335 },
-  { 710.8827438331574 , 324.05320890171544 },
-  { 451.535857227352 , 323.3191067789689 },
-  { 749.750588060633 , 452.7473411919456 },
-  { 887.7494816584415 , 92.37622048086169 },
-  { 712.5400297833825 , 412.13914261444853 },
-  { 730.6510249990474 , 561.0663459457584 },
-  { 596.5960169570803 , 364.302384196643 },
-  { 853.9454425918032 , 512.9234877694124 },
-  { 755.9919736823217 , 542.003313947156 },
-  { 622.0284810285498 , 424.670556777095 },
-  { 826.2495244807543 , 387.35386384278377 },
-  { 944.1509990901368 , 271.2589800126244 },
-  { 728.2477168852757 , 337.41944877643107 },
-  { 625.8670766708578 , 534.5935538409253 },
-  { 619.4642238301255 , 268.22879324625455 },
-  { 457.27651107499975 , 323.7709060350681 }
-},
-{  //#3
-  { 261.982281964596 , 385.98313332717686 },
-  { 357.2364161268464 , 440.97813332717686 },
-  { 346.2395102632524 , 456.6833425165993 },
-  { 172.99850275329553 , 450.63363322682596 },
-  { 354.22765773291314 , 326.078285865874 },
-  { 154.81131853886797 , 410.7254997944585 },
-  { 190.20472956307052 , 559.2694738088852 },
-  { 131.79552354347933 , 348.65268106302506 },
-  { 227.99350275329553 , 490.5898395544808 },
-  { 126.01255058949458 , 449.3868603446647 },
-  { 325.0784523243925 , 335.7941732188026 },
-  { 257.2557310519519 , 521.3338424162484 },
-  { 418.3552624206378 , 394.0799930918128 },
-  { 356.11408820439726 , 569.550284851579 },
-  { 463.61512100446953 , 337.57537154068325 },
-  { 326.91906336053466 , 335.2489593909212 },
-  { 332.4940496595647 , 548.1490967529048 },
-  { 77.79610815416393 , 350.5285031922193 },
-  { 435.1476142336433 , 231.33318990714864 },
-  { 357.23641612684634 , 230.61021311042833 },
-  { 366.827185895063 , 530.9201025610633 },
-  { 344.64139758809824 , 435.6497407089851 },
-  { 180.67101730041188 , 560.355703114904 },
-  { 271.7581318261942 , 371.75918351560523 },
-  { 237.47043416237022 , 410.9073742417034 },
-  { 435.01109098955476 , 363.2034584644685 },
-  { 461.33177924317306 , 495.3263219230467 },
-  { 92.0237713781941 , 344.7801541173608 },
-  { 346.5551431857968 , 216.35621597779596 },
-  { 427.7629634348197 , 375.21106398929015 },
-  { 232.9033502145983 , 358.38825745850875 },
-  { 35.37473351883721 , 250.50032271313546 },
-  { 111.4520674888403 , 474.87741881425177 },
-  { 385.8443767979144 , 537.6306928727861 },
-  { 265.6122983176858 , 593.9466309147228 },
-  { 535.7321373422283 , 396.19814539075634 }
-},
-{ //#4
-  { 551.8786320433525 , 71.62793083489218 },
-  { 646.1584634475778 , 14.978892975535295 },
-  { 648.0780536316146 , 124.9521409657868 },
-  { 540.4292895113222 , 45.29624574184709 },
-  { 544.2061174962362 , 181.35000072297024 },
-  { 652.8419580782954 , 164.14377391319522 },
-  { 735.9199733817163 , 191.14577536228057 },
-  { 637.3569163440047 , 140.84688064646377 },
-  { 472.04618489757024 , 98.33949399426758 },
-  { 553.7982222273893 , 68.30310310642994 },
-  { 537.5226228655185 , 32.1851197853103 },
-  { 580.3614479605454 , 211.62544375499016 },
-  { 681.9677047563205 , 118.97648110570412 },
-  { 692.3519163440047 , 236.10101480871418 },
-  { 705.7563254251369 , 345.27116602774316 },
-  { 732.0813777394081 , 81.22277829845025 },
-  { 721.6757290250254 , 43.213641611528175 },
-  { 631.5728970900976 , 146.0777779691383 },
-  { 620.1506895342297 , 249.48272122852296 },
-  { 531.1147347104701 , 112.37937387563755 },
-  { 372.3613914014091 , 51.85571138540807 },
-  { 724.8558884867225 , 236.95216127393041 },
-  { 668.2033677106472 , 277.81907815148395 },
-  { 756.1987494385374 , 126.52497834880492 },
-  { 525.1065544346505 , 289.669005476783 },
-  { 632.0332896899677 , 20.974673510225557 },
-  { 575.4582542581553 , 99.23612127419167 },
-  { 570.5276622372203 , 112.1605161155546 },
-  { 661.2660953149089 , 60.130845160082984 },
-  { 612.933726628382 , 129.2936782640383 },
-  { 641.3448724034862 , 54.756310641638834 },
-  { 275.24598566285573 , 103.49288857622824 },
-  { 535.8934612355733 , 320.18293041794544 },
-  { 443.7252526101265 , 136.613037351063 },
-  { 621.9866369452827 , 255.6492328122494 },
-  { 611.1294987007446 , 129.5534740405035 }
-},
-{ //#5
-  { 300.0420549060299 , 101.02603663102398 },
-  { 197.35754379560268 , 140.44292740151155 },
-  { 402.02300706983084 , 142.22901584084013 },
-  { 385.5203392066821 , 31.807086819452323 },
-  { 273.7630179623877 , 61.322742762263246 },
-  { 211.05827569472942 , 165.6765365306731 },
-  { 345.37396921047394 , 47.94918443661483 },
-  { 306.74500706715907 , 128.94584172670235 },
-  { 106.17170119027364 , 78.93729994876412 },
-  { 98.49918664315729 , 92.22648496618098 },
-  { 392.2874306743471 , 41.12118916972117 },
-  { 388.6185979886987 , 251.39916705986914 },
-  { 263.5511781920964 , 52.6010076514098 },
-  { 201.18369775358448 , 52.8095941956934 },
-  { 382.99276477486427 , 151.3059757968569 },
-  { 278.6285979886987 , 251.39916705986914 },
-  { 203.06280877296524 , 145.57997106091963 },
-  { 494.4399240875674 , 47.11473619404992 },
-  { 248.99472098642275 , 43.32752166295816 },
-  { 384.8684692444563 , 56.70099633886489 },
-  { 386.6990078046619 , 361.3724150501206 },
-  { 135.85191634285525 , 231.6287700068406 },
-  { 284.80396229516543 , 147.325109793127 },
-  { 286.5582567380914 , 10.803836403409452 },
-  { 110.68424100639935 , 208.1595330725807 },
-  { 384.5169270237371 , 43.27614055174185 },
-  { 199.57404364143105 , 104.20347525942064 },
-  { 91.21044976333302 , 54.729184379730206 },
-  { 14.985858584944594 , 17.431672496016695 },
-  { 125.19761119693673 , 57.4324206728089 },
-  { 157.30899655856183 , 81.06851442223609 },
-  { 89.85197375335298 , 96.53096071230435 },
-  { 444.9995238923661 , 243.47534467207402 },
-  { 405.77122884228555 , 131.34338939733573 },
-  { 296.5365599953816 , 96.45758671910146 },
-  { 491.1106508779909 , 85.16850310969114 }
-},
-{ //#6
-  { 356.56384681168424 , 309.5740441143201 },
-  { 461.7478069200585 , 341.7320079167739 },
-  { 444.5415801102835 , 233.09616733471472 },
-  { 277.443662172436 , 385.9795182811052 },
-  { 438.3023461659428 , 235.9763687209093 },
-  { 171.20148053890136 , 357.51201151027897 },
-  { 501.164697690546 , 239.04749680634666 },
-  { 380.00930756579993 , 415.32968331018475 },
-  { 165.44504871173993 , 247.67274898262338 },
-  { 397.8079063303039 , 276.666292370737 },
-  { 97.60380514549053 , 275.7735121560204 },
-  { 413.5313644847279 , 242.87365076432854 },
-  { 426.80526049113365 , 126.58890544935292 },
-  { 430.161522205095 , 227.83554476006145 },
-  { 478.2494999713965 , 351.6792919940112 },
-  { 329.66650558388363 , 218.77014191113432 },
-  { 335.6219952293982 , 248.40381670931237 },
-  { 334.7023175826279 , 238.8525991618761 },
-  { 392.7712156707443 , 420.8982418055828 },
-  { 531.4119667184376 , 92.60012623805244 },
-  { 346.8727323936586 , 327.4059824931935 },
-  { 606.8938716268017 , 269.3648495726584 },
-  { 385.34233275327335 , 262.6118232775257 },
-  { 271.6146453483763 , 148.75406581052994 },
-  { 481.7549948820448 , 356.24774190593365 },
-  { 526.4522779857091 , 194.3518499493842 },
-  { 441.15256379788394 , 270.7569446338366 },
-  { 491.02536271914306 , 332.78096083087587 },
-  { 499.0542351615378 , 233.68977554820165 },
-  { 292.1673878156982 , 481.52331770667854 },
-  { 449.5572435040858 , 366.82287326368106 },
-  { 631.6362380940834 , 162.19388614693042 },
-  { 404.04929195199264 , 187.41031961552653 },
-  { 684.66854648951 , 347.13952443536675 },
-  { 585.1117862422868 , 318.6289463415434 },
-  { 265.48336777105635 , 153.37431486122387 }
-},
-{ //#7
-  { 78.95243259445577 , 489.87181219000325 },
-  { 17.446805141708346 , 581.0576547953323 },
-  { 27.315255403635675 , 586.9872179285567 },
-  { 25.628222463561187 , 393.6723906017411 },
-  { 8.421995653786176 , 502.3082311838003 },
-  { 33.30073701067752 , 283.950320713663 },
-  { 97.78815506222708 , 476.6828973304438 },
-  { 125.7658098955211 , 600.1572178569179 },
-  { 33.13765516257797 , 565.6666765417442 },
-  { 21.558823576474307 , 696.8264804562123 },
-  { 33.07168723079708 , 696.8264804562123 },
-  { 130.25306090113133 , 617.3038537325643 },
-  { 33.30073701067753 , 393.940320713663 },
-  { 93.50888980012942 , 499.14529817845494 },
-  { 181.8902380919514 , 520.188447994011 },
-  { 54.811638239691874 , 577.9292261616777 },
-  { 21.82640473491837 , 393.1380799647713 },
-  { 162.78081214710045 , 556.9421447602115 },
-  { 142.24183844982608 , 710.2308895373444 },
-  { 10.074674867784623 , 477.448361275568 },
-  { 62.48415278680823 , 687.6512960497557 },
-  { 142.85972505065604 , 573.3391910888605 },
-  { 78.47544259427525 , 487.4179113689966 },
-  { 123.98978023955561 , 596.4654534444267 },
-  { 130.2530609011313 , 617.3038537325643 },
-  { 103.67612981603654 , 447.3132311838002 },
-  { 205.75732896963564 , 455.69581592897765 },
-  { 44.56877290560628 , 806.2139437277687 },
-  { 75.11383695214772 , 599.7948092538336 },
-  { 172.22924269070108 , 548.1576320630135 },
-  { 17.72022793416615 , 586.903483392382 },
-  { 268.8450012038872 , 545.7943492803239 },
-  { 151.29159983870312 , 832.8229330247761 },
-  { 67.12643437387844 , 670.2733827690481 },
-  { 169.10738653767936 , 629.0704035592319 },
-  { 260.782619742579 , 507.0077296938587 }
-},
-{ //#8
-  { 314.88036518760947 , 574.7836735192714 },
-  { 210.88277705744065 , 610.592914828014 },
-  { 273.9704492916922 , 520.4943814766679 },
-  { 382.6062898737514 , 503.2881546668928 },
-  { 361.61920847228515 , 395.31898075948425 },
-  { 315.13542586342567 , 495.0037742556454 },
-  { 382.6062898737513 , 287.3498068520757 },
-  { 347.56812468510304 , 602.2328808309264 },
-  { 333.87529675299504 , 612.7397572449851 },
-  { 297.556079846644 , 678.3095204990832 },
-  { 222.3798627322498 , 501.20545155645766 },
-  { 239.59546534876972 , 669.388795104342 },
-  { 249.56631708962448 , 652.1672958972792 },
-  { 206.56136043379672 , 555.6841104576857 },
-  { 195.77087343524232 , 394.48262462336083 },
-  { 466.2259146995891 , 361.33020154818377 },
-  { 262.463672221815 , 561.8023404996306 },
-  { 260.14042586342566 , 590.2579084178958 },
-  { 443.7982938168254 , 616.5783528872931 },
-  { 208.50324867260557 , 687.3733141564492 },
-  { 424.05501074431095 , 479.69612488104775 },
-  { 223.95840445323321 , 760.0480198533418 },
-  { 259.99865829664003 , 397.8486601962156 },
-  { 217.1144862055515 , 753.3225201223574 },
-  { 254.44824504655713 , 420.0613472267659 },
-  { 104.1599501243438 , 583.9839255310067 },
-  { 317.95578997410223 , 414.3043754555923 },
-  { 358.14223345890423 , 540.323493351543 },
-  { 304.4067140173015 , 377.2763978135858 },
-  { 198.43978152856914 , 640.6329633903636 },
-  { 310.44635727508546 , 420.27764793819017 },
-  { 191.2804972166143 , 745.4441059935245 },
-  { 261.02682772035087 , 488.68631616072287 },
-  { 367.64763233018925 , 529.6443766971769 },
-  { 119.35169822592928 , 794.0367990646422 },
-  { 222.70848958617137 , 831.6555946290325 }
-},
-{ //#9
-  { 405.39206992605386 , 441.9807125256651 },
-  { 326.2718852868056 , 365.57523835888003 },
-  { 514.7795331976102 , 453.47779820047435 },
-  { 497.6374456943711 , 382.0758650643623 },
-  { 543.2470399684365 , 347.23561656693977 },
-  { 653.2370399684365 , 347.23561656693977 },
-  { 652.9691098565146 , 354.9081311140561 },
-  { 537.6477400706556 , 561.0642528051856 },
-  { 704.6062870473347 , 257.79272537550276 },
-  { 400.5220399558177 , 330.43868787354216 },
-  { 560.7237340881974 , 414.8129785753589 },
-  { 407.53891234302483 , 318.98819283011073 },
-  { 432.0010592230613 , 335.2578855925683 },
-  { 596.5880021090796 , 441.5154479711651 },
-  { 763.0763024960921 , 352.9920483941012 },
-  { 437.7574910502227 , 445.0971481202239 },
-  { 723.7058501089203 , 149.47372062169 },
-  { 738.4473941571669 , 424.12708092562775 },
-  { 845.1702210902637 , 397.51809162862025 },
-  { 497.6374456943711 , 382.0758650643623 },
-  { 484.323529939761 , 657.2636743934477 },
-  { 432.68000375827154 , 225.2547277651679 },
-  { 331.52019433695165 , 379.9948489644756 },
-  { 218.30271137939707 , 386.5623197603462 },
-  { 709.8860778277934 , 252.95578516271445 },
-  { 139.18252674014883 , 462.9677939271313 },
-  { 415.8989463401125 , 455.67354045777313 },
-  { 215.58800090693387 , 383.847609287883 },
-  { 480.9987022112987 , 466.78442140096024 },
-  { 125.02590128315177 , 328.276499887336 },
-  { 547.1449543217791 , 456.5942337950331 },
-  { 228.1634029767096 , 417.6136445288659 },
-  { 489.3946682410428 , 347.98174238167053 },
-  { 624.6187957252658 , 447.7213663733129 },
-  { 706.1594569521907 , 431.92918782635013 },
-  { 434.87698569719373 , 417.61364452886585 }
-},
-{ //#10
-  { 21.879823834422464 , 575.8148737804223 },
-  { 131.26728710597882 , 587.3119594552315 },
-  { 61.296714604909965 , 473.13036266999507 },
-  { 152.254368507445 , 695.28113336264 },
-  { 197.46092150247256 , 499.4700397051298 },
-  { 121.56461733058359 , 622.2986563892819 },
-  { 133.1868772900156 , 477.33871146498007 },
-  { 152.7239581305653 , 599.9509045912395 },
-  { 224.37271989534457 , 415.8330840122326 },
-  { 159.72221999569547 , 504.81686322353306 },
-  { 249.11508636262627 , 308.66212058650456 },
-  { 260.22354241485357 , 716.2682147641062 },
-  { 171.018784492988 , 480.8028772171114 },
-  { 296.319278654918 , 451.25359726979923 },
-  { 365.5382284664896 , 365.775312969147 },
-  { 77.94307697508424 , 491.11253786696943 },
-  { 226.52142126822918 , 532.3169594552315 },
-  { 64.91557947122669 , 528.0188249850565 },
-  { 117.72602168827554 , 732.2216534531121 },
-  { 18.207825970341517 , 584.6798608248915 },
-  { 262.8537173560624 , 326.3584221986594 },
-  { 205.0075637042885 , 585.4095834444154 },
-  { 257.56905455908105 , 344.7882315676809 },
-  { 367.40831708673664 , 339.03179974051943 },
-  { 126.83662777206804 , 485.833176846372 },
-  { 349.64348878581256 , 547.4530188580613 },
-  { 216.93516112341422 , 422.7455046121204 },
-  { 40.32428141069394 , 594.4693292272115 },
-  { 291.1719211678783 , 443.33318024393105 },
-  { 168.46767803063796 , 448.38799620271334 },
-  { 150.25672921018088 , 356.87856302183513 },
-  { 63.432329888276726 , 503.67108409015674 },
-  { 268.9485429167476 , 493.1249595746206 },
-  { 111.23112967126269 , 375.1285550745165 },
-  { 216.19738401871825 , 405.17877886631413 },
-  { 252.5280830472592 , 599.0901960488815 }
-},
-{ //#11
-  { 487.42320799100565 , 220.59999233262047 },
-  { 525.0420035553959 , 323.95678369286253 },
-  { 561.0208833844165 , 302.3384916868791 },
-  { 662.2672122156504 , 345.31500850941427 },
-  { 565.151806477097 , 293.67783131859414 },
-  { 589.4883901552428 , 196.0963100533445 },
-  { 668.990057291825 , 323.32557308834527 },
-  { 589.4883901552428 , 86.1063100533445 },
-  { 466.7410519801912 , 358.987529546236 },
-  { 688.3467473076881 , 244.31275248867513 },
-  { 630.2259636637702 , 291.79881989040877 },
-  { 523.9837820302356 , 320.26632666123504 },
-  { 422.00408860828395 , 459.46839443234563 },
-  { 613.0197368539953 , 183.16297930834958 },
-  { 637.3117390757628 , 210.66732458989145 },
-  { 664.6569140448154 , 86.04757356979619 },
-  { 445.9218189161477 , 400.3622578596476 },
-  { 454.7787017508819 , 330.80599845770536 },
-  { 554.733916980985 , 82.2089779274881 },
-  { 392.16907382875524 , 275.59499233262045 },
-  { 748.9141423434718 , 156.74778275921864 },
-  { 414.5963187586792 , 331.76341233604427 },
-  { 612.8839233054977 , 390.1504180893563 },
-  { 711.0215444494738 , 133.22856424199682 },
-  { 484.3044300468685 , 118.26427385579835 },
-  { 641.4072197701882 , 14.49237225641889 },
-  { 523.9488272672809 , 395.6587834823951 },
-  { 413.15615523022143 , 383.564166240029 },
-  { 456.7321093855064 , 132.14339299384085 },
-  { 634.6160702826887 , 212.3487488812451 },
-  { 500.82761707213785 , 329.7701435516495 },
-  { 453.2835728408131 , 236.00909836257867 },
-  { 727.410272427109 , 147.57965235563984 },
-  { 338.99358187958126 , 531.6283270310115 },
-  { 654.8116288513204 , 123.66252347544788 },
-  { 761.7723197833687 , 137.6847507606163 }
-},
-{ //#12
-  { 267.82715578296927 , 292.16552942977825 },
-  { 237.50980301665754 , 397.8947033660339 },
-  { 128.12233974510116 , 386.39761769122475 },
-  { 189.62796719784853 , 295.2117750858957 },
-  { 123.43433280135474 , 207.36985533579394 },
-  { 252.81745239125513 , 288.9751184851486 },
-  { 194.53163251824492 , 195.69830838890329 },
-  { 345.0628281595723 , 229.07027102384578 },
-  { 37.95604850070252 , 138.1509055242223 },
-  { 205.17283215561332 , 133.77217994238316 },
-  { 21.88015811156653 , 357.93011092039853 },
-  { 283.90779860207385 , 351.8608129452525 },
-  { 123.86111027536748 , 399.13309013021467 },
-  { 241.34839865896566 , 287.9717063022036 },
-  { 194.5316325182449 , 85.70830838890329 },
-  { 398.3870382904669 , 325.2696926121079 },
-  { 215.5187139197111 , 303.66748229631185 },
-  { 293.49405874688875 , 461.4322677883636 },
-  { 18.856485439116856 , 29.83190077040956 },
-  { 337.07468068991153 , 359.675327674571 },
-  { 253.38927459094396 , 232.63053709482853 },
-  { 502.9937445177708 , 359.2584718234084 },
-  { 377.7501528467996 , 296.0041250720863 },
-  { 159.31061443153683 , 189.48260114964 },
-  { 343.7519846501922 , 369.42719659520765 },
-  { 22.648399126104934 , 247.07049040510765 },
-  { 144.23299292041224 , 339.6088834930237 },
-  { 341.0331921551268 , 334.4554889110631 },
-  { 432.37581750176736 , 429.8763988394119 },
-  { 301.70259594397294 , 110.450674856185 },
-  { 191.42168161618417 , 371.28571406902654 },
-  { 308.60717391908526 , 465.91750930810565 },
-  { 362.5395222793332 , 296.64763303226493 },
-  { 414.45219383961467 , 285.16996829655125 },
-  { 71.94482771200299 , 242.75761175152624 },
-  { 194.9797690108761 , 137.05966415319244 }
-},
-{ //#13
-  { 379.1842197583593 , 405.3505996388179 },
-  { 352.57523046135185 , 512.0734265719148 },
-  { 415.6629026956034 , 602.1719599232609 },
-  { 394.49186913295694 , 514.2701845197032 },
-  { 405.9889548077661 , 404.8827212481468 },
-  { 247.96852423404792 , 478.08464736061427 },
-  { 442.27189199261085 , 315.25206628747173 },
-  { 432.6856318477959 , 424.82352113058283 },
-  { 465.1400988656562 , 422.838520892183 },
-  { 447.9932812223935 , 315.9039362496975 },
-  { 298.2924475446948 , 460.9459743888086 },
-  { 348.2268626110476 , 558.9477819842872 },
-  { 382.99478345814777 , 623.6576477912596 },
-  { 371.67479352293753 , 620.3924313257276 },
-  { 304.74262597653217 , 361.90620442561163 },
-  { 438.4070210775785 , 206.3324814065864 },
-  { 490.4883344279415 , 216.39370913502637 },
-  { 423.2754396507743 , 427.81619827325835 },
-  { 560.3942330279066 , 367.84352089218294 },
-  { 330.08801632376577 , 225.43204446817205 },
-  { 400.52766804534207 , 530.0074812389571 },
-  { 351.08604938728183 , 253.7464388347243 },
-  { 318.08639496617184 , 593.3903691589514 },
-  { 405.01676439985823 , 214.6576074184636 },
-  { 478.2489176203981 , 568.6626477912596 },
-  { 436.8108432568626 , 252.0410337651795 },
-  { 249.89071935092466 , 472.65653580142714 },
-  { 539.7545450731456 , 659.8484903965887 },
-  { 384.69850522456363 , 347.8255212689088 },
-  { 598.0403649461557 , 566.5716803003434 },
-  { 377.00258878916424 , 611.6391646137948 },
-  { 547.4558521009851 , 283.09410248501797 },
-  { 344.4833273550186 , 313.6968786428178 },
-  { 280.1264880365017 , 583.2686074689885 },
-  { 525.2823987213135 , 243.09213368880583 },
-  { 507.511052446285 , 167.7838054665231 }
-},
-{ //#14
-  { 71.46016292519732 , 374.78820797560115 },
-  { 167.65958451345946 , 321.46399784470657 },
-  { 181.03161776830842 , 384.37446812041605 },
-  { 71.46016292519732 , 268.139787713812 },
-  { 179.77916767901007 , 249.04022465222621 },
-  { 279.46396117517116 , 202.55644204336662 },
-  { 146.47316254847146 , 294.34661433450856 },
-  { 298.56352423675685 , 310.8754467971794 },
-  { 248.10117815455203 , 246.45099822143237 },
-  { 239.74997264471676 , 352.63243420751877 },
-  { 3.743557254128177 , 354.81309050301536 },
-  { 199.81754831591329 , 426.64795795308083 },
-  { 378.32231832761653 , 250.77288447869722 },
-  { 262.61817951776203 , 245.04597960280748 },
-  { 37.553577667586154 , 279.03896495991097 },
-  { 88.66638973497233 , 376.7756282958712 },
-  { 41.142810158885595 , 373.86896165006766 },
-  { 389.81940400242576 , 360.1603477502536 },
-  { 357.271329373581 , 259.8554073025645 },
-  { 116.67376230683439 , 355.44443912669607 },
-  { 217.3979632434004 , 352.39701601246827 },
-  { 151.90805289461503 , 286.438799811025 },
-  { 307.7867222233218 , 405.6608765516147 },
-  { 330.66234007657357 , 366.57823423566134 },
-  { 334.4031225005357 , 367.4418619072758 },
-  { 320.6669403849873 , 304.53739420716755 },
-  { 141.050595216452 , 428.1868247778034 },
-  { 405.7885298188004 , 355.72646148526195 },
-  { 324.20092454707844 , 102.07557715725696 },
-  { 173.63440030646154 , 180.39547970315837 },
-  { 139.6456210951611 , 285.0021859304623 },
-  { 72.39577718624923 , 401.58069493019104 },
-  { 159.58056744173135 , 176.7167299229469 },
-  { 271.1301511196546 , 447.4621403546676 },
-  { 112.56657729086035 , 359.4805586010035 },
-  { 276.89457341756344 , 300.67740184304637 }
-},
-{ //#15
-  { 381.4502190881082 , 195.8515184750986 },
-  { 340.247239878292 , 297.83247063889957 },
-  { 246.97042978204672 , 239.54665076588938 },
-  { 396.7578684627058 , 86.93193359421328 },
-  { 439.1055970307374 , 346.0489130742302 },
-  { 548.2757482497664 , 332.64450399309794 },
-  { 484.59978821280754 , 153.12556799070705 },
-  { 272.28006786907923 , 182.4471093939664 },
-  { 262.27807915664437 , 348.4662356467747 },
-  { 476.9272736656912 , 262.8476378787851 },
-  { 368.60826891187844 , 243.74807481719944 },
-  { 342.71967279773696 , 423.4792352700489 },
-  { 465.70744738676456 , 125.15130928567612 },
-  { 501.7919656409068 , 432.3292974892591 },
-  { 609.3784202456181 , 409.4610906162137 },
-  { 682.9760956390289 , 491.1995899704723 },
-  { 574.6983215641537 , 90.03789575645546 },
-  { 250.14870652694577 , 234.74479840464804 },
-  { 225.40634005966407 , 341.915761830376 },
-  { 619.8884234047774 , 581.2981233218185 },
-  { 395.06913870781 , 458.93828678626653 },
-  { 333.9216369223631 , 378.2068768766841 },
-  { 576.2532687059321 , 517.8085792674798 },
-  { 233.076276452564 , 322.57483710618123 },
-  { 452.8654972105348 , 173.04786562777696 },
-  { 416.8831825417384 , 239.7988707799104 },
-  { 310.6410009082038 , 268.2663775507367 },
-  { 241.96271510276753 , 76.71793545771071 },
-  { 450.39979801216697 , 234.07089416656146 },
-  { 592.1721934358432 , 518.0969311982728 },
-  { 263.5994881584887 , 347.0737611032638 },
-  { 711.0742660101065 , 642.803750774566 },
-  { 388.4156757709122 , 133.5566891463758 },
-  { 534.3654206223439 , 329.01949697512117 },
-  { 375.6089140354183 , 62.06363705142459 },
-  { 532.8162306481381 , 251.98392514315242 }
-},
-{ //#16
-  { 592.2892374228375 , 250.28515665936266 },
-  { 482.3662403590071 , 246.4465610170546 },
-  { 453.8987335881809 , 140.20437938351998 },
-  { 429.04203022811254 , 342.6459826053167 },
-  { 696.2868255530063 , 214.4759153506199 },
-  { 484.2160863544927 , 34.4752054472643 },
-  { 376.12405872547254 , 62.429704520811626 },
-  { 557.2555249484229 , 102.58558381912968 },
-  { 467.05859098440953 , 355.36614589793993 },
-  { 660.612316308665 , 64.96678825473938 },
-  { 410.61841096108185 , 116.2137048015229 },
-  { 561.3384223886349 , 412.01518375729677 },
-  { 660.4775842442637 , 318.47350348078874 },
-  { 571.3021560213713 , 142.3159827519541 },
-  { 518.3619055660996 , 310.7688549260629 },
-  { 371.2015201905943 , 218.8982159119501 },
-  { 781.7651098536585 , 145.25696553904825 },
-  { 534.0034175498273 , 343.56196675560795 },
-  { 806.2098226168366 , 218.314510992928 },
-  { 374.8132152160923 , 295.4612984366371 },
-  { 446.0715095829433 , 247.39697199053137 },
-  { 762.4804599495001 , 126.63399560051816 },
-  { 424.0820741618743 , 254.11981706670605 },
-  { 885.3300072560849 , 141.90903682614288 },
-  { 633.1991533187547 , 124.37738199927374 },
-  { 693.5355662540713 , 207.30863983682733 },
-  { 465.5729820851156 , 111.99862998564238 },
-  { 331.9266244895592 , 291.0088054144966 },
-  { 491.06189055192914 , 14.743664069027943 },
-  { 474.5583115508364 , 256.5170114763404 },
-  { 855.0126544897731 , 36.17986288988719 },
-  { 446.21451981386843 , 138.4566222708575 },
-  { 670.5085736076638 , 398.6107746761645 },
-  { 686.510975691408 , 200.25196553904823 },
-  { 815.7960827616515 , 327.8859658360391 },
-  { 758.6709082900738 , 117.24145881034552 }
-},
-{ //#17
-  { 537.2850394827071 , 542.9491779592183 },
-  { 523.880630401575 , 433.77902674018935 },
-  { 570.3644130104345 , 334.09423324402826 },
-  { 662.6097887787517 , 274.1893857827254 },
-  { 687.3521552460335 , 167.0184223569974 },
-  { 462.395239103026 , 355.08131464549444 },
-  { 707.346752150659 , 374.6702506688351 },
-  { 773.5403865471528 , 462.5121704189368 },
-  { 361.91437421691626 , 310.3443512735872 },
-  { 606.1736543191771 , 230.09664511385938 },
-  { 749.283091567955 , 206.47278011165622 },
-  { 428.36545460182185 , 558.256827333816 },
-  { 689.1841610478798 , 157.93671251519348 },
-  { 557.8694096128754 , 538.3857329674933 },
-  { 470.83395909780154 , 295.0367018989896 },
-  { 449.2335690308162 , 521.1795061577183 },
-  { 424.35017648894194 , 195.35190840282849 },
-  { 310.27719702609613 , 213.22894553503386 },
-  { 485.0428103395589 , 625.1770942878871 },
-  { 523.2085336413874 , 147.1354659674979 },
-  { 799.1574090381313 , 159.8563026992303 },
-  { 670.1459284362585 , 58.38258177493822 },
-  { 783.5515768342956 , 113.69421222610282 },
-  { 795.9069879809766 , 184.54570181220092 },
-  { 691.9093998508077 , 220.3549431209436 },
-  { 444.92488094561895 , 382.5042838722531 },
-  { 880.2632134802496 , 435.9031811219294 },
-  { 622.0668907938327 , 98.91902353216733 },
-  { 475.84255832782367 , 414.45667922462144 },
-  { 884.0324417204052 , 68.95724885419557 },
-  { 407.74628686355004 , 385.1352352503358 },
-  { 533.520327707971 , 181.94749932169626 },
-  { 471.9814992478409 , 464.65276948860554 },
-  { 414.3091755584639 , 443.3652868850043 },
-  { 546.9944988711151 , 545.0943631296981 },
-  { 993.9554387842356 , 72.79584449650365 }
-},
-{ //#18
-  { 353.4327064933044 , 369.1873176879695 },
-  { 267.9544221926522 , 299.96836787639785 },
-  { 330.5644996202591 , 476.77377229268075 },
-  { 431.04536450636874 , 521.510735664588 },
-  { 435.171205847563 , 442.7849930813803 },
-  { 543.8070464296222 , 425.5787662716053 },
-  { 377.3418854642086 , 288.4712822015887 },
-  { 180.11250244255046 , 366.16200227289164 },
-  { 319.4439272820039 , 264.5806114606655 },
-  { 109.412293253128 , 450.41923057154804 },
-  { 358.8854319077028 , 604.5212423932907 },
-  { 282.4799577409177 , 525.4010577540424 },
-  { 374.39632664701185 , 615.7905670688133 },
-  { 223.84167268716223 , 450.1647829956733 },
-  { 442.56071759838835 , 382.6022494490701 },
-  { 251.7144684819748 , 629.2636088605724 },
-  { 146.06699782445384 , 372.39010813296494 },
-  { 252.16260497460598 , 631.1302316902982 },
-  { 214.76335206984857 , 438.72775496483905 },
-  { 331.36057101020765 , 567.9945182734475 },
-  { 255.45446109601022 , 383.88719380777417 },
-  { 334.1171349317378 , 428.28565201548906 },
-  { 143.39546372816204 , 648.363171922158 },
-  { 212.0968043635552 , 489.8361213420356 },
-  { 202.85459128569607 , 558.1339569030819 },
-  { 390.43424247565576 , 543.26585796749 },
-  { 93.0153287580405 , 563.8903887302432 },
-  { 507.33113844622886 , 359.7744863526776 },
-  { 640.9224521681756 , 373.94158908078515 },
-  { 202.93832582187082 , 560.0517930879352 },
-  { 305.1773768354402 , 701.2688513694656 },
-  { 468.66416007075907 , 624.86752702483 },
-  { 188.6267962477232 , 539.1650755092262 },
-  { 168.61541676774127 , 475.549465544448 },
-  { 437.24673292551137 , 196.22590643327146 },
-  { 453.16526331192813 , 661.1702802526476 }
-},
-{ //#19
-  { 179.6248515015435 , 334.2473351068891 },
-  { 84.3707173392931 , 389.24233510688913 },
-  { 287.94385625535625 , 315.1477720453033 },
-  { 244.2753514011926 , 245.26355589558864 },
-  { 312.686222722638 , 207.9768086195753 },
-  { 417.87018283101224 , 175.81884481712154 },
-  { 196.05890896586197 , 344.121913048034 },
-  { 274.8789856637939 , 389.24233510688913 },
-  { 380.6081596000496 , 419.55968787320086 },
-  { 240.79587233776928 , 243.64104816192435 },
-  { 304.02808287327053 , 365.1089944495002 },
-  { 337.9112780763227 , 295.27822535274447 },
-  { 194.93250087614112 , 443.16691998777446 },
-  { 341.7498737186308 , 185.35522828891413 },
-  { 147.8424665305313 , 245.26355589558864 },
-  { 38.27101168742023 , 254.84981604040362 },
-  { 116.93872432661375 , 267.7164388812489 },
-  { 89.90818887824031 , 157.73441030185023 },
-  { 233.78069981122223 , 206.34230969038032 },
-  { 435.91308567180124 , 345.2126404190972 },
-  { 371.3864002221527 , 275.5036383132827 },
-  { 387.03858960197323 , 292.94906185083425 },
-  { 361.5415316487671 , 396.8862713995619 },
-  { 367.681222722638 , 112.72267445732491 },
-  { 391.30064761559834 , 277.52897648091306 },
-  { 178.6505487435184 , 445.89137296624597 },
-  { 61.50251046624777 , 496.8287897116004 },
-  { 43.424406269380796 , 257.4192037980114 },
-  { 248.84380131311514 , 419.72561940754133 },
-  { 150.18304197269214 , 552.1335545997806 },
-  { 347.0380539713039 , 272.1085549327506 },
-  { 193.02926058267568 , 443.4174863259181 },
-  { 132.55084309164553 , 198.20077818104673 },
-  { 284.2151031880047 , 504.92311377866554 },
-  { 418.41539665889366 , 177.6594558532635 },
-  { 253.53983333293422 , 514.5147590353903 }
-},
-{ //#20
-  { 255.06066023083503 , 392.3392202719095 },
-  { 364.230811449864 , 405.7436293530416 },
-  { 401.8496070142543 , 302.38683799279954 },
-  { 319.71116013048413 , 303.355441060609 },
-  { 439.2438110731382 , 486.18522299413416 },
-  { 425.9533417640188 , 274.8879342897827 },
-  { 548.1633959540235 , 501.49287236873175 },
-  { 587.580286724511 , 398.8083612583045 },
-  { 321.6307503145209 , 193.38219307035752 },
-  { 477.7410241968554 , 393.05192943114315 },
-  { 494.9472510066304 , 501.68777001320234 },
-  { 527.0857308232399 , 419.9915885976404 },
-  { 666.7004713637592 , 322.40288709151935 },
-  { 410.89700273581315 , 241.8498136078615 },
-  { 195.15581276953222 , 300.0938445035923 },
-  { 502.35881593080387 , 354.00811892903096 },
-  { 490.8333862255547 , 237.73633809315038 },
-  { 378.88266704441 , 344.8354869958126 },
-  { 431.352820202599 , 185.70967852324122 },
-  { 228.45167093382756 , 499.0620472050063 },
-  { 523.9551493594973 , 324.8223493561355 },
-  { 400.66741960240506 , 445.0387321538455 },
-  { 656.4824007078362 , 520.5924354303174 },
-  { 288.78413369306384 , 407.9231592300642 },
-  { 438.3241334263678 , 290.36741832071596 },
-  { 671.8375150231674 , 469.5085704477269 },
-  { 392.6983182206903 , 511.9858109865762 },
-  { 396.0931751870928 , 192.54757546514395 },
-  { 455.53036023614277 , 399.00325890277514 },
-  { 558.8871515963848 , 361.3844633383849 },
-  { 396.7533076004724 , 386.93607782859806 },
-  { 228.45167093382756 , 285.61639333881266 },
-  { 650.8504336217012 , 577.4777443551354 },
-  { 434.3721031648627 , 490.2928691888401 },
-  { 373.6736335267186 , 201.3836391094155 },
-  { 327.0949846115734 , 226.67149185445214 }
-},
-{ //#21
-  { 324.3533216723696 , 78.44077339127118 },
-  { 424.0381151685307 , 124.9245560001307 },
-  { 421.46872741092295 , 130.07795058209132 },
-  { 325.26930582266084 , 183.40216071298593 },
-  { 283.15034246255345 , 180.42172555507213 },
-  { 388.3569780569124 , 93.30362736163973 },
-  { 186.0349367240001 , 232.05890274589228 },
-  { 452.50562193935696 , 18.682374366596108 },
-  { 214.9658584008132 , 66.94368771646202 },
-  { 433.90514640472 , 166.1959339032109 },
-  { 543.8783943949715 , 164.276343719174 },
-  { 579.687635703714 , 60.278755589005144 },
-  { 327.18889600669763 , 186.7269884414482 },
-  { 261.44964100967275 , 166.62848121262314 },
-  { 262.18163358840934 , 273.50069406433215 },
-  { 126.13008926269728 , 139.8135269775751 },
-  { 229.2916772072189 , 61.44452110424889 },
-  { 688.3234762857733 , 77.48498239878013 },
-  { 371.7530884315204 , 283.08695420914705 },
-  { 543.8783943949713 , 164.276343719174 },
-  { 466.06311020717385 , 271.3798940115852 },
-  { 220.94671437316305 , 215.1944952122745 },
-  { 491.0414891673396 , 53.8867365911521 },
-  { 153.87697292154624 , 126.87494263751803 },
-  { 332.3361976610328 , 385.77146531957425 },
-  { 316.44464100967275 , 71.37434705037275 },
-  { 346.2634403058223 , 202.69923086283907 },
-  { 324.94430250333187 , 179.38525390353175 },
-  { 151.5266439458424 , 170.4670768549312 },
-  { 386.31198754286316 , 106.52429411669783 },
-  { 140.0295582710332 , 279.85454012648756 },
-  { 342.47553263243583 , 74.76632013092673 },
-  { 45.90779901413768 , 105.88786123605188 },
-  { 676.8030414422674 , 8.641578398185018 },
-  { 84.78860789276618 , 189.0823859233571 },
-  { 592.0948368303019 , 263.1347008716194 }
-},
-{ //#22
-  { 190.9107328011404 , 497.6622110601956 },
-  { 192.83032298517716 , 387.6889630699441 },
-  { 295.5148340956044 , 427.1058538404317 },
-  { 299.22973755495315 , 516.7617741217813 },
-  { 352.5539476858478 , 612.9611957100434 },
-  { 303.18734864272074 , 317.3837839523536 },
-  { 158.75276899868655 , 392.47825095182134 },
-  { 333.1336296599947 , 530.4626452006737 },
-  { 412.106933523606 , 302.07613457775597 },
-  { 126.26023290149126 , 408.6784318488951 },
-  { 391.0292683928225 , 383.5774183488474 },
-  { 227.97171881025815 , 306.99996665116913 },
-  { 91.0361633276174 , 479.1515537410247 },
-  { 72.07946620948321 , 460.1948566228905 },
-  { 77.63175424648524 , 588.3217049600537 },
-  { 308.41331245135075 , 382.01296627444333 },
-  { 194.39295468785946 , 516.770349305415 },
-  { 496.36416182226236 , 231.37592538833348 },
-  { 243.28250118141793 , 225.13840818403642 },
-  { 451.6271984503551 , 331.85679027444314 },
-  { 194.868343888908 , 298.2842208907679 },
-  { 96.86653629342942 , 348.2186359571207 },
-  { 351.6123776223349 , 486.2619294592746 },
-  { 148.5037134842495 , 251.1032302185673 },
-  { 107.30073427443332 , 353.0841823823682 },
-  { 263.5305321745996 , 303.4317347712877 },
-  { 529.4018733130634 , 409.6314651371515 },
-  { 461.72409890487677 , 599.5567866289111 },
-  { 349.0088164752518 , 372.6506845828593 },
-  { 260.0250372639514 , 437.30118448250846 },
-  { 431.40674613856504 , 705.2859605651669 },
-  { 92.95575351165418 , 369.17830575077323 },
-  { 373.75118294253355 , 265.4797211571313 },
-  { 187.92837949089312 , 404.23764696738635 },
-  { 72.07946620948317 , 324.76164528075225 },
-  { 307.8058372654356 , 270.6697324190584 }
-},
-{ //#23
-  { 455.95018614022257 , 83.46432225101717 },
-  { 368.10826639012083 , 149.65795664751096 },
-  { 398.42561915643256 , 255.38713058376663 },
-  { 564.8697710211079 , 68.15667287641952 },
-  { 506.0120737611438 , 278.25533745681196 },
-  { 587.7505731154024 , 204.65766206340118 },
-  { 531.1015352560455 , 110.37783065917587 },
-  { 446.6420615917632 , 156.52877343132127 },
-  { 321.62448378126135 , 249.3427501436721 },
-  { 291.25465573070454 , 280.1294970510483 },
-  { 505.1484460895294 , 281.9961198807741 },
-  { 606.3947749207633 , 324.97263670330926 },
-  { 525.1116368227295 , 169.9363327029992 },
-  { 323.54407396529814 , 139.36950215342063 },
-  { 488.1081499426764 , 188.64828235939143 },
-  { 676.7343523267028 , 140.007162163752 },
-  { 669.0618377795864 , 30.28509227567396 },
-  { 422.105348667371 , 204.60578677176485 },
-  { 596.2927586856102 , 64.99416254047782 },
-  { 285.4982239035431 , 170.2902345233927 },
-  { 486.90529541405385 , 76.49124821528704 },
-  { 488.80584695136884 , 386.89117803887115 },
-  { 305.14880906018726 , 313.67295045677685 },
-  { 671.0452748204125 , 413.95641591460975 },
-  { 596.7750208587775 , 365.904096637405 },
-  { 565.1203373592516 , 70.05991316988492 },
-  { 717.278280214917 , 129.14344942811934 },
-  { 696.7736235717199 , 109.73112591238507 },
-  { 572.1869176679671 , 365.7399734792792 },
-  { 411.8716359932841 , 287.0639611597694 },
-  { 374.3677588717589 , 399.15123475742905 },
-  { 548.1955619085397 , 23.55947478971435 },
-  { 642.89501222196 , 147.83458803259327 },
-  { 411.8716359932841 , 340.2819397537843 },
-  { 656.831402490599 , 40.76570159948935 },
-  { 237.28178146821242 , 71.43187737094736 }
-},
-{ //#24
-  { 214.36899603910234 , 202.84724300188904 },
-  { 149.71849613945324 , 291.8310222131895 },
-  { 89.8136486781504 , 384.0763979815067 },
-  { 256.44132307255006 , 318.44001151019694 },
-  { 106.0499912852896 , 183.74767994030336 },
-  { 297.37950276780504 , 130.68731040322314 },
-  { 344.2832428226518 , 384.63364590669073 },
-  { 348.1218384649599 , 274.7106488428604 },
-  { 197.6947092716439 , 84.20352779436362 },
-  { 120.08916463487701 , 146.19820514253217 },
-  { 244.76504710471787 , 312.3294444072507 },
-  { 305.66388317905245 , 63.21644639289748 },
-  { 192.7232940744929 , 116.03107426923414 },
-  { 230.01216169870736 , 150.03680078484027 },
-  { 232.7290028681559 , 41.70353119192268 },
-  { 407.37091505690336 , 294.53511255534454 },
-  { 458.0950864552114 , 272.7910586588235 },
-  { 426.0217421769104 , 458.2313213001015 },
-  { 267.9384087473593 , 427.8274747817533 },
-  { 154.07794384617745 , 41.59149891522823 },
-  { 228.7250052169362 , 163.40443195230716 },
-  { 369.1847375785932 , 470.8039916042885 },
-  { 432.37906676361627 , 204.0104396534379 },
-  { 327.77236053631236 , 237.9992188647384 },
-  { 326.208220756058 , 572.0503204355224 },
-  { 203.98263874965448 , 56.23346852657916 },
-  { 124.40999811434315 , 60.803094253508334 },
-  { 92.57231639343001 , 132.7773415205573 },
-  { 352.3759150569033 , 199.28097839309416 },
-  { 45.7589390923647 , 22.49193585364255 },
-  { 50.396757907662774 , 281.3918868710795 },
-  { 344.44984060087893 , 265.8456617983911 },
-  { 390.93362320973847 , 166.16086830223003 },
-  { 497.6564501428353 , 192.76985759923747 },
-  { 44.10469585592598 , 39.67190873119145 },
-  { 306.96576291261994 , 240.25876524633424 }
-},
-{ //#25
-  { 110.82891193436492 , 334.6862547135101 },
-  { 160.76332700071765 , 236.6844471180315 },
-  { 268.3497816054289 , 259.55265399107685 },
-  { 182.8714973047767 , 190.33370417950522 },
-  { 269.54480009398003 , 258.05030985057437 },
-  { 375.2739740302357 , 227.73295708426255 },
-  { 116.58534376152633 , 444.5255172411657 },
-  { 394.3735370918214 , 336.0519618380753 },
-  { 171.58034376152634 , 539.7796514034161 },
-  { 219.9421351217684 , 482.14431280555596 },
-  { 270.09001392186144 , 195.5749932818088 },
-  { 370.3307337692298 , 218.34967478126066 },
-  { 460.429267120576 , 155.26200254700905 },
-  { 314.8269772937687 , 95.09412839569913 },
-  { 198.17914667937433 , 299.25328906039056 },
-  { 339.3089637334331 , 110.09670898115657 },
-  { 454.58796206788617 , 147.64946559183818 },
-  { 369.10967776723396 , 216.8684154034098 },
-  { 413.38498285807 , 45.668513428037244 },
-  { 305.89925523060407 , 91.57740515163992 },
-  { 275.95382154208266 , 377.0279639230989 },
-  { 464.61056517345514 , 161.70063692190377 },
-  { 155.2026298568391 , 198.00696022915668 },
-  { 443.3065518636019 , 74.28746767241381 },
-  { 316.2695771195166 , 97.3056906188574 },
-  { 380.9200770191657 , 8.321911407556925 },
-  { 157.7883229713425 , 342.5445650773647 },
-  { 53.497671527274804 , 534.6240505925119 },
-  { 306.6833169747017 , 206.8771454619685 },
-  { 68.80454376004202 , 277.8940651777156 },
-  { 308.9616908644675 , 155.3657987401471 },
-  { 317.9680629250363 , 415.1721464773235 },
-  { 106.98618742150848 , 296.86531738160204 },
-  { 186.61128225117034 , 185.95497859766604 },
-  { 204.98799501698704 , 346.7997324479548 },
-  { 447.6977472227159 , 239.8525402498131 }
-},
-{ //#26
-  { 138.5025568324824 , 287.9785379686891 },
-  { 210.6624894311483 , 370.9890446973918 },
-  { 270.5673368924511 , 463.234420465709 },
-  { 205.91683699280202 , 552.2181996770095 },
-  { 317.3853163642451 , 344.3800554003843 },
-  { 250.07938020163587 , 473.673555807819 },
-  { 276.6170461822245 , 636.4754279756659 },
-  { 101.31013076549809 , 586.2069788883099 },
-  { 145.47267397433194 , 507.6623350191195 },
-  { 320.7795893910583 , 557.9307841064754 },
-  { 104.51377762118196 , 392.5852441959931 },
-  { 97.29957762266622 , 185.9975858048882 },
-  { 326.55146124857725 , 538.4736203801873 },
-  { 140.42214701651918 , 178.00528997843765 },
-  { 216.0906009903354 , 369.06684958051505 },
-  { 272.9475870746812 , 581.2600104125303 },
-  { 27.71245537208725 , 504.4684795340513 },
-  { 228.48318070303463 , 579.8222676177854 },
-  { 131.36777496448127 , 528.1850904269653 },
-  { 241.8593481927245 , 325.59733353307945 },
-  { 36.797171950112826 , 305.9119414067897 },
-  { 351.37409557554554 , 239.77334917308036 },
-  { 332.27453251395985 , 348.0923539268931 },
-  { 355.2633403100101 , 505.83151961027284 },
-  { 155.5853974956764 , 92.72077570864289 },
-  { 273.5994207128372 , 317.5480240357887 },
-  { 452.6204244067794 , 282.74986599561555 },
-  { 122.27545625076502 , 236.69299159521805 },
-  { 364.7785046566777 , 348.94350039210934 },
-  { 219.9291966326435 , 259.1438525166847 },
-  { 300.20841000984467 , 424.27085096888555 },
-  { 185.08905259179892 , 394.01547065413735 },
-  { 48.17677124820199 , 118.10044251713481 },
-  { 402.68600934042666 , 380.7516735910941 },
-  { 123.91187696034937 , 557.7926896649459 },
-  { 40.90137023164668 , 629.9526222636118 }
-},
-{ //#27
-  { 324.49679443569016 , 245.30044115830452 },
-  { 318.7403626085288 , 355.1397036859601 },
-  { 434.06824927880126 , 235.7141810134896 },
-  { 337.86882769053915 , 289.0383911443842 },
-  { 410.028760289205 , 206.0278844156815 },
-  { 454.7657236611123 , 306.50874930179117 },
-  { 370.6118695187174 , 103.3433733052543 },
-  { 480.1833243618285 , 93.75711316043936 },
-  { 430.7389760692248 , 216.83293438747828 },
-  { 345.2606917685726 , 147.61398457590664 },
-  { 460.7104028700636 , 166.43104553950585 },
-  { 344.9264611334567 , 300.7523174746298 },
-  { 543.7209095987663 , 94.27111294083994 },
-  { 376.03998107790454 , 101.42117818837758 },
-  { 265.8062764942085 , 377.1577916414149 },
-  { 344.7757236611123 , 306.50874930179117 },
-  { 241.90390040833054 , 185.23278014029697 },
-  { 460.2972093765609 , 30.7209689989551 },
-  { 343.48272907581054 , 247.9687402602321 },
-  { 456.51254289806457 , 106.3430909195204 },
-  { 456.4586137342528 , 140.64396606278544 },
-  { 250.89911904227935 , 327.0389405125631 },
-  { 272.7665285347908 , 217.74181074592718 },
-  { 550.9651452493745 , 359.8329594326858 },
-  { 280.78584691565413 , 156.41617818837756 },
-  { 283.4208336807092 , 209.5664748693008 },
-  { 547.8999300328976 , 180.4304159496427 },
-  { 281.1215670441385 , 458.4964950462022 },
-  { 209.57021138949983 , 341.7352946048279 },
-  { 266.3179111898265 , 93.74866364126129 },
-  { 178.8048947518532 , 197.61915739819375 },
-  { 275.357735356467 , 48.34837330525429 },
-  { 651.8975181630665 , 216.23965725838536 },
-  { 375.52834638228654 , 384.83030618853127 },
-  { 177.69165974445355 , 239.8838276356126 },
-  { 542.0357087308195 , 104.31864439236591 }
-},
-{ //#28
-  { 306.59454125679355 , 354.038575776704 },
-  { 203.2377498965515 , 391.65737134109435 },
-  { 226.10595676959676 , 284.0709167363831 },
-  { 148.24274989655146 , 296.40323717884394 },
-  { 282.7549946289536 , 189.79108533215776 },
-  { 217.4616997081231 , 381.88152147949614 },
-  { 65.23224316784878 , 224.24330458017803 },
-  { 158.509053264094 , 165.95748470716774 },
-  { 18.748460558989194 , 124.55851108401694 },
-  { 48.02601635807377 , 115.60746399811885 },
-  { 116.3838868815187 , 291.74343128349943 },
-  { 276.0403718359495 , 186.0691091409045 },
-  { 386.01361982620097 , 184.14951895686758 },
-  { 206.48242023286488 , 228.65575904924782 },
-  { 120.2272431678488 , 128.98917041792765 },
-  { 109.14269495431034 , 400.9810845410818 },
-  { 258.11959742368504 , 325.7711647878012 },
-  { 88.33790243524865 , 204.15786141052675 },
-  { 407.0754061429032 , 398.7755391486113 },
-  { 369.42829741815694 , 122.07447966108855 },
-  { 377.03482603317894 , 133.14204747280087 },
-  { 346.74058102537197 , 270.32633743956086 },
-  { 355.2350031622384 , 377.4083419786213 },
-  { 353.37373158593545 , 380.7661647878012 },
-  { 258.8341450261745 , 294.70494972296365 },
-  { 58.144216545205225 , 233.3155649445924 },
-  { 305.1572891506048 , 281.9078076353558 },
-  { 316.204490120943 , 220.98324450213153 },
-  { 462.4059665879664 , 402.15070844590304 },
-  { 562.0907600841275 , 355.66692583704344 },
-  { 127.36316635677692 , 444.96919371374776 },
-  { 157.55685224682026 , 118.67957710987453 },
-  { 9.212923455790687 , 316.4857977507811 },
-  { 356.5289563231463 , 452.0403833721826 },
-  { 411.8840410215953 , 471.6881733828466 },
-  { 458.5576916943097 , 412.924128590255 }
-},
-{ //#29
-  { 337.15808414230077 , 109.8733054133621 },
-  { 243.88127404605547 , 168.1591252863723 },
-  { 230.91590250876612 , 81.4057986425359 },
-  { 437.6389490284104 , 154.61026878526937 },
-  { 140.5244826858134 , 205.77792085076263 },
-  { 65.51148306253921 , 286.2195144918552 },
-  { 330.4679856026824 , 129.86790231798767 },
-  { 358.9354923735087 , 236.11008395152228 },
-  { 55.04619838516119 , 136.558971039191 },
-  { 340.0860537277951 , 68.00138956140366 },
-  { 384.31473889751584 , 58.41084719700723 },
-  { 98.02271520769638 , 35.31264220795707 },
-  { 317.4789494394663 , 249.8976246406309 },
-  { 417.95981432557596 , 294.6345880125382 },
-  { 205.99188911510493 , 14.325560806490923 },
-  { 157.7307094955884 , 314.41376143282184 },
-  { 391.0934561759625 , 341.2940440598966 },
-  { 82.71770987231415 , 233.9721677917293 },
-  { 173.09793766725048 , 263.3513076188098 },
-  { 431.7143144339163 , 86.89138549545234 },
-  { 404.1522522286696 , 182.1810189695617 },
-  { 395.443904015311 , 203.15011550960742 },
-  { 26.094592292051587 , 183.535003381428 },
-  { 135.26474351108058 , 170.13059430029577 },
-  { 253.41275093859173 , 0.28478389033455187 },
-  { 333.85434457968427 , 75.29778351360875 },
-  { 432.44893776648337 , 171.07088152780383 },
-  { 420.5276473688876 , 7.581177842539532 },
-  { 130.43503762265647 , 126.14276201444318 },
-  { 71.11698550344954 , 304.554286828626 },
-  { 242.31688747882208 , 177.8730233181576 },
-  { 314.91147399599026 , 29.633210181088522 },
-  { 47.42453089395377 , 198.30269461310905 },
-  { 198.41775093859175 , 95.53891805258496 },
-  { 540.033319187729 , 105.99094855703801 },
-  { 452.94659840300807 , 263.5298536661547 }
-},
-{ //#30
-  { 61.24309930088365 , 127.9015425468449 },
-  { 124.3307715351352 , 218.00007589819108 },
-  { 71.00656140424059 , 314.1994974864532 },
-  { 167.30728835767044 , 319.24640472942497 },
-  { 19.36938421342049 , 411.31490322500656 },
-  { 246.42747299691868 , 395.65187889621006 },
-  { 32.77559253005738 , 234.1437241803795 },
-  { 271.3048764878393 , 355.05564603816765 },
-  { 84.01988411306958 , 322.3311240137061 },
-  { 202.08592667626772 , 269.5773617375154 },
-  { 116.17784791552339 , 427.51508412208034 },
-  { 171.23309930088365 , 127.9015425468449 },
-  { 150.21351850956333 , 234.48920426360434 },
-  { 120.94097647059334 , 412.20130508193176 },
-  { 234.25376859896554 , 214.16148025588302 },
-  { 63.092945296369116 , 339.8728981166352 },
-  { 33.09905672049159 , 478.39493947842556 },
-  { 142.7655925300574 , 21.65936091331028 },
-  { 90.62362370428161 , 517.9304790181875 },
-  { 98.08833854609888 , 305.3866030462581 },
-  { 68.54858819045644 , 88.48465177635731 },
-  { 190.15992628216497 , 326.72302078127956 },
-  { 257.40582170901666 , 382.3340769636765 },
-  { 110.6076287276036 , 126.84332102168456 },
-  { 192.33888886688231 , 341.43068707529176 },
-  { 182.02169170854816 , 372.26553908005883 },
-  { 193.61813545630628 , 54.683388423018656 },
-  { 225.56531118707977 , 439.01216979688957 },
-  { 20.31366368339053 , 383.16127790896644 },
-  { 222.30228835767045 , 223.99227056717456 },
-  { 200.1663364922309 , 379.55060972776687 },
-  { 110.42345217472808 , 211.51498637602594 },
-  { 314.28139331037454 , 456.30197486940153 },
-  { 271.87256416335583 , 317.51827161612505 },
-  { 315.5790984539157 , 282.27809044018477 },
-  { 138.10594491964332 , 420.31449175772775 }
-},
-{ //#31
-  { 119.09511685454868 , 329.3390409236428 },
-  { 217.95347400699407 , 281.12259848831224 },
-  { 187.63612124068234 , 386.8517724245679 },
-  { 278.8219638460114 , 448.35739987731534 },
-  { 108.51593660143409 , 463.257246591353 },
-  { 320.6379851174213 , 241.70570771782462 },
-  { 345.0155982425052 , 536.199319627417 },
-  { 80.9132943075855 , 413.46076172157535 },
-  { 112.35453224374221 , 353.3342495275227 },
-  { 231.35788308812627 , 171.95244726928325 },
-  { 269.2357037011964 , 338.78594503420425 },
-  { 42.3223022049403 , 375.4153268412513 },
-  { 246.15724109005978 , 487.98287719208645 },
-  { 322.560180234298 , 315.1113776996127 },
-  { 217.90339987299046 , 451.7601609165438 },
-  { 173.21651063508682 , 180.64173360220258 },
-  { 109.50885670973375 , 438.9104957667539 },
-  { 91.30970979165909 , 354.6214060092938 },
-  { 72.21014673007342 , 246.30240125548107 },
-  { 31.91293860264966 , 428.34724915079687 },
-  { 189.83818463471093 , 513.0078997769645 },
-  { 263.36346789983475 , 379.34703661002726 },
-  { 164.45552249839062 , 186.39755379417826 },
-  { 76.0020604170615 , 463.54099089017916 },
-  { 422.2449737304591 , 268.6275950907531 },
-  { 123.67364260276874 , 224.4735606289554 },
-  { 110.43552678547088 , 573.2304945816045 },
-  { 75.15686248042414 , 523.3000242492309 },
-  { 201.79274669767932 , 404.9714267183427 },
-  { 345.380351584703 , 134.5347442920966 },
-  { 186.8410009522559 , 494.1103099423562 },
-  { 161.292438167159 , 121.11676926871333 },
-  { 327.3409372785504 , 269.62551281350306 },
-  { 135.90829430758552 , 508.71489588382576 },
-  { 268.9748774179179 , 213.65492893134487 },
-  { 242.31864544775163 , 378.0598801282561 }
-},
-{ //#32
-  { 397.66873515066965 , 432.2472513236217 },
-  { 403.42516697783105 , 542.0865138512772 },
-  { 293.703097089753 , 534.4139993041609 },
-  { 288.7491502697843 , 416.9396019490241 },
-  { 288.7491502697843 , 416.9396019490241 },
-  { 313.32663362648486 , 605.1741860855288 },
-  { 396.71832417719287 , 395.952520547558 },
-  { 446.6527392435456 , 297.95071295207936 },
-  { 426.1362419214959 , 326.0050696900871 },
-  { 296.42240631943577 , 475.22376814615694 },
-  { 510.3934702201523 , 396.7052788795096 },
-  { 240.53270783445367 , 515.7979591014695 },
-  { 310.909323899528 , 643.0498398862202 },
-  { 452.40917107070703 , 188.11145042442377 },
-  { 259.27214670870785 , 545.9344341476668 },
-  { 344.0901663168943 , 207.21101348600942 },
-  { 249.93862371057625 , 574.9085616423181 },
-  { 218.6477314567274 , 397.4490932834486 },
-  { 357.30143340670526 , 293.2680094371308 },
-  { 131.3625566154247 , 502.3935500203373 },
-  { 190.34630572951093 , 572.0327948685513 },
-  { 555.0936821811342 , 227.52834119491135 },
-  { 522.9357183786805 , 332.71230130328564 },
-  { 301.11364949435904 , 105.96468465477552 },
-  { 284.30033460252054 , 536.3270129531234 },
-  { 300.3195537197624 , 573.952385052588 },
-  { 441.17452040858075 , 482.18356318016185 },
-  { 528.3912385978042 , 371.54838834549014 },
-  { 318.30738269716204 , 593.5726339641778 },
-  { 620.6366143661214 , 311.6435408841873 },
-  { 514.3944327325868 , 340.1110476550136 },
-  { 101.36252651821047 , 636.6832947682004 },
-  { 505.9877399044824 , 451.3468143852074 },
-  { 150.9531419548951 , 526.8348710860812 },
-  { 175.6955084221768 , 419.6639076603532 },
-  { 417.705405578659 , 287.9833466401494 }
-},
-{ //#33
-  { 296.7321302297813 , 367.9072786967841 },
-  { 339.7086470523165 , 266.66094986555015 },
-  { 224.5721976311154 , 284.89677196808145 },
-  { 331.7431610568434 , 309.6391384353632 },
-  { 391.6480085181462 , 217.39376266704596 },
-  { 214.99363087552274 , 441.50495409019493 },
-  { 250.24834762092172 , 268.222485200623 },
-  { 402.79631928656806 , 356.75948321689634 },
-  { 203.45532013353602 , 426.1930985697943 },
-  { 126.00985166422228 , 506.1554539898441 },
-  { 292.89353458747325 , 477.8302757606144 },
-  { 114.58219763111539 , 284.89677196808145 },
-  { 368.7798016451008 , 109.8073080623347 },
-  { 411.8685796509824 , 349.67145659425285 },
-  { 232.73267859731914 , 479.5464646928366 },
-  { 192.20348606071605 , 418.31353423974235 },
-  { 189.53674322723117 , 440.2114801962241 },
-  { 253.70911351346342 , 327.1276916344133 },
-  { 459.44535714592496 , 451.03931462112166 },
-  { 373.33512822856585 , 552.8432753838886 },
-  { 393.3743994735829 , 522.5672391325216 },
-  { 372.38731807211667 , 414.5980652251131 },
-  { 430.8944896576455 , 205.15532241280266 },
-  { 337.4995928840048 , 419.47840096301877 },
-  { 223.10732047478422 , 326.84536524513817 },
-  { 71.01485166422223 , 410.90131982759374 },
-  { 223.10732047478422 , 326.84536524513817 },
-  { 82.42423382866158 , 390.0807320764557 },
-  { 363.18050174731997 , 111.15158103351135 },
-  { 57.61044258309008 , 520.0714710466227 },
-  { 447.43773004597637 , 181.8517902229338 },
-  { 65.21800701888657 , 498.7165726585149 },
-  { 27.599211454496192 , 395.3597812982729 },
-  { 287.1458700849664 , 477.4787335398952 },
-  { 511.5533731471435 , 303.18767398539325 },
-  { 93.41968389183275 , 624.0690591767916 }
-},
-{ //#34
-  { 501.44129652740696 , 49.3458163962468 },
-  { 420.9997028863144 , 124.35881601952102 },
-  { 507.19772835456837 , 159.18507892390238 },
-  { 609.1786805183693 , 200.38805813371854 },
-  { 439.4811226834992 , 245.85838171310573 },
-  { 349.38258933215303 , 308.9460539473573 },
-  { 248.90172444604337 , 353.6830173192646 },
-  { 358.87497243629485 , 355.6026075033014 },
-  { 258.39410755018514 , 310.86564413139416 },
-  { 435.03779575590244 , 242.19558565260505 },
-  { 675.3723149148631 , 112.54613838361679 },
-  { 465.63205521866433 , 153.34340452641567 },
-  { 459.2218518598086 , 303.18962212019585 },
-  { 368.51664948011097 , 101.70622733559554 },
-  { 370.43623966414776 , 211.67947532584702 },
-  { 414.73875621621755 , 353.0293451388337 },
-  { 557.2236594552871 , 253.2552070538431 },
-  { 484.73161828025 , 261.6624092802284 },
-  { 463.71246503462754 , 43.3701565361642 },
-  { 345.1011460343055 , 407.00722745015923 },
-  { 602.6876253586408 , 6.36929957371148 },
-  { 309.9656985616654 , 206.26154283693012 },
-  { 553.0784737182271 , 146.46122213480015 },
-  { 153.7874013228812 , 344.85442334269464 },
-  { 482.2106598320129 , 172.81361341275056 },
-  { 663.8752292400538 , 221.93360165517316 },
-  { 195.57751431514876 , 449.88243890752676 },
-  { 713.1762686485381 , 164.57881682497577 },
-  { 363.9677176975582 , 248.19462212019585 },
-  { 613.872697314644 , 158.97537564961777 },
-  { 621.990426043209 , 226.0844442777232 },
-  { 368.78091349407674 , 330.1156100117621 },
-  { 182.70809004954958 , 441.52493706936633 },
-  { 505.7186996817162 , 369.631583187637 },
-  { 375.4184988006172 , 512.736401386415 },
-  { 466.03781684995806 , 191.74957960109566 }
-},
-{ //#35
-  { 258.23195729528896 , 318.3800876268621 },
-  { 277.33152035687465 , 426.69909238067487 },
-  { 368.20520528554044 , 320.2996778108989 },
-  { 305.7990271277009 , 320.4569107471403 },
-  { 319.2034362088331 , 211.2867595281113 },
-  { 252.47552546812753 , 208.54082509920653 },
-  { 319.20343620883307 , 429.62706196616926 },
-  { 152.7907319719664 , 162.05704249034702 },
-  { 352.89755591094286 , 429.21926269178425 },
-  { 256.78832010213523 , 126.24780118160426 },
-  { 449.09697749920497 , 375.89505256088967 },
-  { 479.4143302655167 , 481.62422649714534 },
-  { 389.19228668700663 , 428.2688517183075 },
-  { 588.8017935370731 , 493.12131217195457 },
-  { 557.7328180812642 , 393.10127937066466 },
-  { 148.46931534832248 , 107.14823812001858 },
-  { 557.7328180812642 , 283.11127937066465 },
-  { 567.2562500156184 , 547.8178608936391 },
-  { 148.39269476763337 , 324.1365194540235 },
-  { 178.7100475339451 , 429.8656933902792 },
-  { 354.43137888355113 , 265.05587749596754 },
-  { 379.72953676935555 , 435.14044388828586 },
-  { 522.6946528926157 , 457.63355191514825 },
-  { 291.19047909152806 , 478.20326678466023 },
-  { 394.81419458254794 , 427.02250474399574 },
-  { 422.7060535918908 , 536.3867727195197 },
-  { 189.59567397744954 , 222.15556729022256 },
-  { 159.67291436358187 , 177.88497837242443 },
-  { 597.7076525158899 , 377.19195827405565 },
-  { 299.1671288205606 , 231.7418274350375 },
-  { 508.9704301426082 , 454.54105079739384 },
-  { 336.7327537667839 , 137.84061590978405 },
-  { 522.6946528926156 , 296.7503646329631 },
-  { 404.4493594378531 , 51.16731312058073 },
-  { 343.94580267611485 , 104.11579610238329 },
-  { 334.5110855834307 , 538.5466468470546 }
-},
-{ //#36
-  { 233.10056514679573 , 282.8229159426349 },
-  { 291.3863850198059 , 189.5461058463896 },
-  { 310.87524000950407 , 360.59759080534326 },
-  { 395.9930912471099 , 155.5573266350891 },
-  { 276.07708196933095 , 384.0692447738688 },
-  { 447.63026843793 , 252.67273237364248 },
-  { 239.7492078289858 , 92.43070010783622 },
-  { 201.153170121426 , 368.2701053524596 },
-  { 348.2370145679968 , 467.07975150257147 },
-  { 186.61678253793616 , 183.1381224464738 },
-  { 241.99483293446218 , 438.61224473174525 },
-  { 437.196070456926 , 257.5382787988901 },
-  { 170.0128929125442 , 372.92144929398114 },
-  { 295.4330015256513 , 311.6210674931027 },
-  { 452.23460269816565 , 431.2705101938287 },
-  { 415.4723046354761 , 147.4887722652682 },
-  { 336.1233483917132 , 89.06524096027994 },
-  { 152.93672768609537 , 467.128462504905 },
-  { 266.49082182451605 , 493.6406996169799 },
-  { 210.39437512339438 , 315.86062743343604 },
-  { 342.9398276744513 , 288.5793477697963 },
-  { 134.02565902705362 , 459.59932613321143 },
-  { 476.43468488820247 , 230.5703262583633 },
-  { 501.1770513554842 , 337.7412896840913 },
-  { 471.1848496682265 , 362.14498502619404 },
-  { 323.2269288671589 , 87.58392480396537 },
-  { 480.189969954018 , 445.7104635914999 },
-  { 347.17879304283645 , 406.4542809292915 },
-  { 253.41759257220502 , 422.3914991329977 },
-  { 254.18305651732928 , 510.1049793274402 },
-  { 150.18546838716043 , 545.9142206361829 },
-  { 416.18984966822654 , 457.39911918844444 },
-  { 408.0300373553521 , 528.7209703202026 },
-  { 488.3497822668924 , 374.38861245974175 },
-  { 347.72400687071786 , 468.929597498057 },
-  { 101.96902595182976 , 447.05586348373754 }
-},
-{ //#37
-  { 518.124015066921 , 440.9804214974903 },
-  { 408.2010180030906 , 437.1418258551822 },
-  { 359.98457556776 , 536.0001830076276 },
-  { 518.124015066921 , 550.9704214974903 },
-  { 379.0841386293456 , 427.68117825381483 },
-  { 510.4515005198046 , 331.2583516094122 },
-  { 610.3693908352382 , 500.8852689587931 },
-  { 301.0300545773626 , 461.8841923224639 },
-  { 482.4409299895877 , 390.06238268942457 },
-  { 302.6786644625605 , 506.80136289306313 },
-  { 450.4074093958518 , 354.3071187082869 },
-  { 483.21401762636475 , 356.7002322140896 },
-  { 192.75566739873017 , 510.6399585353712 },
-  { 440.42616920885257 , 611.0131826309018 },
-  { 371.28722475660356 , 277.9016445415018 },
-  { 706.5688124235003 , 554.2094790896878 },
-  { 418.2061247514874 , 391.163199070715 },
-  { 231.97845527313802 , 422.5441345944067 },
-  { 393.942386599993 , 511.32838913474075 },
-  { 314.63818689724667 , 183.6218131372765 },
-  { 97.50153323647977 , 455.6449585353712 },
-  { 123.05887039225271 , 407.23648521980914 },
-  { 479.3754219840566 , 246.7772351502593 },
-  { 416.81059347303835 , 618.914843739452 },
-  { 312.20388724573445 , 584.9260645281514 },
-  { 311.6266333646641 , 586.7568799369982 },
-  { 549.813632480409 , 599.5160969560926 },
-  { 554.4049975260207 , 390.1163600170296 },
-  { 204.79736974651132 , 333.63880982639836 },
-  { 405.77774659064573 , 328.51573450451787 },
-  { 375.6076142632222 , 720.8957959032529 },
-  { 372.1087347070373 , 677.1714402964686 },
-  { 433.89343413623243 , 814.1726059994982 },
-  { 203.28430236484914 , 600.2337139027491 },
-  { 174.4800169801996 , 439.36798376265403 },
-  { 155.78735310948997 , 362.3681484391259 }
-},
-{ //#38
-  { 397.1206911163706 , 370.841368396373 },
-  { 470.7183665097814 , 289.1028690421144 },
-  { 571.199231395891 , 333.83983241402166 },
-  { 592.1863127973572 , 441.8090063214302 },
-  { 546.4568649286093 , 441.0107958397497 },
-  { 698.9091397304541 , 415.2000170244228 },
-  { 541.4185756992039 , 204.84564074345798 },
-  { 615.675814740181 , 355.53251153909747 },
-  { 361.5482152907524 , 302.5072781232466 },
-  { 491.4005225205959 , 314.1923305370161 },
-  { 290.84800610132993 , 218.2500498245902 },
-  { 482.5989754170228 , 440.06031820794465 },
-  { 724.8459659592099 , 368.9369206202296 },
-  { 800.1554685616879 , 372.2235002018875 },
-  { 563.0405690581154 , 365.04731858467045 },
-  { 718.4169692074294 , 298.62582480847664 },
-  { 524.2123488894289 , 96.20980016139879 },
-  { 656.3173791543605 , 306.7614987116601 },
-  { 530.8154178523534 , 538.91867536039 },
-  { 690.8571867479095 , 264.33021439292565 },
-  { 578.0570191757906 , 252.17572017885544 },
-  { 516.5567864492558 , 265.36252508850936 },
-  { 224.65437170483614 , 306.0919695746919 },
-  { 151.0566963114253 , 224.35347022043334 },
-  { 288.4848505343114 , 388.047595206148 },
-  { 726.6664280566521 , 160.33262626275678 },
-  { 711.3123791543605 , 211.50736454940971 },
-  { 592.5722234072742 , 438.14072802390774 },
-  { 686.5700126870788 , 318.67832797513773 },
-  { 114.81510917718056 , 300.33553774753057 },
-  { 556.7629820985316 , 334.14313989373886 },
-  { 664.9411184979072 , 461.1822963885468 },
-  { 640.7384149161837 , 535.080079718082 },
-  { 117.06791710012484 , 328.9601764477373 },
-  { 826.8269181230108 , 327.7339414104134 },
-  { 8.572927543645932 , 271.86803097670435 }
-},
-{ //#39
-  { 373.1632172266981 , 291.57001620164164 },
-  { 439.3568516231919 , 379.4119359517434 },
-  { 373.1632172266981 , 401.56001620164164 },
-  { 473.6440821128078 , 446.2969795735489 },
-  { 481.4822219805109 , 382.46045314005585 },
-  { 301.0032846280322 , 208.559509472939 },
-  { 239.4976571752847 , 117.37366686761 },
-  { 475.1441693904991 , 250.36703699182544 },
-  { 429.84504478969075 , 285.3450474015025 },
-  { 510.0570608126144 , 295.154707653087 },
-  { 368.65664243376943 , 463.6691642503998 },
-  { 360.9841278866531 , 573.3912341384778 },
-  { 377.8512241704445 , 470.5977785570724 },
-  { 376.3291569808858 , 573.3912341384778 },
-  { 547.9926922052512 , 396.61816276151836 },
-  { 288.82419528798715 , 656.4017408671805 },
-  { 293.33077008091584 , 98.83743958486095 },
-  { 583.2155369559189 , 455.8832397183638 },
-  { 198.318773517605 , 247.97640024342655 },
-  { 426.94246230677965 , 556.945974346645 },
-  { 278.8833858224728 , 344.9109783422848 },
-  { 366.2245845096138 , 265.6746863664231 },
-  { 129.5076571752847 , 117.37366686761001 },
-  { 524.4587388030461 , 281.2141243088219 },
-  { 195.32896248543727 , 148.7718546512137 },
-  { 399.5729517144505 , 70.3699328140347 },
-  { 645.9944998007297 , 346.6837476951656 },
-  { 294.9662454871466 , 104.35871202533517 },
-  { 214.2105854416676 , 175.24291375164603 },
-  { 531.4166370468636 , 284.4586455445773 },
-  { 97.83790863149531 , 203.23943687151933 },
-  { 461.46499277276274 , 528.6542707665706 },
-  { 441.3421304644999 , 175.9575841299461 },
-  { 536.6645321948577 , 564.6184888937613 },
-  { 92.64445137501006 , 109.3549638807261 },
-  { 535.2552326891716 , 394.3816426084076 }
-},
-{ //#40
-  { 538.9720958386081 , 372.1411999601426 },
-  { 644.1560559469824 , 339.98323615768885 },
-  { 536.5696013422711 , 317.1150292846435 },
-  { 723.2762405862306 , 416.38871032447395 },
-  { 624.4503801392602 , 302.9222501485709 },
-  { 644.8886060960838 , 298.01546622305773 },
-  { 717.5198087590693 , 526.2279728521295 },
-  { 711.0822404925775 , 210.173546472956 },
-  { 816.3781659115147 , 478.0115304167989 },
-  { 654.4748662408987 , 188.44401137994663 },
-  { 576.5908914029984 , 475.4979913203847 },
-  { 590.8318458160878 , 243.7838145694267 },
-  { 827.8829468135345 , 382.39993111317347 },
-  { 570.2176379422423 , 117.74380219052418 },
-  { 726.2796325601685 , 541.0992026510505 },
-  { 449.89629855306777 , 384.8316349557127 },
-  { 610.5796706142988 , 580.1046975476886 },
-  { 547.0117042916212 , 436.4688121465328 },
-  { 835.6670958317249 , 552.5962883258597 },
-  { 644.1271100301745 , 384.8316349557127 },
-  { 720.6685006373924 , 100.60209162984488 },
-  { 550.674823152996 , 487.8593217793714 },
-  { 769.3680603655877 , 116.89673637671069 },
-  { 642.9777805660895 , 79.05654810839025 },
-  { 570.8178479674235 , 162.0670548370929 },
-  { 683.57294671747 , 442.66774726811605 },
-  { 500.7333124647416 , 180.69614233517518 },
-  { 514.1688101080666 , 256.34688624131826 },
-  { 586.7582605698295 , 275.11731416914995 },
-  { 622.076756289108 , 470.7172342761322 },
-  { 814.9483320416177 , 157.25112948920173 },
-  { 466.7516288753428 , 469.74155949322335 },
-  { 450.8122827033591 , 489.79302227742744 },
-  { 724.716279920348 , 5.458872714979449 },
-  { 351.8944909575892 , 434.76605002206543 },
-  { 830.0559639089488 , 89.10500595503568 }
-},
-{ //#41
-  { 397.45709725455947 , 395.1796262888525 },
-  { 311.97881295390727 , 325.96067647728086 },
-  { 366.97381295390727 , 230.70654231503045 },
-  { 236.96581333063307 , 406.4022701183734 },
-  { 234.2041380911989 , 403.7353513399892 },
-  { 344.1328871236649 , 491.37904787711466 },
-  { 395.5375070705227 , 285.206378298601 },
-  { 505.25957695860075 , 292.87889284571736 },
-  { 242.7598631423357 , 240.4823921766286 },
-  { 244.44809362750374 , 444.8952652682551 },
-  { 296.0840732732302 , 144.28297058836642 },
-  { 421.95206094415875 , 327.88026666131765 },
-  { 340.4463197247335 , 375.267844569163 },
-  { 531.6741308322368 , 335.552781208434 },
-  { 236.1792258119274 , 52.037594820049236 },
-  { 344.148399719336 , 31.05051341858309 },
-  { 221.57988675445833 , 337.30881066354385 },
-  { 489.7024730228767 , 455.0844737501553 },
-  { 635.0309221924788 , 373.1715767728243 },
-  { 132.59610754315787 , 272.65831076389475 },
-  { 196.3992797770691 , 190.76675319722597 },
-  { 256.1890914260771 , 304.5676353797405 },
-  { 138.2059119939691 , 416.4277584974289 },
-  { 210.3707824058662 , 194.88363590118638 },
-  { 292.5112225285159 , 128.16591915713647 },
-  { 241.76625876218685 , 259.2539016827625 },
-  { 291.17422581192744 , 147.29172898229962 },
-  { 96.71448628090798 , 237.2505358060855 },
-  { 133.609021970391 , 444.0210656827637 },
-  { 46.780071214555214 , 139.24872821060694 },
-  { 167.74686351906143 , 160.04079853553606 },
-  { 134.93289698069353 , 95.0141116425845 },
-  { 339.9333120274546 , 434.05270410630095 },
-  { 245.37687541969711 , 441.1701249647106 },
-  { 584.9983409631313 , 239.35335962017183 },
-  { 390.8441158704313 , 503.3009161854859 }
-},
-{ //#42
-  { 399.0082440308487 , 194.10565789003357 },
-  { 487.9920232421491 , 129.4551579903844 },
-  { 297.7619151996148 , 237.08217471256881 },
-  { 587.6768167383102 , 175.93894059924395 },
-  { 689.6577689021111 , 217.1419198090601 },
-  { 273.0195487323331 , 129.9112112868408 },
-  { 284.35750611848266 , 346.25232593159785 },
-  { 218.64173056036657 , 160.67670054578372 },
-  { 404.48474213271163 , 263.69116400957626 },
-  { 703.0621779832433 , 107.97176859003112 },
-  { 378.60455997059273 , 140.95224366519363 },
-  { 380.5241501546295 , 250.92549165544511 },
-  { 399.5916413720588 , 32.98306975778506 },
-  { 146.48179796170064 , 243.68720727448638 },
-  { 811.0313518906519 , 86.98468718856498 },
-  { 221.49479758497478 , 163.24561363339376 },
-  { 331.46804557522626 , 161.32602344935685 },
-  { 657.4998050996572 , 111.95795970068586 },
-  { 897.7046546798551 , 19.26808151749576 },
-  { 507.6440846129079 , 211.31188469980856 },
-  { 327.81188177939555 , 147.2722914646515 },
-  { 238.70102439474977 , 271.88145421545295 },
-  { 822.5284375654611 , 196.37215046012136 },
-  { 325.3743271839531 , 204.16484854438374 },
-  { 412.0476299731564 , 271.8814542154529 },
-  { 326.6787576933491 , 131.08764983094 },
-  { 807.059766113412 , 72.16252728128836 },
-  { 907.29091482467 , 128.83953636060684 },
-  { 644.776358110233 , 14.694958493785833 },
-  { 799.7044602199587 , 105.97132948756152 },
-  { 948.4938940344862 , 26.858584196805893 },
-  { 171.22416442898233 , 136.51624384875836 },
-  { 438.6566192701639 , 378.6042811485497 },
-  { 728.0208451619492 , 159.14461978723085 },
-  { 1058.4168910983165 , 23.01998855449783 },
-  { 612.4191832055919 , 68.76797717351593 }
-},
-{ //#43
-  { 540.7912307851242 , 282.8745790717845 },
-  { 490.85681571877143 , 380.8763866672631 },
-  { 599.4926563008306 , 363.67015985748804 },
-  { 600.0269669378005 , 367.47197758613083 },
-  { 573.417977640793 , 260.749150653034 },
-  { 646.51074954666 , 467.1567710822919 },
-  { 658.3127868108106 , 274.19516748988553 },
-  { 495.4950681706618 , 399.47940116623073 },
-  { 726.0293924818798 , 360.8684702790889 },
-  { 544.9504708699667 , 154.5069690194994 },
-  { 792.2230268783735 , 448.71039002919065 },
-  { 491.3911263557413 , 384.6782043959058 },
-  { 396.5769843145461 , 437.52542452662 },
-  { 652.2671813738214 , 576.9960336099475 },
-  { 890.2248344738521 , 498.6448050955434 },
-  { 565.0359767145653 , 215.90934761687535 },
-  { 640.7543177194987 , 576.9960336099475 },
-  { 722.9162237134451 , 546.2769557215402 },
-  { 387.90861356595053 , 376.6111942931854 },
-  { 749.4986294161396 , 212.68954003713804 },
-  { 381.01755319111584 , 386.6328184944245 },
-  { 887.4771610406239 , 393.7153900291906 },
-  { 425.0444910853724 , 331.2832428930854 },
-  { 419.4451911875914 , 329.93896992190867 },
-  { 749.4986294161397 , 335.70079494263297 },
-  { 373.3450386439995 , 276.91074860634643 },
-  { 278.18654367787246 , 368.9386797460691 },
-  { 682.6515720352625 , 458.2966501740056 },
-  { 351.72858551652223 , 243.2656671327053 },
-  { 428.8830867276805 , 441.20623995691574 },
-  { 835.1995437009087 , 374.27287936022105 },
-  { 717.1597918862836 , 436.43769319388457 },
-  { 480.2999709703176 , 243.49074823079985 },
-  { 662.1513824531187 , 164.2721704260552 },
-  { 680.1408045738898 , 234.14016135602654 },
-  { 702.0079191016014 , 408.67495679594697 }
-},
-{ //#44
-  { 403.31425668574076 , 330.1125520341365 },
-  { 332.6140474963183 , 414.3697803327929 },
-  { 501.3160642812193 , 280.17813696778376 },
-  { 579.0907391439276 , 202.4034621050754 },
-  { 688.8128090320057 , 210.07597665219174 },
-  { 796.7819829394143 , 189.08889525072559 },
-  { 821.524349406696 , 296.25985867645363 },
-  { 802.5384147665757 , 298.92815777838115 },
-  { 858.2876103921618 , 280.2747378560546 },
-  { 903.024573764069 , 380.7556027421643 },
-  { 226.37186586278364 , 385.9022735619667 },
-  { 931.3636119343516 , 290.50342684929217 },
-  { 329.7165812923299 , 248.37405267987793 },
-  { 305.3124490902622 , 380.04696710048927 },
-  { 713.9378948019847 , 319.12806554949896 },
-  { 1021.4621452856978 , 353.5910990835437 },
-  { 596.5674332636885 , 269.9808241134945 },
-  { 614.8999804526702 , 98.40587397490653 },
-  { 521.6231703564249 , 40.120054101896336 },
-  { 890.7432992182677 , 381.73814297710584 },
-  { 248.35681919766188 , 343.6695711433705 },
-  { 216.3286698789617 , 315.39646720084016 },
-  { 355.0978142504101 , 231.25419488169115 },
-  { 730.338506801367 , 357.76548612920107 },
-  { 193.3618191976619 , 438.9237053056209 },
-  { 842.5114308081622 , 404.2290325838622 },
-  { 785.7151080979534 , 192.26227054628478 },
-  { 631.345240244503 , 32.44753955478005 },
-  { 762.1543372373153 , 220.2697083970536 },
-  { 730.7201080979534 , 287.5164047085352 },
-  { 688.478202415484 , 190.9063764302662 },
-  { 719.527908037873 , 371.088090377047 },
-  { 393.34689037381077 , 301.16521836924994 },
-  { 702.2526013271271 , 393.75858634206986 },
-  { 834.4007785038045 , 85.73210389048351 },
-  { 307.232039274299 , 270.0737191102378 }
-},
-{ //#45
-  { 319.22471111702737 , 376.549245143718 },
-  { 351.3826749194812 , 271.36528503534373 },
-  { 306.6457115475739 , 170.88442014923407 },
-  { 255.18325333121908 , 324.6894951662384 },
-  { 180.17025370794488 , 405.1310888073309 },
-  { 306.57257831453407 , 486.8695881615895 },
-  { 217.66193233627342 , 106.23392024958497 },
-  { 169.70496903056687 , 255.47054535466674 },
-  { 369.899275525330737 , 554.5861938326586 },
-  { 45.06695086178659 , 395.6837455562605 },
-  { 274.48774774512003 , 65.70046004085982 },
-  { 68.75857380886436 , 96.01781280717162 },
-  { 6.8877848183729355 , 440.38580555272995 },
-  { 513.12996645190755 , 468.8533123235562 },
-  { 125.50854450287918 , 320.6707459329863 },
-  { 381.65871117084805 , 90.44282650814154 },
-  { 464.14571494513297 , 235.9187137457461 },
-  { 96.30474969211585 , 633.7063784719069 },
-  { 579.4533643197306 , 314.8382986266314 },
-  { 252.71547575926957 , 183.31061275600084 },
-  { 525.00075544239894 , 124.48531957799787 },
-  { 138.7305421169879 , 592.0535482699638 },
-  { 62.875792347865925 , 213.3398650014247 },
-  { 320.38014041144041 , 599.3231572045659 },
-  { 95.91302540928851 , 475.8312979967534 },
-  { 149.429242800428995 , 495.5160914929145 },
-  { 120.26879793354843 , 151.17874434151207 },
-  { 385.1825382559863 , 345.1556513929431 },
-  { 216.29464820261214 , 479.1970736144732 },
-  { 153.48524036887903 , 35.32038718906669 },
-  { 186.01697623109848 , 189.135819477647 },
-  { 424.5994290264739 , 447.8401625033703 },
-  { 486.70425497057005 , 327.91731898330477 },
-  { 29.7559916914183 , 547.9722601574413 },
-  { 428.40615809694594 , 170.11895620410985 },
-  { 229.55029163046942 , 585.9187481234336 }
-},
-{ //#2 46
-  { 486.7567544294248 , 370.05881602380447 },
-  { 398.91483467932306 , 303.8651816273107 },
-  { 552.9503888259186 , 457.9007357739062 },
-  { 652.6351823220797 , 504.38451838276575 },
-  { 445.7794254001906 , 433.1583693066245 },
-  { 596.5960169570803 , 375.8152478509659 },
-  { 703.7669803828084 , 211.07288138368415 },
-  { 258.1343489342929 , 425.74277197145244 },
-  { 790.4402831720116 , 163.35627571261494 },
-  { 706.1674718001914 , 35.4015079957808 },
-  { 898.4094570794202 , 304.34335711408113 },
-  { 798.7246635832591 , 257.85957450522164 },
-  { 448.3436825986147 , 511.8895149852067 },
-  { 778.3274043988573 , 468.41201472448347 },
-  { 861.1404923614341 , 199.09904741395854 },
-  { 352.6351823220797 , 411.4169531650466 },
-  { 948.7246635832591 , 397.84957450522165 },
-  { 195.9762686843947 , 491.93640636794623 },
-  { 813.7402283730598 , 349.15329119964724 },
-  { 353.35234534829266 , 479.2289672428335 },
-  { 710.8827438331574 , 324.05320890171544 },
-  { 301.535857227352 , 323.3191067789689 },
-  { 939.750588060633 , 452.7473411919456 },
-  { 887.7494816584415 , 92.37622048086169 },
-  { 712.5400297833825 , 412.13914261444853 },
-  { 730.6510249990474 , 621.0663459457584 },
-  { 596.5960169570803 , 204.302384196643 },
-  { 853.9454425918032 , 512.9234877694124 },
-  { 755.9919736823217 , 542.003313947156 },
-  { 622.0284810285498 , 424.670556777095 },
-  { 826.2495244807543 , 387.35386384278377 },
-  { 944.1509990901368 , 271.2589800126244 },
-  { 728.2477168852757 , 127.41944877643107 },
-  { 625.8670766708578 , 594.5935538409253 },
-  { 619.4642238301255 , 268.22879324625455 },
-  { 457.27651107499975 , 263.7709060350681 }
-},
-{ //#11 47
-  { 487.42320799100565 , 220.59999233262047 },
-  { 315.0420035553959 , 323.95678369286253 },
-  { 561.0208833844165 , 302.3384916868791 },
-  { 662.2672122156504 , 445.31500850941427 },
-  { 765.151806477097 , 293.67783131859414 },
-  { 589.4883901552428 , 196.0963100533445 },
-  { 668.990057291825 , 323.32557308834527 },
-  { 389.4883901552428 , 36.1063100533445 },
-  { 466.7410519801912 , 458.987529546236 },
-  { 688.3467473076881 , 244.31275248867513 },
-  { 630.2259636637702 , 291.79881989040877 },
-  { 233.9837820302356 , 320.26632666123504 },
-  { 352.00408860828395 , 459.46839443234563 },
-  { 213.0197368539953 , 143.16297930834958 },
-  { 947.3117390757628 , 210.66732458989145 },
-  { 664.6569140448154 , 8.04757356979619 },
-  { 245.9218189161477 , 400.3622578596476 },
-  { 154.7787017508819 , 330.80599845770536 },
-  { 554.733916980985 , 82.2089779274881 },
-  { 392.16907382875524 , 275.59499233262045 },
-  { 878.9141423434718 , 156.74778275921864 },
-  { 314.5963187586792 , 211.76341233604427 },
-  { 612.8839233054977 , 390.1504180893563 },
-  { 811.0215444494738 , 133.22856424199682 },
-  { 484.3044300468685 , 118.26427385579835 },
-  { 541.4072197701882 , 14.49237225641889 },
-  { 523.9488272672809 , 395.6587834823951 },
-  { 413.15615523022143 , 383.564166240029 },
-  { 356.7321093855064 , 132.14339299384085 },
-  { 834.6160702826887 , 212.3487488812451 },
-  { 840.82761707213785 , 329.7701435516495 },
-  { 223.2835728408131 , 236.00909836257867 },
-  { 727.410272427109 , 147.57965235563984 },
-  { 338.99358187958126 , 531.6283270310115 },
-  { 654.8116288513204 , 123.66252347544788 },
-  { 761.7723197833687 , 57.6847507606163 }
-},
-{ //#34 48
-  { 501.44129652740696 , 49.3458163962468 },
-  { 420.9997028863144 , 124.35881601952102 },
-  { 277.19772835456837 , 139.18507892390238 },
-  { 809.1786805183693 , 200.38805813371854 },
-  { 439.4811226834992 , 245.85838171310573 },
-  { 349.38258933215303 , 308.9460539473573 },
-  { 248.90172444604337 , 353.6830173192646 },
-  { 758.87497243629485 , 355.6026075033014 },
-  { 258.39410755018514 , 310.86564413139416 },
-  { 235.03779575590244 , 242.19558565260505 },
-  { 675.3723149148631 , 112.54613838361679 },
-  { 165.63205521866433 , 93.34340452641567 },
-  { 459.2218518598086 , 503.18962212019585 },
-  { 368.51664948011097 , 101.70622733559554 },
-  { 370.43623966414776 , 211.67947532584702 },
-  { 414.73875621621755 , 353.0293451388337 },
-  { 557.2236594552871 , 253.2552070538431 },
-  { 884.73161828025 , 261.6624092802284 },
-  { 423.71246503462754 , 23.3701565361642 },
-  { 345.1011460343055 , 407.00722745015923 },
-  { 602.6876253586408 , 6.36929957371148 },
-  { 309.9656985616654 , 206.26154283693012 },
-  { 553.0784737182271 , 146.46122213480015 },
-  { 153.7874013228812 , 344.85442334269464 },
-  { 482.2106598320129 , 172.81361341275056 },
-  { 663.8752292400538 , 271.93360165517316 },
-  { 195.57751431514876 , 449.88243890752676 },
-  { 713.1762686485381 , 164.57881682497577 },
-  { 133.9677176975582 , 248.19462212019585 },
-  { 613.872697314644 , 158.97537564961777 },
-  { 721.990426043209 , 226.0844442777232 },
-  { 668.78091349407674 , 330.1156100117621 },
-  { 102.70809004954958 , 441.52493706936633 },
-  { 505.7186996817162 , 369.631583187637 },
-  { 375.4184988006172 , 512.736401386415 },
-  { 176.03781684995806 , 191.74957960109566 }
-},
-{ //#9 49
-  { 405.39206992605386 , 441.9807125256651 },
-  { 316.2718852868056 , 265.57523835888003 },
-  { 514.7795331976102 , 453.47779820047435 },
-  { 197.6374456943711 , 212.0758650643623 },
-  { 543.2470399684365 , 347.23561656693977 },
-  { 603.2370399684365 , 247.23561656693977 },
-  { 652.9691098565146 , 354.9081311140561 },
-  { 537.6477400706556 , 561.0642528051856 },
-  { 704.6062870473347 , 257.79272537550276 },
-  { 400.5220399558177 , 330.43868787354216 },
-  { 860.7237340881974 , 504.8129785753589 },
-  { 357.53891234302483 , 208.98819283011073 },
-  { 542.0010592230613 , 175.2578855925683 },
-  { 596.5880021090796 , 111.5154479711651 },
-  { 763.0763024960921 , 352.9920483941012 },
-  { 437.7574910502227 , 125.0971481202239 },
-  { 723.7058501089203 , 149.47372062169 },
-  { 738.4473941571669 , 524.12708092562775 },
-  { 845.1702210902637 , 397.51809162862025 },
-  { 497.6374456943711 , 72.0758650643623 },
-  { 484.323529939761 , 657.2636743934477 },
-  { 432.68000375827154 , 225.2547277651679 },
-  { 331.52019433695165 , 379.9948489644756 },
-  { 218.30271137939707 , 306.5623197603462 },
-  { 811.8860778277934 , 252.95578516271445 },
-  { 139.18252674014883 , 462.9677939271313 },
-  { 415.8989463401125 , 535.67354045777313 },
-  { 115.58800090693387 , 383.847609287883 },
-  { 290.9987022112987 , 496.78442140096024 },
-  { 125.02590128315177 , 328.276499887336 },
-  { 597.1449543217791 , 536.5942337950331 },
-  { 228.1634029767096 , 417.6136445288659 },
-  { 489.3946682410428 , 347.98174238167053 },
-  { 624.6187957252658 , 447.7213663733129 },
-  { 706.1594569521907 , 431.92918782635013 },
-  { 234.87698569719373 , 517.61364452886585 }
-},
-{ //#16 50
-  { 592.2892374228375 , 250.28515665936266 },
-  { 512.3662403590071 , 216.4465610170546 },
-  { 453.8987335881809 , 150.20437938351998 },
-  { 429.04203022811254 , 342.6459826053167 },
-  { 696.2868255530063 , 14.4759153506199 },
-  { 284.2160863544927 , 54.4752054472643 },
-  { 376.12405872547254 , 42.429704520811626 },
-  { 557.2555249484229 , 102.58558381912968 },
-  { 467.05859098440953 , 355.36614589793993 },
-  { 660.612316308665 , 64.96678825473938 },
-  { 410.61841096108185 , 116.2137048015229 },
-  { 561.3384223886349 , 412.01518375729677 },
-  { 660.4775842442637 , 318.47350348078874 },
-  { 571.3021560213713 , 142.3159827519541 },
-  { 518.3619055660996 , 310.7688549260629 },
-  { 371.2015201905943 , 218.8982159119501 },
-  { 781.7651098536585 , 145.25696553904825 },
-  { 574.0034175498273 , 343.56196675560795 },
-  { 806.2098226168366 , 218.314510992928 },
-  { 374.8132152160923 , 295.4612984366371 },
-  { 746.0715095829433 , 227.39697199053137 },
-  { 722.4804599495001 , 276.63399560051816 },
-  { 274.0820741618743 , 254.11981706670605 },
-  { 885.3300072560849 , 141.90903682614288 },
-  { 633.1991533187547 , 124.37738199927374 },
-  { 723.5355662540713 , 407.30863983682733 },
-  { 465.5729820851156 , 111.99862998564238 },
-  { 331.9266244895592 , 291.0088054144966 },
-  { 491.06189055192914 , 24.743664069027943 },
-  { 474.5583115508364 , 256.5170114763404 },
-  { 845.0126544897731 , 56.17986288988719 },
-  { 316.21451981386843 , 138.4566222708575 },
-  { 670.5085736076638 , 398.6107746761645 },
-  { 686.510975691408 , 200.25196553904823 },
-  { 815.7960827616515 , 327.8859658360391 },
-  { 758.6709082900738 , 117.24145881034552 }
-},
-{ //#35 51
-  { 368.20520528554044 , 320.2996778108989 },
-  { 258.23195729528896 , 318.3800876268621 },
-  { 277.33152035687465 , 426.69909238067487 },
-  { 105.7990271277009 , 320.4569107471403 },
-  { 485.2034362088331 , 211.2867595281113 },
-  { 252.47552546812753 , 208.54082509920653 },
-  { 119.20343620883307 , 429.62706196616926 },
-  { 112.7907319719664 , 162.05704249034702 },
-  { 352.89755591094286 , 429.21926269178425 },
-  { 256.78832010213523 , 126.24780118160426 },
-  { 449.09697749920497 , 375.89505256088967 },
-  { 479.4143302655167 , 481.62422649714534 },
-  { 389.19228668700663 , 428.2688517183075 },
-  { 588.8017935370731 , 493.12131217195457 },
-  { 557.7328180812642 , 393.10127937066466 },
-  { 148.46931534832248 , 107.14823812001858 },
-  { 557.7328180812642 , 283.11127937066465 },
-  { 567.2562500156184 , 547.8178608936391 },
-  { 148.39269476763337 , 324.1365194540235 },
-  { 178.7100475339451 , 429.8656933902792 },
-  { 354.43137888355113 , 265.05587749596754 },
-  { 429.72953676935555 , 135.14044388828586 },
-  { 632.6946528926157 , 457.63355191514825 },
-  { 291.19047909152806 , 478.20326678466023 },
-  { 394.81419458254794 , 227.02250474399574 },
-  { 422.7060535918908 , 536.3867727195197 },
-  { 189.59567397744954 , 222.15556729022256 },
-  { 159.67291436358187 , 177.88497837242443 },
-  { 597.7076525158899 , 377.19195827405565 },
-  { 299.1671288205606 , 231.7418274350375 },
-  { 508.9704301426082 , 454.54105079739384 },
-  { 336.7327537667839 , 137.84061590978405 },
-  { 502.6946528926156 , 296.7503646329631 },
-  { 404.4493594378531 , 51.16731312058073 },
-  { 343.94580267611485 , 104.11579610238329 },
-  { 334.5110855834307 , 538.5466468470546 }
-},
-{ //#38  52
-  { 397.1206911163706 , 370.841368396373 },
-  { 440.7183665097814 , 259.1028690421144 },
-  { 571.199231395891 , 333.83983241402166 },
-  { 592.1863127973572 , 441.8090063214302 },
-  { 216.4568649286093 , 421.0107958397497 },
-  { 768.9091397304541 , 455.2000170244228 },
-  { 571.4185756992039 , 184.84564074345798 },
-  { 625.675814740181 , 365.53251153909747 },
-  { 361.5482152907524 , 302.5072781232466 },
-  { 481.4005225205959 , 324.1923305370161 },
-  { 290.84800610132993 , 218.2500498245902 },
-  { 482.5989754170228 , 440.06031820794465 },
-  { 724.8459659592099 , 368.9369206202296 },
-  { 800.1554685616879 , 372.2235002018875 },
-  { 513.0405690581154 , 375.04731858467045 },
-  { 768.4169692074294 , 288.62582480847664 },
-  { 524.2123488894289 , 116.20980016139879 },
-  { 656.3173791543605 , 306.7614987116601 },
-  { 530.8154178523534 , 538.91867536039 },
-  { 690.8571867479095 , 264.33021439292565 },
-  { 578.0570191757906 , 252.17572017885544 },
-  { 516.5567864492558 , 225.36252508850936 },
-  { 224.65437170483614 , 306.0919695746919 },
-  { 151.0566963114253 , 224.35347022043334 },
-  { 288.4848505343114 , 388.047595206148 },
-  { 726.6664280566521 , 160.33262626275678 },
-  { 791.3123791543605 , 211.50736454940971 },
-  { 392.5722234072742 , 438.14072802390774 },
-  { 646.5700126870788 , 218.67832797513773 },
-  { 114.81510917718056 , 300.33553774753057 },
-  { 296.7629820985316 , 334.14313989373886 },
-  { 664.9411184979072 , 461.1822963885468 },
-  { 640.7384149161837 , 535.080079718082 },
-  { 147.06791710012484 , 348.9601764477373 },
-  { 826.8269181230108 , 327.7339414104134 },
-  { 28.572927543645932 , 271.86803097670435 }
-},
-{ //#15  53
-  { 361.4502190881082 , 185.8515184750986 },
-  { 140.247239878292 , 147.83247063889957 },
-  { 246.97042978204672 , 239.54665076588938 },
-  { 306.7578684627058 , 86.93193359421328 },
-  { 439.1055970307374 , 346.0489130742302 },
-  { 548.2757482497664 , 332.64450399309794 },
-  { 484.59978821280754 , 153.12556799070705 },
-  { 272.28006786907923 , 182.4471093939664 },
-  { 262.27807915664437 , 348.4662356467747 },
-  { 476.9272736656912 , 262.8476378787851 },
-  { 368.60826891187844 , 263.74807481719944 },
-  { 342.71967279773696 , 423.4792352700489 },
-  { 465.70744738676456 , 75.15130928567612 },
-  { 501.7919656409068 , 432.3292974892591 },
-  { 609.3784202456181 , 409.4610906162137 },
-  { 682.9760956390289 , 491.1995899704723 },
-  { 574.6983215641537 , 90.03789575645546 },
-  { 180.14870652694577 , 234.74479840464804 },
-  { 225.40634005966407 , 412.915761830376 },
-  { 619.8884234047774 , 581.2981233218185 },
-  { 405.06913870781 , 448.93828678626653 },
-  { 343.9216369223631 , 358.2068768766841 },
-  { 516.2532687059321 , 517.8085792674798 },
-  { 163.076276452564 , 322.57483710618123 },
-  { 542.8654972105348 , 173.04786562777696 },
-  { 116.8831825417384 , 239.7988707799104 },
-  { 310.6410009082038 , 268.2663775507367 },
-  { 241.96271510276753 , 106.71793545771071 },
-  { 450.39979801216697 , 234.07089416656146 },
-  { 592.1721934358432 , 518.0969311982728 },
-  { 123.5994881584887 , 387.0737611032638 },
-  { 611.0742660101065 , 202.803750774566 },
-  { 388.4156757709122 , 133.5566891463758 },
-  { 614.3654206223439 , 329.01949697512117 },
-  { 375.6089140354183 , 62.06363705142459 },
-  { 532.8162306481381 , 251.98392514315242 }
-},
-{ //#9 54
-  { 405.39206992605386 , 441.9807125256651 },
-  { 268.2718852868056 , 365.57523835888003 },
-  { 564.7795331976102 , 343.47779820047435 },
-  { 497.6374456943711 , 382.0758650643623 },
-  { 543.2470399684365 , 277.23561656693977 },
-  { 653.2370399684365 , 347.23561656693977 },
-  { 602.9691098565146 , 254.9081311140561 },
-  { 537.6477400706556 , 561.0642528051856 },
-  { 644.6062870473347 , 237.79272537550276 },
-  { 340.5220399558177 , 330.43868787354216 },
-  { 560.7237340881974 , 414.8129785753589 },
-  { 387.53891234302483 , 288.98819283011073 },
-  { 432.0010592230613 , 335.2578855925683 },
-  { 596.5880021090796 , 531.5154479711651 },
-  { 763.0763024960921 , 352.9920483941012 },
-  { 437.7574910502227 , 545.0971481202239 },
-  { 723.7058501089203 , 169.47372062169 },
-  { 738.4473941571669 , 424.12708092562775 },
-  { 845.1702210902637 , 397.51809162862025 },
-  { 497.6374456943711 , 382.0758650643623 },
-  { 484.323529939761 , 627.2636743934477 },
-  { 432.68000375827154 , 225.2547277651679 },
-  { 331.52019433695165 , 379.9948489644756 },
-  { 218.30271137939707 , 306.5623197603462 },
-  { 709.8860778277934 , 252.95578516271445 },
-  { 139.18252674014883 , 462.9677939271313 },
-  { 315.8989463401125 , 455.67354045777313 },
-  { 215.58800090693387 , 383.847609287883 },
-  { 480.9987022112987 , 466.78442140096024 },
-  { 125.02590128315177 , 328.276499887336 },
-  { 547.1449543217791 , 456.5942337950331 },
-  { 228.1634029767096 , 417.6136445288659 },
-  { 489.3946682410428 , 347.98174238167053 },
-  { 624.6187957252658 , 447.7213663733129 },
-  { 706.1594569521907 , 431.92918782635013 },
-  { 434.87698569719373 , 587.61364452886585 }
-},
-{ //#17 55
-  { 557.2850394827071 , 472.9491779592183 },
-  { 583.880630401575 , 423.77902674018935 },
-  { 570.3644130104345 , 334.09423324402826 },
-  { 662.6097887787517 , 274.1893857827254 },
-  { 687.3521552460335 , 167.0184223569974 },
-  { 462.395239103026 , 355.08131464549444 },
-  { 707.346752150659 , 374.6702506688351 },
-  { 773.5403865471528 , 432.5121704189368 },
-  { 361.91437421691626 , 310.3443512735872 },
-  { 606.1736543191771 , 230.09664511385938 },
-  { 749.283091567955 , 276.47278011165622 },
-  { 428.36545460182185 , 558.256827333816 },
-  { 629.1841610478798 , 157.93671251519348 },
-  { 597.8694096128754 , 538.3857329674933 },
-  { 470.83395909780154 , 295.0367018989896 },
-  { 469.2335690308162 , 541.1795061577183 },
-  { 424.35017648894194 , 195.35190840282849 },
-  { 340.27719702609613 , 233.22894553503386 },
-  { 485.0428103395589 , 625.1770942878871 },
-  { 523.2085336413874 , 147.1354659674979 },
-  { 869.1574090381313 , 159.8563026992303 },
-  { 670.1459284362585 , 58.38258177493822 },
-  { 783.5515768342956 , 113.69421222610282 },
-  { 795.9069879809766 , 184.54570181220092 },
-  { 691.9093998508077 , 220.3549431209436 },
-  { 654.92488094561895 , 382.5042838722531 },
-  { 860.2632134802496 , 405.9031811219294 },
-  { 622.0668907938327 , 98.91902353216733 },
-  { 515.84255832782367 , 414.45667922462144 },
-  { 884.0324417204052 , 68.95724885419557 },
-  { 407.74628686355004 , 385.1352352503358 },
-  { 533.520327707971 , 211.94749932169626 },
-  { 471.9814992478409 , 464.65276948860554 },
-  { 414.3091755584639 , 443.3652868850043 },
-  { 546.9944988711151 , 545.0943631296981 },
-  { 623.9554387842356 , 472.79584449650365 }
-},
-{ //#24 56
-  { 214.36899603910234 , 202.84724300188904 },
-  { 149.71849613945324 , 291.8310222131895 },
-  { 89.8136486781504 , 344.0763979815067 },
-  { 216.44132307255006 , 358.44001151019694 },
-  { 106.0499912852896 , 213.74767994030336 },
-  { 297.37950276780504 , 130.68731040322314 },
-  { 344.2832428226518 , 384.63364590669073 },
-  { 348.1218384649599 , 327.7106488428604 },
-  { 397.6947092716439 , 84.20352779436362 },
-  { 120.08916463487701 , 146.19820514253217 },
-  { 244.76504710471787 , 312.3294444072507 },
-  { 305.66388317905245 , 63.21644639289748 },
-  { 192.7232940744929 , 116.03107426923414 },
-  { 230.01216169870736 , 150.03680078484027 },
-  { 232.7290028681559 , 11.70353119192268 },
-  { 407.37091505690336 , 294.53511255534454 },
-  { 458.0950864552114 , 272.7910586588235 },
-  { 426.0217421769104 , 458.2313213001015 },
-  { 267.9384087473593 , 427.8274747817533 },
-  { 154.07794384617745 , 41.59149891522823 },
-  { 548.7250052169362 , 143.40443195230716 },
-  { 369.1847375785932 , 470.8039916042885 },
-  { 432.37906676361627 , 204.0104396534379 },
-  { 537.77236053631236 , 237.9992188647384 },
-  { 326.208220756058 , 542.0503204355224 },
-  { 203.98263874965448 , 56.23346852657916 },
-  { 124.40999811434315 , 60.803094253508334 },
-  { 42.57231639343001 , 132.7773415205573 },
-  { 352.3759150569033 , 199.28097839309416 },
-  { 445.7589390923647 , 22.49193585364255 },
-  { 50.396757907662774 , 281.3918868710795 },
-  { 344.44984060087893 , 265.8456617983911 },
-  { 390.93362320973847 , 166.16086830223003 },
-  { 497.6564501428353 , 192.76985759923747 },
-  { 44.10469585592598 , 39.67190873119145 },
-  { 306.96576291261994 , 240.25876524633424 }
-},
-{ //#26 57
-  { 138.5025568324824 , 287.9785379686891 },
-  { 210.6624894311483 , 370.9890446973918 },
-  { 70.5673368924511 , 463.234420465709 },
-  { 205.91683699280202 , 552.2181996770095 },
-  { 317.3853163642451 , 344.3800554003843 },
-  { 250.07938020163587 , 473.673555807819 },
-  { 276.6170461822245 , 636.4754279756659 },
-  { 101.31013076549809 , 586.2069788883099 },
-  { 145.47267397433194 , 507.6623350191195 },
-  { 452.7795893910583 , 537.9307841064754 },
-  { 104.51377762118196 , 392.5852441959931 },
-  { 97.29957762266622 , 185.9975858048882 },
-  { 326.55146124857725 , 538.4736203801873 },
-  { 140.42214701651918 , 178.00528997843765 },
-  { 486.0906009903354 , 369.06684958051505 },
-  { 272.9475870746812 , 581.2600104125303 },
-  { 27.71245537208725 , 504.4684795340513 },
-  { 187.48318070303463 , 629.8222676177854 },
-  { 131.36777496448127 , 458.1850904269653 },
-  { 241.8593481927245 , 225.59733353307945 },
-  { 36.797171950112826 , 305.9119414067897 },
-  { 351.37409557554554 , 239.77334917308036 },
-  { 332.27453251395985 , 188.0923539268931 },
-  { 355.2633403100101 , 505.83151961027284 },
-  { 155.5853974956764 , 92.72077570864289 },
-  { 273.5994207128372 , 317.5480240357887 },
-  { 452.6204244067794 , 282.74986599561555 },
-  { 62.27545625076502 , 236.69299159521805 },
-  { 364.7785046566777 , 348.94350039210934 },
-  { 219.9291966326435 , 259.1438525166847 },
-  { 300.20841000984467 , 424.27085096888555 },
-  { 185.08905259179892 , 394.01547065413735 },
-  { 48.17677124820199 , 118.10044251713481 },
-  { 402.68600934042666 , 380.7516735910941 },
-  { 393.91187696034937 , 557.7926896649459 },
-  { 40.90137023164668 , 629.9526222636118 }
-},
-{ //#28 58
-  { 306.59454125679355 , 374.038575776704 },
-  { 203.2377498965515 , 439.65737134109435 },
-  { 426.10595676959676 , 284.0709167363831 },
-  { 148.24274989655146 , 296.40323717884394 },
-  { 282.7549946289536 , 109.79108533215776 },
-  { 217.4616997081231 , 381.88152147949614 },
-  { 65.23224316784878 , 224.24330458017803 },
-  { 158.509053264094 , 165.95748470716774 },
-  { 8.748460558989194 , 104.55851108401694 },
-  { 48.02601635807377 , 115.60746399811885 },
-  { 46.3838868815187 , 491.74343128349943 },
-  { 516.0403718359495 , 186.0691091409045 },
-  { 416.01361982620097 , 184.14951895686758 },
-  { 206.48242023286488 , 228.65575904924782 },
-  { 120.2272431678488 , 128.98917041792765 },
-  { 109.14269495431034 , 400.9810845410818 },
-  { 258.11959742368504 , 475.7711647878012 },
-  { 88.33790243524865 , 44.15786141052675 },
-  { 407.0754061429032 , 398.7755391486113 },
-  { 469.42829741815694 , 122.07447966108855 },
-  { 377.03482603317894 , 133.14204747280087 },
-  { 346.74058102537197 , 270.32633743956086 },
-  { 355.2350031622384 , 357.4083419786213 },
-  { 531.37373158593545 , 300.7661647878012 },
-  { 258.8341450261745 , 294.70494972296365 },
-  { 58.144216545205225 , 333.3155649445924 },
-  { 305.1572891506048 , 28.9078076353558 },
-  { 316.204490120943 , 220.98324450213153 },
-  { 492.4059665879664 , 402.15070844590304 },
-  { 562.0907600841275 , 355.66692583704344 },
-  { 127.36316635677692 , 484.96919371374776 },
-  { 197.55685224682026 , 118.67957710987453 },
-  { 9.212923455790687 , 316.4857977507811 },
-  { 356.5289563231463 , 452.0403833721826 },
-  { 421.8840410215953 , 471.6881733828466 },
-  { 458.5576916943097 , 312.924128590255 }
-},
-{ //#1 59
-  { 264.359521649183 , 403.9465939133772 },
-  { 559.6136558114334 , 308.95159391337717 },
-  { 469.5366528752637 , 352.79018955568523 },
-  { 154.38627365893154 , 402.0270037293404 },
-  { 245.57211626426056 , 340.52137627659295 },
-  { 354.74226748328954 , 327.1169671954607 },
-  { 53.905408772821886 , 446.7639671012478 },
-  { 221.10910059202837 , 228.6359930263479 },
-  { 196.63164942724873 , 461.9318511906432 },
-  { 354.74226748328954 , 467.1069671954607 },
-  { 405.0596202496013 , 221.387793259205 },
-  { 656.6216494272487 , 461.9318511906432 },
-  { 454.6234570227273 , 411.9974361242904 },
-  { 288.8601986613392 , 274.71200339009965 },
-  { 188.375052870232 , 297.4202975020365 },
-  { 426.35371931532677 , 539.6043657377595 },
-  { 288.8601986613392 , 164.72200339009964 },
-  { 494.0403477932149 , 554.6819472347177 },
-  { 246.63164942724873 , 571.9218511906432 },
-  { 680.56711626426056 , 435.7755104388433 },
-  { 421.05040056491276 , 271.3024264650213 },
-  { 463.94017392003803 , 492.4725726108048 },
-  { 380.5528736639633 , 417.4406894553343 },
-  { 109.64931028702429 , 502.5078686154501 },
-  { 137.19608230372125 , 195.0594850197247 },
-  { 318.93302617454685 , 223.1193790652918 },
-  { 569.18871424602247 , 400.2344626455593 },
-  { 347.0697529361732 , 546.8290370835388 },
-  { 567.2969652802801 , 454.8537770464145 },
-  { 677.69890939121524 , 543.3619650435546 },
-  { 309.71932166150026 , 662.0203845419894 },
-  { 142.95251413088266 , 564.8987475473803 },
-  { 270.1135522244906 , 471.0179728954473 },
-  { 185.81591029205606 , 517.921554341444 },
-  { 350.79375769713204 , 636.7979843739832 },
-  { 377.218846047557 , 129.8425689690465 }
-},
-{ //#2 60
-  { 486.7567544294248 , 370.05881602380447 },
-  { 398.91483467932306 , 303.8651816273107 },
-  { 552.9503888259186 , 457.9007357739062 },
-  { 652.6351823220797 , 504.38451838276575 },
-  { 445.7794254001906 , 433.1583693066245 },
-  { 596.5960169570803 , 195.8152478509659 },
-  { 703.7669803828084 , 131.07288138368415 },
-  { 688.1343489342929 , 225.74277197145244 },
-  { 790.4402831720116 , 153.35627571261494 },
-  { 306.1674718001914 , 385.4015079957808 },
-  { 898.4094570794202 , 304.34335711408113 },
-  { 798.7246635832591 , 257.85957450522164 },
-  { 358.3436825986147 , 441.8895149852067 },
-  { 778.3274043988573 , 468.41201472448347 },
-  { 861.1404923614341 , 199.09904741395854 },
-  { 652.6351823220797 , 411.4169531650466 },
-  { 798.7246635832591 , 367.84957450522165 },
-  { 445.9762686843947 , 541.93640636794623 },
-  { 813.7402283730598 , 599.15329119964724 },
-  { 473.35234534829266 , 479.2289672428335 },
-  { 710.8827438331574 , 324.05320890171544 },
-  { 321.535857227352 , 323.3191067789689 },
-  { 889.750588060633 , 452.7473411919456 },
-  { 887.7494816584415 , 92.37622048086169 },
-  { 712.5400297833825 , 412.13914261444853 },
-  { 730.6510249990474 , 561.0663459457584 },
-  { 596.5960169570803 , 364.302384196643 },
-  { 853.9454425918032 , 512.9234877694124 },
-  { 755.9919736823217 , 542.003313947156 },
-  { 522.0284810285498 , 224.670556777095 },
-  { 876.2495244807543 , 387.35386384278377 },
-  { 944.1509990901368 , 271.2589800126244 },
-  { 728.2477168852757 , 197.41944877643107 },
-  { 625.8670766708578 , 534.5935538409253 },
-  { 619.4642238301255 , 268.22879324625455 },
-  { 457.27651107499975 , 303.7709060350681 }
-},
-{ //#13 61
-  { 379.1842197583593 , 415.3505996388179 },
-  { 352.57523046135185 , 512.0734265719148 },
-  { 415.6629026956034 , 602.1719599232609 },
-  { 694.49186913295694 , 534.2701845197032 },
-  { 205.9889548077661 , 404.8827212481468 },
-  { 247.96852423404792 , 478.08464736061427 },
-  { 442.27189199261085 , 315.25206628747173 },
-  { 712.6856318477959 , 424.82352113058283 },
-  { 465.1400988656562 , 422.838520892183 },
-  { 647.9932812223935 , 315.9039362496975 },
-  { 298.2924475446948 , 460.9459743888086 },
-  { 178.2268626110476 , 558.9477819842872 },
-  { 682.99478345814777 , 623.6576477912596 },
-  { 371.67479352293753 , 620.3924313257276 },
-  { 304.74262597653217 , 361.90620442561163 },
-  { 438.4070210775785 , 206.3324814065864 },
-  { 490.4883344279415 , 216.39370913502637 },
-  { 623.2754396507743 , 427.81619827325835 },
-  { 560.3942330279066 , 367.84352089218294 },
-  { 330.08801632376577 , 225.43204446817205 },
-  { 430.52766804534207 , 510.0074812389571 },
-  { 351.08604938728183 , 253.7464388347243 },
-  { 788.08639496617184 , 533.3903691589514 },
-  { 405.01676439985823 , 164.6576074184636 },
-  { 478.2489176203981 , 568.6626477912596 },
-  { 636.8108432568626 , 252.0410337651795 },
-  { 549.89071935092466 , 472.65653580142714 },
-  { 539.7545450731456 , 649.8484903965887 },
-  { 384.69850522456363 , 347.8255212689088 },
-  { 598.0403649461557 , 566.5716803003434 },
-  { 777.00258878916424 , 611.6391646137948 },
-  { 547.4558521009851 , 283.09410248501797 },
-  { 344.4833273550186 , 313.6968786428178 },
-  { 280.1264880365017 , 583.2686074689885 },
-  { 725.2823987213135 , 243.09213368880583 },
-  { 507.511052446285 , 167.7838054665231 }
-},
-{ //#36 62
-  { 233.10056514679573 , 282.8229159426349 },
-  { 291.3863850198059 , 189.5461058463896 },
-  { 310.87524000950407 , 360.59759080534326 },
-  { 395.9930912471099 , 155.5573266350891 },
-  { 606.07708196933095 , 354.0692447738688 },
-  { 587.63026843793 , 252.67273237364248 },
-  { 239.7492078289858 , 92.43070010783622 },
-  { 201.153170121426 , 368.2701053524596 },
-  { 348.2370145679968 , 467.07975150257147 },
-  { 186.61678253793616 , 183.1381224464738 },
-  { 241.99483293446218 , 438.61224473174525 },
-  { 437.196070456926 , 257.5382787988901 },
-  { 100.0128929125442 , 372.92144929398114 },
-  { 695.4330015256513 , 311.6210674931027 },
-  { 623.23460269816565 , 431.2705101938287 },
-  { 475.4723046354761 , 147.4887722652682 },
-  { 416.1233483917132 , 89.06524096027994 },
-  { 152.93672768609537 , 467.128462504905 },
-  { 566.49082182451605 , 493.6406996169799 },
-  { 110.39437512339438 , 215.86062743343604 },
-  { 342.9398276744513 , 288.5793477697963 },
-  { 134.02565902705362 , 289.59932613321143 },
-  { 516.43468488820247 , 230.5703262583633 },
-  { 501.1770513554842 , 337.7412896840913 },
-  { 431.1848496682265 , 362.14498502619404 },
-  { 323.2269288671589 , 87.58392480396537 },
-  { 480.189969954018 , 445.7104635914999 },
-  { 347.17879304283645 , 406.4542809292915 },
-  { 693.41759257220502 , 402.3914991329977 },
-  { 254.18305651732928 , 510.1049793274402 },
-  { 150.18546838716043 , 545.9142206361829 },
-  { 416.18984966822654 , 457.39911918844444 },
-  { 408.0300373553521 , 528.7209703202026 },
-  { 558.3497822668924 , 374.38861245974175 },
-  { 647.72400687071786 , 468.929597498057 },
-  { 101.96902595182976 , 447.05586348373754 }
-},
-{ //#32 63
-  { 397.66873515066965 , 332.2472513236217 },
-  { 403.42516697783105 , 442.0865138512772 },
-  { 513.703097089753 , 434.4139993041609 },
-  { 288.7491502697843 , 316.9396019490241 },
-  { 288.7491502697843 , 216.9396019490241 },
-  { 413.32663362648486 , 505.1741860855288 },
-  { 396.71832417719287 , 245.952520547558 },
-  { 446.6527392435456 , 197.95071295207936 },
-  { 76.1362419214959 , 226.0050696900871 },
-  { 296.42240631943577 , 375.22376814615694 },
-  { 510.3934702201523 , 296.7052788795096 },
-  { 240.53270783445367 , 415.7979591014695 },
-  { 310.909323899528 , 543.0498398862202 },
-  { 452.40917107070703 , 88.11145042442377 },
-  { 259.27214670870785 , 105.9344341476668 },
-  { 344.0901663168943 , 107.21101348600942 },
-  { 249.93862371057625 , 534.9085616423181 },
-  { 218.6477314567274 , 297.4490932834486 },
-  { 357.30143340670526 , 193.2680094371308 },
-  { 101.3625566154247 , 342.3935500203373 },
-  { 190.34630572951093 , 472.0327948685513 },
-  { 555.0936821811342 , 127.52834119491135 },
-  { 522.9357183786805 , 232.71230130328564 },
-  { 301.11364949435904 , 5.96468465477552 },
-  { 74.30033460252054 , 436.3270129531234 },
-  { 300.3195537197624 , 473.952385052588 },
-  { 441.17452040858075 , 382.18356318016185 },
-  { 598.3912385978042 , 298.54838834549014 },
-  { 318.30738269716204 , 623.5726339641778 },
-  { 620.6366143661214 , 211.6435408841873 },
-  { 164.3944327325868 , 240.1110476550136 },
-  { 101.36252651821047 , 536.6832947682004 },
-  { 505.9877399044824 , 351.3468143852074 },
-  { 150.9531419548951 , 426.8348710860812 },
-  { 175.6955084221768 , 319.6639076603532 },
-  { 217.705405578659 , 187.9833466401494 }
-},
-{ //#23 64
-  { 455.95018614022257 , 83.46432225101717 },
-  { 368.10826639012083 , 149.65795664751096 },
-  { 398.42561915643256 , 255.38713058376663 },
-  { 124.8697710211079 , 68.15667287641952 },
-  { 506.0120737611438 , 278.25533745681196 },
-  { 587.7505731154024 , 204.65766206340118 },
-  { 531.1015352560455 , 110.37783065917587 },
-  { 446.6420615917632 , 156.52877343132127 },
-  { 321.62448378126135 , 249.3427501436721 },
-  { 201.25465573070454 , 280.1294970510483 },
-  { 735.1484460895294 , 281.9961198807741 },
-  { 646.3947749207633 , 324.97263670330926 },
-  { 525.1116368227295 , 169.9363327029992 },
-  { 323.54407396529814 , 139.36950215342063 },
-  { 448.1081499426764 , 8.64828235939143 },
-  { 799.7343523267028 , 140.007162163752 },
-  { 669.0618377795864 , 30.28509227567396 },
-  { 222.105348667371 , 204.60578677176485 },
-  { 596.2927586856102 , 64.99416254047782 },
-  { 205.4982239035431 , 130.2902345233927 },
-  { 326.90529541405385 , 76.49124821528704 },
-  { 488.80584695136884 , 386.89117803887115 },
-  { 305.14880906018726 , 313.67295045677685 },
-  { 671.0452748204125 , 413.95641591460975 },
-  { 746.7750208587775 , 365.904096637405 },
-  { 565.1203373592516 , 470.05991316988492 },
-  { 717.278280214917 , 129.14344942811934 },
-  { 696.7736235717199 , 209.73112591238507 },
-  { 572.1869176679671 , 365.7399734792792 },
-  { 411.8716359932841 , 487.0639611597694 },
-  { 374.3677588717589 , 399.15123475742905 },
-  { 548.1955619085397 , 23.55947478971435 },
-  { 642.89501222196 , 147.83458803259327 },
-  { 411.8716359932841 , 340.2819397537843 },
-  { 766.831402490599 , 40.76570159948935 },
-  { 237.28178146821242 , 71.43187737094736 }
-},
-{ //#44  65
-  { 403.31425668574076 , 330.1125520341365 },
-  { 332.6140474963183 , 414.3697803327929 },
-  { 501.3160642812193 , 280.17813696778376 },
-  { 579.0907391439276 , 202.4034621050754 },
-  { 688.8128090320057 , 210.07597665219174 },
-  { 796.7819829394143 , 189.08889525072559 },
-  { 821.524349406696 , 296.25985867645363 },
-  { 802.5384147665757 , 8.92815777838115 },
-  { 858.2876103921618 , 280.2747378560546 },
-  { 903.024573764069 , 380.7556027421643 },
-  { 226.37186586278364 , 385.9022735619667 },
-  { 931.3636119343516 , 290.50342684929217 },
-  { 399.7165812923299 , 448.37405267987793 },
-  { 305.3124490902622 , 380.04696710048927 },
-  { 713.9378948019847 , 469.12806554949896 },
-  { 1021.4621452856978 , 353.5910990835437 },
-  { 596.5674332636885 , 269.9808241134945 },
-  { 614.8999804526702 , 98.40587397490653 },
-  { 521.6231703564249 , 40.120054101896336 },
-  { 920.7432992182677 , 101.73814297710584 },
-  { 248.35681919766188 , 473.6695711433705 },
-  { 216.3286698789617 , 315.39646720084016 },
-  { 355.0978142504101 , 201.25419488169115 },
-  { 630.338506801367 , 357.76548612920107 },
-  { 193.3618191976619 , 438.9237053056209 },
-  { 842.5114308081622 , 404.2290325838622 },
-  { 875.7151080979534 , 192.26227054628478 },
-  { 631.345240244503 , 32.44753955478005 },
-  { 462.1543372373153 , 220.2697083970536 },
-  { 730.7201080979534 , 287.5164047085352 },
-  { 688.478202415484 , 100.9063764302662 },
-  { 759.527908037873 , 371.088090377047 },
-  { 393.34689037381077 , 261.16521836924994 },
-  { 702.2526013271271 , 393.75858634206986 },
-  { 834.4007785038045 , 85.73210389048351 },
-  { 307.232039274299 , 270.0737191102378 }
-},
-{ //#41 66
-  { 397.45709725455947 , 395.1796262888525 },
-  { 311.97881295390727 , 325.96067647728086 },
-  { 366.97381295390727 , 230.70654231503045 },
-  { 236.96581333063307 , 406.4022701183734 },
-  { 534.2041380911989 , 403.7353513399892 },
-  { 344.1328871236649 , 491.37904787711466 },
-  { 395.5375070705227 , 285.206378298601 },
-  { 505.25957695860075 , 292.87889284571736 },
-  { 642.7598631423357 , 240.4823921766286 },
-  { 244.44809362750374 , 444.8952652682551 },
-  { 296.0840732732302 , 184.28297058836642 },
-  { 421.95206094415875 , 327.88026666131765 },
-  { 340.4463197247335 , 575.267844569163 },
-  { 531.6741308322368 , 335.552781208434 },
-  { 236.1792258119274 , 52.037594820049236 },
-  { 344.148399719336 , 31.05051341858309 },
-  { 221.57988675445833 , 337.30881066354385 },
-  { 489.7024730228767 , 455.0844737501553 },
-  { 635.0309221924788 , 373.1715767728243 },
-  { 132.59610754315787 , 272.65831076389475 },
-  { 496.3992797770691 , 190.76675319722597 },
-  { 56.1890914260771 , 354.5676353797405 },
-  { 128.2059119939691 , 406.4277584974289 },
-  { 210.3707824058662 , 194.88363590118638 },
-  { 292.5112225285159 , 128.16591915713647 },
-  { 241.76625876218685 , 259.2539016827625 },
-  { 391.17422581192744 , 147.29172898229962 },
-  { 96.71448628090798 , 237.2505358060855 },
-  { 133.609021970391 , 444.0210656827637 },
-  { 46.780071214555214 , 139.24872821060694 },
-  { 167.74686351906143 , 160.04079853553606 },
-  { 134.93289698069353 , 95.0141116425845 },
-  { 339.9333120274546 , 434.05270410630095 },
-  { 245.37687541969711 , 541.1701249647106 },
-  { 584.9983409631313 , 239.35335962017183 },
-  { 390.8441158704313 , 503.3009161854859 }
-},
-{ //#18 67
-  { 353.4327064933044 , 269.1873176879695 },
-  { 267.9544221926522 , 199.96836787639785 },
-  { 330.5644996202591 , 376.77377229268075 },
-  { 431.04536450636874 , 421.510735664588 },
-  { 435.171205847563 , 342.7849930813803 },
-  { 543.8070464296222 , 325.5787662716053 },
-  { 377.3418854642086 , 188.4712822015887 },
-  { 180.11250244255046 , 266.16200227289164 },
-  { 319.4439272820039 , 164.5806114606655 },
-  { 109.412293253128 , 350.41923057154804 },
-  { 582.8854319077028 , 504.5212423932907 },
-  { 282.4799577409177 , 425.4010577540424 },
-  { 374.39632664701185 , 515.7905670688133 },
-  { 223.84167268716223 , 350.1647829956733 },
-  { 442.56071759838835 , 282.6022494490701 },
-  { 251.7144684819748 , 529.2636088605724 },
-  { 46.06699782445384 , 272.39010813296494 },
-  { 252.16260497460598 , 53.1302316902982 },
-  { 214.76335206984857 , 138.72775496483905 },
-  { 331.36057101020765 , 467.9945182734475 },
-  { 255.45446109601022 , 283.88719380777417 },
-  { 334.1171349317378 , 58.28565201548906 },
-  { 143.39546372816204 , 548.363171922158 },
-  { 612.0968043635552 , 389.8361213420356 },
-  { 602.85459128569607 , 458.1339569030819 },
-  { 520.43424247565576 , 443.26585796749 },
-  { 93.0153287580405 , 463.8903887302432 },
-  { 507.33113844622886 , 239.7744863526776 },
-  { 640.9224521681756 , 273.94158908078515 },
-  { 202.93832582187082 , 460.0517930879352 },
-  { 305.1773768354402 , 601.2688513694656 },
-  { 468.66416007075907 , 524.86752702483 },
-  { 18.6267962477232 , 439.1650755092262 },
-  { 168.61541676774127 , 375.549465544448 },
-  { 437.24673292551137 , 96.22590643327146 },
-  { 453.16526331192813 , 561.1702802526476 }
-},
-{ //#38 68
-  { 397.1206911163706 , 370.841368396373 },
-  { 470.7183665097814 , 289.1028690421144 },
-  { 571.199231395891 , 333.83983241402166 },
-  { 592.1863127973572 , 441.8090063214302 },
-  { 546.4568649286093 , 441.0107958397497 },
-  { 748.9091397304541 , 465.2000170244228 },
-  { 541.4185756992039 , 204.84564074345798 },
-  { 615.675814740181 , 355.53251153909747 },
-  { 361.5482152907524 , 302.5072781232466 },
-  { 491.4005225205959 , 314.1923305370161 },
-  { 290.84800610132993 , 218.2500498245902 },
-  { 482.5989754170228 , 440.06031820794465 },
-  { 724.8459659592099 , 368.9369206202296 },
-  { 800.1554685616879 , 372.2235002018875 },
-  { 563.0405690581154 , 365.04731858467045 },
-  { 718.4169692074294 , 298.62582480847664 },
-  { 524.2123488894289 , 96.20980016139879 },
-  { 656.3173791543605 , 306.7614987116601 },
-  { 530.8154178523534 , 538.91867536039 },
-  { 690.8571867479095 , 244.33021439292565 },
-  { 578.0570191757906 , 252.17572017885544 },
-  { 516.5567864492558 , 265.36252508850936 },
-  { 224.65437170483614 , 306.0919695746919 },
-  { 151.0566963114253 , 224.35347022043334 },
-  { 288.4848505343114 , 388.047595206148 },
-  { 726.6664280566521 , 160.33262626275678 },
-  { 711.3123791543605 , 71.50736454940971 },
-  { 392.5722234072742 , 438.14072802390774 },
-  { 846.5700126870788 , 248.67832797513773 },
-  { 114.81510917718056 , 300.33553774753057 },
-  { 556.7629820985316 , 34.14313989373886 },
-  { 664.9411184979072 , 461.1822963885468 },
-  { 640.7384149161837 , 535.080079718082 },
-  { 117.06791710012484 , 328.9601764477373 },
-  { 826.8269181230108 , 327.7339414104134 },
-  { 8.572927543645932 , 271.86803097670435 }
-},
-{ //#31 69
-  { 119.09511685454868 , 329.3390409236428 },
-  { 217.95347400699407 , 281.12259848831224 },
-  { 187.63612124068234 , 386.8517724245679 },
-  { 278.8219638460114 , 448.35739987731534 },
-  { 608.51593660143409 , 463.257246591353 },
-  { 320.6379851174213 , 241.70570771782462 },
-  { 345.0155982425052 , 536.199319627417 },
-  { 520.9132943075855 , 413.46076172157535 },
-  { 112.35453224374221 , 53.3342495275227 },
-  { 231.35788308812627 , 171.95244726928325 },
-  { 269.2357037011964 , 338.78594503420425 },
-  { 42.3223022049403 , 375.4153268412513 },
-  { 246.15724109005978 , 487.98287719208645 },
-  { 322.560180234298 , 315.1113776996127 },
-  { 217.90339987299046 , 451.7601609165438 },
-  { 473.21651063508682 , 180.64173360220258 },
-  { 109.50885670973375 , 438.9104957667539 },
-  { 511.30970979165909 , 354.6214060092938 },
-  { 72.21014673007342 , 246.30240125548107 },
-  { 31.91293860264966 , 428.34724915079687 },
-  { 189.83818463471093 , 593.0078997769645 },
-  { 663.36346789983475 , 379.34703661002726 },
-  { 164.45552249839062 , 186.39755379417826 },
-  { 396.0020604170615 , 463.54099089017916 },
-  { 422.2449737304591 , 268.6275950907531 },
-  { 623.67364260276874 , 224.4735606289554 },
-  { 110.43552678547088 , 573.2304945816045 },
-  { 75.15686248042414 , 523.3000242492309 },
-  { 351.79274669767932 , 404.9714267183427 },
-  { 345.380351584703 , 134.5347442920966 },
-  { 536.8410009522559 , 494.1103099423562 },
-  { 161.292438167159 , 121.11676926871333 },
-  { 527.3409372785504 , 269.62551281350306 },
-  { 135.90829430758552 , 508.71489588382576 },
-  { 268.9748774179179 , 213.65492893134487 },
-  { 442.31864544775163 , 378.0598801282561 }
-},
-{ //#18 70
-  { 353.4327064933044 , 269.1873176879695 },
-  { 267.9544221926522 , 199.96836787639785 },
-  { 330.5644996202591 , 356.77377229268075 },
-  { 431.04536450636874 , 421.510735664588 },
-  { 435.171205847563 , 342.7849930813803 },
-  { 543.8070464296222 , 325.5787662716053 },
-  { 377.3418854642086 , 188.4712822015887 },
-  { 180.11250244255046 , 266.16200227289164 },
-  { 319.4439272820039 , 164.5806114606655 },
-  { 109.412293253128 , 350.41923057154804 },
-  { 582.8854319077028 , 504.5212423932907 },
-  { 282.4799577409177 , 425.4010577540424 },
-  { 374.39632664701185 , 485.7905670688133 },
-  { 223.84167268716223 , 350.1647829956733 },
-  { 442.56071759838835 , 282.6022494490701 },
-  { 251.7144684819748 , 509.2636088605724 },
-  { 46.06699782445384 , 272.39010813296494 },
-  { 252.16260497460598 , 53.1302316902982 },
-  { 214.76335206984857 , 138.72775496483905 },
-  { 331.36057101020765 , 427.9945182734475 },
-  { 255.45446109601022 , 283.88719380777417 },
-  { 334.1171349317378 , 58.28565201548906 },
-  { 143.39546372816204 , 528.363171922158 },
-  { 612.0968043635552 , 389.8361213420356 },
-  { 602.85459128569607 , 458.1339569030819 },
-  { 520.43424247565576 , 443.26585796749 },
-  { 93.0153287580405 , 463.8903887302432 },
-  { 507.33113844622886 , 239.7744863526776 },
-  { 620.9224521681756 , 273.94158908078515 },
-  { 202.93832582187082 , 460.0517930879352 },
-  { 305.1773768354402 , 571.2688513694656 },
-  { 468.66416007075907 , 524.86752702483 },
-  { 18.6267962477232 , 439.1650755092262 },
-  { 168.61541676774127 , 375.549465544448 },
-  { 437.24673292551137 , 116.22590643327146 },
-  { 453.16526331192813 , 561.1702802526476 }
-},
-{ //05/25/2014 #71
-  { 713.103843508642 , 456.36082306531733 },
-  { 637.4676199567978 , 367.32425344985415 },
-  { 890.7068513316036 , 359.57599793232055 },
-  { 484.7068513316036 , 513.145648198314 },
-  { 335.598843508642 , 345.43681592198914 },
-  { 634.7128564308889 , 459.0718007135074 },
-  { 719.1791935949844 , 262.3855592104284 },
-  { 735.7357176109778 , 555.7156052774791 },
-  { 355.0878884427464 , 273.04388746674096 },
-  { 587.3429844654175 , 510.59996402209293 },
-  { 458.3939058727484 , 241.22939546116675 },
-  { 693.3763148045596 , 156.1051932273152 },
-  { 774.8154171468286 , 173.34898959496525 },
-  { 557.0651836282386 , 316.62814817101406 },
-  { 394.5642800767171 , 426.6281064740817 },
-  { 836.6328038423081 , 417.8992962478342 },
-  { 684.2798452485421 , 612.0897267913308 },
-  { 431.3351656818929 , 332.9658570765656 },
-  { 826.3158642538506 , 535.8566258465041 },
-  { 857.837521851297 , 598.2942540581904 },
-  { 644.4102165192056 , 277.2982019282774 },
-  { 877.0522341290609 , 205.3207006134048 },
-  { 534.9759505273822 , 392.4921631198899 },
-  { 874.0854123990009 , 139.16758905850827 },
-  { 926.4958501076095 , 262.3855592104285 },
-  { 744.6397043088893 , 636.5131016199896 },
-  { 530.1611399375563 , 204.50218540435355 },
-  { 785.7326418126453 , 326.072973195269 },
-  { 817.709199548552 , 457.13046141433074 },
-  { 622.5353890310128 , 221.3626980303396 },
-  { 783.8301656818929 , 242.04184993323742 },
-  { 642.2178564308889 , 549.9958078568357 },
-  { 900.8708204244467 , 520.75151286863115 },
-  { 716.993926000122 , 378.40430632911705 },
-  { 758.509139837721 , 75.04052631946143 },
-  { 462.9911055943528 , 420.25643576434425 }
-},
-{ //#72
-  { 601.2517353278428 , 301.50962757217013 },
-  { 648.9161978954978 , 207.96285259763337 },
-  { 501.8755431529439 , 149.25318966223966 },
-  { 656.2399300738934 , 103.22860296085446 },
-  { 761.0860449277761 , 508.72335500680113 },
-  { 763.385158029578 , 175.10574381123871 },
-  { 966.4461960197482 , 105.13878023582215 },
-  { 450.1639695147571 , 64.31449542281395 },
-  { 413.1331356679614 , 347.082968584367123 },
-  { 324.9479533583203 , 173.3510687278361 },
-  { 744.8293354933945 , 250.66613275416162 },
-  { 543.9421883810282 , 206.130524445783 },
-  { 722.8811133063448 , 85.10574381123874 },
-  { 874.9777125229452 , 419.033395954916244 },
-  { 741.1652373345989 , 355.5921756828965 },
-  { 631.4215620297746 , 492.02166282379285 },
-  { 328.7966955581855 , 286.53562800856963 },
-  { 525.9668483051819 , 360.59486140592716 },
-  { 809.5571901525352 , 110.78036746345063 },
-  { 502.59340707153024 , 265.60093272440815 },
-  { 407.44015251055237 , 221.23024142425214 },
-  { 770.4529757150879 , 9.582258173683755 },
-  { 236.613437033402 , 218.7763785510004 },
-  { 700.2388541407422 , 489.8166141852383 },
-  { 888.4695846930291 , 347.207309196444825 },
-  { 542.5165354099813 , 432.070704528056936 },
-  { 536.9163140757213 , 536.86777767767555 },
-  { 405.2038071327707 , 119.4744988596405 },
-  { 552.2716855367161 , 88.61681909105714 },
-  { 440.0516695942104 , 422.69749411371179 },
-  { 900.1737904105152 , 265.79263151976085 },
-  { 778.5213517981641 , 411.05121312154459 },
-  { 947.1792476284228 , 434.24796393899865 },
-  { 892.9688527746216 , 170.00005198058324 },
-  { 824.7524616080616 , 310.50512363024785 },
-  { 644.5214327706273 , 396.6150368629854 }
-},
-{ //#73
-  { 350.18099961102865 , 413.10211088431936 },
-  { 679.28083758136574 , 251.2757878317542 },
-  { 529.02881521974922 , 243.2530126048826 },
-  { 619.20655625255773 , 308.6872570896044 },
-  { 368.4123217842797 , 516.4970768730711 },
-  { 194.30682806689623 , 319.4434596799038 },
-  { 470.7114348860815 , 540.1146880686335 },
-  { 296.1781763686131 , 294.04407986089467 },
-  { 395.5857333295934 , 155.08452437098185 },
-  { 117.52200293389953 , 391.04646750286554 },
-  { 252.09918529513806 , 400.3278107603443 },
-  { 90.34859138858589 , 89.63391500077626 },
-  { 379.16167884501954 , 311.38712549189836 },
-  { 298.1836950724689 , 95.33106165357606 },
-  { 8.756036895218529 , 423.56156714445382 },
-  { 621.11316573321614 , 426.2497973462237 },
-  { 172.47817964793964 , 216.74774307886156 },
-  { 193.24122082035082 , 97.8681056251482 },
-  { 444.14138285001374 , 239.69442867771335 },
-  { 712.087609091687 , 341.8349435515087 },
-  { 213.54539677802802 , 512.5978126324063 },
-  { 520.0012542629722 , 622.8153558428922 },
-  { 26.597995790571332 , 338.55146750286553 },
-  { 78.93140467340288 , 169.0832805112066 },
-  { 295.22969352346036 , 548.3826256671305 },
-  { 39.55090149736138 , 248.84491010879003 },
-  { 37.84184100134169 , 35.996757323431325 },
-  { 450.58343593958773 , 443.7982161631595 },
-  { 117.52200293389954 , 391.04646750286554 },
-  { 366.37996779787136 , 110.09980959169366 },
-  { 516.3357266303581 , 320.44791793175176 },
-  { 313.8071764335486 , 206.8159087878875 },
-  { 117.5208612471354 , 309.6123015156387 },
-  { 117.573676724233 , 479.09693247040656 },
-  { 546.833434931917 , 402.00407858194865 },
-  { 266.02495462247634 , 169.0832805112065 }
-},
-{ //74
-  { 409.26926096127374 , 139.03011841756233 },
-  { 514.0035105980527 , 131.70638623916668 },
-  { 359.9794415843831 , 231.7307861918211 },
-  { 464.9054845131179 , 428.06668803302554 },
-  { 464.39429537909814 , 242.70522955029202 },
-  { 618.593991950705 , 530.8568676702433 },
-  { 760.0758584543751 , 353.29894073253405 },
-  { 569.1014150959041 , 317.7137945272491 },
-  { 674.5811064084284 , 38.45282587865135 },
-  { 311.2702597723093 , 315.59111730702224 },
-  { 762.7715750554173 , 191.47029231357743 },
-  { 371.69362760483943 , 393.41541017340134 },
-  { 666.4464479868711 , 357.0437407699857 },
-  { 599.9804862274375 , 6.581477576934475 },
-  { 501.9638772494963 , 44.206528599695545 },
-  { 818.2012530662413 , 265.88747147468393 },
-  { 201.04101179293224 , 4.14569458692233 },
-  { 559.547549940076 , 219.33453825013592 },
-  { 738.2750964058276 , 274.34802416894343 },
-  { 279.8673045522743 , 142.51524814373843 },
-  { 268.89286119380336 , 38.10039434902342 },
-  { 153.2272435517718 , 227.71979962653432 },
-  { 526.7676688981398 , 489.9567056405804 },
-  { 615.6039675885172 , 425.09663044262305 },
-  { 405.68463244370446 , 329.74588429284586 },
-  { 880.8806482571005 , 98.40780062949963 },
-  { 603.2161856894454 , 121.9545756040364 },
-  { 660.5028645374366 , 280.7852118735238 },
-  { 424.0719522970976 , 38.12805722162388 },
-  { 211.71120890757567 , 126.15241727761348 },
-  { 344.9174478951886 , 62.46478126997295 },
-  { 255.00543206991358 , 229.89845803997073 },
-  { 509.3989114705924 , 370.99049712603136 },
-  { 897.9504353262244 , 199.2783077824321 },
-  { 786.6648016012905 , 104.17376498605896 },
-  { 688.5361499030073 , 129.573144805068 }
-},
-{ //#75
-  { 645.677667277934 , 298.7402167652926 },
-  { 367.5063156968905 , 196.04450016425034 },
-  { 285.3878479010434 , 391.44088453955135 },
-  { 554.6762742628566 , 283.5021903001256 },
-  { 682.4601957573659 , 473.0334390329187 },
-  { 642.0600560823716 , 196.44110366349076 },
-  { 189.0895044572098 , 377.8801844719409 },
-  { 784.1501202608622 , 237.0673613443392 },
-  { 715.2704828071488 , 157.83040251675038 },
-  { 450.26142046814164 , 325.52774694165475 },
-  { 752.7122181189824 , 395.01066380604703 },
-  { 605.6458102177842 , 477.73160811776904 },
-  { 770.5237821318167 , 493.2454647193459 },
-  { 382.9695423961799 , 372.9973584809901 },
-  { 487.2086833529555 , 448.75821752421444 },
-  { 848.7884185553031 , 154.33411232316948 },
-  { 856.0728163008456 , 410.24533697677924 },
-  { 689.8711029881397 , 55.95905421503352 },
-  { 525.7849061056966 , 368.45992925614485 },
-  { 785.0243575491176 , 100.32974551518956 },
-  { 834.3141769260081 , 7.629077740930811 },
-  { 230.906706358993 , 206.86697213221356 },
-  { 659.6023171915915 , 570.1662884589212 },
-  { 262.1347262816904 , 295.09411936541886 },
-  { 736.1273450339907 , 307.3193837059557 },
-  { 349.33855501157757 , 276.58858095442804 },
-  { 927.8609519005449 , 55.29354030858582 },
-  { 149.2178893350773 , 280.98319440367607 },
-  { 880.0801036064931 , 268.0441114864525 },
-  { 552.0660611816568 , 142.3672561786842 },
-  { 608.4960149917063 , 386.79223969388266 },
-  { 611.2531389358379 , 27.662114165514264 },
-  { 448.8102689753664 , 156.88191967159761 },
-  { 928.6212358550448 , 345.93162906952807 },
-  { 737.3993065263564 , 2.3131365372483685 },
-  { 453.03595389066106 , 243.0126354390019 }
-},
-{ //#76
-  { 300.07483195908617 , 255.0235563935472 },
-  { 67.25623249554303 , 165.75356114137492 },
-  { 236.29000682608944 , 123.4205485705855 },
-  { 305.24618354012966 , 367.71927299458946 },
-  { 399.75123249554304 , 44.82955399804672 },
-  { 91.3947598943015 , 335.2755787551637 },
-  { 295.33637870082805 , 63.85511063957583 },
-  { 729.20420956695295 , 222.93521342760258 },
-  { 251.91623729739305 , 465.06430588555645 },
-  { 82.41762107439035 , 431.91938331913536 },
-  { 148.85519930722282 , 485.0973423101399 },
-  { 239.74135325278607 , 327.1851336823564 },
-  { 509.95584647552334 , 454.7599277371433 },
-  { 201.7896037262913 , 16.19064807192087 },
-  { 395.4831423677185 , 298.8396355408761 },
-  { 50.1968710509103 , 521.0060371579018 },
-  { 186.25618354012965 , 387.71927299458946 },
-  { 345.4630122719298 , 552.7287684532115 },
-  { 442.4094870565209 , 121.38286984121882 },
-  { 581.4575857261894 , 403.2544893355911 },
-  { 159.9342143147807 , 188.75381289114569 },
-  { 357.0479523390148 , 148.79380487900156 },
-  { 240.4890027574603 , 560.8964403013611 },
-  { 528.4122601864221 , 61.16307978872245 },
-  { 30.4714073625463 , 257.35656896433665 },
-  { 497.115211926518 , 278.3794301444255 },
-  { 166.50354179269425 , 272.22503280449325 },
-  { 500.8560085051862 , 362.9336046845781 },
-  { 336.62504153521274 , 454.7144456832418 },
-  { 393.06882685980094 , 210.9497089087406 },
-  { 560.61676206904224 , 195.76180188228892 },
-  { 411.485903226674 , 373.53268470540337 },
-  { 416.650486934172 , 457.7405737071608 },
-  { 682.82757497036147 , 409.44137955316535 },
-  { 709.74135325278607 , 327.1851336823564 },
-  { 637.0364424430467 , 251.7563342712762 }
-},
-{ //#77
-  { 619.8646368939683 , 190.8044440576931 },
-  { 901.4571913873357 , 255.87679191401554 },
-  { 753.8328814311458 , 192.41622792749038 },
-  { 916.7922266885919 , 165.70656499209667 },
-  { 817.0720223879214 , 130.17708697071475 },
-  { 603.4405824093944 , 378.25174089125446 },
-  { 400.3795444192242 , 238.2847773158379 },
-  { 816.2396942360709 , 235.15109648518427 },
-  { 383.1885600477779 , 140.22896566438288 },
-  { 789.5092143159258 , 428.69513962778785 },
-  { 457.5523364959337 , 279.26553527984606 },
-  { 775.6963323441113 , 330.11593287079114 },
-  { 341.6932853129249 , 292.50016065873535 },
-  { 245.8682195452636 , 198.20156499209668 },
-  { 812.6838062577186 , 26.208842433537285 },
-  { 755.3278137794689 , 99.42514437561559 },
-  { 691.4926053379845 , 236.3201906505489 },
-  { 522.5530857318163 , 219.9457059488723 },
-  { 661.8468883040904 , 94.32027081662093 },
-  { 903.6078134010469 , 78.70384243353728 },
-  { 564.3606171631006 , 23.893264733559448 },
-  { 460.66321828401715 , 7.469210248985625 },
-  { 469.8136997150938 , 112.05969160163798 },
-  { 649.4651691107797 , 312.616127812204 },
-  { 574.4041810677461 , 121.21017303271461 },
-  { 168.4763436392618 , 176.770535279846 },
-  { 708.7155617205411 , 370.820626303334585 },
-  { 182.7183792037853 , 55.71257009138192 },
-  { 646.6594698858321 , 13.0036754254011 },
-  { 981.6305886279185 , 8.451820071920764 },
-  { 370.7400829089504 , 16.284130103979763 },
-  { 531.866183759857 , 319.37066315089223 },
-  { 676.7032941695479 , 437.59256183715219 },
-  { 277.7891802287687 , 38.35761736266602 },
-  { 303.1816451957776 , 134.11228071886822 },
-  { 725.9931135464385 , 4.891894062893442 }
-},
-{ //#78
-  { 301.57801278691477 , 404.7716576872685 },
-  { 389.60078801378637 , 364.519635325652 },
-  { 539.7516897343496 , 383.87149565760564 },
-  { 416.17574421892343 , 280.17409677852214 },
-  { 224.091741645925 , 515.1986637703301 },
-  { 514.79318765391807 , 506.3746655102302 },
-  { 128.12372129033338 , 52.99244449229445 },
-  { 24.24031800009683 , 567.6423580097559 },
-  { 316.9773926059239 , 506.6430059889854 },
-  { 179.02388331999623 , 131.16612143972927 },
-  { 241.45390696836893 , 609.5751883034754 },
-  { 596.46669062316388 , 477.182054792389 },
-  { 132.28529008670705 , 516.4520500445612 },
-  { 507.85490675336666 , 313.21381025521146 },
-  { 280.8952316217131 , 156.5655012587384 },
-  { 344.67325446713897 , 235.1617873266214 },
-  { 57.22355926067046 , 314.8187675448596 },
-  { 196.46669062316388 , 417.182054792389 },
-  { 466.7950218024533 , 419.2855261724335 },
-  { 16.2601288761336 , 370.4549910967038 },
-  { 277.23113346291746 , 51.63945833000355 },
-  { 385.1026520825355 , 143.77043889463187 },
-  { 30.47269572244913 , 480.2559022771956 },
-  { 478.52615761889248 , 192.29633921345436 },
-  { 111.76089042420841 , 269.1996534200513 },
-  { 382.20514297738697 , 53.47178648185394 },
-  { 620.869126951723 , 386.48594951354886 },
-  { 557.6740280221051 , 226.496373263523 },
-  { 400.88754951716413 , 482.2303456356665 },
-  { 123.6647355628635 , 595.6849349113198 },
-  { 107.05102196009089 , 421.1613150344963 },
-  { 9.69924495266946 , 226.99411547847177 },
-  { 97.75126788125952 , 169.8124631922441 },
-  { 183.16825446713898 , 316.0857944699496 },
-  { 285.75873581979135 , 306.93531303887295 },
-  { 186.36801571939176 , 678.5980725092165 }
-},
-{ //#79
-  { 413.906626560108 , 446.44049387371797 },
-  { 462.61628949550163 , 349.3998391311641 },
-  { 559.2600940594733 , 308.3769779510751 },
-  { 280.1922350109278 , 453.09723801024757 },
-  { 237.4314456405167 , 205.68126135003286 },
-  { 729.1115177053015 , 340.82067219050083 },
-  { 452.49275140109097 , 247.39283498821965 },
-  { 652.8068690340101 , 260.71251538342005 },
-  { 535.5991174886663 , 195.70725183556334 },
-  { 637.4704657903831 , 5.30787201655421 },
-  { 488.14162626362605 , 112.98059357577411 },
-  { 341.25354077150206 , 391.38566437206083 },
-  { 175.0526735986509 , 321.17204031518156 },
-  { 662.8698456093922 , 177.17922031827106 },
-  { 801.82845856277197 , 364.0606683947844 },
-  { 318.2948340897085 , 122.53590025451989 },
-  { 417.3719686331444 , 93.59673426729316 },
-  { 504.3090628886671 , 405.7443885948779 },
-  { 264.987751401091 , 358.31684213154784 },
-  { 817.94709665853713 , 429.60717919615416 },
-  { 548.6797541888232 , 500.89764315585575 },
-  { 651.8954022509213 , 72.76436652355605 },
-  { 334.2552909233798 , 226.91087983951593 },
-  { 741.3454895719057 , 497.4679293104036 },
-  { 600.0551525072993 , 584.5085840529574 },
-  { 236.242163992453 , 543.9872688482548 },
-  { 190.28478820007143 , 462.6663209826047 },
-  { 364.59968051756044 , 311.77478810840296 },
-  { 582.4428395263307 , 109.6929491772813 },
-  { 160.3276387797023 , 585.31832534614857 },
-  { 256.1901502801745 , 283.8168894727935 },
-  { 189.1014057772625 , 141.4161277935692 },
-  { 634.5755468607591 , 364.1074813721718 },
-  { 353.0064645304451 , 528.2668169262831 },
-  { 635.9638473550613 , 485.8502557966449 },
-  { 443.00045943115987 , 582.3406644110897 }
-},
-{ //#80
-  { 352.4931948277946 , 590.7515418926109 },
-  { 650.28825719190104 , 399.54412143178854 },
-  { 436.7301536553834 , 533.8719044388976 },
-  { 507.2536392929384 , 591.8040867533877 },
-  { 249.43215683762435 , 607.7845783171944 },
-  { 419.02687349885514 , 422.95876684100085 },
-  { 52.3560748774109 , 408.0206357942336 },
-  { 540.97485057026506 , 365.77711455477316 },
-  { 463.64641194201715 , 320.97998105167983 },
-  { 147.56080853590748 , 633.1839581362035 },
-  { 68.27418279600633 , 316.4872951778825 },
-  { 680.1576573954496 , 494.20476691807414 },
-  { 267.827812478474 , 221.70998579950754 },
-  { 286.05129836431223 , 414.66448397807517 },
-  { 276.9008169332356 , 310.0740026254228 },
-  { 368.72713998580076 , 360.9741646550857 },
-  { 190.051985113701 , 544.71628054199994 },
-  { 504.8980999675837 , 460.2110325879466 },
-  { 164.64325319774045 , 305.55872799937276 },
-  { 191.0429873454773 , 150.10697797654583 },
-  { 465.18891142883683 , 229.5801903115674 },
-  { 590.2904393210879 , 488.90362493485077 },
-  { 68.32384970831866 , 564.3043206824901 },
-  { 583.5195793651521 , 586.9390874205403 },
-  { 95.88973278449942 , 194.47766927670187 },
-  { 99.01995498715878 , 463.90188435393105 },
-  { 403.85867330418665 , 640.0354089266386 },
-  { 367.9645250135053 , 248.8098717950096 },
-  { 496.3296321496102 , 139.3090867533876 },
-  { 138.54798734547722 , 59.18297083321764 },
-  { 244.67830991508737 , 486.2138057178479 },
-  { 337.139672302731 , 504.72142300782093 },
-  { 387.18367752394767 , 162.01304449180543 },
-  { 177.5780775171662 , 406.8897315064416 },
-  { 169.0081136475763 , 238.2467320305101 },
-  { 286.12485249170294 , 114.5541940740966 }
-},
-{ //#81
-  { 185.90855162747002 , 208.45903944054913 },
-  { 566.8325587707982 , 130.96403944054907 },
-  { 316.86559519538156 , 7.903001450378824 },
-  { 136.83255877079813 , 440.96403944054907 },
-  { 537.8400385538525 , 242.31785524509382 },
-  { 770.7722208683425 , 66.79436960753878 },
-  { 308.85714547218345 , 235.3284263614986 },
-  { 525.6522078362899 , 339.535846822321 },
-  { 90.9698573880443 , 255.1706130787359 },
-  { 384.53344566899636 , 164.58165063611142 },
-  { 117.35179338276868 , 96.52962770752136 },
-  { 768.25652529119253 , 173.45707805978174 },
-  { 401.441084571926 , 49.60833585991644 },
-  { 472.6435691700594 , 92.1937494265479 },
-  { 20.311138640214836 , 17.819964772127662 },
-  { 22.14346679206522 , 122.79397428659718 },
-  { 501.84352090048515 , 8.912230581076358 },
-  { 590.56299407446505 , 21.47894696580496 },
-  { 626.32893220267985 , 193.17343227149308 },
-  { 270.9704395810977 , 147.55129482212743 },
-  { 377.4954437666243 , 318.06167538266834 },
-  { 457.9224498496858 , 385.5479465236581 },
-  { 289.2811999567573 , 339.0258252405821 },
-  { 302.9452981155529 , 443.951868169317 },
-  { 205.75871128599152 , 310.95803434126384 },
-  { 697.1334667920652 , 122.79397428659718 },
-  { 38.54246081346586 , 421.21493076087938 },
-  { 236.84397278910325 , 530.63048960509542 },
-  { 214.55912641210904 , 449.88113254435558 },
-  { 391.5609026840519 , 438.1941750786335 },
-  { 27.638218838011905 , 227.64008914047986 },
-  { 655.53045896910345 , 46.009149153600504 },
-  { 256.3877748310655 , 47.185415943313316 },
-  { 77.77969034390941 , 341.83054390206036 },
-  { 470.91855162747002 , 193.45903944054913 },
-  { 178.0336288217281 , 30.96765123403199 }
-},
-{  //#82
-  { 487.48034275656676 , 7.330520388199968 },
-  { 539.9753427565668 , 118.25452753152817 },
-  { 217.7001328090631 , 293.33329351810121 },
-  { 463.8627315610044 , 109.62963349000181 },
-  { 383.5120982193893 , 401.94230425799727 },
-  { 555.3747225755759 , 230.12587583324503 },
-  { 474.8855927410932 , 362.98582892603008 },
-  { 560.4125250710568 , 422.85400602575494 },
-  { 121.3353905276209 , 53.91484003852814 },
-  { 757.9791950915926 , 12.891978858439188 },
-  { 680.8395311541183 , 435.367734884765156 },
-  { 663.6148081706431 , 58.91656555982441 },
-  { 635.8884803544635 , 355.55124737499991 },
-  { 877.8306187374208 , 5.33567309786491 },
-  { 579.1247336978688 , 5.2249698828057 },
-  { 279.8146993403058 , 11.518249773423449 },
-  { 426.23768053824335 , 207.646242467943 },
-  { 763.19051762357003 , 256.651519708566468 },
-  { 323.1766425480731 , 227.67927889252647 },
-  { 323.292308166893 , 107.94507738789855 },
-  { 575.1376151027098 , 521.0086041529017 },
-  { 361.31916932185317 , 491.2521398895573768 },
-  { 710.951056750434 , 178.12513191246862 },
-  { 253.9621700734866 , 172.95246428793143 },
-  { 921.0151780181543 , 129.1844152977302 },
-  { 928.33891019655 , 233.91866493450914 },
-  { 315.8529103696774 , 332.4135285293054 },
-  { 387.7193142499545 , 32.458806246908765 },
-  { 847.0157647070557 , 68.52820241028337 },
-  { 478.26376911838 , 293.1932217709539 },
-  { 188.6429015002489 , 105.98638952633632 },
-  { 783.9112555813351 , 125.80326973661644 },
-  { 620.9115280141148 , 154.8297031577211 },
-  { 236.43144096652964 , 398.21921225648438 },
-  { 644.9493522710363 , 260.08685568337856 },
-  { 87.0855921741197 , 148.19025643912937 }
-},
-{ //#83
-  { 122.9971749726842 , 279.93524821986506 },
-  { 210.24919733430073 , 351.95802344673666 },
-  { 639.70242235976397 , 310.2935608790817 },
-  { 33.45039999814745 , 230.2707856522101 },
-  { 542.52901081445032 , 411.706113381171 },
-  { 440.1881593441305 , 347.9910598713201 },
-  { 466.97298447712723 , 449.5940676942818 },
-  { 77.07545102090845 , 134.25417667426885 },
-  { 264.15640388130794 , 513.3792760015228 },
-  { 514.549167798786087 , 265.9228695789257 },
-  { 382.02048749598087 , 501.9650693857896 },
-  { 4.506235587578715 , 435.95813574278753 },
-  { 228.9467993226253 , 128.85479685525972 },
-  { 157.5024571039699 , 66.76790553327906 },
-  { 166.6616375403392 , 186.3884732453283 },
-  { 488.02279217929711 , 26.35979685525971 },
-  { 81.95683717087948 , 491.3860258600718 },
-  { 318.40245189527855 , 313.5873321465806 },
-  { 57.43841790206885 , 557.4816213803425 },
-  { 12.357389468796981 , 332.62350712181836 },
-  { 5.53421256679245 , 72.156121663481784 },
-  { 332.5838524317354 , 204.3173368944083 },
-  { 67.50846220325514 , 12.694058048472478 },
-  { 109.3479334543661 , 381.57745871634063 },
-  { 538.74021937503812 , 324.9714534264688 },
-  { 371.22079960905086 , 401.63935507517067 },
-  { 238.26717022485644 , 249.75384768340808 },
-  { 417.94413378753781 , 264.15419175217676 },
-  { 183.74319441516755 , 550.8377731965008 },
-  { 259.8015702057717 , 37.150294337716645 },
-  { 164.1215653078177 , 467.77846123749345 },
-  { 288.0051460811732 , 416.5638352822563 },
-  { 416.96195816652386 , 147.2826623118238 },
-  { 353.03366172472863 , 66.1515166987315 },
-  { 117.67938536226487 , 625.89431888303295 },
-  { 501.68986273971203 , 111.96405330064474 }
-},
-{ //#84
-  { 568.0338950837067 , 176.88929409796648 },
-  { 527.0110339036179 , 269.5330986619382 },
-  { 619.7454687218935 , 297.8279883373922 },
-  { 106.9730610709335 , 101.9664286414024 },
-  { 538.2633981355397 , 14.925773898848604 },
-  { 767.2504687218935 , 196.903981194064 },
-  { 617.5003569631285 , 83.80541135256195 },
-  { 547.0440703282013 , 402.59413665210843 },
-  { 271.4875482660629 , 382.4652809764283 },
-  { 472.12075748581003 , 160.18601394143826 },
-  { 874.4198705876119 , 173.80362513700064 },
-  { 711.8510889028844 , 95.03263289234712 },
-  { 444.16381608766716 , 477.19953061320723 },
-  { 634.5981120936946 , 399.9830376193436 },
-  { 799.15425762999337 , 123.65233527037769 },
-  { 268.0338950837067 , 162.8892940979665 },
-  { 810.0720718937881 , 279.50006223735477 },
-  { 662.4487488784217 , 213.86373745643743 },
-  { 451.65881608766716 , 376.27552346987903 },
-  { 450.9282234463203 , 66.09346690512041 },
-  { 720.6226987950798 , 294.34742454029316 },
-  { 206.759055780251 , 77.45276492026855 },
-  { 175.5902008442811 , 302.7407177437947 },
-  { 369.3373311239968 , 124.20070103753577 },
-  { 699.3796077605463 , 6.14091162664516 },
-  { 717.0959984021573 , 392.7230162507622 },
-  { 411.32758483195624 , 553.3225639128729 },
-  { 165.66652962215085 , 178.88137509221238 },
-  { 326.3362904659282 , 309.28072169569475 },
-  { 328.7417388976825 , 205.3613946301541 },
-  { 231.4680994866249 , 479.0281790321638 },
-  { 306.04905392760526 , 49.47142864140239 },
-  { 308.631868230914 , 531.4939154939163 },
-  { 359.3137831967002 , 425.6054697126157 },
-  { 234.036668213608 , 263.1090841504628 },
-  { 424.8187202167035 , 274.4923019209282 }
-},
-{ //#85
-  { 566.6921939847439 , 267.83889077488413 },
-  { 861.1070477794589 , 250.8644474164132 },
-  { 373.9964773837016 , 250.01024235592763 },
-  { 764.8044466585424 , 277.28850190098706 },
-  { 258.4037676229307 , 174.9513098185165 },
-  { 849.743140897968 , 339.0000755391738 },
-  { 557.5417125536673 , 387.4293721275365 },
-  { 664.9530230127142 , 244.8448076615613 },
-  { 791.0334779625744 , 556.0407302817276 },
-  { 378.2849037455149 , 349.9489365953534 },
-  { 600.3147247182734 , 162.11155864039154 },
-  { 354.9265085880706 , 158.14331410321404 },
-  { 647.6292908343185 , 345.5790572983402 },
-  { 640.0554414126775 , 456.856378210598 },
-  { 693.8614996928102 , 114.4470960727365 },
-  { 747.8852053272043 , 174.32132202400624 },
-  { 283.45858069294974 , 284.0487745656905 },
-  { 570.9794485560058 , 509.351378210598 },
-  { 651.1582195362819 , 18.5339584748398 },
-  { 511.6330177059053 , 475.087700383849 },
-  { 876.9165524432817 , 440.4126280412631 },
-  { 477.5086761290837 , 63.3683341373662 },
-  { 481.4693646973449 , 348.0219266209039 },
-  { 954.5892557518507 , 333.5053234932271 },
-  { 564.3092598117781 , 65.62392314492274 },
-  { 465.8301389154805 , 245.4906778881107 },
-  { 431.2060116228438 , 441.6014292428592 },
-  { 774.2208358422395 , 462.2412764602196 },
-  { 931.425773478133 , 218.0338559993972 },
-  { 817.1221641547932 , 100.44168457029286 },
-  { 731.5175556857112 , 366.3281388623229 },
-  { 975.3978648835239 , 430.0161435803425 },
-  { 755.5730733309969 , 29.50840183331076 },
-  { 457.6605755424972 , 145.08419942719274 },
-  { 286.8992860864907 , 383.7604578347971 },
-  { 909.7115283797694 , 118.4211599943433 }
-},
-{ //#44  65 86
-  { 410.31425668574076 , 335.1125520341365 },
-  { 332.6140474963183 , 494.3697803327929 },
-  { 498.3160642812193 , 285.17813696778376 },
-  { 572.0907391439276 , 198.4034621050754 },
-  { 688.8128090320057 , 210.07597665219174 },
-  { 786.7819829394143 , 189.08889525072559 },
-  { 501.524349406696 , 400.25985867645363 },
-  { 502.5384147665757 , 118.92815777838115 },
-  { 843.2876103921618 , 280.2747378560546 },
-  { 903.024573764069 , 380.7556027421643 },
-  { 226.37186586278364 , 385.9022735619667 },
-  { 931.3636119343516 , 290.50342684929217 },
-  { 399.7165812923299 , 448.37405267987793 },
-  { 315.3124490902622 , 380.04696710048927 },
-  { 713.9378948019847 , 469.12806554949896 },
-  { 1021.4621452856978 , 353.5910990835437 },
-  { 596.5674332636885 , 269.9808241134945 },
-  { 614.8999804526702 , 108.40587397490653 },
-  { 531.6231703564249 , 40.120054101896336 },
-  { 920.7432992182677 , 101.73814297710584 },
-  { 248.35681919766188 , 473.6695711433705 },
-  { 216.3286698789617 , 315.39646720084016 },
-  { 468.0978142504101 , 498.25419488169115 },
-  { 630.338506801367 , 357.76548612920107 },
-  { 593.3618191976619 , 438.9237053056209 },
-  { 830.5114308081622 , 414.2290325838622 },
-  { 875.7151080979534 , 192.26227054628478 },
-  { 631.345240244503 , 28.44753955478005 },
-  { 469.1543372373153 , 212.2697083970536 },
-  { 730.7201080979534 , 287.5164047085352 },
-  { 715.478202415484 , 100.9063764302662 },
-  { 759.527908037873 , 371.088090377047 },
-  { 393.34689037381077 , 261.16521836924994 },
-  { 702.2526013271271 , 398.75858634206986 },
-  { 834.4007785038045 , 85.73210389048351 },
-  { 307.232039274299 , 270.0737191102378 }
-},
-{ //#45 87
-  { 311.22471111702737 , 386.549245143718 },
-  { 351.3826749194812 , 271.36528503534373 },
-  { 326.6457115475739 , 180.88442014923407 },
-  { 225.18325333121908 , 324.6894951662384 },
-  { 180.17025370794488 , 405.1310888073309 },
-  { 306.57257831453407 , 486.8695881615895 },
-  { 217.66193233627342 , 106.23392024958497 },
-  { 169.70496903056687 , 235.47054535466674 },
-  { 369.899275525330737 , 554.5861938326586 },
-  { 15.06695086178659 , 335.6837455562605 },
-  { 274.48774774512003 , 65.70046004085982 },
-  { 68.75857380886436 , 96.01781280717162 },
-  { 58.8877848183729355 , 430.38580555272995 },
-  { 513.12996645190755 , 468.8533123235562 },
-  { 115.50854450287918 , 320.6707459329863 },
-  { 381.65871117084805 , 90.44282650814154 },
-  { 444.14571494513297 , 235.9187137457461 },
-  { 60.30474969211585 , 627.7063784719069 },
-  { 579.4533643197306 , 314.8382986266314 },
-  { 252.71547575926957 , 183.31061275600084 },
-  { 525.00075544239894 , 124.48531957799787 },
-  { 138.7305421169879 , 592.0535482699638 },
-  { 62.875792347865925 , 213.3398650014247 },
-  { 320.38014041144041 , 599.3231572045659 },
-  { 575.91302540928851 , 541.8312979967534 },
-  { 149.429242800428995 , 495.5160914929145 },
-  { 120.26879793354843 , 151.17874434151207 },
-  { 400.1825382559863 , 345.1556513929431 },
-  { 586.29464820261214 , 409.1970736144732 },
-  { 153.48524036887903 , 35.32038718906669 },
-  { 586.01697623109848 , 189.135819477647 },
-  { 424.5994290264739 , 447.8401625033703 },
-  { 486.70425497057005 , 327.91731898330477 },
-  { 35.7559916914183 , 527.9722601574413 },
-  { 438.40615809694594 , 170.11895620410985 },
-  { 229.55029163046942 , 585.9187481234336 }
-},
-{ //#88
-  { 739.3310172817 , 216.17095878816684 },
-  { 716.5359549175936 , 317.37837924898923 },
-  { 833.5041994547711 , 305.7665953791919 },
-  { 647.1777627207222 , 168.80026748801083 },
-  { 719.4953001750398 , 511.08804218438297 },
-  { 927.4675820976129 , 245.50093526226954 },
-  { 736.1708622541412 , 107.58779766437289 },
-  { 617.9440964600578 , 351.4331175767596 },
-  { 833.5158951451082 , 204.9177439071095 },
-  { 961.4725249481683 , 16.3400645459995 },
-  { 308.5288878581871 , 169.7893616240828 },
-  { 517.3536151074055 , 328.282636145683 },
-  { 274.8313585457687 , 345.5375048777327 },
-  { 379.8068401328688 , 372.94709871333805 },
-  { 299.8139862725664 , 257.836837103474 },
-  { 470.65033495087727 , 421.1957737435797 },
-  { 918.7809102198036 , 121.76658639721114 },
-  { 360.3552109107522 , 108.8891995944199 },
-  { 560.0712472844098 , 34.725931654657344 },
-  { 914.3529416546363 , 365.95115465992546 },
-  { 484.8287203841966 , 520.3629257260884 },
-  { 386.84749487542257 , 274.2374357779443 },
-  { 448.4046658996227 , 133.6655268470049 },
-  { 578.4505026983842 , 237.45261064494755 },
-  { 630.507626367373 , 455.27175451451166 },
-  { 814.3859780792197 , 469.0121926500957 },
-  { 869.03293258142 , 15.78936162408274 },
-  { 483.7507566376607 , 236.2865386290006 },
-  { 547.5339581567505 , 127.777406307922 },
-  { 367.31184013286884 , 463.87110585666625 },
-  { 735.4463206067986 , 403.56018087632486 },
-  { 825.2074318696043 , 101.22402121621707 },
-  { 645.9367738393739 , 67.02560456188604 },
-  { 913.3784982961654 , 470.36600845464045 },
-  { 608.6789779484164 , 557.967471115554 },
-  { 272.12805260993787 , 438.0731063491977 }
-},
-{ //#89
-  { 223.070834773402442 , 476.32327728981124 },
-  { 86.91957697326771 , 179.50783657054478 },
-  { 93.99484191673065 , 618.81827728981125 },
-  { 672.01761714360225 , 438.56625492819474 },
-  { 105.15089914651873 , 282.9028025592965 },
-  { 247.54110278115724 , 171.49843724268487 },
-  { 297.1708717045801 , 574.93694622835076 },
-  { 348.4639682377213 , 142.55927125545807 },
-  { 403.110244403964884 , 604.19313962390282 },
-  { 372.16087170458013 , 232.93694622835076 },
-  { 198.7290915535096 , 578.14200946820696 },
-  { 442.01074321225803 , 94.89480868780304 },
-  { 83.32225072756219 , 385.59851916033875 },
-  { 409.78592272734124 , 310.95355520629198 },
-  { 48.806349682805006 , 523.79070329534373 },
-  { 581.632938137491365 , 422.37815079325445 },
-  { 134.22241275722513 , 477.4248422129039 },
-  { 505.60118267466883 , 621.98993466305172 },
-  { 326.69158421223386 , 46.90795589003251 },
-  { 672.70720490709297 , 543.05137891346834 },
-  { 198.25128340426656 , 78.79776946842613 },
-  { 648.36226676558141 , 292.2159148507744 },
-  { 218.21369041140957 , 269.7722206113487 },
-  { 497.29082495484548 , 334.83305462412198 },
-  { 19.65752483887661 , 100.74253771420399 },
-  { 570.29126639380388 , 538.286845641016406 },
-  { 372.72604321373724 , 401.2524844662376 },
-  { 333.46467793911754 , 494.6993981431057 },
-  { 8.18863017257955 , 319.816523117738111 },
-  { 111.46645827126984 , 67.194761645464425 },
-  { 280.74265219167842 , 393.6274334434765 },
-  { 566.6513470394403 , 254.96910518716396 },
-  { 492.42208869789929 , 423.7721961077736 },
-  { 434.82951459378174 , 510.92415328694824 },
-  { 184.24511618412626 , 356.6593531731119 },
-  { 492.91090524192094 , 186.7211317403682 }
-}
-};
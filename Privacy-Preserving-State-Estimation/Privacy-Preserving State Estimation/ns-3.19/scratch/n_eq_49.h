@@ -1,3381 +0,0 @@
-using namespace std;
-
-
-/*
-struct coordinates {
-	double X;
-	double Y;
-};
-
-template <typename T, int N> char (&array(T(&)[N]))[N];
-*/
-
-
-struct coordinates n_eq_49[66][49] = {
-{ //#1
-	  { 546.2499321648903 , 76.7795310884235 },
-	  { 640.5297635691156 , 20.13049322906661 },
-	  { 724.786991867772 , 90.83070241848907 },
-	  { 831.0291735013067 , 62.36319564766282 },
-	  { 439.0789687391623 , 52.037164621141784 },
-	  { 749.2906741470481 , 135.96087104107363 },
-	  { 439.5271052317935 , 103.38852038543095 },
-	  { 457.2661529535898 , 12.129031188774391 },
-	  { 940.9521705651371 , 58.524600005354756 },
-	  { 724.5483076797664 , 243.13183446680165 },
-	  { 686.929512115376 , 346.48862582704373 },
-	  { 565.2353268609984 , 33.116112590240554 },
-	  { 733.0273659058281 , 12.428780581310129 },
-	  { 655.6373954364467 , 88.2766167632327 },
-	  { 831.0291735013067 , 119.29820918931532 },
-	  { 717.1327103445942 , 30.77691093269938 },
-	  { 380.8606787868047 , 91.24921582802266 },
-	  { 939.948758382192 , 77.67084502226042 },
-	  { 293.018759036703 , 25.055581431528893 },
-	  { 915.2864017999631 , 133.06340483708527 },
-	  { 735.1459545507066 , 445.3469829794891 },
-	  { 934.3859648615487 , 99.98199121205312 },
-	  { 440.0077505313557 , 105.24703785924979 },
-	  { 336.65095917111364 , 67.62824229485949 },
-	  { 470.670562034722 , 121.29918240780339 },
-	  { 817.0072798181172 , 49.28756825187031 },
-	  { 872.2321527111228 , 221.27916135311625 },
-	  { 1042.1984993963708 , 15.548083182819433 },
-	  { 531.1423002975592 , 8.63340755425745 },
-	  { 459.5061529247427 , 2.7987598239288367 },
-	  { 1105.2861716306224 , 105.64661653416564 },
-	  { 829.1550139070703 , 277.12061367810213 },
-	  { 433.32253691200094 , 161.87642714879735 },
-	  { 890.9340209626096 , 154.60857141598 },
-	  { 1006.1423927786857 , 165.51276477236217 },
-	  { 548.3485271073342 , 117.26924813631665 },
-	  { 519.64521462275 , 118.02087082581383 },
-	  { 1002.3037971363775 , 55.58976770853185 },
-	  { 348.14804484592287 , 177.01570556641587 },
-	  { 1206.5325004618564 , 148.62313335670086 },
-	  { 1139.3139051349242 , 67.18526037363955 },
-	  { 668.1379540084151 , 185.1105338227144 },
-	  { 349.29697904618126 , 33.116112590240576 },
-	  { 784.6918393290748 , 183.07607818680623 },
-	  { 595.5526796273101 , 138.84528652649624 },
-	  { 691.7521012155722 , 85.52107639560165 },
-	  { 730.5434236949334 , 200.66996494614466 },
-	  { 1187.4329374002707 , 256.9421381105136 },
-	  { 709.6788397058006 , 263.51767182789877 }
-	},
-	{ //#2
-	  { 102.54774927481594 , 312.6092544111386 },
-	  { 75.93875997780849 , 419.3320813442354 },
-	  { 61.34477006499978 , 414.59020657493954 },
-	  { 149.03153188367548 , 212.9244609149775 },
-	  { 216.74813755474466 , 126.25115812577417 },
-	  { 324.71731146215325 , 105.26407672430803 },
-	  { 93.14498678758349 , 527.9679219262946 },
-	  { 120.67572334971575 , 519.8129462303451 },
-	  { 263.21168400940576 , 14.078234118979026 },
-	  { 106.82514049091432 , 130.08975376808223 },
-	  { 153.4896141213277 , 6.405719571862736 },
-	  { 219.53335135377898 , 137.42204052676186 },
-	  { 212.0091005992886 , 162.24771757053605 },
-	  { 170.2643549458851 , 399.2825572003419 },
-	  { 11.756138468830443 , 535.1205956049428 },
-	  { 230.15254663587686 , 17.081006906745174 },
-	  { 185.55825600351864 , 384.76918700980445 },
-	  { 78.38729257779062 , 409.5115534770861 },
-	  { 101.8524369305076 , 103.52112531041612 },
-	  { 81.25883257922817 , 622.4974573407724 },
-	  { 57.40021117632438 , 301.54237956967756 },
-	  { 109.56010336352752 , 135.50245034272507 },
-	  { 321.84836312694415 , 156.4912857433746 },
-	  { 18.8419302018049 , 175.68105790908203 },
-	  { 140.81391970221478 , 25.483047540778287 },
-	  { 57.40021117632436 , 191.55237956967756 },
-	  { 167.93213536843152 , 690.2140630118415 },
-	  { 170.21859138203382 , 475.98111920359224 },
-	  { 204.3365860521722 , 52.525647682458 },
-	  { 172.44467518455718 , 560.9918298880249 },
-	  { 71.66098593013328 , 627.36597137326 },
-	  { 185.51021482091957 , 428.9183414890503 },
-	  { 21.726570863780537 , 725.3677789687385 },
-	  { 28.950073881405103 , 230.87075505688 },
-	  { 163.68212657526013 , 133.06950214548954 },
-	  { 138.9397601079784 , 25.898538719761532 },
-	  { 373.1346810732361 , 17.916829761287108 },
-	  { 169.66279352561185 , 577.4315563069072 },
-	  { 81.25883257922816 , 512.5074573407724 },
-	  { 215.42119200709237 , 459.74550105679094 },
-	  { 179.62711179321593 , 25.746450447707744 },
-	  { 263.36692007142125 , 179.55328475434908 },
-	  { 251.71604299410268 , 252.34135168546507 },
-	  { 18.131987164309294 , 608.4095155673872 },
-	  { 166.2227027120838 , 134.91660166673677 },
-	  { 410.8321423382446 , 91.84078584372544 },
-	  { 33.15462919674239 , 56.38226570347686 },
-	  { 184.97044290020946 , 686.3511411877925 },
-	  { 3.484157716519803 , 590.2821322034807 }
-	},
-{ //#3
-  { 416.9753544496885 , 186.64157364563195 },
-  { 310.2525275165916 , 160.0325843486245 },
-  { 310.25252751659167 , 213.2505629426394 },
-  { 298.75544184178244 , 50.645121077068126 },
-  { 497.4169480907811 , 111.62857402235777 },
-  { 558.9225755435285 , 202.8144166276868 },
-  { 348.6898569081352 , 148.6469286725467 },
-  { 279.9351747502799 , 54.30341041236882 },
-  { 174.2060008140242 , 84.62076317868062 },
-  { 484.01253900964895 , 2.4584228033287587 },
-  { 198.27457695567276 , 5.908157705160903 },
-  { 518.4040294922472 , 3.659400114949193 },
-  { 143.27957695567278 , 101.16229186741131 },
-  { 291.152964455006 , 321.56956769645217 },
-  { 645.5958783327318 , 135.0978109566176 },
-  { 201.61668693453248 , 230.4567897524144 },
-  { 555.7027679637913 , 204.90538411860308 },
-  { 400.3510608679378 , 223.12025658287607 },
-  { 527.9902896370621 , 113.23085495806028 },
-  { 341.08737952135874 , 419.57137529193074 },
-  { 208.65690849043625 , 113.73279331131971 },
-  { 604.139775023878 , 138.23756331936522 },
-  { 491.66051626361974 , 221.46783655001335 },
-  { 357.3465988514998 , 409.4114874465539 },
-  { 531.979842425212 , 55.22705659066257 },
-  { 308.3417019865974 , 160.21657592017925 },
-  { 387.3523860432681 , 374.89377782734675 },
-  { 200.26252751659166 , 213.2505629426394 },
-  { 140.9403028193671 , 27.05949052211635 },
-  { 241.28138455115135 , 151.09670693376404 },
-  { 613.4685739377144 , 182.4498047696319 },
-  { 92.46750145976561 , 11.023087785269809 },
-  { 321.53735754275715 , 513.4090755767228 },
-  { 307.09860031005826 , 314.96466906462683 },
-  { 221.05425181838115 , 178.93696673011965 },
-  { 347.9354952727805 , 272.20926671691956 },
-  { 566.4756936934835 , 58.69233678983248 },
-  { 606.9884029338922 , 121.21483416717268 },
-  { 603.0032892603363 , 193.67244859915283 },
-  { 502.3785578328967 , 108.70596253034094 },
-  { 452.7845957584311 , 82.64398551546309 },
-  { 258.46322911268055 , 13.920553989258138 },
-  { 248.11126624509512 , 2.3171240548346006 },
-  { 522.1593145580628 , 154.4836098431782 },
-  { 225.86313530021124 , 222.3686338933789 },
-  { 77.15985208516803 , 119.94267266615513 },
-  { 697.4165851201233 , 196.52338319237543 },
-  { 162.63813638582025 , 189.16162247772672 },
-  { 389.2719762273049 , 484.86702581759823 }
-},
-{ //#4
-  { 383.4436175529294 , 215.96604210950431 },
-  { 287.2441959646673 , 269.29025224039896 },
-  { 345.5300158376775 , 176.01344214415366 },
-  { 395.8800365467265 , 252.08402543062394 },
-  { 396.6316592362237 , 280.7873379152082 },
-  { 505.80303361055684 , 255.92262107293203 },
-  { 530.5454000778385 , 148.751657647204 },
-  { 610.9869937189311 , 223.76465727047827 },
-  { 547.8993214846796 , 313.8631906218245 },
-  { 398.751266927527 , 107.04645722861899 },
-  { 452.07547705842154 , 10.847035640356822 },
-  { 589.9999123174649 , 115.79548336306972 },
-  { 637.7163635035665 , 124.00929117992226 },
-  { 362.2571955879415 , 349.7318458814915 },
-  { 489.6135016116694 , 407.1400007180698 },
-  { 470.6405526165357 , 56.506281878886824 },
-  { 462.56380219217766 , 292.3715162762894 },
-  { 466.160822130421 , 240.2655152284137 },
-  { 303.0020239118369 , 290.9790417327785 },
-  { 697.6602965081344 , 156.04805159940906 },
-  { 680.4540696983594 , 47.412211017349875 },
-  { 649.4438540728038 , 254.90640875185443 },
-  { 788.7730744521721 , 66.51177407893555 },
-  { 618.5401118688861 , 232.45352576619416 },
-  { 725.7110752946141 , 207.7111592989124 },
-  { 631.9445209500183 , 341.62367698522314 },
-  { 535.0318523931393 , 163.42618195040984 },
-  { 183.2466078344985 , 233.48101093165627 },
-  { 235.80794594959946 , 168.34092759703736 },
-  { 347.73898728374417 , 391.45990661888817 },
-  { 704.2638038151764 , 282.0504771434885 },
-  { 300.6259023844761 , 197.08902543062393 },
-  { 381.6567734052352 , 121.15678177853596 },
-  { 557.2747698624739 , 48.99629155664806 },
-  { 469.0397726250911 , 239.93750025253306 },
-  { 253.3376107070562 , 334.4241965068939 },
-  { 558.6352644075833 , 140.20814999787697 },
-  { 507.36380134023716 , 342.24646739221464 },
-  { 752.6552965081344 , 60.79391743715867 },
-  { 219.9915171831342 , 218.8191091341126 },
-  { 503.40053911421984 , 246.63286414352362 },
-  { 559.6619316631328 , 33.71524251340217 },
-  { 505.57771290090864 , 342.9500263388409 },
-  { 242.5550271753699 , 359.3019428164344 },
-  { 474.7962044522525 , 130.0982377248775 },
-  { 424.65020047692576 , 99.60796797736852 },
-  { 290.83306243920975 , 256.3492178047016 },
-  { 324.54293443621134 , 283.9826160515622 },
-  { 624.4647464633803 , 164.73464247637722 }
-},
-{ //#5
-  { 399.25001539018956 , 127.91137927867004 },
-  { 290.6141748081304 , 145.11760608844503 },
-  { 374.8714031067868 , 215.81781527786748 },
-  { 447.4664578255202 , 29.05302212622466 },
-  { 531.7236861241765 , 99.75323131564711 },
-  { 403.33890987761305 , 109.57563364433288 },
-  { 188.63322264432944 , 186.32058529826122 },
-  { 251.720894878581 , 276.4191186496074 },
-  { 280.59157170256145 , 272.46685313722435 },
-  { 615.9809144228329 , 170.45344050506958 },
-  { 441.06503750328056 , 303.6597350279692 },
-  { 608.3083998757165 , 60.731370616991526 },
-  { 285.8876238954863 , 280.4683151775166 },
-  { 478.22819446702886 , 178.19901971347718 },
-  { 720.5876206501368 , 204.44221971637003 },
-  { 718.281647865968 , 62.65096080102834 },
-  { 431.8064166484393 , 215.8178152778675 },
-  { 297.3847095702955 , 389.855778449073 },
-  { 239.09888969728533 , 483.1325885453183 },
-  { 335.6223042065439 , 196.24893643353624 },
-  { 251.72089487858096 , 166.4291186496074 },
-  { 382.0870454837484 , 333.7925253084112 },
-  { 569.3424816885669 , 203.11002267588918 },
-  { 225.59657170256148 , 367.72098729947476 },
-  { 608.710193022857 , 53.06470065621345 },
-  { 506.0256819124298 , 92.48159142670102 },
-  { 817.9664413621291 , 16.16717819216875 },
-  { 198.36879903981315 , 205.02245354974784 },
-  { 908.0649747134753 , 79.25485042642029 },
-  { 428.1956132376814 , 312.0172368661296 },
-  { 296.45785825048824 , 65.94825376349775 },
-  { 641.2951409672876 , 90.16697117083217 },
-  { 563.8816499266303 , 204.93719142402136 },
-  { 355.7184830087498 , 240.60987734086467 },
-  { 212.19216262142933 , 258.5508360804457 },
-  { 316.3015922382622 , 137.92536623043748 },
-  { 200.08371768776087 , 263.54452438816077 },
-  { 381.1127887284755 , 229.83619690429734 },
-  { 416.7225670142814 , 269.3848623188062 },
-  { 484.71066563444236 , 221.57424710502886 },
-  { 183.72465585060306 , 364.79301771398036 },
-  { 542.8786943666779 , 89.21524050217671 },
-  { 293.99598078369365 , 163.29670191819537 },
-  { 521.2047112895641 , 279.44534854471107 },
-  { 159.40293730606768 , 455.5629070495765 },
-  { 557.3483791062771 , 101.79354554669204 },
-  { 186.73578836241018 , 58.27573921638145 },
-  { 393.85679780289485 , 259.4812337760505 },
-  { 791.2878298395593 , 288.6994480150264 }
-},
-{ //#6
-  { 329.9364956562906 , 328.60047032915867 },
-  { 362.09445945874444 , 223.4165102207844 },
-  { 383.0815408602106 , 331.38568412819296 },
-  { 437.9056695636992 , 349.58755173062485 },
-  { 365.93305510105256 , 113.49351315695407 },
-  { 491.4005456140234 , 350.48524718977865 },
-  { 406.34196982307566 , 249.48028568991037 },
-  { 543.6348434999549 , 379.9049044969366 },
-  { 309.28401724169566 , 207.77334456117939 },
-  { 308.3401622275971 , 299.41470075626313 },
-  { 329.9364956562905 , 170.36010105066217 },
-  { 384.67771868092655 , 323.8762578927712 },
-  { 377.32510903304916 , 221.54642160053737 },
-  { 272.53092091885446 , 403.41228888643195 },
-  { 350.9235770577568 , 436.5696442365672 },
-  { 439.65856554436857 , 162.68758650354587 },
-  { 438.76549680785854 , 502.763278633061 },
-  { 508.3229219868766 , 290.6832648997265 },
-  { 479.9396452164865 , 331.21878504416895 },
-  { 281.99320757049935 , 363.29314866325876 },
-  { 494.06518195248293 , 312.37917221796204 },
-  { 445.41499737153 , 52.848323975890295 },
-  { 257.2508411032176 , 256.12218523753074 },
-  { 637.9146749041802 , 323.2558666375797 },
-  { 473.1800742115568 , 394.4733563624445 },
-  { 520.6741712494904 , 419.10199915105886 },
-  { 464.63199584188897 , 222.29920016328361 },
-  { 572.1850209848037 , 391.1236325054718 },
-  { 459.8431619386421 , 421.2619948619696 },
-  { 432.8941611162572 , 225.01790074032584 },
-  { 224.75253554791635 , 296.4425065267049 },
-  { 556.4834125582331 , 523.0995872812277 },
-  { 656.1682060543942 , 476.61580467236814 },
-  { 567.8060197808085 , 429.6054318290269 },
-  { 373.1806330061174 , 214.48879462121482 },
-  { 539.616988049354 , 449.343604342224 },
-  { 336.244846152501 , 39.443914894758095 },
-  { 561.5092007373951 , 244.13568199833148 },
-  { 477.01866985386494 , 284.5503592986142 },
-  { 506.514200737395 , 148.8815478360811 },
-  { 573.139044968282 , 276.88757179636787 },
-  { 604.4857175599303 , 345.3820108295654 },
-  { 420.7003364246009 , 434.74247548843505 },
-  { 336.9740544339414 , 202.10447727403346 },
-  { 334.0270336353976 , 502.4590811595042 },
-  { 626.417589229371 , 432.64332990913607 },
-  { 470.1573638388117 , 160.01928740161833 },
-  { 430.69740316846867 , 434.0359549676264 },
-  { 420.22294877245895 , 62.01747980613976 }
-},
-{ //#7
-  { 532.0290254463023 , 7.4439644743253375 },
-  { 537.7854572734636 , 117.28322700198092 },
-  { 522.4778078988661 , 226.20281188286623 },
-  { 428.67223408606026 , 45.06276003871565 },
-  { 647.7084543372939 , 113.44463135967285 },
-  { 415.7549809657693 , 252.81180117987367 },
-  { 313.0704698553421 , 292.2286919503612 },
-  { 419.31265148887667 , 320.6961987211875 },
-  { 320.50084680351887 , 307.8068011798737 },
-  { 396.44444461583134 , 428.28265332589876 },
-  { 318.5812566194821 , 417.78004917012515 },
-  { 219.25451797228496 , 264.8302843573385 },
-  { 380.4056942648217 , 400.05217694819083 },
-  { 411.46600727628527 , 153.69860062077484 },
-  { 376.8670764924923 , 511.05685926637045 },
-  { 718.4086635267164 , 29.187403061016454 },
-  { 171.03807553695432 , 363.68864150978385 },
-  { 775.0577013860733 , 123.46723446524177 },
-  { 210.4549663074419 , 466.37315262021104 },
-  { 279.67391611901354 , 551.8514369208633 },
-  { 476.2798298207162 , 208.46906960730996 },
-  { 628.6088912757083 , 5.125626605860106 },
-  { 437.6474238256475 , 530.2636054896997 },
-  { 339.3495067989842 , 331.9319858191219 },
-  { 90.59648189586177 , 438.70164113305805 },
-  { 148.55430878286248 , 180.5730560586821 },
-  { 312.18721631717494 , 498.98286251532124 },
-  { 412.75573801078804 , 233.8753264299826 },
-  { 449.65931548752644 , 153.0319339461242 },
-  { 477.34794137860194 , 555.7938226382777 },
-  { 181.63572240789466 , 368.18707571758057 },
-  { 677.0558937905947 , 73.53281939888907 },
-  { 208.46376362803815 , 326.2174711616617 },
-  { 341.1795435717609 , 460.66559431553424 },
-  { 382.8874255065974 , 414.72563421666484 },
-  { 357.9720248966378 , 129.31998833737202 },
-  { 255.49358438523055 , 507.8785825214714 },
-  { 715.2821940649117 , 72.84223227692925 },
-  { 567.4844389474837 , 63.946559254074174 },
-  { 531.675197638741 , 167.94414738424302 },
-  { 773.1381112020365 , 233.44048245549322 },
-  { 309.9251882173203 , 332.1932843959967 },
-  { 233.19013351015394 , 452.1666434247022 },
-  { 596.0754832922769 , 144.4643125286076 },
-  { 324.43847808065925 , 232.67232055488472 },
-  { 147.64694319659418 , 263.58036949027667 },
-  { 671.0601132559044 , 159.27647577398446 },
-  { 394.3445067989842 , 427.1861199813723 },
-  { 465.8508557037927 , 446.4063593667213 }
-},
-{ //#8
-  { 572.7319057124392 , 379.34150594032843 },
-  { 493.611721073191 , 455.74698010711353 },
-  { 468.12519948513534 , 345.35272672902795 },
-  { 608.5411470211818 , 275.34391781015955 },
-  { 679.9028691381673 , 354.5991394730467 },
-  { 787.4893237428785 , 331.7309326000013 },
-  { 556.9039698303617 , 178.2285120716062 },
-  { 383.68872400936067 , 451.90838446480547 },
-  { 448.58496507654894 , 159.1289490100205 },
-  { 709.7874758524157 , 232.36740098762422 },
-  { 779.0064256639873 , 317.84568528827646 },
-  { 659.5884809407889 , 138.81162130111858 },
-  { 489.18736415929254 , 91.55520928240283 },
-  { 431.37873826677395 , 267.7647895920797 },
-  { 657.6688907567521 , 28.838373310867112 },
-  { 481.5148496121762 , 201.27727917048088 },
-  { 714.583480940789 , 234.065755463369 },
-  { 422.99372976279875 , 179.39712903250455 },
-  { 530.3903433691087 , 193.53616144620378 },
-  { 724.6398325100746 , 254.11827458693705 },
-  { 324.9919221673201 , 129.46271396615185 },
-  { 415.3212152156824 , 289.1191989205826 },
-  { 825.1081193072688 , 435.08772396024335 },
-  { 624.9550390139135 , 300.6020571957966 },
-  { 551.4267091232175 , 0.37086654004090036 },
-  { 426.8183008904916 , 398.506662192139 },
-  { 706.8464930653214 , 400.8561920169791 },
-  { 838.9112731252901 , 410.0910610565936 },
-  { 553.6713026265833 , 64.64761461960981 },
-  { 426.39275523893986 , 157.7269201374611 },
-  { 502.29896538764723 , 303.81142458098583 },
-  { 574.36738111867 , 373.8202334998542 },
-  { 839.1265009336986 , 428.8463383385547 },
-  { 763.6987762893898 , 208.92610040739112 },
-  { 665.3414053038686 , 138.56044319894517 },
-  { 594.8580499044249 , 412.7704632845782 },
-  { 372.1794909097638 , 80.0087643707723 },
-  { 704.997220795974 , 343.6372103064801 },
-  { 321.74740093156487 , 222.3736458550398 },
-  { 436.11051196488336 , 250.18519930556067 },
-  { 900.632128386446 , 337.6604957332256 },
-  { 780.62545325228 , 503.3678711528389 },
-  { 468.88471591636124 , 284.72200405153285 },
-  { 403.89416670121307 , 71.0781242786918 },
-  { 679.4547326455361 , 352.732516643321 },
-  { 514.5988024746571 , 347.77780619970497 },
-  { 524.1578407150024 , 497.0276915832346 },
-  { 664.8404191369444 , 257.1425428427217 },
-  { 317.31940762020383 , 339.0536139869354 }
-},
-{ //#9
-  { 233.19993134535773 , 371.0502456932278 },
-  { 281.41637378068833 , 469.90860284567316 },
-  { 123.62847650224664 , 380.63650583804275 },
-  { 208.457564878076 , 263.8792822674998 },
-  { 185.13410395499403 , 289.4506632327137 },
-  { 295.05710101882437 , 293.28925887502174 },
-  { 318.43081286832745 , 265.79887245153657 },
-  { 76.81509920118128 , 270.351100171128 },
-  { 356.5627284715718 , 384.47510148035076 },
-  { 465.9501917431282 , 372.97801580554153 },
-  { 329.9278985431367 , 375.18633572309295 },
-  { 553.7921114932299 , 439.1716502020353 },
-  { 376.4116811519962 , 474.87112921925404 },
-  { 98.88611003496491 , 273.46554241231473 },
-  { 78.73468938521806 , 160.37785218087652 },
-  { 659.5212854294856 , 469.48900296834705 },
-  { 443.08198487008286 , 480.5644704102528 },
-  { 238.43985695815314 , 571.154931676907 },
-  { 313.6415249864503 , 446.063245316502 },
-  { 89.87996979274364 , 234.45566323271368 },
-  { 277.8508742090494 , 401.92509945708093 },
-  { 302.1444393116411 , 555.4507085880584 },
-  { 232.26431708430584 , 363.4302790282677 },
-  { 500.4679013623353 , 535.3710717902975 },
-  { 343.6238170665274 , 603.3128954793608 },
-  { 469.7887873854363 , 263.0550187417112 },
-  { 431.90885070693764 , 416.3893149329091 },
-  { 57.71553613959562 , 378.67010492494074 },
-  { 133.40595993186045 , 315.2138365929371 },
-  { 213.95673149028914 , 399.5794627076425 },
-  { 712.8454955603802 , 373.2895813800849 },
-  { 576.6603183662751 , 331.58519559732406 },
-  { 372.1307056132747 , 345.27606159772404 },
-  { 88.32094953003295 , 50.80639733776543 },
-  { 510.68715511503547 , 473.4588806916512 },
-  { 163.536609934614 , 184.48176320101425 },
-  { 360.6186361664073 , 276.4594278228434 },
-  { 94.07738135719435 , 160.645659865421 },
-  { 221.45942562541356 , 375.0277582292803 },
-  { 624.4923206826523 , 354.9144219033789 },
-  { 365.4693268570185 , 328.2410524336343 },
-  { 385.0218376347774 , 426.66746592436266 },
-  { 615.2977389459774 , 530.3574928073643 },
-  { 451.1076003828027 , 399.7547594315477 },
-  { 402.4480583795865 , 239.54688766146836 },
-  { 375.43557748996244 , 317.09601108125156 },
-  { 219.82789809050877 , 327.31229570714817 },
-  { 345.1182247236507 , 422.82518501750724 },
-  { 161.71312426976448 , 414.4793462336834 }
-},
-{ //#10
-  { 520.353331029285 , 195.1260469658506 },
-  { 465.35833102928495 , 290.380181128101 },
-  { 629.924785872396 , 204.71230711066553 },
-  { 388.95285686249986 , 211.2599964888528 },
-  { 678.1412283077266 , 105.85394995822016 },
-  { 624.3509191594537 , 159.31680565710786 },
-  { 748.8414374971491 , 21.596721659563755 },
-  { 585.8958525394094 , 45.94910249691733 },
-  { 623.1462283077266 , 201.10808412047055 },
-  { 597.7668220699422 , 309.8962672190398 },
-  { 610.4246226366574 , 192.52725274742352 },
-  { 498.94285686249987 , 211.2599964888528 },
-  { 477.2600119573502 , 63.15532930669233 },
-  { 553.6507099700312 , 75.05957735845149 },
-  { 304.69562856384346 , 281.9602056782753 },
-  { 424.76209817124254 , 315.25758461902166 },
-  { 414.66887655409494 , 280.0406154942384 },
-  { 382.98018055312485 , 119.80436716604922 },
-  { 731.4652330615393 , 182.00852105888478 },
-  { 447.40852833649666 , 103.52708412927778 },
-  { 219.21734426319125 , 212.74125586670368 },
-  { 533.6816830521278 , 299.949935244424 },
-  { 568.6896257296344 , 154.58494307897652 },
-  { 350.2931225979433 , 51.88990693845765 },
-  { 467.99308668498946 , 183.84119390597624 },
-  { 373.11295526096774 , 350.2850285894038 },
-  { 583.9762623553726 , 155.92235048716879 },
-  { 412.664802471252 , 260.9731242768092 },
-  { 458.75087738254297 , 210.6508783917177 },
-  { 664.3492075175427 , 303.0890362842715 },
-  { 611.0249973866481 , 399.2884578725336 },
-  { 317.5911347455145 , 290.51521815173993 },
-  { 578.393076437313 , 182.2305407841795 },
-  { 719.3440021404608 , 380.1888948109479 },
-  { 547.7025443281682 , 262.5541169863851 },
-  { 714.3817887468902 , 361.66966230814336 },
-  { 275.86638212254815 , 307.021087270929 },
-  { 260.4203234730074 , 314.72220803050465 },
-  { 433.303629326646 , 124.04983953712352 },
-  { 396.77690520680284 , 151.57470043461876 },
-  { 546.7407541409415 , 121.98789948122234 },
-  { 394.1000366624339 , 458.25420249681235 },
-  { 281.78189343677184 , 186.51763002157108 },
-  { 456.5353042314779 , 23.4224001676314 },
-  { 639.219857293222 , 241.9133685201876 },
-  { 493.784830158595 , 411.77041988795276 },
-  { 415.0871180639001 , 566.223376404221 },
-  { 575.348331029285 , 290.380181128101 },
-  { 495.6756837955967 , 396.1093550643567 }
-},
-{ //#11
-  { 342.2743381257682 , 446.2150227252463 },
-  { 317.53197165848655 , 553.3859861509743 },
-  { 452.19733518959856 , 442.3764270829382 },
-  { 373.9115153165883 , 349.0996169866929 },
-  { 365.7484140938172 , 652.2443433034197 },
-  { 249.8153659874174 , 466.7126833617709 },
-  { 240.22910584260248 , 576.284138204882 },
-  { 314.0951973916427 , 401.06364550241403 },
-  { 520.58481810579167 , 400.81622265776207 },
-  { 343.19476045322835 , 290.7446407486013 },
-  { 435.67997064448883 , 509.0615984260793 },
-  { 415.5337792539651 , 603.320401217327 },
-  { 362.09880183825237 , 505.46409931718983 },
-  { 376.59916953436056 , 192.5744895295723 },
-  { 469.87597963060585 , 250.86030940258252 },
-  { 238.8129819652421 , 352.18728922094454 },
-  { 267.02771469124946 , 182.9882293847574 },
-  { 350.4407647192196 , 761.163928184305 },
-  { 424.5367910327353 , 335.05064587913984 },
-  { 250.43212377238166 , 73.81807816572841 },
-  { 529.4941280391598 , 447.55597097333185 },
-  { 328.53334214399683 , 91.80238677942833 },
-  { 375.3346742386321 , 761.8157981465307 },
-  { 144.08619205116173 , 497.0300361280827 },
-  { 461.2161872440686 , 68.3149642974734 },
-  { 374.67957935032376 , 82.60124153932084 },
-  { 448.7589208225199 , 724.4042759020856 },
-  { 472.35344665573473 , 645.2840912628374 },
-  { 176.92918133990327 , 246.075901619009 },
-  { 292.8267812360133 , 658.0226375591405 },
-  { 374.711955176607 , 17.16904030637152 },
-  { 561.8327444846757 , 521.2280223485205 },
-  { 95.86974961583107 , 398.17167897563735 },
-  { 200.476455843135 , 432.16045818693783 },
-  { 520.0017088762792 , 314.1317115473348 },
-  { 154.561231825167 , 311.7176833617709 },
-  { 581.8311469370256 , 373.83970583522677 },
-  { 310.1163743233144 , 341.031062616872 },
-  { 349.9005636700745 , 772.6207183374162 },
-  { 315.1289330628647 , 200.97253799845734 },
-  { 435.1144945264044 , 451.0805691504939 },
-  { 360.1539097425278 , 258.53282394969887 },
-  { 259.8379690929863 , 339.3634363129916 },
-  { 511.078958840422 , 352.8412615663835 },
-  { 430.63926652874494 , 738.5609013590827 },
-  { 288.0062765611204 , 14.884635868251735 },
-  { 438.3726046716524 , 97.55881860658972 },
-  { 158.10812981036415 , 198.29587875935505 },
-  { 643.336774389773 , 465.0255484405558 }
-},
-{ //#12
-  { 595.9649090956557 , 178.0047208609014 },
-  { 286.7947578766267 , 51.40912994203356 },
-  { 407.1099643804656 , 237.8929125508931 },
-  { 691.978717985001 , 59.2511661395798 },
-  { 472.60811773541366 , 55.6235164252917 },
-  { 771.14886920403 , 200.1626846633552 },
-  { 178.4741237984064 , 180.6866857411181 },
-  { 581.5918969467141 , 280.2740163249408 },
-  { 707.8720591077847 , 131.87686479034502 },
-  { 172.74494986215075 , 251.0040385074299 },
-  { 257.93981316143663 , 231.29732163202527 },
-  { 231.03076973516096 , 344.28084860367517 },
-  { 340.3814068025292 , 106.28432200875108 },
-  { 193.8331542842203 , 79.60709267788292 },
-  { 74.74314226667214 , 201.0696234410772 },
-  { 346.8489135733555 , 272.52650364228566 },
-  { 382.7971697464579 , 127.21837125077624 },
-  { 797.792077843788 , 72.5438890989649 },
-  { 752.7860463948501 , 307.27809040190857 },
-  { 420.4481851367477 , 298.63402315399435 },
-  { 510.4866247950035 , 108.78577104932975 },
-  { 500.792875379672 , 220.75679359232726 },
-  { 267.2241649872129 , 286.32991961097974 },
-  { 215.27433790799952 , 134.44158607601958 },
-  { 253.8989766082063 , 451.86730320838643 },
-  { 392.6053454005169 , 392.36576616994125 },
-  { 340.20092095418994 , 357.6852576848073 },
-  { 690.8370751374464 , 207.4676085749104 },
-  { 659.5092362986048 , 348.9922705288984 },
-  { 475.40189092563867 , 324.2593570073509 },
-  { 797.9524808759998 , 259.1047857657305 },
-  { 192.39334915545882 , 360.6814606030574 },
-  { 534.2743837143739 , 363.61536414460363 },
-  { 141.2665103722333 , 319.0139273030944 },
-  { 814.5614701730073 , 365.82761269882735 },
-  { 315.3728712593457 , 171.35391384176796 },
-  { 513.7249952329929 , 240.34820328098405 },
-  { 117.71965908920737 , 302.3159522723111 },
-  { 242.6648824896638 , 324.68427387128696 },
-  { 366.80991025119744 , 464.40808461790414 },
-  { 215.72312036056343 , 235.36126372278983 },
-  { 254.48344921640933 , 177.4063631140191 },
-  { 233.20284978952938 , 150.81645674591562 },
-  { 388.7285881364353 , 256.5427513362818 },
-  { 413.1970824832159 , 273.14762929629217 },
-  { 453.04254796984924 , 194.68458389218392 },
-  { 288.24772325032563 , 301.2797147081891 },
-  { 281.97593263574413 , 97.16413736950287 },
-  { 558.3751870733004 , 275.22840020939213 }
-},
-{ //#13
-  { 293.7374966383075 , 126.88491847839371 },
-  { 254.32060586781992 , 229.56942958882092 },
-  { 383.8360299896537 , 83.797246244142116 },
-  { 489.01999009802796 , 31.63928244168836 },
-  { 108.2592123376553 , 396.10386828996536 },
-  { 380.1004052171427 , 16.331633067090753 },
-  { 553.6704899976771 , 150.62306165298884 },
-  { 461.4251142293599 , 60.71821419168601 },
-  { 192.81497841507243 , 168.3835869834919 },
-  { 116.0138365693381 , 256.00871575126814 },
-  { 494.7491640342836 , 201.3219296753765555 },
-  { 559.4269218248385 , 10.783799125333239 },
-  { 646.9473000939224 , 178.90888152599905 },
-  { 6.626373297781726 , 267.50580142607737 },
-  { 428.572993361561 , 164.27811113025177 },
-  { 293.3237567831224 , 336.4563733215048 },
-  { 202.654240942728 , 382.62715515633045 },
-  { 680.2274483349358 , 270.54087948694816 },
-  { 706.8521475552252 , 86.66350575768183 },
-  { 38.239161706629716 , 178.23404088855978 },
-  { 130.4845374749469 , 118.32919342725697 },
-  { 128.56494729091008 , 8.355945437005502 },
-  { 410.04658371621923 , 263.06536261851227 },
-  { 559.1053803438207 , 245.10251592249284 },
-  { 570.3881858072803 , 76.29731131410955 },
-  { 234.8682016346627 , 89.38104135686851 },
-  { 82.08116468205057 , 108.04073893316664 },
-  { 186.92506700647232 , 292.94450792264223 },
-  { 387.5809850817788 , 307.15658251092725 },
-  { 345.5624866328583 , 236.43804372891765 },
-  { 237.20078787296927 , 25.562172246780495 },
-  { 297.56732495596094 , 426.61711079384922 },
-  { 327.649240942728 , 37.37302099408005 },
-  { 509.2708797336314 , 370.5408794869482 },
-  { 616.753614203879 , 23.575833523430305 },
-  { 500.46933263005826 , 287.97096753473343 },
-  { 147.8106165497408 , 187.8203010333747 },
-  { 307.9440058338164 , 149.62008568110576 },
-  { 794.6940673053269 , 152.85714015417562 },
-  { 246.67471892376554 , 330.73620472573015 },
-  { 27.800026364519695 , 78.91230265676938 },
-  { 393.74650569696144 , 31.361978237726003 },
-  { 211.2679707315885 , 311.00371575126815 },
-  { 583.7925948884124 , 185.46746253313853 },
-  { 597.2806927121142 , 96.2497659024968 },
-  { 9.771654935803447 , 284.4762225220944 },
-  { 613.8775859609353 , 104.52965869824865 },
-  { 64.376659378518 , 353.1241214898215 },
-  { 507.1547590278385 , 131.1386479952561 }
-},
-{ //#14
-  { 93.45102046133854 , 123.62512330393153 },
-  { 356.5386926955901 , 73.52658995258533 },
-  { 761.14539892289406 , 207.5153691638858 },
-  { 560.0037560753394 , 175.73181159921643 },
-  { 293.45102046133854 , 273.6151233039315 },
-  { 215.67634559863018 , 351.3897981666399 },
-  { 120.6713455986302 , 256.13566400438947 },
-  { 336.4275372838738 , 374.8614521351654 },
-  { 749.8155027918354 , 131.81240982559552 },
-  { 240.22811569561168 , 428.18566226606004 },
-  { 453.65409843414346 , 21.8894127617652 },
-  { 403.02247530444964 , 264.02886315911655 },
-  { 519.8477328306373 , 109.73133251186694 },
-  { 512.9957232947011 , 262.10927297507965 },
-  { 617.8495404261158 , 59.79691744551417 },
-  { 185.86456585662728 , 296.48333017697684 },
-  { 458.51964485939106 , 114.72956916240149 },
-  { 215.48574922832998 , 535.356625691788 },
-  { 519.3668679445276 , 354.46829588377423 },
-  { 93.85232408542066 , 220.62445407798435 },
-  { 425.6663455986302 , 351.3897981666399 },
-  { 308.75866983593613 , 164.69553842304617 },
-  { 189.0673563016227 , 458.1126250997367 },
-  { 668.0910997025021 , 94.3158293072164 },
-  { 657.1191618138928 , 207.36898879003655 },
-  { 675.929950242079 , 169.77016543576565 },
-  { 293.06494443179156 , 493.92186640847933 },
-  { 499.2218968927118 , 210.70465302822197 },
-  { 327.3863610554355 , 439.0130620381509 },
-  { 186.51329406761894 , 104.79069096174334 },
-  { 465.48224985786203 , 393.19066226606 },
-  { 208.95223809087884 , 56.39479682563066 },
-  { 408.1758698864102 , 170.64199569113867 },
-  { 189.047390629576 , 188.64017259394785 },
-  { 569.9221060821343 , 294.96188132687837 },
-  { 276.88931037967774 , 122.44653819745406 },
-  { 339.8422548015839 , 129.89281964155873 },
-  { 228.311286432134 , 348.44829579877825 },
-  { 668.6162474887019 , 97.98152551848017 },
-  { 274.96972019564095 , 232.41978618770554 },
-  { 616.3075421378327 , 223.17418645966177 },
-  { 548.4833212318335 , 190.16276198026156 },
-  { 501.45267998265547 , 34.69700408704213 },
-  { 445.97585724153504 , 47.74546895067738 },
-  { 563.6273464243949 , 23.809002945802014 },
-  { 464.85769744940285 , 92.626153014171 },
-  { 159.78652205451914 , 503.19866188933423 },
-  { 405.9450867964665 , 152.4188331552118 },
-  { 259.42328695703674 , 21.889412761765193 }
-},
-{ //#15
-  { 571.73283992191 , 451.94220982833 },
-  { 593.2653331510837 , 345.70002819479544 },
-  { 520.0956627310899 , 354.82680408977666 },
-  { 511.10736934862985 , 240.51606808642117 },
-  { 581.73283992191 , 571.93220982833 },
-  { 674.4173510323373 , 631.3491005988176 },
-  { 474.61743418335664 , 603.5793870191502 },
-  { 342.3720584150394 , 443.67453955784737 },
-  { 401.93721812960086 , 253.92047716755334 },
-  { 603.2532747654159 , 510.7856138289252 },
-  { 482.0623539412676 , 407.6809803585964 },
-  { 503.18354696083475 , 296.89699399008856 },
-  { 551.0953109629621 , 625.9695739372995 },
-  { 347.8051256426112 , 318.3811895480189 },
-  { 784.3403480961676 , 597.5105049565095 },
-  { 507.3700033158652 , 556.6005652394817 },
-  { 362.2333909239629 , 169.1911367963638 },
-  { 614.501085568512 , 103.2669367836709 },
-  { 383.81634643131076 , 622.9878957753228 },
-  { 683.5132223281882 , 472.5420989370069 },
-  { 585.1372490030421 , 671.102361047359 },
-  { 572.7782586354152 , 176.6579474866635 },
-  { 640.9517897334816 , 326.4639255276778 },
-  { 490.1202879471636 , 132.5468941790126 },
-  { 403.4469851579602 , 64.83028850794351 },
-  { 407.53074078820964 , 550.8441334123204 },
-  { 402.37756044510644 , 401.1971977497369 },
-  { 273.8430984410593 , 621.068305591286 },
-  { 524.80174181288 , 475.4116186554296 },
-  { 685.2342269292168 , 561.9885930387413 },
-  { 300.5659253741561 , 524.4593162942786 },
-  { 776.6678335490512 , 487.78843506843145 },
-  { 510.16981209105705 , 38.22129921093604 },
-  { 411.6486140860825 , 138.1095255154853 },
-  { 415.631590593851 , 488.8160277365618 },
-  { 676.0470479556409 , 419.4214544109843 },
-  { 396.5320275322653 , 597.1350324903746 },
-  { 388.13933578336264 , 173.74987338882883 },
-  { 442.3209878683815 , 277.0521292270683 },
-  { 549.527967118319 , 451.4166051311075 },
-  { 448.9173087373474 , 30.565942015211675 },
-  { 587.627579602587 , 462.6633471159399 },
-  { 687.8217601134694 , 710.5192518178466 },
-  { 715.1622060963037 , 396.60259246310244 },
-  { 425.81583132686455 , 411.47584194913355 },
-  { 477.1231149946631 , 238.40037328847797 },
-  { 422.1235901373294 , 305.1665679860703 },
-  { 441.35410890008836 , 151.2359660571261 },
-  { 473.73103232643143 , 611.8666248946827 }
-},
-{ //#16
-  { 423.52789778881044 , 266.2918374042258 },
-  { 495.6878303874763 , 183.28133067552312 },
-  { 512.8940571972513 , 74.64549009346392 },
-  { 313.68863526115484 , 272.0482692313872 },
-  { 589.4941959909825 , 321.12325042562486 },
-  { 618.0780173056256 , 42.48752629101016 },
-  { 488.15169072996963 , 321.81645351919195 },
-  { 668.3723414979036 , 343.8644399050355 },
-  { 217.4892136728927 , 218.72405910049264 },
-  { 231.5305550112566 , 105.85463483489343 },
-  { 344.4077131495622 , 342.6973115710109 },
-  { 295.28837337772194 , 177.3871280640672 },
-  { 387.38422997209744 , 443.9436404022448 },
-  { 497.1062998601755 , 436.2711258551285 },
-  { 281.14204833856286 , 472.4111471730711 },
-  { 134.43446515931072 , 300.7777213869741 },
-  { 476.1192184587093 , 544.240299762537 },
-  { 401.10621883543513 , 624.6818934036296 },
-  { 236.43853924215364 , 321.7102301695448 },
-  { 187.7188365886191 , 414.77404018031933 },
-  { 153.7068782236754 , 224.48430988533931 },
-  { 468.2648611607177 , 366.7727022903355 },
-  { 567.2718753692178 , 105.41097935240681 },
-  { 413.2092637010902 , 121.12927270232345 },
-  { 291.1832217716048 , 628.5204890459377 },
-  { 320.076209710147 , 92.42194135736293 },
-  { 135.19221041091976 , 364.68674699208003 },
-  { 367.58869593838983 , 549.4003044066893 },
-  { 647.6517116878831 , 477.99811812900236 },
-  { 729.9154722378026 , 148.17837318452432 },
-  { 595.09410942793994 , 391.16845387063546 },
-  { 625.8053836464028 , 122.73929412367465 },
-  { 603.3064829407951 , 204.90120011762116 },
-  { 404.6758366492783 , 188.8842137388764 },
-  { 721.8785815965217 , 71.42220014110632 },
-  { 731.15729209240754 , 427.38671068398156 },
-  { 663.2113304020979 , 112.65582434930394 },
-  { 668.0124323719783 , 140.48933388648874 },
-  { 512.5116770001109 , 330.9423373038749 },
-  { 396.918908491803 , 159.569010471129 },
-  { 569.1607148594678 , 236.6625058996496 },
-  { 551.2393629642212 , 271.91498687053814 },
-  { 495.6880104960277 , 403.7869587788532 },
-  { 432.1211933440047 , 544.4245052883545 },
-  { 471.97606488727547 , 354.07383099089685 },
-  { 592.7583969572736 , 215.8052327304924 },
-  { 575.4358245864457 , 391.5150687576172 },
-  { 361.8834309610272 , 544.2632607472813 },
-  { 196.88482003990646 , 401.7109379836486 }
-},
-{ //#17
-  { 428.9853208940154 , 113.72455213426744 },
-  { 423.17607958527276 , 277.7221402644363 },
-  { 624.4224084165066 , 534.74562344190096 },
-  { 438.4837289598704 , 386.64172514532163 },
-  { 383.97232127074113 , 33.28295849317492 },
-  { 328.89624818104744 , 221.07310240507945 },
-  { 650.8247330230958 , 53.0071240876424 },
-  { 670.7477300869261 , 126.8457197299505 },
-  { 517.4559109894981 , 334.37117812379313 },
-  { 544.4636051946676 , 34.50560232269578 },
-  { 229.21145468488632 , 267.556885013939 },
-  { 553.509244133523 , 113.59023331715478 },
-  { 627.1069195269338 , 195.32873267141338 },
-  { 156.5803722189604 , 339.9295835502752 },
-  { 267.3906207283 , 312.2589450104085 },
-  { 185.9705136752625 , 103.348543426822225 },
-  { 443.4934323515845 , 493.45131420069197 },
-  { 357.4891540796462 , 445.3466172446601 },
-  { 296.1304015206394 , 27.089324096681153 },
-  { 468.0581310278825 , 183.62578696194404 },
-  { 661.1870784462643 , 305.9408043389747 },
-  { 122.17305827729274 , 279.35892227808966 },
-  { 255.3340433877266 , 472.53818015606203 },
-  { 538.1055055332636 , 250.13002630105254 },
-  { 694.21953538557443 , 213.54878402577435 },
-  { 540.3241178625434 , 441.9576327285044 },
-  { 617.1634814484728 , 462.6140946607024 },
-  { 236.98612954759466 , 189.78221015123063 },
-  { 241.7284960148764 , 102.61124672550261 },
-  { 347.7675787114595 , 124.20472983523452 },
-  { 336.69477397664053 , 348.5778720896613 },
-  { 477.73722335822345 , 229.0056523286164 },
-  { 346.51080536754824 , 488.6644191771936 },
-  { 139.18470267513777 , 165.6372948299021 },
-  { 438.95342131678854 , 62.69910238248702 },
-  { 563.6472640573323 , 342.9293011645413 },
-  { 653.3831900755529 , 89.19795294809813 },
-  { 483.17470223717237 , 547.2208008880064 },
-  { 247.28671382534986 , 168.9416932071418 },
-  { 223.97562281889196 , 117.62227755256473 },
-  { 581.8139813481218 , 353.6303154494019 },
-  { 250.65217297290616 , 72.56755264441438 },
-  { 578.8904770916031 , 96.47037551896803 },
-  { 265.78315033777847 , 291.7631623150316 },
-  { 544.1627135048515 , 551.8806297923347 },
-  { 146.65458484273734 , 36.758311335671706 },
-  { 185.65212137404143 , 238.6612696169977 },
-  { 417.77111749333693 , 287.8873955149336 },
-  { 487.5136756454946 , 646.16046119656 }
-},
-{ //#18
-  { 383.132009809137 , 143.10107732303027 },
-  { 324.8461899361268 , 236.37788741927557 },
-  { 450.84861548020615 , 229.77438011223362 },
-  { 545.1284468844315 , 173.12534225287672 },
-  { 282.65114492302735 , 187.83804069493755 },
-  { 136.40896328949276 , 216.30554746576382 },
-  { 447.7825097087861 , 432.08485653433075 },
-  { 188.37131351880203 , 131.1890028355807 },
-  { 524.1413654829653 , 65.15616834546817 },
-  { 634.1146134732168 , 67.07575852950498 },
-  { 464.23651802166245 , 357.40154411378535 },
-  { 630.6067311850837 , 242.34429206444833 },
-  { 649.1260350146003 , 137.31610094413395 },
-  { 415.2899736115908 , 248.28503743140453 },
-  { 365.925782999362 , 451.73691790508946 },
-  { 537.3299210888384 , 300.63011193745854 },
-  { 695.6202409259643 , 258.26160113483402 },
-  { 465.8555456099551 , 258.4329784417135 },
-  { 804.7903921449932 , 171.6660102159662 },
-  { 741.7010680779281 , 44.20755165645957 },
-  { 417.09156570444395 , 346.2827348805784 },
-  { 214.8729419458753 , 238.29747760331236 },
-  { 700.498088868112 , 146.1885038202605 },
-  { 529.9688001194544 , 453.3689059454485 },
-  { 285.4292991656392 , 113.69337630884837 },
-  { 206.84438234064817 , 56.44347235292287 },
-  { 567.5875956838446 , 24.01211458520642 },
-  { 354.6482489772108 , 48.21509200819615 },
-  { 578.5329002986546 , 402.6110641012595 },
-  { 138.79016772510238 , 112.94875610552178 },
-  { 190.39774250079324 , 320.9122536930678 },
-  { 259.6099053177826 , 338.778342489422 },
-  { 316.43161645914546 , 296.50147986673517 },
-  { 458.60381647254417 , 114.66261448485555 },
-  { 422.8950366517314 , 22.17965152293298 },
-  { 332.27946688288813 , 392.4449700300704 },
-  { 394.59945038466816 , 147.09778538998054 },
-  { 324.6069523357718 , 210.72290014199234 },
-  { 302.71486169597705 , 172.10384320681857 },
-  { 249.39065156508246 , 75.90442161855643 },
-  { 586.2054148457709 , 292.88899421318143 },
-  { 321.83743154219354 , 241.2877348805784 },
-  { 256.0027859355317 , 255.57551354739752 },
-  { 696.1284119096013 , 289.05039857087337 },
-  { 510.75346294150893 , 137.5290043439164 },
-  { 166.82270314467783 , 325.8770023088749 },
-  { 425.85328116700566 , 167.746383319457 },
-  { 574.8032380608063 , 167.98682461575015 },
-  { 364.54948380488736 , 57.28790214206323 }
-},
-{ //#19
-  { 539.7188854931592 , 345.6188786704811 },
-  { 410.7993006122739 , 350.3112292958835 },
-  { 627.5608052432609 , 411.8125130669749 },
-  { 482.436477803094 , 427.42663503443686 },
-  { 639.9694518313029 , 173.71563837701564 },
-  { 443.77003024304076 , 290.39142824612105 },
-  { 456.7083787644565 , 173.45894607181515 },
-  { 358.29174594238856 , 221.17247843454942 },
-  { 298.3868984810857 , 313.4178542028666 },
-  { 300.3064886651225 , 423.39110219311806 },
-  { 646.2116334648375 , 315.2481316061894 },
-  { 516.277584912926 , 261.0922794843118 },
-  { 363.39416089937407 , 513.4896355444642 },
-  { 248.90428267083217 , 232.66956410935865 },
-  { 208.83880240968324 , 500.16513438869544 },
-  { 192.25524481147528 , 138.38973270513333 },
-  { 531.6119499931425 , 185.19779384962726 },
-  { 282.35377816282147 , 75.30206047088173 },
-  { 467.3917490295429 , 549.2988768532069 },
-  { 317.65295980435417 , 147.659506935948 },
-  { 391.49233127045153 , 484.8967296458655 },
-  { 489.28039605077583 , 584.1781340119696 },
-  { 536.238385474586 , 103.3285414221526 },
-  { 255.56952529321526 , 523.8719670792277 },
-  { 168.89622250401192 , 591.5885727502969 },
-  { 617.974545098446 , 102.2410582238638 },
-  { 234.5589710054579 , 322.5160965293386 },
-  { 720.8376153395061 , 353.52669319396455 },
-  { 641.4223455829604 , 225.17057761969886 },
-  { 255.60723483196136 , 181.75558766406184 },
-  { 550.4022557582456 , 477.138944254541 },
-  { 581.5463650594952 , 622.1996014451058 },
-  { 376.7985699805063 , 622.6597867634932 },
-  { 166.6234556206609 , 246.40608756371097 },
-  { 205.07120157363636 , 370.5743518103685 },
-  { 153.96897103226775 , 373.6688166679714 },
-  { 423.00077481668075 , 202.80645961130162 },
-  { 405.973353085797 , 290.5496473298212 },
-  { 531.920359697566 , 187.49881023670397 },
-  { 754.8263945508065 , 458.13339942126845 },
-  { 186.15435657455936 , 128.62627060177635 },
-  { 591.2613482145767 , 625.3811132217858 },
-  { 307.23510297179513 , 414.19652045644307 },
-  { 483.52396422361437 , 474.33887148431404 },
-  { 266.11050948060716 , 341.30540469141783 },
-  { 84.28607090406672 , 117.40265130366717 },
-  { 350.3682123142006 , 556.5136846595075 },
-  { 228.9982455349539 , 288.4784145971587 },
-  { 147.25974618069532 , 362.0760899905695 }
-},
-{ //#20
-  { 296.51056508447607 , 321.7865845019826 },
-  { 567.2107742738986 , 406.043812800639 },
-  { 492.6719694421679 , 211.86358743815225 },
-  { 601.11727131178 , 287.7978052906821 },
-  { 598.4011433784236 , 212.18094020446398 },
-  { 651.468002572555 , 335.3436036112165 },
-  { 686.5955556124321 , 218.57885547911044 },
-  { 400.4265936738507 , 151.95873997684942 },
-  { 674.7972288786099 , 428.9120196736843 },
-  { 389.31517808192586 , 449.48238300254258 },
-  { 780.5264028148656 , 459.22937243999604 },
-  { 360.84767131109965 , 143.24020136900796 },
-  { 622.2057742738986 , 501.2979469628894 },
-  { 661.8531891451504 , 111.40789205338244 },
-  { 743.244593471789 , 124.29902407488511 },
-  { 368.26862987139685 , 257.1427000852237 },
-  { 477.1570978320276 , 315.67601739903637 },
-  { 515.5401763152131 , 104.27713283344096 },
-  { 533.2219950625981 , 565.9484468625385 },
-  { 462.52178587317565 , 650.2056751611949 },
-  { 354.5526119657671 , 629.2185937597287 },
-  { 756.6490025529212 , 15.128872855856116 },
-  { 362.6353821326799 , 384.894967210608 },
-  { 543.8815479678436 , 358.21181048426183 },
-  { 281.5513971039127 , 228.8838390607449 },
-  { 728.4479559074332 , 529.7654537337156 },
-  { 324.23525919945536 , 523.489419823473 },
-  { 429.5656115890412 , 548.7770001186361 },
-  { 465.22982211009764 , 447.2467920104552 },
-  { 714.5817571572661 , 273.95458218560543 },
-  { 838.3875019071797 , 88.72654824926693 },
-  { 539.2876814771192 , 496.4495146657524 },
-  { 437.54199941240404 , 100.32156278602929 },
-  { 796.5688036026836 , 220.49844566314727 },
-  { 216.2325017913008 , 628.1083794612043 },
-  { 238.2004349632696 , 373.1636704649702 },
-  { 818.5464892587794 , 466.677781499464 },
-  { 295.2426335654764 , 184.11670377930326 },
-  { 486.2146494483981 , 643.0568315228614 },
-  { 527.0915128983803 , 217.67420980355777 },
-  { 363.2488699462967 , 406.043812800639 },
-  { 596.473002572555 , 240.08946944896613 },
-  { 436.03637195965655 , 9.13572018070029 },
-  { 439.3420778108242 , 351.3801129003008 },
-  { 606.4615842932893 , 85.01391341143164 },
-  { 455.05317387777757 , 315.22037879839434 },
-  { 618.8945475911178 , 438.65340412535437 },
-  { 514.6821562192245 , 536.8146498893268 },
-  { 636.202580139116 , 589.6703011950184 }
-},
-{ //#21
-  { 559.2786174318474 , 389.0318818121093 },
-  { 589.5959701981591 , 283.3027078758536 },
-  { 699.1674250412701 , 292.88896802066853 },
-  { 549.6923572870325 , 498.6033366552204 },
-  { 273.28688312024735 , 419.4831520159722 },
-  { 856.2828307798235 , 51.2517908298484 },
-  { 139.3053694415959 , 327.1122916280725 },
-  { 449.3053694415959 , 390.9514719961461 },
-  { 855.2024156607088 , 516.559440204446 },
-  { 405.5702774491782 , 526.1564548051756 },
-  { 906.2058278436539 , 245.0903864721565 },
-  { 377.14543684292994 , 307.94096526744346 },
-  { 288.16165763162945 , 243.29046536779435 },
-  { 474.0477359088776 , 494.28325505380053 },
-  { 232.0991426318209 , 499.5873125782053 },
-  { 525.3759527280662 , 557.8731324512155 },
-  { 913.8783423907702 , 135.36831658407843 },
-  { 802.8490364834119 , 407.4715909077662 },
-  { 847.9200079706436 , 151.81357637591123 },
-  { 379.7679045046523 , 437.6342171944437 },
-  { 693.593558328328 , 399.11194918459626 },
-  { 632.9737906447763 , 205.0470482705668 },
-  { 804.3513851496444 , 260.73100421821476 },
-  { 208.1152740276757 , 388.3308989961679 },
-  { 603.0003792792912 , 592.4728590948826 },
-  { 668.7830319535188 , 101.04946014039793 },
-  { 627.2147657625494 , 386.6594992360957 },
-  { 381.8212953354507 , 155.52803301314526 },
-  { 523.4023358016652 , 195.4607881257519 },
-  { 795.2794185968785 , 460.39803584675406 },
-  { 985.6440093018014 , 101.5464405811718 },
-  { 439.696980548531 , 143.332868143577 },
-  { 742.9470386350278 , 206.9666384546036 },
-  { 903.9152591789377 , 337.60426265652904 },
-  { 908.1254180276907 , 435.11713848190504 },
-  { 985.6440093018014 , 291.5364405811718 },
-  { 280.4891430845131 , 353.0125352558724 },
-  { 817.360495910607 , 322.7530746009398 },
-  { 600.8022474992516 , 144.32505380332907 },
-  { 198.9602340271741 , 228.09193343361977 },
-  { 444.81937634942113 , 313.2409703824376 },
-  { 767.0397951746692 , 103.47400277759735 },
-  { 502.41525440019905 , 303.42996203316045 },
-  { 127.8869267711359 , 217.14254943395838 },
-  { 742.7360478622693 , 39.65561257345746 },
-  { 69.1762629355214 , 328.92804666890964 },
-  { 415.74195161099567 , 235.71335636209136 },
-  { 667.3706450608674 , 481.077382738562 },
-  { 330.852813800587 , 456.6107957556701 }
-},
-{ //#22
-  { 476.39999893138435 , 394.8499664008053 },
-  { 476.39999893138435 , 284.85996640080526 },
-  { 388.5580791812826 , 218.6663320043115 },
-  { 278.5848311910311 , 216.74674182027474 },
-  { 168.61158320077965 , 518.66633200431153 },
-  { 58.77232067312407 , 224.4227638314729 },
-  { 74.07997004772167 , 115.50317895058758 },
-  { 303.0797948806304 , 149.44738219273987 },
-  { 459.25828837070503 , 134.4091037056551 },
-  { 441.4049989313843 , 19.59583223855486 },
-  { 10.992297813470081 , 25.404645599241405 },
-  { 721.0067051586883 , 450.8611871895048 },
-  { 209.8145624105958 , 320.6472841681125 },
-  { 560.10327805809516 , 48.20105336150597 },
-  { 211.89395227530136 , 87.94175473999243 },
-  { 281.46942545247776 , 298.3839190110949 },
-  { 102.22810780588453 , 297.77907729506717 },
-  { 300.8777314866018 , 23.291254840343285 },
-  { 123.14125962139248 , 388.36388983918164 },
-  { 397.07715307486393 , 76.6154649712379 },
-  { 698.59765060534772 , 139.38689596683503 },
-  { 332.68276928364116 , 488.23373877282376 },
-  { 118.57875241818135 , 2.5364387261959997 },
-  { 795.6513277626182 , 256.61931541601956 },
-  { 835.36091159081346 , 155.37201678723397 },
-  { 792.209240240127 , 338.8575545309741 },
-  { 515.9073262300619 , 228.68893510988042 },
-  { 597.8104730981694 , 378.7160168778031 },
-  { 640.31183073233754 , 102.66370606308033 },
-  { 221.99961677383786 , 436.5803322745123 },
-  { 543.387909594298 , 464.2179785497469 },
-  { 725.00267432479507 , 207.85733288429623 },
-  { 162.9878723195418 , 99.83823055232614 },
-  { 673.03753125127974 , 351.848268590971 },
-  { 938.29627688189055 , 169.68025409425104 },
-  { 578.9949984643134 , 138.5904017585342 },
-  { 948.75838807769215 , 83.63046413967368 },
-  { 868.5131674845341 , 100.53824632167456 },
-  { 371.3518523715076 , 327.3021725863707 },
-  { 652.3074944751833 , 479.52562792434446 },
-  { 319.11502251239125 , 384.94315508369215 },
-  { 632.319208595208 , 234.7898233467963 },
-  { 187.7302387868235 , 207.00919397805416 },
-  { 882.01007019104884 , 263.658231837411 },
-  { 56.87374323794666 , 224.13901953264678 },
-  { 705.19549505373357 , 276.6643084825967 },
-  { 412.5244467439659 , 435.3413371398336 },
-  { 586.2392614590399 , 290.61639822796667 },
-  { 293.57717750879925 , 549.52749772366235 }
-},
-{ //#23
-  { 199.7269293599168 , 344.3798544227555 },
-  { 246.2107119687763 , 444.06464791891665 },
-  { 217.70779764358554 , 553.452111190473 },
-  { 539.0397485430483 , 419.3222814516349 },
-  { 110.74315014861634 , 409.0303543224046 },
-  { 348.20989976207727 , 132.72669053276707 },
-  { 571.4648461310267 , 499.05964791891665 },
-  { 603.23050723430563 , 315.32469332146604 },
-  { 696.2007119687763 , 444.06464791891665 },
-  { 352.96193180583595 , 348.447111190473 },
-  { 387.94862873988626 , 299.37485442275556 },
-  { 244.6429270520232 , 627.5466742520587 },
-  { 483.12303973452472 , 353.96611456757046 },
-  { 145.52538865165008 , 472.1435813032546 },
-  { 124.14755922974854 , 299.8602031033756 },
-  { 312.9619318058359 , 189.67218464736027 },
-  { 24.06984735941296 , 341.3137486513355 },
-  { 239.37749673401056 , 232.39416377045018 },
-  { 323.29812884023715 , 488.35863363405605 },
-  { 10.665438278280824 , 232.1435974323065 },
-  { 243.03893474200555 , 93.51078028966833 },
-  { 425.2790810040381 , 529.5616128438722 },
-  { 639.14382013040438 , 497.0643655331827 },
-  { 108.83990985515099 , 190.9406182224903 },
-  { 13.585775692900597 , 135.94561822249028 },
-  { 146.71226309016464 , 529.044351339713 },
-  { 39.48134218414086 , 524.3352810749091 },
-  { 521.29196491138003 , 213.2668428478333 },
-  { 464.77743409626413 , 267.1084556830791 },
-  { 18.99565741909551 , 442.3710485505096 },
-  { 613.4369715798412 , 403.1347584241612 },
-  { 91.704982186894192 , 122.67209388237212 },
-  { 390.2757441226805 , 597.9173427474825 },
-  { 196.22977995807882 , 158.3032419226328 },
-  { 296.30992732543785 , 573.3506373166138 },
-  { 414.78743409626412 , 167.1084556830791 },
-  { 479.259523333981 , 662.5678426471317 },
-  { 366.9932611310279 , 436.28480274762694 },
-  { 466.1739599590278 , 445.98423810295344 },
-  { 165.48894771450784 , 66.66078681826495 },
-  { 738.95763885848183 , 588.9491988010158 },
-  { 520.75673911862862 , 160.68798468977198 },
-  { 695.8168356129315 , 291.78839981804424 },
-  { 117.5003900203399 , 623.1323018650929 },
-  { 556.55152561782023 , 594.8007831668743 },
-  { 722.1808816174076 , 522.9688268898208 },
-  { 276.5564576390508 , 310.55200000811203 },
-  { 788.3407534180293 , 552.3635559151476 },
-  { 48.59680651996267 , 77.67747796106933 }
-},
-{ //#24
-  { 450.08346431429135 , 29.030149395568785 },
-  { 357.83808854597413 , 88.93499685687158 },
-  { 265.5927127776569 , 148.83984431817439 },
-  { 918.9797313935287 , 40.71855442154099 },
-  { 233.4347489752031 , 254.02380442654868 },
-  { 728.9529793837802 , 412.63814460557781 },
-  { 181.79757178438297 , 156.90839868799532 },
-  { 556.9815389890073 , 179.65296948789373 },
-  { 280.5760648222222 , 11.53278484864552 },
-  { 214.3824304257284 , 99.37470459874724 },
-  { 131.3719236970257 , 27.21477200008134 },
-  { 555.2674244226656 , 61.1881131980226 },
-  { 478.8759764476105 , 238.79954896326974 },
-  { 557.2544277400193 , 4.2877829282870366 },
-  { 354.5764919889574 , 253.49034421782352 },
-  { 456.6964456984195 , 457.1514392922022 },
-  { 870.0043877945728 , 211.66897808413228 },
-  { 581.1854812859649 , 320.21317115092035 },
-  { 750.0064613781217 , 25.19155375326072 },
-  { 136.31934323664973 , 202.38662723572855 },
-  { 668.1498826125577 , 354.122963502673166 },
-  { 371.28952184289926 , 15.931342090224426 },
-  { 694.2842191987982 , 105.01994022477538 },
-  { 238.0578425909083 , 368.78895184231777 },
-  { 124.2645977561741 , 267.4282135076809 },
-  { 337.9653117120047 , 412.13076367848657 },
-  { 631.73198685073572 , 254.91020628347388 },
-  { 334.237364926247 , 177.88951784726902 },
-  { 669.7285312661998 , 17.519039206144438 },
-  { 23.78373287006444 , 312.16517687958816 },
-  { 797.9449737015303 , 116.37739635858982 },
-  { 282.4538073615776 , 449.03116069482364 },
-  { 715.7344506010562 , 257.2769811188254 },
-  { 725.017387417847 , 181.22738444303967 },
-  { 49.7428820568263 , 98.20926369610922 },
-  { 496.4827406945642 , 387.98467038596621 },
-  { 627.7230670491908 , 111.86485654246407 },
-  { 898.196038037026 , 123.76122083967905 },
-  { 427.05703835754576 , 174.41328115752378 },
-  { 115.31378917552337 , 97.223605191834224 },
-  { 317.9653117120047 , 512.13076367848657 },
-  { 417.4707782127308 , 283.9847360006349 },
-  { 156.4225615586279 , 372.61217361605514 },
-  { 512.5391069408165 , 132.02282034491793 },
-  { 855.77444826197745 , 42.11564905311445 },
-  { 307.54778114890047 , 287.82333164294295 },
-  { 542.8958672866817 , 480.47564942309683 },
-  { 411.6615369039882 , 387.9823241308037 },
-  { 26.329343236649734 , 202.38662723572855 }
-},
-{ //#25
-  { 340.88671886590174 , 249.18525624329928 },
-  { 340.7915663272045 , 156.93988047498206 },
-  { 243.77131312734838 , 280.82243343411943 },
-  { 243.77131312734835 , 190.83243343411942 },
-  { 134.383849855792 , 312.31951910892866 },
-  { 159.378849855792 , 477.57365327117907 },
-  { 365.8917188659018 , 394.4393904055497 },
-  { 66.66724418472285 , 398.992821898132 },
-  { 280.564692461121 , 469.0792807239265 },
-  { 410.89112938879015 , 18.6208757211693 },
-  { 689.53545105776811 , 291.40636729342066 },
-  { 628.7286386160035 , 182.9916218468055 },
-  { 309.90112938879014 , 48.62087572116931 },
-  { 228.92751527030092 , 566.1946864624799 },
-  { 29.630603596465285 , 383.6517430617379 },
-  { 428.7286386160035 , 292.98162184680547 },
-  { 44.93825297106291 , 492.57132794262316 },
-  { 241.05715264499534 , 380.0361247799978 },
-  { 214.64699522653973 , 103.6158757211693 },
-  { 163.17277076281414 , 53.58308911474002 },
-  { 552.4287435180246 , 59.82447473642867 },
-  { 455.3376279130109 , 76.26879491370863 },
-  { 427.6863770507429 , 166.9954381621567 },
-  { 750.9818714045989 , 341.43063201161647 },
-  { 530.203418380733 , 137.59914959913704 },
-  { 172.4789570794081 , 232.04316874006008 },
-  { 445.4934250932057 , 215.1964770319988 },
-  { 141.89574969979486 , 133.45797767774025 },
-  { 338.3149785418573 , 577.6917721372891 },
-  { 435.9071649483908 , 384.76793187510987 },
-  { 447.2345634227426 , 592.9994215118868 },
-  { 653.79794421394786 , 58.47896495988883 },
-  { 383.2492035715482 , 508.49617149441406 },
-  { 505.9755264355788 , 264.7819166725283 },
-  { 718.4134321121646 , 136.5078392379459 },
-  { 510.5136362152826 , 349.26736592786577 },
-  { 187.45925967175518 , 517.5469012614305 },
-  { 843.0516684489086 , 391.0911607895818 },
-  { 223.17108344313954 , 676.0339489901355 },
-  { 174.2536987894341 , 376.1246150250866 },
-  { 746.9901392617449 , 219.38394645339466 },
-  { 63.61938280776573 , 279.0450368344339 },
-  { 753.4264317354388 , 56.06624559685328 },
-  { 622.1493465819254 , 296.3004251042836 },
-  { 839.12081322769924 , 211.83865422281897 },
-  { 69.13081322769925 , 211.83865422281897 },
-  { 641.17262824858824 , 388.521773031974 },
-  { 483.384638097879 , 489.7581946680759 },
-  { 7.319457406672612 , 595.9281193028652 }
-},
-{ //#26
-  { 407.84778079362474 , 504.5225179696798 },
-  { 613.031740901999 , 536.6804817721336 },
-  { 701.12459088987 , 486.2366980966695 },
-  { 454.64080828101044 , 545.9214915928306 },
-  { 297.9247837297944 , 500.68392232737176 },
-  { 454.64080828101044 , 425.93149159283064 },
-  { 350.6432201508416 , 580.12225028408795 },
-  { 146.14122616512503 , 401.8255651749264 },
-  { 56.3787250521203 , 391.24169809666944 },
-  { 205.6996325240325 , 476.8385647982006 },
-  { 242.67404624343305 , 379.1351688826218 },
-  { 784.5638053448408 , 549.7600872351387 },
-  { 802.84278079362474 , 409.2683838074294 },
-  { 506.27798547183056 , 623.036897331384 },
-  { 116.3859918521852 , 329.4220410946655 },
-  { 536.9338321986125 , 342.2391099665006 },
-  { 604.2797930673091 , 642.9713123977367 },
-  { 407.29225801019845 , 305.84241887986263 },
-  { 359.0758155748678 , 206.98406172741727 },
-  { 192.7396311770803 , 281.13336128714326 },
-  { 372.0385394848821 , 400.52492983951095 },
-  { 628.1196748039415 , 280.73348251375313 },
-  { 263.4398403665027 , 66.87613298848686 },
-  { 732.1172629341104 , 316.54272382249576 },
-  { 716.8096135595129 , 207.62313894161042 },
-  { 630.5159659935348 , 415.3288032791156 },
-  { 270.5143060397886 , 203.3586864244349 },
-  { 505.294065605677 , 105.90800381350988 },
-  { 516.3787250521203 , 181.25169809666943 },
-  { 330.88678384341335 , 384.96260351911087 },
-  { 613.4528221992708 , 170.00434337722012 },
-  { 784.4781305313389 , 207.53568589373248 },
-  { 685.6127547979366 , 86.99383664851742 },
-  { 407.8104787010043 , 649.2790789649187 },
-  { 308.17680373841 , 297.3569978745965 },
-  { 318.46690974263936 , 112.14239212103644 },
-  { 540.1190925816626 , 476.702541781259 },
-  { 153.51684330267238 , 193.0375373461788 },
-  { 55.0218324342444 , 312.2158142848904 },
-  { 824.7757519487143 , 276.04547557000683 },
-  { 795.261764683131 , 607.6873972310332 },
-  { 838.134761557925 , 341.97201191887353 },
-  { 714.9110361243354 , 425.17856440455495 },
-  { 490.45004958975295 , 242.55431647033953 },
-  { 695.9169702581293 , 595.8559066591833 },
-  { 446.6220910512347 , 146.5625285468337 },
-  { 548.3976049158634 , 43.06096796663684 },
-  { 111.7854120707651 , 493.7039649495984 },
-  { 379.1501466218478 , 70.56491323420988 }
-},
-{ //#27
-  { 367.51221320899737 , 113.17359670513119 },
-  { 685.7737138547388 , 39.57592131172038 },
-  { 354.1078041278652 , 222.3437479241602 },
-  { 309.37084075595794 , 322.82461281026985 },
-  { 261.1543983206273 , 421.6829699627152 },
-  { 262.9055069816934 , 79.18481749383069 },
-  { 625.09100935173262 , 379.47365066962675 },
-  { 476.89967648055375 , 101.67651103032199 },
-  { 409.1830708094846 , 15.003208241118628 },
-  { 280.83891041979405 , 180.89020237620036 },
-  { 161.4696048244662 , 468.16675257157476 },
-  { 209.5812968507988 , 175.38423908209285 },
-  { 688.11864268382305 , 373.88692116734944 },
-  { 457.80011341896807 , 209.99551578413474 },
-  { 75.24123502638324 , 262.62870173045894 },
-  { 195.45838403576664 , 363.5600463442708 },
-  { 624.99247600038645 , 442.56132290387836 },
-  { 276.77603356505581 , 541.4196800563237 },
-  { 119.178122935871 , 148.74607253074936 },
-  { 397.5122132089974 , 531.5138991431892 },
-  { 426.12010472411527 , 379.1829733602743 },
-  { 357.5872831912886 , 421.6829699627152 },
-  { 558.2809783050777 , 165.2585524122275 },
-  { 131.84027331988995 , 322.53393550091744 },
-  { 40.735247701730074 , 513.2615320933008 },
-  { 211.40401989081894 , 566.1685601670533 },
-  { 681.9478715291993 , 305.3542546528629 },
-  { 779.46100092140654 , 22.675722788234992 },
-  { 601.21481586292805 , 253.7207838166152 },
-  { 403.0850151370062 , 467.0689971054677 },
-  { 248.7825941666612 , 267.36062475600863 },
-  { 177.1378732726796 , 22.3696945019454 },
-  { 637.07979648579686 , 116.03251414847705 },
-  { 445.29364673319424 , 283.84937537690763 },
-  { 152.82735472135604 , 214.56476159350888 },
-  { 683.4952673994216 , 213.8408335989694 },
-  { 90.66966276808283 , 611.2633396887794 },
-  { 197.4800487576056 , 83.87870199805118 },
-  { 150.30670254484116 , 522.8477922381157 },
-  { 301.27055517705423 , 22.034926018308198 },
-  { 784.78500603649235 , 303.1698660647513 },
-  { 34.1535627921317 , 352.7272350818052 },
-  { 762.13054865725474 , 152.86248120935164 },
-  { 90.48173378921314 , 67.0652343282801 },
-  { 46.49167952889148 , 623.1007946209564 },
-  { 493.81262016573334 , 339.5700075352251 },
-  { 784.68985349779518 , 395.4152418330685 },
-  { 78.35404326612031 , 409.90474073305876 },
-  { 10.22591459535519 , 118.87370199805116 }
-},
-{ //#28
-  { 483.4458996193333 , 399.7636084943845 },
-  { 374.52631473844804 , 415.0712578689822 },
-  { 296.6843949883463 , 581.26489226547596 },
-  { 35.47672571192476 , 338.7765270929184 },
-  { 349.53931436172223 , 95.5128515100747 },
-  { 572.4296788306337 , 335.11310859473537 },
-  { 177.51424376931732 , 467.86048318434376 },
-  { 604.5876426330875 , 440.29706870310963 },
-  { 282.2809389701308 , 474.97610533028495 },
-  { 695.7734852384166 , 501.80269615585706 },
-  { 242.16474366896642 , 556.8442623956443 },
-  { 228.95672883923623 , 378.7766837420228 },
-  { 690.0170534112552 , 611.6419586835126 },
-  { 362.0030088582089 , 567.30359078316866 },
-  { 483.52809357302266 , 245.90614528277075 },
-  { 277.17317127456687 , 279.9183265895774 },
-  { 530.9899672396767 , 522.0355680573682 },
-  { 713.6326580404499 , 367.09406075853633 },
-  { 637.7127941727736 , 548.6445573543757 },
-  { 783.2938635075005 , 639.9277785565228 },
-  { 278.3268931501859 , 361.7470477380876 },
-  { 430.47172571192476 , 83.522392930668 },
-  { 540.5762273844916 , 412.4641132142571 },
-  { 467.2457187222595 , 302.9551447922816 },
-  { 388.88113479305696 , 199.6063758738894 },
-  { 438.7089362474261 , 610.2444733804942 },
-  { 748.8952321383044 , 431.5636762758428 },
-  { 836.6180736383951 , 766.1272001447849 },
-  { 421.15070471202114 , 516.2791362302069 },
-  { 343.31876190947094 , 273.59256698454413 },
-  { 768.2334958465858 , 512.7836015310672 },
-  { 484.4275148082663 , 457.99331635719653 },
-  { 74.69950054057986 , 549.47689293144526 },
-  { 680.3988527380423 , 314.12602719326924 },
-  { 559.9335677398078 , 640.026329922019 },
-  { 575.19271885628564 , 240.5596798843331 },
-  { 836.2353034420644 , 462.8491864647145 },
-  { 329.28588310659575 , 202.01676547792056 },
-  { 889.9422837692897 , 862.326621733047 },
-  { 528.7513461750068 , 111.76930218695253 },
-  { 133.2451587880811 , 572.1519117702419 },
-  { 40.0730956653669 , 483.0382465707192 },
-  { 392.2541869603823 , 476.89569551432174 },
-  { 449.0479358457266 , 143.27521421823232 },
-  { 516.4048388742715 , 571.2741362302069 },
-  { 417.33445917652887 , 303.064225532669 },
-  { 86.32840116398827 , 406.35485573159633 },
-  { 793.0212399740593 , 560.1248632733652 },
-  { 151.18205397652787 , 301.0020088793144 }
-},
-{ //#29
-  { 520.353331029285 , 195.1260469658506 },
-  { 465.35833102928495 , 290.380181128101 },
-  { 829.924785872396 , 204.71230711066553 },
-  { 388.95285686249986 , 211.2599964888528 },
-  { 678.1412283077266 , 105.85394995822016 },
-  { 924.3509191594537 , 159.31680565710786 },
-  { 748.8414374971491 , 21.596721659563755 },
-  { 585.8958525394094 , 45.94910249691733 },
-  { 623.1462283077266 , 511.10808412047055 },
-  { 597.7668220699422 , 309.8962672190398 },
-  { 610.4246226366574 , 192.52725274742352 },
-  { 98.94285686249987 , 211.2599964888528 },
-  { 877.2600119573502 , 63.15532930669233 },
-  { 553.6507099700312 , 75.05957735845149 },
-  { 104.69562856384346 , 281.9602056782753 },
-  { 44.76209817124254 , 315.25758461902166 },
-  { 14.66887655409494 , 280.0406154942384 },
-  { 382.98018055312485 , 119.80436716604922 },
-  { 731.4652330615393 , 182.00852105888478 },
-  { 447.40852833649666 , 103.52708412927778 },
-  { 219.21734426319125 , 212.74125586670368 },
-  { 533.6816830521278 , 299.949935244424 },
-  { 568.6896257296344 , 154.58494307897652 },
-  { 350.2931225979433 , 51.88990693845765 },
-  { 37.99308668498946 , 183.84119390597624 },
-  { 373.11295526096774 , 350.2850285894038 },
-  { 583.9762623553726 , 525.92235048716879 },
-  { 892.664802471252 , 260.9731242768092 },
-  { 458.75087738254297 , 210.6508783917177 },
-  { 664.3492075175427 , 303.0890362842715 },
-  { 611.0249973866481 , 399.2884578725336 },
-  { 317.5911347455145 , 290.51521815173993 },
-  { 578.393076437313 , 582.2305407841795 },
-  { 719.3440021404608 , 380.1888948109479 },
-  { 747.7025443281682 , 262.5541169863851 },
-  { 814.3817887468902 , 361.66966230814336 },
-  { 165.86638212254815 , 307.021087270929 },
-  { 260.4203234730074 , 314.72220803050465 },
-  { 133.303629326646 , 124.04983953712352 },
-  { 196.77690520680284 , 151.57470043461876 },
-  { 786.7407541409415 , 121.98789948122234 },
-  { 394.1000366624339 , 458.25420249681235 },
-  { 281.78189343677184 , 186.51763002157108 },
-  { 456.5353042314779 , 23.4224001676314 },
-  { 639.219857293222 , 241.9133685201876 },
-  { 493.784830158595 , 501.77041988795276 },
-  { 415.0871180639001 , 566.223376404221 },
-  { 795.348331029285 , 290.380181128101 },
-  { 495.6756837955967 , 396.1093550643567 }
-},
-{ //#30
-  { 595.9649090956557 , 178.0047208609014 },
-  { 286.7947578766267 , 51.40912994203356 },
-  { 447.1099643804656 , 447.8929125508931 },
-  { 691.978717985001 , 59.2511661395798 },
-  { 472.60811773541366 , 55.6235164252917 },
-  { 771.14886920403 , 200.1626846633552 },
-  { 178.4741237984064 , 180.6866857411181 },
-  { 581.5918969467141 , 280.2740163249408 },
-  { 707.8720591077847 , 131.87686479034502 },
-  { 172.74494986215075 , 251.0040385074299 },
-  { 257.93981316143663 , 231.29732163202527 },
-  { 231.03076973516096 , 544.28084860367517 },
-  { 340.3814068025292 , 106.28432200875108 },
-  { 193.8331542842203 , 79.60709267788292 },
-  { 74.74314226667214 , 201.0696234410772 },
-  { 346.8489135733555 , 272.52650364228566 },
-  { 382.7971697464579 , 127.21837125077624 },
-  { 797.792077843788 , 72.5438890989649 },
-  { 752.7860463948501 , 307.27809040190857 },
-  { 420.4481851367477 , 538.63402315399435 },
-  { 510.4866247950035 , 108.78577104932975 },
-  { 500.792875379672 , 220.75679359232726 },
-  { 47.2241649872129 , 286.32991961097974 },
-  { 825.27433790799952 , 134.44158607601958 },
-  { 253.8989766082063 , 451.86730320838643 },
-  { 392.6053454005169 , 392.36576616994125 },
-  { 340.20092095418994 , 357.6852576848073 },
-  { 690.8370751374464 , 207.4676085749104 },
-  { 659.5092362986048 , 348.9922705288984 },
-  { 475.40189092563867 , 324.2593570073509 },
-  { 797.9524808759998 , 259.1047857657305 },
-  { 192.39334915545882 , 360.6814606030574 },
-  { 534.2743837143739 , 363.61536414460363 },
-  { 41.2665103722333 , 319.0139273030944 },
-  { 814.5614701730073 , 365.82761269882735 },
-  { 315.3728712593457 , 171.35391384176796 },
-  { 513.7249952329929 , 540.34820328098405 },
-  { 117.71965908920737 , 302.3159522723111 },
-  { 242.6648824896638 , 324.68427387128696 },
-  { 366.80991025119744 , 464.40808461790414 },
-  { 875.72312036056343 , 235.36126372278983 },
-  { 924.48344921640933 , 177.4063631140191 },
-  { 233.20284978952938 , 150.81645674591562 },
-  { 388.7285881364353 , 256.5427513362818 },
-  { 413.1970824832159 , 573.14762929629217 },
-  { 453.04254796984924 , 194.68458389218392 },
-  { 888.24772325032563 , 301.2797147081891 },
-  { 81.97593263574413 , 97.16413736950287 },
-  { 558.3751870733004 , 475.22840020939213 }
-},
-{ //#31
-  { 293.7374966383075 , 126.88491847839371 },
-  { 254.32060586781992 , 229.56942958882092 },
-  { 383.8360299896537 , 83.797246244142116 },
-  { 489.01999009802796 , 31.63928244168836 },
-  { 108.2592123376553 , 396.10386828996536 },
-  { 380.1004052171427 , 16.331633067090753 },
-  { 553.6704899976771 , 450.62306165298884 },
-  { 461.4251142293599 , 560.71821419168601 },
-  { 192.81497841507243 , 168.3835869834919 },
-  { 116.0138365693381 , 256.00871575126814 },
-  { 494.7491640342836 , 201.3219296753765555 },
-  { 559.4269218248385 , 10.783799125333239 },
-  { 646.9473000939224 , 178.90888152599905 },
-  { 6.626373297781726 , 267.50580142607737 },
-  { 428.572993361561 , 164.27811113025177 },
-  { 293.3237567831224 , 336.4563733215048 },
-  { 202.654240942728 , 382.62715515633045 },
-  { 680.2274483349358 , 270.54087948694816 },
-  { 706.8521475552252 , 86.66350575768183 },
-  { 38.239161706629716 , 178.23404088855978 },
-  { 130.4845374749469 , 118.32919342725697 },
-  { 128.56494729091008 , 8.355945437005502 },
-  { 410.04658371621923 , 263.06536261851227 },
-  { 559.1053803438207 , 245.10251592249284 },
-  { 570.3881858072803 , 376.29731131410955 },
-  { 234.8682016346627 , 89.38104135686851 },
-  { 82.08116468205057 , 498.04073893316664 },
-  { 186.92506700647232 , 292.94450792264223 },
-  { 387.5809850817788 , 307.15658251092725 },
-  { 345.5624866328583 , 236.43804372891765 },
-  { 237.20078787296927 , 25.562172246780495 },
-  { 297.56732495596094 , 426.61711079384922 },
-  { 327.649240942728 , 37.37302099408005 },
-  { 509.2708797336314 , 370.5408794869482 },
-  { 616.753614203879 , 23.575833523430305 },
-  { 500.46933263005826 , 287.97096753473343 },
-  { 147.8106165497408 , 187.8203010333747 },
-  { 337.9440058338164 , 499.62008568110576 },
-  { 794.6940673053269 , 152.85714015417562 },
-  { 246.67471892376554 , 490.73620472573015 },
-  { 27.800026364519695 , 78.91230265676938 },
-  { 393.74650569696144 , 531.361978237726003 },
-  { 211.2679707315885 , 511.00371575126815 },
-  { 583.7925948884124 , 185.46746253313853 },
-  { 597.2806927121142 , 496.2497659024968 },
-  { 9.771654935803447 , 424.4762225220944 },
-  { 613.8775859609353 , 104.52965869824865 },
-  { 64.376659378518 , 353.1241214898215 },
-  { 507.1547590278385 , 131.1386479952561 }
-},
-{ //#32
-  { 423.52789778881044 , 266.2918374042258 },
-  { 495.6878303874763 , 183.28133067552312 },
-  { 512.8940571972513 , 74.64549009346392 },
-  { 313.68863526115484 , 272.0482692313872 },
-  { 589.4941959909825 , 321.12325042562486 },
-  { 618.0780173056256 , 42.48752629101016 },
-  { 488.15169072996963 , 321.81645351919195 },
-  { 668.3723414979036 , 343.8644399050355 },
-  { 217.4892136728927 , 218.72405910049264 },
-  { 231.5305550112566 , 105.85463483489343 },
-  { 344.4077131495622 , 342.6973115710109 },
-  { 295.28837337772194 , 177.3871280640672 },
-  { 387.38422997209744 , 443.9436404022448 },
-  { 497.1062998601755 , 436.2711258551285 },
-  { 281.14204833856286 , 472.4111471730711 },
-  { 134.43446515931072 , 300.7777213869741 },
-  { 516.1192184587093 , 544.240299762537 },
-  { 401.10621883543513 , 624.6818934036296 },
-  { 236.43853924215364 , 321.7102301695448 },
-  { 187.7188365886191 , 414.77404018031933 },
-  { 153.7068782236754 , 224.48430988533931 },
-  { 468.2648611607177 , 366.7727022903355 },
-  { 567.2718753692178 , 105.41097935240681 },
-  { 413.2092637010902 , 121.12927270232345 },
-  { 291.1832217716048 , 628.5204890459377 },
-  { 320.076209710147 , 92.42194135736293 },
-  { 135.19221041091976 , 364.68674699208003 },
-  { 117.58869593838983 , 549.4003044066893 },
-  { 647.6517116878831 , 477.99811812900236 },
-  { 729.9154722378026 , 148.17837318452432 },
-  { 595.09410942793994 , 391.16845387063546 },
-  { 65.8053836464028 , 122.73929412367465 },
-  { 603.3064829407951 , 204.90120011762116 },
-  { 404.6758366492783 , 188.8842137388764 },
-  { 721.8785815965217 , 71.42220014110632 },
-  { 731.15729209240754 , 427.38671068398156 },
-  { 833.2113304020979 , 112.65582434930394 },
-  { 668.0124323719783 , 140.48933388648874 },
-  { 812.5116770001109 , 330.9423373038749 },
-  { 96.918908491803 , 159.569010471129 },
-  { 569.1607148594678 , 236.6625058996496 },
-  { 751.2393629642212 , 271.91498687053814 },
-  { 795.6880104960277 , 403.7869587788532 },
-  { 432.1211933440047 , 544.4245052883545 },
-  { 71.97606488727547 , 354.07383099089685 },
-  { 92.7583969572736 , 215.8052327304924 },
-  { 875.4358245864457 , 391.5150687576172 },
-  { 361.8834309610272 , 544.2632607472813 },
-  { 196.88482003990646 , 531.7109379836486 }
-},
-{ //#4 33
-  { 383.4436175529294 , 215.96604210950431 },
-  { 87.2441959646673 , 269.29025224039896 },
-  { 45.5300158376775 , 176.01344214415366 },
-  { 395.8800365467265 , 452.08402543062394 },
-  { 396.6316592362237 , 280.7873379152082 },
-  { 505.80303361055684 , 525.92262107293203 },
-  { 530.5454000778385 , 148.751657647204 },
-  { 610.9869937189311 , 223.76465727047827 },
-  { 547.8993214846796 , 313.8631906218245 },
-  { 358.751266927527 , 10.04645722861899 },
-  { 452.07547705842154 , 10.847035640356822 },
-  { 589.9999123174649 , 101.79548336306972 },
-  { 637.7163635035665 , 124.00929117992226 },
-  { 362.2571955879415 , 549.7318458814915 },
-  { 489.6135016116694 , 407.1400007180698 },
-  { 470.6405526165357 , 56.506281878886824 },
-  { 462.56380219217766 , 292.3715162762894 },
-  { 536.160822130421 , 440.2655152284137 },
-  { 183.0020239118369 , 290.9790417327785 },
-  { 697.6602965081344 , 156.04805159940906 },
-  { 680.4540696983594 , 47.412211017349875 },
-  { 649.4438540728038 , 554.90640875185443 },
-  { 788.7730744521721 , 66.51177407893555 },
-  { 818.5401118688861 , 232.45352576619416 },
-  { 725.7110752946141 , 207.7111592989124 },
-  { 631.9445209500183 , 341.62367698522314 },
-  { 835.0318523931393 , 163.42618195040984 },
-  { 183.2466078344985 , 233.48101093165627 },
-  { 235.80794594959946 , 168.34092759703736 },
-  { 347.73898728374417 , 391.45990661888817 },
-  { 704.2638038151764 , 282.0504771434885 },
-  { 300.6259023844761 , 137.08902543062393 },
-  { 381.6567734052352 , 121.15678177853596 },
-  { 257.2747698624739 , 48.99629155664806 },
-  { 469.0397726250911 , 489.93750025253306 },
-  { 253.3376107070562 , 534.4241965068939 },
-  { 178.6352644075833 , 140.20814999787697 },
-  { 437.36380134023716 , 352.24646739221464 },
-  { 752.6552965081344 , 60.79391743715867 },
-  { 39.9915171831342 , 218.8191091341126 },
-  { 503.40053911421984 , 246.63286414352362 },
-  { 559.6619316631328 , 33.71524251340217 },
-  { 55.57771290090864 , 342.9500263388409 },
-  { 242.5550271753699 , 359.3019428164344 },
-  { 474.7962044522525 , 160.0982377248775 },
-  { 124.65020047692576 , 99.60796797736852 },
-  { 290.83306243920975 , 256.3492178047016 },
-  { 304.54293443621134 , 295.9826160515622 },
-  { 624.4647464633803 , 464.73464247637722 }
-},
-{ //#5 -- 34
-  { 399.25001539018956 , 127.91137927867004 },
-  { 290.6141748081304 , 145.11760608844503 },
-  { 374.8714031067868 , 215.81781527786748 },
-  { 447.4664578255202 , 29.05302212622466 },
-  { 531.7236861241765 , 99.75323131564711 },
-  { 53.33890987761305 , 109.57563364433288 },
-  { 188.63322264432944 , 186.32058529826122 },
-  { 51.720894878581 , 276.4191186496074 },
-  { 80.59157170256145 , 372.46685313722435 },
-  { 615.9809144228329 , 170.45344050506958 },
-  { 681.06503750328056 , 333.6597350279692 },
-  { 608.3083998757165 , 5.731370616991526 },
-  { 285.8876238954863 , 280.4683151775166 },
-  { 478.22819446702886 , 178.19901971347718 },
-  { 720.5876206501368 , 204.44221971637003 },
-  { 718.281647865968 , 62.65096080102834 },
-  { 461.8064166484393 , 395.8178152778675 },
-  { 297.3847095702955 , 389.855778449073 },
-  { 239.09888969728533 , 483.1325885453183 },
-  { 335.6223042065439 , 466.24893643353624 },
-  { 151.72089487858096 , 116.4291186496074 },
-  { 382.0870454837484 , 333.7925253084112 },
-  { 839.3424816885669 , 203.11002267588918 },
-  { 225.59657170256148 , 367.72098729947476 },
-  { 838.710193022857 , 123.06470065621345 },
-  { 516.0256819124298 , 392.48159142670102 },
-  { 817.9664413621291 , 16.16717819216875 },
-  { 98.36879903981315 , 205.02245354974784 },
-  { 908.0649747134753 , 79.25485042642029 },
-  { 428.1956132376814 , 312.0172368661296 },
-  { 296.45785825048824 , 65.94825376349775 },
-  { 641.2951409672876 , 90.16697117083217 },
-  { 563.8816499266303 , 204.93719142402136 },
-  { 355.7184830087498 , 580.60987734086467 },
-  { 132.19216262142933 , 258.5508360804457 },
-  { 366.3015922382622 , 37.92536623043748 },
-  { 200.08371768776087 , 263.54452438816077 },
-  { 381.1127887284755 , 529.83619690429734 },
-  { 646.7225670142814 , 269.3848623188062 },
-  { 484.71066563444236 , 521.57424710502886 },
-  { 183.72465585060306 , 364.79301771398036 },
-  { 532.8786943666779 , 9.21524050217671 },
-  { 23.99598078369365 , 163.29670191819537 },
-  { 521.2047112895641 , 279.44534854471107 },
-  { 159.40293730606768 , 455.5629070495765 },
-  { 757.3483791062771 , 101.79354554669204 },
-  { 186.73578836241018 , 58.27573921638145 },
-  { 393.85679780289485 , 439.4812337760505 },
-  { 791.2878298395593 , 288.6994480150264 }
-},
-{ //#6 - 35
-  { 329.9364956562906 , 328.60047032915867 },
-  { 322.09445945874444 , 203.4165102207844 },
-  { 783.0815408602106 , 331.38568412819296 },
-  { 437.9056695636992 , 349.58755173062485 },
-  { 365.93305510105256 , 113.49351315695407 },
-  { 191.4005456140234 , 350.48524718977865 },
-  { 406.34196982307566 , 249.48028568991037 },
-  { 543.6348434999549 , 79.9049044969366 },
-  { 39.28401724169566 , 137.77334456117939 },
-  { 278.3401622275971 , 149.41470075626313 },
-  { 169.9364956562905 , 130.36010105066217 },
-  { 84.67771868092655 , 323.8762578927712 },
-  { 77.32510903304916 , 221.54642160053737 },
-  { 272.53092091885446 , 403.41228888643195 },
-  { 350.9235770577568 , 436.5696442365672 },
-  { 439.65856554436857 , 162.68758650354587 },
-  { 438.76549680785854 , 502.763278633061 },
-  { 708.3229219868766 , 290.6832648997265 },
-  { 479.9396452164865 , 531.21878504416895 },
-  { 281.99320757049935 , 563.29314866325876 },
-  { 494.06518195248293 , 312.37917221796204 },
-  { 445.41499737153 , 52.848323975890295 },
-  { 257.2508411032176 , 226.12218523753074 },
-  { 637.9146749041802 , 323.2558666375797 },
-  { 53.1800742115568 , 394.4733563624445 },
-  { 720.6741712494904 , 419.10199915105886 },
-  { 464.63199584188897 , 222.29920016328361 },
-  { 572.1850209848037 , 391.1236325054718 },
-  { 459.8431619386421 , 421.2619948619696 },
-  { 732.8941611162572 , 225.01790074032584 },
-  { 224.75253554791635 , 296.4425065267049 },
-  { 556.4834125582331 , 523.0995872812277 },
-  { 656.1682060543942 , 476.61580467236814 },
-  { 827.8060197808085 , 429.6054318290269 },
-  { 173.1806330061174 , 214.48879462121482 },
-  { 539.616988049354 , 449.343604342224 },
-  { 336.244846152501 , 39.443914894758095 },
-  { 561.5092007373951 , 244.13568199833148 },
-  { 877.01866985386494 , 284.5503592986142 },
-  { 506.514200737395 , 148.8815478360811 },
-  { 613.139044968282 , 176.88757179636787 },
-  { 604.4857175599303 , 585.3820108295654 },
-  { 120.7003364246009 , 434.74247548843505 },
-  { 6.9740544339414 , 202.10447727403346 },
-  { 334.0270336353976 , 502.4590811595042 },
-  { 626.417589229371 , 432.64332990913607 },
-  { 120.1573638388117 , 160.01928740161833 },
-  { 230.69740316846867 , 434.0359549676264 },
-  { 220.22294877245895 , 62.01747980613976 }
-},
-{ //#36
-  { 160.08362109144704 , 78.83585837608283 },
-  { 118.88064188163088 , 180.81681053988376 },
-  { 639.36150676774054 , 225.553773911791 },
-  { 325.0906807039962 , 255.87112667810274 },
-  { 392.80728637506536 , 169.19782388889942 },
-  { 337.9802049432165 , 7.497805786071 },
-  { 96.99594885719551 , 468.93439172742904 },
-  { 117.3805546039396 , 266.7567531216072 },
-  { 406.8291800582548 , 582.27345128469193 },
-  { 466.7340275195576 , 344.5188270530091 },
-  { 502.08331422050514 , 27.27845128469188 },
-  { 527.0340213148569 , 335.27584379986905 },
-  { 170.59362425060633 , 250.67289108168762 },
-  { 416.7996124532049 , 476.51701945753052 },
-  { 574.3204821242689 , 297.3870339260544 },
-  { 435.0639286942477 , 257.79071686213956 },
-  { 29.53863485383785 , 332.95038751810097 },
-  { 137.9802049432165 , 12.497805786071 },
-  { 308.1637718711457 , 539.31079264775553 },
-  { 504.3528230839479 , 211.162035692767 },
-  { 591.0670934318056 , 62.627951385042735 },
-  { 69.98508774010087 , 141.9235306103344 },
-  { 325.0739286942477 , 457.79071686213956 },
-  { 338.9504156108484 , 313.2916866460779 },
-  { 204.05385739314295 , 334.4733587926763 },
-  { 216.963984154517 , 37.14830568572012 },
-  { 666.7340275195576 , 164.52882705300908 },
-  { 693.10972854019528 , 297.0741058879189 },
-  { 1.0711280830115797 , 439.19256915163555 },
-  { 295.2696611388612 , 380.0846126166216 },
-  { 695.6737996591095 , 28.639172173742246 },
-  { 268.0527949988556 , 9.82293977754898 },
-  { 751.6449010966714 , 118.88047112258766 },
-  { 113.59983848258753 , 378.52065187224395 },
-  { 745.43427636114825 , 221.55828268891722 },
-  { 191.64732083207048 , 448.94312441679725 },
-  { 25.603831785385594 , 239.10263041289397 },
-  { 447.11696521951666 , 7.78784552127485 },
-  { 228.85388987188236 , 182.73640072392058 },
-  { 786.14947649961294 , 303.6791384498365 },
-  { 799.5301133081622 , 142.58883459189195 },
-  { 403.39520337207273 , 67.34686823850151 },
-  { 260.7028952524998 , 240.193527388451 },
-  { 475.75162912746003 , 115.82910875266154 },
-  { 329.47188513960583 , 122.51433531786068 },
-  { 574.6099862799055 , 164.04555118799215 },
-  { 58.10266892764609 , 37.63287916626666 },
-  { 263.4404124516891 , 116.45465394047312 },
-  { 260.69215760195254 , 483.7605633159392 }
-},
-{ //#37
-  { 504.40501449815764 , 252.25328178316784 },
-  { 104.4705994318049 , 450.2550893786464 },
-  { 79.45759980853063 , 289.81349573755386 },
-  { 383.29619545083875 , 399.7364928013842 },
-  { 175.65702139679274 , 236.48928560665928 },
-  { 613.792477769714 , 260.7561961083586 },
-  { 707.0692878659593 , 319.0420159813688 },
-  { 213.73743121275595 , 46.46253359691076 },
-  { 514.9404104225721 , 134.4815814331098 },
-  { 600.937998552741 , 208.67234012436705 },
-  { 729.79488963954515 , 64.94695479961592 },
-  { 496.390480558413 , 334.1171060186449 },
-  { 335.0797530155081 , 498.59484995382957 },
-  { 426.78438291084245 , 152.78702220095002 },
-  { 485.98070656126595 , 439.15338357187176 },
-  { 554.1790248538485 , 421.47553322018496 },
-  { 563.8359645641021 , 23.37486136265915 },
-  { 822.3741884055662 , 251.26620038170168 },
-  { 611.8728875856772 , 370.7294440986101 },
-  { 66.73743651590746 , 201.79693498125692 },
-  { 147.6379735605937 , 177.6922648164755 },
-  { 848.0172626169813 , 453.1115714562676 },
-  { 481.77938291084246 , 57.532888038699625 },
-  { 547.3351066061667 , 548.20103295116934 },
-  { 620.3726592503424 , 509.3174529702867 },
-  { 755.9943112278073 , 171.62274466872134 },
-  { 719.9606430102774 , 228.39799350865627 },
-  { 618.1306202327276 , 141.42693785404612 },
-  { 404.9671624323206 , 242.561991249073 },
-  { 218.9697793244341 , 390.4363516007307 },
-  { 728.1150692192118 , 392.2619373277838 },
-  { 311.30609861019025 , 22.00597201252168 },
-  { 387.7898812190498 , 22.32117851636058 },
-  { 350.38740239010576 , 607.5144348347148 },
-  { 306.10880527987524 , 194.34554881374243 },
-  { 242.4182284826972 , 628.501516236181 },
-  { 604.0747210437705 , 61.64949667846987 },
-  { 649.4331590160989 , 566.4805332201849 },
-  { 425.1782863668543 , 561.6825221880811 },
-  { 324.09987180041526 , 113.37013143046244 },
-  { 386.0430619820975 , 322.48683689863134 },
-  { 826.7509098012711 , 359.4681641375588 },
-  { 159.70952889960233 , 329.732954674801 },
-  { 257.04887031153385 , 292.70618120194416 },
-  { 83.0114275812856 , 346.2344804090108 },
-  { 482.1421109189579 , 509.0763806357021 },
-  { 160.90221475760325 , 453.18971334717475 },
-  { 281.68874231251556 , 391.87202302073274 },
-  { 222.1696071986252 , 127.13505964882546 }
-},
-{ //#38
-  { 490.9333998140045 , 128.37721460008646 },
-  { 593.6179109244317 , 167.79410537057404 },
-  { 393.3469452092932 , 181.2454214731318 },
-  { 119.7304206041883 , 26.396262436285525 },
-  { 136.32601152305614 , 315.56641365531453 },
-  { 682.6016901357322 , 232.44460527022318 },
-  { 156.94462060270405 , 232.98392082739042 },
-  { 702.7880621434607 , 154.38969628944182 },
-  { 20.020235531021 , 96.05560601631548 },
-  { 329.1550480973281 , 160.30878012259623 },
-  { 785.9584814959742 , 194.82580970583288 },
-  { 472.1352528317988 , 239.56400178548336 },
-  { 409.0475805975472 , 239.46546843413716 },
-  { 466.53088074751895 , 342.5553756705015 },
-  { 706.6266577857688 , 44.46669922561148 },
-  { 784.5265614977193 , 80.79202089603102 },
-  { 241.6369712281065 , 124.0643359465051 },
-  { 72.1352528317988 , 329.57400178548335 },
-  { 320.8311381622166 , 248.32382558658253 },
-  { 569.2506585703522 , 7.93682459466322 },
-  { 468.7697936842426 , 33.199861222756 },
-  { 596.8722162037061 , 340.044866671593 },
-  { 890.7687431312539 , 52.32451412520477 },
-  { 520.7571558673548 , 447.658861779719956 },
-  { 413.1694644572803 , 17.822154312970483 },
-  { 737.7420390606435 , 293.6841668582782 },
-  { 236.641218026895 , 382.05019626417408 },
-  { 226.7397513782412 , 25.99495881220345 },
-  { 44.22767263160625 , 200.91840313721943 },
-  { 245.4375496398444 , 277.38854607739972 },
-  { 542.4229049033562 , 383.76497101581876 },
-  { 165.8660947967333 , 137.80228593258482 },
-  { 589.9771725819005 , 423.37036738898956 },
-  { 890.7687431312539 , 162.31451412520477 },
-  { 526.2410491886021 , 227.29679948097177 },
-  { 19.11978471328115 , 26.930573073255346 },
-  { 623.064844816152 , 263.46890074033576 },
-  { 416.7397513782412 , 95.98495881220344 },
-  { 222.4322211642313 , 216.91776941960367 },
-  { 546.2436774554104 , 90.0755567352046 },
-  { 648.935207409483 , 78.44279953373369 },
-  { 391.2460491886021 , 332.55093364322215 },
-  { 533.9876489028446 , 497.09647162570798 },
-  { 316.43527360285395 , 66.34746384374291 },
-  { 397.92183905770753 , 428.75035523148426 },
-  { 307.506928031322 , 344.52324717484464 },
-  { 452.28731257468036 , 492.3946381981571 },
-  { 554.3728004976207 , 276.3617412740077 },
-  { 92.2022541354223 , 125.81295740166242 }
-},
-{ //#39
-  { 335.26320258481815 , 316.14787153312386 },
-  { 252.2389475391514 , 338.3941536248059 },
-  { 277.546596913749 , 229.47456874392054 },
-  { 257.9603367689341 , 539.04602358703164 },
-  { 155.2154643616866 , 237.14782479357194 },
-  { 240.75410995915908 , 30.41018300497245 },
-  { 411.9365053740215 , 398.864477204193 },
-  { 219.76702855769284 , 122.4410090975639 },
-  { 531.7757679016771 , 389.6209090313544 },
-  { 780.2223252470317 , 290.5876671079477 },
-  { 22.80963354184175 , 329.9554336300302 },
-  { 125.0529409685803 , 516.22989832836186 },
-  { 516.2163367782468 , 440.51351506354985 },
-  { 583.932942449316 , 527.1868178527532 },
-  { 597.19641652548756 , 278.35080400338813 },
-  { 231.0247056704293 , 441.14541292374076 },
-  { 712.1437950004542 , 246.14877785648866 },
-  { 312.21443548594345 , 391.53699175130936 },
-  { 692.6218109450319 , 519.633699702798 },
-  { 642.2187623223261 , 620.4636279489985 },
-  { 626.1895847684983 , 442.43310524758664 },
-  { 658.44120165504376 , 294.30906021512436 },
-  { 407.4301798372143 , 262.02522828449247 },
-  { 307.7995992965897 , 144.80245541419305 },
-  { 95.7491099591591 , 325.66431716722286 },
-  { 315.966450145955 , 69.11679896666931 },
-  { 232.39589368665665 , 220.3839787869191 },
-  { 111.44802380388009 , 141.54057215914958 },
-  { 483.45207756320633 , 571.9237812246605 },
-  { 800.4735650769032 , 511.21372425297227 },
-  { 510.7869711974564 , 299.64402384888274 },
-  { 513.6723614707489 , 233.55772151366622 },
-  { 56.94837555514835 , 409.5670209127131 },
-  { 510.3527846362805 , 508.7371721317421 },
-  { 402.35519650611167 , 574.5464134404848 },
-  { 353.4174146957596 , 493.5179439151103 },
-  { 397.70494950021356 , 142.71447436008012 },
-  { 56.453023803880114 , 236.79470632139999 },
-  { 185.82611289532878 , 329.5029128095309 },
-  { 145.0349586791334 , 407.73010849273857 },
-  { 575.4764594092821 , 345.5826671079477 },
-  { 85.5741463176833 , 469.0681291398326 },
-  { 379.4282830565098 , 186.3398863077158 },
-  { 476.5436887950632 , 134.70270911689568 },
-  { 33.58481693083472 , 129.20825171668872 },
-  { 445.38605390130095 , 337.6706622872384 },
-  { 412.38361072887193 , 497.750090730276 },
-  { 521.7378974362165 , 635.2005913209058 },
-  { 104.28502612025717 , 44.95102341803232 }
-},
-{ //#40
-  { 454.85675417813104 , 264.853422442564 },
-  { 356.8549465826524 , 374.9190073762113 },
-  { 630.45262197606326 , 556.6575067304699 },
-  { 785.1741069444428 , 319.12424850630833 },
-  { 560.0407142865054 , 392.69545864011025 },
-  { 454.3115403502497 , 362.3781058737985 },
-  { 528.150623766978 , 217.8779196750744 },
-  { 251.67098647427815 , 342.76104357375755 },
-  { 623.1283865207569 , 302.59692528876406 },
-  { 631.50741512722 , 255.4967152394647 },
-  { 588.5308983046848 , 154.25038640823078 },
-  { 491.53254404723646 , 561.0528440308261 },
-  { 380.56740071713887 , 285.13546929500785 },
-  { 444.69686633275415 , 441.1126417727051 },
-  { 536.6948036095979 , 485.12501350129617 },
-  { 315.6519673728362 , 72.9380552124104 },
-  { 753.0158710865669 , 460.2122048342908 },
-  { 175.26551230749303 , 263.6408589345093 },
-  { 689.7932350002302 , 62.2199051432194 },
-  { 399.66696377872455 , 103.4544740488206 },
-  { 647.8707529880386 , 409.7678887144921 },
-  { 214.40563854160234 , 185.91457203494565 },
-  { 697.9183615762412 , 142.75330073342158 },
-  { 430.4526219760633 , 513.5925202721224 },
-  { 491.41549256613143 , 25.88756359905094 },
-  { 276.51184113872694 , 266.61737575704456 },
-  { 243.29380119848884 , 452.5396902871745 },
-  { 824.6960167057866 , 419.09699061540255 },
-  { 573.15399192039 , 32.28988820564012 },
-  { 128.4206349474906 , 150.4779572262854 },
-  { 254.17043547222522 , 135.5021166057237 },
-  { 393.8600295001201 , 11.33077414274806 },
-  { 145.9783123089161 , 491.95658105766205 },
-  { 713.8436326790558 , 249.93467979737306 },
-  { 503.40825729969634 , 125.0488831008024 },
-  { 721.6384645813922 , 385.1518792777224 },
-  { 82.141579051783 , 440.08524148080386 },
-  { 651.36931949499 , 486.8135962864717 },
-  { 198.13371918053838 , 371.2273135392206 },
-  { 114.530888974926 , 347.82035496686075 },
-  { 603.215292674829 , 593.5364149651854 },
-  { 394.6433806673206 , 560.6550948606388 },
-  { 346.6103744900731 , 193.52970352279294 },
-  { 548.591371754475 , 305.7290680144416 },
-  { 291.69328151958086 , 526.8092758579875 },
-  { 449.7863505287105 , 170.61375359566006 },
-  { 504.6433806673206 , 610.6550948606388 },
-  { 347.2702995734198 , 447.72162931560933 },
-  { 764.0338072811418 , 218.69536237242522 }
-},
-{ //#20 41
-  { 296.51056508447607 , 321.7865845019826 },
-  { 567.2107742738986 , 406.043812800639 },
-  { 492.6719694421679 , 211.86358743815225 },
-  { 601.11727131178 , 287.7978052906821 },
-  { 598.4011433784236 , 212.18094020446398 },
-  { 651.468002572555 , 335.3436036112165 },
-  { 686.5955556124321 , 218.57885547911044 },
-  { 400.4265936738507 , 151.95873997684942 },
-  { 674.7972288786099 , 428.9120196736843 },
-  { 389.31517808192586 , 449.48238300254258 },
-  { 780.5264028148656 , 459.22937243999604 },
-  { 360.84767131109965 , 143.24020136900796 },
-  { 622.2057742738986 , 501.2979469628894 },
-  { 661.8531891451504 , 111.40789205338244 },
-  { 743.244593471789 , 124.29902407488511 },
-  { 368.26862987139685 , 257.1427000852237 },
-  { 127.1570978320276 , 315.67601739903637 },
-  { 515.5401763152131 , 104.27713283344096 },
-  { 533.2219950625981 , 565.9484468625385 },
-  { 462.52178587317565 , 650.2056751611949 },
-  { 354.5526119657671 , 629.2185937597287 },
-  { 756.6490025529212 , 15.128872855856116 },
-  { 362.6353821326799 , 384.894967210608 },
-  { 543.8815479678436 , 358.21181048426183 },
-  { 281.5513971039127 , 228.8838390607449 },
-  { 728.4479559074332 , 529.7654537337156 },
-  { 324.23525919945536 , 523.489419823473 },
-  { 429.5656115890412 , 548.7770001186361 },
-  { 465.22982211009764 , 447.2467920104552 },
-  { 714.5817571572661 , 273.95458218560543 },
-  { 838.3875019071797 , 88.72654824926693 },
-  { 539.2876814771192 , 496.4495146657524 },
-  { 437.54199941240404 , 100.32156278602929 },
-  { 796.5688036026836 , 220.49844566314727 },
-  { 246.2325017913008 , 628.1083794612043 },
-  { 238.2004349632696 , 373.1636704649702 },
-  { 818.5464892587794 , 466.677781499464 },
-  { 205.2426335654764 , 164.11670377930326 },
-  { 206.2146494483981 , 553.0568315228614 },
-  { 897.0915128983803 , 217.67420980355777 },
-  { 293.2488699462967 , 436.043812800639 },
-  { 196.473002572555 , 240.08946944896613 },
-  { 436.03637195965655 , 9.13572018070029 },
-  { 439.3420778108242 , 351.3801129003008 },
-  { 606.4615842932893 , 85.01391341143164 },
-  { 455.05317387777757 , 315.22037879839434 },
-  { 158.8945475911178 , 438.65340412535437 },
-  { 114.6821562192245 , 536.8146498893268 },
-  { 636.202580139116 , 589.6703011950184 }
-},
-{ //#28 42
-  { 483.4458996193333 , 399.7636084943845 },
-  { 374.52631473844804 , 415.0712578689822 },
-  { 296.6843949883463 , 581.26489226547596 },
-  { 35.47672571192476 , 338.7765270929184 },
-  { 349.53931436172223 , 95.5128515100747 },
-  { 572.4296788306337 , 335.11310859473537 },
-  { 177.51424376931732 , 467.86048318434376 },
-  { 604.5876426330875 , 440.29706870310963 },
-  { 282.2809389701308 , 474.97610533028495 },
-  { 695.7734852384166 , 501.80269615585706 },
-  { 242.16474366896642 , 556.8442623956443 },
-  { 228.95672883923623 , 378.7766837420228 },
-  { 690.0170534112552 , 611.6419586835126 },
-  { 362.0030088582089 , 567.30359078316866 },
-  { 483.52809357302266 , 245.90614528277075 },
-  { 277.17317127456687 , 279.9183265895774 },
-  { 530.9899672396767 , 522.0355680573682 },
-  { 713.6326580404499 , 367.09406075853633 },
-  { 637.7127941727736 , 548.6445573543757 },
-  { 783.2938635075005 , 639.9277785565228 },
-  { 278.3268931501859 , 361.7470477380876 },
-  { 430.47172571192476 , 83.522392930668 },
-  { 540.5762273844916 , 412.4641132142571 },
-  { 467.2457187222595 , 302.9551447922816 },
-  { 388.88113479305696 , 199.6063758738894 },
-  { 438.7089362474261 , 610.2444733804942 },
-  { 748.8952321383044 , 431.5636762758428 },
-  { 706.6180736383951 , 200.1272001447849 },
-  { 421.15070471202114 , 516.2791362302069 },
-  { 343.31876190947094 , 273.59256698454413 },
-  { 768.2334958465858 , 512.7836015310672 },
-  { 484.4275148082663 , 457.99331635719653 },
-  { 74.69950054057986 , 549.47689293144526 },
-  { 680.3988527380423 , 314.12602719326924 },
-  { 559.9335677398078 , 640.026329922019 },
-  { 575.19271885628564 , 240.5596798843331 },
-  { 836.2353034420644 , 462.8491864647145 },
-  { 289.28588310659575 , 182.01676547792056 },
-  { 769.9422837692897 , 262.326621733047 },
-  { 528.7513461750068 , 111.76930218695253 },
-  { 133.2451587880811 , 572.1519117702419 },
-  { 40.0730956653669 , 483.0382465707192 },
-  { 392.2541869603823 , 476.89569551432174 },
-  { 449.0479358457266 , 143.27521421823232 },
-  { 516.4048388742715 , 571.2741362302069 },
-  { 417.33445917652887 , 303.064225532669 },
-  { 86.32840116398827 , 406.35485573159633 },
-  { 793.0212399740593 , 560.1248632733652 },
-  { 151.18205397652787 , 301.0020088793144 }
-},
-{ //#17 43
-  { 428.9853208940154 , 113.72455213426744 },
-  { 423.17607958527276 , 277.7221402644363 },
-  { 624.4224084165066 , 534.74562344190096 },
-  { 438.4837289598704 , 386.64172514532163 },
-  { 383.97232127074113 , 3.28295849317492 },
-  { 328.89624818104744 , 221.07310240507945 },
-  { 650.8247330230958 , 3.0071240876424 },
-  { 750.7477300869261 , 176.8457197299505 },
-  { 517.4559109894981 , 334.37117812379313 },
-  { 544.4636051946676 , 34.50560232269578 },
-  { 29.21145468488632 , 267.556885013939 },
-  { 553.509244133523 , 113.59023331715478 },
-  { 627.1069195269338 , 195.32873267141338 },
-  { 156.5803722189604 , 339.9295835502752 },
-  { 267.3906207283 , 312.2589450104085 },
-  { 185.9705136752625 , 103.348543426822225 },
-  { 443.4934323515845 , 493.45131420069197 },
-  { 147.4891540796462 , 465.3466172446601 },
-  { 296.1304015206394 , 27.089324096681153 },
-  { 468.0581310278825 , 183.62578696194404 },
-  { 661.1870784462643 , 305.9408043389747 },
-  { 122.17305827729274 , 279.35892227808966 },
-  { 255.3340433877266 , 472.53818015606203 },
-  { 538.1055055332636 , 250.13002630105254 },
-  { 694.21953538557443 , 213.54878402577435 },
-  { 540.3241178625434 , 441.9576327285044 },
-  { 617.1634814484728 , 462.6140946607024 },
-  { 26.98612954759466 , 189.78221015123063 },
-  { 41.7284960148764 , 102.61124672550261 },
-  { 347.7675787114595 , 124.20472983523452 },
-  { 336.69477397664053 , 348.5778720896613 },
-  { 477.73722335822345 , 229.0056523286164 },
-  { 346.51080536754824 , 488.6644191771936 },
-  { 119.18470267513777 , 165.6372948299021 },
-  { 438.95342131678854 , 62.69910238248702 },
-  { 823.6472640573323 , 342.9293011645413 },
-  { 653.3831900755529 , 89.19795294809813 },
-  { 483.17470223717237 , 547.2208008880064 },
-  { 247.28671382534986 , 168.9416932071418 },
-  { 123.97562281889196 , 397.62227755256473 },
-  { 631.8139813481218 , 353.6303154494019 },
-  { 250.65217297290616 , 72.56755264441438 },
-  { 758.8904770916031 , 96.47037551896803 },
-  { 265.78315033777847 , 397.7631623150316 },
-  { 544.1627135048515 , 551.8806297923347 },
-  { 146.65458484273734 , 36.758311335671706 },
-  { 185.65212137404143 , 238.6612696169977 },
-  { 761.77111749333693 , 287.8873955149336 },
-  { 487.5136756454946 , 646.16046119656 }
-},
-{ //#7 44
-  { 532.0290254463023 , 7.4439644743253375 },
-  { 537.7854572734636 , 117.28322700198092 },
-  { 522.4778078988661 , 226.20281188286623 },
-  { 428.67223408606026 , 45.06276003871565 },
-  { 647.7084543372939 , 113.44463135967285 },
-  { 415.7549809657693 , 252.81180117987367 },
-  { 43.0704698553421 , 292.2286919503612 },
-  { 419.31265148887667 , 320.6961987211875 },
-  { 525.50084680351887 , 307.8068011798737 },
-  { 396.44444461583134 , 428.28265332589876 },
-  { 318.5812566194821 , 417.78004917012515 },
-  { 219.25451797228496 , 264.8302843573385 },
-  { 490.4056942648217 , 400.05217694819083 },
-  { 411.46600727628527 , 153.69860062077484 },
-  { 376.8670764924923 , 511.05685926637045 },
-  { 718.4086635267164 , 29.187403061016454 },
-  { 171.03807553695432 , 363.68864150978385 },
-  { 775.0577013860733 , 123.46723446524177 },
-  { 20.4549663074419 , 466.37315262021104 },
-  { 279.67391611901354 , 551.8514369208633 },
-  { 476.2798298207162 , 208.46906960730996 },
-  { 628.6088912757083 , 5.125626605860106 },
-  { 437.6474238256475 , 620.2636054896997 },
-  { 739.3495067989842 , 331.9319858191219 },
-  { 90.59648189586177 , 438.70164113305805 },
-  { 148.55430878286248 , 180.5730560586821 },
-  { 312.18721631717494 , 498.98286251532124 },
-  { 612.75573801078804 , 233.8753264299826 },
-  { 449.65931548752644 , 153.0319339461242 },
-  { 477.34794137860194 , 555.7938226382777 },
-  { 181.63572240789466 , 100.18707571758057 },
-  { 637.0558937905947 , 333.53281939888907 },
-  { 208.46376362803815 , 326.2174711616617 },
-  { 641.1795435717609 , 460.66559431553424 },
-  { 732.8874255065974 , 414.72563421666484 },
-  { 357.9720248966378 , 129.31998833737202 },
-  { 185.49358438523055 , 507.8785825214714 },
-  { 715.2821940649117 , 72.84223227692925 },
-  { 297.4844389474837 , 63.946559254074174 },
-  { 241.675197638741 , 167.94414738424302 },
-  { 773.1381112020365 , 233.44048245549322 },
-  { 309.9251882173203 , 332.1932843959967 },
-  { 233.19013351015394 , 452.1666434247022 },
-  { 596.0754832922769 , 144.4643125286076 },
-  { 324.43847808065925 , 232.67232055488472 },
-  { 147.64694319659418 , 263.58036949027667 },
-  { 671.0601132559044 , 159.27647577398446 },
-  { 594.3445067989842 , 427.1861199813723 },
-  { 465.8508557037927 , 446.4063593667213 }
-},
-{ //#1  45
-	  { 546.2499321648903 , 76.7795310884235 },
-	  { 640.5297635691156 , 20.13049322906661 },
-	  { 724.786991867772 , 90.83070241848907 },
-	  { 831.0291735013067 , 62.36319564766282 },
-	  { 439.0789687391623 , 52.037164621141784 },
-	  { 349.2906741470481 , 335.96087104107363 },
-	  { 439.5271052317935 , 400.38852038543095 },
-	  { 457.2661529535898 , 312.129031188774391 },
-	  { 940.9521705651371 , 58.524600005354756 },
-	  { 624.5483076797664 , 243.13183446680165 },
-	  { 686.929512115376 , 346.48862582704373 },
-	  { 565.2353268609984 , 333.116112590240554 },
-	  { 733.0273659058281 , 12.428780581310129 },
-	  { 655.6373954364467 , 88.2766167632327 },
-	  { 831.0291735013067 , 119.29820918931532 },
-	  { 717.1327103445942 , 30.77691093269938 },
-	  { 280.8606787868047 , 231.24921582802266 },
-	  { 939.948758382192 , 377.67084502226042 },
-	  { 243.018759036703 , 25.055581431528893 },
-	  { 915.2864017999631 , 133.06340483708527 },
-	  { 735.1459545507066 , 445.3469829794891 },
-	  { 934.3859648615487 , 99.98199121205312 },
-	  { 440.0077505313557 , 205.24703785924979 },
-	  { 336.65095917111364 , 67.62824229485949 },
-	  { 470.670562034722 , 121.29918240780339 },
-	  { 817.0072798181172 , 9.28756825187031 },
-	  { 872.2321527111228 , 221.27916135311625 },
-	  { 142.1984993963708 , 15.548083182819433 },
-	  { 531.1423002975592 , 8.63340755425745 },
-	  { 459.5061529247427 , 2.7987598239288367 },
-	  { 215.2861716306224 , 105.64661653416564 },
-	  { 829.1550139070703 , 277.12061367810213 },
-	  { 433.32253691200094 , 161.87642714879735 },
-	  { 890.9340209626096 , 294.60857141598 },
-	  { 106.1423927786857 , 165.51276477236217 },
-	  { 548.3485271073342 , 237.26924813631665 },
-	  { 519.64521462275 , 118.02087082581383 },
-	  { 48.3037971363775 , 5.58976770853185 },
-	  { 348.14804484592287 , 177.01570556641587 },
-	  { 1206.5325004618564 , 148.62313335670086 },
-	  { 119.3139051349242 , 67.18526037363955 },
-	  { 668.1379540084151 , 185.1105338227144 },
-	  { 349.29697904618126 , 33.116112590240576 },
-	  { 784.6918393290748 , 183.07607818680623 },
-	  { 595.5526796273101 , 138.84528652649624 },
-	  { 231.7521012155722 , 285.52107639560165 },
-	  { 730.5434236949334 , 200.66996494614466 },
-	  { 117.4329374002707 , 256.9421381105136 },
-	  { 709.6788397058006 , 263.51767182789877 }
-	},
-	{ //#1  46
-		  { 546.2499321648903 , 76.7795310884235 },
-		  { 640.5297635691156 , 20.13049322906661 },
-		  { 724.786991867772 , 90.83070241848907 },
-		  { 831.0291735013067 , 62.36319564766282 },
-		  { 439.0789687391623 , 52.037164621141784 },
-		  { 349.2906741470481 , 335.96087104107363 },
-		  { 439.5271052317935 , 400.38852038543095 },
-		  { 457.2661529535898 , 312.129031188774391 },
-		  { 940.9521705651371 , 58.524600005354756 },
-		  { 624.5483076797664 , 243.13183446680165 },
-		  { 686.929512115376 , 346.48862582704373 },
-		  { 565.2353268609984 , 333.116112590240554 },
-		  { 733.0273659058281 , 12.428780581310129 },
-		  { 655.6373954364467 , 88.2766167632327 },
-		  { 831.0291735013067 , 119.29820918931532 },
-		  { 717.1327103445942 , 30.77691093269938 },
-		  { 280.8606787868047 , 231.24921582802266 },
-		  { 939.948758382192 , 377.67084502226042 },
-		  { 243.018759036703 , 25.055581431528893 },
-		  { 915.2864017999631 , 133.06340483708527 },
-		  { 735.1459545507066 , 445.3469829794891 },
-		  { 934.3859648615487 , 99.98199121205312 },
-		  { 440.0077505313557 , 205.24703785924979 },
-		  { 336.65095917111364 , 67.62824229485949 },
-		  { 470.670562034722 , 121.29918240780339 },
-		  { 817.0072798181172 , 9.28756825187031 },
-		  { 872.2321527111228 , 221.27916135311625 },
-		  { 142.1984993963708 , 15.548083182819433 },
-		  { 531.1423002975592 , 8.63340755425745 },
-		  { 459.5061529247427 , 2.7987598239288367 },
-		  { 215.2861716306224 , 105.64661653416564 },
-		  { 829.1550139070703 , 277.12061367810213 },
-		  { 433.32253691200094 , 161.87642714879735 },
-		  { 890.9340209626096 , 294.60857141598 },
-		  { 106.1423927786857 , 165.51276477236217 },
-		  { 548.3485271073342 , 237.26924813631665 },
-		  { 519.64521462275 , 118.02087082581383 },
-		  { 48.3037971363775 , 5.58976770853185 },
-		  { 348.14804484592287 , 177.01570556641587 },
-		  { 206.5325004618564 , 178.62313335670086 },
-		  { 119.3139051349242 , 67.18526037363955 },
-		  { 668.1379540084151 , 185.1105338227144 },
-		  { 349.29697904618126 , 33.116112590240576 },
-		  { 784.6918393290748 , 183.07607818680623 },
-		  { 595.5526796273101 , 138.84528652649624 },
-		  { 231.7521012155722 , 285.52107639560165 },
-		  { 730.5434236949334 , 200.66996494614466 },
-		  { 117.4329374002707 , 256.9421381105136 },
-		  { 709.6788397058006 , 263.51767182789877 }
-		},
-{ //#11  47
-  { 342.2743381257682 , 446.2150227252463 },
-  { 337.53197165848655 , 573.3859861509743 },
-  { 652.19733518959856 , 372.3764270829382 },
-  { 373.9115153165883 , 349.0996169866929 },
-  { 385.7484140938172 , 662.2443433034197 },
-  { 249.8153659874174 , 466.7126833617709 },
-  { 240.22910584260248 , 576.284138204882 },
-  { 314.0951973916427 , 401.06364550241403 },
-  { 520.58481810579167 , 400.81622265776207 },
-  { 273.19476045322835 , 290.7446407486013 },
-  { 435.67997064448883 , 509.0615984260793 },
-  { 415.5337792539651 , 603.320401217327 },
-  { 362.09880183825237 , 505.46409931718983 },
-  { 376.59916953436056 , 192.5744895295723 },
-  { 469.87597963060585 , 250.86030940258252 },
-  { 238.8129819652421 , 352.18728922094454 },
-  { 267.02771469124946 , 182.9882293847574 },
-  { 350.4407647192196 , 761.163928184305 },
-  { 424.5367910327353 , 335.05064587913984 },
-  { 250.43212377238166 , 73.81807816572841 },
-  { 529.4941280391598 , 447.55597097333185 },
-  { 328.53334214399683 , 91.80238677942833 },
-  { 305.3346742386321 , 711.8157981465307 },
-  { 144.08619205116173 , 497.0300361280827 },
-  { 506.2161872440686 , 68.3149642974734 },
-  { 374.67957935032376 , 82.60124153932084 },
-  { 528.7589208225199 , 724.4042759020856 },
-  { 472.35344665573473 , 645.2840912628374 },
-  { 176.92918133990327 , 246.075901619009 },
-  { 292.8267812360133 , 658.0226375591405 },
-  { 374.711955176607 , 17.16904030637152 },
-  { 561.8327444846757 , 521.2280223485205 },
-  { 95.86974961583107 , 398.17167897563735 },
-  { 200.476455843135 , 432.16045818693783 },
-  { 520.0017088762792 , 314.1317115473348 },
-  { 154.561231825167 , 311.7176833617709 },
-  { 581.8311469370256 , 373.83970583522677 },
-  { 310.1163743233144 , 341.031062616872 },
-  { 269.9005636700745 , 512.6207183374162 },
-  { 315.1289330628647 , 200.97253799845734 },
-  { 435.1144945264044 , 451.0805691504939 },
-  { 360.1539097425278 , 258.53282394969887 },
-  { 259.8379690929863 , 139.3634363129916 },
-  { 461.078958840422 , 372.8412615663835 },
-  { 430.63926652874494 , 738.5609013590827 },
-  { 288.0062765611204 , 14.884635868251735 },
-  { 438.3726046716524 , 97.55881860658972 },
-  { 158.10812981036415 , 198.29587875935505 },
-  { 643.336774389773 , 465.0255484405558 }
-},
-{ //#10 48
-  { 520.353331029285 , 195.1260469658506 },
-  { 465.35833102928495 , 290.380181128101 },
-  { 629.924785872396 , 20.71230711066553 },
-  { 358.95285686249986 , 211.2599964888528 },
-  { 678.1412283077266 , 105.85394995822016 },
-  { 624.3509191594537 , 159.31680565710786 },
-  { 748.8414374971491 , 21.596721659563755 },
-  { 545.8958525394094 , 15.94910249691733 },
-  { 863.1462283077266 , 201.10808412047055 },
-  { 597.7668220699422 , 309.8962672190398 },
-  { 780.4246226366574 , 192.52725274742352 },
-  { 138.94285686249987 , 211.2599964888528 },
-  { 477.2600119573502 , 63.15532930669233 },
-  { 583.6507099700312 , 75.05957735845149 },
-  { 304.69562856384346 , 281.9602056782753 },
-  { 444.76209817124254 , 365.25758461902166 },
-  { 384.66887655409494 , 500.0406154942384 },
-  { 382.98018055312485 , 119.80436716604922 },
-  { 731.4652330615393 , 182.00852105888478 },
-  { 447.40852833649666 , 103.52708412927778 },
-  { 219.21734426319125 , 212.74125586670368 },
-  { 533.6816830521278 , 299.949935244424 },
-  { 218.6896257296344 , 154.58494307897652 },
-  { 350.2931225979433 , 51.88990693845765 },
-  { 467.99308668498946 , 183.84119390597624 },
-  { 373.11295526096774 , 350.2850285894038 },
-  { 783.9762623553726 , 105.92235048716879 },
-  { 412.664802471252 , 260.9731242768092 },
-  { 458.75087738254297 , 210.6508783917177 },
-  { 664.3492075175427 , 303.0890362842715 },
-  { 611.0249973866481 , 399.2884578725336 },
-  { 317.5911347455145 , 390.51521815173993 },
-  { 578.393076437313 , 182.2305407841795 },
-  { 719.3440021404608 , 380.1888948109479 },
-  { 547.7025443281682 , 262.5541169863851 },
-  { 784.3817887468902 , 321.66966230814336 },
-  { 275.86638212254815 , 397.021087270929 },
-  { 260.4203234730074 , 314.72220803050465 },
-  { 313.303629326646 , 124.04983953712352 },
-  { 396.77690520680284 , 151.57470043461876 },
-  { 546.7407541409415 , 121.98789948122234 },
-  { 394.1000366624339 , 458.25420249681235 },
-  { 281.78189343677184 , 186.51763002157108 },
-  { 456.5353042314779 , 23.4224001676314 },
-  { 639.219857293222 , 241.9133685201876 },
-  { 493.784830158595 , 491.77041988795276 },
-  { 415.0871180639001 , 566.223376404221 },
-  { 575.348331029285 , 429.380181128101 },
-  { 495.6756837955967 , 396.1093550643567 }
-},
-{ //#12 49
-  { 346.8489135733555 , 272.52650364228566 },
-  { 595.9649090956557 , 178.0047208609014 },
-  { 286.7947578766267 , 51.40912994203356 },
-  { 407.1099643804656 , 237.8929125508931 },
-  { 691.978717985001 , 59.2511661395798 },
-  { 472.60811773541366 , 55.6235164252917 },
-  { 771.14886920403 , 200.1626846633552 },
-  { 178.4741237984064 , 180.6866857411181 },
-  { 581.5918969467141 , 280.2740163249408 },
-  { 707.8720591077847 , 131.87686479034502 },
-  { 172.74494986215075 , 251.0040385074299 },
-  { 257.93981316143663 , 231.29732163202527 },
-  { 181.03076973516096 , 474.28084860367517 },
-  { 340.3814068025292 , 106.28432200875108 },
-  { 193.8331542842203 , 79.60709267788292 },
-  { 74.74314226667214 , 201.0696234410772 },
-  { 412.7971697464579 , 147.21837125077624 },
-  { 797.792077843788 , 72.5438890989649 },
-  { 752.7860463948501 , 307.27809040190857 },
-  { 420.4481851367477 , 298.63402315399435 },
-  { 510.4866247950035 , 108.78577104932975 },
-  { 540.792875379672 , 22.75679359232726 },
-  { 227.2241649872129 , 286.32991961097974 },
-  { 115.27433790799952 , 134.44158607601958 },
-  { 253.8989766082063 , 451.86730320838643 },
-  { 392.6053454005169 , 392.36576616994125 },
-  { 340.20092095418994 , 357.6852576848073 },
-  { 690.8370751374464 , 207.4676085749104 },
-  { 659.5092362986048 , 348.9922705288984 },
-  { 475.40189092563867 , 324.2593570073509 },
-  { 797.9524808759998 , 259.1047857657305 },
-  { 192.39334915545882 , 360.6814606030574 },
-  { 534.2743837143739 , 363.61536414460363 },
-  { 141.2665103722333 , 399.0139273030944 },
-  { 814.5614701730073 , 365.82761269882735 },
-  { 315.3728712593457 , 171.35391384176796 },
-  { 513.7249952329929 , 240.34820328098405 },
-  { 117.71965908920737 , 302.3159522723111 },
-  { 242.6648824896638 , 394.68427387128696 },
-  { 366.80991025119744 , 464.40808461790414 },
-  { 25.72312036056343 , 235.36126372278983 },
-  { 854.48344921640933 , 147.4063631140191 },
-  { 233.20284978952938 , 150.81645674591562 },
-  { 688.7285881364353 , 256.5427513362818 },
-  { 413.1970824832159 , 73.14762929629217 },
-  { 453.04254796984924 , 194.68458389218392 },
-  { 288.24772325032563 , 301.2797147081891 },
-  { 281.97593263574413 , 97.16413736950287 },
-  { 588.3751870733004 , 105.22840020939213 }
-},
-{ //#18 50
-  { 415.2899736115908 , 248.28503743140453 },
-  { 383.132009809137 , 143.10107732303027 },
-  { 834.8461899361268 , 236.37788741927557 },
-  { 510.84861548020615 , 229.77438011223362 },
-  { 595.1284468844315 , 503.12534225287672 },
-  { 232.65114492302735 , 587.83804069493755 },
-  { 136.40896328949276 , 216.30554746576382 },
-  { 447.7825097087861 , 432.08485653433075 },
-  { 188.37131351880203 , 131.1890028355807 },
-  { 524.1413654829653 , 65.15616834546817 },
-  { 634.1146134732168 , 67.07575852950498 },
-  { 654.23651802166245 , 357.40154411378535 },
-  { 600.6067311850837 , 252.34429206444833 },
-  { 649.1260350146003 , 137.31610094413395 },
-  { 355.925782999362 , 461.73691790508946 },
-  { 537.3299210888384 , 330.63011193745854 },
-  { 695.6202409259643 , 208.26160113483402 },
-  { 495.8555456099551 , 548.4329784417135 },
-  { 804.7903921449932 , 171.6660102159662 },
-  { 741.7010680779281 , 44.20755165645957 },
-  { 417.09156570444395 , 346.2827348805784 },
-  { 214.8729419458753 , 238.29747760331236 },
-  { 720.498088868112 , 146.1885038202605 },
-  { 529.9688001194544 , 453.3689059454485 },
-  { 285.4292991656392 , 113.69337630884837 },
-  { 206.84438234064817 , 56.44347235292287 },
-  { 567.5875956838446 , 24.01211458520642 },
-  { 354.6482489772108 , 48.21509200819615 },
-  { 598.5329002986546 , 402.6110641012595 },
-  { 14.79016772510238 , 92.94875610552178 },
-  { 190.39774250079324 , 420.9122536930678 },
-  { 259.6099053177826 , 338.778342489422 },
-  { 86.43161645914546 , 296.50147986673517 },
-  { 458.60381647254417 , 94.66261448485555 },
-  { 422.8950366517314 , 22.17965152293298 },
-  { 332.27946688288813 , 392.4449700300704 },
-  { 74.59945038466816 , 147.09778538998054 },
-  { 324.6069523367718 , 210.72290014199234 },
-  { 262.71486169597705 , 492.10384320681857 },
-  { 249.39065156508246 , 5.90442161855643 },
-  { 786.2054148457709 , 292.88899421318143 },
-  { 21.83743154219354 , 241.2877348805784 },
-  { 256.0027859355317 , 255.57551354739752 },
-  { 696.1284119096013 , 289.05039857087337 },
-  { 510.75346294150893 , 137.5290043439164 },
-  { 166.82270314467783 , 325.8770023088749 },
-  { 425.85328116700566 , 537.746383319457 },
-  { 574.8032380608063 , 167.98682461575015 },
-  { 104.54948380488736 , 37.28790214206323 }
-},
-{ //#14 51
-  { 408.1758698864102 , 170.64199569113867 },
-  { 90.45102046133854 , 129.62512330393153 },
-  { 350.5386926955901 , 23.52658995258533 },
-  { 791.14539892289406 , 207.5153691638858 },
-  { 560.0037560753394 , 175.73181159921643 },
-  { 303.45102046133854 , 273.6151233039315 },
-  { 115.67634559863018 , 371.3897981666399 },
-  { 120.6713455986302 , 256.13566400438947 },
-  { 331.4275372838738 , 374.8614521351654 },
-  { 799.8155027918354 , 131.81240982559552 },
-  { 240.22811569561168 , 428.18566226606004 },
-  { 823.65409843414346 , 461.8894127617652 },
-  { 403.02247530444964 , 264.02886315911655 },
-  { 607.8477328306373 , 94.73133251186694 },
-  { 508.9957232947011 , 262.10927297507965 },
-  { 617.8495404261158 , 519.79691744551417 },
-  { 185.86456585662728 , 296.48333017697684 },
-  { 478.51964485939106 , 114.72956916240149 },
-  { 215.48574922832998 , 535.356625691788 },
-  { 519.3668679445276 , 354.46829588377423 },
-  { 38.85232408542066 , 220.62445407798435 },
-  { 425.6663455986302 , 365.3897981666399 },
-  { 758.75866983593613 , 364.69553842304617 },
-  { 149.0673563016227 , 458.1126250997367 },
-  { 768.0910997025021 , 14.3158293072164 },
-  { 897.1191618138928 , 207.36898879003655 },
-  { 700.929950242079 , 111.77016543576565 },
-  { 293.06494443179156 , 493.92186640847933 },
-  { 719.2218968927118 , 290.70465302822197 },
-  { 377.3863610554355 , 459.0130620381509 },
-  { 186.51329406761894 , 104.79069096174334 },
-  { 465.48224985786203 , 493.19066226606 },
-  { 108.95223809087884 , 36.39479682563066 },
-  { 189.047390629576 , 188.64017259394785 },
-  { 619.9221060821343 , 294.96188132687837 },
-  { 676.88931037967774 , 22.44653819745406 },
-  { 339.8422548015839 , 99.89281964155873 },
-  { 228.311286432134 , 348.44829579877825 },
-  { 888.6162474887019 , 97.98152551848017 },
-  { 274.96972019564095 , 202.41978618770554 },
-  { 659.3075421378327 , 200.17418645966177 },
-  { 728.4833212318335 , 469.16276198026156 },
-  { 551.45267998265547 , 9.69700408704213 },
-  { 445.97585724153504 , 17.74546895067738 },
-  { 563.6273464243949 , 443.809002945802014 },
-  { 464.85769744940285 , 592.626153014171 },
-  { 79.78652205451914 , 503.19866188933423 },
-  { 655.9450867964665 , 392.4188331552118 },
-  { 249.42328695703674 , 21.889412761765193 }
-},
-{ //#52
-  { 478.4178827235853 , 325.44108382137443 },
-  { 296.16197384894906 , 83.2004367310757 },
-  { 460.1865605503343 , 428.83604981012616 },
-  { 178.7524552016014 , 214.049955299999 },
-  { 112.1785828268903 , 285.57538570831457 },
-  { 890.9467989819458 , 391.597428908114 },
-  { 271.3738050650073 , 166.0837000491038 },
-  { 455.56789592086784 , 612.8986974998643 },
-  { 401.6330575905886 , 253.83807599841273 },
-  { 76.0974880925684 , 553.3799015427356 },
-  { 865.032675404217 , 234.3308018560728 },
-  { 810.5787782541665 , 163.14979327033615 },
-  { 616.8605292649795 , 642.259538996449 },
-  { 359.6547583229712 , 640.6019776563926 },
-  { 718.0650493951563 , 133.5767993533976 },
-  { 253.3217479591847 , 333.5808199301728 },
-  { 161.1600062770245 , 534.7558628025099 },
-  { 639.5179442413933 , 564.0726587269003 },
-  { 498.72112777819376 , 121.70947162845596 },
-  { 748.3170717567727 , 465.554024126526 },
-  { 644.4474381995939 , 461.2776862515958 },
-  { 179.3437911589841 , 328.3822540411107 },
-  { 309.4277242121701 , 515.87670455268 },
-  { 362.16995157239313 , 341.21099878736504 },
-  { 741.8170573431951 , 587.6902699224627 },
-  { 654.91183184806 , 22.93708741387366 },
-  { 390.0687011247864 , 437.0975345461974 },
-  { 623.726464716071 , 112.2176271481486 },
-  { 571.4217955524525 , 172.41965225156528 },
-  { 651.4282968230899 , 358.5593119176838 },
-  { 305.7636260533745 , 410.9506616239452 },
-  { 540.2366183588365 , 544.2980966823727 },
-  { 818.5690941183893 , 543.5767993533976 },
-  { 553.9413683611403 , 418.3732661358646 },
-  { 823.8509978352868 , 320.0142219573096 },
-  { 392.41510959368406 , 55.2212937688781 },
-  { 296.64305759058857 , 253.83807599841273 },
-  { 248.36742673784687 , 588.5509251666164 },
-  { 887.4487315721027 , 464.33984052580877 },
-  { 558.8448888066468 , 42.9273549623642 },
-  { 410.78332371235496 , 528.2341814801804 },
-  { 531.03188930550186 , 642.0977001411532 },
-  { 204.3611897248154 , 441.6467669027854 },
-  { 659.6450808692298 , 215.5753857083145 },
-  { 728.2658516300017 , 293.9886653157805 },
-  { 325.4733577865143 , 739.8719729085649 },
-  { 100.1907653845813 , 446.9970670989667 },
-  { 400.69835255132216 , 151.45744926683943 },
-  { 570.2442057761505 , 274.5409217917115 }
-},
-{ //#24 53
-  { 498.8759764476105 , 258.79954896326974 },
-  { 450.08346431429135 , 29.030149395568785 },
-  { 357.83808854597413 , 88.93499685687158 },
-  { 265.5927127776569 , 148.83984431817439 },
-  { 818.9797313935287 , 340.71855442154099 },
-  { 233.4347489752031 , 254.02380442654868 },
-  { 728.9529793837802 , 412.63814460557781 },
-  { 161.79757178438297 , 176.90839868799532 },
-  { 556.9815389890073 , 479.65296948789373 },
-  { 280.5760648222222 , 11.53278484864552 },
-  { 214.3824304257284 , 79.37470459874724 },
-  { 131.3719236970257 , 17.21477200008134 },
-  { 525.2674244226656 , 61.1881131980226 },
-  { 557.2544277400193 , 4.2877829282870366 },
-  { 354.5764919889574 , 253.49034421782352 },
-  { 456.6964456984195 , 477.1514392922022 },
-  { 870.0043877945728 , 211.66897808413228 },
-  { 581.1854812859649 , 320.21317115092035 },
-  { 750.0064613781217 , 21.19155375326072 },
-  { 136.31934323664973 , 282.38662723572855 },
-  { 668.1498826125577 , 344.122963502673166 },
-  { 371.28952184289926 , 15.931342090224426 },
-  { 694.2842191987982 , 105.01994022477538 },
-  { 238.0578425909083 , 368.78895184231777 },
-  { 54.2645977561741 , 267.4282135076809 },
-  { 337.9653117120047 , 412.13076367848657 },
-  { 621.73198685073572 , 244.91020628347388 },
-  { 334.237364926247 , 177.88951784726902 },
-  { 659.7285312661998 , 7.519039206144438 },
-  { 23.78373287006444 , 362.16517687958816 },
-  { 797.9449737015303 , 116.37739635858982 },
-  { 242.4538073615776 , 459.03116069482364 },
-  { 745.7344506010562 , 277.2769811188254 },
-  { 725.017387417847 , 191.22738444303967 },
-  { 29.7428820568263 , 98.20926369610922 },
-  { 516.4827406945642 , 387.98467038596621 },
-  { 607.7230670491908 , 141.86485654246407 },
-  { 898.196038037026 , 123.76122083967905 },
-  { 427.05703835754576 , 174.41328115752378 },
-  { 105.31378917552337 , 97.223605191834224 },
-  { 317.9653117120047 , 512.13076367848657 },
-  { 417.4707782127308 , 283.9847360006349 },
-  { 156.4225615586279 , 372.61217361605514 },
-  { 512.5391069408165 , 162.02282034491793 },
-  { 855.77444826197745 , 22.11564905311445 },
-  { 307.54778114890047 , 317.82333164294295 },
-  { 662.8958672866817 , 480.47564942309683 },
-  { 411.6615369039882 , 387.9823241308037 },
-  { 26.329343236649734 , 202.38662723572855 }
-},
-{ //#27 54
-  { 357.5872831912886 , 411.6829699627152 },
-  { 377.51221320899737 , 113.17359670513119 },
-  { 685.7737138547388 , 491.57592131172038 },
-  { 354.1078041278652 , 222.3437479241602 },
-  { 309.37084075595794 , 322.82461281026985 },
-  { 261.1543983206273 , 421.6829699627152 },
-  { 294.9055069816934 , 79.18481749383069 },
-  { 545.09100935173262 , 379.47365066962675 },
-  { 476.89967648055375 , 101.67651103032199 },
-  { 409.1830708094846 , 15.003208241118628 },
-  { 280.83891041979405 , 180.89020237620036 },
-  { 163.4696048244662 , 468.16675257157476 },
-  { 209.5812968507988 , 175.38423908209285 },
-  { 688.11864268382305 , 373.88692116734944 },
-  { 457.80011341896807 , 203.99551578413474 },
-  { 75.24123502638324 , 252.62870173045894 },
-  { 195.45838403576664 , 363.5600463442708 },
-  { 624.99247600038645 , 442.56132290387836 },
-  { 276.77603356505581 , 521.4196800563237 },
-  { 114.178122935871 , 148.74607253074936 },
-  { 367.5122132089974 , 561.5138991431892 },
-  { 446.12010472411527 , 379.1829733602743 },
-  { 558.2809783050777 , 165.2585524122275 },
-  { 131.84027331988995 , 322.53393550091744 },
-  { 40.735247701730074 , 513.2615320933008 },
-  { 211.40401989081894 , 566.1685601670533 },
-  { 661.9478715291993 , 305.3542546528629 },
-  { 779.46100092140654 , 492.675722788234992 },
-  { 581.21481586292805 , 253.7207838166152 },
-  { 413.0850151370062 , 487.0689971054677 },
-  { 248.7825941666612 , 267.36062475600863 },
-  { 177.1378732726796 , 22.3696945019454 },
-  { 637.07979648579686 , 116.03251414847705 },
-  { 445.29364673319424 , 288.84937537690763 },
-  { 152.82735472135604 , 214.56476159350888 },
-  { 683.4952673994216 , 203.8408335989694 },
-  { 90.66966276808283 , 611.2633396887794 },
-  { 197.4800487576056 , 83.87870199805118 },
-  { 120.30670254484116 , 532.8477922381157 },
-  { 306.27055517705423 , 12.034926018308198 },
-  { 784.78500603649235 , 303.1698660647513 },
-  { 32.1535627921317 , 345.7272350818052 },
-  { 762.13054865725474 , 152.86248120935164 },
-  { 90.48173378921314 , 67.0652343282801 },
-  { 16.49167952889148 , 623.1007946209564 },
-  { 513.81262016573334 , 478.5700075352251 },
-  { 784.68985349779518 , 395.4152418330685 },
-  { 78.35404326612031 , 415.90474073305876 },
-  { 10.22591459535519 , 118.87370199805116 }
-},
-{ //#39 55
-  { 335.26320258481815 , 316.14787153312386 },
-  { 242.2389475391514 , 338.3941536248059 },
-  { 277.546596913749 , 229.47456874392054 },
-  { 257.9603367689341 , 539.04602358703164 },
-  { 155.2154643616866 , 237.14782479357194 },
-  { 230.75410995915908 , 15.41018300497245 },
-  { 451.9365053740215 , 398.864477204193 },
-  { 209.76702855769284 , 122.4410090975639 },
-  { 551.7757679016771 , 389.6209090313544 },
-  { 780.2223252470317 , 290.5876671079477 },
-  { 22.80963354184175 , 329.9554336300302 },
-  { 125.0529409685803 , 516.22989832836186 },
-  { 786.2163367782468 , 440.51351506354985 },
-  { 583.932942449316 , 527.1868178527532 },
-  { 590.19641652548756 , 78.35080400338813 },
-  { 231.0247056704293 , 441.14541292374076 },
-  { 702.1437950004542 , 266.14877785648866 },
-  { 362.21443548594345 , 391.53699175130936 },
-  { 692.6218109450319 , 519.633699702798 },
-  { 632.2187623223261 , 610.4636279489985 },
-  { 626.1895847684983 , 442.43310524758664 },
-  { 618.44120165504376 , 174.30906021512436 },
-  { 407.4301798372143 , 242.02522828449247 },
-  { 307.7995992965897 , 144.80245541419305 },
-  { 175.7491099591591 , 590.66431716722286 },
-  { 315.966450145955 , 49.11679896666931 },
-  { 832.39589368665665 , 220.3839787869191 },
-  { 111.44802380388009 , 141.54057215914958 },
-  { 483.45207756320633 , 571.9237812246605 },
-  { 720.4735650769032 , 171.21372425297227 },
-  { 498.7869711974564 , 299.64402384888274 },
-  { 513.6723614707489 , 195.55772151366622 },
-  { 26.94837555514835 , 409.5670209127131 },
-  { 510.3527846362805 , 485.7371721317421 },
-  { 402.35519650611167 , 574.5464134404848 },
-  { 353.4174146957596 , 493.5179439151103 },
-  { 399.70494950021356 , 142.71447436008012 },
-  { 56.453023803880114 , 236.79470632139999 },
-  { 145.82611289532878 , 329.5029128095309 },
-  { 135.0349586791334 , 412.73010849273857 },
-  { 615.4764594092821 , 315.5826671079477 },
-  { 25.5741463176833 , 489.0681291398326 },
-  { 409.4282830565098 , 36.3398863077158 },
-  { 491.5436887950632 , 94.70270911689568 },
-  { 13.58481693083472 , 129.20825171668872 },
-  { 705.38605390130095 , 377.6706622872384 },
-  { 402.38361072887193 , 657.750090730276 },
-  { 521.7378974362165 , 635.2005913209058 },
-  { 104.28502612025717 , 44.95102341803232 }
-},
-{ //#4 33 56
-  { 503.40053911421984 , 246.63286414352362 },
-  { 383.4436175529294 , 215.96604210950431 },
-  { 87.2441959646673 , 269.29025224039896 },
-  { 45.5300158376775 , 176.01344214415366 },
-  { 211.8800365467265 , 462.08402543062394 },
-  { 896.6316592362237 , 280.7873379152082 },
-  { 505.80303361055684 , 575.92262107293203 },
-  { 830.5454000778385 , 148.751657647204 },
-  { 603.9869937189311 , 223.76465727047827 },
-  { 567.8993214846796 , 323.8631906218245 },
-  { 348.751266927527 , 10.04645722861899 },
-  { 852.07547705842154 , 10.847035640356822 },
-  { 589.9999123174649 , 121.79548336306972 },
-  { 687.7163635035665 , 124.00929117992226 },
-  { 362.2571955879415 , 511.7318458814915 },
-  { 539.6135016116694 , 417.1400007180698 },
-  { 470.6405526165357 , 56.506281878886824 },
-  { 432.56380219217766 , 292.3715162762894 },
-  { 116.160822130421 , 420.2655152284137 },
-  { 183.0020239118369 , 343.9790417327785 },
-  { 787.6602965081344 , 356.04805159940906 },
-  { 680.4540696983594 , 27.412211017349875 },
-  { 649.4438540728038 , 554.90640875185443 },
-  { 938.7730744521721 , 66.51177407893555 },
-  { 818.5401118688861 , 232.45352576619416 },
-  { 725.7110752946141 , 207.7111592989124 },
-  { 651.9445209500183 , 381.62367698522314 },
-  { 925.0318523931393 , 163.42618195040984 },
-  { 183.2466078344985 , 253.48101093165627 },
-  { 235.80794594959946 , 168.34092759703736 },
-  { 347.73898728374417 , 411.45990661888817 },
-  { 704.2638038151764 , 292.0504771434885 },
-  { 300.6259023844761 , 102.08902543062393 },
-  { 381.6567734052352 , 121.15678177853596 },
-  { 237.2747698624739 , 28.99629155664806 },
-  { 469.0397726250911 , 489.93750025253306 },
-  { 263.3376107070562 , 534.4241965068939 },
-  { 133.6352644075833 , 140.20814999787697 },
-  { 437.36380134023716 , 392.24646739221464 },
-  { 777.6552965081344 , 60.79391743715867 },
-  { 39.9915171831342 , 78.8191091341126 },
-  { 559.6619316631328 , 33.71524251340217 },
-  { 55.57771290090864 , 342.9500263388409 },
-  { 262.5550271753699 , 359.3019428164344 },
-  { 474.7962044522525 , 160.0982377248775 },
-  { 124.65020047692576 , 52.60796797736852 },
-  { 290.83306243920975 , 256.3492178047016 },
-  { 304.54293443621134 , 610.9826160515622 },
-  { 624.4647464633803 , 464.73464247637722 }
-},
-{ //#38  57
-  { 339.1550480973281 , 150.30878012259623 },
-  { 490.9333998140045 , 128.37721460008646 },
-  { 593.6179109244317 , 167.79410537057404 },
-  { 393.3469452092932 , 561.2454214731318 },
-  { 119.7304206041883 , 34.396262436285525 },
-  { 136.32601152305614 , 365.56641365531453 },
-  { 692.6016901357322 , 232.44460527022318 },
-  { 156.94462060270405 , 232.98392082739042 },
-  { 702.7880621434607 , 154.38969628944182 },
-  { 20.020235531021 , 106.05560601631548 },
-  { 785.9584814959742 , 194.82580970583288 },
-  { 472.1352528317988 , 539.56400178548336 },
-  { 434.0475805975472 , 279.46546843413716 },
-  { 466.53088074751895 , 367.5553756705015 },
-  { 706.6266577857688 , 44.46669922561148 },
-  { 784.5265614977193 , 80.79202089603102 },
-  { 241.6369712281065 , 124.0643359465051 },
-  { 72.1352528317988 , 294.57400178548335 },
-  { 340.8311381622166 , 248.32382558658253 },
-  { 725.2506585703522 , 457.93682459466322 },
-  { 768.7697936842426 , 383.199861222756 },
-  { 636.8722162037061 , 340.044866671593 },
-  { 880.7687431312539 , 52.32451412520477 },
-  { 460.7571558673548 , 447.658861779719956 },
-  { 413.1694644572803 , 10.822154312970483 },
-  { 737.7420390606435 , 293.6841668582782 },
-  { 216.641218026895 , 382.05019626417408 },
-  { 226.7397513782412 , 25.99495881220345 },
-  { 44.22767263160625 , 200.91840313721943 },
-  { 245.4375496398444 , 287.38854607739972 },
-  { 546.4229049033562 , 383.76497101581876 },
-  { 141.8660947967333 , 137.80228593258482 },
-  { 649.9771725819005 , 433.37036738898956 },
-  { 870.7687431312539 , 162.31451412520477 },
-  { 526.2410491886021 , 227.29679948097177 },
-  { 19.11978471328115 , 26.930573073255346 },
-  { 623.064844816152 , 263.46890074033576 },
-  { 416.7397513782412 , 95.98495881220344 },
-  { 222.4322211642313 , 486.91776941960367 },
-  { 546.2436774554104 , 60.0755567352046 },
-  { 648.935207409483 , 78.44279953373369 },
-  { 351.2460491886021 , 350.55093364322215 },
-  { 583.9876489028446 , 501.09647162570798 },
-  { 316.43527360285395 , 46.34746384374291 },
-  { 367.92183905770753 , 448.75035523148426 },
-  { 307.506928031322 , 634.52324717484464 },
-  { 302.28731257468036 , 542.3946381981571 },
-  { 554.3728004976207 , 600.3617412740077 },
-  { 92.2022541354223 , 455.81295740166242 }
-},
-{ //#22 58
-  { 381.3518523715076 , 327.3021725863707 },
-  { 476.39999893138435 , 394.8499664008053 },
-  { 476.39999893138435 , 294.85996640080526 },
-  { 388.5580791812826 , 222.6663320043115 },
-  { 258.5848311910311 , 216.74674182027474 },
-  { 168.61158320077965 , 518.66633200431153 },
-  { 38.77232067312407 , 434.4227638314729 },
-  { 74.07997004772167 , 115.50317895058758 },
-  { 323.0797948806304 , 149.44738219273987 },
-  { 459.25828837070503 , 134.4091037056551 },
-  { 441.4049989313843 , 19.59583223855486 },
-  { 25.992297813470081 , 35.404645599241405 },
-  { 721.0067051586883 , 380.8611871895048 },
-  { 159.8145624105958 , 320.6472841681125 },
-  { 550.10327805809516 , 38.20105336150597 },
-  { 241.89395227530136 , 97.94175473999243 },
-  { 261.46942545247776 , 298.3839190110949 },
-  { 62.22810780588453 , 297.77907729506717 },
-  { 300.8777314866018 , 23.291254840343285 },
-  { 123.14125962139248 , 408.36388983918164 },
-  { 397.07715307486393 , 76.6154649712379 },
-  { 698.59765060534772 , 119.38689596683503 },
-  { 332.68276928364116 , 488.23373877282376 },
-  { 118.57875241818135 , 4.5364387261959997 },
-  { 795.6513277626182 , 256.61931541601956 },
-  { 785.36091159081346 , 115.37201678723397 },
-  { 792.209240240127 , 338.8575545309741 },
-  { 515.9073262300619 , 218.68893510988042 },
-  { 597.8104730981694 , 378.7160168778031 },
-  { 660.31183073233754 , 30.66370606308033 },
-  { 221.99961677383786 , 436.5803322745123 },
-  { 513.387909594298 , 475.2179785497469 },
-  { 725.00267432479507 , 207.85733288429623 },
-  { 162.9878723195418 , 99.83823055232614 },
-  { 673.03753125127974 , 451.848268590971 },
-  { 928.29627688189055 , 179.68025409425104 },
-  { 578.9949984643134 , 138.5904017585342 },
-  { 948.75838807769215 , 283.63046413967368 },
-  { 868.5131674845341 , 100.53824632167456 },
-  { 602.3074944751833 , 499.52562792434446 },
-  { 309.11502251239125 , 384.94315508369215 },
-  { 632.319208595208 , 224.7898233467963 },
-  { 157.7302387868235 , 207.00919397805416 },
-  { 882.01007019104884 , 263.658231837411 },
-  { 56.87374323794666 , 204.13901953264678 },
-  { 701.19549505373357 , 287.6643084825967 },
-  { 422.5244467439659 , 495.3413371398336 },
-  { 586.2392614590399 , 290.61639822796667 },
-  { 273.57717750879925 , 549.52749772366235 }
-},
-{ //#11  47 59
-  { 273.19476045322835 , 290.7446407486013 },
-  { 342.2743381257682 , 448.2150227252463 },
-  { 337.53197165848655 , 573.3859861509743 },
-  { 652.19733518959856 , 372.3764270829382 },
-  { 373.9115153165883 , 349.0996169866929 },
-  { 385.7484140938172 , 662.2443433034197 },
-  { 249.8153659874174 , 466.7126833617709 },
-  { 240.22910584260248 , 556.284138204882 },
-  { 114.0951973916427 , 611.06364550241403 },
-  { 460.58481810579167 , 400.81622265776207 },
-  { 430.67997064448883 , 500.0615984260793 },
-  { 455.5337792539651 , 593.320401217327 },
-  { 632.09880183825237 , 275.46409931718983 },
-  { 376.59916953436056 , 192.5744895295723 },
-  { 469.87597963060585 , 250.86030940258252 },
-  { 238.8129819652421 , 352.18728922094454 },
-  { 137.02771469124946 , 182.9882293847574 },
-  { 350.4407647192196 , 761.163928184305 },
-  { 724.5367910327353 , 335.05064587913984 },
-  { 220.43212377238166 , 73.81807816572841 },
-  { 529.4941280391598 , 447.55597097333185 },
-  { 328.53334214399683 , 111.80238677942833 },
-  { 305.3346742386321 , 711.8157981465307 },
-  { 144.08619205116173 , 517.0300361280827 },
-  { 526.2161872440686 , 68.3149642974734 },
-  { 74.67957935032376 , 82.60124153932084 },
-  { 528.7589208225199 , 724.4042759020856 },
-  { 472.35344665573473 , 645.2840912628374 },
-  { 76.92918133990327 , 246.075901619009 },
-  { 292.8267812360133 , 658.0226375591405 },
-  { 374.711955176607 , 7.16904030637152 },
-  { 561.8327444846757 , 521.2280223485205 },
-  { 95.86974961583107 , 398.17167897563735 },
-  { 170.476455843135 , 432.16045818693783 },
-  { 520.0017088762792 , 314.1317115473348 },
-  { 154.561231825167 , 311.7176833617709 },
-  { 581.8311469370256 , 373.83970583522677 },
-  { 610.1163743233144 , 611.031062616872 },
-  { 69.9005636700745 , 512.6207183374162 },
-  { 265.1289330628647 , 200.97253799845734 },
-  { 735.1144945264044 , 451.0805691504939 },
-  { 360.1539097425278 , 258.53282394969887 },
-  { 194.8379690929863 , 139.3634363129916 },
-  { 461.078958840422 , 172.8412615663835 },
-  { 430.63926652874494 , 738.5609013590827 },
-  { 288.0062765611204 , 14.884635868251735 },
-  { 438.3726046716524 , 87.55881860658972 },
-  { 58.10812981036415 , 148.29587875935505 },
-  { 643.336774389773 , 465.0255484405558 }
-},
-{ //60
-  { 242.6627383622756 , 171.4916902317981 },
-  { 424.4950665141259 , 66.51768071732857 },
-  { 669.0956866951168 , 368.38902901904544 },
-  { 513.6009346491701 , 423.54291416516274 },
-  { 467.1477096237069 , 225.57068130527313 },
-  { 149.9620705880169 , 220.7815096086888 },
-  { 598.1297424361665 , 325.7555191231583 },
-  { 380.7147612908657 , 414.3100379455704 },
-  { 319.5226586009458 , 357.55407232733194 },
-  { 493.71488864145147 , 336.7299624816293 },
-  { 628.0190446898234 , 106.13868636452696 },
-  { 446.3341836703398 , 478.18121245960359 },
-  { 674.5904387410635 , 273.2351438729281 },
-  { 779.0052925357785 , 262.2607005144572 },
-  { 356.9959006379217 , 21.77423633841376 },
-  { 737.1146731991234 , 398.63171929544336 },
-  { 702.152783133883 , 8.91121720743132 },
-  { 607.418533497104 , 36.23494938582706 },
-  { 628.5986514576175 , 180.04907232733194 },
-  { 876.6278988887624 , 157.01331810209865 },
-  { 435.6408042196006 , 350.64593978677483 },
-  { 154.8424611026801 , 351.2579190997997 },
-  { 551.8138263246208 , 251.65208015029367 },
-  { 844.9184301336752 , 324.96398067098545 },
-  { 523.21111303628163 , 39.0300117499335 },
-  { 243.8575961209019 , 425.8868461275496 },
-  { 67.8506124481653 , 380.48746630854043 },
-  { 598.5658520396782 , 528.8707569519786 },
-  { 830.9254138064118 , 481.4103317651046 },
-  { 443.3782894423593 , 584.0733494402156 },
-  { 398.2127129966009 , 275.05576287856366 },
-  { 323.5075952156535 , 229.59376496169287 },
-  { 585.9866572894022 , 435.1458965296383 },
-  { 245.5118260984027 , 298.67337407412606 },
-  { 757.7852482645795 , 467.479400620917 },
-  { 62.5365937365243 , 275.67164635841118 },
-  { 529.370132085195 , 141.8006565044655 },
-  { 796.870158823098 , 158.69662786769157 },
-  { 159.4938196727461 , 474.92341574301275 },
-  { 104.5655058435908 , 14.786246470851864 },
-  { 679.0956866951168 , 528.38902901904544 },
-  { 733.1402697965082 , 85.2549592255301 },
-  { 373.0290446898234 , 136.13868636452696 },
-  { 144.2339742163705 , 120.08369158569232 },
-  { 333.9897883654315 , 549.84544057818246 },
-  { 200.3219220827359 , 33.30698215412015 },
-  { 306.561637358256 , 470.4469013805677 },
-  { 287.524851101037 , 83.49590940624557 },
-  { 55.0413614155574 , 172.3600462775214 }
-},
-{ //#15 61
-  { 591.73283992191 , 431.94220982833 },
-  { 603.2653331510837 , 335.70002819479544 },
-  { 520.0956627310899 , 357.82680408977666 },
-  { 511.10736934862985 , 240.51606808642117 },
-  { 581.73283992191 , 571.93220982833 },
-  { 674.4173510323373 , 631.3491005988176 },
-  { 874.61743418335664 , 603.5793870191502 },
-  { 342.3720584150394 , 443.67453955784737 },
-  { 401.93721812960086 , 223.92047716755334 },
-  { 603.2532747654159 , 510.7856138289252 },
-  { 182.0623539412676 , 307.6809803585964 },
-  { 803.18354696083475 , 296.89699399008856 },
-  { 721.0953109629621 , 225.9695739372995 },
-  { 347.8051256426112 , 318.3811895480189 },
-  { 784.3403480961676 , 597.5105049565095 },
-  { 507.3700033158652 , 556.6005652394817 },
-  { 322.2333909239629 , 169.1911367963638 },
-  { 624.501085568512 , 103.2669367836709 },
-  { 383.81634643131076 , 622.9878957753228 },
-  { 683.5132223281882 , 472.5420989370069 },
-  { 585.1372490030421 , 671.102361047359 },
-  { 572.7782586354152 , 176.6579474866635 },
-  { 680.9517897334816 , 326.4639255276778 },
-  { 490.1202879471636 , 132.5468941790126 },
-  { 403.4469851579602 , 64.83028850794351 },
-  { 407.53074078820964 , 550.8441334123204 },
-  { 402.37756044510644 , 401.1971977497369 },
-  { 273.8430984410593 , 621.068305591286 },
-  { 514.80174181288 , 475.4116186554296 },
-  { 685.2342269292168 , 561.9885930387413 },
-  { 300.5659253741561 , 524.4593162942786 },
-  { 776.6678335490512 , 487.78843506843145 },
-  { 510.16981209105705 , 38.22129921093604 },
-  { 411.6486140860825 , 138.1095255154853 },
-  { 415.631590593851 , 488.8160277365618 },
-  { 796.0470479556409 , 400.4214544109843 },
-  { 896.5320275322653 , 367.1350324903746 },
-  { 238.13933578336264 , 173.74987338882883 },
-  { 272.3209878683815 , 277.0521292270683 },
-  { 249.527967118319 , 451.4166051311075 },
-  { 448.9173087373474 , 30.565942015211675 },
-  { 877.627579602587 , 467.6633471159399 },
-  { 687.8217601134694 , 710.5192518178466 },
-  { 715.1622060963037 , 396.60259246310244 },
-  { 175.81583132686455 , 411.47584194913355 },
-  { 627.1231149946631 , 238.40037328847797 },
-  { 432.1235901373294 , 305.1665679860703 },
-  { 711.35410890008836 , 151.2359660571261 },
-  { 473.73103232643143 , 631.8666248946827 }
-},
-{ //#7 44 62
-  { 522.4778078988661 , 226.20281188286623 },
-  { 532.0290254463023 , 7.4439644743253375 },
-  { 537.7854572734636 , 100.28322700198092 },
-  { 438.67223408606026 , 45.06276003871565 },
-  { 87.7084543372939 , 63.44463135967285 },
-  { 415.7549809657693 , 252.81180117987367 },
-  { 13.0704698553421 , 292.2286919503612 },
-  { 419.31265148887667 , 320.6961987211875 },
-  { 525.50084680351887 , 307.8068011798737 },
-  { 396.44444461583134 , 418.28265332589876 },
-  { 318.5812566194821 , 417.78004917012515 },
-  { 209.25451797228496 , 264.8302843573385 },
-  { 490.4056942648217 , 400.05217694819083 },
-  { 11.46600727628527 , 153.69860062077484 },
-  { 396.8670764924923 , 511.05685926637045 },
-  { 818.4086635267164 , 29.187403061016454 },
-  { 151.03807553695432 , 393.68864150978385 },
-  { 775.0577013860733 , 123.46723446524177 },
-  { 20.4549663074419 , 466.37315262021104 },
-  { 279.67391611901354 , 551.8514369208633 },
-  { 856.2798298207162 , 248.46906960730996 },
-  { 628.6088912757083 , 5.125626605860106 },
-  { 437.6474238256475 , 620.2636054896997 },
-  { 739.3495067989842 , 331.9319858191219 },
-  { 90.59648189586177 , 438.70164113305805 },
-  { 108.55430878286248 , 180.5730560586821 },
-  { 312.18721631717494 , 498.98286251532124 },
-  { 612.75573801078804 , 233.8753264299826 },
-  { 449.65931548752644 , 153.0319339461242 },
-  { 477.34794137860194 , 555.7938226382777 },
-  { 181.63572240789466 , 100.18707571758057 },
-  { 637.0558937905947 , 333.53281939888907 },
-  { 208.46376362803815 , 326.2174711616617 },
-  { 641.1795435717609 , 496.66559431553424 },
-  { 732.8874255065974 , 414.72563421666484 },
-  { 357.9720248966378 , 129.31998833737202 },
-  { 165.49358438523055 , 517.8785825214714 },
-  { 715.2821940649117 , 52.84223227692925 },
-  { 297.4844389474837 , 63.946559254074174 },
-  { 241.675197638741 , 167.94414738424302 },
-  { 773.1381112020365 , 233.44048245549322 },
-  { 309.9251882173203 , 332.1932843959967 },
-  { 233.19013351015394 , 452.1666434247022 },
-  { 616.0754832922769 , 144.4643125286076 },
-  { 324.43847808065925 , 232.67232055488472 },
-  { 107.64694319659418 , 263.58036949027667 },
-  { 871.0601132559044 , 159.27647577398446 },
-  { 594.3445067989842 , 427.1861199813723 },
-  { 495.8508557037927 , 466.4063593667213 }
-},
-{ //#25 63
-  { 428.7286386160035 , 303.98162184680547 },
-  { 340.88671886590174 , 249.18525624329928 },
-  { 340.7915663272045 , 146.93988047498206 },
-  { 243.77131312734838 , 280.82243343411943 },
-  { 243.77131312734835 , 190.83243343411942 },
-  { 134.383849855792 , 312.31951910892866 },
-  { 159.378849855792 , 477.57365327117907 },
-  { 345.8917188659018 , 394.4393904055497 },
-  { 86.66724418472285 , 398.992821898132 },
-  { 280.564692461121 , 469.0792807239265 },
-  { 410.89112938879015 , 18.6208757211693 },
-  { 689.53545105776811 , 291.40636729342066 },
-  { 628.7286386160035 , 182.9916218468055 },
-  { 309.90112938879014 , 48.62087572116931 },
-  { 228.92751527030092 , 566.1946864624799 },
-  { 29.630603596465285 , 383.6517430617379 },
-  { 44.93825297106291 , 492.57132794262316 },
-  { 241.05715264499534 , 380.0361247799978 },
-  { 214.64699522653973 , 103.6158757211693 },
-  { 163.17277076281414 , 53.58308911474002 },
-  { 552.4287435180246 , 59.82447473642867 },
-  { 455.3376279130109 , 76.26879491370863 },
-  { 427.6863770507429 , 166.9954381621567 },
-  { 750.9818714045989 , 341.43063201161647 },
-  { 535.203418380733 , 147.59914959913704 },
-  { 172.4789570794081 , 232.04316874006008 },
-  { 465.4934250932057 , 235.1964770319988 },
-  { 141.89574969979486 , 133.45797767774025 },
-  { 338.3149785418573 , 577.6917721372891 },
-  { 435.9071649483908 , 394.76793187510987 },
-  { 447.2345634227426 , 592.9994215118868 },
-  { 653.79794421394786 , 58.47896495988883 },
-  { 383.2492035715482 , 508.49617149441406 },
-  { 565.9755264355788 , 264.7819166725283 },
-  { 718.4134321121646 , 136.5078392379459 },
-  { 525.5136362152826 , 349.26736592786577 },
-  { 187.45925967175518 , 517.5469012614305 },
-  { 843.0516684489086 , 391.0911607895818 },
-  { 223.17108344313954 , 676.0339489901355 },
-  { 174.2536987894341 , 376.1246150250866 },
-  { 746.9901392617449 , 219.38394645339466 },
-  { 63.61938280776573 , 279.0450368344339 },
-  { 753.4264317354388 , 56.06624559685328 },
-  { 622.1493465819254 , 296.3004251042836 },
-  { 839.12081322769924 , 211.83865422281897 },
-  { 69.13081322769925 , 211.83865422281897 },
-  { 641.17262824858824 , 388.521773031974 },
-  { 483.384638097879 , 479.7581946680759 },
-  { 537.319457406672612 , 595.9281193028652 }
-},
-{ //64
-  { 648.1297424361665 , 280.7555191231583 },
-  { 274.5904387410635 , 173.2351438729281 },
-  { 708.6627383622756 , 181.4916902317981 },
-  { 424.4950665141259 , 26.51768071732857 },
-  { 669.0956866951168 , 368.38902901904544 },
-  { 513.6009346491701 , 463.54291416516274 },
-  { 445.1477096237069 , 229.57068130527313 },
-  { 429.9620705880169 , 530.7815096086888 },
-  { 350.7147612908657 , 454.3100379455704 },
-  { 280.5226586009458 , 327.55407232733194 },
-  { 493.71488864145147 , 336.7299624816293 },
-  { 628.0190446898234 , 106.13868636452696 },
-  { 446.3341836703398 , 428.18121245960359 },
-  { 749.0052925357785 , 272.2607005144572 },
-  { 336.9959006379217 , 541.77423633841376 },
-  { 757.1146731991234 , 378.63171929544336 },
-  { 712.152783133883 , 28.91121720743132 },
-  { 607.418533497104 , 36.23494938582706 },
-  { 620.5986514576175 , 178.04907232733194 },
-  { 876.6278988887624 , 157.01331810209865 },
-  { 915.6408042196006 , 90.64593978677483 },
-  { 374.8424611026801 , 351.2579190997997 },
-  { 548.8138263246208 , 251.65208015029367 },
-  { 840.9184301336752 , 314.96398067098545 },
-  { 503.21111303628163 , 49.0300117499335 },
-  { 873.8575961209019 , 405.8868461275496 },
-  { 947.8506124481653 , 380.48746630854043 },
-  { 588.5658520396782 , 598.8707569519786 },
-  { 830.9254138064118 , 481.4103317651046 },
-  { 743.3782894423593 , 584.0733494402156 },
-  { 383.2127129966009 , 275.05576287856366 },
-  { 323.5075952156535 , 239.59376496169287 },
-  { 568.9866572894022 , 395.1458965296383 },
-  { 985.5118260984027 , 298.67337407412606 },
-  { 757.7852482645795 , 467.479400620917 },
-  { 912.5365937365243 , 255.67164635841118 },
-  { 519.370132085195 , 151.8006565044655 },
-  { 796.870158823098 , 158.69662786769157 },
-  { 929.4938196727461 , 494.92341574301275 },
-  { 824.5655058435908 , 44.786246470851864 },
-  { 679.0956866951168 , 528.38902901904544 },
-  { 733.1402697965082 , 75.2549592255301 },
-  { 433.0290446898234 , 136.13868636452696 },
-  { 344.2339742163705 , 120.08369158569232 },
-  { 503.9897883654315 , 600.84544057818246 },
-  { 590.3219220827359 , 513.30698215412015 },
-  { 846.561637358256 , 570.4469013805677 },
-  { 287.524851101037 , 43.49590940624557 },
-  { 975.0413614155574 , 172.3600462775214 }
-},
-{ //#16 65
-  { 575.09410942793994 , 408.16845387063546 },
-  { 413.52789778881044 , 276.2918374042258 },
-  { 495.6878303874763 , 183.28133067552312 },
-  { 492.8940571972513 , 44.64549009346392 },
-  { 313.68863526115484 , 272.0482692313872 },
-  { 589.4941959909825 , 321.12325042562486 },
-  { 618.0780173056256 , 622.48752629101016 },
-  { 821.15169072996963 , 521.81645351919195 },
-  { 668.3723414979036 , 343.8644399050355 },
-  { 217.4892136728927 , 218.72405910049264 },
-  { 231.5305550112566 , 105.85463483489343 },
-  { 344.4077131495622 , 362.6973115710109 },
-  { 295.28837337772194 , 177.3871280640672 },
-  { 387.38422997209744 , 443.9436404022448 },
-  { 817.1062998601755 , 436.2711258551285 },
-  { 281.14204833856286 , 472.4111471730711 },
-  { 124.43446515931072 , 300.7777213869741 },
-  { 476.1192184587093 , 544.240299762537 },
-  { 411.10621883543513 , 624.6818934036296 },
-  { 236.43853924215364 , 321.7102301695448 },
-  { 717.7188365886191 , 614.77404018031933 },
-  { 153.7068782236754 , 224.48430988533931 },
-  { 458.2648611607177 , 366.7727022903355 },
-  { 567.2718753692178 , 105.41097935240681 },
-  { 413.2092637010902 , 111.12927270232345 },
-  { 291.1832217716048 , 628.5204890459377 },
-  { 320.076209710147 , 92.42194135736293 },
-  { 135.19221041091976 , 364.68674699208003 },
-  { 267.58869593838983 , 549.4003044066893 },
-  { 647.6517116878831 , 477.99811812900236 },
-  { 759.9154722378026 , 148.17837318452432 },
-  { 125.8053836464028 , 122.73929412367465 },
-  { 603.3064829407951 , 204.90120011762116 },
-  { 404.6758366492783 , 188.8842137388764 },
-  { 721.8785815965217 , 541.42220014110632 },
-  { 731.15729209240754 , 427.38671068398156 },
-  { 668.2113304020979 , 112.65582434930394 },
-  { 688.0124323719783 , 220.48933388648874 },
-  { 762.5116770001109 , 330.9423373038749 },
-  { 396.918908491803 , 9.569010471129 },
-  { 789.1607148594678 , 236.6625058996496 },
-  { 541.2393629642212 , 271.91498687053814 },
-  { 495.6880104960277 , 463.7869587788532 },
-  { 572.1211933440047 , 544.4245052883545 },
-  { 471.97606488727547 , 654.07383099089685 },
-  { 52.7583969572736 , 215.8052327304924 },
-  { 875.4358245864457 , 361.5150687576172 },
-  { 361.8834309610272 , 544.2632607472813 },
-  { 215.88482003990646 , 405.7109379836486 }
-},
-{ //66
-  { 431.6555485526498 , 181.31735841537164 },
-  { 339.82922550008465 , 130.41719638570873 },
-  { 293.8046387986994 , 36.05280946475922 },
-  { 567.28485725249374 , 86.1641038543938 },
-  { 488.8372008388775 , 269.36938134396166 },
-  { 192.13160269151587 , 41.79341255423778 },
-  { 714.5980598821019 , 493.60852230073726 },
-  { 140.5111974799986 , 180.905242144209 },
-  { 286.5814509041607 , 305.98347127797615 },
-  { 211.99096955150833 , 346.8329898468995 },
-  { 448.77946041855876 , 442.87851755290956 },
-  { 112.4179756345698 , 364.31926098788927 },
-  { 137.31145565198844 , 271.8020707415193 },
-  { 396.33902315233826 , 10.58847491834422 },
-  { 428.74642399397527 , 339.8174795627393 },
-  { 746.01317497280553 , 404.4557778571802 },
-  { 546.7960693965 , 480.5035685756706 },
-  { 344.8112158813813 , 457.49030142270686 },
-  { 507.46612315376336 , 383.1585356847036 },
-  { 532.4438228730587 , 573.3934250781655 },
-  { 574.8399739687787 , 229.58917139645797 },
-  { 525.26125532345134 , 165.67198246487817 },
-  { 672.5050671215732 , 76.72687706271928 },
-  { 673.91710851221467 , 258.52833738368474 },
-  { 36.6375389339465 , 406.59013939304396 },
-  { 36.8656767888696 , 56.085845889342664 },
-  { 677.901011958949 , 349.6222078210414 },
-  { 135.08232583517974 , 444.7435224914742 },
-  { 450.1522648325283 , 521.5264297557595 },
-  { 36.837084405391 , 291.3382378009528 },
-  { 780.4699985631599 , 307.1376087016616 },
-  { 116.22468570798816 , 110.035758913034 },
-  { 178.04167109262596 , 503.45318542686795 },
-  { 392.4756784490363 , 551.0370763972436 },
-  { 423.17178372787646 , 651.4395127258027 },
-  { 241.80575451198314 , 437.25084022128664 },
-  { 578.507589864867 , 349.3778559526081 },
-  { 180.71163453502373 , 599.8967770524521 },
-  { 827.01725025820895 , 98.58410939420189 },
-  { 237.8969054250519 , 235.22699821008695 },
-  { 237.20080014621175 , 134.82456188152787 },
-  { 359.00997797885736 , 363.1509679981068 },
-  { 745.2206376034476 , 130.492748573308 },
-  { 358.66340745795617 , 240.4380757712899 },
-  { 772.1442573677365 , 211.41781981541453 },
-  { 487.42059019870806 , 48.82178875162663 },
-  { 863.79198877057337 , 357.7028677489203 },
-  { 272.8072319415613 , 560.8563759984961 },
-  { 494.7747915508382 , 728.2243378587995 }
-}
-};
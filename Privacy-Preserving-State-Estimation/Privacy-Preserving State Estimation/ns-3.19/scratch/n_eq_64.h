@@ -1,3642 +0,0 @@
-using namespace std;
-
-/*struct coordinates {
-	double X;
-	double Y;
-};
-
-template <typename T, int N> char (&array(T(&)[N]))[N];
-*/
-
-struct coordinates n_eq_64[55][64] = {
-{ //#1
-  { 393.48559374606316 , 4.681463382721485 },
-  { 355.86679818167283 , 108.03825474296356 },
-  { 246.94721330078752 , 123.34590411756119 },
-  { 446.80980387695774 , 100.88088497098362 },
-  { 402.0728405050505 , 401.3617498570933 },
-  { 556.5318737650358 , 108.55339951809995 },
-  { 439.69163606944085 , 304.7185412173353 },
-  { 518.9130782006455 , 5.196608157857909 },
-  { 319.10714589945337 , 40.33539738885848 },
-  { 542.376147179868 , 265.3016504468477 },
-  { 744.17611482873826 , 115.67747304396758 },
-  { 494.68663606944085 , 399.9726753795857 },
-  { 94.9546726975336 , 204.23767633122566 },
-  { 673.5213670363331 , 180.71333211676586 },
-  { 222.0674374096761 , 208.05184839671165 },
-  { 329.82206164135886 , 267.9566958580144 },
-  { 54.8890877638864 , 110.23586873574706 },
-  { 135.57849346852026 , 337.79595838567 },
-  { 329.82206164135886 , 387.94669585801444 },
-  { 292.1498434412202 , 197.52315421478522 },
-  { 239.917214180056 , 375.71132008969724 },
-  { 398.2672328740827 , 255.70833211676586 },
-  { 377.17248209281723 , 192.9091715249504 },
-  { 477.4116891257876 , 32.14792535131484 },
-  { 173.5748066994064 , 111.17067217069184 },
-  { 115.0059636097093 , 72.27306396283538 },
-  { 412.83256837006155 , 450.1066284566803 },
-  { 480.1263995982507 , 187.67358415734822 },
-  { 688.4845330437565 , 14.782868302672831 },
-  { 722.7553591075009 , 45.100221068984624 },
-  { 584.9993805358621 , 2.3112178845653517 },
-  { 657.159313134528 , 85.32172461326805 },
-  { 147.2624198046264 , 169.82968672642073 },
-  { 586.0057322283413 , 162.11065672335508 },
-  { 188.17871482579744 , 249.30899548310805 },
-  { 158.2672328740827 , 48.51298132994427 },
-  { 229.7409864910125 , 14.710063535502002 },
-  { 742.9712082346497 , 210.80388203481397 },
-  { 673.83657354017197 , 534.22954950790634 },
-  { 657.56953174196883 , 349.62576357057065 },
-  { 829.2163848754631 , 69.13650874761233 },
-  { 482.31189820925056 , 456.7967269962987 },
-  { 144.2627021903603 , 483.9290133470736 },
-  { 797.371147179868 , 270.0475162845973 },
-  { 76.1820046855117 , 511.554472134104046 },
-  { 277.4876885966561 , 319.39295413380995 },
-  { 757.6140757339098 , 367.9221711482246 },
-  { 494.6394661936947 , 557.75389372236606 },
-  { 164.99616208018264 , 400.0488446813566199 },
-  { 549.859451502227 , 348.0173236869218 },
-  { 220.65191042232988 , 564.54228677688224 },
-  { 929.376429565602 , 57.2730288362564 },
-  { 834.4794215035558 , 169.617373633722 },
-  { 658.0949406200194 , 423.18520777631736 },
-  { 728.59934364345787 , 462.92650597083262 },
-  { 919.3256469552608 , 217.18924010015914 },
-  { 200.20878364981786 , 462.96728325573169 },
-  { 354.88502063154164 , 310.20887280008304 },
-  { 345.1159626989924 , 536.7799312458836 },
-  { 618.0267307803387 , 521.04876147166624 },
-  { 871.6442953481616 , 310.94801000190822 },
-  { 287.36205103318963 , 476.6543155381154 },
-  { 643.2510080156366 , 268.07388849759195 },
-  { 404.9826794208724 , 514.06892665427786 }
-},
-{ //#2
-  { 308.31468431924634 , 300.76484064739395 },
-  { 376.0312899903155 , 387.43814343659733 },
-  { 847.73157508973384 , 218.0803295369667 },
-  { 588.93455429955 , 96.09937737316575 },
-  { 478.51262527816226 , 82.60204523631445 },
-  { 278.51262527816226 , 2.612045236314458 },
-  { 105.331080800893 , 471.69537173525373 },
-  { 914.32186658690495 , 216.5996333664833 },
-  { 213.07553775567106 , 259.57615018901856 },
-  { 310.1909434942244 , 207.93897299819844 },
-  { 410.5212881751671 , 163.2754232355887 },
-  { 383.3276839425205 , 220.32324700630136 },
-  { 457.00507078402666 , 262.9602167317498 },
-  { 391.00019848963683 , 330.0453168943794 },
-  { 411.0602547371487 , 441.37801896894194 },
-  { 241.008748156637 , 224.68931883397414 },
-  { 793.79296861989855 , 389.9837904589656 },
-  { 760.4670475287237 , 202.34155900670038 },
-  { 873.1917825982063 , 25.39916818374327 },
-  { 167.64856379770157 , 148.88302769541417 },
-  { 498.36320792526885 , 529.4690576320825 },
-  { 285.4739638660858 , 389.08335352055127 },
-  { 589.21512125766066 , 192.4458358935812 },
-  { 60.2565284278717 , 109.93716540271987 },
-  { 760.0505108756173 , 256.9322363033088 },
-  { 191.03757861630007 , 195.4154497033721 },
-  { 526.515992729101 , 121.5985897720054 },
-  { 914.5947243228517 , 250.92513225513122 },
-  { 61.8309017103868 , 400.4496341435551 },
-  { 36.843901333661 , 480.89122778464764 },
-  { 769.86695486974406 , 27.31875836778009 },
-  { 393.8218274849646 , 596.43461510488166 },
-  { 636.79834430749986 , 327.68094393611557 },
-  { 697.2797602498347 , 223.88295647419835 },
-  { 387.14846586022145 , 19.81827204608945 },
-  { 541.9823044158742 , 295.5229801336618 },
-  { 143.39133549904517 , 78.18281850599172 },
-  { 46.275929760491806 , 26.545641315171586 },
-  { 196.77412592390368 , 76.20972062972528 },
-  { 598.8440728113785 , 274.20602100398975 },
-  { 782.2524102245559 , 145.4286704412969 },
-  { 575.9710836271746 , 400.1296863609657 },
-  { 264.4868824646196 , 497.05252742795983 },
-  { 479.87327765707204 , 370.5466713364611 },
-  { 374.4601304548711 , 495.1329372439229 },
-  { 495.8027796487655 , 185.23163589506547 },
-  { 273.2138016236372 , 538.1094540664582 },
-  { 760.4594770694751 , 112.7367924015901 },
-  { 271.32610092294874 , 118.9601448977185 },
-  { 581.24360982933774 , 1.9679914953112956 },
-  { 718.7455394600323 , 377.29369323824136 },
-  { 96.77412592390368 , 186.19972062972528 },
-  { 67.0452609278828 , 308.41856163900843 },
-  { 479.066836682175 , 529.1217164552233 },
-  { 189.27454227782366 , 335.7591433896567 },
-  { 181.47637573591692 , 569.2124600266258 },
-  { 138.12567604699748 , 363.11091226441084 },
-  { 104.43969717361186 , 242.36992337924357 },
-  { 799.3192032434496 , 310.9457538327937 },
-  { 676.7290677134929 , 13.743688083869074 },
-  { 663.9475539228241 , 95.657783732073142 },
-  { 540.5221824532657 , 412.92670599659465 },
-  { 23.04785253829516 , 296.97228486565825 },
-  { 365.86936673957524 , 63.12799967652278 }
-},
-{ //#3
-  { 545.0233812655151 , 199.79681013211214 },
-  { 258.42779034664727 , 308.96696135114115 },
-  { 336.20246520935564 , 231.19228648843279 },
-  { 630.4460333821943 , 321.0315490160884 },
-  { 727.81715445574008 , 91.16096955005295 },
-  { 570.02838126551512 , 295.0509442943626 },
-  { 607.20461772729647 , 29.66388387524376 },
-  { 451.72633342664426 , 108.8828336868154 },
-  { 620.80899478225697 , 412.32375271138324 },
-  { 215.9170921179016 , 44.88524555664654 },
-  { 736.51216387437466 , 394.7357377905237 },
-  { 135.57177868742286 , 151.06581701135576 },
-  { 228.85812655359894 , 606.46928829152665 },
-  { 743.0488852448563 , 340.4668764216955 },
-  { 102.95035189351013 , 423.5545486559471 },
-  { 645.47324533607663 , 87.97814477710423 },
-  { 298.6642218475743 , 477.84471748458753 },
-  { 356.33303965394816 , 114.8940544755149 },
-  { 194.2000054852495 , 305.6009257782864 },
-  { 202.63514538967124 , 470.0383312648066 },
-  { 66.35282887585129 , 65.58753271070351 },
-  { 125.55486062000658 , 357.32875271138323 },
-  { 103.77678823722586 , 518.2547737001372 },
-  { 833.5262955907059 , 90.40934686055576 },
-  { 291.18478562320703 , 589.7198071959425 },
-  { 25.23965411616769 , 310.84497010252363 },
-  { 270.50094308567515 , 499.3424440178276 },
-  { 1.7958360734249084 , 477.0517944903211 },
-  { 503.0344965739512 , 454.97818213984067 },
-  { 176.32607686610277 , 63.6679425266666 },
-  { 724.5529326999608 , 32.09147236642153 },
-  { 220.88954698486594 , 200.07004262187917 },
-  { 511.1485236188287 , 171.26162358545054 },
-  { 57.293005628366345 , 617.9395671962983 },
-  { 164.25876145214056 , 527.8099507886539 },
-  { 127.23784652068908 , 260.91055503617093 },
-  { 342.047415172485 , 382.94735604724923 },
-  { 437.30154933473534 , 327.95235604724917 },
-  { 4.091994741064738 , 564.7385563089967 },
-  { 412.04368619295605 , 43.15365975055971 },
-  { 794.7258647864196 , 284.3825111567315 },
-  { 41.71079030545498 , 461.38176494875466 },
-  { 280.5555798679396 , 173.94371527946907 },
-  { 38.080773952365185 , 260.1318500816928 },
-  { 853.97855881343202 , 201.0839666138833 },
-  { 524.83541127216495 , 27.29467742011218 },
-  { 509.39246131005675 , 90.68257935032278 },
-  { 215.1331151577045 , 90.23078009422359 },
-  { 26.93593810536371 , 168.27204382113072 },
-  { 394.96847542889307 , 450.493628431444 },
-  { 576.75500145620174 , 120.61950514857449 },
-  { 367.06363092870646 , 326.17318816091614 },
-  { 289.07796170275935 , 68.27326264147644 },
-  { 718.94311708155504 , 183.26155926865457 },
-  { 387.7768630412329 , 167.80721871411265 },
-  { 55.30928146639961 , 382.01259206660256 },
-  { 350.0016292557666 , 546.9705344783994 },
-  { 446.0626829142431 , 261.08402881035795 },
-  { 636.4389197854574 , 254.72480719594245 },
-  { 166.91667272237387 , 189.08913724666894 },
-  { 759.1914204499988 , 191.14994208924406 },
-  { 238.75937438627147 , 370.0900932529047 },
-  { 669.4343434918389 , 264.53843368169584 },
-  { 622.03118983242055 , 151.8536001865486 }
-},
-{ //#4
-  { 450.05302367050984 , 316.93980702147525 },
-  { 549.737817166671 , 310.45602441261565 },
-  { 877.57788456800506 , 83.46653114131834 },
-  { 340.66556039895346 , 45.4427213466661 },
-  { 372.3939244596308 , 425.6244949437722 },
-  { 347.65155799234907 , 318.4535315180442 },
-  { 398.4576999287568 , 469.87200530810344 },
-  { 481.4682066574595 , 542.0319379067694 },
-  { 88.8820028342841 , 246.5843641942207 },
-  { 645.9372387549331 , 363.78023454351023 },
-  { 415.3681636634183 , 131.78022872884088 },
-  { 581.5754726981739 , 49.275772450061 },
-  { 755.7765012825887 , 369.53666637067164 },
-  { 632.532829673801 , 254.61008332448122 },
-  { 340.355164040144 , 151.33863508774834 },
-  { 420.7967576812366 , 56.35163471102254 },
-  { 583.4491588212604 , 500.8289586969532 },
-  { 149.1571854450965 , 409.6393741233733 },
-  { 353.7207365568496 , 570.3528701942131 },
-  { 842.4498040717921 , 437.2532720417408 },
-  { 843.6184210326904 , 303.34303197417785 },
-  { 714.3411455534708 , 77.4814103209195 },
-  { 523.8969890917417 , 121.81631013425624 },
-  { 479.594520534373 , 388.0727932402449 },
-  { 51.34229419020346 , 348.2348281172833 },
-  { 559.0368028818103 , 621.59030692112435 },
-  { 550.6831045926826 , 918.77523454351024 },
-  { 299.46258118913727 , 243.46176918286514 },
-  { 145.8803753488512 , 351.35355425036306 },
-  { 832.8635439269772 , 546.8247268848519 },
-  { 513.4370168493218 , 592.9903362640164 },
-  { 197.5417157784656 , 564.91061798638873 },
-  { 159.2911302284892 , 117.53747731635156 },
-  { 937.895059868056 , 291.75584691310098 },
-  { 638.2892615009623 , 144.77082079682566 },
-  { 522.2129562691757 , 73.92930029277255 },
-  { 586.748035787034 , 406.8709402224505 },
-  { 870.9901834128277 , 571.7612417251448 },
-  { 728.0437230766257 , 119.0015570527159 },
-  { 830.7967576812366 , 136.34163471102255 },
-  { 685.6063929394794 , 508.6544977871199 },
-  { 109.8963207428223 , 104.6706394648353 },
-  { 254.1549318145397 , 332.38135406375045 },
-  { 428.5100800400608 , 232.05919301569935 },
-  { 137.41419498194637 , 276.49281028500826 },
-  { 208.70941192312318 , 376.09592071764473 },
-  { 91.73487299566 , 443.263016011096 },
-  { 290.6554251053722 , 499.22217033718306 },
-  { 188.07639836537874 , 484.78645533220975 },
-  { 127.95734334355285 , 190.9573875016915 },
-  { 734.4482698136615 , 289.93862289304565 },
-  { 351.4901536346572 , 208.53053445421386 },
-  { 678.1611468385557 , 447.0188752578631 },
-  { 111.38425017151127 , 531.3084508914201 },
-  { 947.4606138471133 , 421.6860681631431 },
-  { 609.6646228007555 , 147.02362871976996 },
-  { 421.43734222791875 , 657.0261729834165 },
-  { 485.4473512257818 , 450.8945436306005 },
-  { 555.2152380787961 , 581.59091562444587 },
-  { 930.2917238218938 , 371.059637645247 },
-  { 209.2557187964427 , 246.55170188912166 },
-  { 515.0765890854619 , 209.69259685166566 },
-  { 265.9130586380905 , 392.05120691145504 },
-  { 772.918211843268 , 219.08580367552148 }
-},
-{ //#5
-  { 176.9269643294401 , 381.68149187380055 },
-  { 228.5641415202602 , 284.56608613524713 },
-  { 129.44395688101196 , 375.97156030203223 },
-  { 449.55122292172638 , 312.5352600426557 },
-  { 576.9269643294401 , 381.6814918738005 },
-  { 831.18419262809647 , 240.981282684378 },
-  { 261.18419262809647 , 200.991282684378 },
-  { 584.5134189341514 , 314.5496987468458 },
-  { 498.09652039384488 , 230.88274933303182 },
-  { 572.35545513169757 , 509.7336588552201 },
-  { 614.2017228213755 , 481.5190392539562 },
-  { 695.70590832744426 , 96.77233287280637 },
-  { 398.4589511200319 , 552.2192484433787 },
-  { 675.7326603371928 , 143.69192305684317 },
-  { 199.79517120248545 , 489.26794647851176 },
-  { 113.94910277252342 , 34.83356590439779 },
-  { 308.43101178454464 , 506.47417328828675 },
-  { 17.30006491316655 , 129.11339730862312 },
-  { 139.5803623089597 , 219.91558623559803 },
-  { 253.4107469382996 , 441.3662853699616 },
-  { 350.7070533306452 , 492.39161849694756 },
-  { 163.3716759203971 , 574.3841587548692 },
-  { 463.109451019681 , 463.2354692320782 },
-  { 557.30006491316653 , 19.123397308623126 },
-  { 832.32583547565108 , 162.77484024904743 },
-  { 360.06818897536476 , 603.58957902684 },
-  { 570.9616760577103 , 115.5686134392724 },
-  { 679.4456932738379 , 384.57895807778885 },
-  { 362.64970981128926 , 656.2168365735475 },
-  { 471.4890921643542 , 23.852660529187588 },
-  { 380.1249327464134 , 41.05888733896258 },
-  { 488.93909014108438 , 102.56451479171002 },
-  { 272.72250337008313 , 326.29313820477853 },
-  { 80.44013925025229 , 87.5426699478221 },
-  { 354.15792914903034 , 358.5464808313552 },
-  { 848.5711033005556 , 374.20211575528367 },
-  { 743.21260498066496 , 121.15742069030878 },
-  { 91.4761664486727 , 508.36750954009744 },
-  { 110.57572951025838 , 616.6865142939102 },
-  { 796.9954960116005 , 372.883198671897 },
-  { 351.8484455627242 , 148.36364750008377 },
-  { 595.7120533306452 , 587.645752659198 },
-  { 61.079506644417194 , 195.75135707158267 },
-  { 411.8633602011641 , 443.0490972243497 },
-  { 690.23358752992607 , 327.900660887489 },
-  { 299.06987613982506 , 395.2762127583942 },
-  { 159.07864503545227 , 451.4478389822099 },
-  { 294.41547065171991 , 70.76057449944325 },
-  { 139.45762860260575 , 260.3612948537587 },
-  { 282.2081161701967 , 731.2298361968218 },
-  { 602.34349922221655 , 221.73466601073903 },
-  { 69.86642942556523 , 346.0514774337962 },
-  { 699.79517120248545 , 489.26794647851176 },
-  { 755.85116744062293 , 305.45877343854056 },
-  { 188.40931315766085 , 66.55558854635596 },
-  { 494.7577759167539 , 196.7241663851454 },
-  { 299.06987613982506 , 395.2762127583942 },
-  { 649.62755036605018 , 19.391327420545068 },
-  { 398.3322281715837 , 248.0484409962449 },
-  { 221.32791195622957 , 143.03983950276353 },
-  { 250.49673413225366 , 594.0033188820252 },
-  { 156.92561959505866 , 136.07989473563168 },
-  { 460.6515174067678 , 706.1512516399002 },
-  { 35.61488001018979 , 6.365093203447884 }
-},
-{ //#6
-  { 337.2360407245913 , 485.78973001095966 },
-  { 401.8865406242404 , 396.8059507996592 },
-  { 855.8718813066505 , 498.5835032011846 },
-  { 263.3921680769878 , 305.6201081943301 },
-  { 469.1485999041492 , 415.4593707219857 },
-  { 788.1172570749677 , 528.4883506624874 },
-  { 782.7796313485442 , 317.1171938691393 },
-  { 770.40065140389856 , 74.815047873284 },
-  { 316.4082563235882 , 327.58700098808754 },
-  { 858.2579156491963 , 247.89824405756767 },
-  { 747.2416948604968 , 183.24774415791853 },
-  { 189.72846037434215 , 280.6123164031654 },
-  { 665.9573244763018 , 545.47784393378475 },
-  { 161.9776364784212 , 390.71700425470397 },
-  { 422.7143250252435 , 555.0086798225312 },
-  { 305.8162321207293 , 178.6400013185343 },
-  { 689.5535724346797 , 415.54310525816044 },
-  { 267.0989673238564 , 53.6942863691154 },
-  { 871.95088446867265 , 388.79741407066706 },
-  { 101.8865406242404 , 258.3680511765159 },
-  { 322.51508994640847 , 76.20229876557494 },
-  { 619.2634139574037 , 217.43240037297824 },
-  { 509.6919591142927 , 47.2157272204856 },
-  { 550.7394150400088 , 477.04873271090787 },
-  { 268.7008263821759 , 449.0028241277142 },
-  { 437.53202651562674 , 324.20522049178294 },
-  { 596.7522881964488 , 156.71240145223868 },
-  { 222.6504379571228 , 219.11949421726126 },
-  { 220.48438394684524 , 547.8611812801596 },
-  { 572.5053912643913 , 377.8405751575954 },
-  { 440.7661670497573 , 478.96832289494466 },
-  { 531.6339099061288 , 539.7010304479336 },
-  { 730.9462936492397 , 553.2307171297691 },
-  { 166.0772993154977 , 122.8083626694903 },
-  { 340.8477602978935 , 616.3183893640207 },
-  { 796.4030769479779 , 435.2115405662421 },
-  { 399.9669504402036 , 148.39480318626443 },
-  { 108.6534263475266 , 416.9164258429661 },
-  { 292.0472780965848 , 391.0495189724978 },
-  { 946.3088508584584 , 475.888495183283 },
-  { 949.9858581583192 , 415.7530344511985 },
-  { 249.6656422187005 , 138.26969961889273 },
-  { 568.1593822978501 , 310.98591629181925 },
-  { 585.9078238522351 , 66.737206389719 },
-  { 388.5681889222541 , 244.57649425938484 },
-  { 510.4229383480332 , 584.6287805298348 },
-  { 495.7391523479821 , 269.31886072666657 },
-  { 127.5895022889976 , 595.6119215653788 },
-  { 550.0444641458321 , 131.95411607232597 },
-  { 474.9050317313106 , 105.6201081943301 },
-  { 632.8802387373627 , 496.7245136253983 },
-  { 132.541841956157 , 504.28270858153815 },
-  { 152.9580546808322 , 348.3026149382917 },
-  { 685.7360674077494 , 274.4335867632476 },
-  { 172.05761774241785 , 219.98361018447895 },
-  { 843.4411164487589 , 129.92353402702395 },
-  { 329.61915736832697 , 573.5449128536391 },
-  { 450.77075736172384 , 620.1569850063288 },
-  { 364.2677450598501 , 25.16274215990126 },
-  { 673.7517200956252 , 334.8640583350601 },
-  { 888.1345345442695 , 198.44914476860208 },
-  { 889.81451775348796 , 287.5530110819201 },
-  { 238.1632491874663 , 655.7352801345083 },
-  { 491.9850739755866 , 195.2803789422643 }
-},
-{ //#7
-  { 94.74147428008483 , 420.05253885239904 },
-  { 603.91162549911382 , 46.6481297712668 },
-  { 75.64191121849916 , 311.7335340985863 },
-  { 41.899544751217476 , 418.9044975243143 },
-  { 771.14694844686994 , 99.1727234916473 },
-  { 660.33426184390157 , 120.6531189794716 },
-  { 562.33279105219896 , 147.6670960388998 },
-  { 294.01015885046 , 143.56045753701517 },
-  { 254.59326807997243 , 386.24496864744236 },
-  { 309.6407994353695 , 36.9654825375785 },
-  { 667.6078342438708 , 385.29895689127375 },
-  { 219.2192748737114 , 297.72854489038144 },
-  { 855.2266298082611 , 508.6557482515158 },
-  { 715.1314772695639 , 436.41037248319856 },
-  { 201.26905794907782 , 592.4443902357045 },
-  { 476.6285629443731 , 77.0229092116422 },
-  { 493.5989840403902 , 33.168190849664 },
-  { 125.94246477746613 , 356.01436476339165 },
-  { 783.20246871694684 , 313.0666643747603 },
-  { 200.25333616381312 , 425.46839686276934 },
-  { 577.64044042679654 , 228.74751115801445 },
-  { 256.23639035423736 , 606.1356337566075 },
-  { 273.83145955729714 , 289.75583272115966 },
-  { 412.3253105457967 , 476.38237330806606 },
-  { 264.2360313456644 , 67.9176623770435 },
-  { 716.06970574901207 , 72.8417641677606 },
-  { 7.433865166952884 , 490.04799097753556 },
-  { 109.02368218076063 , 482.5395427744017 },
-  { 588.73511565878812 , 355.9285966846412 },
-  { 352.88542821359425 , 640.4154651608328 },
-  { 235.76852457483815 , 131.67548074350884 },
-  { 573.4504820233767 , 455.50993554478424 },
-  { 144.53721251983833 , 579.0839458012952 },
-  { 372.20520525307296 , 158.90474377850967 },
-  { 177.63203796903503 , 513.0800428520542 },
-  { 835.4533180709993 , 378.1592633523684 },
-  { 695.1190837360217 , 506.18443234915014 },
-  { 495.59994862213136 , 461.44746897724286 },
-  { 85.22817136331405 , 102.1620792554752 },
-  { 381.8006334647057 , 438.76875131969354 },
-  { 453.3662930997039 , 595.6785017889256 },
-  { 507.09703429694054 , 172.0600057056865 },
-  { 60.334261843901615 , 202.81394921770095 },
-  { 698.58006992239295 , 310.1295417885687 },
-  { 415.9111916916115 , 290.55437825293905 },
-  { 141.4886931706128 , 35.026442884152 },
-  { 615.728555681551 , 528.0217127598075 },
-  { 302.9573343442217 , 514.2827361025742 },
-  { 765.48201534931826 , 517.1905636515198 },
-  { 400.8548526634059 , 133.59249893486026 },
-  { 118.61842804103435 , 101.48720526735235 },
-  { 13.002974925826251 , 593.6502142458099 },
-  { 439.9218109241421 , 545.578046567713 },
-  { 865.1314772695639 , 436.41037248319856 },
-  { 331.6359028518343 , 238.114214634208 },
-  { 415.18172207560815 , 357.65841494727573 },
-  { 604.8600423911171 , 259.4571760740698 },
-  { 118.03490646936564 , 271.6713683859848 },
-  { 496.3527853327041 , 365.56737787621324 },
-  { 703.4057256649114 , 161.0747239334685 },
-  { 169.9057166870127 , 193.22768907288602 },
-  { 294.31680017020057 , 436.162385766356 },
-  { 403.43819923033135 , 559.0196994744814 },
-  { 631.6147224286912 , 188.0822604161987 }
-},
-{ //#8
-  { 358.8003707933712 , 162.07328260205045 },
-  { 231.68496505481784 , 100.43610541123033 },
-  { 705.03592719546097 , 304.71593681545568 },
-  { 935.3532799617727 , 310.44511075171135 },
-  { 327.38410605436414 , 531.43219215317754 },
-  { 468.7903707933712 , 162.07328260205045 },
-  { 17.662036166286086 , 339.1047067002939 },
-  { 92.67503578956023 , 258.6631130592013 },
-  { 810.43754798419127 , 64.95787686349706 },
-  { 167.63667429070355 , 397.11841354091473 },
-  { 28.525748901918746 , 283.21574971784696 },
-  { 316.15771657996595 , 121.60691472285394 },
-  { 735.035927195461 , 214.71593681545568 },
-  { 827.5986557300899 , 250.54026329040855 },
-  { 60.51707198710638 , 153.47915295082703 },
-  { 696.8176055416615 , 465.0619789897563 },
-  { 520.3605450480215 , 68.79647250580514 },
-  { 153.04912447275865 , 93.22987860145535 },
-  { 417.5095281132192 , 338.5652498181978 },
-  { 855.6681944226192 , 177.71605738669047 },
-  { 32.96968554088371 , 448.0242915811792 },
-  { 84.40758923182892 , 380.18586332194366 },
-  { 876.7595447007798 , 141.0862012005843 },
-  { 588.9924045535138 , 81.5166357984283 },
-  { 340.1685676823047 , 259.34181039398163 },
-  { 645.3902643106973 , 170.04354283957417 },
-  { 587.072814369477 , 191.48988378867978 },
-  { 783.35493194927375 , 485.6163737538699 },
-  { 157.69590012094773 , 296.6201587989791 },
-  { 792.05941037292575 , 305.9622656466896 },
-  { 545.40315389056319 , 290.2292129433614 },
-  { 836.9127580803587 , 457.30735475807353 },
-  { 47.86516436438437 , 61.07191479900158 },
-  { 743.32245386918123 , 389.4580293502452 },
-  { 272.1270680041679 , 229.78988827311963 },
-  { 308.4565958203903 , 23.7548976536809 },
-  { 427.06675328805244 , 525.70301821692186 },
-  { 867.64593354116698 , 359.62122388463206 },
-  { 80.16292609273883 , 16.10034397929357 },
-  { 452.93922573367753 , 429.55679147990452 },
-  { 448.13774158971324 , 238.35472899251548 },
-  { 169.15156099391442 , 516.80706648996113 },
-  { 181.52299497038229 , 178.54868613112353 },
-  { 761.78080595128495 , 119.95431924194303 },
-  { 124.58161770193237 , 199.47206023498995 },
-  { 620.55802129806784 , 332.91358284014655 },
-  { 512.300629551775742 , 452.3375101032724 },
-  { 915.42620121502296 , 52.1708469682536 },
-  { 721.2757988824446 , 168.18993858763164 },
-  { 946.4426041835253 , 95.5178404025237 },
-  { 250.23945529115537 , 325.0239604291427 },
-  { 425.81385397083596 , 60.82695377081656 },
-  { 621.87788517574063 , 278.25595258221082 },
-  { 346.75176099832822 , 397.04268076580428 },
-  { 592.12239266304076 , 431.77212398842403 },
-  { 204.76133927972035 , 411.2584010754522 },
-  { 4.257627085153949 , 229.93455548126488 },
-  { 959.51450794020803 , 159.22571028724423 },
-  { 62.23504461812848 , 554.3357025077938 },
-  { 230.18993114726183 , 230.6983654610661 },
-  { 550.07708081567467 , 499.5196626161681 },
-  { 467.2711789484367 , 492.2447317935113 },
-  { 118.52109381549856 , 584.63715701782053 },
-  { 126.25016906418313 , 499.9598537768585 }
-},
-{ //#9
-  { 525.4100877625881 , 243.68906094111588 },
-  { 510.1024383879905 , 352.6086458220012 },
-  { 372.9314749622625 , 377.3510122892829 },
-  { 253.4534005286336 , 258.3288144177759 },
-  { 561.2193290713307 , 139.691472810947 },
-  { 637.6248032381158 , 218.81165745019524 },
-  { 95.02569467483687 , 121.84955306084527 },
-  { 463.9044603098406 , 152.50321833578687 },
-  { 109.62157350188085 , 397.3456091939085 },
-  { 911.3487672192243 , 309.6321289994659 },
-  { 859.6955821621682 , 229.86130764694965 },
-  { 549.7222433965214 , 30.30400953939062 },
-  { 221.5338103445968 , 148.35556642752442 },
-  { 475.4015459846498 , 43.115755064230484 },
-  { 401.74888457859157 , 110.13537293385548 },
-  { 862.3671697053975 , 325.98262087592326 },
-  { 295.02569467483687 , 161.83955306084528 },
-  { 59.3782293958565 , 335.59048158320536 },
-  { 82.7255766521609 , 283.10595171160344 },
-  { 694.359273947927 , 381.7920615981318 },
-  { 620.0924383879905 , 352.6086458220012 },
-  { 258.1945115903552 , 477.83187717539255 },
-  { 801.5232558742308 , 49.1464269755448 },
-  { 513.3582479899364 , 550.57419018609306 },
-  { 792.8878398662085 , 519.2925223363049 },
-  { 637.6248032381158 , 419.77338722241456 },
-  { 443.6103527131813 , 501.95231542121246 },
-  { 919.6004296234711 , 379.04169695691934 },
-  { 730.5070350855312 , 113.79692687519392 },
-  { 604.597149517948 , 61.43581320566019 },
-  { 547.3541700821233 , 606.4242145170158 },
-  { 153.4534005286336 , 258.3288144177759 },
-  { 377.00651811130984 , 2.964409508127474 },
-  { 757.9264749622625 , 262.0968781270325 },
-  { 449.8563196345126 , 235.61773947411103 },
-  { 579.3389833651056 , 312.08846754644054 },
-  { 385.3036247867588 , 169.51206760796165 },
-  { 263.1754704167116 , 326.00132896489225 },
-  { 279.8911123727565 , 54.601586698947635 },
-  { 151.52325587423076 , 49.14642697554481 },
-  { 436.4526434836148 , 292.6103182618997 },
-  { 859.2997388872939 , 29.71822482069554 },
-  { 158.8188740011842 , 144.45518819260283 },
-  { 439.2796960445103 , 398.678153817457 },
-  { 742.2315094654197 , 453.76216643371504 },
-  { 708.3250124275382 , 303.06888574885164 },
-  { 289.5310485059665 , 376.9113179006952 },
-  { 468.35271918046305 , 609.1232788469405 },
-  { 556.58622099685 , 452.2934393181623 },
-  { 593.1267033178369 , 526.04542008884505 },
-  { 356.29736337098626 , 493.54503078217067 },
-  { 667.6848217521995 , 151.5343465570064 },
-  { 927.828318368338 , 32.96864587785015 },
-  { 361.1985093213644 , 237.6153182618997 },
-  { 770.6755476175028 , 349.92413471157403 },
-  { 669.1390014149495 , 35.47465664785693 },
-  { 496.29487629108417 , 465.06221486497765 },
-  { 666.3756405474451 , 528.7717226195916 },
-  { 927.3513374866083 , 153.7247131233119 },
-  { 88.30286774174 , 25.240563763837837 },
-  { 144.081910629277 , 194.93605307871252 },
-  { 182.0142834369664 , 340.8016995824853 },
-  { 873.8351200954678 , 94.03991962715078 },
-  { 795.1089801960366 , 133.71581295086438 }
-},
-{ //#10
-  { 484.6853753712679 , 356.0386725662906 },
-  { 433.0481981804478 , 158.9232668277372 },
-  { 574.7839087226141 , 292.951000332039 },
-  { 868.0607188188594 , 551.2368202050492 },
-  { 605.1012614889258 , 187.2218263957833 },
-  { 574.7839087226141 , 292.951000332039 },
-  { 777.6321736619705 , 341.6505600602342 },
-  { 488.52397101357604 , 206.11567550246025 },
-  { 854.6563097377273 , 460.40697142407817 },
-  { 307.19745411790285 , 135.8192072050843 },
-  { 333.3634046842867 , 305.40704943659676 },
-  { 686.8397608431844 , 113.6241510023725 },
-  { 391.6492245572969 , 398.68385953284206 },
-  { 932.3315448826037 , 320.91946743873746 },
-  { 333.3634046842867 , 305.40704943659676 },
-  { 368.3112348085406 , 108.44240194162757 },
-  { 143.2026672119423 , 111.1634812637582 },
-  { 872.3180451438366 , 44.40520119080084 },
-  { 577.6391942572013 , 459.83905231962274 },
-  { 456.602370946348 , 290.6021146724257 },
-  { 173.45855722298387 , 397.6524252049139 },
-  { 892.2330115312575 , 194.00713967298907 },
-  { 581.0586343443165 , 542.1454707783367 },
-  { 337.2020003265948 , 415.3300465004271 },
-  { 666.5369186449686 , 472.9265209667651 },
-  { 140.5181561015151 , 171.74659049327056 },
-  { 811.6209528732709 , 237.04385383293027 },
-  { 664.6173284609318 , 582.8997689570166 },
-  { 664.3488712364281 , 23.418119789334686 },
-  { 472.8029565588132 , 584.15397954185516 },
-  { 908.7363586118242 , 288.6810310237504 },
-  { 551.9157018495687 , 185.3645457273277 },
-  { 165.42799234923393 , 233.3888064010498 },
-  { 68.6384856980425 , 254.8869550337408 },
-  { 237.5172068304337 , 461.81382910928664 },
-  { 711.5419186449686 , 568.1806551290156 },
-  { 523.3808521653242 , 532.0579184594688 },
-  { 665.0160559930309 , 360.336358209225 },
-  { 855.3613126311393 , 331.4959443307482 },
-  { 926.8970695564647 , 92.3731249633077 },
-  { 363.0628603122285 , 570.60273059185687 },
-  { 698.4254716198204 , 223.4212479840454 },
-  { 388.2961992222792 , 25.80235179633851 },
-  { 605.2875235573994 , 399.1667864379661 },
-  { 871.8993144611675 , 394.5881775228591 },
-  { 58.5219611303848 , 400.5753626626772 },
-  { 273.45855722298387 , 287.6624252049139 },
-  { 188.04310612746633 , 201.37871213055303 },
-  { 448.48733000892366 , 92.7595090918044 },
-  { 665.1923710187021 , 306.9214106696489 },
-  { 576.6580683168504 , 78.19358230159969 },
-  { 770.5910528699627 , 51.885626560160944 },
-  { 420.065993186906 , 454.6348444279648 },
-  { 66.7050622962188 , 315.8584968712066 },
-  { 414.9202241055481 , 265.1652288747244 },
-  { 744.311593507677 , 395.15184610405674 },
-  { 751.5004878361112 , 144.8693466712263 },
-  { 276.7143668249298 , 399.6868808408221 },
-  { 213.55370976168106 , 305.4070494365967 },
-  { 336.79911354747003 , 205.1898150678949 },
-  { 473.7469971030467 , 54.28924333946404 },
-  { 440.5884648208954 , 522.5420341381811 },
-  { 501.0366878288533 , 410.1809452076513 },
-  { 161.49146417287244 , 344.1093999487802 }
-},
-{ //#11
-  { 488.0093774228642 , 385.71632392748336 },
-  { 221.9981566341646 , 351.1096177001794 },
-  { 816.9289623037495 , 370.4086745528857 },
-  { 743.412744912609 , 105.7238810567246 },
-  { 106.255384932821 , 210.40940851075692 },
-  { 493.7658092500256 , 275.87706139982777 },
-  { 718.2363370966219 , 39.20642930094073 },
-  { 236.2258198581948 , 524.5746810799287 },
-  { 876.4527795319525 , 268.0647864533861 },
-  { 49.92721360771753 , 385.8000584636581 },
-  { 198.4824149210948 , 189.20375861062445 },
-  { 574.9746734566997 , 9.86328886894546 },
-  { 645.3323350966458 , 160.75063306647314 },
-  { 583.8643426013718 , 338.9647336340793 },
-  { 959.3146768792739 , 397.29714413846733 },
-  { 885.1269250395989 , 384.0006911529699 },
-  { 403.996349038686 , 231.1752026338267 },
-  { 625.7939493482187 , 67.3670896964826 },
-  { 412.779206822593 , 366.5879020008316 },
-  { 266.6116095374377 , 476.1378484891414 },
-  { 857.6991083631864 , 225.08826963085076 },
-  { 368.5219785239366 , 295.8876928114091 },
-  { 414.41008889387103 , 121.60374779071562 },
-  { 293.2205988344451 , 369.4150215560445 },
-  { 500.7771006321688 , 61.19045869918529 },
-  { 179.93830674823437 , 408.4212428180723 },
-  { 923.5780001631064 , 464.68850595711103 },
-  { 385.9425821230448 , 15.361566157181002 },
-  { 291.78485708622463 , 234.6740821900116 },
-  { 938.736744177778 , 269.9207842855021 },
-  { 91.1735424389515 , 428.7765752861933 },
-  { 719.7716345596002 , 632.5304257072128 },
-  { 570.4502051797458 , 586.0608455529717 },
-  { 773.2584598771257 , 339.13973409707376 },
-  { 143.42203427704476 , 331.789487928565 },
-  { 790.3924922505231 , 514.2548595868456 },
-  { 702.6080621060015 , 380.91210723085374 },
-  { 669.5813796840037 , 213.8520680802459 },
-  { 545.8751103951141 , 71.54428411513271 },
-  { 675.337811511165 , 323.6913306079015 },
-  { 591.1735424389515 , 538.7665752861933 },
-  { 673.134716290173 , 546.6439547824841 },
-  { 428.2566459507862 , 463.5875996784626 },
-  { 455.2526035686217 , 172.19077432182917 },
-  { 326.27569378698524 , 422.3846204686464 },
-  { 519.5940490022454 , 153.76171159316942 },
-  { 543.2514237386122 , 481.9994800519202 },
-  { 229.1803091470603 , 263.3331664362805 },
-  { 948.6108597818508 , 334.2584208498799 },
-  { 779.1528345271147 , 223.43832822506084 },
-  { 759.2508494029685 , 562.4713020221761 },
-  { 129.6251733563489 , 268.84706808024595 },
-  { 739.19662819946 , 259.260807935431 },
-  { 676.5848575276892 , 474.2182583051045 },
-  { 304.83863405075994 , 131.1900079355306 },
-  { 586.6628689582578 , 229.96958287804478 },
-  { 817.6238003681783 , 157.70934362613153 },
-  { 469.6537483452014 , 563.7379794061789 },
-  { 836.452895979397 , 449.44238095825415 },
-  { 70.5376453905752 , 516.68133930514847 },
-  { 763.3000700511844 , 472.3610205042274 },
-  { 799.3801036093737 , 45.98870656926508 },
-  { 100.09276821301034 , 126.18500793553056 },
-  { 587.9290212031962 , 435.73447353001086 }
-},
-{ //#12
-  { 250.2936090097661 , 351.3908442304386 },
-  { 386.4930305980282 , 418.066634099544 },
-  { 46.5700335341979 , 244.2280384572359 },
-  { 336.55861553167546 , 250.06482650406542 },
-  { 303.4825238693255 , 360.22656669820987 },
-  { 398.06424298442283 , 98.87898389873635 },
-  { 341.41520512506594 , 4.599152494511046 },
-  { 173.2132421739558 , 446.60924289284563 },
-  { 553.82067481158424 , 508.71824642639194 },
-  { 133.20182417143337 , 152.44603093967513 },
-  { 623.4575367571189 , 302.86776311003683 },
-  { 98.0642429844228 , 98.87898389873637 },
-  { 391.55361553167546 , 285.31896066631583 },
-  { 66.8784003790938 , 37.373356445988925 },
-  { 726.89348942571814 , 73.81810230608265 },
-  { 454.641287765927 , 195.22042731496964 },
-  { 156.00701536418077 , 355.24508347490485 },
-  { 460.46971267094114 , 302.99807783061726 },
-  { 404.0252825526728 , 581.40455691079393 },
-  { 619.1803636902157 , 456.25877381302936 },
-  { 271.21504976943436 , 196.67482782649284 },
-  { 595.43848892091984 , 524.070742319853 },
-  { 899.1356286777502 , 101.07356563541137 },
-  { 524.0088951642715 , 22.180925115262525 },
-  { 463.71354813034134 , 402.30845393761314 },
-  { 265.3597879738872 , 257.6299910480494 },
-  { 242.27878412745014 , 133.41578864470858 },
-  { 180.4543464821105 , 547.1472760576 },
-  { 664.0656330988379 , 357.54205558778267 },
-  { 417.2860682311747 , 48.78991441226998 },
-  { 645.2552421385833 , 69.77699581373614 },
-  { 301.79069468457527 , 452.0033809588822 },
-  { 285.7850222100025 , 23.14569322195878 },
-  { 833.9956285559464 , 240.4237642382744 },
-  { 557.998079126169 , 157.60163175057934 },
-  { 655.5591741658428 , 135.12057103298116 },
-  { 52.6502240039387 , 317.6262879105145 },
-  { 420.8902577461609 , 543.68437620506943 },
-  { 195.12720000342898 , 218.8396093081197 },
-  { 71.5347616012252 , 562.4549254321976 },
-  { 281.16238068749874 , 109.99315581944818 },
-  { 485.20587411625706 , 467.0218116474609 },
-  { 81.4567940724072 , 195.0289039232087 },
-  { 77.7698353716833 , 386.56416682808754 },
-  { 155.43679091005686 , 261.4685866903575 },
-  { 1.0130468131186063 , 414.7416936490679 },
-  { 371.0096444961469 , 517.4816652595344 },
-  { 754.4248239278287 , 392.5000959481131 },
-  { 34.7933185491481 , 487.8104956593214 },
-  { 510.0196262178713 , 112.01520564019076 },
-  { 152.7573275676964 , 8.61053481138046 },
-  { 938.3921423611123 , 278.30317199618696 },
-  { 286.9469093043715 , 549.3077398776163 },
-  { 826.6888816846295 , 101.13179182168065 },
-  { 552.2416472990077 , 267.4408942782349 },
-  { 238.2290213448189 , 469.3726011948916 },
-  { 732.5937176057723 , 177.7094992931553 },
-  { 103.69755792354582 , 454.15858441955544 },
-  { 882.3214712830792 , 169.57919308815883 },
-  { 513.9267492013266 , 418.3168846765424 },
-  { 737.61941128660976 , 217.7583591315725 },
-  { 189.5856006217404 , 76.46990335285341 },
-  { 372.3482232928277 , 167.65960290412204 },
-  { 582.7394581370045 , 346.82458811906326 }
-},
-{ //#13
-  { 465.0207343262773 , 289.75169297521575 },
-  { 358.7785526927427 , 318.219199746042 },
-  { 859.29156039002163 , 390.06904574152753 },
-  { 278.3369590516502 , 563.2321993693162 },
-  { 880.27864179148776 , 212.09987183411897 },
-  { 271.3590569106025 , 227.40752120871662 },
-  { 299.3867129287188 , 147.82366997321034 },
-  { 176.35600688784925 , 134.4351785791324 },
-  { 321.15975712835245 , 421.5759911062841 },
-  { 428.3307205540805 , 396.8336246390024 },
-  { 534.5729021876151 , 425.30113140982866 },
-  { 740.74652018215886 , 138.90460688352582 },
-  { 864.4755204983959 , 287.91108193907377 },
-  { 758.7444604092655 , 287.2621697958913 },
-  { 181.02785473819637 , 200.5888670066879 },
-  { 815.7209435156998 , 165.49446467655935 },
-  { 777.19531620409555 , 345.01575693398564 },
-  { 563.7744054950434 , 532.728209797751 },
-  { 222.83978949670876 , 534.1199720752935 },
-  { 429.2114930175346 , 85.7541048450469 },
-  { 170.36778514424162 , 54.2192807707824 },
-  { 743.73146078599126 , 66.82057615479874 },
-  { 234.48645433914913 , 489.29259677735325 },
-  { 553.4592997096963 , 223.2605820394246 },
-  { 119.70696902849238 , 528.7150099833577 },
-  { 402.6650319290165 , 597.70427274524127 },
-  { 472.06867054016004 , 191.0627482076291 },
-  { 110.16237249135546 , 346.5932588290307 },
-  { 203.96419732714878 , 599.4152191727802 },
-  { 78.82692999812207 , 128.93135889327436 },
-  { 481.80202243139945 , 51.02697772268516 },
-  { 222.98936866433993 , 379.90513350579687 },
-  { 289.8431507868216 , 14.28085899362526 },
-  { 66.78455204473816 , 444.02143872394737 },
-  { 573.8629837699523 , 276.4139962642646 },
-  { 580.7454417449797 , 60.7310247549898 },
-  { 45.88411510632379 , 335.7024339701346 },
-  { 100.74398624670835 , 291.9962864785815 },
-  { 218.47524601792526 , 160.99288187677166 },
-  { 375.9657631379064 , 53.41874199741613 },
-  { 501.92839594749125 , 478.57212399326096 },
-  { 287.46971008591356 , 297.190426756536 },
-  { 659.26430249911596 , 399.59095550287134 },
-  { 46.0159940696596 , 203.42444134101595 },
-  { 761.2111505740584 , 430.042293731779 },
-  { 659.701481343231 , 194.79307526859836 },
-  { 421.6406220144621 , 466.3129544781914 },
-  { 338.241806512953 , 485.4775751376334 },
-  { 130.4888662089803 , 453.48335546861057 },
-  { 599.9430823185559 , 123.5757885432635 },
-  { 351.4771098946642 , 567.3051650425398 },
-  { 93.55662965344013 , 225.98036408205655 },
-  { 107.76477573888664 , 646.0910090418856 },
-  { 466.9403245103141 , 520.35964649809074 },
-  { 937.1448779487514 , 335.32799718625495 },
-  { 739.1171179322026 , 221.41899626426454 },
-  { 895.39349826862235 , 142.98233839166596 },
-  { 370.78679204131845 , 226.97111760296644 },
-  { 667.0569751031071 , 304.9990813936832 },
-  { 202.7421786512298 , 321.93070154493427 },
-  { 74.3574689281415 , 617.6987891946582 },
-  { 311.61096396770876 , 97.9043558962607 },
-  { 528.8115854401901 , 352.0966612670951 },
-  { 491.0234974376706 , 138.88343791786113 }
-},
-{ //#14
-  { 598.5859508140032 , 211.0755888091353 },
-  { 97.9734140855596 , 499.5785031343261 },
-  { 560.9671552496129 , 314.4323801693774 },
-  { 407.9734140855596 , 509.5685031343261 },
-  { 190.6167769065947 , 209.08850740766914 },
-  { 81.4896314767001 , 209.883709638165 },
-  { 417.01910151318384 , 271.82700676192775 },
-  { 222.4951297849075 , 328.7874529458977 },
-  { 553.1706267228874 , 590.7841465765793 },
-  { 724.5773037109516 , 299.9822429895112 },
-  { 942.6926106865162 , 511.86466180196595 },
-  { 926.6081298035431 , 320.96932439097736 },
-  { 834.2993735990296 , 587.6547575366275 },
-  { 772.7937461462823 , 398.84060014195654 },
-  { 657.8111090133592 , 218.9883722271764 },
-  { 456.1898565208902 , 100.72014598188072 },
-  { 662.5580899944438 , 592.2812322513885 },
-  { 537.1005595154543 , 90.40371391150804 },
-  { 247.4443079664486 , 259.29203124446593 },
-  { 147.7455240797119 , 120.9865646316978 },
-  { 700.3008995384433 , 419.29057302240415 },
-  { 927.3491554277514 , 567.04665547614871 },
-  { 463.0720933715412 , 453.8718188108309 },
-  { 242.6926106865162 , 107.90275747436404 },
-  { 345.6691275090513 , 6.656428643130113 },
-  { 656.5050630247291 , 54.236363373021206 },
-  { 634.9429021403138 , 111.40191762246513 },
-  { 463.5028841220435 , 172.14221326576663 },
-  { 300.4353823878598 , 57.202548284941585 },
-  { 521.5666344128697 , 406.04511399585692 },
-  { 847.780746523008 , 479.28219378304914 },
-  { 637.0453148902894 , 495.24379293035418 },
-  { 927.605045438793 , 253.53559941730458 },
-  { 761.111769252033 , 20.247584161720717 },
-  { 289.9991405065356 , 427.6921513240742 },
-  { 944.9379864548334 , 47.99791001306122 },
-  { 327.6404580388162 , 226.71577449830818 },
-  { 555.2587341934952 , 11.25984655048601 },
-  { 862.7405240797119 , 25.732430469447408 },
-  { 335.6422656342947 , 296.65018956466093 },
-  { 35.7085812882717 , 295.3619939388172 },
-  { 807.5955518608926 , 119.93237765788183 },
-  { 649.1106728915405 , 344.7214420226336 },
-  { 187.9734140855596 , 419.5585031343261 },
-  { 254.811272248568 , 174.8997588352454 },
-  { 721.3944789380029 , 117.63833386984777 },
-  { 740.6357823438285 , 504.0245602503308 },
-  { 896.302665118894 , 211.07558880913535 },
-  { 736.4650131154331 , 585.5227314111616 },
-  { 286.5805952308159 , 523.40307426201906 },
-  { 498.2424242819751 , 302.24453558411903 },
-  { 872.4785396424434 , 352.35681753309694 },
-  { 594.423955162766 , 441.6633982186588 },
-  { 133.9354509143541 , 300.0593680204358 },
-  { 378.262550805074 , 361.7404011548285 },
-  { 945.2285257791096 , 406.22164440777203 },
-  { 102.0864141041953 , 390.188274202549 },
-  { 976.9156752987409 , 154.39097371282998 },
-  { 732.7157805528414 , 202.39753970859806 },
-  { 514.7127388972218 , 207.98743106949698 },
-  { 829.3332199884784 , 253.10918601587287 },
-  { 471.4126285405305 , 543.72230528047308 },
-  { 900.4359793829276 , 106.44700574998285 },
-  { 358.8961778947396 , 138.15343405446612 }
-},
-{ //#15
-  { 547.7351412116793 , 443.592672958122 },
-  { 121.3328166050901 , 361.8541736038634 },
-  { 672.9699937959102 , 264.73876786531 },
-  { 494.2189238205389 , 543.2774664542832 },
-  { 323.0469967320798 , 460.90017222300196 },
-  { 568.9724056657413 , 228.92952655656734 },
-  { 535.8545323044378 , 292.63522379229175 },
-  { 714.1729730057264 , 366.719720029111 },
-  { 662.5357958149062 , 89.8732214400624 },
-  { 157.2905649049184 , 151.06090969534637 },
-  { 474.2800581762157 , 78.90097709668046 },
-  { 70.1753848755575 , 330.9104787203683 },
-  { 870.6334513367912 , 283.7683790960473 },
-  { 782.8929908597406 , 260.90017222300196 },
-  { 532.5658780492258 , 172.17778719292576 },
-  { 747.1172339456507 , 184.0835855998862 },
-  { 240.646287865189 , 282.1510351831772 },
-  { 601.0593513425739 , 539.7920945463842 },
-  { 617.1888481010719 , 327.7878837090127 },
-  { 427.96177675476184 , 321.56792595366477 },
-  { 448.1204136858894 , 164.46531877647854 },
-  { 349.6180503578021 , 560.78297958342444 },
-  { 745.2358194244428 , 112.82814158565841 },
-  { 232.4344736514678 , 440.3173954225218 },
-  { 737.1118451649022 , 323.94928806670464 },
-  { 662.4745250132926 , 183.2188734978002 },
-  { 789.03639783618064 , 59.503931454763816 },
-  { 793.1858916042602 , 544.68889393651955 },
-  { 340.7173930823679 , 78.60349451634947 },
-  { 842.7978383210434 , 353.1455479913191 },
-  { 105.3591192747392 , 111.58169630698006 },
-  { 387.5639837087189 , 473.4425469622078 },
-  { 460.33656508368216 , 246.13575336634233 },
-  { 288.0090796307985 , 136.41368347826426 },
-  { 647.5431339514334 , 440.1073010502231 },
-  { 484.6474689774277 , 353.49413960677583 },
-  { 825.3744821849634 , 150.94371705576884 },
-  { 156.4062335588996 , 257.7421288727238 },
-  { 429.7011722936684 , 13.952994616700323 },
-  { 772.1072506580173 , 450.2869612952475 },
-  { 295.6625086538886 , 346.8015350828264 },
-  { 43.4242373179337 , 156.03722001499614 },
-  { 579.4640182845899 , 111.05894089913429 },
-  { 842.0976720887181 , 209.22953692877905 },
-  { 208.7792351046529 , 368.73635599547885 },
-  { 235.6342913018782 , 211.8458560655867 },
-  { 496.14016946316764 , 6.103412006327815 },
-  { 354.2167910610935 , 640.77365837847674 },
-  { 644.7149812125367 , 42.794253207606715 },
-  { 340.7173930823679 , 78.60349451634947 },
-  { 93.8888764215464 , 230.4656268171127 },
-  { 539.573960044025 , 631.0943824516893 },
-  { 347.63725513797687 , 365.4908752778842 },
-  { 612.2600064712229 , 371.75540843154 },
-  { 291.1837234937061 , 254.94130518593767 },
-  { 349.262056533444 , 212.68176121180915 },
-  { 619.8473780376497 , 620.1158497514111 },
-  { 721.8283302014506 , 601.3188289612273 },
-  { 219.9162131969324 , 135.9094056215489 },
-  { 236.40623355889954 , 71.18850868023324 },
-  { 464.530715526934 , 454.38798968753764 },
-  { 699.9177084950193 , 491.5756521110536 },
-  { 386.7246554711332 , 115.19932344793423 },
-  { 385.0327414516379 , 254.56385212782476 }
-},
-{ //#16
-  { 166.23079376503478 , 400.8609113304527 },
-  { 667.37243661258938 , 352.64446889512215 },
-  { 573.9033083121511 , 291.13884144237466 },
-  { 778.45611890232642 , 468.6355861931611 },
-  { 425.68686587682046 , 389.99719859482 },
-  { 576.2920214934747 , 367.95211826971973 },
-  { 531.807081042969557 , 572.9154175973864 },
-  { 291.1406300127536 , 439.2186954226735 },
-  { 74.21851481598998 , 337.6226240512342 },
-  { 131.49187453913066 , 619.399200206246 },
-  { 258.16053661080747 , 361.83905063179714 },
-  { 67.61632235171223 , 676.9130057275553 },
-  { 437.62627012135542 , 492.03999527429323 },
-  { 47.60952551898252 , 230.89979711813737 },
-  { 124.26536021106911 , 771.1928371317806 },
-  { 155.47602550038027 , 322.4221598613095 },
-  { 167.24187703360428 , 669.9465083005467 },
-  { 699.78383865251155 , 476.8374909870638 },
-  { 478.0571104582981 , 227.69962698740386 },
-  { 751.54379113657797 , 568.7341195445073 },
-  { 438.04926267650416 , 601.3829243682127 },
-  { 12.712887363242551 , 428.80846665656327 },
-  { 299.58758512527686 , 93.24211576606245 },
-  { 544.50422973954399 , 245.05801429041088 },
-  { 430.42949303431169 , 715.4817694457666 },
-  { 240.12771512118985 , 636.6054270160209 },
-  { 183.706303130557 , 553.7675893187768 },
-  { 226.7233060400577 , 727.435275796992 },
-  { 280.88129366468388 , 281.87713211915224 },
-  { 299.499229739544 , 149.80388012816047 },
-  { 64.9844649338009 , 443.83742815298797 },
-  { 334.93974847538834 , 626.2936329494373 },
-  { 630.54145497637492 , 527.0339721729099 },
-  { 496.4722417045621 , 520.0514513159027 },
-  { 17.681907285359465 , 578.9111981320767 },
-  { 214.59258512527688 , 458.49624992831286 },
-  { 281.8834984200118 , 562.7402044637157 },
-  { 56.47887491585641 , 538.9576065651535 },
-  { 520.31783187327258 , 428.3150911577437 },
-  { 821.62187009548961 , 411.7263227983123 },
-  { 363.46171467105853 , 216.12584181910046 },
-  { 349.93474847538835 , 541.039498787187 },
-  { 307.0137333929118 , 480.542909599484 },
-  { 795.3907517492826 , 536.1245621299113 },
-  { 385.52032683024152 , 425.45432363319105 },
-  { 413.63540558647748 , 234.93811294080695 },
-  { 336.61046760093956 , 342.19448488546396 },
-  { 442.37081508297734 , 327.3810230759093 },
-  { 119.13685143534643 , 504.56706892394664 },
-  { 242.85019188018714 , 244.0837115323858 },
-  { 381.09888206170098 , 673.793375458396 },
-  { 361.65226801681467 , 295.99543103576525 },
-  { 567.61632235171221 , 649.9230057275553 },
-  { 416.44786727359791 , 162.34521217812716 },
-  { 201.13601175319732 , 150.8069014361405 },
-  { 562.418870657266766 , 478.43033324596706 },
-  { 621.689277746651626 , 425.8064399035627 },
-  { 86.09482065841186 , 40.63372890913146 },
-  { 80.3134710482866 , 141.060426160242 },
-  { 162.05197040254518 , 214.6581015536528 },
-  { 165.8905660448533 , 104.73510448982248 },
-  { 267.69088272005425 , 26.8868355108664 },
-  { 190.53558966631326 , 58.11285574206414 },
-  { 129.60351852402357 , 257.04908306967513 }
-},
-{ //#17
-  { 543.9192122376415 , 9.996863695727543 },
-  { 291.7612484351877 , 155.18082380410182 },
-  { 551.6660958964906 , 207.426199572419 },
-  { 661.5890929603208 , 211.2647952147271 },
-  { 826.6037233480688 , 49.41375446621512 },
-  { 171.7646292478368 , 270.5138718066705 },
-  { 517.6773166851901 , 312.0329057997229 },
-  { 750.2590017950894 , 361.6997144119996 },
-  { 306.2829641345355 , 25.96187399253019 },
-  { 676.7427844039489 , 511.3845079081607 },
-  { 591.7560874698986 , 471.087177683556 },
-  { 491.0683273881827 , 418.75573273281975 },
-  { 399.51587266687056 , 55.27597634279899 },
-  { 476.6807262842385 , 45.575158823907046 },
-  { 727.9891132351828 , 418.4079910856254 },
-  { 591.2749920786009 , 393.7714051539815 },
-  { 207.7453661956234 , 97.63019690154573 },
-  { 145.8937591205207 , 213.17454864727756 },
-  { 590.1128466341354 , 97.83878344582928 },
-  { 197.2446397610901 , 455.42523805054054 },
-  { 654.6794011597331 , 552.9415563730105 },
-  { 389.2509936483709 , 188.81603950687477 },
-  { 496.0435605776739 , 570.1477831827855 },
-  { 422.4008948800132 , 102.22419668326393 },
-  { 507.0177637799445 , 464.471614343404 },
-  { 446.8247592153441 , 328.91647020516416 },
-  { 400.2949368468477 , 491.0806036404114 },
-  { 220.6783144144074 , 361.3844001326497 },
-  { 701.0059837308083 , 10.58028410429984 },
-  { 317.7941886527093 , 68.23541747196343 },
-  { 704.8445793731164 , 618.50328116813017 },
-  { 922.8382470130733 , 164.3949068613524 },
-  { 814.3301938617029 , 244.77970569256195 },
-  { 625.7500276464882 , 10.574117576797875 },
-  { 563.3361030081292 , 532.68137480615475 },
-  { 645.9000315077278 , 94.53620810264944 },
-  { 670.554440275228 , 312.85178306910348 },
-  { 673.0647225462487 , 388.4321821799958 },
-  { 750.9186568290365 , 14.421658871100945 },
-  { 458.9256350072773 , 224.5248011121262 },
-  { 623.4329558810547 , 288.58744504560724 },
-  { 477.85781870747695 , 181.9003246177264 },
-  { 271.8511656116071 , 272.36408076876097 },
-  { 120.3615417145342 , 77.8812612370414 },
-  { 105.1597858769553 , 172.01949855927066 },
-  { 252.4877326629052 , 204.80116032727375 },
-  { 748.077722169523 , 268.8737758210884 },
-  { 718.2489884542485 , 109.33312994910118 },
-  { 826.8461656116071 , 177.10994660651056 },
-  { 222.491232033373 , 42.63519690154572 },
-  { 821.8244136018586 , 340.44449058472406 },
-  { 807.6544039925975 , 108.58028410429978 },
-  { 891.7976615921101 , 272.36408076876086 },
-  { 94.6413731187595 , 434.53029909639827 },
-  { 606.5989913437699 , 612.914804363262 },
-  { 52.7775693900869 , 58.21330613105816 },
-  { 374.6227711842679 , 390.6167336760313 },
-  { 371.1705838324077 , 298.7892874971262 },
-  { 534.9356496399852 , 124.40694052755194 },
-  { 744.2056180374683 , 167.08769922448204 },
-  { 687.0405849848624 , 687.9278039865362 },
-  { 332.5531405203029 , 342.18197087882209 },
-  { 634.6204431361463 , 170.89072313641145 },
-  { 266.8957290601768 , 411.24319252696144 }
-},
-{ //#18
-  { 363.0707949881042 , 371.6217193559716 },
-  { 216.2702165763664 , 308.297509225077 },
-  { 542.8792058733738 , 455.02033615817385 },
-  { 650.0501692991019 , 430.2779696908921 },
-  { 465.1045310106655 , 532.7950110208822 },
-  { 665.3578186736995 , 539.1975545717775 },
-  { 772.9442732784108 , 562.0657614448228 },
-  { 152.9347635605485 , 378.640792500072 },
-  { 475.16008869784014 , 200.86611763736363 },
-  { 614.3209953628461 , 219.9606169245804 },
-  { 462.83623020920226 , 315.55312026582044 },
-  { 406.6370242398392 , 676.55282938734763 },
-  { 283.85245099790177 , 250.90262036617133 },
-  { 233.75729845920455 , 158.65724459785412 },
-  { 872.6290667745719 , 608.5495440536823 },
-  { 22.0517471519051 , 442.8246985657878 },
-  { 848.1305791150651 , 540.2512176811435 },
-  { 706.5607978835156 , 337.2166024079765 },
-  { 177.78740065917333 , 499.2950221451749 },
-  { 630.7211256234756 , 388.82670176168006 },
-  { 392.5332664969229 , 433.3000221451749 },
-  { 876.058027863122 , 454.94032627312106 },
-  { 357.51683960059097 , 502.9583035541327 },
-  { 341.6944871954479 , 145.71866025779707 },
-  { 465.5182708658505 , 403.22355617777106 },
-  { 612.1502805032513 , 505.91237080003935 },
-  { 986.6178459858723 , 713.1562502809862 },
-  { 546.7941136191869 , 135.6537351400598 },
-  { 705.4762031383177 , 761.3726927163168 },
-  { 143.7795953281568 , 190.3235053226396 },
-  { 747.1655750376552 , 378.640792500072 },
-  { 824.9402499003636 , 456.41546736278036 },
-  { 539.7242616990216 , 562.5467684538659 },
-  { 262.8362302092023 , 551.7284647343236 },
-  { 849.9688081265155 , 807.4360816852115 },
-  { 385.5408560238739 , 257.5156017502995 },
-  { 127.6945505576012 , 443.97273989387253 },
-  { 96.0399040585919 , 377.2715918041487 },
-  { 430.4231253259329 , 631.3469825234733 },
-  { 493.9150203902789 , 656.5443565840347 },
-  { 524.3418576619497 , 224.36727766049137 },
-  { 378.7622984592045 , 63.403110435603736 },
-  { 321.2124378356588 , 429.83816179130224 },
-  { 58.95219386908514 , 259.8473695365536 },
-  { 400.14708907456594 , 581.30771127845617 },
-  { 46.7941136191869 , 335.6537351400598 },
-  { 969.7055182201238 , 803.2547836323324 },
-  { 450.6140720763332 , 130.41101088319942 },
-  { 589.71854391767704 , 671.7214511336412 },
-  { 803.2610546256303 , 750.7750458453766 },
-  { 473.7447644679768 , 463.04621063271475 },
-  { 254.54873785086966 , 395.55858260136256 },
-  { 635.1394193861566 , 152.7261652144416 },
-  { 594.9118843147329 , 284.8291136315112 },
-  { 373.774087466576 , 307.06715111924797 },
-  { 744.4780033129477 , 462.7920804049923 },
-  { 557.1114413280887 , 351.2882287834453 },
-  { 902.7916920278905 , 721.9558019458292 },
-  { 928.5025390103077 , 875.2357357961333 },
-  { 254.83232849016377 , 463.5414127836451 },
-  { 533.6689224901179 , 751.96405676814766 },
-  { 829.8046203478896 , 377.81366773872566 },
-  { 698.0649941814179 , 638.2530252766221 },
-  { 743.3562071643275 , 683.0204216136938 }
-},
-{ //#19
-  { 220.45289373219484 , 362.2016792343719 },
-  { 214.6964619050334 , 25.36241670671632 },
-  { 575.44789373219487 , 457.4558133966223 },
-  { 673.5283035481581 , 567.4290613868737 },
-  { 237.65912054196983 , 470.8375198164311 },
-  { 215.54304627089203 , 549.7011891649395 },
-  { 303.6802411163339 , 47.0129166063654 },
-  { 164.60871866727277 , 582.7367107614714 },
-  { 413.40231100441196 , 24.6854311534818 },
-  { 321.7447459834887 , 468.5707042344284 },
-  { 513.11163299246357 , 492.1241740330278 },
-  { 418.86806481962498 , 582.2849115053722 },
-  { 55.2212553957164 , 594.2337964362806 },
-  { 236.12213972116626 , 764.2841066316937 },
-  { 320.6696272706725 , 398.6775872177652 },
-  { 312.95089552011916 , 686.3677422058663 },
-  { 129.5010867999417 , 530.5847585769237 },
-  { 143.37928913774448 , 414.18848195707426 },
-  { 523.55422153211913 , 347.0404100269451 },
-  { 78.88722059629077 , 506.3600048368852 },
-  { 431.66774304731905 , 472.40929987673644 },
-  { 35.41011523033592 , 435.17556335854044 },
-  { 489.7338049621494 , 613.6987772951084 },
-  { 325.11778849200306 , 140.5908065636635 },
-  { 620.19743017187706 , 309.42161446255477 },
-  { 93.87145966076918 , 173.5673233861987 },
-  { 560.63563736450504 , 572.083848647665 },
-  { 595.69477802731727 , 374.77159118658665 },
-  { 145.43989410892058 , 101.76008559327937 },
-  { 279.32881423738337 , 181.347005213611 },
-  { 225.11778849200303 , 230.60080656366347 },
-  { 181.6533951461862 , 703.6720252853598 },
-  { 154.33527172054755 , 11.56212572629283 },
-  { 414.9494586748978 , 122.0285493584083 },
-  { 645.96140224882186 , 614.2078096072004 },
-  { 230.12042723570738 , 313.26021010486284 },
-  { 438.2317621244191 , 666.3937290349465 },
-  { 420.1706573725099 , 363.02183660518006 },
-  { 139.91482665512677 , 647.1562134200348 },
-  { 292.65412054196986 , 566.0916539786815 },
-  { 85.09346926473427 , 320.91167186082896 },
-  { 305.8158563997007 , 301.81722428043645 },
-  { 541.84230831694094 , 707.6350687723368 },
-  { 237.6591205419698 , 470.83751981643115 },
-  { 90.75002575084895 , 718.3492771947575 },
-  { 602.4553740366405 , 659.7997225162857 },
-  { 41.44230597875175 , 245.9508442845367 },
-  { 232.4657402130358 , 664.0234108596308 },
-  { 338.376222079283 , 737.0630359883523 },
-  { 497.4229439547991 , 221.660659077639 },
-  { 320.6696272706725 , 398.6775872177652 },
-  { 90.20513112612085 , 804.7504745108902 },
-  { 246.10486989346913 , 122.6316326562549 },
-  { 3.8235104143614507 , 349.30763564477877 },
-  { 31.989580490884507 , 694.8612358057728 },
-  { 356.2277056163644 , 628.081922332856 },
-  { 18.95110134064315 , 166.4450976400196 },
-  { 650.35603098543928 , 433.2123381946276 },
-  { 149.7288477992283 , 775.7811923065029 },
-  { 144.6761948509105 , 265.5778069403893 },
-  { 69.12909319348744 , 76.3963599604707 },
-  { 689.3085471832604 , 334.59839469383235 },
-  { 406.76624829137774 , 253.85168538615105 },
-  { 143.0171976592176 , 172.73016600760113 }
-},
-{ //#20
-  { 407.1661288116461 , 385.76237517381844 },
-  { 602.4202629738965 , 440.75737517381845 },
-  { 478.41245764288 , 92.78585835128314 },
-  { 301.4369548753904 , 416.0797279401302 },
-  { 487.6077224527387 , 460.77537479709264 },
-  { 407.9315927567703 , 298.0488949793759 },
-  { 125.7716601581044 , 215.03838825067328 },
-  { 871.8649507513951 , 531.4755839865151 },
-  { 462.14288086331703 , 539.1480985336315 },
-  { 439.39128001740806 , 31.9170176446473 },
-  { 61.6620159772074 , 553.8850619055388 },
-  { 217.83216719623636 , 597.289470986671 },
-  { 631.7697982126979 , 623.7209597548323 },
-  { 578.4186218009477 , 574.4212641136255 },
-  { 367.4753758359943 , 634.9082665510613 },
-  { 239.931327422643 , 507.26557054545924 },
-  { 250.6372534105696 , 630.3339411389605 },
-  { 269.5780257616106 , 127.19646850057154 },
-  { 322.90223589250513 , 30.997046912309372 },
-  { 513.4083104451807 , 357.29486840299217 },
-  { 764.6348415407384 , 666.1431824477032 },
-  { 449.5039357273091 , 650.0786963020325 },
-  { 332.15312918837185 , 305.3207815327259 },
-  { 485.6227691178605 , 589.9430907573413 },
-  { 792.6444131122983 , 454.9813249853901 },
-  { 522.9945705899956 , 247.72341355988107 },
-  { 494.9170848147949 , 686.9829789983174 },
-  { 635.6083938550059 , 733.6439568186627 },
-  { 437.4253762414138 , 170.7550322586917 },
-  { 414.1544356269583 , 739.062475513333 },
-  { 772.5784616642097 , 343.8904593218599 },
-  { 114.2167117497461 , 154.05254786399576 },
-  { 831.66981109092217 , 430.892543796403 },
-  { 361.6251809876917 , 524.1338494485987 },
-  { 569.9453605673583 , 641.4488319767665 },
-  { 562.7937325435885 , 505.2007242900596 },
-  { 271.2172837640803 , 562.7383273376194 },
-  { 704.6348415407384 , 556.1531824477032 },
-  { 581.6281923235988 , 59.6318248850392 },
-  { 725.262972774637 , 383.30735009234746 },
-  { 215.18896095536127 , 400.0946071197312 },
-  { 884.543980974877 , 610.4549330086885 },
-  { 139.73674568596795 , 500.3369562387866 },
-  { 657.5463671035678 , 296.6340473031441 },
-  { 662.6758500996041 , 503.72105492420303 },
-  { 338.79697557318224 , 212.67475280122375 },
-  { 58.985299980495 , 470.30943456689056 },
-  { 372.68603187962174 , 455.5430436960521 },
-  { 586.769220355467 , 147.8880474520288 },
-  { 161.17483758207743 , 273.0586604922019 },
-  { 210.51779320966875 , 324.0672529333559 },
-  { 693.8907419435322 , 447.9578418079253 },
-  { 111.46382065181675 , 401.0233889119246 },
-  { 289.2384955145251 , 323.24871404921623 },
-  { 815.3309495666962 , 664.5197974649717 },
-  { 105.1193976858523 , 640.3944273648654 },
-  { 235.9142853836305 , 227.0492924609541 },
-  { 826.3790400759476 , 290.5662491909653 },
-  { 616.8220298370483 , 234.05119679420432 },
-  { 365.4059648701897 , 105.95192586812689 },
-  { 103.20230432009595 , 324.6503621628684 },
-  { 923.5919430252691 , 538.9560093558752 },
-  { 586.6774912725529 , 370.05716598439597 },
-  { 477.1198547926697 , 250.55562748578495 }
-},
-{ //#21
-  { 476.51387718147475 , 429.0779630620374 },
-  { 567.6997197868037 , 367.5723356092899 },
-  { 581.6978372898491 , 461.2359268644912 },
-  { 401.5008775582005 , 348.63636942094485 },
-  { 611.7680113437251 , 174.0829630620373 },
-  { 586.436874245305 , 682.91655870434545 },
-  { 880.70770030904936 , 402.5992059380337 },
-  { 476.5138771814747 , 679.0779630620374 },
-  { 274.89188826119306 , 241.91354248784802 },
-  { 685.0546286500911 , 423.61713130010094 },
-  { 897.98466016706004 , 448.321162917106 },
-  { 765.4976563927752 , 693.7284629616865 },
-  { 515.1189734843682 , 279.803131657812 },
-  { 488.7575046150224 , 516.2428956607032 },
-  { 467.08422322864567 , 340.00215816329325 },
-  { 92.9976597903342 , 367.8795692760134 },
-  { 429.640689183716 , 210.58418184624037 },
-  { 797.90635172498554 , 269.51618478169655 },
-  { 698.4590377312232 , 532.7872825191299 },
-  { 389.0727111188613 , 492.72667826956274 },
-  { 372.17717778872986 , 299.83353754800834 },
-  { 302.4945305550416 , 405.562711484264 },
-  { 808.6873305611464 , 189.07599426582533 },
-  { 548.8227225829042 , 753.5998335567041 },
-  { 748.1423008843426 , 333.51859794875475 },
-  { 307.33421176460274 , 566.3243536629735 },
-  { 34.8008288997148 , 426.67546095249656 },
-  { 498.89343312645167 , 161.547010874288 },
-  { 732.1163177892876 , 626.0923517229841 },
-  { 552.9193513482596 , 189.07459114060396 },
-  { 129.46838074957475 , 474.5542785664776 },
-  { 265.9349961551953 , 328.3010443188346 },
-  { 415.6532165184155 , 585.4239167245591 },
-  { 632.2654033347294 , 620.6292022692317 },
-  { 803.1373008843426 , 428.77273211100515 },
-  { 365.18455841801546 , 181.80132406233344 },
-  { 706.0218951457892 , 257.13555492018503 },
-  { 681.1554746152815 , 362.58587738722815 },
-  { 537.382367020492 , 573.30150954554557 },
-  { 402.5889285100018 , 652.4114717657238 },
-  { 282.8305294853267 , 464.2591714987365 },
-  { 461.3459627757073 , 71.87832699850311 },
-  { 165.2776220583174 , 90.5566904363087 },
-  { 707.8297453845668 , 171.56312049466425 },
-  { 861.4770436465795 , 23.8809005672033 },
-  { 655.7568750508049 , 480.52993842656014 },
-  { 188.92414274438 , 303.74084878558835 },
-  { 280.7252224675953 , 673.0471805960703 },
-  { 609.397196461684 , 513.0427476645204 },
-  { 827.8796673516243 , 321.60176868527714 },
-  { 180.0758483695673 , 184.07150629030184 },
-  { 252.49039515865553 , 629.3237995314723 },
-  { 372.2176432573463 , 65.34758928602582 },
-  { 858.1323008843426 , 524.0268662732556 },
-  { 180.14601837489948 , 424.8422807282489 },
-  { 565.9526690030112 , 37.88954778720262 },
-  { 671.681842939267 , 68.20690055351436 },
-  { 604.7361591445928 , 294.2818938826026 },
-  { 775.4084172503835 , 48.43604143721655 },
-  { 781.4695444599259 , 460.627349920464 },
-  { 571.3359627757072 , 71.87832699850311 },
-  { 469.90425035109683 , 588.2944109073575 },
-  { 209.33240416912412 , 516.3899385966208 },
-  { 371.90717095417074 , 463.06674227333787 }
-},
-{ //#22
-  { 384.12576579231506 , 382.0815716445341 },
-  { 493.84783568039313 , 444.4090570974178 },
-  { 547.1720458112877 , 168.20963550915565 },
-  { 485.6664183585402 , 207.02379290382663 },
-  { 116.4091601212459 , 488.7548744337374 },
-  { 637.4499759232096 , 108.16543575138128 },
-  { 651.1696339414566 , 33.01887681789833 },
-  { 573.93375853206913 , 8.480642255220175 },
-  { 375.82715583088464 , 201.26736107666528 },
-  { 91.6024599120759 , 424.3139045587206 },
-  { 735.158413152757 , 138.62558304520223 },
-  { 148.27824978118133 , 358.1144829704584 },
-  { 295.38556218979204 , 126.25436145339108 },
-  { 596.5323467908204 , 203.82594786790537 },
-  { 35.1127661690408 , 321.63997800344157 },
-  { 849.3491718440143 , 542.6231711753711 },
-  { 860.7231054820777 , 329.8283597377365 },
-  { 424.6837239479664 , 437.23466760970666 },
-  { 216.8900250073556 , 533.4918378056446 },
-  { 746.8568393074488 , 44.6934181180152 },
-  { 190.28103571034814 , 426.7690108725478 },
-  { 590.0472572686552 , 447.73326722831246 },
-  { 134.2699840927813 , 596.8061224528177 },
-  { 80.0779128151945 , 17.33477657250576 },
-  { 577.4327837292348 , 542.1449526217182 },
-  { 546.3759744213392 , 689.43038148992247 },
-  { 438.10857973508945 , 656.7291195166481 },
-  { 888.9056144211006 , 399.5168247929819 },
-  { 783.1279377096882 , 224.6557966488764 },
-  { 635.0139655613895 , 364.40326990564944 },
-  { 116.12028597872745 , 252.93052286208416 },
-  { 308.78997127092424 , 17.08421023436209 },
-  { 872.9849637183466 , 496.1532084230193 },
-  { 508.30875791439667 , 374.1355918349017 },
-  { 671.6993876113256 , 290.8809842109227 },
-  { 285.72862247953844 , 264.3550333109169 },
-  { 743.1179377096882 , 314.6557966488764 },
-  { 520.9432868819847 , 614.5227281238868 },
-  { 471.43875513451 , 3.558729524077336 },
-  { 723.3365648021457 , 193.7655784723693 },
-  { 219.4948035856821 , 120.01928768293297 },
-  { 224.08740131385434 , 338.9270911224461 },
-  { 385.9816248623791 , 160.54001029496712 },
-  { 171.75890806138176 , 36.434339634091415 },
-  { 798.6276843091787 , 407.18933934009823 },
-  { 757.2720462568903 , 547.9013844488795 },
-  { 327.47672793295817 , 307.8017402403088 },
-  { 698.8743695368496 , 434.495059176532 },
-  { 731.4666312447835 , 497.7658484576599 },
-  { 546.4517547577842 , 84.00032316516989 },
-  { 201.47139418088204 , 193.65482412149444 },
-  { 641.676657296898 , 652.3452410634492 },
-  { 336.95682557945355 , 632.9684324608099 },
-  { 378.39606891849473 , 54.09442885472518 },
-  { 463.0619666545163 , 492.31461278071123 },
-  { 436.4617547577842 , 84.0003231651699 },
-  { 310.0770177206625 , 403.2458883984062 },
-  { 136.8208942812329 , 104.67104491019398 },
-  { 294.4314964863479 , 479.05627102600226 },
-  { 668.239097880597 , 551.1482084230192 },
-  { 342.9452245937079 , 510.83234300311744 },
-  { 425.29825118569397 , 301.97565923623574 },
-  { 423.38681823480044 , 585.8453426263916 },
-  { 565.4755374829248 , 281.1113767361097 }
-},
-{ //#23
-  { 476.33206894054496 , 227.55909352838773 },
-  { 563.0053717297483 , 295.2756991994569 },
-  { 272.5768265728593 , 34.8619593442718 },
-  { 636.7675852641166 , 408.85954747444066 },
-  { 387.34828972924447 , 162.90859362873863 },
-  { 739.4520963745439 , 448.2764382449282 },
-  { 457.0455153760386 , 616.532062021557 },
-  { 724.2140037636794 , 27.7465536057184 },
-  { 513.6411062949064 , 525.702213240586 },
-  { 636.7675852641166 , 408.85954747444066 },
-  { 84.36100426561137 , 377.1151712510694 },
-  { 373.679913029865 , 38.76101412309447 },
-  { 319.1770441572371 , 344.95720744861563 },
-  { 153.08237466591794 , 299.11429484176494 },
-  { 629.9341723594541 , 51.09751574636152 },
-  { 279.7618351245332 , 185.77680050178398 },
-  { 638.7357194630272 , 138.52760379414676 },
-  { 311.50452961012076 , 454.6792773366937 },
-  { 681.5713495502742 , 248.2129214849149 },
-  { 930.4027399629618 , 292.152024826087 },
-  { 177.5185086721731 , 498.6840111869248 },
-  { 619.6072975363755 , 241.73533281701887 },
-  { 170.9745456371568 , 16.26278060092307 },
-  { 435.5398879232911 , 505.346219416228 },
-  { 612.0252187968349 , 301.68858404871264 },
-  { 315.18835713057854 , 245.9191003574413 },
-  { 193.08853233532983 , 118.06019483071488 },
-  { 750.3515014355677 , 207.08728448156342 },
-  { 788.7217447167745 , 273.05246176450123 },
-  { 815.8067191246377 , 95.0595429479135 },
-  { 558.3780696668136 , 626.1830781266957 },
-  { 694.6202971596497 , 322.17692645811144 },
-  { 265.8528340263425 , 441.1566290368778 },
-  { 611.069698175854 , 688.5081563692403 },
-  { 635.454508244375 , 484.0856795536709 },
-  { 719.7830533826343 , 116.2261187622126 },
-  { 414.18904072054795 , 415.2623865662061 },
-  { 63.7784463812112 , 55.67334188884286 },
-  { 52.1859562691793 , 295.9321522215513 },
-  { 177.1909562691793 , 391.1862863838017 },
-  { 489.73647802167716 , 336.7292447474167 },
-  { 377.69796817318934 , 371.5398538127218 },
-  { 53.9529204570077 , 157.87088759497135 },
-  { 421.91118406367536 , 272.52808965444876 },
-  { 124.3091563023767 , 29.9919293740356 },
-  { 650.4683171632435 , 583.6259383452791 },
-  { 543.3625602635533 , 213.0318401868388 },
-  { 593.210553989726 , 130.69992416924333 },
-  { 181.8138794752258 , 217.21320016367878 },
-  { 356.6800500593288 , 90.8527941960235 },
-  { 69.0550221401263 , 244.99692937403557 },
-  { 348.8633407550452 , 553.3165616355436 },
-  { 670.4705606600686 , 659.9149264378659 },
-  { 821.5358930608933 , 264.7421901816017 },
-  { 422.89978536616144 , 556.9641283151241 },
-  { 504.40452224047715 , 16.01315016273512 },
-  { 887.0899635152841 , 438.2702713317397 },
-  { 489.73647802167716 , 118.38894230935874 },
-  { 211.79734642758604 , 352.64192729053815 },
-  { 531.5836251557423 , 376.70158367198684 },
-  { 567.1796167703867 , 500.3150904557672 },
-  { 725.7718610106867 , 378.3565056174152 },
-  { 870.4602440710331 , 346.650137157912 },
-  { 591.0145874785688 , 16.40516512095917 }
-},
-{ //#24
-  { 490.7307106807841 , 335.45009552437716 },
-  { 623.7325182762627 , 410.3845105907299 },
-  { 859.48852904724953 , 218.91760229520344 },
-  { 46.87235352833875 , 48.66653795970774 },
-  { 321.1431795920831 , 438.9838907260195 },
-  { 815.2177029835052 , 419.23495506151517 },
-  { 723.8111204967473 , 170.42334351462864 },
-  { 264.4941417327262 , 344.7040593217942 },
-  { 317.47065855526137 , 34.45773049056027 },
-  { 387.3368139885768 , 351.1419709759178 },
-  { 597.1235289792552 , 517.1073375238268 },
-  { 155.03050149136163 , 44.70732382303356 },
-  { 380.071638276762 , 491.60211340563063 },
-  { 96.62032217420415 , 281.3311476904922 },
-  { 313.75935511099385 , 109.2349550615152 },
-  { 417.6541667548886 , 245.4127970396621 },
-  { 37.25582662865327 , 522.4819986857419 },
-  { 789.5012023969705 , 262.5771512244391 },
-  { 636.8623535283388 , 108.66653795970774 },
-  { 130.3785709194792 , 508.3513314558689 },
-  { 650.4477391101498 , 613.3067591120889 },
-  { 493.7357279127575 , 229.69397049967205 },
-  { 707.99144337244036 , 279.53013902364705 },
-  { 576.7462346414602 , 157.53403790100614 },
-  { 59.9149422521555 , 353.005696381328 },
-  { 98.3530347772763 , 415.7924708755669 },
-  { 550.4730771480658 , 253.27913209864914 },
-  { 398.24290803011945 , 630.4511725931504 },
-  { 330.1372232104092 , 589.6039210011093 },
-  { 671.4348205116158 , 505.33758520468035 },
-  { 510.9419547225325 , 121.05812991761285 },
-  { 897.503009992449 , 412.64273615808634 },
-  { 220.57835991456795 , 493.56714573827526 },
-  { 732.9404479643632 , 414.1517425993513 },
-  { 567.6793039578408 , 44.64329151658995 },
-  { 501.26825346868566 , 37.81595889665726 },
-  { 430.98244211973866 , 433.22745889885806 },
-  { 328.8973646683807 , 512.6667087998609 },
-  { 849.310332895587 , 501.3563616823904 },
-  { 395.73392031727894 , 149.6283855660248 },
-  { 185.4004078907394 , 368.28368153659704 },
-  { 505.992538167587 , 485.07201212649284 },
-  { 832.4539005845388 , 358.7359153973874 },
-  { 36.2027091742393 , 482.19441239144874 },
-  { 645.4527805688622 , 338.1226100714935 },
-  { 513.7425182762627 , 410.3845105907299 },
-  { 414.1934854883582 , 70.0667197875677 },
-  { 221.82468874580184 , 136.5436625608105 },
-  { 654.8508953200324 , 46.85556969116226 },
-  { 930.8621161087319 , 541.4622759184662 },
-  { 289.3350063930982 , 301.2075559095651 },
-  { 253.66130079543836 , 601.6021833249902 },
-  { 313.65657862471977 , 209.60355573091942 },
-  { 209.4991417327262 , 439.9581934840446 },
-  { 887.1044004841879 , 329.7521361860869 },
-  { 440.1272232104092 , 589.6039210011093 },
-  { 750.9286039962594 , 658.0437224839961 },
-  { 622.6743039578408 , 239.89742567884036 },
-  { 463.1836613380403 , 523.3973916012649 },
-  { 199.23647304175194 , 238.11988367531356 },
-  { 530.9298945827613 , 604.9492572739285 },
-  { 122.1480688294374 , 141.22143306344236 },
-  { 714.4113373341511 , 606.5839140359143 },
-  { 893.66452622415 , 568.1343549731721 }
-},
-{ //#25
-  { 388.83816108113945 , 252.44594530105664 },
-  { 381.1656465340231 , 142.7238754129786 },
-  { 296.59278531282223 , 312.35079276235945 },
-  { 543.26857518192764 , 26.1513711740973 },
-  { 203.85168441144003 , 13.4668600636701 },
-  { 748.84668441144004 , 578.7209942259205 },
-  { 936.5660333030737 , 310.43120257832254 },
-  { 489.4218218870942 , 467.6084262950777 },
-  { 591.7227553425861 , 104.0831224918768 },
-  { 538.9151640173091 , 506.2845409433647 },
-  { 689.9228246633158 , 272.8124070139323 },
-  { 886.87071542474416 , 390.0233073094758 },
-  { 188.79030560878095 , 429.9965552997273 },
-  { 547.5416202277061 , 169.4556156536902 },
-  { 222.5038055310145 , 218.60483819122453 },
-  { 638.97398974843185 , 208.99400140211742 },
-  { 779.28426082003288 , 342.8915141825211 },
-  { 124.98521053713137 , 104.38729517481349 },
-  { 749.0076827315693 , 90.90783552135287 },
-  { 169.6907425471953 , 538.31556005354 },
-  { 224.9852105371314 , 313.6007076294214 },
-  { 614.82447306478696 , 319.3571394565828 },
-  { 388.0853152363381 , 42.88013186223245 },
-  { 258.97398974843185 , 99.00400140211742 },
-  { 294.67319512878544 , 422.3240407526109 },
-  { 386.88433792471767 , 577.27162234483086 },
-  { 147.06915359366553 , 269.4755813049919 },
-  { 759.8538051091836 , 175.4094755689025 },
-  { 298.51179077109356 , 532.2470378164412 },
-  { 567.2929945022447 , 596.60802106101585 },
-  { 37.09590560341407 , 271.3951714890287 },
-  { 649.02500700908905 , 485.99063370175287 },
-  { 137.57677048952374 , 226.65820811712146 },
-  { 97.53080994852935 , 455.3050533248374 },
-  { 59.912014384139056 , 558.6618446850795 },
-  { 497.9245777639937 , 248.63656368939382 },
-  { 933.4527173079576 , 210.6294768083481 },
-  { 465.8031208734475 , 95.85794026027938 },
-  { 216.77329141683498 , 605.844713209852 },
-  { 320.4796172011793 , 89.1798440074465 },
-  { 512.3040290989255 , 376.16919837417436 },
-  { 123.49648132058968 , 647.5588933368418 },
-  { 913.05505479017592 , 157.4392583055498 },
-  { 646.88194180776847 , 581.91834336170507 },
-  { 395.15499941085147 , 494.6282422520509 },
-  { 179.7264997721918 , 132.3155200591354 },
-  { 721.3799976441388 , 424.6605832117299 },
-  { 145.86626270324632 , 18.76126993530278 },
-  { 854.8668047324578 , 255.85106920999505 },
-  { 827.6688351860752 , 563.3080241208295 },
-  { 745.47934146090142 , 267.3481548848043 },
-  { 151.9096012705357 , 377.62781089257305 },
-  { 828.76261309485272 , 165.15258066437397 },
-  { 41.3773489012616 , 173.33399798622685 },
-  { 430.74618208582785 , 174.31016012794208 },
-  { 368.6960596365099 , 399.03820115989186 },
-  { 309.7179764418912 , 176.0404711342715 },
-  { 811.06446751087043 , 481.0288494492629 },
-  { 472.57009496361786 , 582.214692054592 },
-  { 603.25998388478502 , 424.9877005585256 },
-  { 390.58111249503145 , 352.2995649272074 },
-  { 5.51349551253566 , 411.71073542671706 },
-  { 49.22509016010848 , 338.21092012208544 },
-  { 445.9611056666104 , 305.49186512149515 }
-},
-{ //#10  26
-  { 484.6853753712679 , 346.0386725662906 },
-  { 433.0481981804478 , 158.9232668277372 },
-  { 574.7839087226141 , 292.951000332039 },
-  { 868.0607188188594 , 551.2368202050492 },
-  { 605.1012614889258 , 187.2218263957833 },
-  { 574.7839087226141 , 292.951000332039 },
-  { 777.6321736619705 , 341.6505600602342 },
-  { 498.52397101357604 , 206.11567550246025 },
-  { 834.6563097377273 , 450.40697142407817 },
-  { 267.19745411790285 , 125.8192072050843 },
-  { 333.3634046842867 , 305.40704943659676 },
-  { 686.8397608431844 , 113.6241510023725 },
-  { 391.6492245572969 , 398.68385953284206 },
-  { 962.3315448826037 , 370.91946743873746 },
-  { 333.3634046842867 , 305.40704943659676 },
-  { 268.3112348085406 , 58.44240194162757 },
-  { 143.2026672119423 , 51.1634812637582 },
-  { 872.3180451438366 , 24.40520119080084 },
-  { 577.6391942572013 , 459.83905231962274 },
-  { 56.602370946348 , 590.6021146724257 },
-  { 133.45855722298387 , 447.6524252049139 },
-  { 892.2330115312575 , 194.00713967298907 },
-  { 581.0586343443165 , 542.1454707783367 },
-  { 237.2020003265948 , 595.3300465004271 },
-  { 696.5369186449686 , 482.9265209667651 },
-  { 140.5181561015151 , 121.74659049327056 },
-  { 811.6209528732709 , 237.04385383293027 },
-  { 664.6173284609318 , 582.8997689570166 },
-  { 664.3488712364281 , 23.418119789334686 },
-  { 472.8029565588132 , 584.15397954185516 },
-  { 948.7363586118242 , 288.6810310237504 },
-  { 551.9157018495687 , 115.3645457273277 },
-  { 35.42799234923393 , 153.3888064010498 },
-  { 68.6384856980425 , 254.8869550337408 },
-  { 237.5172068304337 , 461.81382910928664 },
-  { 771.5419186449686 , 568.1806551290156 },
-  { 523.3808521653242 , 632.0579184594688 },
-  { 865.0160559930309 , 660.336358209225 },
-  { 855.3613126311393 , 331.4959443307482 },
-  { 926.8970695564647 , 92.3731249633077 },
-  { 363.0628603122285 , 570.60273059185687 },
-  { 698.4254716198204 , 223.4212479840454 },
-  { 358.2961992222792 , 15.80235179633851 },
-  { 625.2875235573994 , 389.1667864379661 },
-  { 941.8993144611675 , 494.5881775228591 },
-  { 58.5219611303848 , 400.5753626626772 },
-  { 273.45855722298387 , 267.6624252049139 },
-  { 188.04310612746633 , 201.37871213055303 },
-  { 448.48733000892366 , 92.7595090918044 },
-  { 665.1923710187021 , 306.9214106696489 },
-  { 576.6580683168504 , 18.19358230159969 },
-  { 770.5910528699627 , 51.885626560160944 },
-  { 410.065993186906 , 474.6348444279648 },
-  { 66.7050622962188 , 315.8584968712066 },
-  { 414.9202241055481 , 265.1652288747244 },
-  { 734.311593507677 , 395.15184610405674 },
-  { 781.5004878361112 , 144.8693466712263 },
-  { 276.7143668249298 , 399.6868808408221 },
-  { 213.55370976168106 , 305.4070494365967 },
-  { 336.79911354747003 , 185.1898150678949 },
-  { 473.7469971030467 , 24.28924333946404 },
-  { 140.5884648208954 , 552.5420341381811 },
-  { 501.0366878288533 , 430.1809452076513 },
-  { 161.49146417287244 , 344.1093999487802 }
-},
-{ //#27
-  { 533.9664672069158 , 418.4674609282029 },
-  { 197.0541394411673 , 508.5659942795491 },
-  { 165.10811005447044 , 120.25101849287233 },
-  { 244.2282946937187 , 446.65649265965743 },
-  { 598.4855229923751 , 375.95628347023495 },
-  { 512.7969111425109 , 579.2662034689715 },
-  { 459.85047652175217 , 263.0800550671443 },
-  { 468.2751954431632 , 648.4851532805432 },
-  { 616.7944992726798 , 615.0754447777142 },
-  { 412.31604625640125 , 534.5292400970643 },
-  { 350.4630132501958 , 251.58296939233514 },
-  { 300.0136947974217 , 5.8874778871324 },
-  { 322.5236732089354 , 584.7580920114024 },
-  { 451.9405639794229 , 482.0735809009751 },
-  { 706.8045277461879 , 395.05584653182063 },
-  { 658.1800429044661 , 740.7305290488604 },
-  { 829.657169650492 , 395.4002781117718 },
-  { 131.3075316427326 , 423.575228623767 },
-  { 504.2282946937187 , 315.2560742808125 },
-  { 734.5173770766978 , 620.0176465097169 },
-  { 629.3093392382111 , 73.6408135574142 },
-  { 926.7677472629313 , 616.995034961751 },
-  { 475.7500247715852 , 39.60910377575755 },
-  { 668.7262300086986 , 180.95630244698697 },
-  { 240.4897652599443 , 253.50255957637194 },
-  { 271.24406343862415 , 337.0612536929874 },
-  { 398.6794556855264 , 152.72461223988978 },
-  { 55.4349365266755 , 573.2594235063042 },
-  { 62.02225848911803 , 359.7447412099066 },
-  { 58.61823164463055 , 457.1955583804688 },
-  { 923.0822068269775 , 433.85713846564454 },
-  { 70.8368310586603 , 193.7619859269473 },
-  { 759.9120726140277 , 332.4619298997344 },
-  { 712.3087045096819 , 36.68324466940595 },
-  { 356.2194450773572 , 361.42223191999074 },
-  { 493.24121329225244 , 197.28690037340397 },
-  { 804.649035985935 , 231.98106501362474 },
-  { 648.7977593358554 , 670.3748292448576 },
-  { 591.4791987078409 , 279.29175100944576 },
-  { 165.49476525994433 , 348.75669373862235 },
-  { 815.7515264742317 , 122.3445350621018 },
-  { 537.0639634698939 , 113.7359660961114 },
-  { 706.4416027127237 , 520.0630799543583 },
-  { 188.5260850787665 , 15.9488507026597 },
-  { 145.8498306819345 , 574.2035795680399 },
-  { 903.6371625102946 , 194.47571111782 },
-  { 831.1595137909947 , 567.5518652016274 },
-  { 370.8666973104517 , 48.4295551674952 },
-  { 263.3891196287966 , 161.37559529480836 },
-  { 949.0694263333238 , 348.5583393677965 },
-  { 673.5401258031371 , 777.5457926705856 },
-  { 233.6917504320362 , 640.3972139645336 },
-  { 637.781580674146 , 723.0446186851227 },
-  { 581.2947500348199 , 717.6409452092828 },
-  { 783.1733870416325 , 495.08507160793295 },
-  { 565.1573220818597 , 517.9600390391608 },
-  { 90.4552884385143 , 49.9004775104065 },
-  { 341.148910899927 , 449.30662946130457 },
-  { 446.33287100830125 , 397.1486656588508 },
-  { 672.8157485348875 , 280.44914030451673 },
-  { 133.0663753397251 , 249.54520740485407 },
-  { 871.3458706315754 , 316.7070720177582 },
-  { 888.3573471500067 , 527.2430354103867 },
-  { 645.2989002934405 , 486.2416891371497 }
-},
-{ //#11 28
-  { 478.0093774228642 , 390.71632392748336 },
-  { 221.9981566341646 , 351.1096177001794 },
-  { 866.9289623037495 , 650.4086745528857 },
-  { 803.412744912609 , 100.7238810567246 },
-  { 106.255384932821 , 200.40940851075692 },
-  { 493.7658092500256 , 275.87706139982777 },
-  { 718.2363370966219 , 39.20642930094073 },
-  { 226.2258198581948 , 624.5746810799287 },
-  { 876.4527795319525 , 268.0647864533861 },
-  { 49.92721360771753 , 625.8000584636581 },
-  { 198.4824149210948 , 159.20375861062445 },
-  { 174.9746734566997 , 9.86328886894546 },
-  { 645.3323350966458 , 120.75063306647314 },
-  { 573.8643426013718 , 338.9647336340793 },
-  { 989.3146768792739 , 427.29714413846733 },
-  { 872.1269250395989 , 384.0006911529699 },
-  { 403.996349038686 , 231.1752026338267 },
-  { 625.7939493482187 , 7.3670896964826 },
-  { 382.779206822593 , 366.5879020008316 },
-  { 266.6116095374377 , 516.1378484891414 },
-  { 977.6991083631864 , 225.08826963085076 },
-  { 368.5219785239366 , 295.8876928114091 },
-  { 414.41008889387103 , 121.60374779071562 },
-  { 293.2205988344451 , 429.4150215560445 },
-  { 280.7771006321688 , 31.19045869918529 },
-  { 139.93830674823437 , 408.4212428180723 },
-  { 923.5780001631064 , 494.68850595711103 },
-  { 385.9425821230448 , 15.361566157181002 },
-  { 291.78485708622463 , 234.6740821900116 },
-  { 9.736744177778 , 26.9207842855021 },
-  { 41.1735424389515 , 428.7765752861933 },
-  { 719.7716345596002 , 652.5304257072128 },
-  { 570.4502051797458 , 586.0608455529717 },
-  { 773.2584598771257 , 349.13973409707376 },
-  { 103.42203427704476 , 331.789487928565 },
-  { 820.3924922505231 , 535.2548595868456 },
-  { 170.6080621060015 , 518.91210723085374 },
-  { 669.5813796840037 , 213.8520680802459 },
-  { 535.8751103951141 , 61.54428411513271 },
-  { 675.337811511165 , 353.6913306079015 },
-  { 591.1735424389515 , 658.7665752861933 },
-  { 673.134716290173 , 566.6439547824841 },
-  { 418.2566459507862 , 653.5875996784626 },
-  { 975.2526035686217 , 122.19077432182917 },
-  { 326.27569378698524 , 582.3846204686464 },
-  { 509.5940490022454 , 153.76171159316942 },
-  { 473.2514237386122 , 471.9994800519202 },
-  { 210.1803091470603 , 263.3331664362805 },
-  { 978.6108597818508 , 334.2584208498799 },
-  { 799.1528345271147 , 203.43832822506084 },
-  { 759.2508494029685 , 599.4713020221761 },
-  { 29.6251733563489 , 268.84706808024595 },
-  { 739.19662819946 , 259.260807935431 },
-  { 676.5848575276892 , 474.2182583051045 },
-  { 304.83863405075994 , 131.1900079355306 },
-  { 586.6628689582578 , 229.96958287804478 },
-  { 987.6238003681783 , 15.70934362613153 },
-  { 469.6537483452014 , 563.7379794061789 },
-  { 936.452895979397 , 595.44238095825415 },
-  { 70.5376453905752 , 516.68133930514847 },
-  { 783.3000700511844 , 452.3610205042274 },
-  { 892.3801036093737 , 35.98870656926508 },
-  { 90.09276821301034 , 100.18500793553056 },
-  { 587.9290212031962 , 435.73447353001086 }
-},
-{ //#16  29
-  { 166.23079376503478 , 400.8609113304527 },
-  { 667.37243661258938 , 312.64446889512215 },
-  { 593.9033083121511 , 21.13884144237466 },
-  { 788.45611890232642 , 488.6355861931611 },
-  { 425.68686587682046 , 389.99719859482 },
-  { 576.2920214934747 , 367.95211826971973 },
-  { 531.807081042969557 , 572.9154175973864 },
-  { 321.1406300127536 , 422.2186954226735 },
-  { 7.21851481598998 , 337.6226240512342 },
-  { 131.49187453913066 , 619.399200206246 },
-  { 258.16053661080747 , 351.83905063179714 },
-  { 67.61632235171223 , 676.9130057275553 },
-  { 437.62627012135542 , 492.03999527429323 },
-  { 17.60952551898252 , 230.89979711813737 },
-  { 124.26536021106911 , 771.1928371317806 },
-  { 115.47602550038027 , 322.4221598613095 },
-  { 167.24187703360428 , 669.9465083005467 },
-  { 699.78383865251155 , 476.8374909870638 },
-  { 508.0571104582981 , 27.69962698740386 },
-  { 751.54379113657797 , 568.7341195445073 },
-  { 438.04926267650416 , 601.3829243682127 },
-  { 12.712887363242551 , 428.80846665656327 },
-  { 429.58758512527686 , 93.24211576606245 },
-  { 544.50422973954399 , 265.05801429041088 },
-  { 430.42949303431169 , 715.4817694457666 },
-  { 240.12771512118985 , 636.6054270160209 },
-  { 183.706303130557 , 553.7675893187768 },
-  { 226.7233060400577 , 727.435275796992 },
-  { 600.88129366468388 , 121.87713211915224 },
-  { 310.499229739544 , 139.80388012816047 },
-  { 794.9844649338009 , 143.83742815298797 },
-  { 334.93974847538834 , 626.2936329494373 },
-  { 630.54145497637492 , 527.0339721729099 },
-  { 876.4722417045621 , 320.0514513159027 },
-  { 17.681907285359465 , 578.9111981320767 },
-  { 214.59258512527688 , 458.49624992831286 },
-  { 281.8834984200118 , 562.7402044637157 },
-  { 36.47887491585641 , 508.9576065651535 },
-  { 520.31783187327258 , 428.3150911577437 },
-  { 821.62187009548961 , 411.7263227983123 },
-  { 343.46171467105853 , 216.12584181910046 },
-  { 349.93474847538835 , 541.039498787187 },
-  { 307.0137333929118 , 480.542909599484 },
-  { 865.3907517492826 , 536.1245621299113 },
-  { 698.52032683024152 , 125.45432363319105 },
-  { 433.63540558647748 , 214.93811294080695 },
-  { 756.61046760093956 , 342.19448488546396 },
-  { 472.37081508297734 , 317.3810230759093 },
-  { 109.13685143534643 , 494.56706892394664 },
-  { 242.85019188018714 , 244.0837115323858 },
-  { 381.09888206170098 , 673.793375458396 },
-  { 361.65226801681467 , 315.99543103576525 },
-  { 567.61632235171221 , 649.9230057275553 },
-  { 516.44786727359791 , 162.34521217812716 },
-  { 201.13601175319732 , 150.8069014361405 },
-  { 562.418870657266766 , 478.43033324596706 },
-  { 661.689277746651626 , 415.8064399035627 },
-  { 86.09482065841186 , 40.63372890913146 },
-  { 40.3134710482866 , 141.060426160242 },
-  { 632.05197040254518 , 214.6581015536528 },
-  { 395.8905660448533 , 14.73510448982248 },
-  { 287.69088272005425 , 26.8868355108664 },
-  { 190.53558966631326 , 58.11285574206414 },
-  { 129.60351852402357 , 217.04908306967513 }
-},
-{ //#12  30
-  { 250.2936090097661 , 351.3908442304386 },
-  { 386.4930305980282 , 418.066634099544 },
-  { 46.5700335341979 , 244.2280384572359 },
-  { 276.55861553167546 , 250.06482650406542 },
-  { 353.4825238693255 , 360.22656669820987 },
-  { 398.06424298442283 , 98.87898389873635 },
-  { 341.41520512506594 , 4.599152494511046 },
-  { 173.2132421739558 , 446.60924289284563 },
-  { 483.82067481158424 , 508.71824642639194 },
-  { 133.20182417143337 , 152.44603093967513 },
-  { 683.4575367571189 , 302.86776311003683 },
-  { 18.0642429844228 , 98.87898389873637 },
-  { 371.55361553167546 , 285.31896066631583 },
-  { 66.8784003790938 , 37.373356445988925 },
-  { 726.89348942571814 , 23.81810230608265 },
-  { 454.641287765927 , 195.22042731496964 },
-  { 156.00701536418077 , 355.24508347490485 },
-  { 460.46971267094114 , 302.99807783061726 },
-  { 404.0252825526728 , 631.40455691079393 },
-  { 689.1803636902157 , 516.25877381302936 },
-  { 898.21504976943436 , 436.67482782649284 },
-  { 595.43848892091984 , 524.070742319853 },
-  { 919.1356286777502 , 101.07356563541137 },
-  { 524.0088951642715 , 22.180925115262525 },
-  { 463.71354813034134 , 402.30845393761314 },
-  { 765.3597879738872 , 587.6299910480494 },
-  { 242.27878412745014 , 633.41578864470858 },
-  { 180.4543464821105 , 547.1472760576 },
-  { 834.0656330988379 , 357.54205558778267 },
-  { 417.2860682311747 , 8.78991441226998 },
-  { 645.2552421385833 , 19.77699581373614 },
-  { 771.79069468457527 , 452.0033809588822 },
-  { 285.7850222100025 , 23.14569322195878 },
-  { 833.9956285559464 , 240.4237642382744 },
-  { 557.998079126169 , 157.60163175057934 },
-  { 655.5591741658428 , 115.12057103298116 },
-  { 52.6502240039387 , 317.6262879105145 },
-  { 504.8902577461609 , 663.68437620506943 },
-  { 200.12720000342898 , 200.8396093081197 },
-  { 71.5347616012252 , 562.4549254321976 },
-  { 281.16238068749874 , 109.99315581944818 },
-  { 515.20587411625706 , 587.0218116474609 },
-  { 31.4567940724072 , 165.0289039232087 },
-  { 37.7698353716833 , 386.56416682808754 },
-  { 155.43679091005686 , 261.4685866903575 },
-  { 651.0130468131186063 , 414.7416936490679 },
-  { 371.0096444961469 , 517.4816652595344 },
-  { 754.4248239278287 , 392.5000959481131 },
-  { 34.7933185491481 , 657.8104956593214 },
-  { 510.0196262178713 , 112.01520564019076 },
-  { 152.7573275676964 , 8.61053481138046 },
-  { 938.3921423611123 , 278.30317199618696 },
-  { 286.9469093043715 , 549.3077398776163 },
-  { 806.6888816846295 , 101.13179182168065 },
-  { 552.2416472990077 , 267.4408942782349 },
-  { 268.2290213448189 , 449.3726011948916 },
-  { 732.5937176057723 , 177.7094992931553 },
-  { 63.69755792354582 , 454.15858441955544 },
-  { 882.3214712830792 , 169.57919308815883 },
-  { 563.9267492013266 , 428.3168846765424 },
-  { 757.61941128660976 , 257.7583591315725 },
-  { 189.5856006217404 , 76.46990335285341 },
-  { 372.3482232928277 , 167.65960290412204 },
-  { 582.7394581370045 , 346.82458811906326 }
-},
-{ //#31
-  { 344.8266088753717 , 208.53212162236008 },
-  { 244.8533608851202 , 206.6125314383233 },
-  { 138.61117925158555 , 178.14502466749707 },
-  { 426.98654147403755 , 291.5426283510628 },
-  { 134.88011289486872 , 408.53212162236008 },
-  { 247.65564544964366 , 383.78975515507838 },
-  { 244.85336088512017 , 96.62253143832329 },
-  { 725.844898626483 , 143.3261859157322 },
-  { 833.7093684071344 , 264.93363905405533 },
-  { 461.9975723010997 , 103.78975515507832 },
-  { 400.6609385181087 , 21.16822211327843 },
-  { 834.5729960787488 , 114.4108352241081 },
-  { 854.8882025825877 , 460.89461783296764 },
-  { 724.101947212591 , 229.90545116024265 },
-  { 17.6237186648577 , 398.65803408961614 },
-  { 932.203740954387 , 96.1194816593844 },
-  { 428.4881072662409 , 205.7073903513419 },
-  { 53.881352197576 , 495.82899751534416 },
-  { 921.6082919054891 , 22.112864518127 },
-  { 556.1622513927947 , 349.0553598519879 },
-  { 28.5903242570275 , 307.09339632443294 },
-  { 113.86881278430381 , 70.97406124176906 },
-  { 35.926668141158345 , 38.72813389700949 },
-  { 302.3236557504866 , 478.9783569158182 },
-  { 640.4321953402313 , 351.5426283510628 },
-  { 346.114188552621 , 115.8789087030719 },
-  { 577.5495129012841 , 415.657164055342 },
-  { 677.0686480151744 , 570.92020068343476 },
-  { 123.38302722005953 , 317.91958489391646 },
-  { 448.9912879670667 , 373.79772631926954 },
-  { 811.6082919054891 , 22.112864518127 },
-  { 138.19307748538614 , 640.04244125345406 },
-  { 712.877889323917 , 66.9226125532659 },
-  { 430.58486540631486 , 470.6049941795959 },
-  { 663.0277972019363 , 484.87611386691356 },
-  { 613.507421379376 , 147.78526652099436 },
-  { 57.88288932391697 , 612.1767467155163 },
-  { 14.605880035658 , 246.30362320938428 },
-  { 527.8312051729496 , 168.52894834667592 },
-  { 995.7280648316188 , 189.80820569678923 },
-  { 338.21982949513466 , 368.12285106941727 },
-  { 315.7548168413673 , 647.88861551275244 },
-  { 228.5669873284338 , 285.7616210914627 },
-  { 528.8943518208503 , 576.2705911564367 },
-  { 223.59088267238187 , 8.6465757888854 },
-  { 925.844898626483 , 243.32618591573225 },
-  { 193.9313680394553 , 497.5776189705015 },
-  { 942.9660698419245 , 367.2482028193539 },
-  { 424.89676369068144 , 685.0798324651794 },
-  { 521.4639926388172 , 20.0287915927525 },
-  { 776.9636579720933 , 581.43896151061114 },
-  { 740.1169888363924 , 338.0264109599223 },
-  { 774.7383328348017 , 439.2136363733195 },
-  { 523.360682036765 , 489.1388989757258 },
-  { 590.9539219824162 , 644.827315274371 },
-  { 336.4362719304653 , 289.2644939169719 },
-  { 525.7212209374736 , 275.7290007821749 },
-  { 848.7528294184516 , 355.2326377696973 },
-  { 622.449344167028 , 257.3363524084509 },
-  { 37.46333861751873 , 150.09424588101734 },
-  { 683.5524902294726 , 647.70800892057207 },
-  { 436.34129723347627 , 580.4442567072515 },
-  { 622.2653525954734 , 27.4196982280751 },
-  { 222.5432145464408 , 595.2054244115634 }
-},
-{ //#3  32
-  { 520.0233812655151 , 219.79681013211214 },
-  { 258.42779034664727 , 298.96696135114115 },
-  { 336.20246520935564 , 231.19228648843279 },
-  { 630.4460333821943 , 368.0315490160884 },
-  { 727.81715445574008 , 91.16096955005295 },
-  { 570.02838126551512 , 295.0509442943626 },
-  { 607.20461772729647 , 29.66388387524376 },
-  { 421.72633342664426 , 88.8828336868154 },
-  { 620.80899478225697 , 472.32375271138324 },
-  { 215.9170921179016 , 4.88524555664654 },
-  { 736.51216387437466 , 394.7357377905237 },
-  { 135.57177868742286 , 151.06581701135576 },
-  { 408.85812655359894 , 606.46928829152665 },
-  { 833.0488852448563 , 360.4668764216955 },
-  { 102.95035189351013 , 423.5545486559471 },
-  { 645.47324533607663 , 87.97814477710423 },
-  { 298.6642218475743 , 477.84471748458753 },
-  { 356.33303965394816 , 1.8940544755149 },
-  { 144.2000054852495 , 335.6009257782864 },
-  { 202.63514538967124 , 470.0383312648066 },
-  { 66.35282887585129 , 65.58753271070351 },
-  { 925.55486062000658 , 357.32875271138323 },
-  { 103.77678823722586 , 528.2547737001372 },
-  { 833.5262955907059 , 90.40934686055576 },
-  { 291.18478562320703 , 589.7198071959425 },
-  { 25.23965411616769 , 310.84497010252363 },
-  { 575.50094308567515 , 549.3424440178276 },
-  { 1.7958360734249084 , 477.0517944903211 },
-  { 513.0344965739512 , 454.97818213984067 },
-  { 176.32607686610277 , 63.6679425266666 },
-  { 724.5529326999608 , 5.09147236642153 },
-  { 220.88954698486594 , 200.07004262187917 },
-  { 481.1485236188287 , 541.26162358545054 },
-  { 657.293005628366345 , 617.9395671962983 },
-  { 195.25876145214056 , 547.8099507886539 },
-  { 127.23784652068908 , 260.91055503617093 },
-  { 342.047415172485 , 382.94735604724923 },
-  { 477.30154933473534 , 357.95235604724917 },
-  { 4.091994741064738 , 564.7385563089967 },
-  { 942.04368619295605 , 43.15365975055971 },
-  { 794.7258647864196 , 284.3825111567315 },
-  { 881.71079030545498 , 461.38176494875466 },
-  { 280.5555798679396 , 173.94371527946907 },
-  { 38.080773952365185 , 260.1318500816928 },
-  { 853.97855881343202 , 201.0839666138833 },
-  { 524.83541127216495 , 27.29467742011218 },
-  { 509.39246131005675 , 130.68257935032278 },
-  { 805.1331151577045 , 480.23078009422359 },
-  { 26.93593810536371 , 168.27204382113072 },
-  { 404.96847542889307 , 450.493628431444 },
-  { 926.75500145620174 , 120.61950514857449 },
-  { 367.06363092870646 , 326.17318816091614 },
-  { 289.07796170275935 , 68.27326264147644 },
-  { 738.94311708155504 , 183.26155926865457 },
-  { 387.7768630412329 , 167.80721871411265 },
-  { 15.30928146639961 , 382.01259206660256 },
-  { 350.0016292557666 , 546.9705344783994 },
-  { 446.0626829142431 , 261.08402881035795 },
-  { 926.4389197854574 , 254.72480719594245 },
-  { 766.91667272237387 , 559.08913724666894 },
-  { 839.1914204499988 , 5.14994208924406 },
-  { 238.75937438627147 , 370.0900932529047 },
-  { 669.4343434918389 , 264.53843368169584 },
-  { 612.03118983242055 , 171.8536001865486 }
-},
-{ //#13 33
-  { 465.0207343262773 , 249.75169297521575 },
-  { 364.7785526927427 , 325.219199746042 },
-  { 859.29156039002163 , 390.06904574152753 },
-  { 278.3369590516502 , 663.2321993693162 },
-  { 790.27864179148776 , 212.09987183411897 },
-  { 271.3590569106025 , 227.40752120871662 },
-  { 279.3867129287188 , 137.82366997321034 },
-  { 176.35600688784925 , 134.4351785791324 },
-  { 321.15975712835245 , 421.5759911062841 },
-  { 428.3307205540805 , 416.8336246390024 },
-  { 534.5729021876151 , 425.30113140982866 },
-  { 740.74652018215886 , 138.90460688352582 },
-  { 884.4755204983959 , 287.91108193907377 },
-  { 758.7444604092655 , 287.2621697958913 },
-  { 181.02785473819637 , 200.5888670066879 },
-  { 815.7209435156998 , 625.49446467655935 },
-  { 977.19531620409555 , 345.01575693398564 },
-  { 563.7744054950434 , 532.728209797751 },
-  { 22.83978949670876 , 534.1199720752935 },
-  { 929.2114930175346 , 85.7541048450469 },
-  { 170.36778514424162 , 54.2192807707824 },
-  { 753.73146078599126 , 36.82057615479874 },
-  { 234.48645433914913 , 489.29259677735325 },
-  { 843.4592997096963 , 523.2605820394246 },
-  { 119.70696902849238 , 528.7150099833577 },
-  { 452.6650319290165 , 627.70427274524127 },
-  { 392.06867054016004 , 151.0627482076291 },
-  { 110.16237249135546 , 326.5932588290307 },
-  { 203.96419732714878 , 599.4152191727802 },
-  { 68.82692999812207 , 108.93135889327436 },
-  { 461.80202243139945 , 51.02697772268516 },
-  { 208.98936866433993 , 389.90513350579687 },
-  { 259.8431507868216 , 14.28085899362526 },
-  { 26.78455204473816 , 454.02143872394737 },
-  { 573.8629837699523 , 256.4139962642646 },
-  { 580.7454417449797 , 30.7310247549898 },
-  { 15.88411510632379 , 320.7024339701346 },
-  { 10.74398624670835 , 391.9962864785815 },
-  { 18.47524601792526 , 16.99288187677166 },
-  { 855.9657631379064 , 23.41874199741613 },
-  { 591.92839594749125 , 618.57212399326096 },
-  { 287.46971008591356 , 297.190426756536 },
-  { 659.26430249911596 , 399.59095550287134 },
-  { 4.0159940696596 , 213.42444134101595 },
-  { 761.2111505740584 , 430.042293731779 },
-  { 659.701481343231 , 194.79307526859836 },
-  { 621.6406220144621 , 466.3129544781914 },
-  { 338.241806512953 , 521.4775751376334 },
-  { 130.4888662089803 , 453.48335546861057 },
-  { 589.9430823185559 , 123.5757885432635 },
-  { 351.4771098946642 , 627.3051650425398 },
-  { 93.55662965344013 , 225.98036408205655 },
-  { 107.76477573888664 , 698.0910090418856 },
-  { 466.9403245103141 , 520.35964649809074 },
-  { 447.1448779487514 , 335.32799718625495 },
-  { 739.1171179322026 , 531.41899626426454 },
-  { 895.39349826862235 , 182.98233839166596 },
-  { 385.78679204131845 , 226.97111760296644 },
-  { 667.0569751031071 , 304.9990813936832 },
-  { 202.7421786512298 , 321.93070154493427 },
-  { 74.3574689281415 , 617.6987891946582 },
-  { 351.61096396770876 , 57.9043558962607 },
-  { 548.8115854401901 , 352.0966612670951 },
-  { 491.0234974376706 , 148.88343791786113 }
-},
-{ //#19  34
-  { 431.66774304731905 , 472.40929987673644 },
-  { 220.45289373219484 , 358.2016792343719 },
-  { 214.6964619050334 , 25.36241670671632 },
-  { 605.44789373219487 , 457.4558133966223 },
-  { 733.5283035481581 , 587.4290613868737 },
-  { 217.65912054196983 , 470.8375198164311 },
-  { 825.54304627089203 , 549.7011891649395 },
-  { 303.6802411163339 , 4.0129166063654 },
-  { 184.60871866727277 , 582.7367107614714 },
-  { 413.40231100441196 , 24.6854311534818 },
-  { 321.7447459834887 , 468.5707042344284 },
-  { 513.11163299246357 , 492.1241740330278 },
-  { 418.86806481962498 , 582.2849115053722 },
-  { 55.2212553957164 , 594.2337964362806 },
-  { 236.12213972116626 , 764.2841066316937 },
-  { 320.6696272706725 , 398.6775872177652 },
-  { 312.95089552011916 , 686.3677422058663 },
-  { 123.5010867999417 , 520.5847585769237 },
-  { 143.37928913774448 , 414.18848195707426 },
-  { 523.55422153211913 , 347.0404100269451 },
-  { 7.88722059629077 , 506.3600048368852 },
-  { 35.41011523033592 , 435.17556335854044 },
-  { 529.7338049621494 , 613.6987772951084 },
-  { 325.11778849200306 , 140.5908065636635 },
-  { 620.19743017187706 , 259.42161446255477 },
-  { 683.87145966076918 , 163.5673233861987 },
-  { 610.63563736450504 , 552.083848647665 },
-  { 595.69477802731727 , 374.77159118658665 },
-  { 145.43989410892058 , 101.76008559327937 },
-  { 579.32881423738337 , 181.347005213611 },
-  { 225.11778849200303 , 230.60080656366347 },
-  { 781.6533951461862 , 123.6720252853598 },
-  { 124.33527172054755 , 4.56212572629283 },
-  { 414.9494586748978 , 122.0285493584083 },
-  { 725.96140224882186 , 694.2078096072004 },
-  { 530.12042723570738 , 83.26021010486284 },
-  { 438.2317621244191 , 696.3937290349465 },
-  { 420.1706573725099 , 363.02183660518006 },
-  { 139.91482665512677 , 647.1562134200348 },
-  { 292.65412054196986 , 566.0916539786815 },
-  { 85.09346926473427 , 320.91167186082896 },
-  { 310.8158563997007 , 296.81722428043645 },
-  { 541.84230831694094 , 707.6350687723368 },
-  { 837.6591205419698 , 450.83751981643115 },
-  { 90.75002575084895 , 718.3492771947575 },
-  { 632.4553740366405 , 659.7997225162857 },
-  { 41.44230597875175 , 245.9508442845367 },
-  { 852.4657402130358 , 354.0234108596308 },
-  { 818.376222079283 , 737.0630359883523 },
-  { 497.4229439547991 , 221.660659077639 },
-  { 760.6696272706725 , 268.6775872177652 },
-  { 19.20513112612085 , 804.7504745108902 },
-  { 246.10486989346913 , 122.6316326562549 },
-  { 3.8235104143614507 , 349.30763564477877 },
-  { 11.989580490884507 , 694.8612358057728 },
-  { 356.2277056163644 , 628.081922332856 },
-  { 18.95110134064315 , 166.4450976400196 },
-  { 730.35603098543928 , 433.2123381946276 },
-  { 449.7288477992283 , 775.7811923065029 },
-  { 148.6761948509105 , 270.5778069403893 },
-  { 39.12909319348744 , 66.3963599604707 },
-  { 689.3085471832604 , 334.59839469383235 },
-  { 406.76624829137774 , 253.85168538615105 },
-  { 143.0171976592176 , 172.73016600760113 }
-},
-{ //#9 35
-  { 525.4100877625881 , 243.68906094111588 },
-  { 510.1024383879905 , 352.6086458220012 },
-  { 372.9314749622625 , 377.3510122892829 },
-  { 253.4534005286336 , 258.3288144177759 },
-  { 561.2193290713307 , 139.691472810947 },
-  { 637.6248032381158 , 218.81165745019524 },
-  { 45.02569467483687 , 111.84955306084527 },
-  { 463.9044603098406 , 152.50321833578687 },
-  { 104.62157350188085 , 407.3456091939085 },
-  { 965.3487672192243 , 309.6321289994659 },
-  { 859.6955821621682 , 229.86130764694965 },
-  { 549.7222433965214 , 10.30400953939062 },
-  { 221.5338103445968 , 148.35556642752442 },
-  { 475.4015459846498 , 43.115755064230484 },
-  { 374.74888457859157 , 100.13537293385548 },
-  { 862.3671697053975 , 325.98262087592326 },
-  { 295.02569467483687 , 161.83955306084528 },
-  { 59.3782293958565 , 505.59048158320536 },
-  { 82.7255766521609 , 303.10595171160344 },
-  { 694.359273947927 , 681.7920615981318 },
-  { 620.0924383879905 , 652.6086458220012 },
-  { 258.1945115903552 , 477.83187717539255 },
-  { 785.5232558742308 , 9.1464269755448 },
-  { 513.3582479899364 , 550.57419018609306 },
-  { 792.8878398662085 , 519.2925223363049 },
-  { 637.6248032381158 , 419.77338722241456 },
-  { 443.6103527131813 , 501.95231542121246 },
-  { 919.6004296234711 , 379.04169695691934 },
-  { 730.5070350855312 , 113.79692687519392 },
-  { 604.597149517948 , 61.43581320566019 },
-  { 527.3541700821233 , 636.4242145170158 },
-  { 153.4534005286336 , 228.3288144177759 },
-  { 377.00651811130984 , 2.964409508127474 },
-  { 777.9264749622625 , 242.0968781270325 },
-  { 449.8563196345126 , 705.61773947411103 },
-  { 599.3389833651056 , 312.08846754644054 },
-  { 185.3036247867588 , 569.51206760796165 },
-  { 263.1754704167116 , 576.00132896489225 },
-  { 279.8911123727565 , 54.601586698947635 },
-  { 151.52325587423076 , 49.14642697554481 },
-  { 423.4526434836148 , 282.6103182618997 },
-  { 879.2997388872939 , 19.71822482069554 },
-  { 128.8188740011842 , 144.45518819260283 },
-  { 439.2796960445103 , 398.678153817457 },
-  { 742.2315094654197 , 453.76216643371504 },
-  { 708.3250124275382 , 303.06888574885164 },
-  { 289.5310485059665 , 376.9113179006952 },
-  { 428.35271918046305 , 609.1232788469405 },
-  { 556.58622099685 , 452.2934393181623 },
-  { 593.1267033178369 , 546.04542008884505 },
-  { 356.29736337098626 , 493.54503078217067 },
-  { 667.6848217521995 , 151.5343465570064 },
-  { 927.828318368338 , 552.96864587785015 },
-  { 361.1985093213644 , 227.6153182618997 },
-  { 770.6755476175028 , 349.92413471157403 },
-  { 679.1390014149495 , 20.47465664785693 },
-  { 896.29487629108417 , 465.06221486497765 },
-  { 666.3756405474451 , 528.7717226195916 },
-  { 927.3513374866083 , 153.7247131233119 },
-  { 38.30286774174 , 25.240563763837837 },
-  { 44.081910629277 , 219.93605307871252 },
-  { 182.0142834369664 , 340.8016995824853 },
-  { 873.8351200954678 , 94.03991962715078 },
-  { 795.1089801960366 , 133.71581295086438 }
-},
-{ //#8  36
-  { 358.8003707933712 , 152.07328260205045 },
-  { 231.68496505481784 , 499.43610541123033 },
-  { 608.03592719546097 , 374.71593681545568 },
-  { 935.3532799617727 , 310.44511075171135 },
-  { 327.38410605436414 , 531.43219215317754 },
-  { 468.7903707933712 , 162.07328260205045 },
-  { 17.662036166286086 , 339.1047067002939 },
-  { 92.67503578956023 , 258.6631130592013 },
-  { 810.43754798419127 , 64.95787686349706 },
-  { 167.63667429070355 , 397.11841354091473 },
-  { 298.525748901918746 , 613.21574971784696 },
-  { 256.15771657996595 , 121.60691472285394 },
-  { 665.035927195461 , 21.71593681545568 },
-  { 757.5986557300899 , 230.54026329040855 },
-  { 60.51707198710638 , 153.47915295082703 },
-  { 666.8176055416615 , 565.0619789897563 },
-  { 520.3605450480215 , 68.79647250580514 },
-  { 153.04912447275865 , 93.22987860145535 },
-  { 417.5095281132192 , 338.5652498181978 },
-  { 945.6681944226192 , 187.71605738669047 },
-  { 22.96968554088371 , 458.0242915811792 },
-  { 84.40758923182892 , 380.18586332194366 },
-  { 856.7595447007798 , 141.0862012005843 },
-  { 588.9924045535138 , 81.5166357984283 },
-  { 340.1685676823047 , 259.34181039398163 },
-  { 665.3902643106973 , 170.04354283957417 },
-  { 567.072814369477 , 191.48988378867978 },
-  { 783.35493194927375 , 485.6163737538699 },
-  { 157.69590012094773 , 296.6201587989791 },
-  { 792.05941037292575 , 305.9622656466896 },
-  { 545.40315389056319 , 290.2292129433614 },
-  { 866.9127580803587 , 457.30735475807353 },
-  { 17.86516436438437 , 61.07191479900158 },
-  { 743.32245386918123 , 389.4580293502452 },
-  { 272.1270680041679 , 229.78988827311963 },
-  { 308.4565958203903 , 23.7548976536809 },
-  { 427.06675328805244 , 525.70301821692186 },
-  { 867.64593354116698 , 359.62122388463206 },
-  { 80.16292609273883 , 16.10034397929357 },
-  { 452.93922573367753 , 429.55679147990452 },
-  { 448.13774158971324 , 238.35472899251548 },
-  { 189.15156099391442 , 596.80706648996113 },
-  { 181.52299497038229 , 17.54868613112353 },
-  { 741.78080595128495 , 99.95431924194303 },
-  { 174.58161770193237 , 199.47206023498995 },
-  { 620.55802129806784 , 632.91358284014655 },
-  { 512.300629551775742 , 492.3375101032724 },
-  { 915.42620121502296 , 12.1708469682536 },
-  { 621.2757988824446 , 468.18993858763164 },
-  { 946.4426041835253 , 95.5178404025237 },
-  { 250.23945529115537 , 325.0239604291427 },
-  { 415.81385397083596 , 60.82695377081656 },
-  { 661.87788517574063 , 278.25595258221082 },
-  { 346.75176099832822 , 397.04268076580428 },
-  { 952.12239266304076 , 431.77212398842403 },
-  { 274.76133927972035 , 411.2584010754522 },
-  { 4.257627085153949 , 229.93455548126488 },
-  { 959.51450794020803 , 539.22571028724423 },
-  { 62.23504461812848 , 554.3357025077938 },
-  { 230.18993114726183 , 690.6983654610661 },
-  { 550.07708081567467 , 579.5196626161681 },
-  { 467.2711789484367 , 602.2447317935113 },
-  { 128.52109381549856 , 634.63715701782053 },
-  { 126.25016906418313 , 499.9598537768585 }
-},
-{ //#37
-  { 329.3001530614103 , 340.4662775900467 },
-  { 432.6569444216524 , 302.8474820256564 },
-  { 539.8279078473804 , 327.58984849293813 },
-  { 302.69116376440286 , 23.74345065694985 },
-  { 513.2189185503729 , 434.31267542603496 },
-  { 628.8116870586808 , 262.93934859328897 },
-  { 20.5757580258495 , 285.38062784777003 },
-  { 683.8066870586808 , 167.68521443103856 },
-  { 172.17134894471735 , 176.21047662874102 },
-  { 949.3993626904914 , 338.0035883481232 },
-  { 419.3986864127565 , 403.55394982429823 },
-  { 919.3337777568441 , 63.00178075264458 },
-  { 635.0820420096309 , 572.58484849293814 },
-  { 724.0658212209312 , 20.9443485932889 },
-  { 102.89124691542229 , 324.7975186182576 },
-  { 497.9112691757753 , 543.2322603069202 },
-  { 90.73316666552404 , 690.9911530147514 },
-  { 215.5757580258495 , 364.21440938874514 },
-  { 18.47619496426384 , 673.6996326015828 },
-  { 662.3279044498213 , 362.6241420894501 },
-  { 117.85915235478035 , 392.0539306369734 },
-  { 847.84915235478036 , 672.0539306369734 },
-  { 891.314729920645 , 161.20475996246074 },
-  { 65.0723682000125 , 100.38665929670782 },
-  { 846.1781571085931 , 581.1534936985591 },
-  { 981.9058886222653 , 190.95485532199154 },
-  { 25.613776586463146 , 431.9587780982762 },
-  { 203.20164028605788 , 609.9071648673252 },
-  { 797.4141875728074 , 329.97502874289603 },
-  { 479.5765346056892 , 102.87423403540492 },
-  { 882.0838738009186 , 278.58669757763556 },
-  { 38.01768017768362 , 22.065128669779 },
-  { 887.94430489347752 , 484.2993064052906 },
-  { 216.38104242556662 , 701.45425683326556 },
-  { 686.719219200451 , 479.7002542314915 },
-  { 645.4456069594916 , 659.185723763928 },
-  { 212.18937789729264 , 495.76019992586305 },
-  { 306.42216959022124 , 702.30762099306435 },
-  { 393.9136810456065 , 579.0415016156629 },
-  { 389.68042759911714 , 201.60115319442252 },
-  { 195.45716881772756 , 269.48728672498635 },
-  { 363.0714383021097 , 94.87832626132568 },
-  { 290.5568896853644 , 541.4227060512726 },
-  { 287.8485724040774 , 442.6283302055715 },
-  { 110.07072079747876 , 472.81981724083107 },
-  { 204.9164889016945 , 15.96877579424148 },
-  { 32.0949214795745 , 196.12465509255958 },
-  { 862.8384145760831 , 399.749781091604 },
-  { 133.20859968173403 , 580.52669255451326 },
-  { 745.93944878447405 , 676.46725645653976 },
-  { 738.7346841225112 , 266.77794423559703 },
-  { 305.3504544207944 , 256.9403479956108 },
-  { 412.4329848751231 , 682.4512101184919 },
-  { 781.7112009450464 , 165.5316154043631 },
-  { 541.7474980314172 , 217.61660050268662 },
-  { 422.57696315765554 , 18.18045771703635 },
-  { 387.8385724040774 , 472.6283302055715 },
-  { 38.20898320118454 , 570.16641229709296 },
-  { 740.0995718799139 , 402.2608166467796 },
-  { 165.49555907561196 , 102.40989821700316 },
-  { 596.7424980314172 , 122.36246634043623 },
-  { 274.42629343686673 , 146.60615319442252 },
-  { 626.0640136254526 , 17.87876365964166 },
-  { 292.1649412915649 , 793.0078301824868 }
-},
-{ //#38
-  { 621.1346699399435 , 389.84971054356828 },
-  { 619.3408967497185 , 278.48555112562747 },
-  { 257.16993332399045 , 263.22791759290914 },
-  { 34.5482153352322 , 406.98150367052295 },
-  { 349.0673504491225 , 32.24454029861573 },
-  { 319.3303870772153 , 562.7254051847254 },
-  { 529.6039333778112 , 338.9664160117371 },
-  { 471.31811350480103 , 432.2432261079824 },
-  { 540.7676087174012 , 181.4894182386505 },
-  { 240.1477655682372 , 46.93689092401813 },
-  { 237.57026477431333 , 481.63200357017212 },
-  { 570.6906057812316 , 665.3280138809586 },
-  { 486.4107743770063 , 628.67897602160173 },
-  { 845.2667720373846 , 515.56875042951035 },
-  { 989.54821533523216 , 17.507576926708474 },
-  { 135.9536895020173 , 96.62776156595669 },
-  { 831.5089536709193 , 393.1012436586841 },
-  { 124.4501588295163 , 469.26660131405583 },
-  { 977.6976881099605 , 268.86675556123717 },
-  { 349.8434526022123 , 203.25538052535632 },
-  { 986.73355315844714 , 355.93990410325918 },
-  { 978.63609951429794 , 710.904301158893375 },
-  { 846.9938836065187 , 725.994464911174518 },
-  { 531.1813485725863 , 71.91796339553942 },
-  { 424.83433089594155 , 531.9280196041435 },
-  { 368.943015663798 , 311.57438527916906 },
-  { 730.17084184388364 , 390.0778959942053 },
-  { 403.84724949447536 , 639.8971935115521 },
-  { 160.3312285518579 , 194.20140474900057 },
-  { 166.43234248962506 , 370.4802206007945 },
-  { 725.7340579405612 , 468.4871311232704 },
-  { 691.519460399622 , 4.941311060018194 },
-  { 529.1111409921867 , 543.6421997311332 },
-  { 806.50592691570347 , 646.43360025328454 },
-  { 615.8522407589641 , 479.21090734650514 },
-  { 877.4959772221572 , 116.18763989125209 },
-  { 650.6906057812316 , 177.65082259634244 },
-  { 970.55568969833473 , 160.87754914914484 },
-  { 888.1869221618907 , 17.334037191698858 },
-  { 362.9317948750985 , 416.18109150647297 },
-  { 46.128858269127 , 210.06875782642157 },
-  { 641.5040537134666 , 103.02483581113543 },
-  { 847.9050213662892 , 193.22949759055209 },
-  { 140.46297207207607 , 0.45310831515861594 },
-  { 934.6856705128667 , 619.99482637935199 },
-  { 31.831609664163 , 104.18087971591183 },
-  { 649.3992757603737 , 591.34678522680329 },
-  { 753.13708180977466 , 565.65895185231096 },
-  { 32.14396731826332 , 19.552671376744275 },
-  { 152.65871400474157 , 283.92347463707864 },
-  { 261.12622077556784 , 390.1656562706132 },
-  { 778.7423060533911 , 73.21112306871677 },
-  { 10.60430942221484 , 306.4590216183949 },
-  { 588.0150408762722 , 5.1375816249815 },
-  { 455.3317728999016 , 8.123146518077604 },
-  { 746.9166379215321 , 286.3450398618894 },
-  { 926.1672089757989 , 433.8877551833231 },
-  { 466.0218919959057 , 257.58511418721315 },
-  { 304.98889234203 , 688.1136359468827 },
-  { 283.1242823907724 , 148.18321975525203 },
-  { 750.7073059308127 , 170.4067213073072 },
-  { 856.0867891405611 , 299.74944894302155 },
-  { 401.366464024307 , 112.71571298442578 },
-  { 948.8644474307954 , 533.830251075251724 }
-},
-{ //#6 39
-  { 479.1485999041492 , 400.4593707219857 },
-  { 337.2360407245913 , 485.78973001095966 },
-  { 401.8865406242404 , 396.8059507996592 },
-  { 855.8718813066505 , 498.5835032011846 },
-  { 263.3921680769878 , 305.6201081943301 },
-  { 788.1172570749677 , 528.4883506624874 },
-  { 782.7796313485442 , 317.1171938691393 },
-  { 770.40065140389856 , 74.815047873284 },
-  { 316.4082563235882 , 327.58700098808754 },
-  { 828.2579156491963 , 247.89824405756767 },
-  { 747.2416948604968 , 183.24774415791853 },
-  { 189.72846037434215 , 280.6123164031654 },
-  { 665.9573244763018 , 545.47784393378475 },
-  { 221.9776364784212 , 423.71700425470397 },
-  { 422.7143250252435 , 555.0086798225312 },
-  { 305.8162321207293 , 178.6400013185343 },
-  { 689.5535724346797 , 415.54310525816044 },
-  { 267.0989673238564 , 53.6942863691154 },
-  { 871.95088446867265 , 388.79741407066706 },
-  { 101.8865406242404 , 258.3680511765159 },
-  { 322.51508994640847 , 96.20229876557494 },
-  { 619.2634139574037 , 217.43240037297824 },
-  { 509.6919591142927 , 47.2157272204856 },
-  { 560.7394150400088 , 457.04873271090787 },
-  { 278.7008263821759 , 549.0028241277142 },
-  { 437.53202651562674 , 324.20522049178294 },
-  { 596.7522881964488 , 606.71240145223868 },
-  { 222.6504379571228 , 219.11949421726126 },
-  { 220.48438394684524 , 547.8611812801596 },
-  { 572.5053912643913 , 377.8405751575954 },
-  { 440.7661670497573 , 478.96832289494466 },
-  { 531.6339099061288 , 539.7010304479336 },
-  { 730.9462936492397 , 553.2307171297691 },
-  { 166.0772993154977 , 122.8083626694903 },
-  { 340.8477602978935 , 616.3183893640207 },
-  { 796.4030769479779 , 435.2115405662421 },
-  { 399.9669504402036 , 148.39480318626443 },
-  { 108.6534263475266 , 416.9164258429661 },
-  { 292.0472780965848 , 391.0495189724978 },
-  { 946.3088508584584 , 475.888495183283 },
-  { 949.9858581583192 , 415.7530344511985 },
-  { 249.6656422187005 , 138.26969961889273 },
-  { 568.1593822978501 , 310.98591629181925 },
-  { 685.9078238522351 , 86.737206389719 },
-  { 388.5681889222541 , 244.57649425938484 },
-  { 510.4229383480332 , 584.6287805298348 },
-  { 495.7391523479821 , 269.31886072666657 },
-  { 127.5895022889976 , 595.6119215653788 },
-  { 550.0444641458321 , 131.95411607232597 },
-  { 474.9050317313106 , 105.6201081943301 },
-  { 632.8802387373627 , 496.7245136253983 },
-  { 132.541841956157 , 484.28270858153815 },
-  { 152.9580546808322 , 348.3026149382917 },
-  { 685.7360674077494 , 274.4335867632476 },
-  { 52.05761774241785 , 219.98361018447895 },
-  { 843.4411164487589 , 129.92353402702395 },
-  { 49.61915736832697 , 573.5449128536391 },
-  { 450.77075736172384 , 620.1569850063288 },
-  { 364.2677450598501 , 25.16274215990126 },
-  { 673.7517200956252 , 334.8640583350601 },
-  { 888.1345345442695 , 198.44914476860208 },
-  { 889.81451775348796 , 287.5530110819201 },
-  { 238.1632491874663 , 655.7352801345083 },
-  { 491.9850739755866 , 195.2803789422643 }
-},
-{ //#23 40
-  { 401.91118406367536 , 272.52808965444876 },
-  { 476.33206894054496 , 227.55909352838773 },
-  { 303.0053717297483 , 595.2756991994569 },
-  { 272.5768265728593 , 34.8619593442718 },
-  { 636.7675852641166 , 408.85954747444066 },
-  { 387.34828972924447 , 162.90859362873863 },
-  { 739.4520963745439 , 448.2764382449282 },
-  { 457.0455153760386 , 616.532062021557 },
-  { 724.2140037636794 , 27.7465536057184 },
-  { 513.6411062949064 , 525.702213240586 },
-  { 706.7675852641166 , 338.85954747444066 },
-  { 84.36100426561137 , 377.1151712510694 },
-  { 423.679913029865 , 88.76101412309447 },
-  { 319.1770441572371 , 344.95720744861563 },
-  { 153.08237466591794 , 299.11429484176494 },
-  { 629.9341723594541 , 51.09751574636152 },
-  { 279.7618351245332 , 185.77680050178398 },
-  { 638.7357194630272 , 138.52760379414676 },
-  { 311.50452961012076 , 454.6792773366937 },
-  { 681.5713495502742 , 248.2129214849149 },
-  { 930.4027399629618 , 292.152024826087 },
-  { 177.5185086721731 , 498.6840111869248 },
-  { 619.6072975363755 , 241.73533281701887 },
-  { 170.9745456371568 , 16.26278060092307 },
-  { 435.5398879232911 , 505.346219416228 },
-  { 582.0252187968349 , 321.68858404871264 },
-  { 315.18835713057854 , 245.9191003574413 },
-  { 193.08853233532983 , 118.06019483071488 },
-  { 750.3515014355677 , 207.08728448156342 },
-  { 788.7217447167745 , 573.05246176450123 },
-  { 815.8067191246377 , 95.0595429479135 },
-  { 558.3780696668136 , 626.1830781266957 },
-  { 694.6202971596497 , 522.17692645811144 },
-  { 265.8528340263425 , 441.1566290368778 },
-  { 611.069698175854 , 688.5081563692403 },
-  { 635.454508244375 , 484.0856795536709 },
-  { 719.7830533826343 , 116.2261187622126 },
-  { 414.18904072054795 , 415.2623865662061 },
-  { 63.7784463812112 , 55.67334188884286 },
-  { 52.1859562691793 , 295.9321522215513 },
-  { 177.1909562691793 , 391.1862863838017 },
-  { 489.73647802167716 , 336.7292447474167 },
-  { 377.69796817318934 , 371.5398538127218 },
-  { 53.9529204570077 , 157.87088759497135 },
-  { 124.3091563023767 , 79.9919293740356 },
-  { 650.4683171632435 , 583.6259383452791 },
-  { 543.3625602635533 , 213.0318401868388 },
-  { 593.210553989726 , 130.69992416924333 },
-  { 181.8138794752258 , 217.21320016367878 },
-  { 316.6800500593288 , 90.8527941960235 },
-  { 69.0550221401263 , 244.99692937403557 },
-  { 348.8633407550452 , 553.3165616355436 },
-  { 670.4705606600686 , 659.9149264378659 },
-  { 821.5358930608933 , 264.7421901816017 },
-  { 222.89978536616144 , 556.9641283151241 },
-  { 504.40452224047715 , 16.01315016273512 },
-  { 887.0899635152841 , 438.2702713317397 },
-  { 489.73647802167716 , 118.38894230935874 },
-  { 251.79734642758604 , 302.64192729053815 },
-  { 531.5836251557423 , 416.70158367198684 },
-  { 567.1796167703867 , 500.3150904557672 },
-  { 785.7718610106867 , 378.3565056174152 },
-  { 870.4602440710331 , 346.650137157912 },
-  { 591.0145874785688 , 16.40516512095917 }
-},
-{ //#5 41
-  { 312.72250337008313 , 286.29313820477853 },
-  { 196.9269643294401 , 351.68149187380055 },
-  { 228.5641415202602 , 284.56608613524713 },
-  { 129.44395688101196 , 375.97156030203223 },
-  { 449.55122292172638 , 312.5352600426557 },
-  { 576.9269643294401 , 381.6814918738005 },
-  { 831.18419262809647 , 240.981282684378 },
-  { 261.18419262809647 , 200.991282684378 },
-  { 604.5134189341514 , 314.5496987468458 },
-  { 498.09652039384488 , 340.88274933303182 },
-  { 542.35545513169757 , 509.7336588552201 },
-  { 614.2017228213755 , 481.5190392539562 },
-  { 695.70590832744426 , 96.77233287280637 },
-  { 398.4589511200319 , 552.2192484433787 },
-  { 675.7326603371928 , 143.69192305684317 },
-  { 199.79517120248545 , 489.26794647851176 },
-  { 113.94910277252342 , 34.83356590439779 },
-  { 308.43101178454464 , 506.47417328828675 },
-  { 17.30006491316655 , 129.11339730862312 },
-  { 139.5803623089597 , 209.91558623559803 },
-  { 253.4107469382996 , 441.3662853699616 },
-  { 350.7070533306452 , 492.39161849694756 },
-  { 163.3716759203971 , 574.3841587548692 },
-  { 483.109451019681 , 443.2354692320782 },
-  { 557.30006491316653 , 19.123397308623126 },
-  { 832.32583547565108 , 162.77484024904743 },
-  { 480.06818897536476 , 563.58957902684 },
-  { 570.9616760577103 , 115.5686134392724 },
-  { 679.4456932738379 , 384.57895807778885 },
-  { 362.64970981128926 , 626.2168365735475 },
-  { 471.4890921643542 , 23.852660529187588 },
-  { 380.1249327464134 , 41.05888733896258 },
-  { 488.93909014108438 , 102.56451479171002 },
-  { 80.44013925025229 , 87.5426699478221 },
-  { 354.15792914903034 , 358.5464808313552 },
-  { 848.5711033005556 , 374.20211575528367 },
-  { 743.21260498066496 , 181.15742069030878 },
-  { 91.4761664486727 , 508.36750954009744 },
-  { 110.57572951025838 , 616.6865142939102 },
-  { 796.9954960116005 , 372.883198671897 },
-  { 351.8484455627242 , 148.36364750008377 },
-  { 595.7120533306452 , 587.645752659198 },
-  { 61.079506644417194 , 195.75135707158267 },
-  { 411.8633602011641 , 443.0490972243497 },
-  { 690.23358752992607 , 272.900660887489 },
-  { 299.06987613982506 , 395.2762127583942 },
-  { 159.07864503545227 , 451.4478389822099 },
-  { 294.41547065171991 , 70.76057449944325 },
-  { 139.45762860260575 , 260.3612948537587 },
-  { 742.2081161701967 , 631.2298361968218 },
-  { 602.34349922221655 , 221.73466601073903 },
-  { 69.86642942556523 , 346.0514774337962 },
-  { 699.79517120248545 , 489.26794647851176 },
-  { 755.85116744062293 , 305.45877343854056 },
-  { 188.40931315766085 , 66.55558854635596 },
-  { 494.7577759167539 , 196.7241663851454 },
-  { 299.06987613982506 , 395.2762127583942 },
-  { 649.62755036605018 , 19.391327420545068 },
-  { 398.3322281715837 , 248.0484409962449 },
-  { 221.32791195622957 , 143.03983950276353 },
-  { 250.49673413225366 , 594.0033188820252 },
-  { 156.92561959505866 , 136.07989473563168 },
-  { 660.6515174067678 , 650.1512516399002 },
-  { 35.61488001018979 , 6.365093203447884 }
-},
-{ //#12 42
-  { 552.2416472990077 , 247.4408942782349 },
-  { 250.2936090097661 , 351.3908442304386 },
-  { 396.4930305980282 , 418.066634099544 },
-  { 46.5700335341979 , 244.2280384572359 },
-  { 336.55861553167546 , 250.06482650406542 },
-  { 343.4825238693255 , 345.22656669820987 },
-  { 398.06424298442283 , 98.87898389873635 },
-  { 341.41520512506594 , 4.599152494511046 },
-  { 173.2132421739558 , 446.60924289284563 },
-  { 578.82067481158424 , 518.71824642639194 },
-  { 133.20182417143337 , 152.44603093967513 },
-  { 653.4575367571189 , 252.86776311003683 },
-  { 98.0642429844228 , 98.87898389873637 },
-  { 391.55361553167546 , 285.31896066631583 },
-  { 766.8784003790938 , 7.373356445988925 },
-  { 726.89348942571814 , 73.81810230608265 },
-  { 454.641287765927 , 200.22042731496964 },
-  { 156.00701536418077 , 355.24508347490485 },
-  { 470.46971267094114 , 302.99807783061726 },
-  { 604.0252825526728 , 581.40455691079393 },
-  { 639.1803636902157 , 446.25877381302936 },
-  { 271.21504976943436 , 196.67482782649284 },
-  { 675.43848892091984 , 524.070742319853 },
-  { 899.1356286777502 , 61.07356563541137 },
-  { 524.0088951642715 , 22.180925115262525 },
-  { 493.71354813034134 , 402.30845393761314 },
-  { 265.3597879738872 , 257.6299910480494 },
-  { 242.27878412745014 , 633.41578864470858 },
-  { 180.4543464821105 , 547.1472760576 },
-  { 664.0656330988379 , 357.54205558778267 },
-  { 417.2860682311747 , 48.78991441226998 },
-  { 625.2552421385833 , 39.77699581373614 },
-  { 301.79069468457527 , 442.0033809588822 },
-  { 285.7850222100025 , 23.14569322195878 },
-  { 843.9956285559464 , 240.4237642382744 },
-  { 557.998079126169 , 157.60163175057934 },
-  { 657.5591741658428 , 140.12057103298116 },
-  { 52.6502240039387 , 317.6262879105145 },
-  { 470.8902577461609 , 543.68437620506943 },
-  { 195.12720000342898 , 218.8396093081197 },
-  { 71.5347616012252 , 562.4549254321976 },
-  { 281.16238068749874 , 109.99315581944818 },
-  { 495.20587411625706 , 467.0218116474609 },
-  { 81.4567940724072 , 195.0289039232087 },
-  { 77.7698353716833 , 386.56416682808754 },
-  { 155.43679091005686 , 261.4685866903575 },
-  { 1.0130468131186063 , 414.7416936490679 },
-  { 371.0096444961469 , 517.4816652595344 },
-  { 754.4248239278287 , 392.5000959481131 },
-  { 34.7933185491481 , 487.8104956593214 },
-  { 510.0196262178713 , 112.01520564019076 },
-  { 152.7573275676964 , 8.61053481138046 },
-  { 938.3921423611123 , 278.30317199618696 },
-  { 286.9469093043715 , 549.3077398776163 },
-  { 806.6888816846295 , 101.13179182168065 },
-  { 238.2290213448189 , 469.3726011948916 },
-  { 772.5937176057723 , 307.7094992931553 },
-  { 103.69755792354582 , 454.15858441955544 },
-  { 882.3214712830792 , 169.57919308815883 },
-  { 853.9267492013266 , 418.3168846765424 },
-  { 737.61941128660976 , 207.7583591315725 },
-  { 189.5856006217404 , 76.46990335285341 },
-  { 372.3482232928277 , 167.65960290412204 },
-  { 582.7394581370045 , 346.82458811906326 }
-},
-{ //#24 43
-  { 490.7307106807841 , 335.45009552437716 },
-  { 623.7325182762627 , 410.3845105907299 },
-  { 859.48852904724953 , 218.91760229520344 },
-  { 56.87235352833875 , 48.66653795970774 },
-  { 321.1431795920831 , 430.9838907260195 },
-  { 815.2177029835052 , 419.23495506151517 },
-  { 713.8111204967473 , 170.42334351462864 },
-  { 285.4941417327262 , 324.7040593217942 },
-  { 317.47065855526137 , 34.45773049056027 },
-  { 386.3368139885768 , 351.1419709759178 },
-  { 597.1235289792552 , 517.1073375238268 },
-  { 155.03050149136163 , 44.70732382303356 },
-  { 780.071638276762 , 91.60211340563063 },
-  { 96.62032217420415 , 281.3311476904922 },
-  { 313.75935511099385 , 109.2349550615152 },
-  { 355.6541667548886 , 245.4127970396621 },
-  { 37.25582662865327 , 582.4819986857419 },
-  { 789.5012023969705 , 262.5771512244391 },
-  { 636.8623535283388 , 108.66653795970774 },
-  { 130.3785709194792 , 508.3513314558689 },
-  { 630.4477391101498 , 600.3067591120889 },
-  { 453.7357279127575 , 229.69397049967205 },
-  { 717.99144337244036 , 259.53013902364705 },
-  { 576.7462346414602 , 157.53403790100614 },
-  { 59.9149422521555 , 353.005696381328 },
-  { 98.3530347772763 , 415.7924708755669 },
-  { 550.4730771480658 , 253.27913209864914 },
-  { 398.24290803011945 , 630.4511725931504 },
-  { 330.1372232104092 , 589.6039210011093 },
-  { 701.4348205116158 , 505.33758520468035 },
-  { 500.9419547225325 , 131.05812991761285 },
-  { 927.503009992449 , 412.64273615808634 },
-  { 220.57835991456795 , 533.56714573827526 },
-  { 722.9404479643632 , 414.1517425993513 },
-  { 567.6793039578408 , 14.64329151658995 },
-  { 501.26825346868566 , 37.81595889665726 },
-  { 430.98244211973866 , 433.22745889885806 },
-  { 328.8973646683807 , 512.6667087998609 },
-  { 839.310332895587 , 501.3563616823904 },
-  { 395.73392031727894 , 149.6283855660248 },
-  { 185.4004078907394 , 368.28368153659704 },
-  { 500.992538167587 , 505.07201212649284 },
-  { 832.4539005845388 , 358.7359153973874 },
-  { 36.2027091742393 , 482.19441239144874 },
-  { 655.4527805688622 , 338.1226100714935 },
-  { 533.7425182762627 , 410.3845105907299 },
-  { 414.1934854883582 , 70.0667197875677 },
-  { 221.82468874580184 , 136.5436625608105 },
-  { 654.8508953200324 , 46.85556969116226 },
-  { 930.8621161087319 , 541.4622759184662 },
-  { 199.3350063930982 , 301.2075559095651 },
-  { 253.66130079543836 , 601.6021833249902 },
-  { 243.65657862471977 , 209.60355573091942 },
-  { 229.4991417327262 , 439.9581934840446 },
-  { 897.1044004841879 , 319.7521361860869 },
-  { 440.1272232104092 , 589.6039210011093 },
-  { 750.9286039962594 , 658.0437224839961 },
-  { 632.6743039578408 , 239.89742567884036 },
-  { 863.1836613380403 , 123.3973916012649 },
-  { 49.23647304175194 , 188.11988367531356 },
-  { 530.9298945827613 , 604.9492572739285 },
-  { 122.1480688294374 , 141.22143306344236 },
-  { 714.4113373341511 , 606.5839140359143 },
-  { 803.66452622415 , 568.1343549731721 }
-},
-{ //#8 44
-  { 368.8003707933712 , 162.07328260205045 },
-  { 231.68496505481784 , 100.43610541123033 },
-  { 705.03592719546097 , 304.71593681545568 },
-  { 935.3532799617727 , 310.44511075171135 },
-  { 327.38410605436414 , 531.43219215317754 },
-  { 470.7903707933712 , 162.07328260205045 },
-  { 17.662036166286086 , 339.1047067002939 },
-  { 92.67503578956023 , 258.6631130592013 },
-  { 810.43754798419127 , 64.95787686349706 },
-  { 167.63667429070355 , 397.11841354091473 },
-  { 28.525748901918746 , 283.21574971784696 },
-  { 316.15771657996595 , 81.60691472285394 },
-  { 735.035927195461 , 214.71593681545568 },
-  { 827.5986557300899 , 250.54026329040855 },
-  { 60.51707198710638 , 153.47915295082703 },
-  { 696.8176055416615 , 515.0619789897563 },
-  { 520.3605450480215 , 68.79647250580514 },
-  { 133.04912447275865 , 93.22987860145535 },
-  { 417.5095281132192 , 338.5652498181978 },
-  { 855.6681944226192 , 177.71605738669047 },
-  { 32.96968554088371 , 448.0242915811792 },
-  { 84.40758923182892 , 380.18586332194366 },
-  { 876.7595447007798 , 541.0862012005843 },
-  { 588.9924045535138 , 21.5166357984283 },
-  { 340.1685676823047 , 259.34181039398163 },
-  { 645.3902643106973 , 170.04354283957417 },
-  { 567.072814369477 , 191.48988378867978 },
-  { 783.35493194927375 , 545.6163737538699 },
-  { 177.69590012094773 , 296.6201587989791 },
-  { 792.05941037292575 , 345.9622656466896 },
-  { 545.40315389056319 , 270.2292129433614 },
-  { 836.9127580803587 , 457.30735475807353 },
-  { 47.86516436438437 , 61.07191479900158 },
-  { 743.32245386918123 , 439.4580293502452 },
-  { 272.1270680041679 , 209.78988827311963 },
-  { 338.4565958203903 , 5.7548976536809 },
-  { 427.06675328805244 , 525.70301821692186 },
-  { 867.64593354116698 , 359.62122388463206 },
-  { 80.16292609273883 , 6.10034397929357 },
-  { 452.93922573367753 , 429.55679147990452 },
-  { 448.13774158971324 , 238.35472899251548 },
-  { 219.15156099391442 , 516.80706648996113 },
-  { 181.52299497038229 , 178.54868613112353 },
-  { 761.78080595128495 , 119.95431924194303 },
-  { 124.58161770193237 , 199.47206023498995 },
-  { 620.55802129806784 , 332.91358284014655 },
-  { 512.300629551775742 , 382.3375101032724 },
-  { 901.42620121502296 , 12.1708469682536 },
-  { 671.2757988824446 , 68.18993858763164 },
-  { 946.4426041835253 , 95.5178404025237 },
-  { 270.23945529115537 , 335.0239604291427 },
-  { 425.81385397083596 , 60.82695377081656 },
-  { 621.87788517574063 , 578.25595258221082 },
-  { 346.75176099832822 , 397.04268076580428 },
-  { 592.12239266304076 , 431.77212398842403 },
-  { 254.76133927972035 , 431.2584010754522 },
-  { 4.257627085153949 , 229.93455548126488 },
-  { 959.51450794020803 , 159.22571028724423 },
-  { 32.23504461812848 , 544.3357025077938 },
-  { 230.18993114726183 , 630.6983654610661 },
-  { 550.07708081567467 , 519.5196626161681 },
-  { 467.2711789484367 , 612.2447317935113 },
-  { 128.52109381549856 , 604.63715701782053 },
-  { 126.25016906418313 , 499.9598537768585 }
-},
-{ //#3  45
-  { 690.94311708155504 , 223.26155926865457 },
-  { 545.0233812655151 , 399.79681013211214 },
-  { 918.42779034664727 , 398.96696135114115 },
-  { 346.20246520935564 , 225.19228648843279 },
-  { 640.4460333821943 , 307.0315490160884 },
-  { 727.81715445574008 , 91.16096955005295 },
-  { 540.02838126551512 , 295.0509442943626 },
-  { 561.20461772729647 , 29.66388387524376 },
-  { 441.72633342664426 , 12.8828336868154 },
-  { 640.80899478225697 , 412.32375271138324 },
-  { 845.9170921179016 , 584.88524555664654 },
-  { 736.51216387437466 , 394.7357377905237 },
-  { 125.57177868742286 , 151.06581701135576 },
-  { 228.85812655359894 , 606.46928829152665 },
-  { 863.0488852448563 , 310.4668764216955 },
-  { 902.95035189351013 , 503.5545486559471 },
-  { 645.47324533607663 , 57.97814477710423 },
-  { 298.6642218475743 , 477.84471748458753 },
-  { 366.33303965394816 , 84.8940544755149 },
-  { 214.2000054852495 , 285.6009257782864 },
-  { 202.63514538967124 , 450.0383312648066 },
-  { 56.35282887585129 , 75.58753271070351 },
-  { 135.55486062000658 , 357.32875271138323 },
-  { 103.77678823722586 , 518.2547737001372 },
-  { 823.5262955907059 , 100.40934686055576 },
-  { 301.18478562320703 , 580.7198071959425 },
-  { 25.23965411616769 , 580.84497010252363 },
-  { 675.50094308567515 , 509.3424440178276 },
-  { 821.7958360734249084 , 437.0517944903211 },
-  { 483.0344965739512 , 479.97818213984067 },
-  { 126.32607686610277 , 33.6679425266666 },
-  { 794.5529326999608 , 6.09147236642153 },
-  { 210.88954698486594 , 190.07004262187917 },
-  { 531.1485236188287 , 191.26162358545054 },
-  { 727.293005628366345 , 617.9395671962983 },
-  { 164.25876145214056 , 527.8099507886539 },
-  { 127.23784652068908 , 250.91055503617093 },
-  { 342.047415172485 , 382.94735604724923 },
-  { 447.30154933473534 , 365.95235604724917 },
-  { 764.091994741064738 , 534.7385563089967 },
-  { 632.04368619295605 , 593.15365975055971 },
-  { 774.7258647864196 , 304.3825111567315 },
-  { 41.71079030545498 , 461.38176494875466 },
-  { 285.5555798679396 , 163.94371527946907 },
-  { 38.080773952365185 , 260.1318500816928 },
-  { 893.97855881343202 , 201.0839666138833 },
-  { 524.83541127216495 , 637.29467742011218 },
-  { 509.39246131005675 , 90.68257935032278 },
-  { 215.1331151577045 , 90.23078009422359 },
-  { 26.93593810536371 , 168.27204382113072 },
-  { 394.96847542889307 , 450.493628431444 },
-  { 919.75500145620174 , 110.61950514857449 },
-  { 367.06363092870646 , 326.17318816091614 },
-  { 309.07796170275935 , 28.27326264147644 },
-  { 427.7768630412329 , 157.80721871411265 },
-  { 55.30928146639961 , 382.01259206660256 },
-  { 390.0016292557666 , 546.9705344783994 },
-  { 446.0626829142431 , 261.08402881035795 },
-  { 536.4389197854574 , 554.72480719594245 },
-  { 436.91667272237387 , 639.08913724666894 },
-  { 789.1914204499988 , 200.14994208924406 },
-  { 238.75937438627147 , 370.0900932529047 },
-  { 969.4343434918389 , 264.53843368169584 },
-  { 622.03118983242055 , 151.8536001865486 }
-},
-{ //#9 46
-  { 525.4100877625881 , 243.68906094111588 },
-  { 510.1024383879905 , 352.6086458220012 },
-  { 372.9314749622625 , 377.3510122892829 },
-  { 253.4534005286336 , 258.3288144177759 },
-  { 561.2193290713307 , 139.691472810947 },
-  { 637.6248032381158 , 218.81165745019524 },
-  { 95.02569467483687 , 121.84955306084527 },
-  { 463.9044603098406 , 142.50321833578687 },
-  { 109.62157350188085 , 397.3456091939085 },
-  { 911.3487672192243 , 309.6321289994659 },
-  { 859.6955821621682 , 229.86130764694965 },
-  { 549.7222433965214 , 30.30400953939062 },
-  { 221.5338103445968 , 148.35556642752442 },
-  { 455.4015459846498 , 43.115755064230484 },
-  { 361.74888457859157 , 75.13537293385548 },
-  { 862.3671697053975 , 325.98262087592326 },
-  { 295.02569467483687 , 161.83955306084528 },
-  { 59.3782293958565 , 335.59048158320536 },
-  { 62.7255766521609 , 253.10595171160344 },
-  { 694.359273947927 , 381.7920615981318 },
-  { 620.0924383879905 , 622.6086458220012 },
-  { 258.1945115903552 , 477.83187717539255 },
-  { 801.5232558742308 , 49.1464269755448 },
-  { 513.3582479899364 , 550.57419018609306 },
-  { 792.8878398662085 , 529.2925223363049 },
-  { 637.6248032381158 , 419.77338722241456 },
-  { 443.6103527131813 , 501.95231542121246 },
-  { 919.6004296234711 , 379.04169695691934 },
-  { 730.5070350855312 , 113.79692687519392 },
-  { 604.597149517948 , 61.43581320566019 },
-  { 547.3541700821233 , 686.4242145170158 },
-  { 153.4534005286336 , 258.3288144177759 },
-  { 377.00651811130984 , 632.964409508127474 },
-  { 757.9264749622625 , 222.0968781270325 },
-  { 449.8563196345126 , 235.61773947411103 },
-  { 579.3389833651056 , 312.08846754644054 },
-  { 385.3036247867588 , 169.51206760796165 },
-  { 263.1754704167116 , 326.00132896489225 },
-  { 879.8911123727565 , 454.601586698947635 },
-  { 181.52325587423076 , 49.14642697554481 },
-  { 436.4526434836148 , 292.6103182618997 },
-  { 859.2997388872939 , 609.71822482069554 },
-  { 268.8188740011842 , 54.45518819260283 },
-  { 439.2796960445103 , 398.678153817457 },
-  { 742.2315094654197 , 453.76216643371504 },
-  { 658.3250124275382 , 293.06888574885164 },
-  { 289.5310485059665 , 376.9113179006952 },
-  { 468.35271918046305 , 609.1232788469405 },
-  { 556.58622099685 , 452.2934393181623 },
-  { 593.1267033178369 , 526.04542008884505 },
-  { 356.29736337098626 , 493.54503078217067 },
-  { 667.6848217521995 , 151.5343465570064 },
-  { 927.828318368338 , 532.96864587785015 },
-  { 361.1985093213644 , 237.6153182618997 },
-  { 770.6755476175028 , 349.92413471157403 },
-  { 669.1390014149495 , 35.47465664785693 },
-  { 496.29487629108417 , 465.06221486497765 },
-  { 676.3756405474451 , 528.7717226195916 },
-  { 927.3513374866083 , 153.7247131233119 },
-  { 88.30286774174 , 25.240563763837837 },
-  { 144.081910629277 , 194.93605307871252 },
-  { 182.0142834369664 , 340.8016995824853 },
-  { 873.8351200954678 , 94.03991962715078 },
-  { 795.1089801960366 , 133.71581295086438 }
-},
-{ //#18 47
-  { 363.0707949881042 , 371.6217193559716 },
-  { 186.2702165763664 , 278.297509225077 },
-  { 542.8792058733738 , 455.02033615817385 },
-  { 650.0501692991019 , 430.2779696908921 },
-  { 465.1045310106655 , 532.7950110208822 },
-  { 665.3578186736995 , 539.1975545717775 },
-  { 772.9442732784108 , 562.0657614448228 },
-  { 192.9347635605485 , 348.640792500072 },
-  { 475.16008869784014 , 200.86611763736363 },
-  { 654.3209953628461 , 219.9606169245804 },
-  { 462.83623020920226 , 315.55312026582044 },
-  { 406.6370242398392 , 676.55282938734763 },
-  { 283.85245099790177 , 250.90262036617133 },
-  { 233.75729845920455 , 158.65724459785412 },
-  { 872.6290667745719 , 608.5495440536823 },
-  { 22.0517471519051 , 442.8246985657878 },
-  { 848.1305791150651 , 540.2512176811435 },
-  { 706.5607978835156 , 337.2166024079765 },
-  { 177.78740065917333 , 499.2950221451749 },
-  { 630.7211256234756 , 388.82670176168006 },
-  { 392.5332664969229 , 433.3000221451749 },
-  { 176.058027863122 , 594.94032627312106 },
-  { 357.51683960059097 , 512.9583035541327 },
-  { 341.6944871954479 , 145.71866025779707 },
-  { 465.5182708658505 , 403.22355617777106 },
-  { 612.1502805032513 , 505.91237080003935 },
-  { 986.6178459858723 , 713.1562502809862 },
-  { 546.7941136191869 , 135.6537351400598 },
-  { 705.4762031383177 , 761.3726927163168 },
-  { 143.7795953281568 , 190.3235053226396 },
-  { 747.1655750376552 , 378.640792500072 },
-  { 824.9402499003636 , 456.41546736278036 },
-  { 539.7242616990216 , 562.5467684538659 },
-  { 262.8362302092023 , 551.7284647343236 },
-  { 849.9688081265155 , 807.4360816852115 },
-  { 385.5408560238739 , 237.5156017502995 },
-  { 127.6945505576012 , 443.97273989387253 },
-  { 96.0399040585919 , 377.2715918041487 },
-  { 430.4231253259329 , 631.3469825234733 },
-  { 493.9150203902789 , 656.5443565840347 },
-  { 524.3418576619497 , 244.36727766049137 },
-  { 378.7622984592045 , 63.403110435603736 },
-  { 321.2124378356588 , 429.83816179130224 },
-  { 58.95219386908514 , 259.8473695365536 },
-  { 370.14708907456594 , 581.30771127845617 },
-  { 46.7941136191869 , 335.6537351400598 },
-  { 969.7055182201238 , 803.2547836323324 },
-  { 450.6140720763332 , 130.41101088319942 },
-  { 589.71854391767704 , 671.7214511336412 },
-  { 803.2610546256303 , 750.7750458453766 },
-  { 473.7447644679768 , 463.04621063271475 },
-  { 254.54873785086966 , 365.55858260136256 },
-  { 635.1394193861566 , 152.7261652144416 },
-  { 594.9118843147329 , 284.8291136315112 },
-  { 373.774087466576 , 307.06715111924797 },
-  { 744.4780033129477 , 462.7920804049923 },
-  { 557.1114413280887 , 351.2882287834453 },
-  { 902.7916920278905 , 721.9558019458292 },
-  { 928.5025390103077 , 875.2357357961333 },
-  { 254.83232849016377 , 463.5414127836451 },
-  { 533.6689224901179 , 751.96405676814766 },
-  { 829.8046203478896 , 377.81366773872566 },
-  { 698.0649941814179 , 638.2530252766221 },
-  { 743.3562071643275 , 683.0204216136938 }
-},
-{ //#17 48
-  { 547.6773166851901 , 312.0329057997229 },
-  { 543.9192122376415 , 9.996863695727543 },
-  { 291.7612484351877 , 155.18082380410182 },
-  { 551.6660958964906 , 207.426199572419 },
-  { 661.5890929603208 , 211.2647952147271 },
-  { 826.6037233480688 , 49.41375446621512 },
-  { 171.7646292478368 , 270.5138718066705 },
-  { 750.2590017950894 , 411.6997144119996 },
-  { 306.2829641345355 , 5.96187399253019 },
-  { 786.7427844039489 , 501.3845079081607 },
-  { 611.7560874698986 , 471.087177683556 },
-  { 491.0683273881827 , 418.75573273281975 },
-  { 399.51587266687056 , 55.27597634279899 },
-  { 476.6807262842385 , 15.575158823907046 },
-  { 861.9891132351828 , 428.4079910856254 },
-  { 591.2749920786009 , 393.7714051539815 },
-  { 207.7453661956234 , 97.63019690154573 },
-  { 145.8937591205207 , 213.17454864727756 },
-  { 590.1128466341354 , 97.83878344582928 },
-  { 197.2446397610901 , 455.42523805054054 },
-  { 694.6794011597331 , 522.9415563730105 },
-  { 389.2509936483709 , 188.81603950687477 },
-  { 496.0435605776739 , 600.1477831827855 },
-  { 422.4008948800132 , 122.22419668326393 },
-  { 487.0177637799445 , 494.471614343404 },
-  { 446.8247592153441 , 328.91647020516416 },
-  { 400.2949368468477 , 491.0806036404114 },
-  { 220.6783144144074 , 361.3844001326497 },
-  { 741.0059837308083 , 10.58028410429984 },
-  { 317.7941886527093 , 68.23541747196343 },
-  { 704.8445793731164 , 618.50328116813017 },
-  { 922.8382470130733 , 164.3949068613524 },
-  { 814.3301938617029 , 244.77970569256195 },
-  { 635.7500276464882 , 10.574117576797875 },
-  { 563.3361030081292 , 532.68137480615475 },
-  { 309.9000315077278 , 494.53620810264944 },
-  { 652.554440275228 , 305.85178306910348 },
-  { 673.0647225462487 , 388.4321821799958 },
-  { 820.9186568290365 , 594.421658871100945 },
-  { 458.9256350072773 , 224.5248011121262 },
-  { 71.4329558810547 , 288.58744504560724 },
-  { 377.85781870747695 , 581.9003246177264 },
-  { 271.8511656116071 , 272.36408076876097 },
-  { 120.3615417145342 , 77.8812612370414 },
-  { 75.1597858769553 , 172.01949855927066 },
-  { 252.4877326629052 , 204.80116032727375 },
-  { 748.077722169523 , 268.8737758210884 },
-  { 718.2489884542485 , 109.33312994910118 },
-  { 826.8461656116071 , 177.10994660651056 },
-  { 222.491232033373 , 42.63519690154572 },
-  { 821.8244136018586 , 340.44449058472406 },
-  { 807.6544039925975 , 108.58028410429978 },
-  { 891.7976615921101 , 272.36408076876086 },
-  { 94.6413731187595 , 434.53029909639827 },
-  { 606.5989913437699 , 612.914804363262 },
-  { 52.7775693900869 , 58.21330613105816 },
-  { 374.6227711842679 , 390.6167336760313 },
-  { 371.1705838324077 , 258.7892874971262 },
-  { 514.9356496399852 , 124.40694052755194 },
-  { 194.2056180374683 , 527.08769922448204 },
-  { 687.0405849848624 , 687.9278039865362 },
-  { 332.5531405203029 , 342.18197087882209 },
-  { 634.6204431361463 , 170.89072313641145 },
-  { 266.8957290601768 , 411.24319252696144 }
-},
-{ //49
-  { 241.95086636236494 , 198.70451130383725 },
-  { 344.48233234981933 , 312.5495310673206 },
-  { 456.86999443909956 , 181.5584336390739 },
-  { 380.56739331818306 , 115.13437915450004 },
-  { 720.78718337067937 , 116.1371522844013 },
-  { 151.71610929298225 , 376.06368159312717 },
-  { 569.37463086859009 , 43.96374073908765 },
-  { 943.34287540576753 , 409.35195686929035 },
-  { 833.60553108445168 , 363.0851293558112 },
-  { 213.3428754057675 , 299.36195686929034 },
-  { 797.1916176056328 , 532.5365161500239 },
-  { 149.9310324292698 , 21.52539721449045 },
-  { 374.48833744910456 , 2.6233785521272 },
-  { 196.0868005931383 , 471.21693615410504 },
-  { 483.594897767384 , 101.3291816424187 },
-  { 328.7274784058802 , 450.8625195089028 },
-  { 60.792102149654056 , 323.56868159312717 },
-  { 132.76440814380777 , 521.3891746460179 },
-  { 5.51617863455479 , 565.55095385601953 },
-  { 156.38201933937015 , 623.6882877478197 },
-  { 292.57983423335634 , 578.2315943230037 },
-  { 73.1785250013902 , 630.57140049680095 },
-  { 451.15120352795827 , 31.18060528824685 },
-  { 390.60260946022794 , 407.9795719613872 },
-  { 791.24068573925561 , 286.405179078096 },
-  { 30.095996870813888 , 223.1662452645681 },
-  { 607.39123984653128 , 461.5887917618487 },
-  { 623.26021213845198 , 119.80438365201576 },
-  { 428.0888806012177 , 277.5525658783257 },
-  { 9.891940119991133 , 415.3950046456923 },
-  { 528.0828755019324 , 273.4787183935191 },
-  { 490.29863801191829 , 576.45874073908766 },
-  { 688.32151789902628 , 491.51595729020255 },
-  { 770.7511858143998 , 440.4232662008129 },
-  { 586.7925384373261 , 360.51937313607294 },
-  { 145.01190435253517 , 173.67147487925382 },
-  { 388.32914740416294 , 584.00544946402306 },
-  { 701.3830197899784 , 373.66985456714957 },
-  { 493.27067347471132 , 501.0475167523967 },
-  { 122.90942580561152 , 262.6826930272521 },
-  { 470.96718536195743 , 357.8913928827652 },
-  { 285.026324327455 , 376.8980113276256 },
-  { 700.322607940000026 , 36.78208845285997 },
-  { 680.3393134118628 , 312.8549105684179 },
-  { 337.3254374292568 , 213.2804001320632 },
-  { 401.92586724241175 , 479.8602483284196 },
-  { 44.07334065644802 , 514.6649998978646 },
-  { 217.5225499110616 , 412.9217361357861 },
-  { 200.062960446230381 , 90.10520727439787 },
-  { 74.81663125468175 , 18.70778019901252 },
-  { 790.04431990539337 , 166.830558869992 },
-  { 611.763288421708 , 560.79438446470147 },
-  { 239.62858425465487 , 655.11370784812067 },
-  { 110.29437644855022 , 446.0911099245325 },
-  { 276.3169858680611 , 499.3190951531694 },
-  { 627.756171244633634 , 218.31200172709612 },
-  { 200.14815658084166 , 561.04922209174 },
-  { 866.46193740790412 , 462.7375077366479 },
-  { 297.45207401116815 , 61.7775215002244 },
-  { 55.495376689822976 , 121.29489696285121 },
-  { 535.60446218741142 , 197.36860946263286 },
-  { 310.0869564475735 , 139.7601433428921 },
-  { 708.7007379152883 , 226.70221165615425 },
-  { 519.3062672963364 , 440.9463792191344 }
-},
-{ //#7 50
-  { 94.74147428008483 , 420.05253885239904 },
-  { 603.91162549911382 , 46.6481297712668 },
-  { 65.64191121849916 , 301.7335340985863 },
-  { 11.899544751217476 , 408.9044975243143 },
-  { 771.14694844686994 , 99.1727234916473 },
-  { 660.33426184390157 , 120.6531189794716 },
-  { 562.33279105219896 , 147.6670960388998 },
-  { 294.01015885046 , 143.56045753701517 },
-  { 254.59326807997243 , 386.24496864744236 },
-  { 309.6407994353695 , 36.9654825375785 },
-  { 667.6078342438708 , 385.29895689127375 },
-  { 519.2192748737114 , 297.72854489038144 },
-  { 855.2266298082611 , 508.6557482515158 },
-  { 715.1314772695639 , 436.41037248319856 },
-  { 201.26905794907782 , 592.4443902357045 },
-  { 476.6285629443731 , 107.0229092116422 },
-  { 493.5989840403902 , 33.168190849664 },
-  { 125.94246477746613 , 356.01436476339165 },
-  { 783.20246871694684 , 313.0666643747603 },
-  { 200.25333616381312 , 425.46839686276934 },
-  { 577.64044042679654 , 598.74751115801445 },
-  { 256.23639035423736 , 606.1356337566075 },
-  { 273.83145955729714 , 289.75583272115966 },
-  { 412.3253105457967 , 476.38237330806606 },
-  { 264.2360313456644 , 67.9176623770435 },
-  { 716.06970574901207 , 72.8417641677606 },
-  { 7.433865166952884 , 490.04799097753556 },
-  { 109.02368218076063 , 482.5395427744017 },
-  { 588.73511565878812 , 355.9285966846412 },
-  { 352.88542821359425 , 640.4154651608328 },
-  { 235.76852457483815 , 131.67548074350884 },
-  { 573.4504820233767 , 455.50993554478424 },
-  { 144.53721251983833 , 579.0839458012952 },
-  { 402.20520525307296 , 178.90474377850967 },
-  { 177.63203796903503 , 513.0800428520542 },
-  { 835.4533180709993 , 378.1592633523684 },
-  { 695.1190837360217 , 506.18443234915014 },
-  { 495.59994862213136 , 461.44746897724286 },
-  { 85.22817136331405 , 102.1620792554752 },
-  { 381.8006334647057 , 438.76875131969354 },
-  { 453.3662930997039 , 595.6785017889256 },
-  { 517.09703429694054 , 202.0600057056865 },
-  { 60.334261843901615 , 202.81394921770095 },
-  { 698.58006992239295 , 310.1295417885687 },
-  { 415.9111916916115 , 290.55437825293905 },
-  { 181.4886931706128 , 35.026442884152 },
-  { 615.728555681551 , 528.0217127598075 },
-  { 302.9573343442217 , 514.2827361025742 },
-  { 765.48201534931826 , 517.1905636515198 },
-  { 400.8548526634059 , 83.59249893486026 },
-  { 118.61842804103435 , 101.48720526735235 },
-  { 13.002974925826251 , 593.6502142458099 },
-  { 499.9218109241421 , 545.578046567713 },
-  { 865.1314772695639 , 436.41037248319856 },
-  { 331.6359028518343 , 238.114214634208 },
-  { 415.18172207560815 , 357.65841494727573 },
-  { 604.8600423911171 , 259.4571760740698 },
-  { 178.03490646936564 , 271.6713683859848 },
-  { 496.3527853327041 , 365.56737787621324 },
-  { 723.4057256649114 , 191.0747239334685 },
-  { 169.9057166870127 , 193.22768907288602 },
-  { 294.31680017020057 , 436.162385766356 },
-  { 403.43819923033135 , 559.0196994744814 },
-  { 631.6147224286912 , 188.0822604161987 }
-},
-{ //51
-  { 512.7624719935548 , 592.4024566916652 },
-  { 133.1614682025214 , 183.60175267985875 },
-  { 596.735100537557 , 292.90698067213066 },
-  { 645.9978449803483 , 199.20341300915692 },
-  { 656.7901218194181 , 377.82988795474114 },
-  { 751.7288160588438 , 362.11831431655435 },
-  { 285.6564682025214 , 104.52575982318695 },
-  { 203.7084911311115 , 168.34410753695926 },
-  { 539.0701928366707 , 134.61085851578952 },
-  { 179.9001676398872 , 253.4225977155121 },
-  { 184.4910087176163 , 571.4474991503035 },
-  { 258.4830566572077 , 575.93831232527623 },
-  { 696.0925925069996 , 645.1548839320175 },
-  { 494.23898635599977 , 519.4702743771751 },
-  { 449.407063800536 , 68.43331232527623 },
-  { 814.8388618793128 , 315.13417135369883 },
-  { 699.4693501743359 , 291.5832484937349 },
-  { 359.5270905946546 , 118.07411228478699 },
-  { 296.7714830190209 , 480.87700656470196 },
-  { 855.6970605960213 , 370.7300981863516 },
-  { 350.200563584872 , 232.4009223325291 },
-  { 853.3753083377135 , 693.0450961950735 },
-  { 410.9639408087164 , 570.5542637510266 },
-  { 782.7648782815312 , 115.20661254879667 },
-  { 714.4545843870732 , 561.37666292927787 },
-  { 797.485959152277 , 253.9581974709738 },
-  { 615.4744749583633 , 531.15875805508404 },
-  { 798.5156223772434 , 536.34362650469444 },
-  { 394.3875627101716 , 487.0265801377493 },
-  { 886.3931658748614 , 471.1325345149107 },
-  { 180.7369153520257 , 487.9876028969502 },
-  { 325.1076066521817 , 332.8343483359723 },
-  { 710.9780566572077 , 466.8623194686044 },
-  { 611.4330206308658 , 588.3900392255093 },
-  { 737.0944011970969 , 193.56663951579367 },
-  { 683.0205537122903 , 103.57264461507891 },
-  { 546.5555148155688 , 448.7176076447779 },
-  { 855.0908799355491 , 115.04499443515742 },
-  { 813.67377325825 , 445.0336710496478 },
-  { 524.6343144573424 , 362.7537530445427 },
-  { 449.3325752261311 , 271.34783097262385 },
-  { 844.4764519197179 , 210.26791830937094 },
-  { 616.4379754091319 , 473.75161190651676 },
-  { 126.2051129930238 , 629.723902415213615 },
-  { 431.5598066370836 , 343.95219237168857 },
-  { 163.5177146150995 , 368.5699813407711 },
-  { 249.6653051331988 , 296.1183143165543 },
-  { 528.7970812815719 , 219.62633938124398 },
-  { 590.3896357749393 , 65.6986872375664 },
-  { 452.9882038173736 , 441.5857641381455 },
-  { 273.9201509436587 , 237.873876061931 },
-  { 777.1281958778529 , 637.9896626182712 },
-  { 612.5077141139403 , 163.2998479306397925 },
-  { 130.0860644801694 , 299.1534871922795 },
-  { 347.1413849135203 , 411.8470071730382 },
-  { 844.6890339225571 , 592.7561790067837 },
-  { 908.221814293818 , 573.8282511159529 },
-  { 909.780838987434 , 298.9366620303266 },
-  { 950.2113389782857 , 469.5149780857378 },
-  { 316.6415454652463 , 585.3861937153154 },
-  { 246.6456101997876 , 389.32927464063766 },
-  { 735.5155537122903 , 12.648637471750718 },
-  { 312.8298797478351 , 675.93831232527623 },
-  { 953.8794370158512 , 390.7055284318492 }
-},
-{ //52
-  { 275.0301160510876 , 581.63202931006916 },
-  { 504.6426712240249 , 352.98677677721633 },
-  { 242.6396843197859 , 436.28990569283744 },
-  { 646.7913394945846 , 213.51418814391297 },
-  { 340.3672850100107 , 479.81678926482948 },
-  { 166.0282983221734 , 364.6345506901996 },
-  { 721.0304804513602 , 547.7533291006886 },
-  { 451.6380849336067 , 19.14349684375696 },
-  { 86.2480883746698 , 438.63177756029836 },
-  { 962.0913144641335 , 388.67619455725264 },
-  { 670.1303184216972 , 379.57965215325373 },
-  { 114.494094869853 , 290.5430825377906 },
-  { 621.820877861351 , 621.83948832609315 },
-  { 655.7762759605569 , 522.6573259170712 },
-  { 599.3906466898748 , 339.38637518036194 },
-  { 238.5420271811837 , 225.0615567732611 },
-  { 331.4276781411825 , 42.763202388482725 },
-  { 646.7913394945846 , 108.52418814391298 },
-  { 447.04760358095433 , 218.29397827483365 },
-  { 541.8652965658497 , 559.8500899851174 },
-  { 750.5573245047588 , 447.0659232942435 },
-  { 884.9064166309823 , 94.54047240806031 },
-  { 369.5447149254232 , 591.807223386890598 },
-  { 768.7886466780097 , 343.6709573054918 },
-  { 206.55512749813 , 64.51575614769749 },
-  { 144.9542335727709 , 2.6567419558139918 },
-  { 798.2038919966739 , 581.35077659859934 },
-  { 550.7450024600378 , 161.86992379025978 },
-  { 300.2962308145812 , 350.4295969222929 },
-  { 859.691196803333 , 298.66091909554393 },
-  { 257.8521735073579 , 512.59132268734888 },
-  { 784.1125868444358 , 180.00910485491187 },
-  { 543.4482826165661 , 65.95678619236313 },
-  { 942.929191857854 , 164.79249476967684 },
-  { 867.4469749343223 , 379.5796521532538 },
-  { 686.9780931224975 , 24.450377023841476 },
-  { 829.7942833323476 , 515.9455607479568 },
-  { 420.0867519687149 , 298.98393885180286 },
-  { 371.7406610744696 , 380.45399687494734 },
-  { 163.5400648241442 , 206.0773442510822 },
-  { 936.7805566253361 , 453.556903985476914 },
-  { 617.6219688631257 , 442.78134116911366 },
-  { 433.5846040827478 , 424.48597433602777 },
-  { 226.098332941758 , 324.91298041908925 },
-  { 130.5036709978542 , 125.25820238848272 },
-  { 873.1491564598989 , 215.64532840675605 },
-  { 421.6482237619452 , 76.42262997311678 },
-  { 546.8956466898748 , 248.46236803703374 },
-  { 518.9636406068132 , 478.69003601687564 },
-  { 251.0515488542655 , 129.97606843032844 },
-  { 614.3476452551588 , 8.672764498084817 },
-  { 108.7120321761083 , 354.69735119947005 },
-  { 435.11489840694793 , 541.8745952976092 },
-  { 326.9905290290743 , 249.37109971865326 },
-  { 448.44588935823595 , 138.2523125946974 },
-  { 999.2242508647619 , 153.40832763130507 },
-  { 63.1000081389526 , 117.92307628029225 },
-  { 345.823231593805 , 153.97339517030434 },
-  { 66.7590144888429 , 223.13743345798898 },
-  { 769.7541904711472 , 253.87665058000707 },
-  { 680.566613882569 , 281.4259436942106 },
-  { 42.4523528067473 , 40.937151811116095 },
-  { 830.5835422726149 , 127.80999651679187 },
-  { 961.1423456684639 , 285.92434896823954 }
-},
-{ //#20 53
-  { 935.262972774637 , 383.30735009234746 },
-  { 392.15312918837185 , 305.3207815327259 },
-  { 666.6774912725529 , 330.05716598439597 },
-  { 477.1198547926697 , 250.55562748578495 },
-  { 407.1661288116461 , 385.76237517381844 },
-  { 602.4202629738965 , 410.75737517381845 },
-  { 478.41245764288 , 92.78585835128314 },
-  { 301.4369548753904 , 416.0797279401302 },
-  { 467.6077224527387 , 490.77537479709264 },
-  { 17.9315927567703 , 298.0488949793759 },
-  { 85.7716601581044 , 215.03838825067328 },
-  { 851.8649507513951 , 561.4755839865151 },
-  { 702.14288086331703 , 669.1480985336315 },
-  { 419.39128001740806 , 11.9170176446473 },
-  { 101.6620159772074 , 593.8850619055388 },
-  { 197.83216719623636 , 597.289470986671 },
-  { 651.7697982126979 , 23.7209597548323 },
-  { 578.4186218009477 , 574.4212641136255 },
-  { 217.4753758359943 , 34.9082665510613 },
-  { 239.931327422643 , 490.26557054545924 },
-  { 315.6372534105696 , 630.3339411389605 },
-  { 269.5780257616106 , 127.19646850057154 },
-  { 322.90223589250513 , 30.997046912309372 },
-  { 503.4083104451807 , 397.29486840299217 },
-  { 744.6348415407384 , 141.1431824477032 },
-  { 379.5039357273091 , 650.0786963020325 },
-  { 465.6227691178605 , 589.9430907573413 },
-  { 792.6444131122983 , 484.9813249853901 },
-  { 562.9945705899956 , 297.72341355988107 },
-  { 494.9170848147949 , 686.9829789983174 },
-  { 635.6083938550059 , 713.6439568186627 },
-  { 437.4253762414138 , 170.7550322586917 },
-  { 654.1544356269583 , 111.062475513333 },
-  { 767.5784616642097 , 343.8904593218599 },
-  { 54.2167117497461 , 124.05254786399576 },
-  { 891.66981109092217 , 460.892543796403 },
-  { 361.6251809876917 , 530.1338494485987 },
-  { 569.9453605673583 , 641.4488319767665 },
-  { 562.7937325435885 , 505.2007242900596 },
-  { 271.2172837640803 , 562.7383273376194 },
-  { 724.6348415407384 , 566.1531824477032 },
-  { 751.6281923235988 , 59.6318248850392 },
-  { 915.18896095536127 , 200.0946071197312 },
-  { 804.543980974877 , 630.4549330086885 },
-  { 139.73674568596795 , 500.3369562387866 },
-  { 887.5463671035678 , 296.6340473031441 },
-  { 662.6758500996041 , 503.72105492420303 },
-  { 338.79697557318224 , 212.67475280122375 },
-  { 38.985299980495 , 470.30943456689056 },
-  { 372.68603187962174 , 455.5430436960521 },
-  { 566.769220355467 , 147.8880474520288 },
-  { 161.17483758207743 , 273.0586604922019 },
-  { 210.51779320966875 , 324.0672529333559 },
-  { 719.8907419435322 , 431.9578418079253 },
-  { 911.46382065181675 , 91.0233889119246 },
-  { 289.2384955145251 , 323.24871404921623 },
-  { 835.3309495666962 , 164.5197974649717 },
-  { 735.1193976858523 , 240.3944273648654 },
-  { 255.9142853836305 , 227.0492924609541 },
-  { 826.3790400759476 , 270.5662491909653 },
-  { 626.8220298370483 , 234.05119679420432 },
-  { 365.4059648701897 , 105.95192586812689 },
-  { 103.20230432009595 , 324.6503621628684 },
-  { 223.5919430252691 , 688.9560093558752 }
-},
-{ //#20 54
-  { 289.2384955145251 , 323.24871404921623 },
-  { 407.1661288116461 , 385.76237517381844 },
-  { 602.4202629738965 , 440.75737517381845 },
-  { 478.41245764288 , 92.78585835128314 },
-  { 301.4369548753904 , 416.0797279401302 },
-  { 487.6077224527387 , 460.77537479709264 },
-  { 407.9315927567703 , 298.0488949793759 },
-  { 125.7716601581044 , 215.03838825067328 },
-  { 871.8649507513951 , 531.4755839865151 },
-  { 462.14288086331703 , 539.1480985336315 },
-  { 439.39128001740806 , 31.9170176446473 },
-  { 101.6620159772074 , 593.8850619055388 },
-  { 197.83216719623636 , 597.289470986671 },
-  { 651.7697982126979 , 623.7209597548323 },
-  { 578.4186218009477 , 574.4212641136255 },
-  { 217.4753758359943 , 34.9082665510613 },
-  { 239.931327422643 , 490.26557054545924 },
-  { 295.6372534105696 , 630.3339411389605 },
-  { 269.5780257616106 , 127.19646850057154 },
-  { 322.90223589250513 , 30.997046912309372 },
-  { 503.4083104451807 , 357.29486840299217 },
-  { 764.6348415407384 , 666.1431824477032 },
-  { 449.5039357273091 , 650.0786963020325 },
-  { 332.15312918837185 , 245.3207815327259 },
-  { 485.6227691178605 , 589.9430907573413 },
-  { 792.6444131122983 , 484.9813249853901 },
-  { 542.9945705899956 , 287.72341355988107 },
-  { 494.9170848147949 , 686.9829789983174 },
-  { 635.6083938550059 , 703.6439568186627 },
-  { 437.4253762414138 , 170.7550322586917 },
-  { 654.1544356269583 , 139.062475513333 },
-  { 772.5784616642097 , 343.8904593218599 },
-  { 114.2167117497461 , 154.05254786399576 },
-  { 831.66981109092217 , 430.892543796403 },
-  { 361.6251809876917 , 545.1338494485987 },
-  { 569.9453605673583 , 641.4488319767665 },
-  { 562.7937325435885 , 505.2007242900596 },
-  { 271.2172837640803 , 562.7383273376194 },
-  { 724.6348415407384 , 566.1531824477032 },
-  { 581.6281923235988 , 59.6318248850392 },
-  { 735.262972774637 , 383.30735009234746 },
-  { 215.18896095536127 , 400.0946071197312 },
-  { 734.543980974877 , 610.4549330086885 },
-  { 139.73674568596795 , 500.3369562387866 },
-  { 657.5463671035678 , 296.6340473031441 },
-  { 662.6758500996041 , 503.72105492420303 },
-  { 342.79697557318224 , 172.67475280122375 },
-  { 58.985299980495 , 470.30943456689056 },
-  { 372.68603187962174 , 455.5430436960521 },
-  { 586.769220355467 , 147.8880474520288 },
-  { 161.17483758207743 , 273.0586604922019 },
-  { 210.51779320966875 , 324.0672529333559 },
-  { 719.8907419435322 , 437.9578418079253 },
-  { 111.46382065181675 , 401.0233889119246 },
-  { 315.3309495666962 , 724.5197974649717 },
-  { 105.1193976858523 , 640.3944273648654 },
-  { 235.9142853836305 , 227.0492924609541 },
-  { 826.3790400759476 , 290.5662491909653 },
-  { 616.8220298370483 , 234.05119679420432 },
-  { 365.4059648701897 , 105.95192586812689 },
-  { 103.20230432009595 , 324.6503621628684 },
-  { 373.5919430252691 , 638.9560093558752 },
-  { 586.6774912725529 , 370.05716598439597 },
-  { 477.1198547926697 , 250.55562748578495 }
-},
-{ //#38 55
-  { 265.12622077556784 , 378.1656562706132 },
-  { 621.1346699399435 , 389.84971054356828 },
-  { 609.3408967497185 , 278.48555112562747 },
-  { 257.16993332399045 , 253.22791759290914 },
-  { 34.5482153352322 , 406.98150367052295 },
-  { 349.0673504491225 , 32.24454029861573 },
-  { 319.3303870772153 , 542.7254051847254 },
-  { 529.6039333778112 , 338.9664160117371 },
-  { 465.31811350480103 , 422.2432261079824 },
-  { 170.7676087174012 , 541.4894182386505 },
-  { 230.1477655682372 , 66.93689092401813 },
-  { 241.57026477431333 , 471.63200357017212 },
-  { 570.6906057812316 , 665.3280138809586 },
-  { 486.4107743770063 , 628.67897602160173 },
-  { 845.2667720373846 , 515.56875042951035 },
-  { 59.54821533523216 , 697.507576926708474 },
-  { 135.9536895020173 , 96.62776156595669 },
-  { 831.5089536709193 , 393.1012436586841 },
-  { 124.4501588295163 , 459.26660131405583 },
-  { 480.6976881099605 , 191.86675556123717 },
-  { 349.8434526022123 , 213.25538052535632 },
-  { 986.73355315844714 , 355.93990410325918 },
-  { 978.63609951429794 , 710.904301158893375 },
-  { 846.9938836065187 , 725.994464911174518 },
-  { 531.1813485725863 , 71.91796339553942 },
-  { 419.83433089594155 , 531.9280196041435 },
-  { 363.943015663798 , 311.57438527916906 },
-  { 730.17084184388364 , 390.0778959942053 },
-  { 403.84724949447536 , 639.8971935115521 },
-  { 170.3312285518579 , 194.20140474900057 },
-  { 166.43234248962506 , 370.4802206007945 },
-  { 95.7340579405612 , 598.4871311232704 },
-  { 691.519460399622 , 14.941311060018194 },
-  { 519.1111409921867 , 543.6421997311332 },
-  { 806.50592691570347 , 646.43360025328454 },
-  { 615.8522407589641 , 479.21090734650514 },
-  { 877.4959772221572 , 116.18763989125209 },
-  { 650.6906057812316 , 187.65082259634244 },
-  { 970.55568969833473 , 160.87754914914484 },
-  { 938.1869221618907 , 257.334037191698858 },
-  { 362.9317948750985 , 416.18109150647297 },
-  { 46.128858269127 , 210.06875782642157 },
-  { 641.5040537134666 , 103.02483581113543 },
-  { 847.9050213662892 , 193.22949759055209 },
-  { 140.46297207207607 , 0.45310831515861594 },
-  { 934.6856705128667 , 619.99482637935199 },
-  { 31.831609664163 , 104.18087971591183 },
-  { 659.3992757603737 , 561.34678522680329 },
-  { 753.13708180977466 , 565.65895185231096 },
-  { 232.14396731826332 , 619.552671376744275 },
-  { 152.65871400474157 , 283.92347463707864 },
-  { 778.7423060533911 , 73.21112306871677 },
-  { 10.60430942221484 , 306.4590216183949 },
-  { 588.0150408762722 , 5.1375816249815 },
-  { 445.3317728999016 , 18.123146518077604 },
-  { 706.9166379215321 , 296.3450398618894 },
-  { 926.1672089757989 , 433.8877551833231 },
-  { 446.0218919959057 , 277.58511418721315 },
-  { 304.98889234203 , 688.1136359468827 },
-  { 298.1242823907724 , 133.18321975525203 },
-  { 750.7073059308127 , 170.4067213073072 },
-  { 856.0867891405611 , 299.74944894302155 },
-  { 430.366464024307 , 122.71571298442578 },
-  { 948.8644474307954 , 533.830251075251724 }
-}
-};
@@ -1,5323 +0,0 @@
-using namespace std;
-
-/*struct coordinates {
-	double X;
-	double Y;
-};
-
-template <typename T, int N> char (&array(T(&)[N]))[N];
-*/
-struct coordinates n_eq_81[64][81] = {
-{ //#1
-  { 269.2344226765896 , 239.67837775611548 },
-  { 15.27204858640056 , 29.3421224748663 },
-  { 122.05309877482898 , 17.86383817421404 },
-  { 229.35972082065211 , 24.2435891235201 },
-  { 737.95304383258781 , 45.2425594132806 },
-  { 499.62301072704369 , 88.6219538790916 },
-  { 553.1370039409621 , 243.08459561082685 },
-  { 632.346200630798393 , 3.3361340060814 },
-  { 833.6822177688435 , 244.9252066469688 },
-  { 846.79397415277168 , 363.8795874118099 },
-  { 957.28826937510009 , 229.6916225752172 },
-  { 846.03099412695951 , 686.81991661494095 },
-  { 899.41678391726867 , 279.98611329703243 },
-  { 747.06728381691778 , 191.00233408573195 },
-  { 651.1388115364407 , 293.0190106771796 },
-  { 553.3094654504524 , 162.5348273149057 },
-  { 165.60727412891282 , 205.59205951363143 },
-  { 736.34834689327127 , 271.0907426786853 },
-  { 650.91167880367044 , 165.3099207481185 },
-  { 823.47275798370282 , 111.88214944648364 },
-  { 663.29689178633896 , 359.2126450736734 },
-  { 283.62681821676415 , 556.80565337865002 },
-  { 129.6630592893931 , 401.0649494079631 },
-  { 215.910212545695 , 133.47895616785337 },
-  { 160.29962475431523 , 569.51164439451674 },
-  { 235.16896212939474 , 320.24600099335125 },
-  { 34.88604735513644 , 308.14108899298196 },
-  { 251.53093752467896 , 464.36045229791955 },
-  { 466.30118797363392 , 507.66079648262576 },
-  { 19.673059289393095 , 401.0649494079631 },
-  { 76.74891697646744 , 558.80850194896203 },
-  { 841.17324917378775 , 4.9980912817437 },
-  { 100.55179251923708 , 742.34709418263617 },
-  { 36.8792860991681 , 509.7007899900223 },
-  { 715.32957022769804 , 649.02142254701076 },
-  { 499.3559921530198 , 6.488300612338218 },
-  { 117.87297646010083 , 640.92761851679995 },
-  { 724.07586283634225 , 559.8861216199174 },
-  { 447.84543256808047 , 580.47820595024166 },
-  { 986.85955908641893 , 325.8777798163313 },
-  { 10.14908398322919 , 588.6219538790916 },
-  { 319.8405857067618 , 159.50662575161286 },
-  { 530.1900439499203 , 380.1279940272102 },
-  { 937.57243458835046 , 125.3466577647836 },
-  { 397.16696042156536 , 3.22647312553539 },
-  { 93.85381798065046 , 505.062537538132 },
-  { 529.86972397981137 , 636.0806218291249 },
-  { 56.21981085735644 , 209.09497383882226 },
-  { 142.0722838169178 , 296.25646824798235 },
-  { 445.16092145765326 , 430.06131517975405 },
-  { 805.550549336250825 , 565.9528024838722 },
-  { 401.270459069035 , 384.8203446526126 },
-  { 338.8535031911118 , 460.731121728774 },
-  { 306.03302360985543 , 636.5269834524509 },
-  { 32.23103164605595 , 114.48826761151832 },
-  { 704.3133494389985 , 464.37092264736161 },
-  { 389.5537123805343 , 524.9883500274303 },
-  { 449.32068623915194 , 307.14153354220963 },
-  { 180.1849848557642 , 470.6024143449067 },
-  { 360.7102663795518 , 283.43275053236465 },
-  { 214.55786845941077 , 387.6189325711116 },
-  { 537.39423223961847 , 472.38438642140437 },
-  { 626.81450191011468 , 560.80669435348346 },
-  { 53.56560116385515 , 637.12724380959855 },
-  { 445.2449491354668 , 235.06872765286164 },
-  { 897.62259414530024 , 593.33421718101852 },
-  { 769.94602228668208 , 382.82924203294385 },
-  { 637.06728381691778 , 84.06732054407948 },
-  { 218.69494636316438 , 620.49352616228522 },
-  { 922.68082918992494 , 422.8684357547588 },
-  { 558.95823626955595 , 324.8718909178568 },
-  { 398.5670989831707 , 649.7057907406337 },
-  { 213.81745733023646 , 692.633258580576 },
-  { 938.31158758492383 , 41.41923108192708 },
-  { 121.04187798612944 , 104.25713194691009 },
-  { 330.5500363998687 , 67.38870454993256 },
-  { 910.99670053044751 , 519.3199132173819 },
-  { 624.1230217559796 , 433.3160678159769 },
-  { 831.32769789390977 , 471.982904952696785 },
-  { 315.96412537180066 , 377.28399649294204 },
-  { 427.0115491324898 , 134.7642592843311 }
-},
-{ //#2
-  { 475.94066462562273 , 83.08185785633614 },
-  { 402.34298923221195 , 664.82035721059475 },
-  { 112.2444558808657 , 671.73268497634322 },
-  { 427.0853556994937 , 271.99132063632277 },
-  { 73.50595652660712 , 175.33036036975403 },
-  { 503.58931806344583 , 207.79687403312997 },
-  { 584.576505207682 , 440.28808466611113 },
-  { 105.0871632949722 , 242.05690556997 },
-  { 340.41205291029036 , 339.7079263073919 },
-  { 368.89349374022254 , 7.452853572117888 },
-  { 476.9900506029707 , 7.41987779306581 },
-  { 565.0949455161932 , 516.6110314278009 },
-  { 262.6940721519604 , 20.77706370301251 },
-  { 421.3289238723323 , 381.83058316397836 },
-  { 674.6750385590282 , 363.3757569003627 },
-  { 386.8915172516245 , 580.5075500273174 },
-  { 31.405926808502 , 385.6691788062864 },
-  { 659.3747769204185 , 139.96199356844401 },
-  { 529.9647644543916 , 399.03680997375335 },
-  { 152.4911691336333 , 589.19135292637648 },
-  { 64.8959056100537 , 43.26209488086058 },
-  { 549.4517798565882 , 593.80058921075206 },
-  { 162.85480962430483 , 66.5334955301739 },
-  { 240.3933096112805 , 589.45054982893845 },
-  { 406.51228930461286 , 110.80964493235994 },
-  { 357.0128848329811 , 158.41030273794814 },
-  { 586.5927907477196 , 130.87106296464094 },
-  { 5.77594076238046 , 135.71059448938655 },
-  { 301.20616571602955 , 91.07313207109763 },
-  { 551.7883223157072 , 37.09378669539869 },
-  { 951.7783223157072 , 27.09378669539869 },
-  { 735.8228340389159 , 7.31156784357581 },
-  { 869.5026118373577 , 589.273315669560091 },
-  { 614.4779718563358 , 363.37575690036275 },
-  { 757.0324564779576 , 92.08878669539868 },
-  { 767.6937816742313 , 379.06155663002967 },
-  { 474.65313400322685 , 485.6311615757162 },
-  { 476.9900506029707 , 687.4098777930658 },
-  { 464.44357895081356 , 592.46932112789253 },
-  { 707.05563553661796 , 689.40807019758722 },
-  { 232.0930481564776 , 320.60836324580623 },
-  { 241.3013182547267 , 233.31850783941482 },
-  { 421.73037193473016 , 184.43811000557972 },
-  { 122.70558488492124 , 332.10544892061546 },
-  { 742.4718718982728 , 271.59139924780112 },
-  { 661.0804675716341 , 464.48253126930382 },
-  { 524.576399464912 , 315.76604794053856 },
-  { 874.7698105286605 , 716.32773163371432 },
-  { 974.1656488388917 , 484.79680658077623 },
-  { 597.4224309690769 , 226.33310131587893 },
-  { 211.7359164407203 , 632.41487779306578 },
-  { 165.1544193775721 , 446.87888973311993 },
-  { 845.4684565369397 , 1.2868817673212902 },
-  { 216.1856272324006 , 511.87334320925083 },
-  { 654.6357399649626 , 31.6426254082983 },
-  { 254.04065222963385 , 128.03912298292136 },
-  { 780.7051469187964 , 567.2596830110294 },
-  { 516.0394147479184 , 154.05857009723633 },
-  { 896.8842111091542 , 316.45022899471473 },
-  { 553.7153394883311 , 680.85653271904448 },
-  { 863.15622697305065 , 396.9444746667672 },
-  { 975.3983096112804 , 274.19641566668804 },
-  { 801.6825608855318 , 183.66826285733362 },
-  { 65.4562148256638 , 492.17152210732365 },
-  { 794.7722412076871 , 676.08137298679057 },
-  { 644.008588655327 , 575.04565149870248 },
-  { 4.72154002917443 , 273.2150194280183 },
-  { 299.34132587888485 , 646.06727846507823 },
-  { 926.913047666801 , 191.24847343537388 },
-  { 349.99831305510526 , 449.279381150503 },
-  { 168.0873659246565 , 164.76584291431298 },
-  { 878.1382410473095 , 514.15337714732436 },
-  { 632.8954042187247 , 296.6664848789528 },
-  { 345.32489776794506 , 263.558294644828 },
-  { 764.6824262950162 , 468.8815784493293 },
-  { 327.13010618205993 , 556.8658357552143 },
-  { 250.73882842811827 , 412.91852758167227 },
-  { 948.336663409985 , 108.87333637203255 },
-  { 866.7545263660356 , 99.76130124251502 },
-  { 710.548673869098 , 191.7735801915598 },
-  { 818.8773460650578 , 270.71158388704936 }
-},
-{ //#3
-  { 24.5660704427044 , 495.4351363553407 },
-  { 603.68625508195264 , 571.8406105221259 },
-  { 775.40043520894242 , 498.5638004258806 },
-  { 714.56607044270438 , 385.4451363553407 },
-  { 812.40799019280614 , 581.6287707518345 },
-  { 363.98296121319188 , 282.76062524491346 },
-  { 26.36416564880158 , 386.11741660515554 },
-  { 892.45046798401813 , 299.00280687844804 },
-  { 18.809638615542937 , 275.6058738276851 },
-  { 8.432120919702228 , 596.8356105221259 },
-  { 564.53881255179863 , 305.92322659399684 },
-  { 751.51979315395377 , 716.9341438734721 },
-  { 845.11746854736458 , 798.6726432277306 },
-  { 495.466507381118735 , 387.11613160152797 },
-  { 3.803187482884624 , 803.6074466626754 },
-  { 464.37005816805491 , 279.02955888819656 },
-  { 212.30196596700463 , 301.86018830649914 },
-  { 132.88507519651716 , 514.5346994169264 },
-  { 254.28761976639356 , 812.0770523088628 },
-  { 428.15419080778028 , 604.5081250692422 },
-  { 884.64998552181179 , 479.39422670140084 },
-  { 857.12739761377917 , 707.4080250744132 },
-  { 111.42464061525655 , 604.6887681051548 },
-  { 876.875310659103405 , 201.6195518386925 },
-  { 664.1915477574755 , 660.4871279042799 },
-  { 351.60310865596637 , 851.4939430793504 },
-  { 391.045848037160305 , 375.2289804764587 },
-  { 768.73490178292104 , 909.0803976840617 },
-  { 329.994182001891396 , 178.15391901760952 },
-  { 350.16603267640855 , 502.63445464324377 },
-  { 369.16692132156615 , 104.9185890473673 },
-  { 159.3610367202032 , 908.5119057553862 },
-  { 41.114754340146476 , 175.1741706402022 },
-  { 652.4399262507187274 , 228.8640936995906 },
-  { 457.12739761377918 , 877.3980250744132 },
-  { 44.47767348426467 , 1029.7806068734842 },
-  { 613.37464232599571 , 854.0211865178605 },
-  { 153.32681920204132 , 654.0838149435186 },
-  { 252.973154945809 , 259.3945896720587 },
-  { 265.7847054412028 , 921.4645155804192 },
-  { 168.57416431057663 , 794.8368295112231 },
-  { 591.42370546201919 , 464.21359379994146 },
-  { 860.96599325608727 , 907.3210221382435 },
-  { 238.31318675570415 , 159.05435595602376 },
-  { 620.84058561683239 , 754.7669593085052 },
-  { 357.64441112663565 , 774.4582567444725 },
-  { 212.83407421843376 , 711.9993404385273 },
-  { 492.5384596020649 , 465.776421465339 },
-  { 91.79325841647 , 702.4732216394685 },
-  { 189.89902946319418 , 85.90854324929231 },
-  { 28.545553950166326 , 696.4364832369474 },
-  { 607.43427731574967 , 387.84868175062945 },
-  { 314.6678943041004 , 673.2119279132386 },
-  { 564.156667983012326 , 667.4882240246508 },
-  { 465.09198469588984 , 768.8061326580926 },
-  { 677.65107073127385 , 141.3573262214736 },
-  { 120.76549203096653 , 332.1209262244461 },
-  { 412.43402221200563 , 691.1571629285991 },
-  { 752.26294812161785 , 793.5484991253743 },
-  { 58.32098114992145 , 66.53833005814299 },
-  { 499.14124628632572 , 538.0154653159516 },
-  { 230.59385668104818 , 477.6180028810736 },
-  { 795.21874831112639 , 305.59842888859123 },
-  { 150.56635691823863 , 6.6334825968401745 },
-  { 685.1417453749567 , 469.4370245308993 },
-  { 76.22696067536486 , 905.717029828226 },
-  { 122.5635872370637 , 439.4416267360501 },
-  { 131.91865654333225 , 148.27682941240158 },
-  { 687.6231270502813 , 307.537803930836 },
-  { 907.54258726523959 , 394.1888075241068 },
-  { 806.60810865596632 , 406.2398089171 },
-  { 241.3476376790869 , 620.8501724628468 },
-  { 216.04444000454606 , 397.10906919932586 },
-  { 330.808252076239 , 35.9776295845145 },
-  { 114.71242973355723 , 256.91266999446077 },
-  { 10.53271175248761 , 900.9033177808806 },
-  { 239.12725683005178 , 543.0022061877527 },
-  { 437.98885373244514 , 175.67276752795448 },
-  { 318.29276117331938 , 409.12427396973834 },
-  { 337.98561398249717 , 591.2186486230833 },
-  { 112.97333870191362 , 817.0118557438076 }
-},
-{ //#4
-  { 447.97106604817264 , 376.4212465360359 },
-  { 326.78522344284363 , 74.91561908328845 },
-  { 814.3765402149577 , 277.3010618967876 },
-  { 434.1324704058646 , 466.3442435998662 },
-  { 579.0270401146067 , 188.3172826854871 },
-  { 237.21376859973253 , 30.5018792281034 },
-  { 180.56473074037567 , 178.7817106323287 },
-  { 639.6306743772082 , 332.2960618967876 },
-  { 539.3164305142388 , 434.18627979741245 },
-  { 571.3545255674904 , 98.03935257356517 },
-  { 488.92850676326054 , 121.40495491973869 },
-  { 132.1454670885108 , 788.9286462646941 },
-  { 135.9901138843717 , 697.6242257458521 },
-  { 424.27800686361144 , 820.38873413103914 },
-  { 954.0000767516894 , 348.0612486781555 },
-  { 401.0865870131588 , 117.59858931623245 },
-  { 386.94755459945964 , 292.60793412955485 },
-  { 520.5379445726497 , 545.4644282391145 },
-  { 407.07178005383645 , 211.75289354897996 },
-  { 415.4150613702859 , 698.85011576308943 },
-  { 512.4575347566865 , 655.4376762293659 },
-  { 94.4930282095625 , 188.2367624742957 },
-  { 942.1187150787623 , 245.8482364487309 },
-  { 238.81604953543507 , 273.9285376818223 },
-  { 471.72227995348555 , 320.73667276028044 },
-  { 834.0656616853367 , 716.06305627363406 },
-  { 363.9914502526186 , 603.55145966534764 },
-  { 88.42240063366376 , 612.0310248218418 },
-  { 618.1243991773609 , 568.3326351121598 },
-  { 908.8080281526184 , 638.89209284790604 },
-  { 648.7718527305279 , 761.23132019869917 },
-  { 916.6069066302318 , 739.21501972626083 },
-  { 559.3249418885373 , 769.4840770307901 },
-  { 899.79141184955256 , 138.052493723949 },
-  { 752.6008543987243 , 341.01586939610036 },
-  { 70.64173367654533 , 454.94311499002066 },
-  { 297.9415357475541 , 347.2940614499346 },
-  { 7.37609975634854 , 302.1941942743698 },
-  { 919.4751135032772 , 446.8014743309721 },
-  { 181.60982272566005 , 582.5643782638815 },
-  { 632.9226172819481 , 651.2225763850487 },
-  { 289.2005713224349 , 645.9879374421037 },
-  { 654.0400397378809 , 107.87568904439449 },
-  { 390.6004395496261 , 10.27428659844446 },
-  { 332.4679027619829 , 229.50687922810334 },
-  { 100.9330546971072 , 536.26893615927963 },
-  { 665.0455460118029 , 253.05749372394894 },
-  { 369.6421649635274 , 491.0009370653779 },
-  { 345.5925421916792 , 401.05255142681517 },
-  { 319.70774989717466 , 822.99912946989934 },
-  { 322.97531586948185 , 725.5242371835619 },
-  { 874.7113169277325 , 335.65814813795544 },
-  { 565.6226310334746 , 297.48743390451614 },
-  { 451.90769788288287 , 551.2470163820084 },
-  { 82.21857641250386 , 22.48502200516185 },
-  { 532.4417523958384 , 695.959539756956 },
-  { 787.7169391916255 , 447.2494282518395 },
-  { 159.4518589232062 , 277.38041815550724 },
-  { 174.69158864592134 , 341.61108504485736 },
-  { 939.6388661877109 , 57.24924569538507 },
-  { 203.1590954167476 , 447.85326667839195 },
-  { 82.56292314489706 , 348.847295565976 },
-  { 587.6663853050638 , 387.1085352832367 },
-  { 274.9301432238584 , 146.5993679670788 },
-  { 497.0437384163243 , 33.12307865759624 },
-  { 700.5238223467404 , 8.190895548233385 },
-  { 238.5032888017507 , 712.0768651629794 },
-  { 693.9416357872874 , 618.3878708429304 },
-  { 254.01820226236714 , 405.4710498493844 },
-  { 623.3785589578318 , 467.2425409873987 },
-  { 281.479805624286 , 543.3231939942133 },
-  { 790.6414138097351 , 34.8615780118548 },
-  { 514.3895752088185 , 845.3943551562469 },
-  { 696.8098426603327 , 385.97432544764166 },
-  { 757.1944981285939 , 554.9568113432563 },
-  { 716.9181526098225 , 177.14154201169646 },
-  { 797.3236294533808 , 151.98846672543425 },
-  { 780.7184167459048 , 791.02298236954675 },
-  { 815.7921043531205 , 630.110747860444 },
-  { 486.3870027684204 , 228.88234250492 },
-  { 46.86840727597325 , 112.8126951196717 }
-},
-{ //#5
-  { 418.2420211682191 , 372.00205087962405 },
-  { 526.2111950756276 , 392.98913228109024 },
-  { 41.3224309841823 , 481.97529886987553 },
-  { 600.6166692424126 , 313.86894764184194 },
-  { 709.3394961755095 , 340.4779369388494 },
-  { 222.64342125216115 , 751.94935745780515 },
-  { 391.63303187121164 , 478.7248778127209 },
-  { 522.9607740184729 , 20.22018352154947 },
-  { 690.4585889925144 , 380.06258203833573 },
-  { 192.77740671475703 , 688.1125158146806 },
-  { 577.9557740184729 , 110.96604935929908 },
-  { 483.54388324798526 , 103.53567241112226 },
-  { 45.2989478067175 , 700.7289700386416 },
-  { 118.7035457198165 , 76.92039271097195 },
-  { 541.1110417896653 , 805.054790247171 },
-  { 601.015889250968 , 497.3001660154882 },
-  { 124.2302429118267 , 351.78615307127404 },
-  { 620.7465806221655 , 669.0995972161468 },
-  { 51.4843770740771 , 596.791153071274 },
-  { 282.46288065218266 , 465.3204687315887 },
-  { 108.35325707677373 , 472.9623802713417 },
-  { 10.62252514250895 , 550.8848104113868 },
-  { 5.4499212618734 , 417.83458570275866 },
-  { 314.30724584799634 , 375.6247487135821 },
-  { 341.8365470014339 , 292.88186624037587 },
-  { 316.0257716238901 , 612.6844501594197 },
-  { 801.5848719438267 , 400.3827844001522 },
-  { 815.0686701117651 , 310.1605841725376 },
-  { 496.9177433711078 , 484.0857613988836 },
-  { 172.8766205073677 , 395.7490138884776 },
-  { 113.8543303430056 , 628.6644344837297 },
-  { 496.0166960309274 , 294.2273760169157 },
-  { 439.45319658386245 , 211.91309422641845 },
-  { 560.6671959305764 , 205.2435968056152 },
-  { 442.2526846372199 , 756.83834781184044 },
-  { 165.47338738088536 , 537.4804013302546 },
-  { 601.015889250968 , 497.3001660154882 },
-  { 653.9440060268217 , 263.5294166786254 },
-  { 288.5508140208349 , 64.78548618592652 },
-  { 512.0113900188115 , 209.77785404465686 },
-  { 362.7246154590792 , 20.60031046594503 },
-  { 857.7309689378721 , 746.05729762341207 },
-  { 698.1312949895214 , 548.9373432063082 },
-  { 713.8223412805312 , 35.13710099507284 },
-  { 358.79869825851364 , 164.67501694265476 },
-  { 518.5100743160519 , 695.13711521191715 },
-  { 889.4954544074621 , 561.7311163965333 },
-  { 208.1416602563993 , 595.6217737832941 },
-  { 925.0586701117651 , 310.1605841725376 },
-  { 621.7860422243679 , 8.34545657025114 },
-  { 925.12089151026515 , 24.25189320712914 },
-  { 403.8049481830853 , 80.7804861859265 },
-  { 322.81103557372046 , 707.74720629299895 },
-  { 667.3900228636733 , 178.63460750860773 },
-  { 728.1307852596644 , 472.9623802713417 },
-  { 751.3723023691828 , 237.91691141336224 },
-  { 603.1437848829386 , 422.5207866302491 },
-  { 870.0636701117651 , 405.414718334788 },
-  { 403.8049481830853 , 610.77048618592653 },
-  { 27.46738716042285 , 331.3005196553675 },
-  { 816.08784566996576 , 31.03302616600917 },
-  { 250.65070439610489 , 231.37623878762844 },
-  { 413.537217185148 , 535.1203440737955 },
-  { 194.001666536748 , 117.09640738340312 },
-  { 511.77412209049385 , 581.7575675873927 },
-  { 843.3201707575065 , 236.5629087791268 },
-  { 250.6507043961049 , 354.3874936931233 },
-  { 856.6592610306329 , 136.24456711575897 },
-  { 933.1513423460166 , 495.5132516861342 },
-  { 288.5832538974919 , 520.60877416002 },
-  { 395.53583114481773 , 249.49041264500846 },
-  { 188.6193922087113 , 285.04880469905515 },
-  { 156.37087299187954 , 174.7272009282716 },
-  { 625.4889470894473 , 111.92863379041876 },
-  { 804.3577458820068 , 673.1008715217365 },
-  { 696.1790951981291 , 757.5172329364469 },
-  { 713.1614616365636 , 112.20656390234069 },
-  { 707.4694075552624 , 655.7085865131542 },
-  { 276.54779697638605 , 131.32727166511603 },
-  { 57.51251583943416 , 222.9436433636022 },
-  { 592.7812851593136 , 591.9461594826422 }
-},
-{ //#6
-  { 560.6726446086671 , 96.78889262935024 },
-  { 852.1697302834763 , 506.17635590090663 },
-  { 737.3536903918506 , 53.3343197033604 },
-  { 796.67505647849828 , 432.59813393809293 },
-  { 637.3536903918506 , 278.3343197033604 },
-  { 182.6862772671978 , 27.991427710789 },
-  { 477.50231715882353 , 36.1493915132429 },
-  { 414.48548351880527 , 645.9207743080717 },
-  { 472.7713033918154 , 552.6439642118264 },
-  { 294.1888619998075 , 297.10409913318915 },
-  { 578.4154512034535 , 358.30878047710075 },
-  { 622.67083701318853 , 446.723307695703 },
-  { 29.285874723492874 , 261.29103436079754 },
-  { 780.68808486267636 , 177.9258427771418 },
-  { 684.67328058455155 , 184.89175798052463 },
-  { 814.35183225937578 , 257.6237446341173 },
-  { 522.7057184581681 , 650.645771807305 },
-  { 270.73822954231434 , 494.7907002248288 },
-  { 111.491096370124 , 400.44017013563916 },
-  { 728.4341055109653 , 523.0266703287627 },
-  { 240.20008278850702 , 192.49739290588522 },
-  { 328.7178498097914 , 555.5405465131354 },
-  { 608.83313672839654 , 518.7917683345867 },
-  { 133.8925809507968 , 295.279813572098 },
-  { 55.01612268013275 , 20.33942910343146 },
-  { 612.8042518095143 , 587.5580995730534 },
-  { 810.43229791548674 , 572.9610853951156 },
-  { 98.4893985602897 , 468.11856542065146 },
-  { 378.3246841470256 , 471.92249335178343 },
-  { 317.1653788223427 , 195.8577703019552 },
-  { 94.65080291798165 , 578.0415624844818 },
-  { 713.83889866064057 , 379.134786209351 },
-  { 352.48708304978805 , 611.9055298371624 },
-  { 506.7308592871225 , 725.8256217693745 },
-  { 399.55989586139447 , 730.5679882366562 },
-  { 1.4875909648111332 , 458.0529804870042 },
-  { 467.68378731325424 , 312.7318253818587 },
-  { 206.21130357720656 , 297.10409913318915 },
-  { 783.7565080463813 , 669.1605069833777 },
-  { 161.81864466142903 , 479.4830508502312 },
-  { 22.1103097952997 , 525.4007576315942 },
-  { 889.9736357165795 , 620.9965333935452 },
-  { 574.9954578409707 , 194.09049103540633 },
-  { 69.2420810511477 , 184.2635927833985 },
-  { 759.49586632256816 , 313.6164298516984 },
-  { 334.47991419273234 , 115.84835504652833 },
-  { 719.5270787426111 , 614.1670888700609 },
-  { 62.680157251547065 , 692.1161535508203 },
-  { 222.98867587353573 , 585.8578992794472 },
-  { 266.55028123660634 , 777.7963475654369 },
-  { 210.90029197792944 , 108.24016460722882 },
-  { 396.38462511086203 , 379.29586187856694 },
-  { 36.296832273553804 , 622.0505686171731 },
-  { 291.3950888095825 , 405.73993971524834 },
-  { 357.3481210657776 , 28.261900441817033 },
-  { 504.1702770149664 , 149.4369916992122 },
-  { 714.51270773144992 , 462.9878374048641 },
-  { 91.21434116400616 , 95.4349769743447 },
-  { 8.16310879153511 , 182.9353646210888 },
-  { 510.76498155206286 , 492.871110040792 },
-  { 631.6386664807287 , 18.47169547101606 },
-  { 824.7522555556163 , 13.8469434216425 },
-  { 893.30912116661074 , 307.6855311707496 },
-  { 375.84806293910316 , 829.5201623086895 },
-  { 323.29964091347625 , 707.4264017608192 },
-  { 200.03231107036544 , 405.9713510437598 },
-  { 137.51039157288352 , 655.0768490910189 },
-  { 176.18705440432902 , 546.4081011918641 },
-  { 141.6486664807287 , 186.47169547101606 },
-  { 661.46519074148532 , 108.6138817421356 },
-  { 491.0091952574528 , 422.5056025812958 },
-  { 424.3363422480707 , 220.6001367692369 },
-  { 475.85806293910315 , 829.5201623086895 },
-  { 15.881465642360716 , 370.4611855798265 },
-  { 213.22607110571172 , 873.995769153699 },
-  { 109.8750542363675 , 829.5500661618134 },
-  { 887.21447389183305 , 392.70027095969914 },
-  { 128.83313672839654 , 758.7817683345867 },
-  { 252.38854969844186 , 674.993202071414 },
-  { 416.0672723445503 , 115.0250358148226 },
-  { 259.0437891670855 , 4.7787069835887 }
-},
-{ //#7
-  { 333.69964258877616 , 471.40311438164343 },
-  { 442.86979380780514 , 457.9987053005112 },
-  { 8.2207559484483 , 552.2785367047366 },
-  { 374.72367027363913 , 661.6659999762929 },
-  { 231.7186904249752 , 430.20013517182724 },
-  { 636.1466039040504 , 469.71288542750085 },
-  { 645.985866431706 , 405.46931725466226 },
-  { 312.6230805550375 , 834.0170360589951 },
-  { 834.94597142001004 , 628.42659755910813 },
-  { 266.25616350281285 , 767.9081816098276 },
-  { 543.8191184511667 , 249.9908155394228 },
-  { 943.90122813573316 , 339.808037966198 },
-  { 833.9176518025129 , 353.07848777367434 },
-  { 921.4379140155569 , 186.6340241791807 },
-  { 382.3961848207555 , 771.388069864371 },
-  { 129.034179314548 , 390.78324440133963 },
-  { 11.42164258610438 , 622.28033007614886 },
-  { 161.7286904249752 , 510.20013517182724 },
-  { 856.15517101480106 , 454.276729109258 },
-  { 338.7172680273589 , 117.65007416374425 },
-  { 735.324745903914 , 198.8049729340937 },
-  { 28.4518803287299 , 371.91431529881703 },
-  { 842.0475728370109 , 225.41396223110115 },
-  { 638.098949855392 , 233.3417776800659 },
-  { 597.1433285820613 , 23.79139395116061 },
-  { 473.11890926174414 , 167.53446111759501 },
-  { 377.7532491776221 , 877.295644881384 },
-  { 864.1217666940979 , 300.7859250978947 },
-  { 479.4975660446936 , 610.5643565777467 },
-  { 266.4046655198264 , 680.7655630378786 },
-  { 240.34123277014118 , 512.2535780664003 },
-  { 904.7606026727864 , 700.08349169163705 },
-  { 270.6119703545246 , 561.5016477329897 },
-  { 395.34371190229876 , 407.39898058120986 },
-  { 926.9117348644359 , 411.9679705648639 },
-  { 151.90238618759327 , 283.1967897966283 },
-  { 178.56274576972464 , 614.5719286413848 },
-  { 740.18528269737794 , 497.41559607099873 },
-  { 571.9772664141896 , 119.31801868226444 },
-  { 753.9550403391145 , 426.45639865612844 },
-  { 738.408820539245 , 12.5805072933075 },
-  { 431.99407812360414 , 99.36425429073395 },
-  { 500.927986429664 , 58.08414414734756 },
-  { 668.8061188278925 , 570.4324091805154 },
-  { 326.0271280416598 , 361.68104449356537 },
-  { 443.64090180798826 , 256.04896172598745 },
-  { 740.1006497239953 , 286.48382783530343 },
-  { 496.0600184761039 , 558.0349685318979 },
-  { 456.6293591716483 , 718.150811182458 },
-  { 580.9798719152796 , 596.3982404946048 },
-  { 536.5227244989617 , 457.10571196971875 },
-  { 71.42839715126513 , 473.1606441300509 },
-  { 640.8865874703047 , 788.8510203718805 },
-  { 241.0225708268415 , 329.6022639634134 },
-  { 49.217875077166056 , 252.61368056711586 },
-  { 460.0760206175801 , 349.362864718452 },
-  { 401.72289118198523 , 532.7896817150383 },
-  { 324.8231146978761 , 224.62188782345225 },
-  { 378.8118939091766 , 309.2285940507562 },
-  { 649.5482923874224 , 320.3081683057345 },
-  { 878.19842495923587 , 538.6334408599442 },
-  { 479.49756604469354 , 610.5643565777467 },
-  { 552.8208130166184 , 355.1156873407956 },
-  { 103.5756289455544 , 656.0231965705968 },
-  { 866.5377856587197 , 118.1482357070686 },
-  { 246.18221759181858 , 226.5477519372714 },
-  { 255.45510254893455 , 126.84738961514654 },
-  { 600.1469362412356 , 172.60585984669535 },
-  { 715.7419267839161 , 112.46624855563277 },
-  { 335.61923277281295 , 581.3763623718949 },
-  { 559.3138702820755 , 757.5677019529456 },
-  { 480.4528442098948 , 831.9833527426047 },
-  { 160.20096838668414 , 41.84238961514654 },
-  { 566.6026071618998 , 686.2312209984211 },
-  { 684.4457401617172 , 653.9934854291766 },
-  { 135.4166716605425 , 740.6790537158472 },
-  { 149.98279600355644 , 123.1700377868798 },
-  { 147.4136442843816 , 210.87063090017458 },
-  { 28.1090560293338 , 152.1141844614333 },
-  { 25.33291811827456 , 716.3647227431295 },
-  { 349.62139673150784 , 26.4570758255549 }
-},
-{ //#8
-  { 5.80235611781261 , 5.88248919844636 },
-  { 110.065392745905356 , 5.36335408455602 },
-  { 216.54917535476488 , 5.0481475807171 },
-  { 324.34522415013066 , 5.71431622519913 },
-  { 434.33522415013067 , 5.71431622519913 },
-  { 547.04773188612978 , 19.97764173714355 },
-  { 652.69804695931057 , 22.82972196375252 },
-  { 762.69804695931055 , 26.59891048664575 },
-  { 874.6720989732093 , 24.35213329585648 },
-  { 4.757743371307814 , 107.4437692036707 },
-  { 114.62958517072808 , 107.0213955709686 },
-  { 218.13580256186856 , 107.03852635609374 },
-  { 328.71891179138093 , 107.35401524566653 },
-  { 447.7220627066835 , 106.6099811992048 },
-  { 537.77166203479499 , 102.67113804966925 },
-  { 640.4285308003707 , 104.19139582351204 },
-  { 751.96102402954446 , 107.94921418997743 },
-  { 864.911998163944787 , 107.1635533192705 },
-  { 7.4108090837779 , 215.71250862972056 },
-  { 104.623154262052594 , 216.04180167808283 },
-  { 212.77153002522118 , 215.89540779698022 },
-  { 325.36673663994253 , 210.8780786755577807 },
-  { 431.67485963160462 , 217.1679126460473 },
-  { 548.0890148011067 , 218.40031198592493 },
-  { 652.21208836504005 , 225.33303867106667 },
-  { 792.74477801547266 , 216.97581761294331 },
-  { 860.942625460523 , 213.413504516951 },
-  { 10.15816465177235 , 326.77097451381394 },
-  { 121.33471742142797 , 325.874248823865 },
-  { 214.65147739554673 , 319.07661221645435 },
-  { 328.26878952418684 , 314.7823488836608 },
-  { 441.10693687091214 , 316.357008181921728 },
-  { 541.91282139794086 , 320.60756932937363 },
-  { 652.40261767063703 , 292.96221381325165 },
-  { 763.8342434107688 , 307.1202603090924 },
-  { 870.6646953486011 , 315.08601906406733 },
-  { 26.6956350894794 , 415.02048065500975 },
-  { 126.8182315985588 , 410.00438465343085 },
-  { 230.51700699747826 , 428.3953177163358 },
-  { 420.151856218163502 , 416.86626840974685 },
-  { 532.18726034767681 , 418.530356116824876 },
-  { 648.78623124038836 , 423.57531713055437 },
-  { 749.94457939329223 , 410.9817704719229 },
-  { 880.3020142074183 , 423.319591157269741 },
-  { 19.49064385322225 , 511.9708176129433 },
-  { 122.128468065852 , 508.9191319696984 },
-  { 239.7985429697513 , 502.46483179802127 },
-  { 346.86382231475176 , 510.26554194711414 },
-  { 447.02652175179745 , 510.049358807324083 },
-  { 558.544817560939 , 519.16597888552846 },
-  { 673.77035531639018 , 528.9471108839399 },
-  { 784.60651403956203 , 516.35032570037788 },
-  { 882.95184245349428 , 514.88056255363998 },
-  { 28.29654003421298 , 618.79495818325512 },
-  { 139.23766232650446 , 615.60375245739468 },
-  { 243.9415054448463 , 629.800199191057 },
-  { 352.97597707123248 , 618.92639593952946 },
-  { 469.27204085741174 , 624.27174257653195 },
-  { 578.86002406477787 , 624.68219627666895 },
-  { 683.14938154480163 , 620.2086887724517 },
-  { 796.1583269951787 , 620.1400701418057 },
-  { 859.86414757228033 , 623.5212891261059 },
-  { 30.5797070929075 , 710.41328841436444 },
-  { 162.47150492082983 , 716.2150299674624 },
-  { 265.21364767263123 , 712.5050683374064 },
-  { 352.45417725890945 , 716.6245817332359 },
-  { 461.82244082127474 , 714.3342457491726 },
-  { 572.44441977003714 , 718.41273591950062 },
-  { 673.39664080145408 , 717.27910749257128 },
-  { 773.8669674201106 , 715.32145657628763 },
-  { 871.56615822820464 , 715.202288806452394 },
-  { 982.07791717921546 , 10.16682215155424 },
-  { 984.89922986911625 , 110.1202603090924 },
-  { 973.89504556838529 , 219.23734968879876 },
-  { 973.78754897318188 , 314.8374354625943 },
-  { 986.1017160561035 , 414.9995417856615 },
-  { 978.93513560130205 , 514.83299818196616 },
-  { 988.71500269023085 , 611.94557539951029 },
-  { 675.46407044392208 , 816.81617598983507 },
-  { 986.15832699517865 , 714.1870364967352 },
-  { 341.0170517131233 , 415.69847354823142 }
-},
-{ //#9
-  { 318.26878952418684 , 314.7823488836608 },
-  { 15.80235611781261 , 5.88248919844636 },
-  { 110.065392745905356 , 15.36335408455602 },
-  { 216.54917535476488 , 25.0481475807171 },
-  { 324.34522415013066 , 5.71431622519913 },
-  { 434.33522415013067 , 5.71431622519913 },
-  { 547.04773188612978 , 19.97764173714355 },
-  { 652.69804695931057 , 22.82972196375252 },
-  { 762.69804695931055 , 26.59891048664575 },
-  { 874.6720989732093 , 24.35213329585648 },
-  { 4.757743371307814 , 107.4437692036707 },
-  { 114.62958517072808 , 107.0213955709686 },
-  { 248.13580256186856 , 127.03852635609374 },
-  { 328.71891179138093 , 107.35401524566653 },
-  { 447.7220627066835 , 106.6099811992048 },
-  { 537.77166203479499 , 102.67113804966925 },
-  { 640.4285308003707 , 104.19139582351204 },
-  { 751.96102402954446 , 107.94921418997743 },
-  { 864.911998163944787 , 107.1635533192705 },
-  { 7.4108090837779 , 215.71250862972056 },
-  { 104.623154262052594 , 216.04180167808283 },
-  { 212.77153002522118 , 215.89540779698022 },
-  { 325.36673663994253 , 210.8780786755577807 },
-  { 431.67485963160462 , 217.1679126460473 },
-  { 538.0890148011067 , 278.40031198592493 },
-  { 652.21208836504005 , 225.33303867106667 },
-  { 792.74477801547266 , 216.97581761294331 },
-  { 860.942625460523 , 213.413504516951 },
-  { 10.15816465177235 , 326.77097451381394 },
-  { 121.33471742142797 , 325.874248823865 },
-  { 214.65147739554673 , 319.07661221645435 },
-  { 441.10693687091214 , 316.357008181921728 },
-  { 541.91282139794086 , 195.60756932937363 },
-  { 672.40261767063703 , 292.96221381325165 },
-  { 763.8342434107688 , 307.1202603090924 },
-  { 870.6646953486011 , 315.08601906406733 },
-  { 26.6956350894794 , 415.02048065500975 },
-  { 126.8182315985588 , 410.00438465343085 },
-  { 230.51700699747826 , 428.3953177163358 },
-  { 420.151856218163502 , 416.86626840974685 },
-  { 532.18726034767681 , 418.530356116824876 },
-  { 638.78623124038836 , 423.57531713055437 },
-  { 749.94457939329223 , 410.9817704719229 },
-  { 880.3020142074183 , 423.319591157269741 },
-  { 19.49064385322225 , 511.9708176129433 },
-  { 122.128468065852 , 508.9191319696984 },
-  { 239.7985429697513 , 522.46483179802127 },
-  { 346.86382231475176 , 510.26554194711414 },
-  { 547.02652175179745 , 610.049358807324083 },
-  { 558.544817560939 , 519.16597888552846 },
-  { 673.77035531639018 , 528.9471108839399 },
-  { 764.60651403956203 , 516.35032570037788 },
-  { 882.95184245349428 , 514.88056255363998 },
-  { 28.29654003421298 , 618.79495818325512 },
-  { 169.23766232650446 , 605.60375245739468 },
-  { 243.9415054448463 , 819.800199191057 },
-  { 322.97597707123248 , 618.92639593952946 },
-  { 469.27204085741174 , 614.27174257653195 },
-  { 578.86002406477787 , 814.68219627666895 },
-  { 683.14938154480163 , 620.2086887724517 },
-  { 796.1583269951787 , 620.1400701418057 },
-  { 859.86414757228033 , 623.5212891261059 },
-  { 30.5797070929075 , 710.41328841436444 },
-  { 162.47150492082983 , 716.2150299674624 },
-  { 265.21364767263123 , 712.5050683374064 },
-  { 352.45417725890945 , 716.6245817332359 },
-  { 461.82244082127474 , 714.3342457491726 },
-  { 572.44441977003714 , 718.41273591950062 },
-  { 673.39664080145408 , 717.27910749257128 },
-  { 773.8669674201106 , 715.32145657628763 },
-  { 871.56615822820464 , 715.202288806452394 },
-  { 982.07791717921546 , 10.16682215155424 },
-  { 484.89922986911625 , 500.1202603090924 },
-  { 973.89504556838529 , 219.23734968879876 },
-  { 973.78754897318188 , 314.8374354625943 },
-  { 116.1017160561035 , 814.9995417856615 },
-  { 978.93513560130205 , 514.83299818196616 },
-  { 488.71500269023085 , 811.94557539951029 },
-  { 675.46407044392208 , 800.81617598983507 },
-  { 956.15832699517865 , 614.1870364967352 },
-  { 341.0170517131233 , 415.69847354823142 }
-},
-{ //#10
-  { 581.9947617620879 , 321.86030467925116 },
-  { 353.01098255078745 , 107.20980477960205 },
-  { 183.45257619188 , 172.19680515632786 },
-  { 691.7715809456927 , 16.09724209474209 },
-  { 418.397086368677 , 24.12180532499258 },
-  { 752.850245078443 , 762.96623660676346 },
-  { 692.4756266481976 , 657.1233413073439 },
-  { 474.54347577996117 , 363.45198641313664 },
-  { 59.2358264053636 , 472.371571294022 },
-  { 507.1210711421873 , 232.64888384045173 },
-  { 223.9980639522536 , 815.1789786870106 },
-  { 752.0889337120044 , 568.8264160309978 },
-  { 784.2470139619027 , 385.0200504274916 },
-  { 195.04506771410627 , 576.3691594241908 },
-  { 24.4778908463139 , 65.45017881765807 },
-  { 45.83141732423144 , 581.541722513051 },
-  { 414.8279127332246 , 378.5833877681428 },
-  { 583.5560417673123 , 792.4309906819415 },
-  { 832.66983248332633 , 444.7770221646366 },
-  { 532.0899143007852 , 414.1056804475684 },
-  { 793.0179097769266 , 120.12072527220676 },
-  { 142.0016381935854 , 675.11520296618875 },
-  { 880.4445073460347 , 522.551697027345 },
-  { 921.0789337120044 , 268.8264160309978 },
-  { 244.2479945506834 , 347.91204605107464 },
-  { 843.9727123230067 , 16.7358780357875 },
-  { 577.8212803316097 , 148.39165554179533 },
-  { 671.6303499513637 , 461.0460695745975 },
-  { 20.2520471940631 , 407.72107139437287 },
-  { 232.6957760469486 , 710.72602217074245 },
-  { 584.8151965355319 , 646.1922224127002 },
-  { 531.3097016248836 , 722.3227727014794 },
-  { 414.4934599380819 , 579.5425347197499 },
-  { 628.3200834325073 , 236.28320968268451 },
-  { 330.2070647825695 , 735.13282605134626 },
-  { 938.2183983495412 , 347.82355049676636 },
-  { 647.0402301431814 , 733.86993984244754 },
-  { 427.31211349471477 , 748.1320140102221 },
-  { 827.4121989506081 , 637.6060587389086 },
-  { 491.8386797129966 , 544.9458935814663 },
-  { 659.5575630028136 , 539.0212589869722 },
-  { 737.7935193872809 , 212.26461917830085 },
-  { 442.4705712425382 , 143.66510462915127 },
-  { 245.1336394073738 , 76.29293381756008 },
-  { 693.9324790186063 , 267.17717109153205 },
-  { 562.5926177656056 , 509.99036685841224 },
-  { 336.7475029172614 , 658.5566357583943 },
-  { 862.9162582299067 , 202.52667119188288 },
-  { 593.1289297062074 , 39.472070660910006 },
-  { 252.18951698563535 , 608.7282468682645 },
-  { 271.39369004161773 , 455.93751382970345 },
-  { 457.3162362213268 , 832.3983233037705 },
-  { 345.02904473911184 , 312.4337617504224 },
-  { 424.4141728780395 , 269.0119329250317 },
-  { 749.0684269833017 , 19.6664834323319 },
-  { 370.09094936131737 , 479.06425265425247 },
-  { 908.1036409971766 , 137.42485253023915 },
-  { 164.5450157470499 , 278.6742567663413 },
-  { 145.5096807267814 , 514.8920348201009 },
-  { 276.526130413921 , 153.046298478866 },
-  { 312.2562090755856 , 16.82797281665745 },
-  { 676.7293862881252 , 123.91098528331756 },
-  { 689.7554633555744 , 345.75520081283616 },
-  { 310.5053212837268 , 537.0241425292206 },
-  { 537.8700789241524 , 847.2743489235797 },
-  { 364.69589637982983 , 221.43977949185964 },
-  { 149.68677241989286 , 35.4092263678642 },
-  { 636.4933703190006 , 407.8168935123775 },
-  { 71.79337973588673 , 226.0332880471705 },
-  { 827.5672381562216 , 746.85606267503576 },
-  { 38.0040500634166 , 139.30596165744606 },
-  { 916.7822649261876 , 705.18609556668304 },
-  { 472.70990237341255 , 658.4008918721953 },
-  { 264.48153421287725 , 241.60264767936582 },
-  { 306.85873882581603 , 399.570469169609 },
-  { 148.440443588659 , 396.38574319039947 },
-  { 511.62764593511594 , 60.54973579169359 },
-  { 90.50842812563445 , 334.85402510080627 },
-  { 967.5124238436517 , 629.1664969976552 },
-  { 453.59302299966754 , 471.2235299659372 },
-  { 809.9534519859468 , 295.27512590700354 }
-},
-{ //#11
-  { 20.375412706764486 , 465.96489746210136 },
-  { 527.09823963986133 , 12.5738867591089 },
-  { 82.36127626795408 , 613.0547516452185 },
-  { 189.08410320105094 , 639.663740942226 },
-  { 232.827413576117 , 42.8912395254206 },
-  { 428.22070734881308 , 50.9024603141201 },
-  { 848.84291947759074 , 592.207079095636 },
-  { 923.54711887328313 , 674.560379097966 },
-  { 8.84291947759075 , 652.197079095636 },
-  { 730.45503100010342 , 284.9550911947186 },
-  { 104.82687490239454 , 36.9635317528035 },
-  { 466.82429194018627 , 837.9513898009586 },
-  { 268.63665488485964 , 438.8936513952517 },
-  { 926.10458664302016 , 312.2822502284132 },
-  { 220.8687708552885 , 365.3836363516075 },
-  { 330.5777187032847 , 14.1963944927732 },
-  { 101.02050929888833 , 686.8054515029053 },
-  { 725.00432383528268 , 702.1300761594664 },
-  { 747.09166804448625 , 148.31307632100464 },
-  { 808.18366626263656 , 231.3447361884132 },
-  { 234.64787567355918 , 543.5003576225556 },
-  { 615.1204374937192 , 478.5784448914128 },
-  { 41.362494108230564 , 177.9957235546929 },
-  { 523.82106657295816 , 285.96489746210136 },
-  { 918.92101590545704 , 85.2542347605182 },
-  { 905.2990720011899 , 219.7075589975931 },
-  { 332.6496832690377 , 493.56594255620286 },
-  { 773.0156776722591 , 786.3808617867965 },
-  { 439.37251020213455 , 520.1749318532103 },
-  { 628.68218200524632 , 707.9535109227974 },
-  { 572.29189883027448 , 155.91958439652785 },
-  { 418.7034810823221 , 638.8777102166221 },
-  { 529.4710435534807 , 583.2626040874618 },
-  { 634.3326691697203 , 789.9841402314152 },
-  { 628.395334538275225 , 585.4072492263696 },
-  { 828.7602784331126 , 491.0106665876796 },
-  { 120.5083412656051 , 322.0612272440825 },
-  { 6.919444478883442 , 740.1967655692758 },
-  { 505.7158868616815 , 432.12363348814006 },
-  { 414.7721094994205 , 186.54159925914087 },
-  { 440.58118887586014 , 749.0512042137824 },
-  { 4.37829711502256 , 557.5206046236677 },
-  { 936.29407200118993 , 774.9616931598434 },
-  { 139.6285259048533 , 245.65575307729733 },
-  { 537.8266986888912 , 766.8475789952852 },
-  { 832.9345821448395 , 686.0574647727752 },
-  { 129.2691883947744 , 526.460718647466 },
-  { 181.68825331360563 , 729.0339815953105 },
-  { 272.87409591893464 , 790.539609048058 },
-  { 947.406874548325135 , 454.7968589298642 },
-  { 94.33900724232554 , 777.5187109846087 },
-  { 937.14776378375484 , 553.6815031331705 },
-  { 823.76745791359164 , 54.5124979092668 },
-  { 493.13604848458084 , 185.1142116961759 },
-  { 349.0208338486339 , 123.1485362803664 },
-  { 585.64213633100735 , 362.4956605278415 },
-  { 238.62576921198655 , 211.990953326524 },
-  { 641.09958664302016 , 121.0281160661628 },
-  { 402.2914009194472 , 863.3208113586945 },
-  { 25.851910808627423 , 269.59736993657367 },
-  { 851.20441023438792 , 388.58093197131484 },
-  { 518.4255509704002 , 656.5502247637384 },
-  { 723.98180404530258 , 480.20846563494 },
-  { 376.10486057551226 , 285.16668698042093 },
-  { 735.787507809200534 , 590.8958609166766 },
-  { 115.37129760619692 , 116.3559622667198 },
-  { 136.04271513038435 , 432.0030857396392 },
-  { 239.99807964634772 , 851.7357153242097 },
-  { 690.59079334231 , 383.4856387018432 },
-  { 288.134139402524 , 291.9511864311408 },
-  { 396.47688410418175 , 404.3373637984763 },
-  { 223.6571174792071 , 123.07915217047452 },
-  { 275.96808471783095 , 672.3849437359536 },
-  { 720.95184199804848 , 46.2671533590521 },
-  { 340.3046027285942 , 582.7837808926755 },
-  { 620.6067213757875 , 253.1939325363402 },
-  { 362.57256452664082 , 711.8525789952852 },
-  { 25.737288869704535 , 370.25028475952433 },
-  { 133.471810878275 , 877.8923387477558 },
-  { 16.50570462369836 , 849.7682204123869 },
-  { 316.39031331007513 , 890.2244025442191 }
-},
-{ //#5  12
-  { 418.2420211682191 , 372.00205087962405 },
-  { 526.2111950756276 , 392.98913228109024 },
-  { 61.3224309841823 , 495.97529886987553 },
-  { 590.6166692424126 , 283.86894764184194 },
-  { 739.3394961755095 , 840.4779369388494 },
-  { 222.64342125216115 , 781.94935745780515 },
-  { 381.63303187121164 , 474.7248778127209 },
-  { 522.9607740184729 , 10.22018352154947 },
-  { 690.4585889925144 , 380.06258203833573 },
-  { 192.77740671475703 , 688.1125158146806 },
-  { 597.9557740184729 , 110.96604935929908 },
-  { 483.54388324798526 , 103.53567241112226 },
-  { 45.2989478067175 , 700.7289700386416 },
-  { 28.7035457198165 , 36.92039271097195 },
-  { 541.1110417896653 , 805.054790247171 },
-  { 601.015889250968 , 497.3001660154882 },
-  { 124.2302429118267 , 351.78615307127404 },
-  { 620.7465806221655 , 669.0995972161468 },
-  { 51.4843770740771 , 596.791153071274 },
-  { 276.46288065218266 , 505.3204687315887 },
-  { 908.35325707677373 , 832.9623802713417 },
-  { 10.62252514250895 , 910.8848104113868 },
-  { 5.4499212618734 , 417.83458570275866 },
-  { 314.30724584799634 , 365.6247487135821 },
-  { 321.8365470014339 , 822.88186624037587 },
-  { 316.0257716238901 , 612.6844501594197 },
-  { 821.5848719438267 , 420.3827844001522 },
-  { 785.0686701117651 , 330.1605841725376 },
-  { 486.9177433711078 , 484.0857613988836 },
-  { 217.8766205073677 , 399.7490138884776 },
-  { 83.8543303430056 , 828.6644344837297 },
-  { 473.0166960309274 , 294.2273760169157 },
-  { 215.45319658386245 , 21.91309422641845 },
-  { 940.6671959305764 , 175.2435968056152 },
-  { 442.2526846372199 , 756.83834781184044 },
-  { 165.47338738088536 , 867.4804013302546 },
-  { 387.015889250968 , 937.3001660154882 },
-  { 653.9440060268217 , 933.5294166786254 },
-  { 288.5508140208349 , 64.78548618592652 },
-  { 512.0113900188115 , 209.77785404465686 },
-  { 362.7246154590792 , 4.60031046594503 },
-  { 857.7309689378721 , 746.05729762341207 },
-  { 698.1312949895214 , 548.9373432063082 },
-  { 713.8223412805312 , 35.13710099507284 },
-  { 358.79869825851364 , 164.67501694265476 },
-  { 518.5100743160519 , 695.13711521191715 },
-  { 805.4954544074621 , 561.7311163965333 },
-  { 208.1416602563993 , 595.6217737832941 },
-  { 925.0586701117651 , 310.1605841725376 },
-  { 621.7860422243679 , 8.34545657025114 },
-  { 925.12089151026515 , 24.25189320712914 },
-  { 403.8049481830853 , 80.7804861859265 },
-  { 322.81103557372046 , 707.74720629299895 },
-  { 660.3900228636733 , 198.63460750860773 },
-  { 728.1307852596644 , 472.9623802713417 },
-  { 751.3723023691828 , 237.91691141336224 },
-  { 603.1437848829386 , 382.5207866302491 },
-  { 930.0636701117651 , 405.414718334788 },
-  { 403.8049481830853 , 580.77048618592653 },
-  { 27.46738716042285 , 321.3005196553675 },
-  { 816.08784566996576 , 31.03302616600917 },
-  { 250.65070439610489 , 231.37623878762844 },
-  { 413.537217185148 , 860.1203440737955 },
-  { 124.001666536748 , 77.09640738340312 },
-  { 501.77412209049385 , 581.7575675873927 },
-  { 843.3201707575065 , 226.5629087791268 },
-  { 900.6507043961049 , 614.3874936931233 },
-  { 856.6592610306329 , 116.24456711575897 },
-  { 933.1513423460166 , 515.5132516861342 },
-  { 170.5832538974919 , 500.60877416002 },
-  { 365.53583114481773 , 269.49041264500846 },
-  { 188.6193922087113 , 285.04880469905515 },
-  { 156.37087299187954 , 174.7272009282716 },
-  { 625.4889470894473 , 841.92863379041876 },
-  { 804.3577458820068 , 673.1008715217365 },
-  { 696.1790951981291 , 757.5172329364469 },
-  { 713.1614616365636 , 112.20656390234069 },
-  { 707.4694075552624 , 655.7085865131542 },
-  { 276.54779697638605 , 131.32727166511603 },
-  { 57.51251583943416 , 222.9436433636022 },
-  { 592.7812851593136 , 591.9461594826422 }
-},
-{ //#7  13
-  { 333.69964258877616 , 471.40311438164343 },
-  { 442.86979380780514 , 457.9987053005112 },
-  { 8.2207559484483 , 552.2785367047366 },
-  { 374.72367027363913 , 661.6659999762929 },
-  { 231.7186904249752 , 430.20013517182724 },
-  { 636.1466039040504 , 489.71288542750085 },
-  { 645.985866431706 , 405.46931725466226 },
-  { 272.6230805550375 , 904.0170360589951 },
-  { 834.94597142001004 , 628.42659755910813 },
-  { 266.25616350281285 , 787.9081816098276 },
-  { 543.8191184511667 , 249.9908155394228 },
-  { 943.90122813573316 , 339.808037966198 },
-  { 833.9176518025129 , 35.07848777367434 },
-  { 951.4379140155569 , 186.6340241791807 },
-  { 382.3961848207555 , 771.388069864371 },
-  { 129.034179314548 , 390.78324440133963 },
-  { 11.42164258610438 , 822.28033007614886 },
-  { 161.7286904249752 , 510.20013517182724 },
-  { 846.15517101480106 , 454.276729109258 },
-  { 338.7172680273589 , 117.65007416374425 },
-  { 735.324745903914 , 198.8049729340937 },
-  { 15.4518803287299 , 377.91431529881703 },
-  { 842.0475728370109 , 225.41396223110115 },
-  { 638.098949855392 , 203.3417776800659 },
-  { 609.1433285820613 , 23.79139395116061 },
-  { 473.11890926174414 , 167.53446111759501 },
-  { 377.7532491776221 , 877.295644881384 },
-  { 864.1217666940979 , 300.7859250978947 },
-  { 979.4975660446936 , 630.5643565777467 },
-  { 266.4046655198264 , 680.7655630378786 },
-  { 180.34123277014118 , 942.2535780664003 },
-  { 904.7606026727864 , 700.08349169163705 },
-  { 171.6119703545246 , 845.5016477329897 },
-  { 705.34371190229876 , 877.39898058120986 },
-  { 926.9117348644359 , 411.9679705648639 },
-  { 151.90238618759327 , 283.1967897966283 },
-  { 178.56274576972464 , 614.5719286413848 },
-  { 740.18528269737794 , 497.41559607099873 },
-  { 571.9772664141896 , 119.31801868226444 },
-  { 753.9550403391145 , 406.45639865612844 },
-  { 738.408820539245 , 12.5805072933075 },
-  { 431.99407812360414 , 99.36425429073395 },
-  { 500.927986429664 , 28.08414414734756 },
-  { 678.8061188278925 , 580.4324091805154 },
-  { 326.0271280416598 , 361.68104449356537 },
-  { 443.64090180798826 , 256.04896172598745 },
-  { 750.1006497239953 , 296.48382783530343 },
-  { 586.0600184761039 , 868.0349685318979 },
-  { 496.6293591716483 , 918.150811182458 },
-  { 555.9798719152796 , 566.3982404946048 },
-  { 536.5227244989617 , 457.10571196971875 },
-  { 71.42839715126513 , 473.1606441300509 },
-  { 656.8865874703047 , 788.8510203718805 },
-  { 241.0225708268415 , 329.6022639634134 },
-  { 49.217875077166056 , 252.61368056711586 },
-  { 460.0760206175801 , 349.362864718452 },
-  { 441.72289118198523 , 562.7896817150383 },
-  { 324.8231146978761 , 224.62188782345225 },
-  { 378.8118939091766 , 309.2285940507562 },
-  { 649.5482923874224 , 300.3081683057345 },
-  { 878.19842495923587 , 538.6334408599442 },
-  { 479.49756604469354 , 650.5643565777467 },
-  { 552.8208130166184 , 355.1156873407956 },
-  { 103.5756289455544 , 656.0231965705968 },
-  { 866.5377856587197 , 118.1482357070686 },
-  { 246.18221759181858 , 226.5477519372714 },
-  { 255.45510254893455 , 126.84738961514654 },
-  { 930.1469362412356 , 17.60585984669535 },
-  { 715.7419267839161 , 112.46624855563277 },
-  { 335.61923277281295 , 581.3763623718949 },
-  { 559.3138702820755 , 757.5677019529456 },
-  { 478.4528442098948 , 826.9833527426047 },
-  { 160.20096838668414 , 41.84238961514654 },
-  { 576.6026071618998 , 666.2312209984211 },
-  { 744.4457401617172 , 653.9934854291766 },
-  { 135.4166716605425 , 740.6790537158472 },
-  { 149.98279600355644 , 123.1700377868798 },
-  { 57.4136442843816 , 21.87063090017458 },
-  { 28.1090560293338 , 152.1141844614333 },
-  { 25.33291811827456 , 716.3647227431295 },
-  { 349.62139673150784 , 26.4570758255549 }
-},
-{ //#14
-  { 368.01739115656517 , 301.16332878790956 },
-  { 661.5306211249965 , 267.1222334730473 },
-  { 471.0890274839039 , 192.1092338497731 },
-  { 861.91887626487494 , 278.7048247686409 },
-  { 416.07602786062967 , 611.66764020868057 },
-  { 449.6835533171188 , 522.98904921052488 },
-  { 978.6905537236624 , 745.13274020175 },
-  { 300.4037219128935 , 664.63808706988175 },
-  { 156.7145812333708 , 319.2801972755011 },
-  { 762.5238225421135 , 443.27778540566993 },
-  { 518.0569800244306 , 620.46466099886436 },
-  { 784.3662005508071 , 115.50024455276565 },
-  { 269.1120663885567 , 299.50524455276565 },
-  { 231.18477210132193 , 584.1598027692295 },
-  { 863.5352643250827 , 1.2457111872926987 },
-  { 478.76154203102027 , 302.38716396169502 },
-  { 333.952460695622 , 555.928789709654566 },
-  { 753.8299869719242 , 350.91737446632123 },
-  { 32.7097417819675 , 682.24374390702422 },
-  { 369.5913908119913 , 388.42689465671896 },
-  { 439.43256871506435 , 715.63475461001676 },
-  { 320.3098869678675 , 465.4276517017377 },
-  { 230.43342700953747 , 403.6108547650932 },
-  { 575.934121896501 , 213.2934776740944 },
-  { 435.8730486508135 , 9.68668804487963 },
-  { 989.8537120805378 , 410.26672566434587 },
-  { 14.10435698220726 , 468.85215339463186 },
-  { 878.389266041954 , 209.37148154104077 },
-  { 743.60313819800416 , 638.29669858512247 },
-  { 834.6867028773147 , 510.37073449551447 },
-  { 644.9104020910389 , 366.2250238409189 },
-  { 3.95330995480606 , 589.40448137936865 },
-  { 240.22963376252517 , 20.319800412647137 },
-  { 539.35957002516557 , 18.457436057466893 },
-  { 404.2153692347149 , 101.05790130169515 },
-  { 989.2429844405491 , 325.39451889704313 },
-  { 23.13828693885642 , 200.8300040518392 },
-  { 449.2103692347149 , 416.31203546394556 },
-  { 91.46932163332576 , 535.65641941998103 },
-  { 629.4399722253527 , 469.83818050745697 },
-  { 845.002771095909 , 610.48789282082731 },
-  { 538.29548882340663 , 519.377113704237146 },
-  { 969.332818015417 , 20.377026241503707 },
-  { 60.4762258064975 , 293.29901774299067 },
-  { 265.9350970535745 , 223.35532466829002 },
-  { 246.82754688596197 , 127.13797326764205 },
-  { 703.43281922087175 , 729.28643577307088 },
-  { 131.27014663845495 , 4.31161015627188 },
-  { 644.9104020910389 , 366.2250238409189 },
-  { 550.3197875861044 , 313.43270634067187 },
-  { 856.9516135798074 , 703.73381760174576 },
-  { 373.7605132731356 , 200.25688263427205 },
-  { 320.9050269777232 , 99.9209940454279 },
-  { 513.3855204537439 , 114.46231038282733 },
-  { 134.4573529347144 , 728.57998808607866 },
-  { 758.1964054924027 , 19.64597307072556 },
-  { 764.2924902492796 , 288.42390837061873 },
-  { 735.8249834784533 , 182.18172673708412 },
-  { 131.22722189269405 , 635.1290417213898 },
-  { 328.3001778398753 , 12.522625578409375 },
-  { 644.0751844826988 , 127.54798966723172 },
-  { 650.2110541941881 , 597.44513277555484 },
-  { 997.7115032668604 , 647.18891264915479 },
-  { 184.96148342904075 , 500.66156375764125 },
-  { 648.4889243378839 , 17.976534824120634 },
-  { 995.7213961683688 , 112.145492941412 },
-  { 537.2862314133329 , 413.27778540567 },
-  { 603.643997716999 , 690.632127928934 },
-  { 980.70425513038435 , 219.961354568218795 },
-  { 116.72139616836884 , 409.51451516226643 },
-  { 7.7330336595459 , 389.6433370920496 },
-  { 839.9326660142268 , 386.49251944279051 },
-  { 21.7878562576621 , 14.305822964503506 },
-  { 927.1876980619867 , 450.1901131714185 },
-  { 888.12389050866818 , 102.9890492105249 },
-  { 136.85429889571049 , 129.05756345167885 },
-  { 158.78481052289857 , 235.0733101904686 },
-  { 31.670338787336206 , 96.89959964922508 },
-  { 998.0801844826988 , 522.80212382948213 },
-  { 726.8411753084252 , 519.0069593419256 },
-  { 924.0270179137542 , 577.5013318891781 }
-},
-{ //#9  15
-  { 318.26878952418684 , 314.7823488836608 },
-  { 15.80235611781261 , 5.88248919844636 },
-  { 110.065392745905356 , 15.36335408455602 },
-  { 216.54917535476488 , 25.0481475807171 },
-  { 324.34522415013066 , 5.71431622519913 },
-  { 434.33522415013067 , 15.71431622519913 },
-  { 547.04773188612978 , 19.97764173714355 },
-  { 652.69804695931057 , 22.82972196375252 },
-  { 762.69804695931055 , 26.59891048664575 },
-  { 874.6720989732093 , 24.35213329585648 },
-  { 4.757743371307814 , 107.4437692036707 },
-  { 114.62958517072808 , 107.0213955709686 },
-  { 218.13580256186856 , 127.03852635609374 },
-  { 308.71891179138093 , 107.35401524566653 },
-  { 447.7220627066835 , 116.6099811992048 },
-  { 537.77166203479499 , 102.67113804966925 },
-  { 640.4285308003707 , 104.19139582351204 },
-  { 751.96102402954446 , 107.94921418997743 },
-  { 844.911998163944787 , 107.1635533192705 },
-  { 7.4108090837779 , 215.71250862972056 },
-  { 104.623154262052594 , 216.04180167808283 },
-  { 212.77153002522118 , 215.89540779698022 },
-  { 325.36673663994253 , 210.8780786755577807 },
-  { 431.67485963160462 , 217.1679126460473 },
-  { 518.0890148011067 , 278.40031198592493 },
-  { 642.21208836504005 , 225.33303867106667 },
-  { 792.74477801547266 , 216.97581761294331 },
-  { 860.942625460523 , 213.413504516951 },
-  { 10.15816465177235 , 326.77097451381394 },
-  { 121.33471742142797 , 325.874248823865 },
-  { 214.65147739554673 , 319.07661221645435 },
-  { 421.10693687091214 , 316.357008181921728 },
-  { 541.91282139794086 , 195.60756932937363 },
-  { 662.40261767063703 , 292.96221381325165 },
-  { 763.8342434107688 , 307.1202603090924 },
-  { 870.6646953486011 , 315.08601906406733 },
-  { 26.6956350894794 , 415.02048065500975 },
-  { 126.8182315985588 , 410.00438465343085 },
-  { 230.51700699747826 , 428.3953177163358 },
-  { 420.151856218163502 , 416.86626840974685 },
-  { 532.18726034767681 , 418.530356116824876 },
-  { 638.78623124038836 , 423.57531713055437 },
-  { 719.94457939329223 , 403.9817704719229 },
-  { 820.3020142074183 , 423.319591157269741 },
-  { 19.49064385322225 , 511.9708176129433 },
-  { 122.128468065852 , 508.9191319696984 },
-  { 239.7985429697513 , 522.46483179802127 },
-  { 346.86382231475176 , 510.26554194711414 },
-  { 547.02652175179745 , 610.049358807324083 },
-  { 578.544817560939 , 519.16597888552846 },
-  { 673.77035531639018 , 528.9471108839399 },
-  { 764.60651403956203 , 516.35032570037788 },
-  { 872.95184245349428 , 514.88056255363998 },
-  { 28.29654003421298 , 618.79495818325512 },
-  { 169.23766232650446 , 605.60375245739468 },
-  { 243.9415054448463 , 819.800199191057 },
-  { 322.97597707123248 , 610.92639593952946 },
-  { 469.27204085741174 , 614.27174257653195 },
-  { 578.86002406477787 , 354.68219627666895 },
-  { 683.14938154480163 , 620.2086887724517 },
-  { 776.1583269951787 , 620.1400701418057 },
-  { 859.86414757228033 , 623.5212891261059 },
-  { 60.5797070929075 , 710.41328841436444 },
-  { 162.47150492082983 , 716.2150299674624 },
-  { 265.21364767263123 , 712.5050683374064 },
-  { 352.45417725890945 , 716.6245817332359 },
-  { 461.82244082127474 , 714.3342457491726 },
-  { 572.44441977003714 , 700.41273591950062 },
-  { 673.39664080145408 , 717.27910749257128 },
-  { 773.8669674201106 , 715.32145657628763 },
-  { 871.56615822820464 , 715.202288806452394 },
-  { 722.07791717921546 , 170.16682215155424 },
-  { 484.89922986911625 , 500.1202603090924 },
-  { 913.89504556838529 , 389.23734968879876 },
-  { 973.78754897318188 , 314.8374354625943 },
-  { 116.1017160561035 , 814.9995417856615 },
-  { 978.93513560130205 , 514.83299818196616 },
-  { 408.71500269023085 , 541.94557539951029 },
-  { 675.46407044392208 , 800.81617598983507 },
-  { 956.15832699517865 , 614.1870364967352 },
-  { 331.0170517131233 , 415.69847354823142 }
-},
-{ //#10 16
-  { 571.9947617620879 , 311.86030467925116 },
-  { 353.01098255078745 , 107.20980477960205 },
-  { 183.45257619188 , 172.19680515632786 },
-  { 691.7715809456927 , 16.09724209474209 },
-  { 418.397086368677 , 24.12180532499258 },
-  { 752.850245078443 , 762.96623660676346 },
-  { 672.4756266481976 , 657.1233413073439 },
-  { 484.54347577996117 , 353.45198641313664 },
-  { 59.2358264053636 , 472.371571294022 },
-  { 507.1210711421873 , 232.64888384045173 },
-  { 223.9980639522536 , 815.1789786870106 },
-  { 752.0889337120044 , 558.8264160309978 },
-  { 784.2470139619027 , 385.0200504274916 },
-  { 195.04506771410627 , 576.3691594241908 },
-  { 44.4778908463139 , 65.45017881765807 },
-  { 65.83141732423144 , 581.541722513051 },
-  { 414.8279127332246 , 378.5833877681428 },
-  { 583.5560417673123 , 792.4309906819415 },
-  { 832.66983248332633 , 444.7770221646366 },
-  { 532.0899143007852 , 414.1056804475684 },
-  { 793.0179097769266 , 120.12072527220676 },
-  { 142.0016381935854 , 675.11520296618875 },
-  { 850.4445073460347 , 522.551697027345 },
-  { 921.0789337120044 , 268.8264160309978 },
-  { 244.2479945506834 , 347.91204605107464 },
-  { 843.9727123230067 , 16.7358780357875 },
-  { 577.8212803316097 , 148.39165554179533 },
-  { 671.6303499513637 , 461.0460695745975 },
-  { 20.2520471940631 , 407.72107139437287 },
-  { 232.6957760469486 , 710.72602217074245 },
-  { 574.8151965355319 , 636.1922224127002 },
-  { 531.3097016248836 , 722.3227727014794 },
-  { 414.4934599380819 , 579.5425347197499 },
-  { 628.3200834325073 , 236.28320968268451 },
-  { 330.2070647825695 , 735.13282605134626 },
-  { 898.2183983495412 , 347.82355049676636 },
-  { 647.0402301431814 , 733.86993984244754 },
-  { 427.31211349471477 , 748.1320140102221 },
-  { 857.4121989506081 , 627.6060587389086 },
-  { 491.8386797129966 , 564.9458935814663 },
-  { 659.5575630028136 , 539.0212589869722 },
-  { 737.7935193872809 , 212.26461917830085 },
-  { 442.4705712425382 , 143.66510462915127 },
-  { 245.1336394073738 , 76.29293381756008 },
-  { 693.9324790186063 , 267.17717109153205 },
-  { 562.5926177656056 , 509.99036685841224 },
-  { 336.7475029172614 , 658.5566357583943 },
-  { 862.9162582299067 , 202.52667119188288 },
-  { 593.1289297062074 , 39.472070660910006 },
-  { 252.18951698563535 , 608.7282468682645 },
-  { 241.39369004161773 , 485.93751382970345 },
-  { 457.3162362213268 , 832.3983233037705 },
-  { 345.02904473911184 , 312.4337617504224 },
-  { 424.4141728780395 , 269.0119329250317 },
-  { 749.0684269833017 , 19.6664834323319 },
-  { 370.09094936131737 , 479.06425265425247 },
-  { 908.1036409971766 , 137.42485253023915 },
-  { 164.5450157470499 , 278.6742567663413 },
-  { 145.5096807267814 , 514.8920348201009 },
-  { 276.526130413921 , 153.046298478866 },
-  { 312.2562090755856 , 16.82797281665745 },
-  { 676.7293862881252 , 123.91098528331756 },
-  { 689.7554633555744 , 345.75520081283616 },
-  { 310.5053212837268 , 537.0241425292206 },
-  { 537.8700789241524 , 847.2743489235797 },
-  { 364.69589637982983 , 221.43977949185964 },
-  { 149.68677241989286 , 35.4092263678642 },
-  { 636.4933703190006 , 397.8168935123775 },
-  { 71.79337973588673 , 226.0332880471705 },
-  { 827.5672381562216 , 746.85606267503576 },
-  { 38.0040500634166 , 139.30596165744606 },
-  { 916.7822649261876 , 705.18609556668304 },
-  { 472.70990237341255 , 658.4008918721953 },
-  { 264.48153421287725 , 241.60264767936582 },
-  { 306.85873882581603 , 399.570469169609 },
-  { 148.440443588659 , 396.38574319039947 },
-  { 511.62764593511594 , 60.54973579169359 },
-  { 90.50842812563445 , 334.85402510080627 },
-  { 757.5124238436517 , 629.1664969976552 },
-  { 453.59302299966754 , 471.2235299659372 },
-  { 809.9534519859468 , 295.27512590700354 }
-},
-{ //#17
-  { 353.2414091274139 , 194.25880678093415 },
-  { 347.97837249932115 , 524.7396716670438 },
-  { 867.4986374260702 , 423.55859759151167 },
-  { 117.5122351911582 , 463.94145401462242 },
-  { 234.25762991611342 , 258.9093066805833 },
-  { 363.3778145553616 , 335.3147808473684 },
-  { 12.76986872387647 , 56.77049058889442 },
-  { 33.327872599672 , 405.75589245574335 },
-  { 396.83908452082466 , 112.52030742667553 },
-  { 493.954490259378 , 60.883130235855404 },
-  { 993.91151157143109 , 364.98693302422502 },
-  { 967.5521656527889 , 142.621629590114 },
-  { 722.2734950131908 , 421.783567174269635 },
-  { 229.12058625670522 , 564.61457165794593 },
-  { 671.5497537829577 , 178.43087089885665 },
-  { 104.1855379803615 , 96.2248483435532 },
-  { 784.5556901918938 , 199.1936102158789 },
-  { 167.5091869648419 , 656.72543237848362 },
-  { 712.1127575408464 , 47.53999900143103 },
-  { 711.4436462322197 , 328.379158093137395 },
-  { 243.42302513836918 , 613.51051668742616 },
-  { 478.631948717612 , 528.31978084736835 },
-  { 631.0020525911272 , 103.3921577164116 },
-  { 893.639283755539 , 14.399347626995812 },
-  { 253.32787259967205 , 383.7234508783443 },
-  { 309.7576109594754 , 223.84630147592526 },
-  { 518.0194119891684 , 268.8226951725592 },
-  { 404.7933530753039 , 445.2427779111987 },
-  { 75.02496669208324 , 293.1171639333795 },
-  { 578.2729436867124 , 570.14505102584647 },
-  { 857.70175537150203 , 595.90964183971434 },
-  { 784.7583924625638 , 433.985789008054795 },
-  { 196.60846436618456 , 466.69348765272474 },
-  { 302.34132356698757 , 66.35675073370933 },
-  { 101.08147652874794 , 551.2483000522315 },
-  { 361.0148548172106 , 23.87380409535058 },
-  { 609.4282464304191 , 8.123108230943437 },
-  { 493.3539101323055 , 26.47591779967203 },
-  { 598.631948717612 , 257.32560949775 },
-  { 786.5992098561471 , 32.86547469822514 },
-  { 787.8491203990048 , 107.49934273238561 },
-  { 831.2564557925356 , 495.09109082068545 },
-  { 587.2313003556233 , 119.1689501088656 },
-  { 721.8319013720982 , 116.79656679754378 },
-  { 193.05465070629722 , 156.92835451678238 },
-  { 602.3906876527683 , 375.21251354854739 },
-  { 153.96607079019458 , 59.61112286141137 },
-  { 897.5711902870829 , 99.82682818526933 },
-  { 26.86101630980343 , 244.7702742668841 },
-  { 289.85971917395585 , 301.0936019480886 },
-  { 427.7315117791976 , 149.00660474393726 },
-  { 584.2130463856621 , 195.98077542245744 },
-  { 511.51618000840074 , 363.6337886141912 },
-  { 206.2068511296336 , 310.5724143800867 },
-  { 386.3383793283747 , 277.9158250544092 },
-  { 433.3743151848937 , 387.49074427309637 },
-  { 907.1574504318978 , 209.39828302838043 },
-  { 748.26052528466624 , 514.45883820436887 },
-  { 463.626948717612 , 625.06564668511794 },
-  { 507.45363230144267 , 435.70930182436558 },
-  { 243.0922469750441 , 67.00869415656364 },
-  { 576.0860355343485 , 461.80156679754373 },
-  { 273.8575496286125 , 164.13370677183627 },
-  { 710.23847584558507 , 268.58326484783254 },
-  { 659.0384212427327 , 565.8928085701596 },
-  { 84.13506582541191 , 172.23600389138 },
-  { 114.3507932308589 , 349.1894732439397 },
-  { 656.5029263048361 , 464.48607790797092 },
-  { 478.111278556801 , 287.0098793869867 },
-  { 407.40258066067355 , 548.68658176038463 },
-  { 267.44665025751095 , 481.943261610101 },
-  { 967.0622978932006 , 301.6436587966976 },
-  { 24.692561759859487 , 190.46521732487724 },
-  { 245.9797419619845 , 5.69927238108782 },
-  { 463.2325066615715 , 239.74467166704375 },
-  { 157.22089048539237 , 240.64660521162162 },
-  { 312.98337249932115 , 389.9938058292942 },
-  { 502.6602141933919 , 155.85754518611265 },
-  { 979.9871238137022 , 26.868240929601185 },
-  { 810.5135216710786 , 333.59374005184185 },
-  { 895.894413803805 , 309.8791479144901 }
-},
-{ //#18
-  { 201.81409046755405 , 274.2315119244587 },
-  { 893.73176319740026 , 635.35959721074653 },
-  { 201.81409046755405 , 394.2215119244587 },
-  { 85.91265057112876 , 425.2772091463102 },
-  { 986.65983314212787 , 419.37576924988485 },
-  { 19.6144918071448 , 388.43854636579647 },
-  { 780.61559130482823 , 461.8109745765048 },
-  { 344.8321394754858 , 204.43015059022872 },
-  { 418.7053598998116 , 109.87674026495817 },
-  { 298.8798020246103 , 103.59694887536737 },
-  { 255.7698486302544 , 546.6567172510786 },
-  { 782.9865997261787 , 554.74885672373637 },
-  { 95.86920880041141 , 217.89961910577964 },
-  { 413.2651650214288 , 361.81741478303803 },
-  { 347.68752136010056 , 623.7848025373664 },
-  { 765.7284786676488 , 334.22651192445863 },
-  { 975.66997264517215 , 589.9832809098627 },
-  { 866.96212275145155 , 371.0056899653273 },
-  { 115.69824770335677 , 522.0773951582723 },
-  { 694.35646077503972 , 154.89882969921956 },
-  { 530.4411491800295 , 625.5311831869139 },
-  { 638.22907795221178 , 312.46422086664916 },
-  { 435.4213836283539 , 41.44605581305753 },
-  { 360.9649308491501 , 522.6287396743688 },
-  { 187.19098795237045 , 155.13589918901647 },
-  { 782.36568640650245 , 57.3474957094828 },
-  { 22.75171673832241 , 11.679276145521214 },
-  { 793.6891430002788 , 167.4412000067053 },
-  { 206.70027041464465 , 460.65229612031544 },
-  { 5.24687033759848 , 568.9612232657004 },
-  { 96.86847180789795 , 336.04920559110076 },
-  { 646.33889134591055 , 446.47562388739917 },
-  { 12.07563261226635 , 226.17093230724487 },
-  { 675.2525860136496 , 10.81181741164394 },
-  { 717.22970378780906 , 664.2514007133379 },
-  { 107.44458793767744 , 100.42450963547141 },
-  { 23.10367006557091 , 109.94978455524428 },
-  { 843.20705925596587 , 270.31084639657064 },
-  { 706.0016810768872 , 474.3046065904374 },
-  { 136.67423589481217 , 632.033614735895 },
-  { 647.0468843085451 , 82.76090403711228 },
-  { 91.00190628778465 , 10.82914141160599 },
-  { 458.03888000420005 , 552.1003872517949 },
-  { 462.2000700875351 , 179.4828268090057 },
-  { 558.7312029742657 , 524.354619784676 },
-  { 251.21099969605027 , 184.82589278129782 },
-  { 943.90611557402673 , 268.3367722522379 },
-  { 318.6790869786232 , 468.7275278227959 },
-  { 566.7867513707276 , 401.3904220255283 },
-  { 510.89087160663746 , 362.8992529722212 },
-  { 698.5964825351305 , 373.37986436322393 },
-  { 981.37936558932387 , 165.3652277369145 },
-  { 576.9470777555398 , 144.4011459593246 },
-  { 319.0660404850952 , 286.5368127421475 },
-  { 927.9698207616874 , 487.0165243624766 },
-  { 107.40270717913052 , 292.6102715152218 },
-  { 898.2940296629042 , 138.3733507261941 },
-  { 687.62338975677176 , 584.6289677192212 },
-  { 31.4982474957468 , 632.195065537877 },
-  { 619.9476480214804 , 256.42146133472386 },
-  { 199.7199762191444 , 84.2597869826433 },
-  { 967.99570025140576 , 345.113807230336 },
-  { 795.9673127496914 , 643.6103604125677 },
-  { 2.5605926997537125 , 511.590791788945 },
-  { 479.94827353006735 , 474.35334488399053 },
-  { 853.22254482430736 , 56.98338243441376 },
-  { 441.7224434069757 , 661.7773771886685 },
-  { 164.99138929196118 , 679.34293363035425 },
-  { 843.97995987258713 , 428.73924699126786 },
-  { 327.29033061225124 , 15.578766960897553 },
-  { 718.1853509152521 , 224.6967922232489 },
-  { 400.6436360347625 , 296.8852771469983 },
-  { 515.88648744490035 , 262.83488468038075 },
-  { 418.37679736929954 , 457.0976071073535 },
-  { 851.2092660387474 , 523.02511792884445 },
-  { 208.17863685859965 , 0.28346498907011153 },
-  { 535.9115108409414 , 44.57829665808605 },
-  { 302.81215760138 , 361.0286481133272 },
-  { 344.8321394754858 , 204.43015059022872 },
-  { 211.80053710507048 , 600.5651448224346 },
-  { 280.0940923253657 , 649.0569500872971 }
-},
-{ //#19
-  { 430.9102163016844 , 128.44927814830652 },
-  { 435.06290741431496 , 247.3667926553087 },
-  { 537.0572445248592 , 308.65117318885603 },
-  { 523.3828142554493 , 53.566444817286325 },
-  { 640.1866328138868 , 76.27080717714139 },
-  { 549.7371446421312 , 134.67673358165442 },
-  { 579.6994468412545 , 419.73790813775804 },
-  { 313.38518065426894 , 109.83514115316947 },
-  { 462.895628282817 , 442.44227049761315 },
-  { 226.36140369860385 , 190.98612601700617 },
-  { 391.4496445138494 , 199.63803410387712 },
-  { 510.4215217605084 , 201.71469594584948 },
-  { 651.7314817526754 , 73.39235304810704 },
-  { 624.6199779731513 , 42.20413562788947 },
-  { 460.81896644084463 , 561.4141477442721 },
-  { 514.6827582649555 , 335.7935954388638 },
-  { 665.6774386509263 , 107.90980762527788 },
-  { 272.7494981734329 , 207.93835691469062 },
-  { 509.6844639030151 , 73.00101380463845 },
-  { 371.41521630168444 , 231.49764094461688 },
-  { 376.948411342071 , 81.53496752007621 },
-  { 191.57209455364537 , 77.1954231049646 },
-  { 257.0346871019839 , 264.29572991328166 },
-  { 214.7379998959445 , 43.29677756918532 },
-  { 404.68266791503277 , 45.26612200647291 },
-  { 314.72218381509555 , 368.36672886579834 },
-  { 75.63180054485024 , 103.96234906134107 },
-  { 12.576707293741201 , 204.8715920229942 },
-  { 390.0293532968215 , 113.97260529720144 },
-  { 508.36751362669236 , 126.41044714141952 },
-  { 745.2972895015669 , 19.483004841722703 },
-  { 392.589524260949 , 218.2749032290877 },
-  { 643.431158941862 , 192.09249938852352 },
-  { 575.1994956405451 , 528.6160587756073 },
-  { 555.9646000754791 , 15.849805241207676 },
-  { 579.2854112941325 , 467.1816825880183 },
-  { 335.0991509615643 , 354.0986228639893 },
-  { 529.4120998767286 , 311.89634455826706 },
-  { 140.76716085630773 , 273.6435255179222 },
-  { 200.23676672416602 , 161.39984415298625 },
-  { 290.30213871533226 , 78.0642109751377 },
-  { 209.80119641536572 , 73.15412851744672 },
-  { 334.1536644526618 , 184.31169940419966 },
-  { 541.2099356374898 , 427.5686876958582 },
-  { 257.5227593983758 , 4.773207078885761 },
-  { 455.5538521950717 , 315.63627683800416 },
-  { 804.7922895015669 , 122.53136763803305 },
-  { 97.93418133750698 , 66.0011399290404 },
-  { 237.03209301698269 , 203.70295834764084 },
-  { 783.2024742983417 , 126.52394462041495 },
-  { 572.458195216719 , 149.15163919702735 },
-  { 376.5127593983758 , 4.773207078885761 },
-  { 618.3925225398035 , 161.0310639683362 },
-  { 497.246622058797 , 191.33917413450928 },
-  { 431.9953104505755 , 364.51359444474923 },
-  { 113.48595025539424 , 141.81649877188505 },
-  { 776.0060031441624 , 237.98685610761385 },
-  { 174.84665024575145 , 49.27792461773326 },
-  { 314.9643468372481 , 290.7896623906043 },
-  { 332.3739727915116 , 191.86057437497823 },
-  { 110.00778553553971 , 137.96072729388476 },
-  { 726.2340861192945 , 211.31841093286204 },
-  { 96.19272230574835 , 383.9691323728243 },
-  { 175.99864519708746 , 155.80403287974804 },
-  { 573.4905917715806 , 288.3574315491985 },
-  { 630.9167603018664 , 52.28109381038749 },
-  { 382.21886243140517 , 336.8121103550245 },
-  { 429.3448760369487 , 323.587751359269 },
-  { 587.5857341049459 , 585.8818289284347 },
-  { 118.59657799809503 , 183.18341445996305 },
-  { 439.5591253456854 , 87.26817518199258 },
-  { 285.98252157461627 , 36.9657991956595 },
-  { 190.56731461498646 , 73.16547088459214 },
-  { 287.37864556133275 , 257.32553081698876 },
-  { 430.10974095572135 , 256.48939043242376 },
-  { 321.2722045022734 , 282.15610180026715 },
-  { 572.7395571541242 , 173.91025676629158 },
-  { 110.43387377345839 , 83.33538029340578 },
-  { 747.9964139133505 , 143.3329202183884 },
-  { 212.99654086418587 , 361.2647700129692 },
-  { 854.9439174824884 , 195.4947029748207 }
-},
-{ //#19 20
-  { 430.9102163016844 , 128.44927814830652 },
-  { 435.06290741431496 , 277.3667926553087 },
-  { 537.0572445248592 , 288.65117318885603 },
-  { 523.3828142554493 , 53.566444817286325 },
-  { 980.1866328138868 , 76.27080717714139 },
-  { 549.7371446421312 , 134.67673358165442 },
-  { 579.6994468412545 , 419.73790813775804 },
-  { 313.38518065426894 , 109.83514115316947 },
-  { 462.895628282817 , 442.44227049761315 },
-  { 246.36140369860385 , 170.98612601700617 },
-  { 391.4496445138494 , 219.63803410387712 },
-  { 659.4215217605084 , 231.71469594584948 },
-  { 611.7314817526754 , 617.39235304810704 },
-  { 624.6199779731513 , 2.20413562788947 },
-  { 460.81896644084463 , 561.4141477442721 },
-  { 514.6827582649555 , 365.7935954388638 },
-  { 665.6774386509263 , 107.90980762527788 },
-  { 202.7494981734329 , 257.93835691469062 },
-  { 509.6844639030151 , 513.00101380463845 },
-  { 371.41521630168444 , 391.49764094461688 },
-  { 376.948411342071 , 81.53496752007621 },
-  { 161.57209455364537 , 77.1954231049646 },
-  { 257.0346871019839 , 264.29572991328166 },
-  { 214.7379998959445 , 43.29677756918532 },
-  { 404.68266791503277 , 45.26612200647291 },
-  { 314.72218381509555 , 368.36672886579834 },
-  { 75.63180054485024 , 103.96234906134107 },
-  { 12.576707293741201 , 204.8715920229942 },
-  { 390.0293532968215 , 633.97260529720144 },
-  { 708.36751362669236 , 526.41044714141952 },
-  { 745.2972895015669 , 19.483004841722703 },
-  { 775.589524260949 , 348.2749032290877 },
-  { 643.431158941862 , 392.09249938852352 },
-  { 575.1994956405451 , 528.6160587756073 },
-  { 505.9646000754791 , 15.849805241207676 },
-  { 667.2854112941325 , 467.1816825880183 },
-  { 5.0991509615643 , 354.0986228639893 },
-  { 679.4120998767286 , 311.89634455826706 },
-  { 140.76716085630773 , 573.6435255179222 },
-  { 200.23676672416602 , 661.39984415298625 },
-  { 290.30213871533226 , 578.0642109751377 },
-  { 209.80119641536572 , 593.15412851744672 },
-  { 334.1536644526618 , 184.31169940419966 },
-  { 541.2099356374898 , 647.5686876958582 },
-  { 257.5227593983758 , 4.773207078885761 },
-  { 995.5538521950717 , 315.63627683800416 },
-  { 804.7922895015669 , 122.53136763803305 },
-  { 9.93418133750698 , 6.0011399290404 },
-  { 267.03209301698269 , 533.70295834764084 },
-  { 933.2024742983417 , 126.52394462041495 },
-  { 872.458195216719 , 449.15163919702735 },
-  { 376.5127593983758 , 4.773207078885761 },
-  { 638.3925225398035 , 161.0310639683362 },
-  { 497.246622058797 , 191.33917413450928 },
-  { 431.9953104505755 , 364.51359444474923 },
-  { 113.48595025539424 , 497.81649877188505 },
-  { 776.0060031441624 , 271.98685610761385 },
-  { 874.84665024575145 , 49.27792461773326 },
-  { 124.9643468372481 , 290.7896623906043 },
-  { 372.3739727915116 , 491.86057437497823 },
-  { 110.00778553553971 , 13.96072729388476 },
-  { 976.2340861192945 , 211.31841093286204 },
-  { 96.19272230574835 , 383.9691323728243 },
-  { 195.99864519708746 , 145.80403287974804 },
-  { 593.4905917715806 , 298.3574315491985 },
-  { 630.9167603018664 , 52.28109381038749 },
-  { 882.21886243140517 , 336.8121103550245 },
-  { 429.3448760369487 , 633.587751359269 },
-  { 647.5857341049459 , 585.8818289284347 },
-  { 118.59657799809503 , 183.18341445996305 },
-  { 809.5591253456854 , 587.26817518199258 },
-  { 285.98252157461627 , 36.9657991956595 },
-  { 190.56731461498646 , 457.16547088459214 },
-  { 287.37864556133275 , 457.32553081698876 },
-  { 901.10974095572135 , 256.48939043242376 },
-  { 321.2722045022734 , 282.15610180026715 },
-  { 572.7395571541242 , 173.91025676629158 },
-  { 10.43387377345839 , 283.33538029340578 },
-  { 747.9964139133505 , 173.3329202183884 },
-  { 212.99654086418587 , 361.2647700129692 },
-  { 854.9439174824884 , 195.4947029748207 }
-},
-{ //#21
-  { 719.9528856927584 , 327.8870526113535 },
-  { 650.012318522477 , 231.62212045067855 },
-  { 666.5725258057153 , 349.454117950238 },
-  { 770.2402326572842 , 435.7286161908445 },
-  { 520.0794288267766 , 458.9849904625439 },
-  { 252.7509746614231 , 442.2675818110541 },
-  { 880.5658395121862 , 638.30305474140386 },
-  { 651.2683554106252 , 433.65195434887215 },
-  { 70.3075936450402 , 579.51355077995663 },
-  { 534.0727425332476 , 370.772182229098 },
-  { 870.5829721609825 , 425.70737452781583 },
-  { 809.3333304428423 , 254.3823992177825 },
-  { 25.2729064320719 , 348.01190346199405 },
-  { 532.8300439915544 , 25.28451711126658 },
-  { 414.99804649199496 , 235.7243098280284 },
-  { 755.0742525967607 , 15.7596991947854 },
-  { 206.2578776824845 , 372.7367092987482 },
-  { 660.0622155770303 , 671.80260637403563 },
-  { 306.2018639761714 , 230.91691082430123 },
-  { 988.4378799719176 , 101.29651359577653 },
-  { 118.4242868338505 , 334.9419166121827 },
-  { 581.6646224174409 , 670.5053803789287 },
-  { 820.0485805945261 , 96.5260184437067 },
-  { 808.9795873561412 , 548.2358715014072 },
-  { 308.1153851062779 , 286.12335362245705 },
-  { 570.3075936450402 , 160.52355077995662 },
-  { 470.3667757913024 , 351.14342688305294 },
-  { 668.5143672630597 , 86.84591187178452 },
-  { 921.486842666704 , 586.9752262002643 },
-  { 249.2884567658311 , 239.8958981891092 },
-  { 640.8976935810813 , 582.189161474809 },
-  { 84.5759295777505 , 386.19787851467885 },
-  { 155.2800729114759 , 402.01772164964314 },
-  { 608.7869759325373 , 483.54859416194904 },
-  { 988.4149696605419 , 442.267581811054 },
-  { 320.1809976629975 , 584.9372403883099 },
-  { 590.7469249406619 , 262.71662409949784 },
-  { 369.692213333547 , 337.9740932604333 },
-  { 200.20873734703645 , 121.93360691598683 },
-  { 721.9844285299832 , 519.54695915841364 },
-  { 510.9502964359604 , 207.45805634489116 },
-  { 410.7560438205358 , 419.47991909446796 },
-  { 930.853186476712 , 372.46149116191293 },
-  { 627.9950903581519 , 5.45255182743989 },
-  { 835.4083741623392 , 356.67333896875795 },
-  { 739.0818253070539 , 99.09475414383516 },
-  { 319.0383060037357 , 421.2694624109941 },
-  { 989.4793731148559 , 278.98584225564633 },
-  { 578.0107964616251 , 389.8865547772083 },
-  { 388.5090601578499 , 3.2334605755703336 },
-  { 295.8851372426634 , 151.37527414961346 },
-  { 136.5942338280312 , 143.79910959249565 },
-  { 674.8855608340491 , 178.57798820611055 },
-  { 431.6429745906753 , 283.4157800197579 },
-  { 502.03316581480544 , 137.34900304113035 },
-  { 572.9252677185839 , 547.99812506836605 },
-  { 217.4997062691432 , 597.672518213464 },
-  { 717.6854887306148 , 624.5257099429374 },
-  { 423.6263368374731 , 127.88104050123962 },
-  { 470.4292609480798 , 498.8712684893387 },
-  { 202.9272536698003 , 307.4793580656589 },
-  { 868.5598623789733 , 4.184281454323 },
-  { 547.4990899712783 , 299.31450398389075 },
-  { 86.2281398979151 , 267.00479098966565 },
-  { 296.9283109686273 , 355.7338636645777 },
-  { 607.0950998890892 , 81.4865817852372 },
-  { 408.9809127864395 , 518.6684625304684 },
-  { 136.5130929759966 , 253.189185789563 },
-  { 782.2204100012098 , 660.1736862184264 },
-  { 432.11973767099954 , 38.11771520061343 },
-  { 861.8807846779417 , 172.8657946734569 },
-  { 332.64663890195675 , 108.29539464985406 },
-  { 907.3303014822477 , 277.0067826574342 },
-  { 765.7327364884771 , 184.42381384536242 },
-  { 896.5051648179592 , 115.6691833611259 },
-  { 900.0563082999631 , 487.3970052320492 },
-  { 719.9528856927584 , 238.8970526113535 },
-  { 985.7203318773854 , 181.97714331690685 },
-  { 495.27483940612535 , 595.2447924693339 },
-  { 156.6328921531515 , 507.47935806565897 },
-  { 125.4794955522459 , 83.205304685556 }
-},
-{ //22
-  { 94.452234400936 , 383.125555711557 },
-  { 156.0622040057982 , 458.15519505208437 },
-  { 462.3271361664732 , 578.0957622223657 },
-  { 884.245645280762 , 298.318956935119 },
-  { 497.4118601547223 , 221.549024774444 },
-  { 47.682302240260995 , 249.9593408375967 },
-  { 165.3033592108081 , 609.2467470862024 },
-  { 344.1787861110988 , 168.60873076564883 },
-  { 746.89007624515403 , 264.78739538168617 },
-  { 153.70316855343486 , 195.939011273588 },
-  { 799.2340410657407 , 449.44591429464919 },
-  { 277.6856891321601 , 36.07785825334297 },
-  { 419.3721873346608 , 45.81531988582283 },
-  { 442.51694644096966 , 133.17088892143076 },
-  { 282.10717776924565 , 631.9511094460574 },
-  { 655.83809740579892 , 245.6005200641416 },
-  { 947.21007157449617 , 8.40813876128213 },
-  { 196.51293492694958 , 549.2937099451414 },
-  { 525.1743459418857 , 27.57664607913459 },
-  { 149.9767332991862 , 329.73915595752885 },
-  { 226.18194882115517 , 84.33147691930965 },
-  { 405.9490672806591 , 357.9196866039878 },
-  { 149.84131482235495 , 92.30841686476157 },
-  { 569.28673341646852 , 205.38001600794112 },
-  { 13.029229730048314 , 327.5773732010966 },
-  { 18.783268790941037 , 6.7882879106416 },
-  { 214.79774878410143 , 156.14092674072486 },
-  { 557.9724349105504 , 104.38460256402628 },
-  { 238.40353608274134 , 409.3590068081694 },
-  { 323.64373572371622 , 109.67407911291299 },
-  { 557.2525512189046 , 322.3352298525043 },
-  { 798.34995132159574 , 67.77126963607145 },
-  { 715.198966457759056 , 124.79504659173654 },
-  { 6.44965826819697 , 440.39969371208474 },
-  { 12.232351553299385 , 162.64185913096034 },
-  { 47.35943000090515 , 506.5527882116738 },
-  { 315.4848121736086 , 551.3703717871138 },
-  { 894.84131482235495 , 211.29841686476158 },
-  { 104.6362760192985 , 563.7012492846466 },
-  { 781.74539512336497 , 342.844784209719435 },
-  { 725.87498696901116 , 49.15713264093435 },
-  { 108.14663512251822 , 288.5856687647695 },
-  { 340.25551616871167 , 16.35904367226955 },
-  { 732.55795840820142 , 587.2162976815197 },
-  { 38.663371910792506 , 611.8551821816656 },
-  { 867.00348245432218 , 21.60153998484408 },
-  { 831.05927989374612 , 556.41440369761239 },
-  { 85.3216323749252 , 105.43546866896601 },
-  { 493.8199326420899 , 312.36668234605503 },
-  { 552.70209456234699 , 460.59645746150414 },
-  { 868.09477280919248 , 457.579925056676615 },
-  { 737.2071533724013 , 475.85404367226954 },
-  { 984.800488374474 , 163.75402717137257 },
-  { 886.78622157124587 , 110.38917390310846 },
-  { 329.7724046497249 , 268.09309505297358 },
-  { 604.6243837632034 , 371.05600853372243 },
-  { 836.029174467468465 , 181.61461643627726 },
-  { 637.5922857611909 , 15.957799780471106 },
-  { 637.0653757528705 , 586.92116496395136 },
-  { 648.2598688818763 , 513.0335949390552 },
-  { 239.6442077730626 , 289.362880724342 },
-  { 416.3837374013813 , 263.6256866164163 },
-  { 222.9908559239197 , 505.17574813368566 },
-  { 340.2242242640137 , 434.9805887757982 },
-  { 155.3938755623052 , 2.2031773629658886 },
-  { 274.57954198074464 , 193.03425092420272 },
-  { 896.53507426012025 , 357.4145450114568 },
-  { 305.7121829655358 , 380.2491711148605 },
-  { 815.51492673852323 , 237.0477916026654 },
-  { 2.77351787670598 , 64.92144605169179 },
-  { 477.01118548792834 , 399.1548818205117 },
-  { 401.07905501590466 , 629.8744476040849 },
-  { 537.934523645956 , 518.1267590671707 },
-  { 668.6768796396027 , 338.0394787683423 },
-  { 420.5467462478923 , 495.5079505312206 },
-  { 983.30801259957377 , 68.52082642870185 },
-  { 627.16868305243 , 108.86102661268194 },
-  { 845.55019474731752 , 622.72858191943673 },
-  { 209.4717332991862 , 226.6907931612185 },
-  { 699.6554758168179 , 418.0449543306862 },
-  { 726.72404185341452 , 188.59809505297358 }
-},
-{ //#23
-  { 474.148761984342 , 377.63516566620166 },
-  { 970.3580590723004 , 402.42447481116017 },
-  { 233.87276139569906 , 31.272846524433 },
-  { 375.4459879794489 , 319.23757250661225 },
-  { 562.2132258439225 , 457.4380586169093 },
-  { 471.26730203395346 , 139.369381560051 },
-  { 253.17578454137774 , 683.0868714717483 },
-  { 153.87276139569906 , 192.282846524433 },
-  { 894.3267694052144 , 510.11064842741337 },
-  { 173.55593369073722 , 511.5136742553034 },
-  { 514.945640161091 , 252.69965159606545 },
-  { 273.210364735111 , 382.4551210553557 },
-  { 559.6941048175086 , 38.98923241069156 },
-  { 53.17578454137774 , 423.0868714717483 },
-  { 167.58154169908164 , 55.74427097266437 },
-  { 632.9516637665087 , 512.7546319823554 },
-  { 55.723936191177785 , 494.9534669720652 },
-  { 174.0620965210486 , 597.3913088162833 },
-  { 659.5846238728361 , 95.09893661322496 },
-  { 436.32110651575874 , 448.826267893866 },
-  { 582.3984671773636 , 595.7930509691291 },
-  { 621.8931437302289 , 200.53786883963318 },
-  { 209.6688815203164 , 375.5559989594424 },
-  { 409.8130554044942 , 200.0497724808095 },
-  { 466.45817316856846 , 562.5599769255056 },
-  { 891.8525412380176 , 368.70188544616576 },
-  { 716.57712375555406 , 75.47902796599547 },
-  { 361.0173481208687 , 473.3742184362741 },
-  { 554.9009040343279 , 309.2068854461657 },
-  { 346.0345441521314 , 154.32534295529513 },
-  { 504.104025857579 , 454.1423995163019 },
-  { 341.5717727148959 , 517.879963280741 },
-  { 652.0278053478197 , 17.25584384319234 },
-  { 741.6544377714017 , 464.3570388227659 },
-  { 432.52794733509637 , 26.8621262494883 },
-  { 845.409407285485 , 280.1424209767644 },
-  { 701.06051860616395 , 595.2160509051815 },
-  { 33.7217104807237 , 156.5703998778365 },
-  { 350.73491175126196 , 729.790489455741 },
-  { 243.1751411184872 , 433.62535075081206 },
-  { 94.5554956067634 , 319.8004677171615 },
-  { 499.7410676764475 , 621.3872938114253 },
-  { 882.15442487379767 , 106.3507851326543 },
-  { 735.6838466422705 , 235.32717798459163 },
-  { 397.43419397078907 , 622.9418973550247 },
-  { 84.7638162300043 , 255.08187431207625 },
-  { 309.4500625139426 , 23.15460369109184 },
-  { 666.6416083866465 , 366.8274496542593 },
-  { 955.955414046585 , 529.2366396921673 },
-  { 3.81332856598044 , 288.547778685108 },
-  { 135.64668629132484 , 149.3367316331593 },
-  { 313.8278009946799 , 235.1624490603018 },
-  { 839.1253395213488 , 396.10717866135485 },
-  { 846.9291939707891 , 539.8935345587144 },
-  { 275.258624400562 , 309.8078821718484 },
-  { 356.3413559924475 , 396.85541859013705 },
-  { 977.11241421138743 , 459.25117399372556 },
-  { 782.351414625723 , 576.1710637700811 },
-  { 524.104025857579 , 135.1523995163019 },
-  { 154.87220440524015 , 416.01727921113763 },
-  { 478.75134982125104 , 284.9604302729743 },
-  { 218.3864753964193 , 536.8775743837899 },
-  { 57.80059803315013 , 613.9253442187241 },
-  { 778.1996226517914 , 152.71182177568596 },
-  { 420.121216825807 , 709.8140965949804 },
-  { 410.26254440701456 , 286.53343443402775 },
-  { 416.4612652712304 , 517.7061646187184 },
-  { 397.3752135602761 , 100.71161215093866 },
-  { 570.3897483639544 , 379.0725472757096 },
-  { 721.6003038739334 , 414.7213156564919 },
-  { 780.4323112986881 , 341.61675879921773 },
-  { 532.9271788611321 , 534.9295264194867 },
-  { 236.7066332805918 , 206.73031719604955 },
-  { 776.1724808989524 , 674.320546633198 },
-  { 641.9360233571384 , 440.7026067995401 },
-  { 635.6335714582278 , 280.3367092587573 },
-  { 175.01893647583057 , 308.1728067182471 },
-  { 858.0442207827173 , 439.61762673236063 },
-  { 310.8590733501843 , 611.7604077148101 },
-  { 255.65724662114314 , 136.7675069271289 },
-  { 285.1065773464971 , 524.3584079678014 }
-},
-{ //#24
-  { 706.7370125016047 , 308.72738064106943 },
-  { 599.7895089324668 , 256.56559788463716 },
-  { 515.6508730390796 , 340.70423377802445 },
-  { 415.85746215925354 , 275.89763500158637 },
-  { 643.6819192504956 , 409.6366236027226 },
-  { 525.1447121245589 , 420.0072854322665 },
-  { 534.3946692851904 , 265.5269731720425 },
-  { 308.90995859011565 , 328.05941775801864 },
-  { 436.71790934100375 , 499.62713628290703 },
-  { 418.1037723458667 , 617.1521719303224 },
-  { 591.2815240320239 , 279.941094283665 },
-  { 639.4566033594741 , 321.38939442793566 },
-  { 753.2473062715158 , 356.1787035728941 },
-  { 296.93994765225136 , 280.05032611421694 },
-  { 218.87548379267085 , 190.24743316350936 },
-  { 497.51612446036006 , 353.1986532326651 },
-  { 673.0470678814669 , 350.330997456301 },
-  { 408.7549291132433 , 395.26787334186133 },
-  { 824.5690100011641 , 325.2875879243076 },
-  { 630.5863871092157 , 371.50111195477336 },
-  { 626.5564348888432 , 372.5058918934323 },
-  { 709.3971705297555 , 225.12446226726064 },
-  { 400.06158687684285 , 404.54471543461995 },
-  { 591.7671257438848 , 258.7151889813907 },
-  { 720.4980110486474 , 382.9750846374193 },
-  { 516.5964926927343 , 344.9805263773354 },
-  { 787.8879973654414 , 395.7511575967345 },
-  { 695.3929858856537 , 271.70770107494735 },
-  { 857.3183052240324 , 413.8662002860058 },
-  { 594.9229875542894 , 268.03040378674814 },
-  { 330.69046525366275 , 305.46498039115374 },
-  { 184.43269234168866 , 241.31097141535986 },
-  { 615.5853842148774 , 150.84812925582548 },
-  { 575.0916461395117 , 153.71294822472726 },
-  { 210.57516098185738 , 308.94757950392585 },
-  { 674.5428384049299 , 179.60360100319298 },
-  { 499.90655739997044 , 318.78257566525997 },
-  { 383.5167743886549 , 294.0431635748548 },
-  { 671.4982143541258 , 420.49056968713967 },
-  { 514.9971009469791 , 373.747837257871 },
-  { 705.0722269440655 , 245.1517851387066 },
-  { 66.32962575788777 , 226.80973824358134 },
-  { 891.958996317958 , 338.0636608836229 },
-  { 100.04855545222411 , 196.47488859685723 },
-  { 673.0470678814669 , 350.330997456301 },
-  { 541.7798434152875 , 555.4895575388002 },
-  { 847.2733723610191 , 208.48376936587007 },
-  { 401.01094660476804 , 337.7378228273286 },
-  { 937.0762653117268 , 364.0269426231647 },
-  { 124.7879675426293 , 312.8646716081727 },
-  { 549.435402245379 , 458.52488891043845 },
-  { 734.7661170504565 , 247.22312406472713 },
-  { 571.4944756086195 , 239.09860100319298 },
-  { 783.5531042997565 , 282.06584167576614 },
-  { 695.3929858856537 , 152.71770107494734 },
-  { 895.3671292470717 , 241.36886482144484 },
-  { 529.0855331388962 , 440.7557520548433 },
-  { 303.89692353801433 , 382.4699663584099 },
-  { 557.3605638740072 , 200.265997663781 },
-  { 404.876918059443 , 390.3925452701222 },
-  { 535.3129885722441 , 559.58268039529 },
-  { 199.8419663320501 , 261.2814873732953 },
-  { 69.49717827155244 , 272.10784959210883 },
-  { 471.7198834151466 , 170.83570092730264 },
-  { 483.39972592115123 , 281.3050099750423 },
-  { 728.0113075248926 , 342.6494979146761 },
-  { 564.7209843099678 , 35.17574109879045 },
-  { 429.9658184679722 , 596.1865343931215 },
-  { 461.6305434750709 , 446.7251000911983 },
-  { 400.2067096814187 , 320.24111428693027 },
-  { 689.0440715767083 , 61.50053441939208 },
-  { 99.1277147265525 , 341.19026744328187 },
-  { 404.78151123174234 , 229.76297914969106 },
-  { 331.31863770964776 , 529.6481708091374 },
-  { 289.39569036623584 , 500.57303294221083 },
-  { 636.3415642944442 , 148.38958212648868 },
-  { 403.4700232537357 , 268.30660267724977 },
-  { 142.6907577686194 , 307.5616235457593 },
-  { 543.8689663406792 , 223.27241545750888 },
-  { 80.51357773141541 , 223.66523179586645 },
-  { 534.888102424071 , 352.9597005195345 }
-},
-{ //#24  25
-  { 706.7370125016047 , 308.72738064106943 },
-  { 199.7895089324668 , 25.56559788463716 },
-  { 115.6508730390796 , 540.70423377802445 },
-  { 415.85746215925354 , 25.89763500158637 },
-  { 643.6819192504956 , 409.6366236027226 },
-  { 965.1447121245589 , 420.0072854322665 },
-  { 934.3946692851904 , 165.5269731720425 },
-  { 298.90995859011565 , 598.05941775801864 },
-  { 436.71790934100375 , 499.62713628290703 },
-  { 418.1037723458667 , 697.1521719303224 },
-  { 891.2815240320239 , 29.941094283665 },
-  { 639.4566033594741 , 321.38939442793566 },
-  { 753.2473062715158 , 624.1787035728941 },
-  { 296.93994765225136 , 280.05032611421694 },
-  { 218.87548379267085 , 190.24743316350936 },
-  { 497.51612446036006 , 353.1986532326651 },
-  { 873.0470678814669 , 550.330997456301 },
-  { 4.7549291132433 , 395.26787334186133 },
-  { 824.5690100011641 , 325.2875879243076 },
-  { 830.5863871092157 , 657.50111195477336 },
-  { 826.5564348888432 , 472.5058918934323 },
-  { 679.3971705297555 , 225.12446226726064 },
-  { 400.06158687684285 , 404.54471543461995 },
-  { 591.7671257438848 , 258.7151889813907 },
-  { 720.4980110486474 , 382.9750846374193 },
-  { 506.5964926927343 , 94.9805263773354 },
-  { 787.8879973654414 , 395.7511575967345 },
-  { 695.3929858856537 , 471.70770107494735 },
-  { 857.3183052240324 , 413.8662002860058 },
-  { 594.9229875542894 , 638.03040378674814 },
-  { 330.69046525366275 , 192.46498039115374 },
-  { 184.43269234168866 , 241.31097141535986 },
-  { 615.5853842148774 , 150.84812925582548 },
-  { 345.0916461395117 , 53.71294822472726 },
-  { 210.57516098185738 , 308.94757950392585 },
-  { 784.5428384049299 , 139.60360100319298 },
-  { 229.90655739997044 , 468.78257566525997 },
-  { 333.5167743886549 , 466.0431635748548 },
-  { 631.4982143541258 , 504.49056968713967 },
-  { 214.9971009469791 , 573.747837257871 },
-  { 755.0722269440655 , 545.1517851387066 },
-  { 66.32962575788777 , 226.80973824358134 },
-  { 891.958996317958 , 338.0636608836229 },
-  { 100.04855545222411 , 196.47488859685723 },
-  { 673.0470678814669 , 650.330997456301 },
-  { 541.7798434152875 , 555.4895575388002 },
-  { 847.2733723610191 , 208.48376936587007 },
-  { 401.01094660476804 , 337.7378228273286 },
-  { 987.0762653117268 , 564.0269426231647 },
-  { 104.7879675426293 , 392.8646716081727 },
-  { 549.435402245379 , 458.52488891043845 },
-  { 734.7661170504565 , 247.22312406472713 },
-  { 71.4944756086195 , 29.09860100319298 },
-  { 283.5531042997565 , 122.06584167576614 },
-  { 695.3929858856537 , 152.71770107494734 },
-  { 895.3671292470717 , 241.36886482144484 },
-  { 29.0855331388962 , 440.7557520548433 },
-  { 303.89692353801433 , 382.4699663584099 },
-  { 557.3605638740072 , 200.265997663781 },
-  { 204.876918059443 , 390.3925452701222 },
-  { 635.3129885722441 , 559.58268039529 },
-  { 199.8419663320501 , 121.2814873732953 },
-  { 6.49717827155244 , 272.10784959210883 },
-  { 471.7198834151466 , 170.83570092730264 },
-  { 483.39972592115123 , 281.3050099750423 },
-  { 828.0113075248926 , 42.6494979146761 },
-  { 564.7209843099678 , 35.17574109879045 },
-  { 429.9658184679722 , 596.1865343931215 },
-  { 461.6305434750709 , 446.7251000911983 },
-  { 200.2067096814187 , 620.24111428693027 },
-  { 689.0440715767083 , 61.50053441939208 },
-  { 99.1277147265525 , 341.19026744328187 },
-  { 404.78151123174234 , 229.76297914969106 },
-  { 331.31863770964776 , 529.6481708091374 },
-  { 19.39569036623584 , 560.57303294221083 },
-  { 636.3415642944442 , 4.38958212648868 },
-  { 403.4700232537357 , 108.30660267724977 },
-  { 142.6907577686194 , 457.5616235457593 },
-  { 243.8689663406792 , 22.27241545750888 },
-  { 80.51357773141541 , 93.66523179586645 },
-  { 564.888102424071 , 352.9597005195345 }
-},
-{ //#26
-  { 415.15670086169376 , 187.84701394190105 },
-  { 467.3184836181261 , 294.7945175110389 },
-  { 450.7582763348879 , 632.6265150105984 },
-  { 753.8115805970648 , 185.263644998733 },
-  { 402.7248456481627 , 247.90584731512828 },
-  { 742.66059573322804 , 98.23986804306796 },
-  { 795.47342026719394 , 472.82580315451497 },
-  { 56.2317486692241 , 507.43671982743416 },
-  { 91.4923365788189 , 221.04693681611866 },
-  { 854.3633697381212 , 49.8422748834785 },
-  { 76.2317486692241 , 337.43671982743416 },
-  { 294.9473681356767 , 235.44238271688982 },
-  { 266.6857378023808 , 121.25352593629266 },
-  { 871.432665812278 , 544.29075443016262 },
-  { 526.8134836181262 , 191.74615471472856 },
-  { 165.5291030845788 , 593.7404918252729 },
-  { 659.3016476512309 , 14.91356348482617 },
-  { 576.6158380334808 , 251.09828950887757 },
-  { 277.37035368339303 , 158.32456998273645 },
-  { 385.0180350266286 , 622.892208297015 },
-  { 484.21077344979625 , 139.86766293142972 },
-  { 234.02143482887178 , 289.29679697752965 },
-  { 493.72080903152164 , 571.28980145660444 },
-  { 875.8754430038678 , 320.1539170568334 },
-  { 850.5988736463378 , 126.51597032523675 },
-  { 785.19574739810986 , 296.15570747653925 },
-  { 6.24655440012185 , 74.00432052317305 },
-  { 138.96769769968535 , 129.4215164037159 },
-  { 484.8114459064546 , 388.0856095205769 },
-  { 353.8723203281464 , 85.85267683135673 },
-  { 460.05443264858735 , 86.77931408732059 },
-  { 355.21304634327976 , 437.33619158775605 },
-  { 346.5391030845788 , 293.7404918252729 },
-  { 582.2823476564017 , 456.3354696819879 },
-  { 632.8015805970648 , 185.263644998733 },
-  { 577.23670717951 , 66.11691742673244 },
-  { 343.5016584986025 , 204.38988395729353 },
-  { 342.8577027825204 , 20.175404183487487 },
-  { 108.20259797295296 , 31.124539556202294 },
-  { 649.47342026719394 , 291.815803154515 },
-  { 663.4333325202383 , 369.31169272632275 },
-  { 946.8266832986463 , 556.29942648968907 },
-  { 818.17778262704894 , 5.01198459607744 },
-  { 526.3056645567539 , 16.62330638442372 },
-  { 697.9002185670281 , 149.10395239833323 },
-  { 485.4642097467537 , 327.5835871854789 },
-  { 692.1497409269356 , 252.82580315451494 },
-  { 520.9642620427533 , 51.237492415405356 },
-  { 202.7573100668468 , 476.8033172897626 },
-  { 555.8202104091716 , 356.76409375470524 },
-  { 405.6804316872166 , 335.7099337660923 },
-  { 375.87544300386776 , 505.09911296436337 },
-  { 589.2141222041643 , 148.7083941653525 },
-  { 975.38851180727386 , 169.6511190958821 },
-  { 637.6283018987962 , 69.78284205375988 },
-  { 359.31523572062963 , 387.2671154648039 },
-  { 306.4050444860683 , 561.36639833158085 },
-  { 526.3056645567539 , 16.62330638442372 },
-  { 471.9567408014997 , 500.9099082325473 },
-  { 127.0485146634211 , 313.9264616234855 },
-  { 35.0408152165206 , 138.07204312534014 },
-  { 469.1161327824414 , 419.5655375213129 },
-  { 296.54581521652057 , 35.023680329029816 },
-  { 781.5363991040392 , 354.8104595545442 },
-  { 257.0485146634211 , 432.91646162348553 },
-  { 840.3928544474022 , 218.09124361695876 },
-  { 413.77429647612337 , 29.628105523889886 },
-  { 212.8085506722922 , 65.38269097252031 },
-  { 943.8924679881741 , 118.09213504488952 },
-  { 18.62384166928234 , 397.9995709824227 },
-  { 237.06893796986162 , 540.1487049673125 },
-  { 286.7085544405576 , 333.63327192412 },
-  { 184.62176128077465 , 190.86794416633046 },
-  { 133.7247109575526 , 430.72781183697214 },
-  { 238.70671302180867 , 356.05085682257123 },
-  { 895.9169283037397 , 387.6085485232089 },
-  { 592.6530094859455 , 574.8726768079247 },
-  { 922.2487815795656 , 232.69948130918908 },
-  { 199.12299445255314 , 398.97101075013137 },
-  { 32.3552608622373 , 600.46279687443342 },
-  { 3.41881432021074 , 297.38616143859116 }
-},
-{ //#27
-  { 638.7807347508151 , 184.9986707669923 },
-  { 332.7598684376412 , 689.01900033100097 },
-  { 215.2660324274165 , 576.1502990537195 },
-  { 767.4278151838488 , 169.2027954845816 },
-  { 227.7038742716345 , 394.48845938359034 },
-  { 814.7276512272996 , 475.63944424742704 },
-  { 253.6371122718072 , 103.99210462954008 },
-  { 441.60824015091407 , 315.5042980076023 },
-  { 853.6371122718072 , 134.4134863396232 },
-  { 121.67313348873915 , 281.66120264739624 },
-  { 856.6127322503745 , 10.55887805023048 },
-  { 751.6725579761905 , 374.7302012857739 },
-  { 552.694975099816 , 272.86209569120695 },
-  { 720.8756797994416 , 489.66571535591015 },
-  { 756.6127322503745 , 320.5488780502305 },
-  { 325.8158540736256 , 616.4943921203667 },
-  { 202.4923011137125 , 199.99967366133058 },
-  { 759.4398046828504 , 252.1614564177629 },
-  { 326.5532994206559 , 432.82381021090544 },
-  { 699.1779550224378 , 71.7318937346345 },
-  { 137.3460765880297 , 505.5751943324924 },
-  { 633.3432561198606 , 241.6115587893465 },
-  { 231.1436669883964 , 512.3204568831497 },
-  { 826.3510550299588 , 706.0268229675745 },
-  { 932.5741657338298 , 243.80348064689673 },
-  { 68.6635583168472 , 356.95582401505783 },
-  { 461.5444562535208 , 591.2334120877485 },
-  { 232.6679461421189 , 342.27122396397874 },
-  { 938.1650799772741 , 601.7237998218958 },
-  { 666.2750776355131 , 447.8876976193808 },
-  { 566.8048925358764 , 142.96437803102214 },
-  { 379.4844211591766 , 125.3310008466254 },
-  { 670.1468178197646 , 370.513275377548 },
-  { 590.5820190206981 , 324.9013475911932 },
-  { 876.5051218963382 , 407.2431709795836 },
-  { 972.1050382461356 , 290.2965776258354 },
-  { 842.2056370849411 , 291.7549800299614 },
-  { 695.8178455789865 , 264.23243482510895 },
-  { 434.11097533295725 , 399.9993629772671 },
-  { 656.1563030062846 , 318.21646931620074 },
-  { 818.1498322690968 , 73.80855557660686 },
-  { 649.4844211591765 , 15.495971832621024 },
-  { 922.6159871906339 , 391.0862557972931 },
-  { 7.753381719406 , 354.03532777581654 },
-  { 539.8464093597655 , 6.20279548458169 },
-  { 726.0092390756578 , 725.5752094518317 },
-  { 319.8428000896995 , 14.7250929241908 },
-  { 824.5597902306253 , 621.0306828020732 },
-  { 34.6663827114833 , 524.4550245008686 },
-  { 719.4439897992098 , 631.0206032235662 },
-  { 689.0878981948131 , 149.67097683250003 },
-  { 334.9534165962027 , 470.30668625737394 },
-  { 500.26652895189227 , 241.61155878934653 },
-  { 326.8946712208073 , 197.7575042012039 },
-  { 233.8680467593693 , 266.6346402578591 },
-  { 310.0395353985027 , 129.1659768325 },
-  { 450.3852768170266 , 101.72194970978376 },
-  { 462.9575140222865 , 179.6668655368519 },
-  { 884.7266057877303 , 538.3732833011571 },
-  { 550.5445353985027 , 86.11761403618968 },
-  { 656.8889527366223 , 560.1095792080815 },
-  { 465.8475585441814 , 17.9316389835049 },
-  { 96.9325493722877 , 213.42210171890582 },
-  { 768.3368227764147 , 563.1126953915623 },
-  { 539.9882391368943 , 359.24966123611154 },
-  { 511.0943689320009 , 452.3540480603076 },
-  { 572.750316843235 , 644.2482151014688 },
-  { 427.8835198996094 , 518.8262913177139 },
-  { 535.5340456880062 , 189.49087145776156 },
-  { 320.763890527086 , 344.7162958985053 },
-  { 614.5376593976741 , 97.7185272229153 },
-  { 818.1936365341292 , 199.00539167823203 },
-  { 9.6593862491433 , 277.59277961605517 },
-  { 842.9112623131971 , 343.19482546801504 },
-  { 781.6782753295188 , 421.5563261946504 },
-  { 494.4738064323095 , 507.65467425755065 },
-  { 928.6669046527705 , 714.1906745487215 },
-  { 595.0109406684061 , 447.8007273474804 },
-  { 400.3837413777265 , 256.2894931149501 },
-  { 578.2567494773525 , 543.889304408838 },
-  { 940.7315842296593 , 493.82491193623923 }
-},
-{ //#28
-  { 458.85320352458 , 322.734488186574 },
-  { 977.7022186607433 , 129.7582651422391 },
-  { 260.17718301332786 , 391.14412814710204 },
-  { 565.8007070937178 , 424.89627094300636 },
-  { 878.5153433431987 , 403.58196999132014 },
-  { 361.3823017746329 , 254.4846280251631 },
-  { 287.0979212410855 , 172.49029091461875 },
-  { 500.29981628163506 , 278.63731913779367 },
-  { 177.5197835124118 , 476.73837098939816 },
-  { 183.29410268264797 , 175.19465327447384 },
-  { 497.34227168364544 , 397.3545145579722 },
-  { 326.3535605867664 , 650.529473560458 },
-  { 145.7966538136273 , 628.3460391784373 },
-  { 478.72813468850836 , 514.8795502053877 },
-  { 275.707881550199 , 348.4738846086918 },
-  { 38.84915024448941 , 306.18425642200503 },
-  { 677.56882299103256 , 84.24043075320773 },
-  { 371.74541118252375 , 500.7481848652805 },
-  { 418.99688853528033 , 427.60063330286147 },
-  { 858.82436377165226 , 537.6824917310862 },
-  { 827.8453903673138 , 432.16393243883874 },
-  { 207.08103434717464 , 256.351702067893 },
-  { 433.56463991663645 , 634.8201992165228 },
-  { 316.03960426922106 , 533.4343362116599 },
-  { 595.1179176998239 , 539.6189622957928 },
-  { 432.0819227206523 , 551.44789130275 },
-  { 718.65538511933687 , 276.3121018522595 },
-  { 308.398244051899 , 271.19043725503525 },
-  { 688.8833172714877 , 612.8765212447929 },
-  { 106.80880500604664 , 84.04302498774666 },
-  { 686.3206825948089 , 204.61698957378496 },
-  { 757.24472303052596 , 149.42269395087936 },
-  { 655.6036000444254 , 296.8318070834259 },
-  { 219.97144126834388 , 350.8102881056758 },
-  { 38.31652314898844 , 478.19033235374997 },
-  { 626.8173136870209 , 181.37631861384506 },
-  { 473.19632672194814 , 213.7876511708418 },
-  { 653.22936786028686 , 376.77648362158675 },
-  { 389.14818799490786 , 335.122616814395 },
-  { 519.869810117883 , 23.53810137027736 },
-  { 504.51632656017046 , 136.40221350964003 },
-  { 754.7789589680781 , 520.92708090109716 },
-  { 115.26402671812633 , 530.3521151101822 },
-  { 835.6893982197237 , 142.6296689429879 },
-  { 245.82038904603172 , 618.85895737845567 },
-  { 777.77387939070604 , 367.9901972641823 },
-  { 990.95318518741675 , 215.2438096614493 },
-  { 597.56882299103256 , 84.24043075320773 },
-  { 934.536003786783 , 446.5281973029141 },
-  { 10.77060421511914 , 373.2706383539141 },
-  { 835.09326013814723 , 228.2888843426203 },
-  { 370.75162605158727 , 39.8918214385735 },
-  { 893.5495275481126 , 290.84075063523693 },
-  { 938.50864839428067 , 34.43962627613195 },
-  { 702.73185800127067 , 438.1482955373769 },
-  { 574.0652158532989 , 331.8948780867937 },
-  { 401.26952211447394 , 178.78706620484405 },
-  { 953.483290533285 , 323.31852368314765 },
-  { 565.8007070937178 , 218.7673432238454 },
-  { 328.3263341817707 , 112.34859033382517 },
-  { 155.59006469345331 , 293.5394404019993 },
-  { 938.9865991942907 , 621.75260225278345 },
-  { 148.75772762574832 , 185.35479963609498 },
-  { 138.78042881355475 , 364.23111567883547 },
-  { 210.9012827737609 , 548.2672954885178 },
-  { 530.94009426466636 , 631.2202651035073 },
-  { 807.5834636119042 , 604.5761984339795 },
-  { 90.3828356539653 , 255.52834167394238 },
-  { 736.0716513709727 , 15.65014938422726 },
-  { 238.8283279774722 , 98.3483171723389 },
-  { 791.3093918221687 , 293.52963435034474 },
-  { 95.95203062763136 , 427.154536334445 },
-  { 869.71447303821435 , 90.13020272434824 },
-  { 635.7412742639992 , 471.1612031036814 },
-  { 194.01771485219842 , 38.39234828637055 },
-  { 331.16489103572087 , 414.1608405860997 },
-  { 232.51771027739647 , 480.6992041700839 },
-  { 442.3062517993089 , 82.39259043522723 },
-  { 51.286992088707436 , 187.8460960921342 },
-  { 7.59132867775487 , 126.79706011488442 },
-  { 272.12625684697 , 9.47126509479716 }
-},
-{ //#29
-  { 601.8325850311838 , 425.1189883060178 },
-  { 598.6663701572236 , 761.8889204666928 },
-  { 400.0089706563075 , 607.4831633089889 },
-  { 557.4057248560806 , 574.3961757772555 },
-  { 108.0418821191422 , 459.9082974509763 },
-  { 628.3927923144221 , 522.9509858055773 },
-  { 420.44876337306937 , 449.6511658094294 },
-  { 757.9236648267279 , 696.45788882663845 },
-  { 575.9701637752908 , 320.05705423173407 },
-  { 596.1063459787226 , 640.10540450026866 },
-  { 681.4383671501265 , 655.30626053991125 },
-  { 449.81942520261316 , 331.1139586834926 },
-  { 792.4681763571471 , 167.671602469234 },
-  { 759.9932120045625 , 486.2857394643711 },
-  { 464.02155255513355 , 565.9291637641502 },
-  { 348.56606408555274 , 707.1428774067458 },
-  { 514.6857832417434 , 642.0513913422784 },
-  { 523.4729689336616 , 162.0955095868668 },
-  { 193.6014544857 , 310.73365130242723 },
-  { 182.2182677442659 , 492.2724724539473 },
-  { 597.6617329697826 , 71.48149466742115 },
-  { 846.350467610283 , 416.8380379759979 },
-  { 922.8357652868843 , 507.9896662627251 },
-  { 682.0101760595984 , 352.46617141641065 },
-  { 110.4868751784231 , 337.3073155316039 },
-  { 166.495858898223 , 657.4522189773558 },
-  { 204.38627024470648 , 565.7122651707091 },
-  { 95.4730051936085 , 583.0700628543137 },
-  { 465.3699023498607 , 876.5967427586453 },
-  { 250.66640641717046 , 23.2766519744877 },
-  { 537.8077441940788 , 724.93490308851614 },
-  { 207.00757688922437 , 408.48176954190575 },
-  { 116.667140629612 , 231.8710791790493 },
-  { 49.04651930658304 , 373.4621176831377 },
-  { 455.73908948638208 , 222.2506287546933 },
-  { 782.3476101117797 , 388.3613537910203 },
-  { 651.9687672346157 , 265.04347042598494 },
-  { 400.5168464717268 , 518.5224344461134 },
-  { 360.7168262208917 , 270.572251705768 },
-  { 518.54151930658304 , 260.41375488682735 },
-  { 593.5711586471105 , 198.80378528196513 },
-  { 363.58634211717623 , 784.5892317351457 },
-  { 642.2032468607276 , 836.581781180081 },
-  { 698.3305976130403 , 572.7335365435177 },
-  { 218.9053043603424 , 695.4806965940182 },
-  { 677.6682009524523 , 455.5512620125951 },
-  { 719.9932120045625 , 229.05746547409694 },
-  { 25.70891596717104 , 256.27984315221505 },
-  { 993.9867501507209 , 220.96588930705997 },
-  { 422.4863120233449 , 155.63012018357824 },
-  { 874.3737412042631 , 319.0838284330358 },
-  { 971.5693606714209 , 321.46000664423445 },
-  { 680.3733611539219 , 26.63066269054184 },
-  { 846.21568932944587 , 245.5914598182245 },
-  { 519.4887237183858 , 476.4457726041409 },
-  { 888.4271294522554 , 695.8099152226569 },
-  { 369.1693596456567 , 391.53426597276786 },
-  { 515.4136680449093 , 393.7713581844087 },
-  { 769.9097682675616 , 586.6995141208911 },
-  { 878.9832120045625 , 486.2857394643711 },
-  { 339.8289125224288 , 170.03587734128217 },
-  { 299.51390538441075 , 465.4686538955098 },
-  { 440.1111600336574 , 686.833440340352 },
-  { 207.45376053274134 , 121.23919749805594 },
-  { 395.53672148309806 , 35.1590471952541 },
-  { 109.89178059901269 , 751.1681432616955 },
-  { 257.9059040725066 , 261.9843964807674 },
-  { 307.6385620798925 , 651.7162736713722 },
-  { 482.2047642036269 , 066.79949528273403 },
-  { 300.03341479852327 , 566.2538564788125 },
-  { 847.3024748596993 , 599.8101983854901 },
-  { 755.8738796187016 , 43.34809016773806 },
-  { 683.7004293534553 , 744.8997173750045 },
-  { 764.8689611970244 , 301.3807173018422 },
-  { 816.8148989737105 , 783.9693366987165 },
-  { 854.7326987030834 , 82.4908994345036 },
-  { 305.76945698614054 , 347.2938585856655 },
-  { 461.80122700527414 , 776.52809733556904 },
-  { 650.4884319973239 , 138.5826283331775 },
-  { 303.448318169536 , 100.49656232395927 },
-  { 132.9373038448413 , 171.7372721629818 }
-},
-{ //#30
-  { 402.58517514203714 , 121.60518356465589 },
-  { 37.5901751420372 , 605.85931772690628 },
-  { 787.49502260334003 , 288.10469349522344 },
-  { 897.907527908349 , 99.1301437906506 },
-  { 219.509765326074 , 775.83256571715776 },
-  { 520.5869827375157 , 150.53959863100863 },
-  { 780.4270948921389 , 166.79881796114967 },
-  { 442.1942764365012 , 555.2494564876453 },
-  { 682.101728830644 , 522.0934727065239 },
-  { 430.695607931403 , 367.3381931699052 },
-  { 709.3047080404601 , 424.0744248703249 },
-  { 855.7494476584507 , 23.936509394156815 },
-  { 852.96818717312544 , 453.89638999125071 },
-  { 283.01372029892605 , 110.19144370947086 },
-  { 503.8878172699726 , 526.7589359807521 },
-  { 485.17079325903643 , 446.4957853188792 },
-  { 919.2241156823227 , 268.77977012495063 },
-  { 862.6751413226109 , 389.9864198595526 },
-  { 434.2223523328572 , 3.4897778261024968 },
-  { 490.9007358685064 , 654.7281098881606 },
-  { 597.7579461632438 , 675.28196509829033 },
-  { 135.4140952688646 , 606.35722432005714 },
-  { 333.494941746067 , 599.0971228912624 },
-  { 312.91252790834903 , 185.38427795290102 },
-  { 463.86862411153976 , 185.57738523743797 },
-  { 166.08890170409904 , 441.3269723812057 },
-  { 42.31351110950357 , 500.44867200812723 },
-  { 851.5157645297092 , 203.7494718691166 },
-  { 497.1892764365012 , 760.5035906498957 },
-  { 449.3840035276995 , 848.558646467207694 },
-  { 267.3013073495732 , 386.93904264136415 },
-  { 196.34041750972267 , 42.47483803840176 },
-  { 93.8324850762591 , 402.8847950855054 },
-  { 820.16824453527033 , 631.3805172201932 },
-  { 346.8298627775654 , 739.244158768754446 },
-  { 558.7714667992559 , 580.05573214201689 },
-  { 595.1440412492879 , 444.5761951348423 },
-  { 304.30959141713123 , 821.48775663693561 },
-  { 668.2770942520034 , 151.24157474734594 },
-  { 477.18257365638357 , 71.36944741197962 },
-  { 64.18576606090505 , 305.02946894593526 },
-  { 184.84333183491347 , 151.86230130995813 },
-  { 984.9663795776468 , 203.96197492489802 },
-  { 158.98930097860895 , 290.64809359638934 },
-  { 277.73850991890555 , 699.25786036360682 },
-  { 287.2900865608737 , 493.54574886866806 },
-  { 113.62769650412366 , 33.481105931293754 },
-  { 714.5479203157478 , 681.55892751365772 },
-  { 211.3310099823053 , 351.01179572980413 },
-  { 684.3542090351671 , 262.2389497589426 },
-  { 485.1707932590364 , 446.4957853188791 },
-  { 35.86681651606114 , 95.64297017108527 },
-  { 730.84667578777857 , 574.2028589580667 },
-  { 185.03002111071285 , 515.21960528555235 },
-  { 113.35671832150952 , 182.9362109566215 },
-  { 620.4498161853193 , 537.76109472226096 },
-  { 762.8911842369557 , 757.7349856335588 },
-  { 238.19668830633236 , 609.44021517890263 },
-  { 403.77805703278204 , 261.078649365375 },
-  { 303.2570280086999 , 1.1463645793501485 },
-  { 373.51327259695 , 623.2310242133515 },
-  { 757.3442063080587 , 65.71051025517924 },
-  { 944.5757619488162 , 45.932892403704685 },
-  { 792.74072625625814 , 487.98822745503116 },
-  { 418.33427747241626 , 711.42212491990284 },
-  { 306.7499371423162 , 290.8203320773434 },
-  { 517.10108209818804 , 278.2180085306569 },
-  { 91.13139318421787 , 703.71088581932986 },
-  { 590.6106442030695 , 760.1499466837446 },
-  { 378.44796632593955 , 499.88679602187165 },
-  { 576.0652670381679 , 81.32064881943697 },
-  { 657.8958898163936 , 47.884783387103866 },
-  { 25.02583346223912 , 222.01896221723263 },
-  { 368.59660104309035 , 426.9879558419039 },
-  { 540.5869827375157 , 12.101699007865335 },
-  { 592.5536306234292 , 228.91473962804804 },
-  { 664.3629910608595 , 359.0979108341901 },
-  { 766.7084350579479 , 356.0822519178244 },
-  { 339.4610064638692 , 44.72005082489962 },
-  { 224.5990129129215 , 227.70171582464405 },
-  { 550.5132811903139 , 364.349019549231 }
-},
-{ //#19 31
-  { 430.9102163016844 , 128.44927814830652 },
-  { 435.06290741431496 , 247.3667926553087 },
-  { 837.0572445248592 , 308.65117318885603 },
-  { 523.3828142554493 , 53.566444817286325 },
-  { 691.1866328138868 , 616.27080717714139 },
-  { 549.7371446421312 , 134.67673358165442 },
-  { 579.6994468412545 , 419.73790813775804 },
-  { 313.38518065426894 , 109.83514115316947 },
-  { 482.895628282817 , 452.44227049761315 },
-  { 226.36140369860385 , 690.98612601700617 },
-  { 391.4496445138494 , 529.63803410387712 },
-  { 510.4215217605084 , 201.71469594584948 },
-  { 991.7314817526754 , 73.39235304810704 },
-  { 864.6199779731513 , 22.20413562788947 },
-  { 460.81896644084463 , 561.4141477442721 },
-  { 514.6827582649555 , 335.7935954388638 },
-  { 695.6774386509263 , 107.90980762527788 },
-  { 272.7494981734329 , 207.93835691469062 },
-  { 509.6844639030151 , 623.00101380463845 },
-  { 681.41521630168444 , 511.49764094461688 },
-  { 286.948411342071 , 581.53496752007621 },
-  { 191.57209455364537 , 527.1954231049646 },
-  { 257.0346871019839 , 264.29572991328166 },
-  { 124.7379998959445 , 4.29677756918532 },
-  { 384.68266791503277 , 65.26612200647291 },
-  { 314.72218381509555 , 368.36672886579834 },
-  { 25.63180054485024 , 103.96234906134107 },
-  { 12.576707293741201 , 204.8715920229942 },
-  { 380.0293532968215 , 443.97260529720144 },
-  { 798.36751362669236 , 400.41044714141952 },
-  { 745.2972895015669 , 19.483004841722703 },
-  { 942.589524260949 , 218.2749032290877 },
-  { 643.431158941862 , 242.09249938852352 },
-  { 575.1994956405451 , 528.6160587756073 },
-  { 555.9646000754791 , 15.849805241207676 },
-  { 789.2854112941325 , 467.1816825880183 },
-  { 12.0991509615643 , 464.0986228639893 },
-  { 659.4120998767286 , 311.89634455826706 },
-  { 140.76716085630773 , 273.6435255179222 },
-  { 200.23676672416602 , 161.39984415298625 },
-  { 70.30213871533226 , 528.0642109751377 },
-  { 209.80119641536572 , 73.15412851744672 },
-  { 304.1536644526618 , 514.31169940419966 },
-  { 689.2099356374898 , 427.5686876958582 },
-  { 257.5227593983758 , 4.773207078885761 },
-  { 455.5538521950717 , 655.63627683800416 },
-  { 804.7922895015669 , 122.53136763803305 },
-  { 9.93418133750698 , 36.0011399290404 },
-  { 237.03209301698269 , 453.70295834764084 },
-  { 901.2024742983417 , 126.52394462041495 },
-  { 572.458195216719 , 649.15163919702735 },
-  { 376.5127593983758 , 4.773207078885761 },
-  { 618.3925225398035 , 161.0310639683362 },
-  { 898.246622058797 , 391.33917413450928 },
-  { 431.9953104505755 , 364.51359444474923 },
-  { 113.48595025539424 , 441.81649877188505 },
-  { 776.0060031441624 , 237.98685610761385 },
-  { 174.84665024575145 , 9.27792461773326 },
-  { 924.9643468372481 , 290.7896623906043 },
-  { 332.3739727915116 , 191.86057437497823 },
-  { 10.00778553553971 , 297.96072729388476 },
-  { 726.2340861192945 , 211.31841093286204 },
-  { 96.19272230574835 , 383.9691323728243 },
-  { 115.99864519708746 , 555.80403287974804 },
-  { 573.4905917715806 , 288.3574315491985 },
-  { 630.9167603018664 , 52.28109381038749 },
-  { 382.21886243140517 , 336.8121103550245 },
-  { 739.3448760369487 , 323.587751359269 },
-  { 587.5857341049459 , 585.8818289284347 },
-  { 102.59657799809503 , 163.18341445996305 },
-  { 439.5591253456854 , 8.26817518199258 },
-  { 995.98252157461627 , 3.9657991956595 },
-  { 190.56731461498646 , 613.16547088459214 },
-  { 87.37864556133275 , 257.32553081698876 },
-  { 360.10974095572135 , 656.48939043242376 },
-  { 321.2722045022734 , 282.15610180026715 },
-  { 872.7395571541242 , 473.91025676629158 },
-  { 110.43387377345839 , 83.33538029340578 },
-  { 998.9964139133505 , 143.3329202183884 },
-  { 212.99654086418587 , 361.2647700129692 },
-  { 854.9439174824884 , 195.4947029748207 }
-},
-{ //#32
-  { 468.76026731113905 , 344.15902150415945 },
-  { 865.403475950897 , 691.7778170685498 },
-  { 768.7602673111391 , 34.1590215041595 },
-  { 531.8479395453907 , 24.0604881528133 },
-  { 758.7870193208876 , 512.2394313201227 },
-  { 786.5903060126724 , 371.23145157854134 },
-  { 632.9957801794574 , 292.11126693929305 },
-  { 360.44126255732635 , 335.0594584425738 },
-  { 11.94689001007373 , 243.87361583724476 },
-  { 692.9006276407601 , 384.3566427076102 },
-  { 148.94775679323203 , 57.9958631472841 },
-  { 895.2440499199987 , 134.47422800799842 },
-  { 820.94498312334144 , 457.423391428497 },
-  { 254.19908092379177 , 363.5269652134001 },
-  { 795.3036813703158 , 206.25482027285446 },
-  { 424.0573525390819 , 249.23133709538973 },
-  { 307.1176560778868 , 485.0546271647951 },
-  { 262.35216587436423 , 248.82571192825515 },
-  { 264.2554061678297 , 696.9154480281694 },
-  { 405.9760132303322 , 686.8381847294645 },
-  { 365.7089572346063 , 26.44450749264547 },
-  { 624.0933153137079 , 204.1556406915105 },
-  { 853.24539570099876 , 35.584182672056 },
-  { 717.3713562011008 , 285.7531672778891 },
-  { 777.7999013579897 , 595.33942742270403 },
-  { 339.3078059325213 , 560.3079856899436 },
-  { 164.10054757244558 , 426.6146374476517 },
-  { 721.08743189854493 , 430.76814278043025 },
-  { 692.9006276407601 , 199.86589117097583 },
-  { 347.86692103706014 , 181.2605473842712 },
-  { 56.13137366503702 , 405.6275560461856 },
-  { 360.4412625573263 , 633.25858456574514 },
-  { 474.2324771024648 , 217.61500876464743 },
-  { 684.92790704617795 , 621.9227917932977 },
-  { 886.16143115310103 , 391.7084963019307 },
-  { 352.08696452193567 , 256.44241583309037 },
-  { 530.9266944262005 , 436.52457460759166 },
-  { 464.2618331033424 , 439.9942595038804 },
-  { 812.0369593705253 , 295.3094945371147 },
-  { 65.2421904200002 , 474.8310798829823 },
-  { 157.73978332719776 , 265.45742609117934 },
-  { 15.307775353647457 , 632.8328874784609 },
-  { 454.04115348313803 , 587.2344313201227 },
-  { 93.1932188413076 , 200.89709901470943 },
-  { 551.7707740398417 , 281.9990889054935 },
-  { 181.9871013341476 , 157.7101613033446 },
-  { 774.51669913830045 , 104.31975897650386 },
-  { 251.98335150003632 , 155.61816356352375 },
-  { 438.6303785811124 , 138.53821460178534 },
-  { 251.27111133829737 , 48.463867523706 },
-  { 874.73337030997394 , 582.18250328849723 },
-  { 253.08432678374606 , 621.2651373473008 },
-  { 493.1457175678619 , 101.07086016448021 },
-  { 627.988192480743 , 536.83792950236682 },
-  { 215.147110165159 , 521.75395813160833 },
-  { 142.38331076828536 , 540.50200323068435 },
-  { 640.7659569538561 , 442.28100643475307 },
-  { 27.623394855609902 , 718.1878712432243 },
-  { 570.3435851966881 , 539.2090857180189 },
-  { 268.4124380864333 , 306.83651309751326 },
-  { 881.0854631023328 , 242.57367594335335 },
-  { 687.1809875479594 , 114.05710734016431 },
-  { 556.4470291298148 , 152.49327584419746 },
-  { 119.30536348381631 , 608.6421287872035 },
-  { 702.88425808619786 , 525.0995070049232 },
-  { 314.2324771024648 , 107.62500876464743 },
-  { 54.12729958219411 , 308.5342276316885 },
-  { 368.84594226352823 , 431.1253870724183 },
-  { 33.9720261599916 , 129.1309655896101 },
-  { 35.02773652060845 , 536.8532323855013 },
-  { 415.3710427051535 , 23.296185301771857 },
-  { 152.72569732875766 , 336.15444876707494 },
-  { 890.3515697162756 , 339.9395444670892 },
-  { 257.56930657826274 , 433.90566108335446 },
-  { 577.3961078931983 , 371.3652483139345 },
-  { 550.9221733050856 , 623.4399436157521 },
-  { 60.6338734690272 , 35.369833668634 },
-  { 630.0447045232256 , 70.75477648993883 },
-  { 490.3559641243381 , 546.20993147552895 },
-  { 887.29757454185204 , 498.27757607968294 },
-  { 416.6891109209979 , 494.64088730961 }
-},
-{ //#33
-  { 401.8078718988254 , 461.76489552159046 },
-  { 676.553737736575 , 116.7598955215905 },
-  { 486.52698572682647 , 514.8403053375536 },
-  { 509.39519259987173 , 107.25385073284224 },
-  { 599.1233607883982 , 51.181786292078 },
-  { 471.77639703548135 , 303.8970593726002 },
-  { 306.0356885541466 , 711.0832529407318 },
-  { 199.31286162104973 , 384.4742636437244 },
-  { 17.15489781859594 , 489.65822375209865 },
-  { 577.1117982709409 , 320.5805479436389 },
-  { 842.079703710299 , 446.6707415033298 },
-  { 582.7264073150886 , 721.1645154684481 },
-  { 362.6847264135034 , 316.8034215365065 },
-  { 190.76513622946663 , 206.83017354625503 },
-  { 68.29654066615056 , 537.8746661874293 },
-  { 279.67421968480073 , 244.6434889378406 },
-  { 240.284271343357 , 132.0932101743478 },
-  { 234.04888583144424 , 14.0096483462815 },
-  { 805.3976044697029 , 183.0630920415849 },
-  { 114.78032327501009 , 637.5594596835904 },
-  { 188.3779986684209 , 719.297959037849 },
-  { 456.83996645946735 , 637.8550890812813 },
-  { 51.69265104075856 , 727.6579930349366 },
-  { 882.79261782418087 , 218.5475592722494 },
-  { 305.6860630222643 , 196.8942426077281 },
-  { 531.1197978636926 , 601.2060512219244 },
-  { 582.7264073150886 , 458.17451546844813 },
-  { 575.510764938127 , 150.1898054379044 },
-  { 384.85817979317505 , 212.48552513538684 },
-  { 683.0972195428383 , 427.321598564859 },
-  { 924.55657213053655 , 501.181786292078 },
-  { 490.3655813691346 , 404.9173082737232 },
-  { 157.75684009754528 , 536.3131308523565 },
-  { 675.195558434288 , 206.67358804676394 },
-  { 126.7763570181662 , 31.436879773559 },
-  { 683.0972195428383 , 537.311598564859 },
-  { 402.2697574281701 , 675.540514526976 },
-  { 5.31908288307744 , 324.40995015152845 },
-  { 277.62292960699455 , 520.8377669042933 },
-  { 216.196426026491 , 486.83968476789323 },
-  { 240.9333893983983 , 316.3588198817836 },
-  { 10.50585995923907 , 583.938055156324 },
-  { 852.47526505786914 , 114.27673320850505 },
-  { 747.0462133372937 , 448.5823555391175 },
-  { 374.660991296928 , 115.5342365634204 },
-  { 737.9894439431814 , 357.6936505823385 },
-  { 229.83054783282023 , 598.47407564858014 },
-  { 295.0987940024421 , 610.2828809942578 },
-  { 138.95243723459737 , 357.56179909159977 },
-  { 616.981647204583 , 394.12205760588756 },
-  { 29.85812714018687 , 230.01206021611262 },
-  { 602.5082488671879 , 256.25700164814475 },
-  { 39.0192920724999 , 408.66717845018485 },
-  { 305.36657724552 , 403.435275686761 },
-  { 786.14684396586296 , 379.93545746084413 },
-  { 880.3971754779368 , 324.30252413489217 },
-  { 677.983630082648 , 301.4343172618468 },
-  { 144.35243101641314 , 427.1429796333275 },
-  { 144.03925147885212 , 267.7609122921716 },
-  { 308.5007137786876 , 63.234853021902424 },
-  { 431.3830632454701 , 35.42565898485947 },
-  { 400.9344772853796 , 370.090693769094 },
-  { 527.1773832045881 , 222.57874034816035 },
-  { 789.60404563092465 , 267.4805251353868 },
-  { 158.57763046210061 , 113.4828934076512 },
-  { 521.7627989403115 , 39.5459457100188 },
-  { 741.363041061994 , 152.23189401504555 },
-  { 469.9151254591784 , 160.5292365634204 },
-  { 800.0867128141356 , 599.4815311635249 },
-  { 95.82280904352146 , 168.90255513972625 },
-  { 787.4599531924788 , 528.1538103822286 },
-  { 394.9217942624766 , 529.1252085211901 },
-  { 454.93010218182064 , 256.89857407520367 },
-  { 398.76038990478474 , 589.0482055850205 },
-  { 532.8256016334997 , 350.5278277118891 },
-  { 685.4109184255159 , 607.5814062389358 },
-  { 582.9928679932826 , 534.7287638331915 },
-  { 314.57617538885023 , 467.40591642469474 },
-  { 79.701931116764 , 338.1592004220271 },
-  { 29.57150183297284 , 118.98825379615329 },
-  { 611.7035213653174 , 637.9930729098842 }
-},
-{ //#34
-  { 927.556467066728963 , 129.37580176299076 },
-  { 76.77290950205959 , 403.2341589154361 },
-  { 698.556467066728935 , 604.37580176299076 },
-  { 598.18664935724466 , 509.662704072325 },
-  { 810.71639966539482 , 340.38630849169346 },
-  { 178.75386166586054 , 362.03117970561993 },
-  { 729.0527409062849 , 66.58512105607923 },
-  { 700.71639966539485 , 787.38630849169346 },
-  { 883.38022635916852 , 50.86305116800116 },
-  { 499.5738607556623 , 34.7049709181029 },
-  { 187.40119316155594 , 423.870091100553 },
-  { 153.7939662143536 , 127.29159632489008 },
-  { 315.0521450563145 , 140.48602110653124 },
-  { 265.11772998996173 , 353.48782870200984 },
-  { 199.14487236885307 , 265.3083527725231 },
-  { 600.5374192305299 , 605.57878097280695 },
-  { 797.88685854666713 , 207.9199323709814 },
-  { 770.143064773374505 , 585.24276783887586 },
-  { 329.76822988961084 , 264.50404949070935 },
-  { 683.09244002050536 , 168.30462790244718 },
-  { 222.74264087716102 , 466.63788593292384 },
-  { 431.308882455836 , 267.16298505489254 },
-  { 525.5887138600614 , 323.8120229142494 },
-  { 177.12187383217997 , 566.5064931309417 },
-  { 15.152057985596826 , 195.20565054396175 },
-  { 257.8740463051087 , 224.9910000062113 },
-  { 785.6615334093755 , 499.6946072336898 },
-  { 122.62651829884759 , 511.64476596326136 },
-  { 306.64337479509055 , 405.4025843297268 },
-  { 599.45526282968524 , 71.1892221638938 },
-  { 248.5683624474549 , 145.80122761037015 },
-  { 38.14272721154383 , 14.80434691987966 },
-  { 843.8259959801732 , 102.97219103609814 },
-  { 597.7486464587273 , 406.8225296429521 },
-  { 879.83658430464303 , 200.9808343249083 },
-  { 42.17162437860161 , 103.38876258848632 },
-  { 541.298882455836 , 267.16298505489254 },
-  { 103.35517760560465 , 678.13497160773306 },
-  { 193.32672748827002 , 657.38753766460496 },
-  { 17.05938139191977 , 413.76326503454715 },
-  { 379.6717052650159 , 170.04757931633918 },
-  { 20.936500401768818 , 303.44018750193885 },
-  { 131.83714925689375 , 204.67892486102454 },
-  { 683.6879856383737 , 22.69224791630626 },
-  { 290.5173157398694 , 544.4125607956322 },
-  { 641.84504381637225 , 121.76921182628197 },
-  { 381.7031583451984 , 605.9181882483797 },
-  { 402.8427963833527 , 352.0783741988322 },
-  { 20.897977034227885 , 303.8402679707168 },
-  { 184.11131898066535 , 21.562422388634403 },
-  { 782.2126246597536 , 124.71010206923228 },
-  { 943.610982702204 , 276.5308435586143 },
-  { 640.3338096353008 , 249.92185426160685 },
-  { 780.34248636163665 , 420.5669779697705 },
-  { 66.17526263111921 , 201.01901040274868 },
-  { 393.0761143461481 , 60.87742809731019 },
-  { 939.5279690565372 , 353.76540713890665 },
-  { 690.36201458494612 , 510.76448353822366 },
-  { 481.36050018549 , 172.9701780282282 },
-  { 447.89679274169214 , 518.076268498278 },
-  { 843.4805527991416 , 606.3724229634565 },
-  { 354.6263539480221 , 485.93673135127756 },
-  { 516.23748433564407 , 499.76352293627536 },
-  { 553.5767840776944 , 5.91632887900727 },
-  { 702.6896476556463 , 409.30589867573025 },
-  { 120.73723956188346 , 309.5966997978782 },
-  { 588.605982702204 , 181.2767093963639 },
-  { 84.25561454401898 , 586.4539763615458 },
-  { 461.30120182282434 , 408.906117279249 },
-  { 738.3356172307793 , 299.8562693279596 },
-  { 860.2453138632378 , 488.2879746030193 },
-  { 899.46036125842586 , 589.72524354301066 },
-  { 18.62893016867875 , 547.4540072720041 },
-  { 877.60892843474517 , 385.5924469180978 },
-  { 848.3088652210308 , 301.7758595119964 },
-  { 59.63257176922707 , 477.82415674112417 },
-  { 657.6082972909449 , 347.51455621941204 },
-  { 252.1595316476486 , 569.3223970433511 },
-  { 285.1069404387395 , 39.89034669584403 },
-  { 394.6783952818506 , 2.47660684065895 },
-  { 492.6802028773292 , 99.4110219070117 }
-},
-{ //#35
-  { 115.6279656871242 , 196.45152842940092 },
-  { 216.6441864758237 , 111.80102852975182 },
-  { 316.1088305732338 , 241.18849180130817 },
-  { 190.977465787475 , 285.4353076407014 },
-  { 559.1193373019365 , 179.02855920264227 },
-  { 448.9671877256792 , 82.9720493659776 },
-  { 715.5328131484271 , 288.6969041977181 },
-  { 814.3818748686072 , 414.6054588597304 },
-  { 117.5636392410186 , 287.70982279625196 },
-  { 215.82513988676 , 194.11214740284115 },
-  { 305.0519482623174 , 433.43386756962536 },
-  { 108.9792733829536 , 395.36972270705417 },
-  { 120.5174905121625 , 99.19256252195582 },
-  { 640.0569482623174 , 498.6880017318758 },
-  { 877.936542523764 , 281.79669037880524 },
-  { 960.2786789861767 , 233.70190419771808 },
-  { 422.5156829166839 , 135.1269775883086 },
-  { 179.8649391309916 , 554.130449354607 },
-  { 590.2955164351561 , 433.27313009728095 },
-  { 729.384074244882 , 79.39348598269977 },
-  { 534.7993147295991 , 625.8589651576037 },
-  { 483.1995791518568 , 382.2775552649149 },
-  { 952.1801106966027 , 391.63595290646083 },
-  { 296.7447544917434 , 47.72497518782188 },
-  { 14.5788110555261 , 151.13563058030596 },
-  { 49.1761020274031 , 458.3919788070665 },
-  { 852.7044214921017 , 132.01834058227917 },
-  { 999.1882041009612 , 321.70313407844029 },
-  { 627.2259939949837 , 13.19985158620598 },
-  { 657.2099120647712 , 228.2499074612511 },
-  { 501.3275532267566 , 685.51951731190206 },
-  { 102.223556605992 , 605.6216796484299 },
-  { 632.543248751068 , 625.7854695901057 },
-  { 405.78179026534224 , 13.1165827441069 },
-  { 224.6954323679731 , 10.1233681915407 },
-  { 828.148429213203 , 510.17767410798314 },
-  { 332.8997883412793 , 298.0203269662585 },
-  { 5.738743654192 , 234.14613730900865 },
-  { 490.8720936989732 , 505.99962515299296 },
-  { 521.4968200587281 , 43.51720435251777 },
-  { 424.21214748820324 , 440.15669450272225 },
-  { 619.5911165003808 , 331.6066988214932 },
-  { 723.2591047871789 , 512.018760566411 },
-  { 325.50449088888826 , 165.63415616304837 },
-  { 202.4662458148982 , 411.94687394779766 },
-  { 680.6305462725816 , 171.96954198973654 },
-  { 929.7041510975865 , 12.49118447986794 },
-  { 154.6746421079173 , 472.22974708191614 },
-  { 699.0534488918495 , 380.8539651576037 },
-  { 386.70644160794126 , 239.12456571847744 },
-  { 414.31806892390034 , 628.51677265285045 },
-  { 736.6134572665401 , 618.7027659113967815 },
-  { 327.2615487544335 , 85.13197758830859 },
-  { 269.6645789539639 , 352.8985759271627 },
-  { 37.8899937029155 , 302.985557027120443 },
-  { 406.3139434334777 , 558.2156881185006 },
-  { 321.416752686241 , 585.19743971637483 },
-  { 433.00829188006645 , 306.4223890421676 },
-  { 536.176095974392 , 261.03122643368096 },
-  { 949.2663868546408 , 154.76331517996152 },
-  { 733.6150172488584 , 15.43101756613828 },
-  { 463.63367974712105 , 203.9609611284177 },
-  { 998.536228072424 , 88.34404809221502 },
-  { 244.7610173016204 , 638.12517578701926 },
-  { 381.4846304274168 , 480.5025394781838 },
-  { 8.8259833116557 , 402.97557886333237 },
-  { 364.2784036176418 , 371.8666988961246 },
-  { 893.1935198535316 , 460.02056816188957 },
-  { 811.5005417375462 , 272.38535056288435 },
-  { 273.7447965129209 , 523.4746758873701 },
-  { 626.2110749166366 , 93.76701731897371 },
-  { 125.2083936348195 , 19.50749655512095 },
-  { 57.8885675525797 , 533.41362073895453 },
-  { 558.2962866666513 , 364.7974529738516 },
-  { 876.2369404973081 , 362.0542837608087 },
-  { 46.0078529224323 , 83.38455143140627 },
-  { 790.6205462725816 , 171.96954198973654 },
-  { 840.611045396709 , 37.51200722013944 },
-  { 728.4563573434496 , 442.60401878865434 },
-  { 895.3383141037269 , 589.9351479335436 },
-  { 576.3503779996254 , 561.2185749645646 }
-},
-{ //#24 36
-  { 643.6819192504956 , 409.6366236027226 },
-  { 706.7370125016047 , 308.72738064106943 },
-  { 899.7895089324668 , 506.56559788463716 },
-  { 895.6508730390796 , 690.70423377802445 },
-  { 475.85746215925354 , 25.89763500158637 },
-  { 525.1447121245589 , 640.0072854322665 },
-  { 974.3946692851904 , 615.5269731720425 },
-  { 268.90995859011565 , 58.05941775801864 },
-  { 436.71790934100375 , 499.62713628290703 },
-  { 418.1037723458667 , 697.1521719303224 },
-  { 881.2815240320239 , 579.941094283665 },
-  { 639.4566033594741 , 761.38939442793566 },
-  { 793.2473062715158 , 401.1787035728941 },
-  { 296.93994765225136 , 280.05032611421694 },
-  { 238.87548379267085 , 200.24743316350936 },
-  { 497.51612446036006 , 353.1986532326651 },
-  { 773.0470678814669 , 620.330997456301 },
-  { 208.7549291132433 , 395.26787334186133 },
-  { 824.5690100011641 , 325.2875879243076 },
-  { 610.5863871092157 , 321.50111195477336 },
-  { 626.5564348888432 , 499.5058918934323 },
-  { 799.3971705297555 , 25.12446226726064 },
-  { 370.06158687684285 , 24.54471543461995 },
-  { 991.7671257438848 , 498.7151889813907 },
-  { 720.4980110486474 , 382.9750846374193 },
-  { 336.5964926927343 , 464.9805263773354 },
-  { 787.8879973654414 , 525.7511575967345 },
-  { 895.3929858856537 , 21.70770107494735 },
-  { 857.3183052240324 , 443.8662002860058 },
-  { 999.9229875542894 , 128.03040378674814 },
-  { 220.69046525366275 , 525.46498039115374 },
-  { 184.43269234168866 , 241.31097141535986 },
-  { 315.5853842148774 , 150.84812925582548 },
-  { 565.0916461395117 , 123.71294822472726 },
-  { 200.57516098185738 , 318.94757950392585 },
-  { 924.5428384049299 , 139.60360100319298 },
-  { 839.90655739997044 , 658.78257566525997 },
-  { 183.5167743886549 , 594.0431635748548 },
-  { 671.4982143541258 , 660.49056968713967 },
-  { 999.9971009469791 , 33.747837257871 },
-  { 665.0722269440655 , 225.1517851387066 },
-  { 66.32962575788777 , 36.80973824358134 },
-  { 921.958996317958 , 318.0636608836229 },
-  { 100.04855545222411 , 196.47488859685723 },
-  { 703.0470678814669 , 550.330997456301 },
-  { 621.7798434152875 , 585.4895575388002 },
-  { 867.2733723610191 , 228.48376936587007 },
-  { 101.01094660476804 , 537.7378228273286 },
-  { 937.0762653117268 , 424.0269426231647 },
-  { 124.7879675426293 , 432.8646716081727 },
-  { 549.435402245379 , 458.52488891043845 },
-  { 734.7661170504565 , 5.22312406472713 },
-  { 761.4944756086195 , 200.09860100319298 },
-  { 783.5531042997565 , 282.06584167576614 },
-  { 665.3929858856537 , 142.71770107494734 },
-  { 965.3671292470717 , 241.36886482144484 },
-  { 29.0855331388962 , 440.7557520548433 },
-  { 303.89692353801433 , 382.4699663584099 },
-  { 857.3605638740072 , 85.265997663781 },
-  { 404.876918059443 , 390.3925452701222 },
-  { 515.3129885722441 , 559.58268039529 },
-  { 183.8419663320501 , 111.2814873732953 },
-  { 26.49717827155244 , 272.10784959210883 },
-  { 471.7198834151466 , 170.83570092730264 },
-  { 483.39972592115123 , 281.3050099750423 },
-  { 728.0113075248926 , 462.6494979146761 },
-  { 564.7209843099678 , 35.17574109879045 },
-  { 429.9658184679722 , 596.1865343931215 },
-  { 461.6305434750709 , 446.7251000911983 },
-  { 400.2067096814187 , 320.24111428693027 },
-  { 669.0440715767083 , 61.50053441939208 },
-  { 99.1277147265525 , 341.19026744328187 },
-  { 384.78151123174234 , 219.76297914969106 },
-  { 331.31863770964776 , 559.6481708091374 },
-  { 229.39569036623584 , 460.57303294221083 },
-  { 756.3415642944442 , 100.38958212648868 },
-  { 403.4700232537357 , 108.30660267724977 },
-  { 172.6907577686194 , 17.5616235457593 },
-  { 563.8689663406792 , 223.27241545750888 },
-  { 80.51357773141541 , 123.66523179586645 },
-  { 564.888102424071 , 382.9597005195345 }
-},
-{ //37
-  { 708.7958203120986 , 400.0982111836751 },
-  { 591.5290693332684 , 515.45991288923426 },
-  { 770.5073939502853 , 315.1595169442494 },
-  { 822.2251746121085 , 635.05747656067518 },
-  { 608.3933839835395 , 430.79431646251527 },
-  { 807.6133907423113 , 339.0257210978526 },
-  { 886.8634729065494 , 592.32422753950547 },
-  { 487.8316704541849 , 645.0358584046604 },
-  { 791.5908826762051 , 55.8907907228527 },
-  { 200.396526193152 , 737.75319316171743 },
-  { 274.1046115352153 , 455.46378463979124 },
-  { 243.4195310951616 , 593.19507412181048 },
-  { 419.6577210315515 , 490.8592927082434 },
-  { 677.3471832388392 , 111.60251962844309 },
-  { 708.7958203120986 , 191.68337026203034 },
-  { 460.4087067869817 , 414.6968717168231 },
-  { 550.4743575257017 , 712.09847895407916 },
-  { 804.937122920707 , 234.29147146107368 },
-  { 914.477196973725 , 57.03470133380353 },
-  { 657.7741449291156 , 25.5212186498086 },
-  { 764.4320438639428 , 102.64680064656717 },
-  { 783.108142788258 , 443.8718359517353 },
-  { 995.8721629624768 , 175.26602350705454 },
-  { 183.5667244682932 , 263.31628101391505 },
-  { 768.7374514881019 , 539.0250905127132 },
-  { 677.5421752112117 , 287.6219645916342 },
-  { 281.2023134320197 , 731.7012811246469 },
-  { 831.2310019378737 , 441.32483419965445 },
-  { 781.0445821179227 , 791.21168309975167 },
-  { 930.1022479964861 , 255.05131031174471 },
-  { 588.5056055957485 , 231.98574103979 },
-  { 988.1338694598704 , 333.7158048169877 },
-  { 920.2417835900497 , 672.68252758343624 },
-  { 359.2584966813326 , 219.9690325938446 },
-  { 1090.2365498834263 , 221.29061020843977 },
-  { 625.8182254343294 , 723.8473531478998 },
-  { 572.0815511111747 , 615.6831399188735 },
-  { 842.1105344660207 , 132.8789189589844 },
-  { 701.9653546044308 , 562.82164367093355 },
-  { 715.5708586294483 , 738.15601255171515 },
-  { 704.2695049013488 , 464.82753724542084 },
-  { 120.7683329607784 , 332.7777074845741 },
-  { 939.3015098416565 , 510.31605816245894 },
-  { 513.1044122912635 , 539.03933535490177 },
-  { 107.2311049676518 , 255.4979114925379 },
-  { 862.6159768554963 , 17.62430422868323 },
-  { 896.5296774140744 , 300.3638193173961 },
-  { 279.4798620661899 , 120.6130008573868 },
-  { 550.7352965361948 , 429.71666949440385 },
-  { 855.0371498539843 , 721.42406550984256 },
-  { 245.4843575257017 , 212.09847895407916 },
-  { 22.1831422227182 , 316.52613845528344 },
-  { 879.8758171601327 , 182.5798978228869 },
-  { 991.0660517743605 , 25.1923191794327 },
-  { 491.16057270478154 , 192.6557947970534 },
-  { 139.2537488493983 , 120.68327035220847 },
-  { 948.4359395737672 , 97.11741373883206 },
-  { 330.3839166451771 , 394.29906602505974 },
-  { 721.9374299778145 , 658.6601293807099 },
-  { 641.0115456933391 , 598.15064510958143 },
-  { 292.99290085663193 , 297.6298043115229 },
-  { 633.137448715847 , 342.100373345072 },
-  { 849.0168376360199 , 542.5301642080478 },
-  { 359.3772854448509 , 68.24062066454358 },
-  { 212.2414063196647 , 456.12011988003024 },
-  { 432.45090976938786 , 279.6964495396072 },
-  { 403.51174378216115 , 380.6193149961713 },
-  { 122.3737509662803 , 182.61378232124943 },
-  { 324.0965229138253 , 660.45685637968427 },
-  { 324.9470781122333 , 536.9136519029416 },
-  { 746.197396868124 , 10.17563880245618 },
-  { 559.5664396085218 , 131.06287558322592 },
-  { 448.4572925482533 , 96.74265719915672 },
-  { 631.1623026192563 , 162.23039835341405 },
-  { 118.014552868874 , 418.0074361975433 },
-  { 213.7964283929047 , 395.002117611837 },
-  { 936.0771167917563 , 435.83008215370774 },
-  { 531.1092380257004 , 315.6051443873692 },
-  { 242.4810188943633 , 326.35012796073954 },
-  { 896.5064474775501 , 384.52347862328133 },
-  { 150.5719224389728 , 572.98233415144597 }
-},
-{ //#34 38
-  { 927.556467066728963 , 129.37580176299076 },
-  { 76.77290950205959 , 403.2341589154361 },
-  { 698.556467066728935 , 604.37580176299076 },
-  { 598.18664935724466 , 509.662704072325 },
-  { 810.71639966539482 , 340.38630849169346 },
-  { 178.75386166586054 , 362.03117970561993 },
-  { 729.0527409062849 , 66.58512105607923 },
-  { 700.71639966539485 , 687.38630849169346 },
-  { 883.38022635916852 , 50.86305116800116 },
-  { 499.5738607556623 , 34.7049709181029 },
-  { 187.40119316155594 , 423.870091100553 },
-  { 153.7939662143536 , 127.29159632489008 },
-  { 315.0521450563145 , 140.48602110653124 },
-  { 265.11772998996173 , 353.48782870200984 },
-  { 199.14487236885307 , 265.3083527725231 },
-  { 600.5374192305299 , 605.57878097280695 },
-  { 797.88685854666713 , 207.9199323709814 },
-  { 770.143064773374505 , 585.24276783887586 },
-  { 329.76822988961084 , 264.50404949070935 },
-  { 683.09244002050536 , 168.30462790244718 },
-  { 222.74264087716102 , 466.63788593292384 },
-  { 431.308882455836 , 267.16298505489254 },
-  { 525.5887138600614 , 323.8120229142494 },
-  { 177.12187383217997 , 566.5064931309417 },
-  { 15.152057985596826 , 195.20565054396175 },
-  { 257.8740463051087 , 224.9910000062113 },
-  { 785.6615334093755 , 499.6946072336898 },
-  { 122.62651829884759 , 511.64476596326136 },
-  { 306.64337479509055 , 405.4025843297268 },
-  { 599.45526282968524 , 71.1892221638938 },
-  { 248.5683624474549 , 145.80122761037015 },
-  { 38.14272721154383 , 14.80434691987966 },
-  { 843.8259959801732 , 102.97219103609814 },
-  { 597.7486464587273 , 406.8225296429521 },
-  { 879.83658430464303 , 200.9808343249083 },
-  { 42.17162437860161 , 103.38876258848632 },
-  { 541.298882455836 , 267.16298505489254 },
-  { 103.35517760560465 , 678.13497160773306 },
-  { 193.32672748827002 , 657.38753766460496 },
-  { 17.05938139191977 , 413.76326503454715 },
-  { 379.6717052650159 , 170.04757931633918 },
-  { 20.936500401768818 , 303.44018750193885 },
-  { 131.83714925689375 , 204.67892486102454 },
-  { 683.6879856383737 , 22.69224791630626 },
-  { 290.5173157398694 , 544.4125607956322 },
-  { 641.84504381637225 , 121.76921182628197 },
-  { 401.7031583451984 , 605.9181882483797 },
-  { 402.8427963833527 , 352.0783741988322 },
-  { 20.897977034227885 , 303.8402679707168 },
-  { 184.11131898066535 , 21.562422388634403 },
-  { 782.2126246597536 , 124.71010206923228 },
-  { 943.610982702204 , 276.5308435586143 },
-  { 640.3338096353008 , 249.92185426160685 },
-  { 780.34248636163665 , 420.5669779697705 },
-  { 66.17526263111921 , 201.01901040274868 },
-  { 393.0761143461481 , 80.87742809731019 },
-  { 939.5279690565372 , 353.76540713890665 },
-  { 690.36201458494612 , 510.76448353822366 },
-  { 481.36050018549 , 172.9701780282282 },
-  { 447.89679274169214 , 518.076268498278 },
-  { 843.4805527991416 , 606.3724229634565 },
-  { 354.6263539480221 , 485.93673135127756 },
-  { 516.23748433564407 , 499.76352293627536 },
-  { 553.5767840776944 , 5.91632887900727 },
-  { 702.6896476556463 , 409.30589867573025 },
-  { 120.73723956188346 , 309.5966997978782 },
-  { 588.605982702204 , 181.2767093963639 },
-  { 84.25561454401898 , 586.4539763615458 },
-  { 461.30120182282434 , 408.906117279249 },
-  { 738.3356172307793 , 299.8562693279596 },
-  { 860.2453138632378 , 488.2879746030193 },
-  { 899.46036125842586 , 589.72524354301066 },
-  { 18.62893016867875 , 547.4540072720041 },
-  { 877.60892843474517 , 385.5924469180978 },
-  { 848.3088652210308 , 301.7758595119964 },
-  { 59.63257176922707 , 477.82415674112417 },
-  { 657.6082972909449 , 347.51455621941204 },
-  { 252.1595316476486 , 569.3223970433511 },
-  { 285.1069404387395 , 39.89034669584403 },
-  { 394.6783952818506 , 2.47660684065895 },
-  { 492.6802028773292 , 99.4110219070117 }
-},
-{ //#26 39
-  { 415.15670086169376 , 187.84701394190105 },
-  { 547.3184836181261 , 294.7945175110389 },
-  { 450.7582763348879 , 632.6265150105984 },
-  { 753.8115805970648 , 185.263644998733 },
-  { 402.7248456481627 , 247.90584731512828 },
-  { 742.66059573322804 , 98.23986804306796 },
-  { 795.47342026719394 , 432.82580315451497 },
-  { 86.2317486692241 , 507.43671982743416 },
-  { 91.4923365788189 , 221.04693681611866 },
-  { 854.3633697381212 , 49.8422748834785 },
-  { 76.2317486692241 , 337.43671982743416 },
-  { 294.9473681356767 , 235.44238271688982 },
-  { 266.6857378023808 , 121.25352593629266 },
-  { 871.432665812278 , 504.29075443016262 },
-  { 526.8134836181262 , 191.74615471472856 },
-  { 165.5291030845788 , 593.7404918252729 },
-  { 659.3016476512309 , 14.91356348482617 },
-  { 576.6158380334808 , 251.09828950887757 },
-  { 277.37035368339303 , 158.32456998273645 },
-  { 385.0180350266286 , 622.892208297015 },
-  { 484.21077344979625 , 139.86766293142972 },
-  { 234.02143482887178 , 289.29679697752965 },
-  { 493.72080903152164 , 571.28980145660444 },
-  { 875.8754430038678 , 320.1539170568334 },
-  { 850.5988736463378 , 126.51597032523675 },
-  { 785.19574739810986 , 296.15570747653925 },
-  { 6.24655440012185 , 74.00432052317305 },
-  { 138.96769769968535 , 129.4215164037159 },
-  { 484.8114459064546 , 388.0856095205769 },
-  { 353.8723203281464 , 85.85267683135673 },
-  { 460.05443264858735 , 86.77931408732059 },
-  { 355.21304634327976 , 437.33619158775605 },
-  { 346.5391030845788 , 293.7404918252729 },
-  { 582.2823476564017 , 456.3354696819879 },
-  { 632.8015805970648 , 185.263644998733 },
-  { 577.23670717951 , 66.11691742673244 },
-  { 343.5016584986025 , 204.38988395729353 },
-  { 342.8577027825204 , 20.175404183487487 },
-  { 108.20259797295296 , 31.124539556202294 },
-  { 649.47342026719394 , 291.815803154515 },
-  { 663.4333325202383 , 369.31169272632275 },
-  { 946.8266832986463 , 556.29942648968907 },
-  { 818.17778262704894 , 5.01198459607744 },
-  { 526.3056645567539 , 16.62330638442372 },
-  { 697.9002185670281 , 149.10395239833323 },
-  { 485.4642097467537 , 267.5835871854789 },
-  { 692.1497409269356 , 252.82580315451494 },
-  { 520.9642620427533 , 51.237492415405356 },
-  { 202.7573100668468 , 476.8033172897626 },
-  { 555.8202104091716 , 356.76409375470524 },
-  { 405.6804316872166 , 335.7099337660923 },
-  { 375.87544300386776 , 505.09911296436337 },
-  { 589.2141222041643 , 148.7083941653525 },
-  { 975.38851180727386 , 169.6511190958821 },
-  { 637.6283018987962 , 69.78284205375988 },
-  { 359.31523572062963 , 387.2671154648039 },
-  { 306.4050444860683 , 561.36639833158085 },
-  { 526.3056645567539 , 16.62330638442372 },
-  { 471.9567408014997 , 500.9099082325473 },
-  { 127.0485146634211 , 313.9264616234855 },
-  { 35.0408152165206 , 138.07204312534014 },
-  { 469.1161327824414 , 419.5655375213129 },
-  { 296.54581521652057 , 35.023680329029816 },
-  { 781.5363991040392 , 354.8104595545442 },
-  { 257.0485146634211 , 432.91646162348553 },
-  { 840.3928544474022 , 218.09124361695876 },
-  { 413.77429647612337 , 29.628105523889886 },
-  { 212.8085506722922 , 65.38269097252031 },
-  { 943.8924679881741 , 118.09213504488952 },
-  { 18.62384166928234 , 397.9995709824227 },
-  { 237.06893796986162 , 540.1487049673125 },
-  { 286.7085544405576 , 333.63327192412 },
-  { 184.62176128077465 , 190.86794416633046 },
-  { 133.7247109575526 , 430.72781183697214 },
-  { 238.70671302180867 , 356.05085682257123 },
-  { 895.9169283037397 , 387.6085485232089 },
-  { 592.6530094859455 , 574.8726768079247 },
-  { 922.2487815795656 , 232.69948130918908 },
-  { 199.12299445255314 , 398.97101075013137 },
-  { 32.3552608622373 , 500.46279687443342 },
-  { 3.41881432021074 , 297.38616143859116 }
-},
-{ //#9 40
-  { 318.26878952418684 , 314.7823488836608 },
-  { 45.80235611781261 , 21.88248919844636 },
-  { 130.065392745905356 , 25.36335408455602 },
-  { 216.54917535476488 , 45.0481475807171 },
-  { 424.34522415013066 , 514.71431622519913 },
-  { 404.33522415013067 , 95.71431622519913 },
-  { 547.04773188612978 , 19.97764173714355 },
-  { 692.69804695931057 , 52.82972196375252 },
-  { 762.69804695931055 , 26.59891048664575 },
-  { 844.6720989732093 , 144.35213329585648 },
-  { 124.757743371307814 , 167.4437692036707 },
-  { 114.62958517072808 , 107.0213955709686 },
-  { 248.13580256186856 , 127.03852635609374 },
-  { 328.71891179138093 , 137.35401524566653 },
-  { 447.7220627066835 , 106.6099811992048 },
-  { 537.77166203479499 , 102.67113804966925 },
-  { 640.4285308003707 , 104.19139582351204 },
-  { 751.96102402954446 , 107.94921418997743 },
-  { 734.911998163944787 , 197.1635533192705 },
-  { 27.4108090837779 , 235.71250862972056 },
-  { 104.623154262052594 , 216.04180167808283 },
-  { 212.77153002522118 , 215.89540779698022 },
-  { 325.36673663994253 , 210.8780786755577807 },
-  { 431.67485963160462 , 217.1679126460473 },
-  { 538.0890148011067 , 278.40031198592493 },
-  { 652.21208836504005 , 225.33303867106667 },
-  { 792.74477801547266 , 216.97581761294331 },
-  { 860.942625460523 , 213.413504516951 },
-  { 10.15816465177235 , 326.77097451381394 },
-  { 121.33471742142797 , 325.874248823865 },
-  { 214.65147739554673 , 319.07661221645435 },
-  { 441.10693687091214 , 316.357008181921728 },
-  { 541.91282139794086 , 195.60756932937363 },
-  { 672.40261767063703 , 292.96221381325165 },
-  { 763.8342434107688 , 307.1202603090924 },
-  { 870.6646953486011 , 315.08601906406733 },
-  { 26.6956350894794 , 415.02048065500975 },
-  { 126.8182315985588 , 410.00438465343085 },
-  { 230.51700699747826 , 428.3953177163358 },
-  { 420.151856218163502 , 416.86626840974685 },
-  { 532.18726034767681 , 418.530356116824876 },
-  { 638.78623124038836 , 373.57531713055437 },
-  { 749.94457939329223 , 410.9817704719229 },
-  { 880.3020142074183 , 423.319591157269741 },
-  { 19.49064385322225 , 511.9708176129433 },
-  { 122.128468065852 , 508.9191319696984 },
-  { 239.7985429697513 , 522.46483179802127 },
-  { 326.86382231475176 , 510.26554194711414 },
-  { 547.02652175179745 , 610.049358807324083 },
-  { 558.544817560939 , 519.16597888552846 },
-  { 673.77035531639018 , 528.9471108839399 },
-  { 764.60651403956203 , 516.35032570037788 },
-  { 882.95184245349428 , 514.88056255363998 },
-  { 78.29654003421298 , 618.79495818325512 },
-  { 169.23766232650446 , 575.60375245739468 },
-  { 243.9415054448463 , 657.800199191057 },
-  { 322.97597707123248 , 618.92639593952946 },
-  { 469.27204085741174 , 614.27174257653195 },
-  { 578.86002406477787 , 814.68219627666895 },
-  { 683.14938154480163 , 620.2086887724517 },
-  { 776.1583269951787 , 620.1400701418057 },
-  { 859.86414757228033 , 623.5212891261059 },
-  { 70.5797070929075 , 710.41328841436444 },
-  { 162.47150492082983 , 716.2150299674624 },
-  { 265.21364767263123 , 712.5050683374064 },
-  { 352.45417725890945 , 716.6245817332359 },
-  { 461.82244082127474 , 714.3342457491726 },
-  { 572.44441977003714 , 718.41273591950062 },
-  { 673.39664080145408 , 717.27910749257128 },
-  { 773.8669674201106 , 715.32145657628763 },
-  { 851.56615822820464 , 701.202288806452394 },
-  { 942.07791717921546 , 340.16682215155424 },
-  { 484.89922986911625 , 500.1202603090924 },
-  { 473.89504556838529 , 191.23734968879876 },
-  { 573.78754897318188 , 314.8374354625943 },
-  { 116.1017160561035 , 781.9995417856615 },
-  { 978.93513560130205 , 514.83299818196616 },
-  { 488.71500269023085 , 811.94557539951029 },
-  { 675.46407044392208 , 800.81617598983507 },
-  { 956.15832699517865 , 614.1870364967352 },
-  { 341.0170517131233 , 415.69847354823142 }
-},
-{ //#19 41
-  { 420.9102163016844 , 138.44927814830652 },
-  { 435.06290741431496 , 247.3667926553087 },
-  { 657.0572445248592 , 308.65117318885603 },
-  { 503.3828142554493 , 5.566444817286325 },
-  { 640.1866328138868 , 76.27080717714139 },
-  { 559.7371446421312 , 114.67673358165442 },
-  { 579.6994468412545 , 419.73790813775804 },
-  { 313.38518065426894 , 109.83514115316947 },
-  { 462.895628282817 , 442.44227049761315 },
-  { 206.36140369860385 , 200.98612601700617 },
-  { 41.4496445138494 , 219.63803410387712 },
-  { 510.4215217605084 , 231.71469594584948 },
-  { 871.7314817526754 , 73.39235304810704 },
-  { 724.6199779731513 , 42.20413562788947 },
-  { 460.81896644084463 , 561.4141477442721 },
-  { 514.6827582649555 , 335.7935954388638 },
-  { 665.6774386509263 , 107.90980762527788 },
-  { 272.7494981734329 , 207.93835691469062 },
-  { 509.6844639030151 , 73.00101380463845 },
-  { 371.41521630168444 , 231.49764094461688 },
-  { 376.948411342071 , 81.53496752007621 },
-  { 191.57209455364537 , 77.1954231049646 },
-  { 237.0346871019839 , 264.29572991328166 },
-  { 134.7379998959445 , 23.29677756918532 },
-  { 404.68266791503277 , 445.26612200647291 },
-  { 314.72218381509555 , 368.36672886579834 },
-  { 45.63180054485024 , 133.96234906134107 },
-  { 12.576707293741201 , 204.8715920229942 },
-  { 390.0293532968215 , 553.97260529720144 },
-  { 508.36751362669236 , 126.41044714141952 },
-  { 745.2972895015669 , 19.483004841722703 },
-  { 662.589524260949 , 418.2749032290877 },
-  { 643.431158941862 , 192.09249938852352 },
-  { 575.1994956405451 , 528.6160587756073 },
-  { 555.9646000754791 , 15.849805241207676 },
-  { 579.2854112941325 , 467.1816825880183 },
-  { 335.0991509615643 , 484.0986228639893 },
-  { 729.4120998767286 , 311.89634455826706 },
-  { 140.76716085630773 , 273.6435255179222 },
-  { 230.23676672416602 , 151.39984415298625 },
-  { 290.30213871533226 , 78.0642109751377 },
-  { 129.80119641536572 , 373.15412851744672 },
-  { 334.1536644526618 , 184.31169940419966 },
-  { 541.2099356374898 , 427.5686876958582 },
-  { 257.5227593983758 , 4.773207078885761 },
-  { 455.5538521950717 , 315.63627683800416 },
-  { 804.7922895015669 , 122.53136763803305 },
-  { 57.93418133750698 , 56.0011399290404 },
-  { 237.03209301698269 , 423.70295834764084 },
-  { 783.2024742983417 , 86.52394462041495 },
-  { 572.458195216719 , 219.15163919702735 },
-  { 376.5127593983758 , 4.773207078885761 },
-  { 618.3925225398035 , 161.0310639683362 },
-  { 467.246622058797 , 191.33917413450928 },
-  { 431.9953104505755 , 364.51359444474923 },
-  { 113.48595025539424 , 441.81649877188505 },
-  { 776.0060031441624 , 237.98685610761385 },
-  { 174.84665024575145 , 49.27792461773326 },
-  { 94.9643468372481 , 290.7896623906043 },
-  { 272.3739727915116 , 511.86057437497823 },
-  { 110.00778553553971 , 137.96072729388476 },
-  { 726.2340861192945 , 211.31841093286204 },
-  { 96.19272230574835 , 383.9691323728243 },
-  { 175.99864519708746 , 155.80403287974804 },
-  { 573.4905917715806 , 288.3574315491985 },
-  { 630.9167603018664 , 25.28109381038749 },
-  { 382.21886243140517 , 336.8121103550245 },
-  { 429.3448760369487 , 323.587751359269 },
-  { 587.5857341049459 , 585.8818289284347 },
-  { 118.59657799809503 , 183.18341445996305 },
-  { 439.5591253456854 , 87.26817518199258 },
-  { 285.98252157461627 , 36.9657991956595 },
-  { 190.56731461498646 , 473.16547088459214 },
-  { 287.37864556133275 , 257.32553081698876 },
-  { 430.10974095572135 , 516.48939043242376 },
-  { 321.2722045022734 , 282.15610180026715 },
-  { 572.7395571541242 , 173.91025676629158 },
-  { 110.43387377345839 , 83.33538029340578 },
-  { 747.9964139133505 , 143.3329202183884 },
-  { 212.99654086418587 , 361.2647700129692 },
-  { 854.9439174824884 , 195.4947029748207 }
-},
-{ //22 42
-  { 416.3837374013813 , 263.6256866164163 },
-  { 94.452234400936 , 383.125555711557 },
-  { 156.0622040057982 , 458.15519505208437 },
-  { 462.3271361664732 , 578.0957622223657 },
-  { 884.245645280762 , 298.318956935119 },
-  { 497.4118601547223 , 221.549024774444 },
-  { 47.682302240260995 , 249.9593408375967 },
-  { 165.3033592108081 , 609.2467470862024 },
-  { 344.1787861110988 , 168.60873076564883 },
-  { 746.89007624515403 , 264.78739538168617 },
-  { 153.70316855343486 , 195.939011273588 },
-  { 799.2340410657407 , 449.44591429464919 },
-  { 277.6856891321601 , 36.07785825334297 },
-  { 419.3721873346608 , 45.81531988582283 },
-  { 442.51694644096966 , 133.17088892143076 },
-  { 282.10717776924565 , 631.9511094460574 },
-  { 655.83809740579892 , 245.6005200641416 },
-  { 947.21007157449617 , 8.40813876128213 },
-  { 196.51293492694958 , 549.2937099451414 },
-  { 505.1743459418857 , 47.57664607913459 },
-  { 149.9767332991862 , 329.73915595752885 },
-  { 226.18194882115517 , 84.33147691930965 },
-  { 405.9490672806591 , 357.9196866039878 },
-  { 149.84131482235495 , 92.30841686476157 },
-  { 569.28673341646852 , 205.38001600794112 },
-  { 13.029229730048314 , 327.5773732010966 },
-  { 18.783268790941037 , 6.7882879106416 },
-  { 214.79774878410143 , 156.14092674072486 },
-  { 557.9724349105504 , 104.38460256402628 },
-  { 238.40353608274134 , 409.3590068081694 },
-  { 323.64373572371622 , 109.67407911291299 },
-  { 557.2525512189046 , 322.3352298525043 },
-  { 798.34995132159574 , 67.77126963607145 },
-  { 715.198966457759056 , 124.79504659173654 },
-  { 6.44965826819697 , 440.39969371208474 },
-  { 12.232351553299385 , 162.64185913096034 },
-  { 47.35943000090515 , 506.5527882116738 },
-  { 315.4848121736086 , 551.3703717871138 },
-  { 894.84131482235495 , 211.29841686476158 },
-  { 104.6362760192985 , 563.7012492846466 },
-  { 781.74539512336497 , 342.844784209719435 },
-  { 725.87498696901116 , 49.15713264093435 },
-  { 108.14663512251822 , 288.5856687647695 },
-  { 340.25551616871167 , 16.35904367226955 },
-  { 732.55795840820142 , 587.2162976815197 },
-  { 38.663371910792506 , 611.8551821816656 },
-  { 867.00348245432218 , 21.60153998484408 },
-  { 831.05927989374612 , 556.41440369761239 },
-  { 85.3216323749252 , 105.43546866896601 },
-  { 493.8199326420899 , 312.36668234605503 },
-  { 552.70209456234699 , 460.59645746150414 },
-  { 868.09477280919248 , 457.579925056676615 },
-  { 737.2071533724013 , 475.85404367226954 },
-  { 984.800488374474 , 163.75402717137257 },
-  { 886.78622157124587 , 110.38917390310846 },
-  { 329.7724046497249 , 268.09309505297358 },
-  { 604.6243837632034 , 371.05600853372243 },
-  { 836.029174467468465 , 181.61461643627726 },
-  { 637.5922857611909 , 15.957799780471106 },
-  { 637.0653757528705 , 586.92116496395136 },
-  { 648.2598688818763 , 513.0335949390552 },
-  { 239.6442077730626 , 289.362880724342 },
-  { 222.9908559239197 , 505.17574813368566 },
-  { 340.2242242640137 , 434.9805887757982 },
-  { 195.3938755623052 , 372.2031773629658886 },
-  { 274.57954198074464 , 193.03425092420272 },
-  { 896.53507426012025 , 357.4145450114568 },
-  { 305.7121829655358 , 380.2491711148605 },
-  { 815.51492673852323 , 237.0477916026654 },
-  { 2.77351787670598 , 64.92144605169179 },
-  { 477.01118548792834 , 399.1548818205117 },
-  { 401.07905501590466 , 629.8744476040849 },
-  { 537.934523645956 , 518.1267590671707 },
-  { 668.6768796396027 , 338.0394787683423 },
-  { 420.5467462478923 , 495.5079505312206 },
-  { 983.30801259957377 , 68.52082642870185 },
-  { 627.16868305243 , 108.86102661268194 },
-  { 545.55019474731752 , 622.72858191943673 },
-  { 209.4717332991862 , 226.6907931612185 },
-  { 699.6554758168179 , 418.0449543306862 },
-  { 726.72404185341452 , 188.59809505297358 }
-},
-{ //#34 43
-  { 640.3338096353008 , 249.92185426160685 },
-  { 927.556467066728963 , 129.37580176299076 },
-  { 96.77290950205959 , 403.2341589154361 },
-  { 698.556467066728935 , 604.37580176299076 },
-  { 598.18664935724466 , 509.662704072325 },
-  { 810.71639966539482 , 340.38630849169346 },
-  { 178.75386166586054 , 362.03117970561993 },
-  { 729.0527409062849 , 66.58512105607923 },
-  { 700.71639966539485 , 677.38630849169346 },
-  { 718.38022635916852 , 250.86305116800116 },
-  { 499.5738607556623 , 34.7049709181029 },
-  { 187.40119316155594 , 423.870091100553 },
-  { 153.7939662143536 , 127.29159632489008 },
-  { 315.0521450563145 , 140.48602110653124 },
-  { 265.11772998996173 , 353.48782870200984 },
-  { 199.14487236885307 , 265.3083527725231 },
-  { 600.5374192305299 , 605.57878097280695 },
-  { 797.88685854666713 , 207.9199323709814 },
-  { 770.143064773374505 , 585.24276783887586 },
-  { 329.76822988961084 , 264.50404949070935 },
-  { 683.09244002050536 , 168.30462790244718 },
-  { 222.74264087716102 , 466.63788593292384 },
-  { 431.308882455836 , 267.16298505489254 },
-  { 525.5887138600614 , 323.8120229142494 },
-  { 177.12187383217997 , 566.5064931309417 },
-  { 15.152057985596826 , 195.20565054396175 },
-  { 257.8740463051087 , 224.9910000062113 },
-  { 785.6615334093755 , 499.6946072336898 },
-  { 122.62651829884759 , 511.64476596326136 },
-  { 306.64337479509055 , 405.4025843297268 },
-  { 599.45526282968524 , 71.1892221638938 },
-  { 248.5683624474549 , 145.80122761037015 },
-  { 108.14272721154383 , 44.80434691987966 },
-  { 843.8259959801732 , 102.97219103609814 },
-  { 597.7486464587273 , 406.8225296429521 },
-  { 879.83658430464303 , 200.9808343249083 },
-  { 42.17162437860161 , 103.38876258848632 },
-  { 541.298882455836 , 267.16298505489254 },
-  { 103.35517760560465 , 678.13497160773306 },
-  { 193.32672748827002 , 657.38753766460496 },
-  { 517.05938139191977 , 413.76326503454715 },
-  { 379.6717052650159 , 170.04757931633918 },
-  { 20.936500401768818 , 303.44018750193885 },
-  { 131.83714925689375 , 204.67892486102454 },
-  { 683.6879856383737 , 22.69224791630626 },
-  { 290.5173157398694 , 544.4125607956322 },
-  { 641.84504381637225 , 121.76921182628197 },
-  { 381.7031583451984 , 585.9181882483797 },
-  { 402.8427963833527 , 352.0783741988322 },
-  { 20.897977034227885 , 303.8402679707168 },
-  { 184.11131898066535 , 21.562422388634403 },
-  { 782.2126246597536 , 124.71010206923228 },
-  { 943.610982702204 , 276.5308435586143 },
-  { 780.34248636163665 , 420.5669779697705 },
-  { 66.17526263111921 , 201.01901040274868 },
-  { 413.0761143461481 , 110.87742809731019 },
-  { 939.5279690565372 , 353.76540713890665 },
-  { 690.36201458494612 , 510.76448353822366 },
-  { 481.36050018549 , 172.9701780282282 },
-  { 447.89679274169214 , 518.076268498278 },
-  { 843.4805527991416 , 606.3724229634565 },
-  { 354.6263539480221 , 485.93673135127756 },
-  { 516.23748433564407 , 499.76352293627536 },
-  { 553.5767840776944 , 5.91632887900727 },
-  { 702.6896476556463 , 409.30589867573025 },
-  { 120.73723956188346 , 309.5966997978782 },
-  { 588.605982702204 , 181.2767093963639 },
-  { 84.25561454401898 , 586.4539763615458 },
-  { 461.30120182282434 , 388.906117279249 },
-  { 738.3356172307793 , 299.8562693279596 },
-  { 860.2453138632378 , 488.2879746030193 },
-  { 899.46036125842586 , 589.72524354301066 },
-  { 18.62893016867875 , 547.4540072720041 },
-  { 877.60892843474517 , 385.5924469180978 },
-  { 848.3088652210308 , 301.7758595119964 },
-  { 59.63257176922707 , 477.82415674112417 },
-  { 657.6082972909449 , 347.51455621941204 },
-  { 252.1595316476486 , 569.3223970433511 },
-  { 285.1069404387395 , 39.89034669584403 },
-  { 394.6783952818506 , 32.47660684065895 },
-  { 492.6802028773292 , 99.4110219070117 }
-},
-{ //#23 44
-  { 474.148761984342 , 377.63516566620166 },
-  { 970.3580590723004 , 402.42447481116017 },
-  { 233.87276139569906 , 31.272846524433 },
-  { 375.4459879794489 , 319.23757250661225 },
-  { 562.2132258439225 , 457.4380586169093 },
-  { 471.26730203395346 , 139.369381560051 },
-  { 253.17578454137774 , 683.0868714717483 },
-  { 153.87276139569906 , 192.282846524433 },
-  { 894.3267694052144 , 510.11064842741337 },
-  { 143.55593369073722 , 511.5136742553034 },
-  { 524.945640161091 , 222.69965159606545 },
-  { 273.210364735111 , 382.4551210553557 },
-  { 559.6941048175086 , 38.98923241069156 },
-  { 53.17578454137774 , 423.0868714717483 },
-  { 167.58154169908164 , 55.74427097266437 },
-  { 632.9516637665087 , 512.7546319823554 },
-  { 55.723936191177785 , 494.9534669720652 },
-  { 174.0620965210486 , 597.3913088162833 },
-  { 659.5846238728361 , 125.09893661322496 },
-  { 436.32110651575874 , 448.826267893866 },
-  { 582.3984671773636 , 595.7930509691291 },
-  { 621.8931437302289 , 200.53786883963318 },
-  { 209.6688815203164 , 375.5559989594424 },
-  { 409.8130554044942 , 200.0497724808095 },
-  { 466.45817316856846 , 562.5599769255056 },
-  { 891.8525412380176 , 368.70188544616576 },
-  { 716.57712375555406 , 75.47902796599547 },
-  { 361.0173481208687 , 473.3742184362741 },
-  { 554.9009040343279 , 309.2068854461657 },
-  { 346.0345441521314 , 154.32534295529513 },
-  { 504.104025857579 , 454.1423995163019 },
-  { 341.5717727148959 , 517.879963280741 },
-  { 652.0278053478197 , 17.25584384319234 },
-  { 741.6544377714017 , 484.3570388227659 },
-  { 432.52794733509637 , 26.8621262494883 },
-  { 845.409407285485 , 280.1424209767644 },
-  { 701.06051860616395 , 595.2160509051815 },
-  { 33.7217104807237 , 156.5703998778365 },
-  { 350.73491175126196 , 729.790489455741 },
-  { 243.1751411184872 , 433.62535075081206 },
-  { 94.5554956067634 , 319.8004677171615 },
-  { 499.7410676764475 , 631.3872938114253 },
-  { 862.15442487379767 , 106.3507851326543 },
-  { 735.6838466422705 , 235.32717798459163 },
-  { 397.43419397078907 , 622.9418973550247 },
-  { 84.7638162300043 , 255.08187431207625 },
-  { 309.4500625139426 , 23.15460369109184 },
-  { 666.6416083866465 , 366.8274496542593 },
-  { 955.955414046585 , 529.2366396921673 },
-  { 3.81332856598044 , 288.547778685108 },
-  { 135.64668629132484 , 149.3367316331593 },
-  { 313.8278009946799 , 235.1624490603018 },
-  { 839.1253395213488 , 236.10717866135485 },
-  { 846.9291939707891 , 539.8935345587144 },
-  { 275.258624400562 , 309.8078821718484 },
-  { 356.3413559924475 , 396.85541859013705 },
-  { 977.11241421138743 , 459.25117399372556 },
-  { 782.351414625723 , 576.1710637700811 },
-  { 544.104025857579 , 135.1523995163019 },
-  { 154.87220440524015 , 416.01727921113763 },
-  { 478.75134982125104 , 284.9604302729743 },
-  { 218.3864753964193 , 536.8775743837899 },
-  { 97.80059803315013 , 603.9253442187241 },
-  { 778.1996226517914 , 152.71182177568596 },
-  { 420.121216825807 , 709.8140965949804 },
-  { 410.26254440701456 , 286.53343443402775 },
-  { 416.4612652712304 , 517.7061646187184 },
-  { 397.3752135602761 , 100.71161215093866 },
-  { 570.3897483639544 , 379.0725472757096 },
-  { 721.6003038739334 , 414.7213156564919 },
-  { 780.4323112986881 , 341.61675879921773 },
-  { 532.9271788611321 , 534.9295264194867 },
-  { 236.7066332805918 , 206.73031719604955 },
-  { 776.1724808989524 , 674.320546633198 },
-  { 641.9360233571384 , 440.7026067995401 },
-  { 635.6335714582278 , 280.3367092587573 },
-  { 175.01893647583057 , 308.1728067182471 },
-  { 838.0442207827173 , 439.61762673236063 },
-  { 310.8590733501843 , 611.7604077148101 },
-  { 255.65724662114314 , 136.7675069271289 },
-  { 285.1065773464971 , 524.3584079678014 }
-},
-{ //#19 20 45
-  { 430.9102163016844 , 128.44927814830652 },
-  { 435.06290741431496 , 277.3667926553087 },
-  { 537.0572445248592 , 288.65117318885603 },
-  { 523.3828142554493 , 53.566444817286325 },
-  { 980.1866328138868 , 76.27080717714139 },
-  { 549.7371446421312 , 134.67673358165442 },
-  { 579.6994468412545 , 419.73790813775804 },
-  { 313.38518065426894 , 109.83514115316947 },
-  { 462.895628282817 , 442.44227049761315 },
-  { 246.36140369860385 , 170.98612601700617 },
-  { 391.4496445138494 , 219.63803410387712 },
-  { 659.4215217605084 , 231.71469594584948 },
-  { 611.7314817526754 , 617.39235304810704 },
-  { 624.6199779731513 , 2.20413562788947 },
-  { 460.81896644084463 , 561.4141477442721 },
-  { 514.6827582649555 , 365.7935954388638 },
-  { 695.6774386509263 , 87.90980762527788 },
-  { 202.7494981734329 , 257.93835691469062 },
-  { 509.6844639030151 , 513.00101380463845 },
-  { 371.41521630168444 , 391.49764094461688 },
-  { 376.948411342071 , 81.53496752007621 },
-  { 161.57209455364537 , 77.1954231049646 },
-  { 257.0346871019839 , 264.29572991328166 },
-  { 214.7379998959445 , 43.29677756918532 },
-  { 404.68266791503277 , 45.26612200647291 },
-  { 314.72218381509555 , 368.36672886579834 },
-  { 75.63180054485024 , 103.96234906134107 },
-  { 12.576707293741201 , 204.8715920229942 },
-  { 390.0293532968215 , 633.97260529720144 },
-  { 738.36751362669236 , 526.41044714141952 },
-  { 745.2972895015669 , 19.483004841722703 },
-  { 775.589524260949 , 348.2749032290877 },
-  { 643.431158941862 , 392.09249938852352 },
-  { 575.1994956405451 , 528.6160587756073 },
-  { 505.9646000754791 , 15.849805241207676 },
-  { 667.2854112941325 , 467.1816825880183 },
-  { 5.0991509615643 , 354.0986228639893 },
-  { 679.4120998767286 , 311.89634455826706 },
-  { 140.76716085630773 , 573.6435255179222 },
-  { 200.23676672416602 , 661.39984415298625 },
-  { 350.30213871533226 , 558.0642109751377 },
-  { 209.80119641536572 , 593.15412851744672 },
-  { 334.1536644526618 , 184.31169940419966 },
-  { 541.2099356374898 , 647.5686876958582 },
-  { 257.5227593983758 , 4.773207078885761 },
-  { 995.5538521950717 , 315.63627683800416 },
-  { 804.7922895015669 , 122.53136763803305 },
-  { 29.93418133750698 , 16.0011399290404 },
-  { 267.03209301698269 , 533.70295834764084 },
-  { 933.2024742983417 , 126.52394462041495 },
-  { 852.458195216719 , 409.15163919702735 },
-  { 376.5127593983758 , 4.773207078885761 },
-  { 638.3925225398035 , 161.0310639683362 },
-  { 497.246622058797 , 191.33917413450928 },
-  { 431.9953104505755 , 364.51359444474923 },
-  { 113.48595025539424 , 497.81649877188505 },
-  { 776.0060031441624 , 271.98685610761385 },
-  { 874.84665024575145 , 49.27792461773326 },
-  { 124.9643468372481 , 290.7896623906043 },
-  { 372.3739727915116 , 491.86057437497823 },
-  { 110.00778553553971 , 13.96072729388476 },
-  { 976.2340861192945 , 211.31841093286204 },
-  { 96.19272230574835 , 383.9691323728243 },
-  { 195.99864519708746 , 145.80403287974804 },
-  { 593.4905917715806 , 298.3574315491985 },
-  { 630.9167603018664 , 52.28109381038749 },
-  { 882.21886243140517 , 336.8121103550245 },
-  { 459.3448760369487 , 633.587751359269 },
-  { 677.5857341049459 , 565.8818289284347 },
-  { 118.59657799809503 , 183.18341445996305 },
-  { 800.5591253456854 , 577.26817518199258 },
-  { 285.98252157461627 , 36.9657991956595 },
-  { 190.56731461498646 , 457.16547088459214 },
-  { 287.37864556133275 , 457.32553081698876 },
-  { 901.10974095572135 , 256.48939043242376 },
-  { 321.2722045022734 , 282.15610180026715 },
-  { 572.7395571541242 , 193.91025676629158 },
-  { 20.43387377345839 , 283.33538029340578 },
-  { 747.9964139133505 , 173.3329202183884 },
-  { 212.99654086418587 , 361.2647700129692 },
-  { 854.9439174824884 , 195.4947029748207 }
-},
-{ //#46
-  { 340.2085598377676 , 360.71301164232784 },
-  { 423.48536993401285 , 302.4271917693175 },
-  { 230.52376634160646 , 614.2292290334683 },
-  { 24.5125455529069 , 209.62252280616434 },
-  { 317.24318830047827 , 630.8946985401438 },
-  { 400.4885640687954 , 660.98985107884096 },
-  { 281.7187723626819 , 100.98668222410514 },
-  { 533.4753699340129 , 532.4271917693175 },
-  { 648.2123333059201 , 432.9080566554272 },
-  { 469.0421820868911 , 589.503647574295 },
-  { 508.73300346673113 , 195.2562283435895 },
-  { 800.83141571620405 , 505.30964415258296 },
-  { 356.16435393790084 , 174.79042949057882 },
-  { 576.6286366916024 , 366.6354407012496 },
-  { 363.3130081506354 , 419.82100034060676 },
-  { 184.07095191181432 , 134.60952318289014 },
-  { 572.7900410492942 , 256.71244363741926 },
-  { 235.70812910263442 , 37.49411744433675 },
-  { 537.2005102375574 , 651.4984099771241 },
-  { 973.37058074767583 , 66.15458890851961 },
-  { 338.57064168335376 , 526.9919637663347 },
-  { 299.76649418071736 , 263.31733653172466 },
-  { 36.0233356064733 , 8.9779000531963 },
-  { 617.9031546857601 , 181.85181926245727 },
-  { 203.56707259245522 , 209.99312640083008 },
-  { 401.8160495216791 , 121.2677811907629 },
-  { 740.9694733905335 , 161.3363843679237 },
-  { 522.6490205235098 , 26.85681926245726 },
-  { 356.731771985956 , 20.54508858301253 },
-  { 629.06628499129488 , 679.0601082330683 },
-  { 713.19429903220131 , 548.720266520478 },
-  { 671.8827708538528 , 311.64044070124953 },
-  { 106.91803473309835 , 304.2729578050554 },
-  { 947.1712113024837 , 165.26067714258528 },
-  { 676.7174007381002 , 226.38730928336656 },
-  { 581.77118980702306 , 435.7040018655628 },
-  { 105.35237928209955 , 174.91390091697178 },
-  { 281.1863576503677 , 186.24670037371027 },
-  { 53.9170771402333 , 510.26567714258528 },
-  { 553.4699668386385 , 94.77536345747984 },
-  { 496.1618668579988 , 338.7064567499101 },
-  { 180.5893512752537 , 412.23103662894687 },
-  { 333.29614706485546 , 67.20397488586755 },
-  { 140.47486320531016 , 474.5871243679834 },
-  { 432.7202389736274 , 434.49197182928623 },
-  { 442.68361033641185 , 8.70106056067675 },
-  { 12.7507961017221 , 139.64321746258065 },
-  { 643.8252531839665 , 526.91750299600736 },
-  { 679.4087821385075 , 90.6659766571282 },
-  { 18.97071954140705 , 586.94850974047708 },
-  { 785.1379560747631 , 60.3486238908164 },
-  { 940.36302886926205 , 319.9856608606297 },
-  { 398.7430034667311 , 195.2562283435895 },
-  { 293.12871409855404 , 10.71845892499941 },
-  { 525.7587642629437 , 434.10049455852084 },
-  { 868.956122144486 , 256.9133708131715 },
-  { 842.9909973867603 , 393.61303437464653 },
-  { 244.1928235113872 , 493.41552617382166 },
-  { 447.49022656423904 , 511.6843143917371 },
-  { 319.37594746779587 , 427.95483476803827 },
-  { 500.2986467613579 , 284.6934494937612 },
-  { 139.83750767195926 , 576.33906208486832 },
-  { 189.82738373897573 , 24.770260655234566 },
-  { 423.48536993401285 , 302.4271917693175 },
-  { 18.14615247232453 , 66.2780603349126 },
-  { 12.2425468718033 , 289.41570106235974 },
-  { 780.8023557347381 , 326.9480900758471 },
-  { 781.0529220728818 , 235.0448497823817 },
-  { 85.3172807430482 , 651.63300636035481 },
-  { 595.22670168918984 , 590.63617517850122 },
-  { 364.19733904906803 , 256.1063054150239 },
-  { 119.54313797335689 , 70.91631278680293 },
-  { 872.3406788601419 , 113.51772898933088 },
-  { 629.3953614408855 , 41.046727331013614 },
-  { 890.7756037249895 , 328.8676802598839 },
-  { 283.3617319985027 , 695.20578248134615 },
-  { 458.7985884003784 , 97.25442074811093 },
-  { 260.3496034102298 , 366.00184764215186 },
-  { 59.12256358021654 , 392.75347247502765 },
-  { 192.08643695006285 , 302.8435733573905 },
-  { 736.0653923628308 , 427.4289549619568 }
-},
-{ //#47
-  { 464.29681995298296 , 252.79738296953792 },
-  { 396.6123651238161 , 97.13379396692952 },
-  { 46.2628650234652 , 586.11757317822997 },
-  { 720.20689095703096 , 18.01360932768131 },
-  { 224.95275679478056 , 473.0086093276813 },
-  { 694.6141727192947 , 147.06820903328224 },
-  { 205.4265225184871 , 558.63942141967698 },
-  { 897.9849349115433 , 193.79008772534632 },
-  { 318.22956689102585 , 531.2944292006915 },
-  { 363.67641041875396 , 473.24936630518465 },
-  { 115.11349426712498 , 367.25217750051993 },
-  { 207.65184765577874 , 380.86474655696863 },
-  { 52.43008158752005 , 420.27284948264946 },
-  { 342.9719333583076 , 24.123465774963478 },
-  { 972.98312731606467 , 143.85567265899363 },
-  { 192.79479299232673 , 178.19256943605558 },
-  { 24.1717066063522 , 158.48689362833352 },
-  { 312.65458059199585 , 429.85263971121918 },
-  { 232.9986853680561 , 26.043055959000284 },
-  { 206.30633787923887 , 305.04489558646208 },
-  { 303.000664147256 , 126.6494499097405 },
-  { 629.2707547845534 , 100.51327762910103 },
-  { 706.672851349721 , 361.6159382422122 },
-  { 123.42174361779223 , 286.6820727772822 },
-  { 842.29042117405504 , 112.64641290144417 },
-  { 130.67292539055524 , 16.359571468324447 },
-  { 247.68792399749267 , 258.17168712449467 },
-  { 244.4957710428653 , 635.43051923055665 },
-  { 527.1463392692351 , 483.867090661516 },
-  { 566.183082550302 , 190.61181098044727 },
-  { 123.27661547997803 , 218.370541411883995 },
-  { 560.4266507231406 , 600.45107350810287 },
-  { 585.1690171904223 , 407.6220369338309 },
-  { 452.14208457733656 , 10.719056693831238 },
-  { 111.57336232896958 , 124.6785762221372 },
-  { 8.390667334028137 , 93.86116679752739 },
-  { 557.3260446857108 , 42.877020496285056 },
-  { 261.09233307862485 , 367.34183834352365 },
-  { 20.92894838805154 , 245.60681098044728 },
-  { 526.7721365217485 , 252.2521691416565 },
-  { 611.0293648204049 , 322.952378331079 },
-  { 520.6349142024942 , 117.71950443887603 },
-  { 557.3260446857108 , 42.877020496285056 },
-  { 942.68545764341707 , 80.1656673008809 },
-  { 349.40613831404113 , 200.7696345489887 },
-  { 138.2535894093307 , 506.96301245973044 },
-  { 721.0193648204049 , 322.952378331079 },
-  { 532.434575840799 , 336.7926535857763 },
-  { 463.398480306832 , 496.65829459839168 },
-  { 327.4978072454099 , 268.22165370427535 },
-  { 401.8928528540846 , 262.10772345763 },
-  { 794.6122039230826 , 169.24166241295387 },
-  { 694.4103755233974 , 216.22955139798216 },
-  { 619.4932713549396 , 9.50306200354545 },
-  { 433.97946718667123 , 147.06820903328224 },
-  { 448.17734754214257 , 407.4928627751988 },
-  { 485.6483199475757 , 177.30212777816246 },
-  { 364.37467458887556 , 407.47373585397608 },
-  { 459.43186271324237 , 554.99427425200366 },
-  { 622.298471940484 , 227.96864597169647 },
-  { 263.85174871905934 , 150.52893994174858 },
-  { 744.2933423601519 , 475.54193956502277 },
-  { 801.9968301281087 , 239.09775827102752 },
-  { 991.1383492888614 , 200.00876998807888 },
-  { 458.8603705271282 , 631.0914025027309 },
-  { 353.4170979337483 , 337.85433435818285 },
-  { 292.2521164223154 , 48.51364563808205 },
-  { 689.1666053205912 , 443.4312782425735 },
-  { 611.3919304578828 , 521.2059531052819 },
-  { 784.64848459812356 , 93.0266089509555 },
-  { 177.15670799941478 , 116.04436496448557 },
-  { 36.01029327926267 , 526.08112763181609 },
-  { 73.6448014962785 , 38.86616679752734 },
-  { 377.45182553174686 , 542.7234158376138424 },
-  { 428.48757864424033 , 356.7949710997068 },
-  { 317.60785662500564 , 623.856746228014 },
-  { 873.2747405887221 , 263.04753086977615 },
-  { 231.96380625009124 , 67.96572985911301 },
-  { 757.3260446857108 , 552.86702049628505 },
-  { 468.5451640232893 , 84.60761989387129 },
-  { 279.3796745888755 , 2.2196016917257 }
-},
-{ //#26 39 48
-  { 415.15670086169376 , 187.84701394190105 },
-  { 547.3184836181261 , 294.7945175110389 },
-  { 450.7582763348879 , 632.6265150105984 },
-  { 753.8115805970648 , 185.263644998733 },
-  { 402.7248456481627 , 247.90584731512828 },
-  { 742.66059573322804 , 98.23986804306796 },
-  { 795.47342026719394 , 432.82580315451497 },
-  { 86.2317486692241 , 507.43671982743416 },
-  { 91.4923365788189 , 221.04693681611866 },
-  { 854.3633697381212 , 49.8422748834785 },
-  { 76.2317486692241 , 337.43671982743416 },
-  { 294.9473681356767 , 235.44238271688982 },
-  { 266.6857378023808 , 121.25352593629266 },
-  { 871.432665812278 , 504.29075443016262 },
-  { 526.8134836181262 , 191.74615471472856 },
-  { 165.5291030845788 , 593.7404918252729 },
-  { 659.3016476512309 , 14.91356348482617 },
-  { 626.6158380334808 , 451.09828950887757 },
-  { 277.37035368339303 , 158.32456998273645 },
-  { 385.0180350266286 , 622.892208297015 },
-  { 484.21077344979625 , 139.86766293142972 },
-  { 234.02143482887178 , 289.29679697752965 },
-  { 493.72080903152164 , 571.28980145660444 },
-  { 875.8754430038678 , 320.1539170568334 },
-  { 850.5988736463378 , 126.51597032523675 },
-  { 785.19574739810986 , 296.15570747653925 },
-  { 6.24655440012185 , 74.00432052317305 },
-  { 138.96769769968535 , 129.4215164037159 },
-  { 484.8114459064546 , 378.0856095205769 },
-  { 353.8723203281464 , 105.85267683135673 },
-  { 460.05443264858735 , 86.77931408732059 },
-  { 355.21304634327976 , 437.33619158775605 },
-  { 346.5391030845788 , 293.7404918252729 },
-  { 582.2823476564017 , 456.3354696819879 },
-  { 632.8015805970648 , 185.263644998733 },
-  { 577.23670717951 , 66.11691742673244 },
-  { 343.5016584986025 , 704.38988395729353 },
-  { 402.8577027825204 , 720.175404183487487 },
-  { 108.20259797295296 , 31.124539556202294 },
-  { 649.47342026719394 , 291.815803154515 },
-  { 663.4333325202383 , 369.31169272632275 },
-  { 746.8266832986463 , 556.29942648968907 },
-  { 788.17778262704894 , 515.01198459607744 },
-  { 526.3056645567539 , 16.62330638442372 },
-  { 697.9002185670281 , 149.10395239833323 },
-  { 485.4642097467537 , 267.5835871854789 },
-  { 692.1497409269356 , 252.82580315451494 },
-  { 520.9642620427533 , 51.237492415405356 },
-  { 202.7573100668468 , 476.8033172897626 },
-  { 555.8202104091716 , 356.76409375470524 },
-  { 405.6804316872166 , 335.7099337660923 },
-  { 375.87544300386776 , 505.09911296436337 },
-  { 589.2141222041643 , 148.7083941653525 },
-  { 665.38851180727386 , 539.6511190958821 },
-  { 637.6283018987962 , 69.78284205375988 },
-  { 359.31523572062963 , 387.2671154648039 },
-  { 306.4050444860683 , 561.36639833158085 },
-  { 526.3056645567539 , 16.62330638442372 },
-  { 471.9567408014997 , 500.9099082325473 },
-  { 127.0485146634211 , 313.9264616234855 },
-  { 35.0408152165206 , 138.07204312534014 },
-  { 451.1161327824414 , 429.5655375213129 },
-  { 296.54581521652057 , 35.023680329029816 },
-  { 781.5363991040392 , 354.8104595545442 },
-  { 257.0485146634211 , 432.91646162348553 },
-  { 840.3928544474022 , 218.09124361695876 },
-  { 413.77429647612337 , 29.628105523889886 },
-  { 212.8085506722922 , 65.38269097252031 },
-  { 943.8924679881741 , 118.09213504488952 },
-  { 18.62384166928234 , 397.9995709824227 },
-  { 237.06893796986162 , 540.1487049673125 },
-  { 286.7085544405576 , 333.63327192412 },
-  { 184.62176128077465 , 190.86794416633046 },
-  { 133.7247109575526 , 430.72781183697214 },
-  { 238.70671302180867 , 656.05085682257123 },
-  { 715.9169283037397 , 387.6085485232089 },
-  { 592.6530094859455 , 574.8726768079247 },
-  { 922.2487815795656 , 232.69948130918908 },
-  { 199.12299445255314 , 398.97101075013137 },
-  { 32.3552608622373 , 500.46279687443342 },
-  { 3.41881432021074 , 297.38616143859116 }
-},
-{ //22 49
-  { 405.9490672806591 , 357.9196866039878 },
-  { 557.2525512189046 , 302.3352298525043 },
-  { 497.4118601547223 , 221.549024774444 },
-  { 493.8199326420899 , 332.36668234605503 },
-  { 94.452234400936 , 383.125555711557 },
-  { 156.0622040057982 , 458.15519505208437 },
-  { 462.3271361664732 , 578.0957622223657 },
-  { 884.245645280762 , 298.318956935119 },
-  { 47.682302240260995 , 249.9593408375967 },
-  { 165.3033592108081 , 609.2467470862024 },
-  { 344.1787861110988 , 168.60873076564883 },
-  { 746.89007624515403 , 264.78739538168617 },
-  { 153.70316855343486 , 195.939011273588 },
-  { 799.2340410657407 , 429.44591429464919 },
-  { 277.6856891321601 , 36.07785825334297 },
-  { 419.3721873346608 , 45.81531988582283 },
-  { 442.51694644096966 , 133.17088892143076 },
-  { 282.10717776924565 , 631.9511094460574 },
-  { 655.83809740579892 , 245.6005200641416 },
-  { 947.21007157449617 , 428.40813876128213 },
-  { 196.51293492694958 , 549.2937099451414 },
-  { 525.1743459418857 , 27.57664607913459 },
-  { 149.9767332991862 , 329.73915595752885 },
-  { 226.18194882115517 , 84.33147691930965 },
-  { 149.84131482235495 , 92.30841686476157 },
-  { 599.28673341646852 , 205.38001600794112 },
-  { 13.029229730048314 , 327.5773732010966 },
-  { 18.783268790941037 , 6.7882879106416 },
-  { 214.79774878410143 , 656.14092674072486 },
-  { 557.9724349105504 , 104.38460256402628 },
-  { 238.40353608274134 , 409.3590068081694 },
-  { 323.64373572371622 , 109.67407911291299 },
-  { 798.34995132159574 , 67.77126963607145 },
-  { 715.198966457759056 , 124.79504659173654 },
-  { 6.44965826819697 , 440.39969371208474 },
-  { 12.232351553299385 , 162.64185913096034 },
-  { 47.35943000090515 , 506.5527882116738 },
-  { 315.4848121736086 , 551.3703717871138 },
-  { 894.84131482235495 , 211.29841686476158 },
-  { 104.6362760192985 , 563.7012492846466 },
-  { 781.74539512336497 , 342.844784209719435 },
-  { 725.87498696901116 , 49.15713264093435 },
-  { 108.14663512251822 , 288.5856687647695 },
-  { 340.25551616871167 , 16.35904367226955 },
-  { 732.55795840820142 , 587.2162976815197 },
-  { 38.663371910792506 , 611.8551821816656 },
-  { 867.00348245432218 , 21.60153998484408 },
-  { 831.05927989374612 , 556.41440369761239 },
-  { 85.3216323749252 , 105.43546866896601 },
-  { 552.70209456234699 , 460.59645746150414 },
-  { 868.09477280919248 , 457.579925056676615 },
-  { 737.2071533724013 , 495.85404367226954 },
-  { 984.800488374474 , 163.75402717137257 },
-  { 886.78622157124587 , 110.38917390310846 },
-  { 329.7724046497249 , 268.09309505297358 },
-  { 604.6243837632034 , 371.05600853372243 },
-  { 806.029174467468465 , 161.61461643627726 },
-  { 637.5922857611909 , 15.957799780471106 },
-  { 637.0653757528705 , 586.92116496395136 },
-  { 648.2598688818763 , 513.0335949390552 },
-  { 239.6442077730626 , 289.362880724342 },
-  { 416.3837374013813 , 263.6256866164163 },
-  { 222.9908559239197 , 505.17574813368566 },
-  { 340.2242242640137 , 434.9805887757982 },
-  { 155.3938755623052 , 2.2031773629658886 },
-  { 274.57954198074464 , 193.03425092420272 },
-  { 896.53507426012025 , 357.4145450114568 },
-  { 305.7121829655358 , 370.2491711148605 },
-  { 815.51492673852323 , 237.0477916026654 },
-  { 2.77351787670598 , 64.92144605169179 },
-  { 477.01118548792834 , 430.1548818205117 },
-  { 401.07905501590466 , 629.8744476040849 },
-  { 537.934523645956 , 518.1267590671707 },
-  { 668.6768796396027 , 338.0394787683423 },
-  { 420.5467462478923 , 495.5079505312206 },
-  { 583.30801259957377 , 668.52082642870185 },
-  { 627.16868305243 , 108.86102661268194 },
-  { 845.55019474731752 , 622.72858191943673 },
-  { 209.4717332991862 , 226.6907931612185 },
-  { 699.6554758168179 , 418.0449543306862 },
-  { 726.72404185341452 , 688.59809505297358 }
-},
-{ //#11 50
-  { 376.10486057551226 , 285.16668698042093 },
-  { 20.375412706764486 , 465.96489746210136 },
-  { 527.09823963986133 , 12.5738867591089 },
-  { 82.36127626795408 , 613.0547516452185 },
-  { 189.08410320105094 , 639.663740942226 },
-  { 232.827413576117 , 42.8912395254206 },
-  { 428.22070734881308 , 50.9024603141201 },
-  { 848.84291947759074 , 592.207079095636 },
-  { 923.54711887328313 , 674.560379097966 },
-  { 8.84291947759075 , 652.197079095636 },
-  { 730.45503100010342 , 284.9550911947186 },
-  { 104.82687490239454 , 36.9635317528035 },
-  { 466.82429194018627 , 837.9513898009586 },
-  { 268.63665488485964 , 438.8936513952517 },
-  { 926.10458664302016 , 312.2822502284132 },
-  { 220.8687708552885 , 365.3836363516075 },
-  { 330.5777187032847 , 14.1963944927732 },
-  { 101.02050929888833 , 686.8054515029053 },
-  { 725.00432383528268 , 702.1300761594664 },
-  { 747.09166804448625 , 148.31307632100464 },
-  { 808.18366626263656 , 231.3447361884132 },
-  { 234.64787567355918 , 543.5003576225556 },
-  { 615.1204374937192 , 448.5784448914128 },
-  { 41.362494108230564 , 177.9957235546929 },
-  { 523.82106657295816 , 275.96489746210136 },
-  { 918.92101590545704 , 85.2542347605182 },
-  { 905.2990720011899 , 219.7075589975931 },
-  { 332.6496832690377 , 493.56594255620286 },
-  { 773.0156776722591 , 786.3808617867965 },
-  { 439.37251020213455 , 540.1749318532103 },
-  { 628.68218200524632 , 707.9535109227974 },
-  { 565.29189883027448 , 105.91958439652785 },
-  { 418.7034810823221 , 638.8777102166221 },
-  { 529.4710435534807 , 583.2626040874618 },
-  { 634.3326691697203 , 789.9841402314152 },
-  { 628.395334538275225 , 585.4072492263696 },
-  { 828.7602784331126 , 491.0106665876796 },
-  { 120.5083412656051 , 322.0612272440825 },
-  { 6.919444478883442 , 740.1967655692758 },
-  { 505.7158868616815 , 422.12363348814006 },
-  { 414.7721094994205 , 186.54159925914087 },
-  { 440.58118887586014 , 749.0512042137824 },
-  { 4.37829711502256 , 557.5206046236677 },
-  { 936.29407200118993 , 774.9616931598434 },
-  { 139.6285259048533 , 245.65575307729733 },
-  { 537.8266986888912 , 766.8475789952852 },
-  { 832.9345821448395 , 686.0574647727752 },
-  { 129.2691883947744 , 526.460718647466 },
-  { 181.68825331360563 , 729.0339815953105 },
-  { 272.87409591893464 , 790.539609048058 },
-  { 947.406874548325135 , 454.7968589298642 },
-  { 94.33900724232554 , 777.5187109846087 },
-  { 937.14776378375484 , 553.6815031331705 },
-  { 823.76745791359164 , 54.5124979092668 },
-  { 493.13604848458084 , 180.1142116961759 },
-  { 349.0208338486339 , 123.1485362803664 },
-  { 585.64213633100735 , 356.4956605278415 },
-  { 238.62576921198655 , 211.990953326524 },
-  { 651.09958664302016 , 121.0281160661628 },
-  { 402.2914009194472 , 863.3208113586945 },
-  { 25.851910808627423 , 269.59736993657367 },
-  { 851.20441023438792 , 388.58093197131484 },
-  { 518.4255509704002 , 656.5502247637384 },
-  { 723.98180404530258 , 480.20846563494 },
-  { 735.787507809200534 , 590.8958609166766 },
-  { 115.37129760619692 , 116.3559622667198 },
-  { 136.04271513038435 , 432.0030857396392 },
-  { 239.99807964634772 , 851.7357153242097 },
-  { 690.59079334231 , 383.4856387018432 },
-  { 288.134139402524 , 291.9511864311408 },
-  { 396.47688410418175 , 384.3373637984763 },
-  { 223.6571174792071 , 123.07915217047452 },
-  { 275.96808471783095 , 672.3849437359536 },
-  { 720.95184199804848 , 46.2671533590521 },
-  { 340.3046027285942 , 582.7837808926755 },
-  { 620.6067213757875 , 253.1939325363402 },
-  { 362.57256452664082 , 711.8525789952852 },
-  { 25.737288869704535 , 370.25028475952433 },
-  { 143.471810878275 , 867.8923387477558 },
-  { 16.50570462369836 , 839.7682204123869 },
-  { 316.39031331007513 , 890.2244025442191 }
-},
-{ //#19 20 45 51
-  { 113.48595025539424 , 497.81649877188505 },
-  { 287.37864556133275 , 457.32553081698876 },
-  { 460.9102163016844 , 158.44927814830652 },
-  { 435.06290741431496 , 277.3667926553087 },
-  { 537.0572445248592 , 288.65117318885603 },
-  { 523.3828142554493 , 743.566444817286325 },
-  { 780.1866328138868 , 436.27080717714139 },
-  { 929.7371446421312 , 134.67673358165442 },
-  { 579.6994468412545 , 419.73790813775804 },
-  { 13.38518065426894 , 609.83514115316947 },
-  { 462.895628282817 , 442.44227049761315 },
-  { 246.36140369860385 , 170.98612601700617 },
-  { 391.4496445138494 , 219.63803410387712 },
-  { 659.4215217605084 , 231.71469594584948 },
-  { 611.7314817526754 , 617.39235304810704 },
-  { 624.6199779731513 , 2.20413562788947 },
-  { 460.81896644084463 , 561.4141477442721 },
-  { 514.6827582649555 , 365.7935954388638 },
-  { 695.6774386509263 , 87.90980762527788 },
-  { 202.7494981734329 , 257.93835691469062 },
-  { 509.6844639030151 , 513.00101380463845 },
-  { 360.41521630168444 , 761.49764094461688 },
-  { 376.948411342071 , 101.53496752007621 },
-  { 121.57209455364537 , 779.1954231049646 },
-  { 287.0346871019839 , 694.29572991328166 },
-  { 214.7379998959445 , 43.29677756918532 },
-  { 464.68266791503277 , 45.26612200647291 },
-  { 314.72218381509555 , 368.36672886579834 },
-  { 75.63180054485024 , 103.96234906134107 },
-  { 12.576707293741201 , 204.8715920229942 },
-  { 390.0293532968215 , 633.97260529720144 },
-  { 738.36751362669236 , 526.41044714141952 },
-  { 745.2972895015669 , 19.483004841722703 },
-  { 775.589524260949 , 348.2749032290877 },
-  { 643.431158941862 , 392.09249938852352 },
-  { 575.1994956405451 , 528.6160587756073 },
-  { 675.9646000754791 , 755.849805241207676 },
-  { 667.2854112941325 , 697.1816825880183 },
-  { 5.0991509615643 , 354.0986228639893 },
-  { 679.4120998767286 , 311.89634455826706 },
-  { 140.76716085630773 , 593.6435255179222 },
-  { 200.23676672416602 , 661.39984415298625 },
-  { 350.30213871533226 , 558.0642109751377 },
-  { 209.80119641536572 , 753.15412851744672 },
-  { 334.1536644526618 , 184.31169940419966 },
-  { 541.2099356374898 , 647.5686876958582 },
-  { 257.5227593983758 , 774.773207078885761 },
-  { 875.5538521950717 , 315.63627683800416 },
-  { 804.7922895015669 , 122.53136763803305 },
-  { 29.93418133750698 , 16.0011399290404 },
-  { 247.03209301698269 , 563.70295834764084 },
-  { 953.2024742983417 , 426.52394462041495 },
-  { 752.458195216719 , 669.15163919702735 },
-  { 376.5127593983758 , 4.773207078885761 },
-  { 638.3925225398035 , 161.0310639683362 },
-  { 457.246622058797 , 798.33917413450928 },
-  { 431.9953104505755 , 364.51359444474923 },
-  { 776.0060031441624 , 271.98685610761385 },
-  { 874.84665024575145 , 449.27792461773326 },
-  { 124.9643468372481 , 290.7896623906043 },
-  { 372.3739727915116 , 491.86057437497823 },
-  { 110.00778553553971 , 13.96072729388476 },
-  { 976.2340861192945 , 211.31841093286204 },
-  { 96.19272230574835 , 383.9691323728243 },
-  { 185.99864519708746 , 135.80403287974804 },
-  { 593.4905917715806 , 798.3574315491985 },
-  { 630.9167603018664 , 52.28109381038749 },
-  { 20.21886243140517 , 536.8121103550245 },
-  { 459.3448760369487 , 713.587751359269 },
-  { 677.5857341049459 , 565.8818289284347 },
-  { 118.59657799809503 , 183.18341445996305 },
-  { 800.5591253456854 , 577.26817518199258 },
-  { 285.98252157461627 , 36.9657991956595 },
-  { 190.56731461498646 , 457.16547088459214 },
-  { 901.10974095572135 , 256.48939043242376 },
-  { 321.2722045022734 , 282.15610180026715 },
-  { 542.7395571541242 , 193.91025676629158 },
-  { 20.43387377345839 , 283.33538029340578 },
-  { 747.9964139133505 , 173.3329202183884 },
-  { 212.99654086418587 , 361.2647700129692 },
-  { 854.9439174824884 , 195.4947029748207 }
-},
-{ //#38 52
-  { 860.2453138632378 , 488.2879746030193 },
-  { 927.556467066728963 , 129.37580176299076 },
-  { 76.77290950205959 , 403.2341589154361 },
-  { 698.556467066728935 , 604.37580176299076 },
-  { 598.18664935724466 , 509.662704072325 },
-  { 810.71639966539482 , 340.38630849169346 },
-  { 178.75386166586054 , 362.03117970561993 },
-  { 729.0527409062849 , 66.58512105607923 },
-  { 700.71639966539485 , 687.38630849169346 },
-  { 883.38022635916852 , 700.86305116800116 },
-  { 499.5738607556623 , 34.7049709181029 },
-  { 187.40119316155594 , 423.870091100553 },
-  { 153.7939662143536 , 127.29159632489008 },
-  { 315.0521450563145 , 140.48602110653124 },
-  { 265.11772998996173 , 353.48782870200984 },
-  { 199.14487236885307 , 265.3083527725231 },
-  { 600.5374192305299 , 605.57878097280695 },
-  { 797.88685854666713 , 207.9199323709814 },
-  { 770.143064773374505 , 585.24276783887586 },
-  { 329.76822988961084 , 264.50404949070935 },
-  { 683.09244002050536 , 168.30462790244718 },
-  { 222.74264087716102 , 466.63788593292384 },
-  { 431.308882455836 , 267.16298505489254 },
-  { 525.5887138600614 , 323.8120229142494 },
-  { 177.12187383217997 , 566.5064931309417 },
-  { 15.152057985596826 , 195.20565054396175 },
-  { 257.8740463051087 , 224.9910000062113 },
-  { 785.6615334093755 , 499.6946072336898 },
-  { 122.62651829884759 , 511.64476596326136 },
-  { 306.64337479509055 , 405.4025843297268 },
-  { 599.45526282968524 , 71.1892221638938 },
-  { 248.5683624474549 , 145.80122761037015 },
-  { 38.14272721154383 , 14.80434691987966 },
-  { 843.8259959801732 , 102.97219103609814 },
-  { 597.7486464587273 , 406.8225296429521 },
-  { 879.83658430464303 , 200.9808343249083 },
-  { 42.17162437860161 , 103.38876258848632 },
-  { 541.298882455836 , 267.16298505489254 },
-  { 103.35517760560465 , 678.13497160773306 },
-  { 193.32672748827002 , 657.38753766460496 },
-  { 17.05938139191977 , 413.76326503454715 },
-  { 379.6717052650159 , 170.04757931633918 },
-  { 20.936500401768818 , 303.44018750193885 },
-  { 131.83714925689375 , 204.67892486102454 },
-  { 683.6879856383737 , 22.69224791630626 },
-  { 290.5173157398694 , 544.4125607956322 },
-  { 641.84504381637225 , 121.76921182628197 },
-  { 401.7031583451984 , 605.9181882483797 },
-  { 402.8427963833527 , 352.0783741988322 },
-  { 20.897977034227885 , 303.8402679707168 },
-  { 184.11131898066535 , 21.562422388634403 },
-  { 782.2126246597536 , 124.71010206923228 },
-  { 943.610982702204 , 276.5308435586143 },
-  { 640.3338096353008 , 249.92185426160685 },
-  { 780.34248636163665 , 420.5669779697705 },
-  { 66.17526263111921 , 201.01901040274868 },
-  { 393.0761143461481 , 80.87742809731019 },
-  { 939.5279690565372 , 353.76540713890665 },
-  { 690.36201458494612 , 510.76448353822366 },
-  { 481.36050018549 , 172.9701780282282 },
-  { 447.89679274169214 , 518.076268498278 },
-  { 843.4805527991416 , 606.3724229634565 },
-  { 354.6263539480221 , 485.93673135127756 },
-  { 516.23748433564407 , 499.76352293627536 },
-  { 553.5767840776944 , 5.91632887900727 },
-  { 702.6896476556463 , 409.30589867573025 },
-  { 120.73723956188346 , 309.5966997978782 },
-  { 588.605982702204 , 181.2767093963639 },
-  { 84.25561454401898 , 586.4539763615458 },
-  { 461.30120182282434 , 408.906117279249 },
-  { 738.3356172307793 , 299.8562693279596 },
-  { 929.46036125842586 , 589.72524354301066 },
-  { 18.62893016867875 , 547.4540072720041 },
-  { 877.60892843474517 , 385.5924469180978 },
-  { 848.3088652210308 , 301.7758595119964 },
-  { 59.63257176922707 , 477.82415674112417 },
-  { 657.6082972909449 , 347.51455621941204 },
-  { 252.1595316476486 , 569.3223970433511 },
-  { 285.1069404387395 , 39.89034669584403 },
-  { 394.6783952818506 , 2.47660684065895 },
-  { 492.6802028773292 , 99.4110219070117 }
-},
-{ //#2 53
-  { 444.65313400322685 , 490.6311615757162 },
-  { 475.94066462562273 , 83.08185785633614 },
-  { 402.34298923221195 , 664.82035721059475 },
-  { 112.2444558808657 , 671.73268497634322 },
-  { 427.0853556994937 , 271.99132063632277 },
-  { 73.50595652660712 , 175.33036036975403 },
-  { 503.58931806344583 , 207.79687403312997 },
-  { 584.576505207682 , 440.28808466611113 },
-  { 105.0871632949722 , 242.05690556997 },
-  { 340.41205291029036 , 339.7079263073919 },
-  { 368.89349374022254 , 7.452853572117888 },
-  { 476.9900506029707 , 7.41987779306581 },
-  { 565.0949455161932 , 516.6110314278009 },
-  { 262.6940721519604 , 20.77706370301251 },
-  { 421.3289238723323 , 381.83058316397836 },
-  { 674.6750385590282 , 363.3757569003627 },
-  { 386.8915172516245 , 580.5075500273174 },
-  { 31.405926808502 , 385.6691788062864 },
-  { 659.3747769204185 , 139.96199356844401 },
-  { 509.9647644543916 , 415.03680997375335 },
-  { 152.4911691336333 , 589.19135292637648 },
-  { 64.8959056100537 , 43.26209488086058 },
-  { 549.4517798565882 , 593.80058921075206 },
-  { 162.85480962430483 , 66.5334955301739 },
-  { 240.3933096112805 , 589.45054982893845 },
-  { 406.51228930461286 , 110.80964493235994 },
-  { 357.0128848329811 , 158.41030273794814 },
-  { 586.5927907477196 , 130.87106296464094 },
-  { 5.77594076238046 , 135.71059448938655 },
-  { 301.20616571602955 , 91.07313207109763 },
-  { 551.7883223157072 , 37.09378669539869 },
-  { 951.7783223157072 , 27.09378669539869 },
-  { 735.8228340389159 , 637.31156784357581 },
-  { 869.5026118373577 , 589.273315669560091 },
-  { 614.4779718563358 , 363.37575690036275 },
-  { 757.0324564779576 , 92.08878669539868 },
-  { 767.6937816742313 , 379.06155663002967 },
-  { 476.9900506029707 , 687.4098777930658 },
-  { 464.44357895081356 , 592.46932112789253 },
-  { 707.05563553661796 , 689.40807019758722 },
-  { 232.0930481564776 , 320.60836324580623 },
-  { 241.3013182547267 , 233.31850783941482 },
-  { 421.73037193473016 , 184.43811000557972 },
-  { 122.70558488492124 , 332.10544892061546 },
-  { 742.4718718982728 , 271.59139924780112 },
-  { 661.0804675716341 , 464.48253126930382 },
-  { 524.576399464912 , 315.76604794053856 },
-  { 874.7698105286605 , 716.32773163371432 },
-  { 974.1656488388917 , 484.79680658077623 },
-  { 597.4224309690769 , 226.33310131587893 },
-  { 211.7359164407203 , 632.41487779306578 },
-  { 165.1544193775721 , 446.87888973311993 },
-  { 845.4684565369397 , 1.2868817673212902 },
-  { 216.1856272324006 , 511.87334320925083 },
-  { 654.6357399649626 , 31.6426254082983 },
-  { 254.04065222963385 , 128.03912298292136 },
-  { 780.7051469187964 , 567.2596830110294 },
-  { 516.0394147479184 , 154.05857009723633 },
-  { 896.8842111091542 , 316.45022899471473 },
-  { 553.7153394883311 , 680.85653271904448 },
-  { 863.15622697305065 , 396.9444746667672 },
-  { 975.3983096112804 , 274.19641566668804 },
-  { 801.6825608855318 , 183.66826285733362 },
-  { 65.4562148256638 , 492.17152210732365 },
-  { 794.7722412076871 , 676.08137298679057 },
-  { 644.008588655327 , 575.04565149870248 },
-  { 4.72154002917443 , 273.2150194280183 },
-  { 299.34132587888485 , 646.06727846507823 },
-  { 926.913047666801 , 191.24847343537388 },
-  { 349.99831305510526 , 449.279381150503 },
-  { 168.0873659246565 , 164.76584291431298 },
-  { 878.1382410473095 , 514.15337714732436 },
-  { 632.8954042187247 , 296.6664848789528 },
-  { 345.32489776794506 , 263.558294644828 },
-  { 764.6824262950162 , 468.8815784493293 },
-  { 327.13010618205993 , 556.8658357552143 },
-  { 250.73882842811827 , 412.91852758167227 },
-  { 948.336663409985 , 108.87333637203255 },
-  { 866.7545263660356 , 99.76130124251502 },
-  { 710.548673869098 , 191.7735801915598 },
-  { 818.8773460650578 , 270.71158388704936 }
-},
-{ //#5  12 54
-  { 118.2302429118267 , 365.78615307127404 },
-  { 418.2420211682191 , 372.00205087962405 },
-  { 526.2111950756276 , 392.98913228109024 },
-  { 61.3224309841823 , 495.97529886987553 },
-  { 590.6166692424126 , 283.86894764184194 },
-  { 739.3394961755095 , 840.4779369388494 },
-  { 222.64342125216115 , 781.94935745780515 },
-  { 381.63303187121164 , 474.7248778127209 },
-  { 522.9607740184729 , 10.22018352154947 },
-  { 690.4585889925144 , 380.06258203833573 },
-  { 192.77740671475703 , 688.1125158146806 },
-  { 597.9557740184729 , 110.96604935929908 },
-  { 483.54388324798526 , 103.53567241112226 },
-  { 45.2989478067175 , 700.7289700386416 },
-  { 28.7035457198165 , 36.92039271097195 },
-  { 541.1110417896653 , 805.054790247171 },
-  { 601.015889250968 , 497.3001660154882 },
-  { 620.7465806221655 , 669.0995972161468 },
-  { 51.4843770740771 , 596.791153071274 },
-  { 276.46288065218266 , 485.3204687315887 },
-  { 908.35325707677373 , 832.9623802713417 },
-  { 10.62252514250895 , 910.8848104113868 },
-  { 5.4499212618734 , 417.83458570275866 },
-  { 314.30724584799634 , 365.6247487135821 },
-  { 321.8365470014339 , 822.88186624037587 },
-  { 316.0257716238901 , 612.6844501594197 },
-  { 821.5848719438267 , 420.3827844001522 },
-  { 785.0686701117651 , 330.1605841725376 },
-  { 486.9177433711078 , 484.0857613988836 },
-  { 217.8766205073677 , 399.7490138884776 },
-  { 83.8543303430056 , 828.6644344837297 },
-  { 473.0166960309274 , 294.2273760169157 },
-  { 215.45319658386245 , 41.91309422641845 },
-  { 940.6671959305764 , 175.2435968056152 },
-  { 442.2526846372199 , 756.83834781184044 },
-  { 165.47338738088536 , 867.4804013302546 },
-  { 387.015889250968 , 937.3001660154882 },
-  { 653.9440060268217 , 933.5294166786254 },
-  { 288.5508140208349 , 64.78548618592652 },
-  { 512.0113900188115 , 209.77785404465686 },
-  { 362.7246154590792 , 4.60031046594503 },
-  { 857.7309689378721 , 746.05729762341207 },
-  { 698.1312949895214 , 548.9373432063082 },
-  { 713.8223412805312 , 35.13710099507284 },
-  { 358.79869825851364 , 164.67501694265476 },
-  { 518.5100743160519 , 695.13711521191715 },
-  { 805.4954544074621 , 561.7311163965333 },
-  { 208.1416602563993 , 595.6217737832941 },
-  { 925.0586701117651 , 310.1605841725376 },
-  { 621.7860422243679 , 8.34545657025114 },
-  { 725.12089151026515 , 624.25189320712914 },
-  { 403.8049481830853 , 80.7804861859265 },
-  { 322.81103557372046 , 707.74720629299895 },
-  { 660.3900228636733 , 198.63460750860773 },
-  { 728.1307852596644 , 472.9623802713417 },
-  { 751.3723023691828 , 237.91691141336224 },
-  { 603.1437848829386 , 382.5207866302491 },
-  { 930.0636701117651 , 405.414718334788 },
-  { 403.8049481830853 , 580.77048618592653 },
-  { 27.46738716042285 , 321.3005196553675 },
-  { 816.08784566996576 , 31.03302616600917 },
-  { 250.65070439610489 , 231.37623878762844 },
-  { 413.537217185148 , 860.1203440737955 },
-  { 124.001666536748 , 77.09640738340312 },
-  { 501.77412209049385 , 581.7575675873927 },
-  { 843.3201707575065 , 226.5629087791268 },
-  { 900.6507043961049 , 614.3874936931233 },
-  { 856.6592610306329 , 116.24456711575897 },
-  { 933.1513423460166 , 515.5132516861342 },
-  { 170.5832538974919 , 500.60877416002 },
-  { 365.53583114481773 , 269.49041264500846 },
-  { 168.6193922087113 , 285.04880469905515 },
-  { 156.37087299187954 , 174.7272009282716 },
-  { 625.4889470894473 , 841.92863379041876 },
-  { 804.3577458820068 , 673.1008715217365 },
-  { 696.1790951981291 , 757.5172329364469 },
-  { 713.1614616365636 , 112.20656390234069 },
-  { 707.4694075552624 , 655.7085865131542 },
-  { 276.54779697638605 , 131.32727166511603 },
-  { 57.51251583943416 , 222.9436433636022 },
-  { 592.7812851593136 , 591.9461594826422 }
-},
-{ //22 55
-  { 420.5467462478923 , 495.5079505312206 },
-  { 405.9490672806591 , 357.9196866039878 },
-  { 557.2525512189046 , 302.3352298525043 },
-  { 497.4118601547223 , 221.549024774444 },
-  { 493.8199326420899 , 332.36668234605503 },
-  { 94.452234400936 , 383.125555711557 },
-  { 156.0622040057982 , 458.15519505208437 },
-  { 462.3271361664732 , 578.0957622223657 },
-  { 884.245645280762 , 298.318956935119 },
-  { 47.682302240260995 , 249.9593408375967 },
-  { 135.3033592108081 , 659.2467470862024 },
-  { 344.1787861110988 , 168.60873076564883 },
-  { 746.89007624515403 , 264.78739538168617 },
-  { 153.70316855343486 , 195.939011273588 },
-  { 799.2340410657407 , 429.44591429464919 },
-  { 277.6856891321601 , 736.07785825334297 },
-  { 419.3721873346608 , 45.81531988582283 },
-  { 442.51694644096966 , 133.17088892143076 },
-  { 302.10717776924565 , 631.9511094460574 },
-  { 655.83809740579892 , 245.6005200641416 },
-  { 947.21007157449617 , 428.40813876128213 },
-  { 136.51293492694958 , 719.2937099451414 },
-  { 525.1743459418857 , 27.57664607913459 },
-  { 149.9767332991862 , 329.73915595752885 },
-  { 226.18194882115517 , 84.33147691930965 },
-  { 149.84131482235495 , 92.30841686476157 },
-  { 599.28673341646852 , 205.38001600794112 },
-  { 13.029229730048314 , 327.5773732010966 },
-  { 18.783268790941037 , 6.7882879106416 },
-  { 214.79774878410143 , 656.14092674072486 },
-  { 557.9724349105504 , 104.38460256402628 },
-  { 238.40353608274134 , 409.3590068081694 },
-  { 323.64373572371622 , 109.67407911291299 },
-  { 798.34995132159574 , 667.77126963607145 },
-  { 415.198966457759056 , 774.79504659173654 },
-  { 6.44965826819697 , 440.39969371208474 },
-  { 12.232351553299385 , 162.64185913096034 },
-  { 47.35943000090515 , 506.5527882116738 },
-  { 315.4848121736086 , 551.3703717871138 },
-  { 894.84131482235495 , 211.29841686476158 },
-  { 104.6362760192985 , 563.7012492846466 },
-  { 781.74539512336497 , 342.844784209719435 },
-  { 725.87498696901116 , 49.15713264093435 },
-  { 108.14663512251822 , 288.5856687647695 },
-  { 340.25551616871167 , 16.35904367226955 },
-  { 732.55795840820142 , 587.2162976815197 },
-  { 38.663371910792506 , 611.8551821816656 },
-  { 867.00348245432218 , 21.60153998484408 },
-  { 831.05927989374612 , 556.41440369761239 },
-  { 85.3216323749252 , 105.43546866896601 },
-  { 552.70209456234699 , 460.59645746150414 },
-  { 868.09477280919248 , 457.579925056676615 },
-  { 737.2071533724013 , 495.85404367226954 },
-  { 984.800488374474 , 163.75402717137257 },
-  { 886.78622157124587 , 110.38917390310846 },
-  { 329.7724046497249 , 268.09309505297358 },
-  { 604.6243837632034 , 371.05600853372243 },
-  { 806.029174467468465 , 161.61461643627726 },
-  { 637.5922857611909 , 15.957799780471106 },
-  { 637.0653757528705 , 586.92116496395136 },
-  { 648.2598688818763 , 513.0335949390552 },
-  { 239.6442077730626 , 289.362880724342 },
-  { 416.3837374013813 , 263.6256866164163 },
-  { 222.9908559239197 , 505.17574813368566 },
-  { 340.2242242640137 , 434.9805887757982 },
-  { 155.3938755623052 , 2.2031773629658886 },
-  { 474.57954198074464 , 693.03425092420272 },
-  { 896.53507426012025 , 357.4145450114568 },
-  { 305.7121829655358 , 830.2491711148605 },
-  { 815.51492673852323 , 237.0477916026654 },
-  { 2.77351787670598 , 64.92144605169179 },
-  { 477.01118548792834 , 430.1548818205117 },
-  { 401.07905501590466 , 629.8744476040849 },
-  { 537.934523645956 , 518.1267590671707 },
-  { 668.6768796396027 , 338.0394787683423 },
-  { 583.30801259957377 , 668.52082642870185 },
-  { 627.16868305243 , 108.86102661268194 },
-  { 845.55019474731752 , 622.72858191943673 },
-  { 209.4717332991862 , 226.6907931612185 },
-  { 699.6554758168179 , 418.0449543306862 },
-  { 726.72404185341452 , 688.59809505297358 }
-},
-{ //#11 56
-  { 418.7034810823221 , 638.8777102166221 },
-  { 20.375412706764486 , 465.96489746210136 },
-  { 527.09823963986133 , 12.5738867591089 },
-  { 82.36127626795408 , 613.0547516452185 },
-  { 189.08410320105094 , 639.663740942226 },
-  { 232.827413576117 , 42.8912395254206 },
-  { 428.22070734881308 , 50.9024603141201 },
-  { 848.84291947759074 , 592.207079095636 },
-  { 923.54711887328313 , 674.560379097966 },
-  { 8.84291947759075 , 652.197079095636 },
-  { 730.45503100010342 , 284.9550911947186 },
-  { 104.82687490239454 , 36.9635317528035 },
-  { 466.82429194018627 , 837.9513898009586 },
-  { 268.63665488485964 , 438.8936513952517 },
-  { 926.10458664302016 , 312.2822502284132 },
-  { 220.8687708552885 , 365.3836363516075 },
-  { 330.5777187032847 , 14.1963944927732 },
-  { 101.02050929888833 , 686.8054515029053 },
-  { 725.00432383528268 , 702.1300761594664 },
-  { 747.09166804448625 , 148.31307632100464 },
-  { 808.18366626263656 , 231.3447361884132 },
-  { 234.64787567355918 , 543.5003576225556 },
-  { 615.1204374937192 , 478.5784448914128 },
-  { 41.362494108230564 , 177.9957235546929 },
-  { 523.82106657295816 , 285.96489746210136 },
-  { 918.92101590545704 , 85.2542347605182 },
-  { 905.2990720011899 , 219.7075589975931 },
-  { 332.6496832690377 , 493.56594255620286 },
-  { 773.0156776722591 , 786.3808617867965 },
-  { 439.37251020213455 , 520.1749318532103 },
-  { 628.68218200524632 , 707.9535109227974 },
-  { 572.29189883027448 , 155.91958439652785 },
-  { 529.4710435534807 , 583.2626040874618 },
-  { 634.3326691697203 , 789.9841402314152 },
-  { 628.395334538275225 , 585.4072492263696 },
-  { 828.7602784331126 , 491.0106665876796 },
-  { 120.5083412656051 , 322.0612272440825 },
-  { 6.919444478883442 , 740.1967655692758 },
-  { 505.7158868616815 , 432.12363348814006 },
-  { 414.7721094994205 , 186.54159925914087 },
-  { 440.58118887586014 , 749.0512042137824 },
-  { 4.37829711502256 , 557.5206046236677 },
-  { 936.29407200118993 , 774.9616931598434 },
-  { 139.6285259048533 , 245.65575307729733 },
-  { 537.8266986888912 , 766.8475789952852 },
-  { 832.9345821448395 , 686.0574647727752 },
-  { 129.2691883947744 , 526.460718647466 },
-  { 181.68825331360563 , 729.0339815953105 },
-  { 272.87409591893464 , 790.539609048058 },
-  { 947.406874548325135 , 454.7968589298642 },
-  { 94.33900724232554 , 777.5187109846087 },
-  { 937.14776378375484 , 553.6815031331705 },
-  { 823.76745791359164 , 54.5124979092668 },
-  { 493.13604848458084 , 185.1142116961759 },
-  { 349.0208338486339 , 123.1485362803664 },
-  { 585.64213633100735 , 362.4956605278415 },
-  { 238.62576921198655 , 211.990953326524 },
-  { 641.09958664302016 , 121.0281160661628 },
-  { 402.2914009194472 , 863.3208113586945 },
-  { 25.851910808627423 , 269.59736993657367 },
-  { 851.20441023438792 , 388.58093197131484 },
-  { 518.4255509704002 , 656.5502247637384 },
-  { 723.98180404530258 , 480.20846563494 },
-  { 376.10486057551226 , 285.16668698042093 },
-  { 735.787507809200534 , 590.8958609166766 },
-  { 115.37129760619692 , 116.3559622667198 },
-  { 136.04271513038435 , 432.0030857396392 },
-  { 239.99807964634772 , 851.7357153242097 },
-  { 690.59079334231 , 383.4856387018432 },
-  { 288.134139402524 , 291.9511864311408 },
-  { 396.47688410418175 , 404.3373637984763 },
-  { 223.6571174792071 , 123.07915217047452 },
-  { 275.96808471783095 , 672.3849437359536 },
-  { 720.95184199804848 , 46.2671533590521 },
-  { 340.3046027285942 , 582.7837808926755 },
-  { 620.6067213757875 , 253.1939325363402 },
-  { 362.57256452664082 , 711.8525789952852 },
-  { 25.737288869704535 , 370.25028475952433 },
-  { 133.471810878275 , 877.8923387477558 },
-  { 16.50570462369836 , 849.7682204123869 },
-  { 316.39031331007513 , 890.2244025442191 }
-},
-{ //#28 57
-  { 519.869810117883 , 23.53810137027736 },
-  { 442.3062517993089 , 82.39259043522723 },
-  { 458.85320352458 , 322.734488186574 },
-  { 977.7022186607433 , 129.7582651422391 },
-  { 260.17718301332786 , 391.14412814710204 },
-  { 565.8007070937178 , 424.89627094300636 },
-  { 878.5153433431987 , 403.58196999132014 },
-  { 361.3823017746329 , 254.4846280251631 },
-  { 287.0979212410855 , 172.49029091461875 },
-  { 470.29981628163506 , 238.63731913779367 },
-  { 177.5197835124118 , 476.73837098939816 },
-  { 183.29410268264797 , 175.19465327447384 },
-  { 497.34227168364544 , 397.3545145579722 },
-  { 326.3535605867664 , 650.529473560458 },
-  { 145.7966538136273 , 628.3460391784373 },
-  { 478.72813468850836 , 514.8795502053877 },
-  { 275.707881550199 , 728.4738846086918 },
-  { 38.84915024448941 , 306.18425642200503 },
-  { 677.56882299103256 , 84.24043075320773 },
-  { 371.74541118252375 , 500.7481848652805 },
-  { 418.99688853528033 , 427.60063330286147 },
-  { 858.82436377165226 , 517.6824917310862 },
-  { 827.8453903673138 , 432.16393243883874 },
-  { 207.08103434717464 , 256.351702067893 },
-  { 433.56463991663645 , 634.8201992165228 },
-  { 316.03960426922106 , 533.4343362116599 },
-  { 595.1179176998239 , 539.6189622957928 },
-  { 432.0819227206523 , 551.44789130275 },
-  { 718.65538511933687 , 276.3121018522595 },
-  { 308.398244051899 , 271.19043725503525 },
-  { 688.8833172714877 , 612.8765212447929 },
-  { 106.80880500604664 , 84.04302498774666 },
-  { 686.3206825948089 , 204.61698957378496 },
-  { 757.24472303052596 , 149.42269395087936 },
-  { 655.6036000444254 , 336.8318070834259 },
-  { 999.97144126834388 , 370.8102881056758 },
-  { 38.31652314898844 , 478.19033235374997 },
-  { 626.8173136870209 , 181.37631861384506 },
-  { 473.19632672194814 , 713.7876511708418 },
-  { 603.22936786028686 , 670.77648362158675 },
-  { 389.14818799490786 , 335.122616814395 },
-  { 504.51632656017046 , 136.40221350964003 },
-  { 754.7789589680781 , 510.92708090109716 },
-  { 115.26402671812633 , 530.3521151101822 },
-  { 835.6893982197237 , 142.6296689429879 },
-  { 245.82038904603172 , 618.85895737845567 },
-  { 777.77387939070604 , 367.9901972641823 },
-  { 990.95318518741675 , 215.2438096614493 },
-  { 597.56882299103256 , 84.24043075320773 },
-  { 934.536003786783 , 446.5281973029141 },
-  { 10.77060421511914 , 373.2706383539141 },
-  { 835.09326013814723 , 228.2888843426203 },
-  { 370.75162605158727 , 39.8918214385735 },
-  { 893.5495275481126 , 290.84075063523693 },
-  { 938.50864839428067 , 34.43962627613195 },
-  { 702.73185800127067 , 428.1482955373769 },
-  { 574.0652158532989 , 321.8948780867937 },
-  { 401.26952211447394 , 178.78706620484405 },
-  { 953.483290533285 , 323.31852368314765 },
-  { 565.8007070937178 , 218.7673432238454 },
-  { 28.3263341817707 , 582.34859033382517 },
-  { 155.59006469345331 , 293.5394404019993 },
-  { 918.9865991942907 , 600.75260225278345 },
-  { 928.75772762574832 , 185.35479963609498 },
-  { 138.78042881355475 , 364.23111567883547 },
-  { 210.9012827737609 , 548.2672954885178 },
-  { 530.94009426466636 , 631.2202651035073 },
-  { 801.5834636119042 , 604.5761984339795 },
-  { 90.3828356539653 , 255.52834167394238 },
-  { 736.0716513709727 , 15.65014938422726 },
-  { 238.8283279774722 , 98.3483171723389 },
-  { 791.3093918221687 , 293.52963435034474 },
-  { 95.95203062763136 , 427.154536334445 },
-  { 869.71447303821435 , 90.13020272434824 },
-  { 635.7412742639992 , 471.1612031036814 },
-  { 194.01771485219842 , 38.39234828637055 },
-  { 331.16489103572087 , 414.1608405860997 },
-  { 232.51771027739647 , 480.6992041700839 },
-  { 51.286992088707436 , 187.8460960921342 },
-  { 7.59132867775487 , 126.79706011488442 },
-  { 272.12625684697 , 9.47126509479716 }
-},
-{ //#8 58
-  { 420.151856218163502 , 416.86626840974685 },
-  { 5.80235611781261 , 5.88248919844636 },
-  { 110.065392745905356 , 5.36335408455602 },
-  { 216.54917535476488 , 5.0481475807171 },
-  { 324.34522415013066 , 5.71431622519913 },
-  { 434.33522415013067 , 5.71431622519913 },
-  { 547.04773188612978 , 19.97764173714355 },
-  { 652.69804695931057 , 22.82972196375252 },
-  { 762.69804695931055 , 26.59891048664575 },
-  { 874.6720989732093 , 24.35213329585648 },
-  { 4.757743371307814 , 107.4437692036707 },
-  { 114.62958517072808 , 107.0213955709686 },
-  { 218.13580256186856 , 107.03852635609374 },
-  { 328.71891179138093 , 107.35401524566653 },
-  { 447.7220627066835 , 106.6099811992048 },
-  { 537.77166203479499 , 102.67113804966925 },
-  { 640.4285308003707 , 104.19139582351204 },
-  { 751.96102402954446 , 107.94921418997743 },
-  { 864.911998163944787 , 107.1635533192705 },
-  { 7.4108090837779 , 215.71250862972056 },
-  { 104.623154262052594 , 216.04180167808283 },
-  { 212.77153002522118 , 215.89540779698022 },
-  { 325.36673663994253 , 210.8780786755577807 },
-  { 431.67485963160462 , 217.1679126460473 },
-  { 548.0890148011067 , 218.40031198592493 },
-  { 652.21208836504005 , 225.33303867106667 },
-  { 792.74477801547266 , 216.97581761294331 },
-  { 860.942625460523 , 213.413504516951 },
-  { 10.15816465177235 , 326.77097451381394 },
-  { 121.33471742142797 , 325.874248823865 },
-  { 214.65147739554673 , 319.07661221645435 },
-  { 328.26878952418684 , 314.7823488836608 },
-  { 441.10693687091214 , 316.357008181921728 },
-  { 541.91282139794086 , 320.60756932937363 },
-  { 652.40261767063703 , 292.96221381325165 },
-  { 763.8342434107688 , 307.1202603090924 },
-  { 870.6646953486011 , 315.08601906406733 },
-  { 26.6956350894794 , 415.02048065500975 },
-  { 126.8182315985588 , 410.00438465343085 },
-  { 230.51700699747826 , 428.3953177163358 },
-  { 532.18726034767681 , 418.530356116824876 },
-  { 648.78623124038836 , 423.57531713055437 },
-  { 749.94457939329223 , 410.9817704719229 },
-  { 880.3020142074183 , 423.319591157269741 },
-  { 19.49064385322225 , 511.9708176129433 },
-  { 122.128468065852 , 508.9191319696984 },
-  { 239.7985429697513 , 502.46483179802127 },
-  { 346.86382231475176 , 510.26554194711414 },
-  { 447.02652175179745 , 510.049358807324083 },
-  { 558.544817560939 , 519.16597888552846 },
-  { 673.77035531639018 , 528.9471108839399 },
-  { 784.60651403956203 , 516.35032570037788 },
-  { 882.95184245349428 , 514.88056255363998 },
-  { 28.29654003421298 , 618.79495818325512 },
-  { 139.23766232650446 , 615.60375245739468 },
-  { 243.9415054448463 , 629.800199191057 },
-  { 352.97597707123248 , 618.92639593952946 },
-  { 469.27204085741174 , 624.27174257653195 },
-  { 578.86002406477787 , 624.68219627666895 },
-  { 683.14938154480163 , 620.2086887724517 },
-  { 796.1583269951787 , 620.1400701418057 },
-  { 859.86414757228033 , 623.5212891261059 },
-  { 30.5797070929075 , 710.41328841436444 },
-  { 162.47150492082983 , 716.2150299674624 },
-  { 265.21364767263123 , 712.5050683374064 },
-  { 352.45417725890945 , 716.6245817332359 },
-  { 461.82244082127474 , 714.3342457491726 },
-  { 572.44441977003714 , 718.41273591950062 },
-  { 673.39664080145408 , 717.27910749257128 },
-  { 773.8669674201106 , 715.32145657628763 },
-  { 871.56615822820464 , 715.202288806452394 },
-  { 982.07791717921546 , 10.16682215155424 },
-  { 984.89922986911625 , 110.1202603090924 },
-  { 973.89504556838529 , 219.23734968879876 },
-  { 973.78754897318188 , 314.8374354625943 },
-  { 986.1017160561035 , 414.9995417856615 },
-  { 978.93513560130205 , 514.83299818196616 },
-  { 988.71500269023085 , 611.94557539951029 },
-  { 675.46407044392208 , 816.81617598983507 },
-  { 986.15832699517865 , 714.1870364967352 },
-  { 341.0170517131233 , 415.69847354823142 }
-},
-{ //#59
-  { 519.869810117883 , 23.53810137027736 },
-  { 442.3062517993089 , 82.39259043522723 },
-  { 458.85320352458 , 322.734488186574 },
-  { 977.7022186607433 , 129.7582651422391 },
-  { 260.17718301332786 , 391.14412814710204 },
-  { 565.8007070937178 , 424.89627094300636 },
-  { 878.5153433431987 , 403.58196999132014 },
-  { 361.3823017746329 , 254.4846280251631 },
-  { 287.0979212410855 , 172.49029091461875 },
-  { 470.29981628163506 , 238.63731913779367 },
-  { 177.5197835124118 , 476.73837098939816 },
-  { 183.29410268264797 , 175.19465327447384 },
-  { 497.34227168364544 , 397.3545145579722 },
-  { 326.3535605867664 , 650.529473560458 },
-  { 145.7966538136273 , 628.3460391784373 },
-  { 498.72813468850836 , 514.8795502053877 },
-  { 275.707881550199 , 728.4738846086918 },
-  { 38.84915024448941 , 306.18425642200503 },
-  { 677.56882299103256 , 84.24043075320773 },
-  { 371.74541118252375 , 500.7481848652805 },
-  { 418.99688853528033 , 427.60063330286147 },
-  { 858.82436377165226 , 537.6824917310862 },
-  { 827.8453903673138 , 432.16393243883874 },
-  { 207.08103434717464 , 256.351702067893 },
-  { 433.56463991663645 , 634.8201992165228 },
-  { 316.03960426922106 , 533.4343362116599 },
-  { 595.1179176998239 , 539.6189622957928 },
-  { 432.0819227206523 , 551.44789130275 },
-  { 718.65538511933687 , 276.3121018522595 },
-  { 288.398244051899 , 295.19043725503525 },
-  { 688.8833172714877 , 612.8765212447929 },
-  { 106.80880500604664 , 84.04302498774666 },
-  { 686.3206825948089 , 204.61698957378496 },
-  { 757.24472303052596 , 149.42269395087936 },
-  { 655.6036000444254 , 336.8318070834259 },
-  { 979.97144126834388 , 550.8102881056758 },
-  { 38.31652314898844 , 478.19033235374997 },
-  { 626.8173136870209 , 181.37631861384506 },
-  { 473.19632672194814 , 713.7876511708418 },
-  { 603.22936786028686 , 670.77648362158675 },
-  { 389.14818799490786 , 335.122616814395 },
-  { 504.51632656017046 , 136.40221350964003 },
-  { 754.7789589680781 , 520.92708090109716 },
-  { 85.26402671812633 , 560.3521151101822 },
-  { 835.6893982197237 , 142.6296689429879 },
-  { 245.82038904603172 , 618.85895737845567 },
-  { 777.77387939070604 , 367.9901972641823 },
-  { 990.95318518741675 , 215.2438096614493 },
-  { 597.56882299103256 , 84.24043075320773 },
-  { 934.536003786783 , 446.5281973029141 },
-  { 10.77060421511914 , 373.2706383539141 },
-  { 835.09326013814723 , 228.2888843426203 },
-  { 370.75162605158727 , 39.8918214385735 },
-  { 893.5495275481126 , 290.84075063523693 },
-  { 938.50864839428067 , 34.43962627613195 },
-  { 702.73185800127067 , 438.1482955373769 },
-  { 574.0652158532989 , 331.8948780867937 },
-  { 401.26952211447394 , 178.78706620484405 },
-  { 953.483290533285 , 323.31852368314765 },
-  { 565.8007070937178 , 218.7673432238454 },
-  { 328.3263341817707 , 112.34859033382517 },
-  { 155.59006469345331 , 293.5394404019993 },
-  { 918.9865991942907 , 621.75260225278345 },
-  { 48.75772762574832 , 665.35479963609498 },
-  { 138.78042881355475 , 364.23111567883547 },
-  { 210.9012827737609 , 548.2672954885178 },
-  { 530.94009426466636 , 631.2202651035073 },
-  { 807.5834636119042 , 604.5761984339795 },
-  { 90.3828356539653 , 255.52834167394238 },
-  { 736.0716513709727 , 15.65014938422726 },
-  { 238.8283279774722 , 98.3483171723389 },
-  { 791.3093918221687 , 293.52963435034474 },
-  { 95.95203062763136 , 427.154536334445 },
-  { 869.71447303821435 , 90.13020272434824 },
-  { 635.7412742639992 , 471.1612031036814 },
-  { 194.01771485219842 , 38.39234828637055 },
-  { 331.16489103572087 , 414.1608405860997 },
-  { 232.51771027739647 , 480.6992041700839 },
-  { 51.286992088707436 , 187.8460960921342 },
-  { 7.59132867775487 , 126.79706011488442 },
-  { 272.12625684697 , 9.47126509479716 }
-},
-{ //#5  12 60
-  { 200.45319658386245 , 21.91309422641845 },
-  { 621.7860422243679 , 8.34545657025114 },
-  { 418.2420211682191 , 372.00205087962405 },
-  { 516.2111950756276 , 392.98913228109024 },
-  { 61.3224309841823 , 495.97529886987553 },
-  { 590.6166692424126 , 283.86894764184194 },
-  { 739.3394961755095 , 840.4779369388494 },
-  { 222.64342125216115 , 781.94935745780515 },
-  { 381.63303187121164 , 474.7248778127209 },
-  { 522.9607740184729 , 10.22018352154947 },
-  { 690.4585889925144 , 380.06258203833573 },
-  { 192.77740671475703 , 688.1125158146806 },
-  { 597.9557740184729 , 110.96604935929908 },
-  { 483.54388324798526 , 103.53567241112226 },
-  { 45.2989478067175 , 700.7289700386416 },
-  { 28.7035457198165 , 36.92039271097195 },
-  { 541.1110417896653 , 805.054790247171 },
-  { 601.015889250968 , 497.3001660154882 },
-  { 124.2302429118267 , 351.78615307127404 },
-  { 620.7465806221655 , 669.0995972161468 },
-  { 51.4843770740771 , 596.791153071274 },
-  { 276.46288065218266 , 475.3204687315887 },
-  { 908.35325707677373 , 832.9623802713417 },
-  { 10.62252514250895 , 910.8848104113868 },
-  { 5.4499212618734 , 417.83458570275866 },
-  { 314.30724584799634 , 355.6247487135821 },
-  { 321.8365470014339 , 822.88186624037587 },
-  { 300.0257716238901 , 612.6844501594197 },
-  { 821.5848719438267 , 420.3827844001522 },
-  { 785.0686701117651 , 330.1605841725376 },
-  { 486.9177433711078 , 484.0857613988836 },
-  { 217.8766205073677 , 399.7490138884776 },
-  { 83.8543303430056 , 828.6644344837297 },
-  { 473.0166960309274 , 294.2273760169157 },
-  { 940.6671959305764 , 175.2435968056152 },
-  { 442.2526846372199 , 756.83834781184044 },
-  { 165.47338738088536 , 867.4804013302546 },
-  { 387.015889250968 , 937.3001660154882 },
-  { 653.9440060268217 , 933.5294166786254 },
-  { 288.5508140208349 , 64.78548618592652 },
-  { 512.0113900188115 , 199.77785404465686 },
-  { 362.7246154590792 , 4.60031046594503 },
-  { 857.7309689378721 , 746.05729762341207 },
-  { 698.1312949895214 , 548.9373432063082 },
-  { 713.8223412805312 , 35.13710099507284 },
-  { 358.79869825851364 , 164.67501694265476 },
-  { 518.5100743160519 , 695.13711521191715 },
-  { 805.4954544074621 , 561.7311163965333 },
-  { 208.1416602563993 , 595.6217737832941 },
-  { 685.0586701117651 , 310.1605841725376 },
-  { 915.12089151026515 , 24.25189320712914 },
-  { 403.8049481830853 , 80.7804861859265 },
-  { 322.81103557372046 , 707.74720629299895 },
-  { 660.3900228636733 , 198.63460750860773 },
-  { 728.1307852596644 , 472.9623802713417 },
-  { 751.3723023691828 , 237.91691141336224 },
-  { 603.1437848829386 , 382.5207866302491 },
-  { 890.0636701117651 , 495.414718334788 },
-  { 403.8049481830853 , 580.77048618592653 },
-  { 27.46738716042285 , 321.3005196553675 },
-  { 816.08784566996576 , 31.03302616600917 },
-  { 250.65070439610489 , 231.37623878762844 },
-  { 413.537217185148 , 860.1203440737955 },
-  { 124.001666536748 , 77.09640738340312 },
-  { 501.77412209049385 , 581.7575675873927 },
-  { 843.3201707575065 , 226.5629087791268 },
-  { 879.6507043961049 , 614.3874936931233 },
-  { 856.6592610306329 , 116.24456711575897 },
-  { 593.1513423460166 , 215.5132516861342 },
-  { 165.5832538974919 , 500.60877416002 },
-  { 365.53583114481773 , 269.49041264500846 },
-  { 158.6193922087113 , 275.04880469905515 },
-  { 156.37087299187954 , 174.7272009282716 },
-  { 625.4889470894473 , 841.92863379041876 },
-  { 804.3577458820068 , 673.1008715217365 },
-  { 696.1790951981291 , 757.5172329364469 },
-  { 713.1614616365636 , 112.20656390234069 },
-  { 707.4694075552624 , 655.7085865131542 },
-  { 276.54779697638605 , 131.32727166511603 },
-  { 57.51251583943416 , 222.9436433636022 },
-  { 592.7812851593136 , 591.9461594826422 }
-},
-{ //#14 61
-  { 333.952460695622 , 555.928789709654566 },
-  { 538.29548882340663 , 519.377113704237146 },
-  { 845.002771095909 , 610.48789282082731 },
-  { 184.96148342904075 , 500.66156375764125 },
-  { 369.5913908119913 , 388.42689465671896 },
-  { 368.01739115656517 , 301.16332878790956 },
-  { 661.5306211249965 , 267.1222334730473 },
-  { 471.0890274839039 , 192.1092338497731 },
-  { 861.91887626487494 , 278.7048247686409 },
-  { 416.07602786062967 , 611.66764020868057 },
-  { 449.6835533171188 , 522.98904921052488 },
-  { 978.6905537236624 , 745.13274020175 },
-  { 300.4037219128935 , 664.63808706988175 },
-  { 156.7145812333708 , 319.2801972755011 },
-  { 762.5238225421135 , 443.27778540566993 },
-  { 518.0569800244306 , 620.46466099886436 },
-  { 784.3662005508071 , 115.50024455276565 },
-  { 269.1120663885567 , 299.50524455276565 },
-  { 231.18477210132193 , 574.1598027692295 },
-  { 863.5352643250827 , 1.2457111872926987 },
-  { 478.76154203102027 , 302.38716396169502 },
-  { 753.8299869719242 , 350.91737446632123 },
-  { 32.7097417819675 , 682.24374390702422 },
-  { 429.43256871506435 , 715.63475461001676 },
-  { 300.3098869678675 , 465.4276517017377 },
-  { 230.43342700953747 , 403.6108547650932 },
-  { 575.934121896501 , 213.2934776740944 },
-  { 435.8730486508135 , 9.68668804487963 },
-  { 989.8537120805378 , 410.26672566434587 },
-  { 14.10435698220726 , 468.85215339463186 },
-  { 878.389266041954 , 209.37148154104077 },
-  { 743.60313819800416 , 638.29669858512247 },
-  { 834.6867028773147 , 510.37073449551447 },
-  { 644.9104020910389 , 366.2250238409189 },
-  { 3.95330995480606 , 589.40448137936865 },
-  { 230.22963376252517 , 20.319800412647137 },
-  { 539.35957002516557 , 18.457436057466893 },
-  { 404.2153692347149 , 101.05790130169515 },
-  { 959.2429844405491 , 325.39451889704313 },
-  { 23.13828693885642 , 200.8300040518392 },
-  { 449.2103692347149 , 416.31203546394556 },
-  { 91.46932163332576 , 535.65641941998103 },
-  { 629.4399722253527 , 469.83818050745697 },
-  { 969.332818015417 , 20.377026241503707 },
-  { 60.4762258064975 , 293.29901774299067 },
-  { 265.9350970535745 , 223.35532466829002 },
-  { 246.82754688596197 , 127.13797326764205 },
-  { 703.43281922087175 , 729.28643577307088 },
-  { 151.27014663845495 , 64.31161015627188 },
-  { 644.9104020910389 , 366.2250238409189 },
-  { 550.3197875861044 , 313.43270634067187 },
-  { 856.9516135798074 , 703.73381760174576 },
-  { 373.7605132731356 , 200.25688263427205 },
-  { 320.9050269777232 , 99.9209940454279 },
-  { 513.3855204537439 , 114.46231038282733 },
-  { 314.4573529347144 , 638.57998808607866 },
-  { 758.1964054924027 , 19.64597307072556 },
-  { 764.2924902492796 , 288.42390837061873 },
-  { 735.8249834784533 , 182.18172673708412 },
-  { 131.22722189269405 , 605.1290417213898 },
-  { 328.3001778398753 , 12.522625578409375 },
-  { 654.0751844826988 , 127.54798966723172 },
-  { 650.2110541941881 , 597.44513277555484 },
-  { 997.7115032668604 , 647.18891264915479 },
-  { 648.4889243378839 , 797.976534824120634 },
-  { 995.7213961683688 , 112.145492941412 },
-  { 537.2862314133329 , 413.27778540567 },
-  { 603.643997716999 , 660.632127928934 },
-  { 980.70425513038435 , 219.961354568218795 },
-  { 116.72139616836884 , 409.51451516226643 },
-  { 7.7330336595459 , 389.6433370920496 },
-  { 839.9326660142268 , 386.49251944279051 },
-  { 671.7878562576621 , 14.305822964503506 },
-  { 927.1876980619867 , 450.1901131714185 },
-  { 888.12389050866818 , 102.9890492105249 },
-  { 936.85429889571049 , 129.05756345167885 },
-  { 178.78481052289857 , 235.0733101904686 },
-  { 31.670338787336206 , 96.89959964922508 },
-  { 998.0801844826988 , 522.80212382948213 },
-  { 726.8411753084252 , 519.0069593419256 },
-  { 924.0270179137542 , 577.5013318891781 }
-},
-{ //#1 62
-  { 360.7102663795518 , 283.43275053236465 },
-  { 557.39423223961847 , 502.38438642140437 },
-  { 724.07586283634225 , 559.8861216199174 },
-  { 269.2344226765896 , 239.67837775611548 },
-  { 15.27204858640056 , 29.3421224748663 },
-  { 122.05309877482898 , 17.86383817421404 },
-  { 239.35972082065211 , 24.2435891235201 },
-  { 737.95304383258781 , 65.2425594132806 },
-  { 499.62301072704369 , 88.6219538790916 },
-  { 553.1370039409621 , 243.08459561082685 },
-  { 632.346200630798393 , 3.3361340060814 },
-  { 823.6822177688435 , 224.9252066469688 },
-  { 846.79397415277168 , 363.8795874118099 },
-  { 957.28826937510009 , 229.6916225752172 },
-  { 846.03099412695951 , 656.81991661494095 },
-  { 899.41678391726867 , 279.98611329703243 },
-  { 747.06728381691778 , 161.00233408573195 },
-  { 651.1388115364407 , 293.0190106771796 },
-  { 553.3094654504524 , 162.5348273149057 },
-  { 165.60727412891282 , 205.59205951363143 },
-  { 736.34834689327127 , 271.0907426786853 },
-  { 650.91167880367044 , 165.3099207481185 },
-  { 823.47275798370282 , 111.88214944648364 },
-  { 673.29689178633896 , 359.2126450736734 },
-  { 283.62681821676415 , 556.80565337865002 },
-  { 129.6630592893931 , 401.0649494079631 },
-  { 215.910212545695 , 133.47895616785337 },
-  { 160.29962475431523 , 569.51164439451674 },
-  { 235.16896212939474 , 320.24600099335125 },
-  { 34.88604735513644 , 738.14108899298196 },
-  { 251.53093752467896 , 464.36045229791955 },
-  { 466.30118797363392 , 507.66079648262576 },
-  { 621.673059289393095 , 641.0649494079631 },
-  { 476.74891697646744 , 688.80850194896203 },
-  { 841.17324917378775 , 14.9980912817437 },
-  { 100.55179251923708 , 742.34709418263617 },
-  { 36.8792860991681 , 459.7007899900223 },
-  { 715.32957022769804 , 649.02142254701076 },
-  { 499.3559921530198 , 6.488300612338218 },
-  { 117.87297646010083 , 640.92761851679995 },
-  { 447.84543256808047 , 580.47820595024166 },
-  { 986.85955908641893 , 325.8777798163313 },
-  { 10.14908398322919 , 588.6219538790916 },
-  { 319.8405857067618 , 159.50662575161286 },
-  { 530.1900439499203 , 395.1279940272102 },
-  { 937.57243458835046 , 125.3466577647836 },
-  { 397.16696042156536 , 3.22647312553539 },
-  { 93.85381798065046 , 505.062537538132 },
-  { 529.86972397981137 , 636.0806218291249 },
-  { 76.21981085735644 , 209.09497383882226 },
-  { 142.0722838169178 , 296.25646824798235 },
-  { 445.16092145765326 , 430.06131517975405 },
-  { 805.550549336250825 , 565.9528024838722 },
-  { 401.270459069035 , 384.8203446526126 },
-  { 338.8535031911118 , 460.731121728774 },
-  { 306.03302360985543 , 636.5269834524509 },
-  { 32.23103164605595 , 114.48826761151832 },
-  { 704.3133494389985 , 464.37092264736161 },
-  { 379.5537123805343 , 524.9883500274303 },
-  { 469.32068623915194 , 307.14153354220963 },
-  { 180.1849848557642 , 470.6024143449067 },
-  { 14.55786845941077 , 387.6189325711116 },
-  { 626.81450191011468 , 560.80669435348346 },
-  { 53.56560116385515 , 637.12724380959855 },
-  { 445.2449491354668 , 235.06872765286164 },
-  { 897.62259414530024 , 593.33421718101852 },
-  { 769.94602228668208 , 382.82924203294385 },
-  { 637.06728381691778 , 84.06732054407948 },
-  { 218.69494636316438 , 620.49352616228522 },
-  { 922.68082918992494 , 422.8684357547588 },
-  { 558.95823626955595 , 324.8718909178568 },
-  { 398.5670989831707 , 649.7057907406337 },
-  { 213.81745733023646 , 692.633258580576 },
-  { 938.31158758492383 , 41.41923108192708 },
-  { 121.04187798612944 , 104.25713194691009 },
-  { 330.5500363998687 , 67.38870454993256 },
-  { 910.99670053044751 , 519.3199132173819 },
-  { 624.1230217559796 , 433.3160678159769 },
-  { 831.32769789390977 , 471.982904952696785 },
-  { 315.96412537180066 , 377.28399649294204 },
-  { 427.0115491324898 , 134.7642592843311 }
-},
-{ //#24 63
-  { 330.69046525366275 , 182.46498039115374 },
-  { 706.7370125016047 , 308.72738064106943 },
-  { 169.7895089324668 , 65.56559788463716 },
-  { 115.6508730390796 , 540.70423377802445 },
-  { 415.85746215925354 , 25.89763500158637 },
-  { 643.6819192504956 , 409.6366236027226 },
-  { 965.1447121245589 , 470.0072854322665 },
-  { 934.3946692851904 , 165.5269731720425 },
-  { 298.90995859011565 , 598.05941775801864 },
-  { 916.71790934100375 , 629.62713628290703 },
-  { 418.1037723458667 , 697.1521719303224 },
-  { 891.2815240320239 , 29.941094283665 },
-  { 639.4566033594741 , 321.38939442793566 },
-  { 753.2473062715158 , 624.1787035728941 },
-  { 296.93994765225136 , 280.05032611421694 },
-  { 218.87548379267085 , 690.24743316350936 },
-  { 497.51612446036006 , 353.1986532326651 },
-  { 873.0470678814669 , 550.330997456301 },
-  { 4.7549291132433 , 395.26787334186133 },
-  { 824.5690100011641 , 325.2875879243076 },
-  { 830.5863871092157 , 657.50111195477336 },
-  { 826.5564348888432 , 472.5058918934323 },
-  { 679.3971705297555 , 225.12446226726064 },
-  { 400.06158687684285 , 404.54471543461995 },
-  { 591.7671257438848 , 258.7151889813907 },
-  { 720.4980110486474 , 382.9750846374193 },
-  { 506.5964926927343 , 94.9805263773354 },
-  { 787.8879973654414 , 395.7511575967345 },
-  { 695.3929858856537 , 471.70770107494735 },
-  { 897.3183052240324 , 413.8662002860058 },
-  { 594.9229875542894 , 638.03040378674814 },
-  { 184.43269234168866 , 241.31097141535986 },
-  { 615.5853842148774 , 135.84812925582548 },
-  { 345.0916461395117 , 53.71294822472726 },
-  { 210.57516098185738 , 308.94757950392585 },
-  { 784.5428384049299 , 139.60360100319298 },
-  { 229.90655739997044 , 468.78257566525997 },
-  { 333.5167743886549 , 466.0431635748548 },
-  { 631.4982143541258 , 504.49056968713967 },
-  { 214.9971009469791 , 573.747837257871 },
-  { 755.0722269440655 , 545.1517851387066 },
-  { 66.32962575788777 , 626.80973824358134 },
-  { 911.958996317958 , 338.0636608836229 },
-  { 100.04855545222411 , 196.47488859685723 },
-  { 673.0470678814669 , 650.330997456301 },
-  { 541.7798434152875 , 555.4895575388002 },
-  { 847.2733723610191 , 208.48376936587007 },
-  { 395.01094660476804 , 327.7378228273286 },
-  { 987.0762653117268 , 564.0269426231647 },
-  { 104.7879675426293 , 392.8646716081727 },
-  { 549.435402245379 , 458.52488891043845 },
-  { 774.7661170504565 , 247.22312406472713 },
-  { 71.4944756086195 , 29.09860100319298 },
-  { 283.5531042997565 , 122.06584167576614 },
-  { 695.3929858856537 , 152.71770107494734 },
-  { 895.3671292470717 , 241.36886482144484 },
-  { 29.0855331388962 , 440.7557520548433 },
-  { 303.89692353801433 , 382.4699663584099 },
-  { 557.3605638740072 , 200.265997663781 },
-  { 204.876918059443 , 390.3925452701222 },
-  { 635.3129885722441 , 559.58268039529 },
-  { 199.8419663320501 , 141.2814873732953 },
-  { 6.49717827155244 , 272.10784959210883 },
-  { 471.7198834151466 , 170.83570092730264 },
-  { 483.39972592115123 , 281.3050099750423 },
-  { 808.0113075248926 , 52.6494979146761 },
-  { 564.7209843099678 , 35.17574109879045 },
-  { 429.9658184679722 , 596.1865343931215 },
-  { 461.6305434750709 , 446.7251000911983 },
-  { 200.2067096814187 , 620.24111428693027 },
-  { 689.0440715767083 , 61.50053441939208 },
-  { 99.1277147265525 , 311.19026744328187 },
-  { 404.78151123174234 , 229.76297914969106 },
-  { 351.31863770964776 , 529.6481708091374 },
-  { 19.39569036623584 , 560.57303294221083 },
-  { 636.3415642944442 , 4.38958212648868 },
-  { 403.4700232537357 , 108.30660267724977 },
-  { 142.6907577686194 , 457.5616235457593 },
-  { 243.8689663406792 , 22.27241545750888 },
-  { 80.51357773141541 , 113.66523179586645 },
-  { 564.888102424071 , 352.9597005195345 }
-},
-{ //#28 57 64
-  { 432.0819227206523 , 551.44789130275 },
-  { 655.6036000444254 , 336.8318070834259 },
-  { 519.869810117883 , 773.53810137027736 },
-  { 442.3062517993089 , 82.39259043522723 },
-  { 458.85320352458 , 322.734488186574 },
-  { 977.7022186607433 , 129.7582651422391 },
-  { 240.17718301332786 , 391.14412814710204 },
-  { 565.8007070937178 , 424.89627094300636 },
-  { 878.5153433431987 , 393.58196999132014 },
-  { 341.3823017746329 , 254.4846280251631 },
-  { 287.0979212410855 , 172.49029091461875 },
-  { 470.29981628163506 , 238.63731913779367 },
-  { 177.5197835124118 , 696.73837098939816 },
-  { 183.29410268264797 , 175.19465327447384 },
-  { 497.34227168364544 , 397.3545145579722 },
-  { 326.3535605867664 , 650.529473560458 },
-  { 135.7966538136273 , 628.3460391784373 },
-  { 528.72813468850836 , 514.8795502053877 },
-  { 275.707881550199 , 728.4738846086918 },
-  { 38.84915024448941 , 306.18425642200503 },
-  { 677.56882299103256 , 84.24043075320773 },
-  { 341.74541118252375 , 500.7481848652805 },
-  { 418.99688853528033 , 427.60063330286147 },
-  { 878.82436377165226 , 537.6824917310862 },
-  { 827.8453903673138 , 452.16393243883874 },
-  { 207.08103434717464 , 256.351702067893 },
-  { 433.56463991663645 , 634.8201992165228 },
-  { 386.03960426922106 , 733.4343362116599 },
-  { 625.1179176998239 , 539.6189622957928 },
-  { 718.65538511933687 , 276.3121018522595 },
-  { 358.398244051899 , 331.19043725503525 },
-  { 688.8833172714877 , 612.8765212447929 },
-  { 106.80880500604664 , 84.04302498774666 },
-  { 686.3206825948089 , 204.61698957378496 },
-  { 757.24472303052596 , 149.42269395087936 },
-  { 279.97144126834388 , 300.8102881056758 },
-  { 38.31652314898844 , 478.19033235374997 },
-  { 626.8173136870209 , 181.37631861384506 },
-  { 473.19632672194814 , 713.7876511708418 },
-  { 603.22936786028686 , 670.77648362158675 },
-  { 38.14818799490786 , 635.122616814395 },
-  { 504.51632656017046 , 136.40221350964003 },
-  { 754.7789589680781 , 520.92708090109716 },
-  { 115.26402671812633 , 530.3521151101822 },
-  { 855.6893982197237 , 142.6296689429879 },
-  { 245.82038904603172 , 618.85895737845567 },
-  { 777.77387939070604 , 367.9901972641823 },
-  { 990.95318518741675 , 215.2438096614493 },
-  { 597.56882299103256 , 84.24043075320773 },
-  { 934.536003786783 , 446.5281973029141 },
-  { 10.77060421511914 , 373.2706383539141 },
-  { 835.09326013814723 , 228.2888843426203 },
-  { 370.75162605158727 , 39.8918214385735 },
-  { 893.5495275481126 , 290.84075063523693 },
-  { 938.50864839428067 , 34.43962627613195 },
-  { 702.73185800127067 , 438.1482955373769 },
-  { 574.0652158532989 , 321.8948780867937 },
-  { 401.26952211447394 , 178.78706620484405 },
-  { 993.483290533285 , 323.31852368314765 },
-  { 565.8007070937178 , 218.7673432238454 },
-  { 528.3263341817707 , 22.34859033382517 },
-  { 155.59006469345331 , 293.5394404019993 },
-  { 918.9865991942907 , 621.75260225278345 },
-  { 148.75772762574832 , 785.35479963609498 },
-  { 138.78042881355475 , 364.23111567883547 },
-  { 210.9012827737609 , 548.2672954885178 },
-  { 530.94009426466636 , 631.2202651035073 },
-  { 807.5834636119042 , 604.5761984339795 },
-  { 90.3828356539653 , 255.52834167394238 },
-  { 736.0716513709727 , 15.65014938422726 },
-  { 238.8283279774722 , 98.3483171723389 },
-  { 791.3093918221687 , 293.52963435034474 },
-  { 95.95203062763136 , 427.154536334445 },
-  { 839.71447303821435 , 50.13020272434824 },
-  { 635.7412742639992 , 471.1612031036814 },
-  { 194.01771485219842 , 38.39234828637055 },
-  { 331.16489103572087 , 414.1608405860997 },
-  { 228.51771027739647 , 480.6992041700839 },
-  { 51.286992088707436 , 187.8460960921342 },
-  { 7.59132867775487 , 126.79706011488442 },
-  { 272.12625684697 , 9.47126509479716 }
-}
-};
@@ -0,0 +1,399 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Runs a simulation program over every point of a parameter sweep, as
+// many runs at a time as there are cores.
+//
+// The sweep is a list of parameters separated by ';', each with a list
+// of values separated by ',', where "a:b" stands for every integer from
+// a to b. Parameters joined by '+' take the same value, like the sides of
+// a square grid. Every combination of the values is run --seeds times.
+//
+// Each run is a process of its own, started from the current directory
+// with the fixed --args, its parameters, --RngRun set to a run number of
+// its own and --output-dir set to a directory of its own, <output>/run-N,
+// which also receives its standard output and error. Once every run is
+// over, the .txt files of the runs which succeeded are concatenated, in
+// the order of the runs, into the files of the same name in <output>;
+// the header lines starting with '#' are kept from the first run only.
+// The program and the arguments of each run are written to the file args
+// of its directory. When a sweep is started again, the runs which
+// succeeded with the same program and arguments are skipped, so an
+// interrupted sweep can be resumed; the others are run again.
+//
+// ./waf --run "sweep-runner --program=Single-Gateway-Obfuscation
+//     --sweep=xSize+ySize=5,7;sink=0:9;arp-op=1,4 --seeds=2
+//     --args=--time=100 --output=sweep-sgo"
+
+#include "ns3/core-module.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("SweepRunner");
+
+/// A swept parameter: the options which take its values, and the values
+struct Dimension
+{
+  std::vector<std::string> names;
+  std::vector<std::string> values;
+};
+
+/// A run of the program
+struct Run
+{
+  uint32_t number;
+  std::string directory;
+  std::vector<std::string> args;
+};
+
+static std::vector<std::string>
+Split (const std::string &s, char separator)
+{
+  std::vector<std::string> items;
+  std::istringstream iss (s);
+  std::string item;
+  while (std::getline (iss, item, separator))
+    {
+      if (!item.empty ())
+        {
+          items.push_back (item);
+        }
+    }
+  return items;
+}
+
+static std::vector<Dimension>
+ParseSweep (const std::string &sweep)
+{
+  std::vector<Dimension> dimensions;
+  std::vector<std::string> parameters = Split (sweep, ';');
+  for (std::vector<std::string>::const_iterator i = parameters.begin (); i != parameters.end (); ++i)
+    {
+      std::string::size_type equal = i->find ('=');
+      if (equal == std::string::npos)
+        {
+          NS_FATAL_ERROR ("No values for parameter " << *i);
+        }
+      Dimension dimension;
+      dimension.names = Split (i->substr (0, equal), '+');
+      std::vector<std::string> values = Split (i->substr (equal + 1), ',');
+      for (std::vector<std::string>::const_iterator j = values.begin (); j != values.end (); ++j)
+        {
+          int first, last;
+          char colon;
+          std::istringstream range (*j);
+          if (j->find (':') != std::string::npos
+              && range >> first >> colon >> last && range.eof () && colon == ':')
+            {
+              for (int k = first; k <= last; k++)
+                {
+                  std::ostringstream oss;
+                  oss << k;
+                  dimension.values.push_back (oss.str ());
+                }
+            }
+          else
+            {
+              dimension.values.push_back (*j);
+            }
+        }
+      if (dimension.names.empty () || dimension.values.empty ())
+        {
+          NS_FATAL_ERROR ("Bad parameter " << *i);
+        }
+      dimensions.push_back (dimension);
+    }
+  return dimensions;
+}
+
+// Every combination of the values, the last parameter varying fastest
+static std::vector<std::vector<std::string> >
+Expand (const std::vector<Dimension> &dimensions)
+{
+  std::vector<std::vector<std::string> > points (1);
+  for (std::vector<Dimension>::const_iterator i = dimensions.begin (); i != dimensions.end (); ++i)
+    {
+      std::vector<std::vector<std::string> > expanded;
+      for (std::vector<std::vector<std::string> >::const_iterator p = points.begin (); p != points.end (); ++p)
+        {
+          for (std::vector<std::string>::const_iterator v = i->values.begin (); v != i->values.end (); ++v)
+            {
+              std::vector<std::string> point = *p;
+              for (std::vector<std::string>::const_iterator n = i->names.begin (); n != i->names.end (); ++n)
+                {
+                  point.push_back ("--" + *n + "=" + *v);
+                }
+              expanded.push_back (point);
+            }
+        }
+      points.swap (expanded);
+    }
+  return points;
+}
+
+static int
+ReadStatus (const std::string &directory)
+{
+  std::ifstream status (SystemPath::Append (directory, "status").c_str ());
+  int code;
+  if (status >> code)
+    {
+      return code;
+    }
+  return -1;
+}
+
+// The program and the arguments of a run, one per line
+static std::string
+FormatArgs (const std::string &program, const Run &run)
+{
+  std::ostringstream oss;
+  oss << program << "\n";
+  for (std::vector<std::string>::const_iterator i = run.args.begin (); i != run.args.end (); ++i)
+    {
+      oss << *i << "\n";
+    }
+  return oss.str ();
+}
+
+static std::string
+ReadArgs (const std::string &directory)
+{
+  std::ifstream args (SystemPath::Append (directory, "args").c_str (), std::ios::binary);
+  std::ostringstream oss;
+  if (args.peek () != std::ifstream::traits_type::eof ())
+    {
+      oss << args.rdbuf ();
+    }
+  return oss.str ();
+}
+
+static pid_t
+Start (const std::string &program, const Run &run)
+{
+  std::ofstream args (SystemPath::Append (run.directory, "args").c_str (), std::ios::binary);
+  args << FormatArgs (program, run);
+  args.close ();
+
+  std::vector<char *> argv;
+  argv.push_back (const_cast<char *> (program.c_str ()));
+  for (std::vector<std::string>::const_iterator i = run.args.begin (); i != run.args.end (); ++i)
+    {
+      argv.push_back (const_cast<char *> (i->c_str ()));
+    }
+  argv.push_back (0);
+  std::string out = SystemPath::Append (run.directory, "stdout.log");
+  std::string err = SystemPath::Append (run.directory, "stderr.log");
+
+  pid_t pid = fork ();
+  if (pid != 0)
+    {
+      return pid;
+    }
+  // In the child: only async-signal-safe calls until exec
+  int outFd = open (out.c_str (), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  int errFd = open (err.c_str (), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (outFd < 0 || errFd < 0 || dup2 (outFd, 1) < 0 || dup2 (errFd, 2) < 0)
+    {
+      _exit (126);
+    }
+  close (outFd);
+  close (errFd);
+  execv (program.c_str (), &argv[0]);
+  _exit (127);
+}
+
+static void
+Merge (const std::string &output, const std::vector<Run> &runs)
+{
+  std::set<std::string> merged;
+  for (std::vector<Run>::const_iterator run = runs.begin (); run != runs.end (); ++run)
+    {
+      if (ReadStatus (run->directory) != 0)
+        {
+          continue;
+        }
+      std::list<std::string> files = SystemPath::ReadFiles (run->directory);
+      files.sort ();
+      for (std::list<std::string>::const_iterator f = files.begin (); f != files.end (); ++f)
+        {
+          if (f->size () < 4 || f->substr (f->size () - 4) != ".txt")
+            {
+              continue;
+            }
+          // The first run to have a file truncates its merged copy, and
+          // keeps its header lines, which the other runs repeat
+          bool first = merged.insert (*f).second;
+          std::ios::openmode mode = std::ios::out | std::ios::binary | (first ? std::ios::trunc : std::ios::app);
+          std::ofstream to (SystemPath::Append (output, *f).c_str (), mode);
+          std::ifstream from (SystemPath::Append (run->directory, *f).c_str (), std::ios::binary);
+          std::string line;
+          while (!first && from.peek () == '#' && std::getline (from, line))
+            {
+            }
+          if (from.peek () != std::ifstream::traits_type::eof ())
+            {
+              to << from.rdbuf ();
+            }
+        }
+    }
+  for (std::set<std::string>::const_iterator f = merged.begin (); f != merged.end (); ++f)
+    {
+      std::cout << "merged " << SystemPath::Append (output, *f) << std::endl;
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string program;
+  std::string sweep;
+  std::string fixed;
+  std::string output = "sweep";
+  uint32_t seeds = 1;
+  uint32_t firstRun = 1;
+  uint32_t jobs = 0;
+
+  CommandLine cmd;
+  cmd.AddValue ("program", "Program to run, a path or the name of a program built next to this one", program);
+  cmd.AddValue ("sweep", "Parameters and their values, like size=25,49;shuffle=1:20", sweep);
+  cmd.AddValue ("args", "Arguments passed to every run, separated by spaces", fixed);
+  cmd.AddValue ("seeds", "Runs of every combination of the parameters, with different RngRun", seeds);
+  cmd.AddValue ("first-run", "RngRun of the first run", firstRun);
+  cmd.AddValue ("jobs", "Runs at a time, zero for one per core", jobs);
+  cmd.AddValue ("output", "Directory of the runs and of the merged results", output);
+  cmd.Parse (argc, argv);
+
+  if (program.empty ())
+    {
+      NS_FATAL_ERROR ("No --program to run");
+    }
+  if (program.find ('/') == std::string::npos)
+    {
+      std::string self = argv[0];
+      std::string::size_type slash = self.rfind ('/');
+      program = (slash == std::string::npos ? "." : self.substr (0, slash)) + "/" + program;
+    }
+  if (access (program.c_str (), X_OK) != 0)
+    {
+      NS_FATAL_ERROR ("Cannot execute " << program);
+    }
+  if (jobs == 0)
+    {
+      long cores = sysconf (_SC_NPROCESSORS_ONLN);
+      jobs = cores > 0 ? cores : 1;
+    }
+
+  std::vector<std::vector<std::string> > points = Expand (ParseSweep (sweep));
+  std::vector<std::string> fixedArgs = Split (fixed, ' ');
+  std::vector<Run> runs;
+  for (uint32_t p = 0; p < points.size (); p++)
+    {
+      for (uint32_t s = 0; s < seeds; s++)
+        {
+          Run run;
+          run.number = firstRun + runs.size ();
+          std::ostringstream directory;
+          directory << "run-" << run.number;
+          run.directory = SystemPath::Append (output, directory.str ());
+          run.args = fixedArgs;
+          run.args.insert (run.args.end (), points[p].begin (), points[p].end ());
+          std::ostringstream rngRun;
+          rngRun << "--RngRun=" << run.number;
+          run.args.push_back (rngRun.str ());
+          run.args.push_back ("--output-dir=" + run.directory);
+          runs.push_back (run);
+        }
+    }
+  NS_LOG_INFO (runs.size () << " runs of " << program << ", " << jobs << " at a time");
+
+  std::map<pid_t, uint32_t> running;
+  uint32_t next = 0;
+  uint32_t done = 0;
+  uint32_t failed = 0;
+  while (next < runs.size () || !running.empty ())
+    {
+      if (next < runs.size () && running.size () < jobs)
+        {
+          const Run &run = runs[next++];
+          SystemPath::MakeDirectories (run.directory);
+          if (ReadStatus (run.directory) == 0 && ReadArgs (run.directory) == FormatArgs (program, run))
+            {
+              done++;
+              continue;
+            }
+          std::remove (SystemPath::Append (run.directory, "status").c_str ());
+          pid_t pid = Start (program, run);
+          if (pid < 0)
+            {
+              NS_FATAL_ERROR ("Cannot fork: " << std::strerror (errno));
+            }
+          running[pid] = next - 1;
+          continue;
+        }
+      int status;
+      pid_t pid = wait (&status);
+      if (pid < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+          NS_FATAL_ERROR ("Cannot wait for the runs: " << std::strerror (errno));
+        }
+      std::map<pid_t, uint32_t>::iterator i = running.find (pid);
+      if (i == running.end ())
+        {
+          continue;
+        }
+      const Run &run = runs[i->second];
+      running.erase (i);
+      int code = WIFEXITED (status) ? WEXITSTATUS (status) : 128 + WTERMSIG (status);
+      std::ofstream (SystemPath::Append (run.directory, "status").c_str ()) << code << "\n";
+      done++;
+      if (code != 0)
+        {
+          failed++;
+        }
+      std::cout << "run " << run.number << " exited with " << code
+                << " (" << done << "/" << runs.size () << ")" << std::endl;
+    }
+
+  Merge (output, runs);
+  if (failed != 0)
+    {
+      std::cerr << failed << " runs failed, see " << output << "/run-*/stderr.log" << std::endl;
+      return 1;
+    }
+  return 0;
+}
@@ -31,6 +31,9 @@
 namespace ns3 {
 
 OnOffHelperMLM::OnOffHelperMLM (std::string protocol, Address address)
+  : m_obfsOffset (0),
+    m_obfsCount (0),
+    m_obfsStride (0)
 {
   m_factory.SetTypeId ("ns3::OnOffMLM");
   m_factory.Set ("Protocol", StringValue (protocol));
@@ -52,35 +55,58 @@ OnOffHelperMLM::SetAttribute (std::string name, const AttributeValue &value)
 //    //sov-> SetObfsValues(value);
 //}
 
+void
+OnOffHelperMLM::SetObfuscationVector (Ptr<const ObfuscationVector> values, uint32_t offset, uint32_t count)
+{
+  m_obfs = values;
+  m_obfsOffset = offset;
+  m_obfsCount = count;
+  m_obfsStride = count;
+}
+
+void
+OnOffHelperMLM::SetObfuscationVector (std::vector<int32_t> values)
+{
+  m_obfs = Create<ObfuscationVector> (values);
+  m_obfsOffset = 0;
+  m_obfsCount = values.size ();
+  m_obfsStride = 0;
+}
+
 ApplicationContainer
 OnOffHelperMLM::Install (Ptr<Node> node) const
 {
-  return ApplicationContainer (InstallPriv (node));
+  return ApplicationContainer (InstallPriv (node, 0));
 }
 
 ApplicationContainer
 OnOffHelperMLM::Install (std::string nodeName) const
 {
   Ptr<Node> node = Names::Find<Node> (nodeName);
-  return ApplicationContainer (InstallPriv (node));
+  return ApplicationContainer (InstallPriv (node, 0));
 }
 
 ApplicationContainer
 OnOffHelperMLM::Install (NodeContainer c) const
 {
   ApplicationContainer apps;
-  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
+  uint32_t index = 0;
+  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i, ++index)
     {
-      apps.Add (InstallPriv (*i));
+      apps.Add (InstallPriv (*i, index));
     }
 
   return apps;
 }
 
 Ptr<Application>
-OnOffHelperMLM::InstallPriv (Ptr<Node> node) const
+OnOffHelperMLM::InstallPriv (Ptr<Node> node, uint32_t index) const
 {
   Ptr<Application> app = m_factory.Create<Application> ();
+  if (m_obfs)
+    {
+      DynamicCast<OnOffMLM> (app)->SetObfuscationVector (m_obfs, m_obfsOffset + index * m_obfsStride, m_obfsCount);
+    }
   node->AddApplication (app);
 
   return app;
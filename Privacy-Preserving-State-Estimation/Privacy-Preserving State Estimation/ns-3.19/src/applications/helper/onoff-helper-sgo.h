@@ -30,6 +30,7 @@
 
 #include <stdint.h>
 #include <string>
+#include <vector>
 #include "ns3/object-factory.h"
 #include "ns3/address.h"
 #include "ns3/attribute.h"
@@ -37,6 +38,7 @@
 #include "ns3/node-container.h"
 #include "ns3/application-container.h"
 #include "ns3/onoff-sgo.h"
+#include "ns3/obfuscation-vector.h"
 
 namespace ns3 {
 
@@ -122,6 +124,29 @@ public:
   
   //void  SetObfsValues (int16_t value);
 
+  /**
+   * \param values obfuscation values shared by all the applications
+   * \param offset index of the first value of the first application of
+   *        each Install call
+   * \param count number of values per application
+   *
+   * Every application installed afterwards references its own slice of
+   * the shared vector instead of parsing an ObfsValues string. The
+   * applications of the nodes of a NodeContainer get consecutive slices:
+   * that of the i-th node starts at offset + i * count. Each Install call
+   * starts again at offset, so call SetObfuscationVector again between
+   * two calls to hand out other slices.
+   */
+  void SetObfuscationVector (Ptr<const ObfuscationVector> values, uint32_t offset, uint32_t count);
+
+  /**
+   * \param values the obfuscation values sent by every application
+   *        installed afterwards
+   *
+   * The applications all reference a single copy of the values.
+   */
+  void SetObfuscationVector (std::vector<int32_t> values);
+
 private:
   /**
    * \internal
@@ -129,12 +154,18 @@ private:
    * attributes set with SetAttribute.
    *
    * \param node The node on which an OnOffApplication will be installed.
+   * \param index The index of the node in the nodes of the Install call,
+   *        which selects the slice of the obfuscation values.
    * \returns Ptr to the application installed.
    */
-  Ptr<Application> InstallPriv (Ptr<Node> node) const;
+  Ptr<Application> InstallPriv (Ptr<Node> node, uint32_t index) const;
   std::string m_protocol;
   Address m_remote;
   ObjectFactory m_factory;
+  Ptr<const ObfuscationVector> m_obfs;
+  uint32_t m_obfsOffset;
+  uint32_t m_obfsCount;
+  uint32_t m_obfsStride; //!< distance between the slices of two nodes
 };
 
 } // namespace ns3
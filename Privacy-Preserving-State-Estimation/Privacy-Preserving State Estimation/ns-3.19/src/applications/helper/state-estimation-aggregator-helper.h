@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef STATE_ESTIMATION_AGGREGATOR_HELPER_H
+#define STATE_ESTIMATION_AGGREGATOR_HELPER_H
+
+#include "ns3/object-factory.h"
+#include "ns3/address.h"
+#include "ns3/node-container.h"
+#include "ns3/application-container.h"
+
+namespace ns3 {
+
+/**
+ * \brief A helper to make it easier to instantiate an
+ * ns3::StateEstimationAggregator on the gateway.
+ */
+class StateEstimationAggregatorHelper
+{
+public:
+  /**
+   * \param protocol the name of the protocol to use to receive the reports,
+   *        which must be ns3::UdpSocketFactory
+   * \param address the address the reports are sent to
+   */
+  StateEstimationAggregatorHelper (std::string protocol, Address address);
+
+  /**
+   * Helper function used to set the underlying application attributes.
+   *
+   * \param name the name of the application attribute to set
+   * \param value the value of the application attribute to set
+   */
+  void SetAttribute (std::string name, const AttributeValue &value);
+
+  /**
+   * Install an aggregator on each node of the input container configured
+   * with all the attributes set with SetAttribute.
+   *
+   * \param c NodeContainer of the set of nodes on which an aggregator
+   * will be installed.
+   */
+  ApplicationContainer Install (NodeContainer c) const;
+
+  /**
+   * \param node The node on which an aggregator will be installed.
+   */
+  ApplicationContainer Install (Ptr<Node> node) const;
+
+  /**
+   * \param nodeName The name of the node on which an aggregator will be installed.
+   */
+  ApplicationContainer Install (std::string nodeName) const;
+
+private:
+  /**
+   * \internal
+   */
+  Ptr<Application> InstallPriv (Ptr<Node> node) const;
+  ObjectFactory m_factory;
+};
+
+} // namespace ns3
+
+#endif /* STATE_ESTIMATION_AGGREGATOR_HELPER_H */
@@ -0,0 +1,179 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "ns3/enum.h"
+#include "ns3/double.h"
+#include "ns3/boolean.h"
+#include "ns3/simulator.h"
+#include "crypto-cost-model.h"
+
+NS_LOG_COMPONENT_DEFINE ("CryptoCostModel");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (CryptoCostModel);
+
+// Sign and verify latencies in microseconds
+static const int64_t g_latencyUs[CryptoCostModel::CURVE_COUNT][CryptoCostModel::OPERATION_COUNT] = {
+  {   9000,  11000 }, // secp128r1
+  {  14000,  17000 }, // secp160r1
+  {  20000,  24000 }, // secp192r1
+  {  28000,  34000 }, // secp224r1
+  {  40000,  48000 }, // secp256r1
+  { 110000, 132000 }, // secp384r1
+  { 250000, 300000 }, // secp521r1
+};
+
+// Length of the (r, s) pair, twice the byte length of the group order
+static const uint32_t g_signatureLength[CryptoCostModel::CURVE_COUNT] = {
+  32, 42, 48, 56, 64, 96, 132
+};
+
+TypeId
+CryptoCostModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::CryptoCostModel")
+    .SetParent<Object> ()
+    .AddConstructor<CryptoCostModel> ()
+    .AddAttribute ("Curve",
+                   "The elliptic curve of the signing keys, which the latencies are taken for.",
+                   EnumValue (SECP128R1),
+                   MakeEnumAccessor (&CryptoCostModel::m_curve),
+                   MakeEnumChecker (SECP128R1, "secp128r1",
+                                    SECP160R1, "secp160r1",
+                                    SECP192R1, "secp192r1",
+                                    SECP224R1, "secp224r1",
+                                    SECP256R1, "secp256r1",
+                                    SECP384R1, "secp384r1",
+                                    SECP521R1, "secp521r1"))
+    .AddAttribute ("CpuScale",
+                   "Factor applied to the built-in latencies, e.g. 0.5 for a CPU twice as fast.",
+                   DoubleValue (1.0),
+                   MakeDoubleAccessor (&CryptoCostModel::m_cpuScale),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("BatchVerifyFactor",
+                   "Latency of each verification after the first of a batch, "
+                   "relative to the latency of a single verification.",
+                   DoubleValue (0.5),
+                   MakeDoubleAccessor (&CryptoCostModel::m_batchVerifyFactor),
+                   MakeDoubleChecker<double> (0.0, 1.0))
+    .AddAttribute ("CostOnly",
+                   "Skip the real crypto operations and only account for their cost.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&CryptoCostModel::m_costOnly),
+                   MakeBooleanChecker ())
+    .AddAttribute ("SignLatency",
+                   "Time to sign a report. Zero selects the built-in figure of the curve.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&CryptoCostModel::m_signLatency),
+                   MakeTimeChecker ())
+    .AddAttribute ("VerifyLatency",
+                   "Time to verify a report. Zero selects the built-in figure of the curve.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&CryptoCostModel::m_verifyLatency),
+                   MakeTimeChecker ())
+  ;
+  return tid;
+}
+
+CryptoCostModel::CryptoCostModel ()
+  : m_busyUntil (Seconds (0))
+{
+  NS_LOG_FUNCTION (this);
+  for (uint32_t i = 0; i < OPERATION_COUNT; i++)
+    {
+      m_operations[i] = 0;
+    }
+}
+
+CryptoCostModel::~CryptoCostModel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+Time
+CryptoCostModel::GetLatency (Operation operation) const
+{
+  NS_LOG_FUNCTION (this << operation);
+  NS_ASSERT (operation < OPERATION_COUNT);
+  Time latency;
+  switch (operation)
+    {
+    case SIGN:
+      latency = m_signLatency;
+      break;
+    case VERIFY:
+      latency = m_verifyLatency;
+      break;
+    default:
+      break;
+    }
+  if (latency.IsZero ())
+    {
+      latency = MicroSeconds (g_latencyUs[m_curve][operation]);
+    }
+  return Seconds (latency.GetSeconds () * m_cpuScale);
+}
+
+Time
+CryptoCostModel::Reserve (Operation operation)
+{
+  NS_LOG_FUNCTION (this << operation);
+  return Reserve (operation, 1);
+}
+
+Time
+CryptoCostModel::Reserve (Operation operation, uint32_t count)
+{
+  NS_LOG_FUNCTION (this << operation << count);
+  NS_ASSERT (count > 0);
+  Time latency = GetLatency (operation);
+  double further = operation == VERIFY ? m_batchVerifyFactor : 1.0;
+  Time now = Simulator::Now ();
+  Time start = m_busyUntil > now ? m_busyUntil : now;
+  m_busyUntil = start + latency + Seconds (latency.GetSeconds () * further * (count - 1));
+  m_operations[operation] += count;
+  NS_LOG_LOGIC (count << " operations " << operation << " complete at " << m_busyUntil);
+  return m_busyUntil - now;
+}
+
+bool
+CryptoCostModel::IsCostOnly (void) const
+{
+  return m_costOnly;
+}
+
+CryptoCostModel::Curve
+CryptoCostModel::GetCurve (void) const
+{
+  return m_curve;
+}
+
+uint32_t
+CryptoCostModel::GetSignatureLength (void) const
+{
+  return g_signatureLength[m_curve];
+}
+
+uint32_t
+CryptoCostModel::GetOperations (Operation operation) const
+{
+  NS_ASSERT (operation < OPERATION_COUNT);
+  return m_operations[operation];
+}
+
+} // namespace ns3
@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef CRYPTO_COST_MODEL_H
+#define CRYPTO_COST_MODEL_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup applications
+ *
+ * \brief Simulated CPU cost of the public key operations of a node.
+ *
+ * Aggregate a CryptoCostModel to a Node to make the crypto work done by
+ * OnOffSGO and PacketSinkTs consume simulated time: a report is only
+ * handed to the socket once its signature would have been computed,
+ * and a received report is only reported as verified once its
+ * verification would have completed. Operations of one node are
+ * serialized, i.e., the node has a single crypto CPU.
+ *
+ * The latency of each operation is taken from a built-in table for the
+ * selected Curve (figures representative of a meter-class embedded CPU,
+ * calibrate them for the target platform), scaled by CpuScale. Each
+ * operation can be overridden through its own attribute.
+ * OnOffSGO also generates its signing key on that Curve.
+ *
+ * A batch of reports verified together is reserved at once: the first
+ * verification of the batch takes the full latency and each further one
+ * BatchVerifyFactor of it, modelling the work shared by batch ECDSA
+ * verification.
+ *
+ * With CostOnly set, the applications skip the real Crypto++ calls and
+ * only account for their cost, which is what large parameter sweeps
+ * should use.
+ */
+class CryptoCostModel : public Object
+{
+public:
+  enum Curve
+  {
+    SECP128R1 = 0,
+    SECP160R1,
+    SECP192R1,
+    SECP224R1,
+    SECP256R1,
+    SECP384R1,
+    SECP521R1,
+    CURVE_COUNT
+  };
+
+  enum Operation
+  {
+    SIGN = 0,
+    VERIFY,
+    OPERATION_COUNT
+  };
+
+  static TypeId GetTypeId (void);
+
+  CryptoCostModel ();
+  virtual ~CryptoCostModel ();
+
+  /**
+   * \param operation the crypto operation
+   * \return the simulated time the operation takes on this node
+   */
+  Time GetLatency (Operation operation) const;
+
+  /**
+   * \param operation the crypto operation
+   * \return the delay from now until the operation completes
+   *
+   * Account for one operation on the crypto CPU of the node. The
+   * operation starts as soon as the operations reserved before it have
+   * completed.
+   */
+  Time Reserve (Operation operation);
+
+  /**
+   * \param operation the crypto operation
+   * \param count the number of operations done together, at least one
+   * \return the delay from now until the last operation completes
+   *
+   * Account for a batch of operations in one reservation. Verifications
+   * after the first of a batch cost BatchVerifyFactor of a verification,
+   * the other operations are not shared.
+   */
+  Time Reserve (Operation operation, uint32_t count);
+
+  /**
+   * \return true if the real crypto operations should be skipped
+   */
+  bool IsCostOnly (void) const;
+
+  /**
+   * \return the curve of the keys and of the latencies
+   */
+  Curve GetCurve (void) const;
+
+  /**
+   * \return the length of an (r, s) ECDSA signature on the configured curve
+   */
+  uint32_t GetSignatureLength (void) const;
+
+  /**
+   * \param operation the crypto operation
+   * \return the number of such operations reserved so far
+   */
+  uint32_t GetOperations (Operation operation) const;
+
+private:
+  Curve m_curve;
+  double m_cpuScale;
+  double m_batchVerifyFactor;
+  bool m_costOnly;
+  Time m_signLatency;
+  Time m_verifyLatency;
+  uint32_t m_operations[OPERATION_COUNT];
+  Time m_busyUntil;
+};
+
+} // namespace ns3
+
+#endif /* CRYPTO_COST_MODEL_H */
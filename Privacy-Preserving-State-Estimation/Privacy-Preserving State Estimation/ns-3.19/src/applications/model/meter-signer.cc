@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/fatal-error.h"
+#include "meter-signer.h"
+
+NS_LOG_COMPONENT_DEFINE ("MeterSigner");
+
+namespace ns3 {
+
+typedef CryptoPP::DL_GroupParameters_EC<MeterSigner::EccAlgorithm> GroupParameters;
+
+// The domain parameters of a curve of CryptoCostModel
+static GroupParameters
+GetGroupParameters (CryptoCostModel::Curve curve)
+{
+  switch (curve)
+    {
+    case CryptoCostModel::SECP128R1:
+      return GroupParameters (CryptoPP::ASN1::secp128r1 ());
+    case CryptoCostModel::SECP160R1:
+      return GroupParameters (CryptoPP::ASN1::secp160r1 ());
+    case CryptoCostModel::SECP192R1:
+      return GroupParameters (CryptoPP::ASN1::secp192r1 ());
+    case CryptoCostModel::SECP224R1:
+      return GroupParameters (CryptoPP::ASN1::secp224r1 ());
+    case CryptoCostModel::SECP256R1:
+      return GroupParameters (CryptoPP::ASN1::secp256r1 ());
+    case CryptoCostModel::SECP384R1:
+      return GroupParameters (CryptoPP::ASN1::secp384r1 ());
+    case CryptoCostModel::SECP521R1:
+      return GroupParameters (CryptoPP::ASN1::secp521r1 ());
+    default:
+      NS_FATAL_ERROR ("Unsupported curve " << curve);
+      return GroupParameters ();
+    }
+}
+
+MeterSigner::MeterSigner ()
+  : m_initialized (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+MeterSigner::~MeterSigner ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+MeterSigner::GenerateKey (CryptoCostModel::Curve curve)
+{
+  NS_LOG_FUNCTION (this << curve);
+  m_signer.AccessKey ().Initialize (m_prng, GetGroupParameters (curve));
+  m_initialized = true;
+}
+
+bool
+MeterSigner::LoadKey (std::string filename, CryptoCostModel::Curve curve)
+{
+  NS_LOG_FUNCTION (this << filename << curve);
+  try
+    {
+      CryptoPP::FileSource fs (filename.c_str (), true);
+      m_signer.AccessKey ().Load (fs);
+    }
+  catch (const CryptoPP::Exception &e)
+    {
+      NS_LOG_WARN ("Could not load private key from " << filename << ": " << e.what ());
+      return false;
+    }
+  if (!m_signer.GetKey ().Validate (m_prng, 3))
+    {
+      NS_LOG_WARN ("Private key in " << filename << " failed validation");
+      return false;
+    }
+  if (!(m_signer.GetKey ().GetGroupParameters () == GetGroupParameters (curve)))
+    {
+      NS_LOG_WARN ("Private key in " << filename << " is not on curve " << curve);
+      return false;
+    }
+  m_initialized = true;
+  return true;
+}
+
+void
+MeterSigner::Precompute (uint32_t storage)
+{
+  NS_LOG_FUNCTION (this << storage);
+  NS_ASSERT (m_initialized);
+  m_signer.AccessKey ().Precompute (storage);
+}
+
+bool
+MeterSigner::IsInitialized (void) const
+{
+  return m_initialized;
+}
+
+uint32_t
+MeterSigner::GetSignatureLength (void) const
+{
+  return m_signer.MaxSignatureLength ();
+}
+
+uint32_t
+MeterSigner::Sign (const uint8_t *message, uint32_t length, uint8_t *signature)
+{
+  NS_LOG_FUNCTION (this << length);
+  NS_ASSERT (m_initialized);
+  return m_signer.SignMessage (m_prng, message, length, signature);
+}
+
+MeterSigner::PublicKey
+MeterSigner::GetPublicKey (void) const
+{
+  NS_ASSERT (m_initialized);
+  PublicKey publicKey;
+  m_signer.GetKey ().MakePublicKey (publicKey);
+  return publicKey;
+}
+
+MeterVerifier::MeterVerifier (const MeterSigner::PublicKey &publicKey, uint32_t storage)
+  : m_verifier (publicKey)
+{
+  NS_LOG_FUNCTION (this << storage);
+  if (storage > 0)
+    {
+      m_verifier.AccessKey ().Precompute (storage);
+    }
+}
+
+MeterVerifier::~MeterVerifier ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+bool
+MeterVerifier::Verify (const uint8_t *message, uint32_t length,
+                       const uint8_t *signature, uint32_t signatureLength) const
+{
+  NS_LOG_FUNCTION (this << length << signatureLength);
+  return m_verifier.VerifyMessage (message, length, signature, signatureLength);
+}
+
+} // namespace ns3
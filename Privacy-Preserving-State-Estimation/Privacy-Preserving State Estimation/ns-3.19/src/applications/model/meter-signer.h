@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef METER_SIGNER_H
+#define METER_SIGNER_H
+
+#include <stdint.h>
+#include <string>
+#include "ns3/simple-ref-count.h"
+#include "crypto-cost-model.h"
+
+// Crypto++ Includes
+#include "cryptopp/cryptlib.h"
+#include "cryptopp/oids.h"
+#include "cryptopp/osrng.h"
+#include "cryptopp/eccrypto.h"
+#include "cryptopp/asn.h"
+#include "cryptopp/ecp.h"
+#include "cryptopp/ec2n.h"
+#include "cryptopp/simple.h"
+#include "cryptopp/sha.h"
+#include "cryptopp/files.h"
+#include "cryptopp/filters.h"
+#include "cryptopp/modes.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup applications
+ *
+ * \brief ECDSA signing state owned by a single meter application.
+ *
+ * The key is provisioned once (either generated on the Curve of the
+ * CryptoCostModel of the node or loaded from a DER file such as the
+ * private.ec.der written by the scratch scripts) and the signer is kept with its base-point precomputation
+ * tables, so that signing a meter report only costs the signature
+ * itself and never a key generation.
+ */
+class MeterSigner : public SimpleRefCount<MeterSigner>
+{
+public:
+  typedef CryptoPP::ECP EccAlgorithm;
+  typedef CryptoPP::SHA1 Hash;
+  typedef CryptoPP::ECDSA<EccAlgorithm, Hash> Ecdsa;
+  typedef Ecdsa::PrivateKey PrivateKey;
+  typedef Ecdsa::PublicKey PublicKey;
+
+  MeterSigner ();
+  ~MeterSigner ();
+
+  /**
+   * Generate a fresh private key.
+   *
+   * \param curve the curve of the key
+   */
+  void GenerateKey (CryptoCostModel::Curve curve);
+  /**
+   * \param filename DER encoded private key to load
+   * \param curve the curve the key must be on
+   * \return false if the file could not be read, or the key did not
+   *         validate or is on another curve
+   */
+  bool LoadKey (std::string filename, CryptoCostModel::Curve curve);
+  /**
+   * Build the fixed-base precomputation tables of the key.
+   *
+   * \param storage number of precomputed multiples of the base point
+   */
+  void Precompute (uint32_t storage);
+  /**
+   * \return true once a key has been generated or loaded
+   */
+  bool IsInitialized (void) const;
+
+  /**
+   * \return the maximum length in bytes of a signature
+   */
+  uint32_t GetSignatureLength (void) const;
+  /**
+   * \param message the message to sign
+   * \param length the length of the message
+   * \param signature buffer of at least GetSignatureLength () bytes
+   * \return the actual length of the signature written
+   */
+  uint32_t Sign (const uint8_t *message, uint32_t length, uint8_t *signature);
+  /**
+   * \return the public key matching the signing key
+   */
+  PublicKey GetPublicKey (void) const;
+
+private:
+  CryptoPP::AutoSeededRandomPool m_prng;
+  Ecdsa::Signer m_signer;
+  bool m_initialized;
+};
+
+/**
+ * \ingroup applications
+ *
+ * \brief ECDSA verifier bound to the public key of one meter.
+ *
+ * Receivers keep one MeterVerifier per sender so that the public key is
+ * decoded and its precomputation tables built only once.
+ */
+class MeterVerifier : public SimpleRefCount<MeterVerifier>
+{
+public:
+  /**
+   * \param publicKey the public key of the sender
+   * \param storage number of precomputed multiples of the public point,
+   *        zero to disable precomputation
+   */
+  MeterVerifier (const MeterSigner::PublicKey &publicKey, uint32_t storage);
+  ~MeterVerifier ();
+
+  /**
+   * \param message the signed message
+   * \param length the length of the message
+   * \param signature the signature of the message
+   * \param signatureLength the length of the signature
+   * \return true if the signature is valid
+   */
+  bool Verify (const uint8_t *message, uint32_t length,
+               const uint8_t *signature, uint32_t signatureLength) const;
+
+private:
+  MeterSigner::Ecdsa::Verifier m_verifier;
+};
+
+} // namespace ns3
+
+#endif /* METER_SIGNER_H */
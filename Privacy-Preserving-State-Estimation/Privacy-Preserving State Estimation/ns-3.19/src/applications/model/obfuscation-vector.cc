@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <stdlib.h>
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "obfuscation-vector.h"
+
+NS_LOG_COMPONENT_DEFINE ("ObfuscationVector");
+
+namespace ns3 {
+
+ObfuscationVector::ObfuscationVector ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+ObfuscationVector::ObfuscationVector (const std::vector<int32_t> &values)
+  : m_values (values)
+{
+  NS_LOG_FUNCTION (this << values.size ());
+}
+
+ObfuscationVector::ObfuscationVector (const int32_t *values, uint32_t count)
+  : m_values (values, values + count)
+{
+  NS_LOG_FUNCTION (this << count);
+}
+
+Ptr<ObfuscationVector>
+ObfuscationVector::Parse (std::string values)
+{
+  NS_LOG_FUNCTION (values);
+  std::vector<int32_t> parsed;
+  std::string::size_type dollar = values.find ('$');
+  if (dollar != std::string::npos)
+    {
+      parsed.reserve (atoi (values.substr (0, dollar).c_str ()));
+      std::string::size_type start = dollar + 1;
+      while (start < values.size ())
+        {
+          std::string::size_type star = values.find ('*', start);
+          if (star == std::string::npos)
+            {
+              star = values.size ();
+            }
+          parsed.push_back (atoi (values.substr (start, star - start).c_str ()));
+          start = star + 1;
+        }
+    }
+  return Create<ObfuscationVector> (parsed);
+}
+
+uint32_t
+ObfuscationVector::GetSize (void) const
+{
+  return m_values.size ();
+}
+
+int32_t
+ObfuscationVector::Get (uint32_t i) const
+{
+  NS_ASSERT (i < m_values.size ());
+  return m_values[i];
+}
+
+const int32_t *
+ObfuscationVector::GetData (uint32_t offset) const
+{
+  NS_ASSERT (offset <= m_values.size ());
+  if (m_values.empty ())
+    {
+      return 0;
+    }
+  return &m_values[0] + offset;
+}
+
+} // namespace ns3
@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OBFUSCATION_VECTOR_H
+#define OBFUSCATION_VECTOR_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "ns3/simple-ref-count.h"
+#include "ns3/ptr.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup applications
+ *
+ * \brief Immutable, reference-counted array of obfuscation values.
+ *
+ * One ObfuscationVector is meant to be built for a whole grid and shared
+ * by all the meter applications, each of them reading its own slice
+ * (offset, count) of it. The values are stored contiguously so that a
+ * slice can be serialized into a packet in a single copy.
+ */
+class ObfuscationVector : public SimpleRefCount<ObfuscationVector>
+{
+public:
+  ObfuscationVector ();
+  /**
+   * \param values the obfuscation values
+   */
+  ObfuscationVector (const std::vector<int32_t> &values);
+  /**
+   * \param values array of obfuscation values
+   * \param count number of values in the array
+   */
+  ObfuscationVector (const int32_t *values, uint32_t count);
+
+  /**
+   * \param values obfuscation values in the legacy "<count>$<v1>*<v2>*...*"
+   *        string format of the ObfsValues attribute
+   * \return the parsed vector
+   */
+  static Ptr<ObfuscationVector> Parse (std::string values);
+
+  /**
+   * \return the number of values
+   */
+  uint32_t GetSize (void) const;
+  /**
+   * \param i index of the value
+   * \return the value at index i
+   */
+  int32_t Get (uint32_t i) const;
+  /**
+   * \param offset index of the first value
+   * \return pointer to the contiguous values starting at offset
+   */
+  const int32_t * GetData (uint32_t offset) const;
+
+private:
+  std::vector<int32_t> m_values;
+};
+
+} // namespace ns3
+
+#endif /* OBFUSCATION_VECTOR_H */
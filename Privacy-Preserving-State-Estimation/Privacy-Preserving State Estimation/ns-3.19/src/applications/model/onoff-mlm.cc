@@ -113,7 +113,8 @@ OnOffMLM::GetTypeId (void)
                    MakeUintegerChecker<uint16_t> ())
   
    .AddAttribute ("ObfsValues", 
-                   "The list of obfuscation values.",
+                   "The list of obfuscation values as \"<count>$<v1>*<v2>*...*\". "
+                   "Superseded by SetObfuscationVector, which avoids any parsing.",
                    StringValue (""),
                    MakeStringAccessor (&OnOffMLM::m_obfsValues),
                    MakeStringChecker ())
@@ -133,7 +134,9 @@ OnOffMLM::OnOffMLM ()
     m_lastStartTime (Seconds (0)),
     m_totBytes (0),
     m_seqnum (0),
-    m_firstTime (true)
+    m_firstTime (true),
+    m_obfsOffset (0),
+    m_obfsCount (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -172,6 +175,7 @@ OnOffMLM::DoDispose (void)
   NS_LOG_FUNCTION (this);
 
   m_socket = 0;
+  m_obfs = 0;
   // chain up
   Application::DoDispose ();
 }
@@ -202,6 +206,13 @@ void OnOffMLM::StartApplication () // Called at time specified by Start
         MakeCallback (&OnOffMLM::ConnectionSucceeded, this),
         MakeCallback (&OnOffMLM::ConnectionFailed, this));
     }
+
+  if (!m_obfs && !m_obfsValues.empty ())
+    {
+      // Legacy string form, parsed once instead of on every send
+      Ptr<ObfuscationVector> values = ObfuscationVector::Parse (m_obfsValues);
+      SetObfuscationVector (values, 0, values->GetSize ());
+    }
     ScheduleNextTx ();
   // Insure no pending event
   //CancelEvents ();
@@ -316,114 +327,26 @@ void OnOffMLM::SendPacket ()
   /*SeqTsHeader seqTs;
   seqTs.SetSeq (m_seqnum);*/
   
-  int* obfsVector;
-  //int obfsVector[m_meterSize];
-  int arraySize;
-  NS_LOG_INFO("OBFUSCATION VALUES for TRANSMODE=0 ");
-  if(m_trsmode == 0){
-      // transmission modes between lead meters
-     NS_LOG_INFO("Meter Size "<<m_meterSize);
-     
-    string splitted_Values2;
-    std::stringstream stream2(m_obfsValues);
-    
-    std::getline(stream2, splitted_Values2, '$');
-    arraySize = atoi(splitted_Values2.c_str());
-    
-    obfsVector = (int*) calloc(arraySize, sizeof(int));
-    
-    m_obfsValues = m_obfsValues.substr(m_obfsValues.find("$")+1);
-    
-    string splitted_Values;
-    stringstream stream(m_obfsValues);
- 
-    int x=0;
-    while( getline(stream, splitted_Values, '*') ) {
-        obfsVector[x] = atoi(splitted_Values.c_str()); 
-        x++;
+  NS_LOG_INFO("Meter Size "<<m_meterSize);
+  for (uint32_t i = 0; i < m_obfsCount; i++)
+    {
+      NS_LOG_INFO("Values(Transmode=" << m_trsmode << "): " << m_obfs->Get (m_obfsOffset + i));
     }
-     
-    for(int i=0; i<arraySize; i++){
-        NS_LOG_INFO("Values(Transmode=0): "<<obfsVector[i]);
-    } 
-  }
-  NS_LOG_INFO("----------OBFS VALUES (TRASMODE=0 BITTI)-----------");
+  NS_LOG_INFO("SIZE : "<< m_obfsCount * sizeof(int32_t));
   
-  
-  NS_LOG_INFO("OBFUSCATION VALUES for TRANSMODE=1 ");
-  if(m_trsmode == 1){
-      // transmission modes between lead meters
-    NS_LOG_INFO("Meter Size "<<m_meterSize);
-     
-    string splitted_Values2;
-    stringstream stream2(m_obfsValues);
-    
-    getline(stream2, splitted_Values2, '$');
-     arraySize = atoi(splitted_Values2.c_str());
-    
-    obfsVector = (int*) calloc(arraySize, sizeof(int));
-    m_obfsValues = m_obfsValues.substr(m_obfsValues.find("$")+1);
-    
-    string splitted_Values;
-    stringstream stream(m_obfsValues);
-    int x=0;
-    while( getline(stream, splitted_Values, '*') ) {
-        obfsVector[x] = atoi(splitted_Values.c_str()); 
-        x++;
+  // Serialize this meter's slice straight from the shared vector into the
+  // packet buffer, followed by one zeroed int as before
+  Ptr<Packet> packet;
+  if (m_obfsCount > 0)
+    {
+      packet = Create<Packet> (reinterpret_cast<const uint8_t *> (m_obfs->GetData (m_obfsOffset)),
+                               m_obfsCount * sizeof(int32_t));
     }
-     for(int i=0; i<arraySize; i++){
-         NS_LOG_INFO("Values(Transmode=1): "<<obfsVector[i]);
-     }
-    
-  }
-  NS_LOG_INFO("----------OBFS VALUES (TRASMODE=1 BITTI)-----------");
-  
-   NS_LOG_INFO("OBFUSCATION VALUES for TRANSMODE=2 ");
-  if(m_trsmode == 2){
-      // transmission modes between lead meters
-    NS_LOG_INFO("Meter Size "<<m_meterSize);
-     
-    string splitted_Values2;
-    stringstream stream2(m_obfsValues);
-    
-    getline(stream2, splitted_Values2, '$');
-     arraySize = atoi(splitted_Values2.c_str());
-    
-    obfsVector = (int*) calloc(arraySize, sizeof(int));
-    m_obfsValues = m_obfsValues.substr(m_obfsValues.find("$")+1);
-    
-    string splitted_Values;
-    stringstream stream(m_obfsValues);
-    int x=0;
-    while( getline(stream, splitted_Values, '*') ) {
-        obfsVector[x] = atoi(splitted_Values.c_str()); 
-        x++;
+  else
+    {
+      packet = Create<Packet> ();
     }
-     for(int i=0; i<arraySize; i++){
-         NS_LOG_INFO("Values(Transmode=2): "<<obfsVector[i]);
-     }
-    
-  }
-  NS_LOG_INFO("----------OBFS VALUES (TRASMODE=2 BITTI)-----------");
-  
-  
-  
-  
-  int oVector[arraySize];
-  for(int i=0; i<arraySize; i++){
-      oVector[i]= obfsVector[i];
-  }
-  
-  NS_LOG_INFO("SIZE : "<< sizeof(oVector));
-  
-  int plainTextLength = sizeof(int) + sizeof(oVector);
-  
-  uint8_t * plainText;
-  plainText = (uint8_t *)malloc(plainTextLength);
-  
-  memcpy (plainText, reinterpret_cast <uint8_t *> (oVector), sizeof(oVector));
-  
-  Ptr<Packet> packet = Create<Packet> (plainText,plainTextLength); 
+  packet->AddPaddingAtEnd (sizeof(int32_t));
   //Ptr<Packet> packet = Create<Packet> (m_pktSize/*-(8+4)*/); // 8+4 : the size of the seqTs header
   //packet->AddHeader (seqTs);
   
@@ -461,6 +384,23 @@ void OnOffMLM::SendPacket ()
 }
 
 
+void
+OnOffMLM::SetObfuscationVector (std::vector<int32_t> values)
+{
+  NS_LOG_FUNCTION (this << values.size ());
+  SetObfuscationVector (Create<ObfuscationVector> (values), 0, values.size ());
+}
+
+void
+OnOffMLM::SetObfuscationVector (Ptr<const ObfuscationVector> values, uint32_t offset, uint32_t count)
+{
+  NS_LOG_FUNCTION (this << values << offset << count);
+  NS_ASSERT (offset + count <= values->GetSize ());
+  m_obfs = values;
+  m_obfsOffset = offset;
+  m_obfsCount = count;
+}
+
 void OnOffMLM::ConnectionSucceeded (Ptr<Socket> socket)
 {
   NS_LOG_FUNCTION (this << socket);
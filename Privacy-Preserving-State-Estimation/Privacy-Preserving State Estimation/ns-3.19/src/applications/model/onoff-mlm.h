@@ -31,6 +31,9 @@
 #include "ns3/ptr.h"
 #include "ns3/data-rate.h"
 #include "ns3/traced-callback.h"
+#include "obfuscation-vector.h"
+
+#include <vector>
 
 namespace ns3 {
 
@@ -116,6 +119,21 @@ public:
   */
   int64_t AssignStreams (int64_t stream);
 
+  /**
+   * \param values the obfuscation values sent in every report
+   */
+  void SetObfuscationVector (std::vector<int32_t> values);
+
+  /**
+   * \param values obfuscation values shared with other applications
+   * \param offset index of the first value sent by this application
+   * \param count number of values sent by this application
+   *
+   * The values are not copied: the application keeps a reference to the
+   * shared vector and serializes its slice straight into the reports.
+   */
+  void SetObfuscationVector (Ptr<const ObfuscationVector> values, uint32_t offset, uint32_t count);
+
 protected:
   virtual void DoDispose (void);
 private:
@@ -163,6 +181,9 @@ private:
   uint16_t        m_meterSize;
 
   std::string m_obfsValues;
+  Ptr<const ObfuscationVector> m_obfs; // Shared obfuscation values
+  uint32_t        m_obfsOffset;     // First value of this meter in m_obfs
+  uint32_t        m_obfsCount;      // Number of values of this meter
 
 private:
   void ScheduleNextTx ();
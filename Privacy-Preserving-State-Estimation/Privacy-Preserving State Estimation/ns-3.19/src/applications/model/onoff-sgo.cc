@@ -43,12 +43,14 @@
 #include "ns3/pointer.h"
 #include "ns3/seq-ts-header.h"
 #include "ns3/object-vector.h"
+#include "crypto-cost-model.h"
 
 #include <iostream>
 #include <stdlib.h>
 #include <string>
 #include <sstream>
 #include <vector>
+#include <algorithm>
 
 NS_LOG_COMPONENT_DEFINE ("OnOffSGO");
 
@@ -56,6 +58,9 @@ namespace ns3 {
 
 NS_OBJECT_ENSURE_REGISTERED (OnOffSGO);
 
+// Payload size of a meter report before signing was introduced
+static const uint32_t MIN_PAYLOAD_SIZE = 64;
+
 TypeId
 OnOffSGO::GetTypeId (void)
 {
@@ -113,10 +118,23 @@ OnOffSGO::GetTypeId (void)
                    MakeUintegerChecker<uint16_t> ())
   
    .AddAttribute ("ObfsValues", 
-                   "The list of obfuscation values.",
+                   "The list of obfuscation values as \"<count>$<v1>*<v2>*...*\". "
+                   "Superseded by SetObfuscationVector, which avoids any parsing.",
                    StringValue (""),
                    MakeStringAccessor (&OnOffSGO::m_obfsValues),
                    MakeStringChecker ())
+    .AddAttribute ("KeyFile",
+                   "DER encoded ECDSA private key loaded once when the application "
+                   "starts. If empty or unreadable, a key is generated instead.",
+                   StringValue (""),
+                   MakeStringAccessor (&OnOffSGO::m_keyFile),
+                   MakeStringChecker ())
+    .AddAttribute ("Precomputation",
+                   "Number of precomputed base point multiples kept by the signer. "
+                   "The value zero disables precomputation.",
+                   UintegerValue (16),
+                   MakeUintegerAccessor (&OnOffSGO::m_precomputation),
+                   MakeUintegerChecker<uint32_t> ())
 
     .AddTraceSource ("Tx", "A new packet is created and is sent",
                      MakeTraceSourceAccessor (&OnOffSGO::m_txTrace))
@@ -133,15 +151,12 @@ OnOffSGO::OnOffSGO ()
     m_lastStartTime (Seconds (0)),
     m_totBytes (0),
     m_seqnum (0),
-    m_firstTime (true)
+    m_firstTime (true),
+    m_obfsOffset (0),
+    m_obfsCount (0),
+    m_signatureLength (0)
 {
   NS_LOG_FUNCTION (this);
-  m_privateKey.Initialize(prng, ECC_CURVE);
-  //signer = signer(m_privateKey);
-  /*m_privateKey = CryptoPP::ECIES < ECC_ALGORITHM >::PrivateKey();
-  m_leadKey = CryptoPP::ECIES < ECC_ALGORITHM >::PublicKey();
-  Decryptor = CryptoPP::ECIES < ECC_ALGORITHM >::Decryptor (prng, ECC_CURVE);
-  Encryptor = CryptoPP::ECIES < ECC_ALGORITHM >::Encryptor (Decryptor); // ECIES*/
 }
 
 OnOffSGO::~OnOffSGO()
@@ -177,11 +192,75 @@ OnOffSGO::DoDispose (void)
 {
   NS_LOG_FUNCTION (this);
 
+  CancelTransmits ();
   m_socket = 0;
+  m_signer = 0;
+  m_costModel = 0;
+  m_obfs = 0;
   // chain up
   Application::DoDispose ();
 }
 
+void
+OnOffSGO::SetObfuscationVector (std::vector<int32_t> values)
+{
+  NS_LOG_FUNCTION (this << values.size ());
+  SetObfuscationVector (Create<ObfuscationVector> (values), 0, values.size ());
+}
+
+void
+OnOffSGO::SetObfuscationVector (Ptr<const ObfuscationVector> values, uint32_t offset, uint32_t count)
+{
+  NS_LOG_FUNCTION (this << values << offset << count);
+  NS_ASSERT (offset + count <= values->GetSize ());
+  m_obfs = values;
+  m_obfsOffset = offset;
+  m_obfsCount = count;
+}
+
+MeterSigner::PublicKey
+OnOffSGO::GetPublicKey (void)
+{
+  NS_LOG_FUNCTION (this);
+  ProvisionSigner ();
+  NS_ASSERT_MSG (m_signer, "No signing key in cost-only mode");
+  return m_signer->GetPublicKey ();
+}
+
+void
+OnOffSGO::ProvisionSigner (void)
+{
+  NS_LOG_FUNCTION (this);
+  // Provision the signing key once, every report reuses it
+  if (!m_message.empty ())
+    {
+      return;
+    }
+  m_costModel = GetNode ()->GetObject<CryptoCostModel> ();
+  if (m_costModel && m_costModel->IsCostOnly ())
+    {
+      m_signatureLength = m_costModel->GetSignatureLength ();
+    }
+  else
+    {
+      // The key is on the curve the costs are accounted for
+      CryptoCostModel::Curve curve = m_costModel ? m_costModel->GetCurve () : CryptoCostModel::SECP128R1;
+      m_signer = Create<MeterSigner> ();
+      if (m_keyFile.empty () || !m_signer->LoadKey (m_keyFile, curve))
+        {
+          m_signer->GenerateKey (curve);
+        }
+      if (m_precomputation > 0)
+        {
+          m_signer->Precompute (m_precomputation);
+        }
+      m_signatureLength = m_signer->GetSignatureLength ();
+    }
+  uint32_t messageLength = 2 * sizeof (uint16_t) + m_obfsCount * sizeof (int32_t)
+    + sizeof (uint64_t) + m_signatureLength;
+  m_message.resize (std::max<uint32_t> (MIN_PAYLOAD_SIZE, messageLength));
+}
+
 // Application Methods
 void OnOffSGO::StartApplication () // Called at time specified by Start
 {
@@ -208,6 +287,14 @@ void OnOffSGO::StartApplication () // Called at time specified by Start
         MakeCallback (&OnOffSGO::ConnectionSucceeded, this),
         MakeCallback (&OnOffSGO::ConnectionFailed, this));
     }
+
+  if (!m_obfs && !m_obfsValues.empty ())
+    {
+      // Legacy string form, parsed once instead of on every send
+      Ptr<ObfuscationVector> values = ObfuscationVector::Parse (m_obfsValues);
+      SetObfuscationVector (values, 0, values->GetSize ());
+    }
+  ProvisionSigner ();
     ScheduleNextTx ();
   // Insure no pending event
   //CancelEvents ();
@@ -222,6 +309,7 @@ void OnOffSGO::StopApplication () // Called at time specified by Stop
   NS_LOG_FUNCTION (this);
 
   CancelEvents ();
+  CancelTransmits ();
   if(m_socket != 0)
     {
       m_socket->Close ();
@@ -247,6 +335,17 @@ void OnOffSGO::CancelEvents ()
   Simulator::Cancel (m_startStopEvent);
 }
 
+void OnOffSGO::CancelTransmits ()
+{
+  NS_LOG_FUNCTION (this << m_transmitEvents.size ());
+  // The reports still being signed are not sent once the application stops
+  for (std::list<EventId>::iterator i = m_transmitEvents.begin (); i != m_transmitEvents.end (); ++i)
+    {
+      Simulator::Cancel (*i);
+    }
+  m_transmitEvents.clear ();
+}
+
 // Event handlers
 void OnOffSGO::StartSending ()
 {
@@ -319,158 +418,80 @@ void OnOffSGO::SendPacket ()
   NS_LOG_FUNCTION (this);
 
   NS_ASSERT (m_sendEvent.IsExpired ());
-  /*SeqTsHeader seqTs;
-  seqTs.SetSeq (m_seqnum);*/
-  
-  //int* obfsVector;
-  //int obfsVector[m_meterSize];
-  int arraySize = 1;
-  /*NS_LOG_INFO("OBFUSCATION VALUES for TRANSMODE=0 ");
-  if(m_trsmode == 0){
-      // transmission modes between lead meters
-     NS_LOG_INFO("Meter Size "<<m_meterSize);
-     
-    string splitted_Values2;
-    std::stringstream stream2(m_obfsValues);
-    
-    std::getline(stream2, splitted_Values2, '$');
-    arraySize = atoi(splitted_Values2.c_str());
-    
-    obfsVector = (int*) calloc(arraySize, sizeof(int));
-    
-    m_obfsValues = m_obfsValues.substr(m_obfsValues.find("$")+1);
-    
-    string splitted_Values;
-    stringstream stream(m_obfsValues);
- 
-    int x=0;
-    while( getline(stream, splitted_Values, '*') ) {
-        obfsVector[x] = atoi(splitted_Values.c_str()); 
-        x++;
-    }
-     
-    for(int i=0; i<arraySize; i++){
-        NS_LOG_INFO("Values(Transmode=0): "<<obfsVector[i]);
-    } 
-  }
-  NS_LOG_INFO("----------OBFS VALUES (TRASMODE=0 BITTI)-----------");
   
+  // The sequence number of a report is the measurement round it belongs to
+  SeqTsHeader seqTs;
+  seqTs.SetSeq (m_seqnum++);
   
-  NS_LOG_INFO("OBFUSCATION VALUES for TRANSMODE=1 ");
-  if(m_trsmode == 1){
-      // transmission modes between lead meters
-    NS_LOG_INFO("Meter Size "<<m_meterSize);
-     
-    string splitted_Values2;
-    stringstream stream2(m_obfsValues);
-    
-    getline(stream2, splitted_Values2, '$');
-     arraySize = atoi(splitted_Values2.c_str());
-    
-    obfsVector = (int*) calloc(arraySize, sizeof(int));
-    m_obfsValues = m_obfsValues.substr(m_obfsValues.find("$")+1);
-    
-    string splitted_Values;
-    stringstream stream(m_obfsValues);
-    int x=0;
-    while( getline(stream, splitted_Values, '*') ) {
-        obfsVector[x] = atoi(splitted_Values.c_str()); 
-        x++;
+  // The report is built in the pooled m_message buffer:
+  // | plainText length (2) | signature length (2) | plainText | signature | padding |
+  // where plainText is this meter's slice of the obfuscation vector followed
+  // by the Tx timestamp.
+  uint32_t obfsLength = m_obfsCount * sizeof(int32_t);
+  uint16_t plainTextLength = obfsLength + sizeof(uint64_t);
+  uint32_t headerLength = 2 * sizeof(uint16_t);
+  if (m_message.size () < headerLength + plainTextLength + m_signatureLength)
+    {
+      m_message.resize (headerLength + plainTextLength + m_signatureLength);
     }
-     for(int i=0; i<arraySize; i++){
-         NS_LOG_INFO("Values(Transmode=1): "<<obfsVector[i]);
-     }
-    
-  }
-  NS_LOG_INFO("----------OBFS VALUES (TRASMODE=1 BITTI)-----------");
+  std::fill (m_message.begin (), m_message.end (), 0);
   
-   NS_LOG_INFO("OBFUSCATION VALUES for TRANSMODE=2 ");
-  if(m_trsmode == 2){
-      // transmission modes between lead meters
-    NS_LOG_INFO("Meter Size "<<m_meterSize);
-     
-    string splitted_Values2;
-    stringstream stream2(m_obfsValues);
-    
-    getline(stream2, splitted_Values2, '$');
-     arraySize = atoi(splitted_Values2.c_str());
-    
-    obfsVector = (int*) calloc(arraySize, sizeof(int));
-    m_obfsValues = m_obfsValues.substr(m_obfsValues.find("$")+1);
-    
-    string splitted_Values;
-    stringstream stream(m_obfsValues);
-    int x=0;
-    while( getline(stream, splitted_Values, '*') ) {
-        obfsVector[x] = atoi(splitted_Values.c_str()); 
-        x++;
+  uint8_t *plainText = &m_message[headerLength];
+  uint64_t txTime = Simulator::Now ().GetTimeStep ();
+  if (m_obfsCount > 0)
+    {
+      memcpy (plainText, m_obfs->GetData (m_obfsOffset), obfsLength);
     }
-     for(int i=0; i<arraySize; i++){
-         NS_LOG_INFO("Values(Transmode=2): "<<obfsVector[i]);
-     }
-    
-  }
-  NS_LOG_INFO("----------OBFS VALUES (TRASMODE=2 BITTI)-----------");*/
-  
-  
-  SeqTsHeader seqTs;
-  
-  int oVector[arraySize];
-  /*for(int i=0; i<arraySize; i++){
-      oVector[i]= obfsVector[i];
-  }*/
-  
-  size_t plainTextLength = sizeof(uint64_t) + sizeof(oVector);
-  
-  byte * plainText;
-  plainText = (byte *)malloc(plainTextLength);
-  
-  memcpy (plainText, reinterpret_cast <byte *> (oVector), sizeof(oVector));
+  memcpy (plainText + obfsLength, &txTime, sizeof(txTime));
   
-  /*size_t cipherTextLength = Encryptor.CiphertextLength (plainTextLength);
-  NS_LOG_INFO("SIZE : "<< cipherTextLength);
-  byte * cipherText = new byte[cipherTextLength]; //ECIES*/
-  
-  //CryptoPP::FileSource fs( "private.ec.der", true);
-  //m_privateKey.Load( fs );
-  
-  //memset (cipherText, 0xFB, cipherTextLength);  //ECIES
-
-   // encrypt plaintext
-  //Encryptor.Encrypt (prng, plainText, plainTextLength, cipherText); //ECIES
-
-//  Ptr<Packet> packet = Create<Packet> (cipherText, cipherTextLength);  // ECIES
-  
-  //Ptr<Packet> packet = Create<Packet> (plainText, plainTextLength);
-  
-  CryptoPP::ECDSA <ECC_ALGORITHM, SHA1>::Signer signer(m_privateKey);
+  uint16_t siglen;
+  if (m_signer)
+    {
+      siglen = m_signer->Sign (plainText, plainTextLength, plainText + plainTextLength);
+    }
+  else
+    {
+      // Cost-only mode, the signature is left zeroed
+      siglen = m_signatureLength;
+    }
+  memcpy (&m_message[0], &plainTextLength, sizeof(uint16_t));
+  memcpy (&m_message[sizeof(uint16_t)], &siglen, sizeof(uint16_t));
   
-  Ptr<Packet> packet = Create<Packet> (64);
+  Ptr<Packet> packet = Create<Packet> (&m_message[0], m_message.size ());
   packet->AddHeader (seqTs);
-  signer.AccessKey().Initialize(prng, ECC_CURVE);
- 
-  //Signer.AccessKey().Initialize(prng, ECC_CURVE);
-  
-  // set up signature
-  size_t siglen = signer.MaxSignatureLength ();
-  string signature(siglen, 0xFB);
-  siglen = signer.SignMessage (prng, (const byte*)plainText, plainTextLength, (byte*)signature.data());
-  signature.resize (siglen);
-
-  // add signature to message
-  size_t messageLength = plainTextLength + siglen;
-  byte* message = (byte *)malloc(messageLength);
-  memset (message, 0xFB, messageLength);
-  memcpy (message, plainText, plainTextLength);
-  memcpy (message + plainTextLength, (byte *) signature.data(), siglen);
-  
-  //Ptr<Packet> packet = Create<Packet> (message, messageLength); 
-  //Ptr<Packet> packet = Create<Packet> (plainText,plainTextLength); 
-  //Ptr<Packet> packet = Create<Packet> (m_pktSize/*-(8+4)*/); // 8+4 : the size of the seqTs header
-  //packet->AddHeader (seqTs);
   
   NS_LOG_INFO("SIZE : "<< packet->GetSize());
   
+  if (m_costModel)
+    {
+      // The report leaves the meter once its signature has been computed.
+      // The signatures are computed in order, so the reports complete in
+      // the order of m_transmitEvents.
+      Time delay = m_costModel->Reserve (CryptoCostModel::SIGN);
+      m_transmitEvents.push_back (Simulator::Schedule (delay, &OnOffSGO::SignatureComplete, this, packet));
+    }
+  else
+    {
+      Transmit (packet);
+    }
+  m_lastStartTime = Simulator::Now ();
+  m_residualBits = 0;
+  ScheduleNextTx ();
+}
+
+
+void OnOffSGO::SignatureComplete (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+  NS_ASSERT (!m_transmitEvents.empty ());
+  m_transmitEvents.pop_front ();
+  Transmit (packet);
+}
+
+void OnOffSGO::Transmit (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+
   m_txTrace (packet);
   m_socket->Send (packet);
   m_totBytes += m_pktSize;
@@ -499,12 +520,8 @@ void OnOffSGO::SendPacket ()
                    << " port " << Inet6SocketAddress::ConvertFrom (m_peer).GetPort ()
                    << " total Tx " << m_totBytes << " bytes");
     }
-  m_lastStartTime = Simulator::Now ();
-  m_residualBits = 0;
-  ScheduleNextTx ();
 }
 
-
 void OnOffSGO::ConnectionSucceeded (Ptr<Socket> socket)
 {
   NS_LOG_FUNCTION (this << socket);
@@ -36,28 +36,16 @@
 #include "ns3/ptr.h"
 #include "ns3/data-rate.h"
 #include "ns3/traced-callback.h"
+#include "meter-signer.h"
+#include "obfuscation-vector.h"
 
-// Crypto++ Includes
-#include "cryptopp/cryptlib.h"
-#include "cryptopp/oids.h"
-#include "cryptopp/osrng.h"
-#include "cryptopp/eccrypto.h"
-#include "cryptopp/asn.h"
-#include "cryptopp/ecp.h"
-#include "cryptopp/ec2n.h"
-#include "cryptopp/simple.h"
-#include "cryptopp/sha.h"
-#include "cryptopp/files.h"
-#include "cryptopp/filters.h"
-#include "cryptopp/modes.h"
-
-#define ECC_ALGORITHM CryptoPP::ECP
-#define SHA1 CryptoPP::SHA1
-#define ECC_CURVE CryptoPP::ASN1::secp128r1()
+#include <list>
+#include <vector>
 
 namespace ns3 {
 
 class Address;
+class CryptoCostModel;
 class RandomVariableStream;
 class Socket;
 
@@ -140,6 +128,30 @@ public:
   */
   int64_t AssignStreams (int64_t stream);
 
+  /**
+   * \param values the obfuscation values sent in every report
+   */
+  void SetObfuscationVector (std::vector<int32_t> values);
+
+  /**
+   * \param values obfuscation values shared with other applications
+   * \param offset index of the first value sent by this application
+   * \param count number of values sent by this application
+   *
+   * The values are not copied: the application keeps a reference to the
+   * shared vector and serializes its slice straight into the reports.
+   */
+  void SetObfuscationVector (Ptr<const ObfuscationVector> values, uint32_t offset, uint32_t count);
+
+  /**
+   * \return the public key matching the key used to sign the reports
+   *
+   * The signing key is provisioned on first use, so this can be called
+   * before the application starts to register the key at the receiver.
+   * There is no key if the node has a CryptoCostModel in cost-only mode.
+   */
+  MeterSigner::PublicKey GetPublicKey (void);
+
 protected:
   virtual void DoDispose (void);
 private:
@@ -149,6 +161,8 @@ private:
 
   //helpers
   void CancelEvents ();
+  void CancelTransmits ();
+  void ProvisionSigner (void);
 
   void Construct (Ptr<Node> n,
                   const Address &remote,
@@ -162,6 +176,8 @@ private:
   void StartSending ();
   void StopSending ();
   void SendPacket ();
+  void Transmit (Ptr<Packet> packet);
+  void SignatureComplete (Ptr<Packet> packet);
 
   Ptr<Socket>     m_socket;       // Associated socket
   Address         m_peer;         // Peer address
@@ -189,16 +205,17 @@ private:
   uint16_t        m_meterSize;
 
   std::string m_obfsValues;
+  Ptr<const ObfuscationVector> m_obfs; // Shared obfuscation values
+  uint32_t        m_obfsOffset;     // First value of this meter in m_obfs
+  uint32_t        m_obfsCount;      // Number of values of this meter
   
-  /*CryptoPP::ECIES < ECC_ALGORITHM >::PrivateKey m_privateKey;
-  CryptoPP::ECIES < ECC_ALGORITHM >::PublicKey m_leadKey;
-  CryptoPP::ECIES < ECC_ALGORITHM >::Encryptor Encryptor;    
-  CryptoPP::ECIES < ECC_ALGORITHM >::Decryptor Decryptor;
-  CryptoPP::AutoSeededRandomPool prng;*/
-  
-  CryptoPP::ECDSA <ECC_ALGORITHM, SHA1>::PrivateKey m_privateKey;
-  CryptoPP::AutoSeededRandomPool prng;
-//  CryptoPP::ECDSA <ECC_ALGORITHM, SHA1>::Signer signer;
+  std::string     m_keyFile;        // DER private key to load, empty to generate
+  uint32_t        m_precomputation; // Signer precomputation storage
+  Ptr<MeterSigner> m_signer;        // Signing key, provisioned in StartApplication
+  Ptr<CryptoCostModel> m_costModel; // Crypto CPU of the node, if any
+  std::list<EventId> m_transmitEvents; // Reports waiting for their signature, in order
+  std::vector<uint8_t> m_message;   // Reused report buffer
+  uint32_t        m_signatureLength; // Maximum signature length
 
 private:
   void ScheduleNextTx ();
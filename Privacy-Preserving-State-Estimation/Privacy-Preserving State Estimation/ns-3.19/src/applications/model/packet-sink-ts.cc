@@ -32,6 +32,10 @@
 #include "ns3/udp-socket-factory.h"
 #include "ns3/packet-sink-ts.h"
 #include "ns3/seq-ts-header.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/string.h"
+#include "ns3/crypto-cost-model.h"
 
 namespace ns3 {
 
@@ -52,22 +56,46 @@ PacketSinkTs::GetTypeId (void)
                    TypeIdValue (UdpSocketFactory::GetTypeId ()),
                    MakeTypeIdAccessor (&PacketSinkTs::m_tid),
                    MakeTypeIdChecker ())
+    .AddAttribute ("Verify", "Verify the ECDSA signature of every received report.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&PacketSinkTs::m_verify),
+                   MakeBooleanChecker ())
+    .AddAttribute ("VerifyInterval",
+                   "Period at which the reports received since the last period "
+                   "are verified as one batch, which reserves the crypto CPU of "
+                   "the node once and shares the cost of the verifications "
+                   "(see CryptoCostModel::BatchVerifyFactor). The value zero "
+                   "verifies every report on its own as it is received.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&PacketSinkTs::m_verifyInterval),
+                   MakeTimeChecker ())
+    .AddAttribute ("PublicKeyFile",
+                   "DER encoded public key used for senders without a key "
+                   "registered through AddPublicKey. Empty for none.",
+                   StringValue (""),
+                   MakeStringAccessor (&PacketSinkTs::m_publicKeyFile),
+                   MakeStringChecker ())
+    .AddAttribute ("Precomputation",
+                   "Number of precomputed multiples kept by each verifier. "
+                   "The value zero disables precomputation.",
+                   UintegerValue (16),
+                   MakeUintegerAccessor (&PacketSinkTs::m_precomputation),
+                   MakeUintegerChecker<uint32_t> ())
     .AddTraceSource ("Rx", "A packet has been received",
                      MakeTraceSourceAccessor (&PacketSinkTs::m_rxTrace))
+    .AddTraceSource ("VerifyResult", "The signature of a received report has been checked",
+                     MakeTraceSourceAccessor (&PacketSinkTs::m_verifyTrace))
   ;
   return tid;
 }
 
 PacketSinkTs::PacketSinkTs ()
+  : m_verified (0),
+    m_failed (0)
 {
   NS_LOG_FUNCTION (this);
   m_socket = 0;
   m_totalRx = 0;
-  
-  //Decryptor = CryptoPP::ECIES < ECC_ALGORITHM >::Decryptor (prng, ECC_CURVE); //ECIES
-  
-  /*privateKey.Initialize (prng, ECC_CURVE);    
-  privateKey.MakePublicKey (publicKey);*/
 }
 
 PacketSinkTs::~PacketSinkTs()
@@ -95,11 +123,42 @@ PacketSinkTs::GetAcceptedSockets (void) const
   return m_socketList;
 }
 
+void
+PacketSinkTs::AddPublicKey (Ipv4Address sender, const MeterSigner::PublicKey &publicKey)
+{
+  NS_LOG_FUNCTION (this << sender);
+  m_verifiers[sender] = Create<MeterVerifier> (publicKey, m_precomputation);
+}
+
+uint32_t
+PacketSinkTs::GetVerified (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_verified;
+}
+
+uint32_t
+PacketSinkTs::GetVerificationFailures (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_failed;
+}
+
 void PacketSinkTs::DoDispose (void)
 {
   NS_LOG_FUNCTION (this);
   m_socket = 0;
   m_socketList.clear ();
+  m_verifiers.clear ();
+  m_defaultVerifier = 0;
+  m_costModel = 0;
+  Simulator::Cancel (m_verifyEvent);
+  m_pending.clear ();
+  for (std::list<Batch>::iterator i = m_batches.begin (); i != m_batches.end (); ++i)
+    {
+      Simulator::Cancel (i->complete);
+    }
+  m_batches.clear ();
 
   // chain up
   Application::DoDispose ();
@@ -110,6 +169,21 @@ void PacketSinkTs::DoDispose (void)
 void PacketSinkTs::StartApplication ()    // Called at time specified by Start
 {
   NS_LOG_FUNCTION (this);
+  m_costModel = GetNode ()->GetObject<CryptoCostModel> ();
+  if (m_verify && !m_defaultVerifier && !m_publicKeyFile.empty ())
+    {
+      try
+        {
+          MeterSigner::PublicKey publicKey;
+          CryptoPP::FileSource fs (m_publicKeyFile.c_str (), true);
+          publicKey.Load (fs);
+          m_defaultVerifier = Create<MeterVerifier> (publicKey, m_precomputation);
+        }
+      catch (const CryptoPP::Exception &e)
+        {
+          NS_LOG_WARN ("Could not load public key from " << m_publicKeyFile << ": " << e.what ());
+        }
+    }
   // Create the socket if not already
   if (!m_socket)
     {
@@ -155,6 +229,10 @@ void PacketSinkTs::StopApplication ()     // Called at time specified by Stop
       m_socket->Close ();
       m_socket->SetRecvCallback (MakeNullCallback<void, Ptr<Socket> > ());
     }
+  // Do not lose the reports of the last batches, but do not leave their
+  // verification scheduled past the end of the application either
+  Simulator::Cancel (m_verifyEvent);
+  FlushBatches ();
 }
 
 void PacketSinkTs::HandleRead (Ptr<Socket> socket)
@@ -163,20 +241,12 @@ void PacketSinkTs::HandleRead (Ptr<Socket> socket)
   Ptr<Packet> packet;
   Address from;
   
-  size_t packetSize;
-  byte* signature;
-  byte* plainText;
-  
-  //byte *cipherText;   //ECIES & ECDSA
-  //byte *cipherText;
-  
   while ((packet = socket->RecvFrom (from)))
     {
       if (packet->GetSize () == 0)
         { //EOF
           break;
         }
-      //packetSize = packet->GetSize ();
       m_totalRx += packet->GetSize ();
       uint32_t m_rxBytes = packet->GetSize ();
       m_rxTrace (packet, from);
@@ -184,77 +254,168 @@ void PacketSinkTs::HandleRead (Ptr<Socket> socket)
       SeqTsHeader seqTs;
       packet->PeekHeader (seqTs);
       
-      //int recoveredTextLength = sizeof(int) + sizeof (uint64_t);  //ECIES
-      //byte * recoveredText = (byte *)malloc(recoveredTextLength); //ECIES
-      //size_t cipherTextLength = Decryptor.CiphertextLength (recoveredTextLength); // ECIES
+      NS_LOG_INFO("RECEIVING SIZE : "<< m_rxBytes); 
       
-      //cipherText = new uint8_t [packet->GetSize ()];  //ECIES & ECDSA
-      
-      //cipherText = new uint8_t [packet->GetSize ()];
-      
-      packetSize = packet->GetSize();
-      
-      
-      
-      // Decryption
-      //Decryptor.Decrypt (prng, cipherText, cipherTextLength, recoveredText);      //ECIES
-      
-      size_t plainTextLength = sizeof(int) + sizeof(uint64_t);
-      size_t signatureLength = packetSize - plainTextLength;
-      
-      plainText = (byte *)malloc(plainTextLength);
-      signature = (byte *)malloc(signatureLength);
-      
-      memset (plainText, 0xFB, plainTextLength);
-      memset (signature, 0xFB, signatureLength);
-      
-      CryptoPP::ECDSA<ECC_ALGORITHM, SHA1>::Verifier Verifier (publicKey);
-      
-      //Verifier.VerifyMessage(plainText, plainTextLength, signature, signatureLength);
-      
-      NS_LOG_INFO("RECEIVING SIZE : "<< packetSize); 
-      
-     /// SeqTsHeader seqTs;
-    //  packet->PeekHeader (seqTs);
-      ///packet->RemoveHeader (seqTs);
+      if (m_verify)
+        {
+          PendingReport report;
+          report.packet = packet;
+          report.from = from;
+          m_pending.push_back (report);
+          if (m_verifyInterval.IsZero ())
+            {
+              VerifyBatch ();
+            }
+          else if (!m_verifyEvent.IsRunning ())
+            {
+              m_verifyEvent = Simulator::Schedule (m_verifyInterval, &PacketSinkTs::VerifyBatch, this);
+            }
+        }
       
       if (InetSocketAddress::IsMatchingType (from))
         {
               Time now = Simulator::Now ();
               NS_LOG_INFO (" RX " << m_rxBytes 
                            << " From "<< InetSocketAddress::ConvertFrom (from).GetIpv4 () 
-         ///                  << " Sequence Number: " << seqTs.GetSeq () 
                            << " Uid: " << packet->GetUid () 
                            << " TXtime: " << seqTs.GetTs () 
                            << " RXtime: " << now );
-            //               << " Delay: " << (now - seqTs.GetTs ()));
-         // NS_LOG_INFO ("At time " << Simulator::Now ().GetSeconds ()
-         //              << "s packet sink received "
-         //              <<  packet->GetSize () << " bytes from "
-         //              << InetSocketAddress::ConvertFrom(from).GetIpv4 ()
-         //              << " port " << InetSocketAddress::ConvertFrom (from).GetPort ()
-         //              << " total Rx " << m_totalRx << " bytes");
         }
       else if (Inet6SocketAddress::IsMatchingType (from))
         {
           NS_LOG_INFO ("TraceDelay: RX " << m_rxBytes <<
                            " bytes from "<< Inet6SocketAddress::ConvertFrom (from).GetIpv6 () <<
-                           ///" Sequence Number: " << seqTs.GetSeq() <<
                            " Uid: " << packet->GetUid () <<
                            " TXtime: " << seqTs.GetTs () <<
                            " RXtime: " << Simulator::Now () );
-                           //" Delay: " << Simulator::Now () - seqTs.GetTs ());
-          /*NS_LOG_INFO ("At time " << Simulator::Now ().GetSeconds ()
-                       << "s packet sink received "
-                       <<  packet->GetSize () << " bytes from "
-                       << Inet6SocketAddress::ConvertFrom(from).GetIpv6 ()
-                       << " port " << Inet6SocketAddress::ConvertFrom (from).GetPort ()
-                       << " total Rx " << m_totalRx << " bytes"); */
         }
      
     }
 }
 
+Ptr<MeterVerifier>
+PacketSinkTs::LookupVerifier (Ipv4Address sender) const
+{
+  std::map<Ipv4Address, Ptr<MeterVerifier> >::const_iterator i = m_verifiers.find (sender);
+  if (i != m_verifiers.end ())
+    {
+      return i->second;
+    }
+  return m_defaultVerifier;
+}
+
+void
+PacketSinkTs::Verify (Ptr<const Packet> packet, const Address &from)
+{
+  NS_LOG_FUNCTION (this << packet << from);
+
+  // Report layout written by OnOffSGO after the SeqTsHeader:
+  // | plainText length (2) | signature length (2) | plainText | signature | padding |
+  SeqTsHeader seqTs;
+  uint32_t offset = seqTs.GetSerializedSize ();
+  uint32_t size = packet->GetSize ();
+  bool valid = false;
+  Ptr<MeterVerifier> verifier;
+  if (InetSocketAddress::IsMatchingType (from))
+    {
+      verifier = LookupVerifier (InetSocketAddress::ConvertFrom (from).GetIpv4 ());
+    }
+  if (m_costModel && m_costModel->IsCostOnly ())
+    {
+      valid = true;
+    }
+  else if (verifier == 0)
+    {
+      NS_LOG_WARN ("No public key for " << from);
+    }
+  else if (size >= offset + 2 * sizeof (uint16_t))
+    {
+      if (m_rxBuffer.size () < size)
+        {
+          m_rxBuffer.resize (size);
+        }
+      packet->CopyData (&m_rxBuffer[0], size);
+      const uint8_t *report = &m_rxBuffer[offset];
+      uint16_t plainTextLength;
+      uint16_t signatureLength;
+      memcpy (&plainTextLength, report, sizeof (uint16_t));
+      memcpy (&signatureLength, report + sizeof (uint16_t), sizeof (uint16_t));
+      const uint8_t *plainText = report + 2 * sizeof (uint16_t);
+      if (offset + 2 * sizeof (uint16_t) + plainTextLength + signatureLength <= size)
+        {
+          valid = verifier->Verify (plainText, plainTextLength,
+                                    plainText + plainTextLength, signatureLength);
+        }
+    }
+
+  if (valid)
+    {
+      m_verified++;
+    }
+  else
+    {
+      m_failed++;
+      NS_LOG_LOGIC ("Report " << packet->GetUid () << " from " << from << " failed verification");
+    }
+  m_verifyTrace (packet, from, valid);
+}
+
+void
+PacketSinkTs::VerifyBatch (void)
+{
+  NS_LOG_FUNCTION (this << m_pending.size ());
+  if (m_pending.empty ())
+    {
+      return;
+    }
+  if (!m_costModel)
+    {
+      for (std::vector<PendingReport>::const_iterator i = m_pending.begin (); i != m_pending.end (); ++i)
+        {
+          Verify (i->packet, i->from);
+        }
+      m_pending.clear ();
+      return;
+    }
+  // The batch is verified once the crypto CPU of the gateway gets to it.
+  // The CPU serves its reservations in order, so the batches complete in
+  // the order they are queued here.
+  Time delay = m_costModel->Reserve (CryptoCostModel::VERIFY, m_pending.size ());
+  m_batches.push_back (Batch ());
+  m_batches.back ().reports.swap (m_pending);
+  m_batches.back ().complete = Simulator::Schedule (delay, &PacketSinkTs::CompleteBatch, this);
+}
+
+void
+PacketSinkTs::CompleteBatch (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!m_batches.empty ());
+  std::vector<PendingReport> reports;
+  reports.swap (m_batches.front ().reports);
+  m_batches.pop_front ();
+  for (std::vector<PendingReport>::const_iterator i = reports.begin (); i != reports.end (); ++i)
+    {
+      Verify (i->packet, i->from);
+    }
+}
+
+void
+PacketSinkTs::FlushBatches (void)
+{
+  NS_LOG_FUNCTION (this);
+  while (!m_batches.empty ())
+    {
+      Simulator::Cancel (m_batches.front ().complete);
+      CompleteBatch ();
+    }
+  for (std::vector<PendingReport>::const_iterator i = m_pending.begin (); i != m_pending.end (); ++i)
+    {
+      Verify (i->packet, i->from);
+    }
+  m_pending.clear ();
+}
+
 
 void PacketSinkTs::HandlePeerClose (Ptr<Socket> socket)
 {
@@ -27,24 +27,18 @@
 #include "ns3/traced-callback.h"
 #include "ns3/address.h"
 
-// Crypto++ Includes
-#include "cryptopp/cryptlib.h"
-#include "cryptopp/oids.h"
-#include "cryptopp/osrng.h"
-#include "cryptopp/eccrypto.h"
-#include "cryptopp/asn.h"
-#include "cryptopp/ecp.h"
-#include "cryptopp/ec2n.h"
-#include "cryptopp/simple.h"
-#include "cryptopp/sha.h"
-
-#define ECC_ALGORITHM CryptoPP::ECP
-#define SHA1 CryptoPP::SHA1
-#define ECC_CURVE CryptoPP::ASN1::secp128r1()
+#include "ns3/ipv4-address.h"
+#include "ns3/nstime.h"
+#include "meter-signer.h"
+
+#include <list>
+#include <map>
+#include <vector>
 
 namespace ns3 {
 
 class Address;
+class CryptoCostModel;
 class Socket;
 class Packet;
 
@@ -102,6 +96,25 @@ public:
    * \return list of pointers to accepted sockets
    */
   std::list<Ptr<Socket> > GetAcceptedSockets (void) const;
+
+  /**
+   * \param sender the address the meter reports are received from
+   * \param publicKey the public key the sender signs its reports with
+   *
+   * Register the key of a meter. Its verifier, with precomputation, is
+   * built once here and reused for every report of that sender.
+   */
+  void AddPublicKey (Ipv4Address sender, const MeterSigner::PublicKey &publicKey);
+
+  /**
+   * \return the number of reports whose signature was valid
+   */
+  uint32_t GetVerified (void) const;
+
+  /**
+   * \return the number of reports which could not be verified
+   */
+  uint32_t GetVerificationFailures (void) const;
  
 protected:
   virtual void DoDispose (void);
@@ -115,23 +128,48 @@ private:
   void HandlePeerClose (Ptr<Socket>);
   void HandlePeerError (Ptr<Socket>);
 
+  Ptr<MeterVerifier> LookupVerifier (Ipv4Address sender) const;
+  void Verify (Ptr<const Packet> packet, const Address &from);
+  void VerifyBatch (void);
+  void CompleteBatch (void);
+  void FlushBatches (void);
+
   // In the case of TCP, each socket accept returns a new socket, so the 
   // listening socket is stored seperately from the accepted sockets
   Ptr<Socket>     m_socket;       // Listening socket
   std::list<Ptr<Socket> > m_socketList; //the accepted sockets
   
-  //CryptoPP::ECIES < ECC_ALGORITHM >::PrivateKey m_privateKey;     //ECIES
-  //CryptoPP::ECIES < ECC_ALGORITHM >::Decryptor Decryptor; `       //ECIES
-  //CryptoPP::AutoSeededRandomPool prng;
-  
-  CryptoPP::ECDSA <ECC_ALGORITHM, SHA1>::PrivateKey privateKey;    
-  CryptoPP::ECDSA <ECC_ALGORITHM, SHA1>::PublicKey publicKey;
-  CryptoPP::AutoSeededRandomPool prng;
+  struct PendingReport
+  {
+    Ptr<const Packet> packet;
+    Address from;
+  };
+
+  struct Batch
+  {
+    std::vector<PendingReport> reports; // Reports verified together
+    EventId complete;                   // End of their verification
+  };
+
+  bool            m_verify;          // Verify the signature of the reports
+  Time            m_verifyInterval;  // Batch verification period, zero for inline
+  std::string     m_publicKeyFile;   // DER public key for unregistered senders
+  uint32_t        m_precomputation;  // Verifier precomputation storage
+  std::map<Ipv4Address, Ptr<MeterVerifier> > m_verifiers; // Per-sender verifiers
+  Ptr<MeterVerifier> m_defaultVerifier; // Verifier built from m_publicKeyFile
+  std::vector<PendingReport> m_pending; // Reports waiting for the next batch
+  EventId         m_verifyEvent;     // Next batch verification
+  std::list<Batch> m_batches;        // Batches on the crypto CPU, in completion order
+  Ptr<CryptoCostModel> m_costModel;  // Crypto CPU of the node, if any
+  std::vector<uint8_t> m_rxBuffer;   // Reused payload buffer
+  uint32_t        m_verified;        // Valid signatures
+  uint32_t        m_failed;          // Invalid or unverifiable reports
 
   Address         m_local;        // Local address to bind to
   uint32_t        m_totalRx;      // Total bytes received
   TypeId          m_tid;          // Protocol TypeId
   TracedCallback<Ptr<const Packet>, const Address &> m_rxTrace;
+  TracedCallback<Ptr<const Packet>, const Address &, bool> m_verifyTrace;
 
 };
 
@@ -0,0 +1,412 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/address-utils.h"
+#include "ns3/log.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/node.h"
+#include "ns3/socket.h"
+#include "ns3/udp-socket.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/udp-socket-factory.h"
+#include "ns3/uinteger.h"
+#include "ns3/seq-ts-header.h"
+#include "state-estimation-aggregator.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("StateEstimationAggregator");
+NS_OBJECT_ENSURE_REGISTERED (StateEstimationAggregator);
+
+TypeId
+StateEstimationAggregator::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::StateEstimationAggregator")
+    .SetParent<Application> ()
+    .AddConstructor<StateEstimationAggregator> ()
+    .AddAttribute ("Local", "The Address on which to Bind the rx socket.",
+                   AddressValue (),
+                   MakeAddressAccessor (&StateEstimationAggregator::m_local),
+                   MakeAddressChecker ())
+    .AddAttribute ("Protocol", "The type id of the protocol to use for the rx socket, "
+                   "which must be ns3::UdpSocketFactory: the reports are not framed.",
+                   TypeIdValue (UdpSocketFactory::GetTypeId ()),
+                   MakeTypeIdAccessor (&StateEstimationAggregator::m_tid),
+                   MakeTypeIdChecker ())
+    .AddAttribute ("Meters",
+                   "Number of reports which complete a round. The value zero "
+                   "expects a report from every meter registered with AddMeter, "
+                   "and at least one meter must then be registered.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&StateEstimationAggregator::m_expected),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("RoundTimeout",
+                   "Time a round waits for its missing reports after its first "
+                   "report was received.",
+                   TimeValue (Seconds (1.0)),
+                   MakeTimeAccessor (&StateEstimationAggregator::m_roundTimeout),
+                   MakeTimeChecker ())
+    .AddTraceSource ("RoundComplete",
+                     "A round was closed: round, estimation latency, reports "
+                     "received, meters missing and duplicate reports dropped",
+                     MakeTraceSourceAccessor (&StateEstimationAggregator::m_roundTrace))
+  ;
+  return tid;
+}
+
+StateEstimationAggregator::StateEstimationAggregator ()
+  : m_registered (0),
+    m_closedAny (false),
+    m_lastClosed (0),
+    m_complete (0),
+    m_incomplete (0),
+    m_late (0),
+    m_duplicate (0),
+    m_malformed (0)
+{
+  NS_LOG_FUNCTION (this);
+  m_socket = 0;
+}
+
+StateEstimationAggregator::~StateEstimationAggregator ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+StateEstimationAggregator::AddMeter (Ipv4Address meter)
+{
+  NS_LOG_FUNCTION (this << meter);
+  if (m_meters.find (meter) == m_meters.end ())
+    {
+      m_registered++;
+    }
+  GetMeterIndex (meter);
+}
+
+std::vector<int64_t>
+StateEstimationAggregator::GetEstimate (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_estimate;
+}
+
+uint32_t
+StateEstimationAggregator::GetCompleteRounds (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_complete;
+}
+
+uint32_t
+StateEstimationAggregator::GetIncompleteRounds (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_incomplete;
+}
+
+uint32_t
+StateEstimationAggregator::GetLateReports (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_late;
+}
+
+uint32_t
+StateEstimationAggregator::GetDuplicateReports (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_duplicate;
+}
+
+uint32_t
+StateEstimationAggregator::GetMalformedReports (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_malformed;
+}
+
+void
+StateEstimationAggregator::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_socket = 0;
+  m_socketList.clear ();
+  m_rounds.clear ();
+
+  // chain up
+  Application::DoDispose ();
+}
+
+// Application Methods
+void
+StateEstimationAggregator::StartApplication ()    // Called at time specified by Start
+{
+  NS_LOG_FUNCTION (this);
+  if (GetExpected () == 0)
+    {
+      NS_FATAL_ERROR ("StateEstimationAggregator needs the Meters attribute or meters registered with AddMeter");
+    }
+  if (m_tid != UdpSocketFactory::GetTypeId ())
+    {
+      NS_FATAL_ERROR ("StateEstimationAggregator needs one report per packet: "
+                      << m_tid.GetName () << " is not ns3::UdpSocketFactory");
+    }
+  // Create the socket if not already
+  if (!m_socket)
+    {
+      m_socket = Socket::CreateSocket (GetNode (), m_tid);
+      m_socket->Bind (m_local);
+      m_socket->Listen ();
+      m_socket->ShutdownSend ();
+      if (addressUtils::IsMulticast (m_local))
+        {
+          Ptr<UdpSocket> udpSocket = DynamicCast<UdpSocket> (m_socket);
+          if (udpSocket)
+            {
+              // equivalent to setsockopt (MCAST_JOIN_GROUP)
+              udpSocket->MulticastJoinGroup (0, m_local);
+            }
+          else
+            {
+              NS_FATAL_ERROR ("Error: joining multicast on a non-UDP socket");
+            }
+        }
+    }
+
+  m_socket->SetRecvCallback (MakeCallback (&StateEstimationAggregator::HandleRead, this));
+  m_socket->SetAcceptCallback (
+    MakeNullCallback<bool, Ptr<Socket>, const Address &> (),
+    MakeCallback (&StateEstimationAggregator::HandleAccept, this));
+  m_socket->SetCloseCallbacks (
+    MakeCallback (&StateEstimationAggregator::HandlePeerClose, this),
+    MakeCallback (&StateEstimationAggregator::HandlePeerError, this));
+}
+
+void
+StateEstimationAggregator::StopApplication ()     // Called at time specified by Stop
+{
+  NS_LOG_FUNCTION (this);
+  while (!m_socketList.empty ()) //these are accepted sockets, close them
+    {
+      Ptr<Socket> acceptedSocket = m_socketList.front ();
+      m_socketList.pop_front ();
+      acceptedSocket->Close ();
+    }
+  if (m_socket)
+    {
+      m_socket->Close ();
+      m_socket->SetRecvCallback (MakeNullCallback<void, Ptr<Socket> > ());
+    }
+  // Report the rounds still waiting for their missing meters
+  while (!m_rounds.empty ())
+    {
+      CloseRound (m_rounds.begin ()->first);
+    }
+}
+
+void
+StateEstimationAggregator::HandleRead (Ptr<Socket> socket)
+{
+  NS_LOG_FUNCTION (this << socket);
+  Ptr<Packet> packet;
+  Address from;
+
+  while ((packet = socket->RecvFrom (from)))
+    {
+      if (packet->GetSize () == 0)
+        { //EOF
+          break;
+        }
+      Receive (packet, from);
+    }
+}
+
+uint32_t
+StateEstimationAggregator::GetMeterIndex (Ipv4Address meter)
+{
+  std::map<Ipv4Address, uint32_t>::const_iterator i = m_meters.find (meter);
+  if (i != m_meters.end ())
+    {
+      return i->second;
+    }
+  uint32_t index = m_meters.size ();
+  m_meters[meter] = index;
+  return index;
+}
+
+uint32_t
+StateEstimationAggregator::GetExpected (void) const
+{
+  return m_expected > 0 ? m_expected : m_registered;
+}
+
+void
+StateEstimationAggregator::Receive (Ptr<const Packet> packet, const Address &from)
+{
+  NS_LOG_FUNCTION (this << packet << from);
+
+  // Report layout written by OnOffSGO after the SeqTsHeader:
+  // | plainText length (2) | signature length (2) | plainText | signature | padding |
+  // where plainText is the readings of the meter followed by its Tx timestamp.
+  SeqTsHeader seqTs;
+  uint32_t offset = seqTs.GetSerializedSize ();
+  uint32_t size = packet->GetSize ();
+  uint16_t plainTextLength = 0;
+  if (size >= offset + 2 * sizeof (uint16_t))
+    {
+      if (m_rxBuffer.size () < size)
+        {
+          m_rxBuffer.resize (size);
+        }
+      packet->CopyData (&m_rxBuffer[0], size);
+      memcpy (&plainTextLength, &m_rxBuffer[offset], sizeof (uint16_t));
+    }
+  if (!InetSocketAddress::IsMatchingType (from)
+      || plainTextLength < sizeof (uint64_t)
+      || (plainTextLength - sizeof (uint64_t)) % sizeof (int32_t) != 0
+      || offset + 2 * sizeof (uint16_t) + plainTextLength > size)
+    {
+      NS_LOG_WARN ("Malformed report " << packet->GetUid () << " from " << from);
+      m_malformed++;
+      return;
+    }
+  packet->PeekHeader (seqTs);
+  uint32_t round = seqTs.GetSeq ();
+  if (m_closedAny && round <= m_lastClosed && m_rounds.find (round) == m_rounds.end ())
+    {
+      NS_LOG_LOGIC ("Report " << packet->GetUid () << " of closed round " << round);
+      m_late++;
+      return;
+    }
+
+  const uint8_t *plainText = &m_rxBuffer[offset + 2 * sizeof (uint16_t)];
+  uint32_t count = (plainTextLength - sizeof (uint64_t)) / sizeof (int32_t);
+  uint64_t txTime;
+  memcpy (&txTime, plainText + count * sizeof (int32_t), sizeof (uint64_t));
+  // The readings are not aligned in the payload, copy them once into an
+  // aligned buffer so that the accumulation loop below can be vectorised
+  if (m_readings.size () < count)
+    {
+      m_readings.resize (count);
+    }
+  if (count > 0)
+    {
+      memcpy (&m_readings[0], plainText, count * sizeof (int32_t));
+    }
+
+  uint32_t meter = GetMeterIndex (InetSocketAddress::ConvertFrom (from).GetIpv4 ());
+  Round &r = m_rounds[round];
+  if (r.reports == 0)
+    {
+      r.firstTx = TimeStep (txTime);
+      r.timeout = Simulator::Schedule (m_roundTimeout, &StateEstimationAggregator::CloseRound, this, round);
+    }
+  if (r.received.size () < m_meters.size ())
+    {
+      r.received.resize (m_meters.size (), false);
+    }
+  if (r.received[meter])
+    {
+      NS_LOG_LOGIC ("Duplicate report of meter " << meter << " in round " << round);
+      r.duplicates++;
+      m_duplicate++;
+      return;
+    }
+  r.received[meter] = true;
+  r.reports++;
+  r.firstTx = std::min (r.firstTx, TimeStep (txTime));
+
+  if (r.sums.size () < count)
+    {
+      r.sums.resize (count, 0);
+    }
+  int64_t *sums = r.sums.empty () ? 0 : &r.sums[0];
+  const int32_t *readings = m_readings.empty () ? 0 : &m_readings[0];
+  for (uint32_t i = 0; i < count; i++)
+    {
+      sums[i] += readings[i];
+    }
+
+  NS_LOG_LOGIC ("Round " << round << ": " << r.reports << " reports");
+  if (r.reports >= GetExpected ())
+    {
+      CloseRound (round);
+    }
+}
+
+void
+StateEstimationAggregator::CloseRound (uint32_t round)
+{
+  NS_LOG_FUNCTION (this << round);
+  std::map<uint32_t, Round>::iterator i = m_rounds.find (round);
+  NS_ASSERT (i != m_rounds.end ());
+  Round &r = i->second;
+  Simulator::Cancel (r.timeout);
+
+  uint32_t expected = GetExpected ();
+  uint32_t missing = r.reports < expected ? expected - r.reports : 0;
+  Time latency = Simulator::Now () - r.firstTx;
+  if (missing == 0)
+    {
+      m_complete++;
+    }
+  else
+    {
+      m_incomplete++;
+      NS_LOG_INFO ("Round " << round << " closed with " << missing << " missing meters");
+    }
+  NS_LOG_INFO ("Round " << round << " estimated in " << latency.GetSeconds () << "s, "
+               << r.duplicates << " duplicate reports dropped");
+
+  m_estimate.swap (r.sums);
+  if (!m_closedAny || round > m_lastClosed)
+    {
+      m_lastClosed = round;
+    }
+  m_closedAny = true;
+  uint32_t reports = r.reports;
+  uint32_t duplicates = r.duplicates;
+  m_rounds.erase (i);
+  m_roundTrace (round, latency, reports, missing, duplicates);
+}
+
+void
+StateEstimationAggregator::HandlePeerClose (Ptr<Socket> socket)
+{
+  NS_LOG_FUNCTION (this << socket);
+}
+
+void
+StateEstimationAggregator::HandlePeerError (Ptr<Socket> socket)
+{
+  NS_LOG_FUNCTION (this << socket);
+}
+
+void
+StateEstimationAggregator::HandleAccept (Ptr<Socket> s, const Address& from)
+{
+  NS_LOG_FUNCTION (this << s << from);
+  s->SetRecvCallback (MakeCallback (&StateEstimationAggregator::HandleRead, this));
+  m_socketList.push_back (s);
+}
+
+} // Namespace ns3
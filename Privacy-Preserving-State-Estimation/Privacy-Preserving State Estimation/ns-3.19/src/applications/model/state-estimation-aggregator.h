@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef STATE_ESTIMATION_AGGREGATOR_H
+#define STATE_ESTIMATION_AGGREGATOR_H
+
+#include "ns3/application.h"
+#include "ns3/event-id.h"
+#include "ns3/ptr.h"
+#include "ns3/traced-callback.h"
+#include "ns3/address.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/nstime.h"
+
+#include <list>
+#include <map>
+#include <vector>
+
+namespace ns3 {
+
+class Socket;
+class Packet;
+
+/**
+ * \ingroup applications
+ *
+ * \brief Gateway side of the privacy preserving state estimation.
+ *
+ * Every meter report sent by OnOffSGO carries the obfuscated readings of
+ * the meter, and the SeqTsHeader sequence number of the report is the
+ * measurement round it belongs to. The aggregator decodes the readings
+ * and adds them to the running sum of their round, so that the masks of
+ * the meters cancel out and only the aggregate is learnt.
+ *
+ * The sums of a round are kept in one contiguous array of int64_t which
+ * the decoded int32_t readings are added to element-wise; the loop has no
+ * dependency between elements and is vectorised by the compiler.
+ *
+ * A round is complete once a report was received from each of the
+ * expected meters. The number of expected meters is never inferred from
+ * the reports: it is either set with the Meters attribute or given by the
+ * meters registered with AddMeter before the application starts. If
+ * RoundTimeout expires first, the round is closed anyway and the missing
+ * meters are reported. Either way the RoundComplete trace source fires
+ * with the estimation latency of the round, measured from the earliest
+ * transmission time of its reports. Reports for a round that was already
+ * closed are counted as late and dropped, and a second report of a meter
+ * in the same round is counted as a duplicate and dropped.
+ *
+ * Each received packet is expected to carry exactly one report, and
+ * anything else is counted as malformed. A stream socket merges and
+ * splits the reports, which are not framed, so the Protocol must be
+ * ns3::UdpSocketFactory: the application aborts at its start otherwise.
+ */
+class StateEstimationAggregator : public Application
+{
+public:
+  static TypeId GetTypeId (void);
+  StateEstimationAggregator ();
+
+  virtual ~StateEstimationAggregator ();
+
+  /**
+   * \param meter the address the reports of a meter are received from
+   *
+   * Register a meter the aggregator expects a report from in every round.
+   * Unless the Meters attribute is set, the registered meters are the
+   * number of reports which complete a round. The reports of senders
+   * which are not registered are still accumulated.
+   */
+  void AddMeter (Ipv4Address meter);
+
+  /**
+   * \return the sums of the last closed round
+   */
+  std::vector<int64_t> GetEstimate (void) const;
+
+  /**
+   * \return the number of rounds closed with all their reports
+   */
+  uint32_t GetCompleteRounds (void) const;
+
+  /**
+   * \return the number of rounds closed by the timeout
+   */
+  uint32_t GetIncompleteRounds (void) const;
+
+  /**
+   * \return the number of reports received after their round was closed
+   */
+  uint32_t GetLateReports (void) const;
+
+  /**
+   * \return the number of reports received twice from a meter in a round
+   */
+  uint32_t GetDuplicateReports (void) const;
+
+  /**
+   * \return the number of reports which could not be decoded
+   */
+  uint32_t GetMalformedReports (void) const;
+
+protected:
+  virtual void DoDispose (void);
+private:
+  // inherited from Application base class.
+  virtual void StartApplication (void);    // Called at time specified by Start
+  virtual void StopApplication (void);     // Called at time specified by Stop
+
+  void HandleRead (Ptr<Socket> socket);
+  void HandleAccept (Ptr<Socket> socket, const Address& from);
+  void HandlePeerClose (Ptr<Socket> socket);
+  void HandlePeerError (Ptr<Socket> socket);
+
+  uint32_t GetMeterIndex (Ipv4Address meter);
+  uint32_t GetExpected (void) const;
+  void Receive (Ptr<const Packet> packet, const Address &from);
+  void CloseRound (uint32_t round);
+
+  struct Round
+  {
+    Round () : reports (0), duplicates (0) {}
+    std::vector<int64_t> sums;  // Element-wise sum of the readings
+    std::vector<bool> received; // Meters which reported, by index
+    uint32_t reports;           // Number of reports accumulated
+    uint32_t duplicates;        // Number of duplicate reports dropped
+    Time firstTx;               // Earliest transmission time of a report
+    EventId timeout;            // Closes the round if it does not complete
+  };
+
+  // In the case of TCP, each socket accept returns a new socket, so the
+  // listening socket is stored seperately from the accepted sockets
+  Ptr<Socket>     m_socket;       // Listening socket
+  std::list<Ptr<Socket> > m_socketList; //the accepted sockets
+
+  Address         m_local;        // Local address to bind to
+  TypeId          m_tid;          // Protocol TypeId
+  uint32_t        m_expected;     // Reports per round, zero for the registered meters
+  Time            m_roundTimeout; // Time a round waits for missing reports
+
+  std::map<Ipv4Address, uint32_t> m_meters; // Meter address to index
+  uint32_t        m_registered;   // Meters registered with AddMeter
+  std::map<uint32_t, Round> m_rounds;       // Open rounds
+  bool            m_closedAny;    // True once a round was closed
+  uint32_t        m_lastClosed;   // Highest closed round
+  std::vector<int64_t> m_estimate; // Sums of the last closed round
+  std::vector<uint8_t> m_rxBuffer; // Reused payload buffer
+  std::vector<int32_t> m_readings; // Reused aligned copy of the readings
+
+  uint32_t        m_complete;     // Rounds closed with every report
+  uint32_t        m_incomplete;   // Rounds closed by the timeout
+  uint32_t        m_late;         // Reports of already closed rounds
+  uint32_t        m_duplicate;    // Second reports of a meter in a round
+  uint32_t        m_malformed;    // Reports which could not be decoded
+
+  /// round, estimation latency, reports received, meters missing,
+  /// duplicate reports dropped
+  TracedCallback<uint32_t, Time, uint32_t, uint32_t, uint32_t> m_roundTrace;
+};
+
+} // namespace ns3
+
+#endif /* STATE_ESTIMATION_AGGREGATOR_H */
@@ -0,0 +1,335 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstring>
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/socket.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simple-channel.h"
+#include "ns3/seq-ts-header.h"
+#include "ns3/meter-signer.h"
+#include "ns3/crypto-cost-model.h"
+#include "ns3/packet-sink-ts.h"
+#include "ns3/packet-sink-helper-ts.h"
+
+using namespace ns3;
+
+/**
+ * Test that a report signed by a MeterSigner is accepted by the
+ * MeterVerifier of its public key, and that a tampered report, a
+ * tampered signature or the key of another meter are rejected.
+ */
+class MeterSignerRoundTripTestCase : public TestCase
+{
+public:
+  MeterSignerRoundTripTestCase ();
+  virtual ~MeterSignerRoundTripTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+MeterSignerRoundTripTestCase::MeterSignerRoundTripTestCase ()
+  : TestCase ("Check that a signed report verifies and a tampered one does not")
+{
+}
+
+MeterSignerRoundTripTestCase::~MeterSignerRoundTripTestCase ()
+{
+}
+
+void
+MeterSignerRoundTripTestCase::DoRun (void)
+{
+  MeterSigner signer;
+  NS_TEST_ASSERT_MSG_EQ (signer.IsInitialized (), false, "Signer initialized without a key");
+  signer.GenerateKey (CryptoCostModel::SECP160R1);
+  signer.Precompute (16);
+  NS_TEST_ASSERT_MSG_EQ (signer.IsInitialized (), true, "Signer not initialized by its key");
+
+  std::vector<uint8_t> message;
+  for (uint8_t i = 0; i < 20; i++)
+    {
+      message.push_back (i * 7);
+    }
+  std::vector<uint8_t> signature (signer.GetSignatureLength ());
+  uint32_t length = signer.Sign (&message[0], message.size (), &signature[0]);
+  NS_TEST_ASSERT_MSG_EQ ((length > 0 && length <= signature.size ()), true, "Wrong signature length");
+
+  MeterVerifier verifier (signer.GetPublicKey (), 16);
+  NS_TEST_ASSERT_MSG_EQ (verifier.Verify (&message[0], message.size (), &signature[0], length), true,
+                         "Signature of the meter rejected");
+  // The same key without precomputation
+  MeterVerifier plain (signer.GetPublicKey (), 0);
+  NS_TEST_ASSERT_MSG_EQ (plain.Verify (&message[0], message.size (), &signature[0], length), true,
+                         "Signature rejected without precomputation");
+
+  std::vector<uint8_t> tampered = message;
+  tampered[5] ^= 0x01;
+  NS_TEST_ASSERT_MSG_EQ (verifier.Verify (&tampered[0], tampered.size (), &signature[0], length), false,
+                         "Tampered report accepted");
+  std::vector<uint8_t> badSignature = signature;
+  badSignature[length - 1] ^= 0x01;
+  NS_TEST_ASSERT_MSG_EQ (verifier.Verify (&message[0], message.size (), &badSignature[0], length), false,
+                         "Tampered signature accepted");
+
+  MeterSigner other;
+  other.GenerateKey (CryptoCostModel::SECP160R1);
+  MeterVerifier otherVerifier (other.GetPublicKey (), 0);
+  NS_TEST_ASSERT_MSG_EQ (otherVerifier.Verify (&message[0], message.size (), &signature[0], length), false,
+                         "Report accepted with the key of another meter");
+}
+
+/**
+ * Test that PacketSinkTs verifies the reports of a meter with the key
+ * registered for it, one by one or as one batch on the crypto CPU of the
+ * gateway, and that the reports of a batch still pending when the sink
+ * stops are verified at once.
+ */
+class PacketSinkTsVerifyTestCase : public TestCase
+{
+public:
+  /**
+   * \param batch true to verify the reports in batches on a CryptoCostModel
+   */
+  PacketSinkTsVerifyTestCase (bool batch);
+  virtual ~PacketSinkTsVerifyTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void Send (Ptr<Socket> socket, uint32_t round, bool tamper);
+  void Verified (Ptr<const Packet> packet, const Address &from, bool valid);
+
+  bool m_batch;
+  MeterSigner m_signer;
+  std::vector<Time> m_verifiedAt;
+  std::vector<bool> m_valid;
+};
+
+PacketSinkTsVerifyTestCase::PacketSinkTsVerifyTestCase (bool batch)
+  : TestCase (batch ? "Check the batched verification of the reports received by PacketSinkTs"
+              : "Check the verification of the reports received by PacketSinkTs"),
+    m_batch (batch)
+{
+}
+
+PacketSinkTsVerifyTestCase::~PacketSinkTsVerifyTestCase ()
+{
+}
+
+void
+PacketSinkTsVerifyTestCase::Send (Ptr<Socket> socket, uint32_t round, bool tamper)
+{
+  // | plainText length (2) | signature length (2) | plainText | signature |
+  std::vector<uint8_t> plainText (3 * sizeof (int32_t) + sizeof (uint64_t), round);
+  std::vector<uint8_t> signature (m_signer.GetSignatureLength ());
+  uint16_t plainTextLength = plainText.size ();
+  uint16_t signatureLength = m_signer.Sign (&plainText[0], plainText.size (), &signature[0]);
+  if (tamper)
+    {
+      plainText[0] ^= 0x01;
+    }
+  std::vector<uint8_t> buffer (2 * sizeof (uint16_t) + plainTextLength + signatureLength);
+  memcpy (&buffer[0], &plainTextLength, sizeof (uint16_t));
+  memcpy (&buffer[sizeof (uint16_t)], &signatureLength, sizeof (uint16_t));
+  memcpy (&buffer[2 * sizeof (uint16_t)], &plainText[0], plainTextLength);
+  memcpy (&buffer[2 * sizeof (uint16_t) + plainTextLength], &signature[0], signatureLength);
+  Ptr<Packet> packet = Create<Packet> (&buffer[0], buffer.size ());
+  SeqTsHeader seqTs;
+  seqTs.SetSeq (round);
+  packet->AddHeader (seqTs);
+  socket->Send (packet);
+}
+
+void
+PacketSinkTsVerifyTestCase::Verified (Ptr<const Packet> packet, const Address &from, bool valid)
+{
+  m_verifiedAt.push_back (Simulator::Now ());
+  m_valid.push_back (valid);
+}
+
+void
+PacketSinkTsVerifyTestCase::DoRun (void)
+{
+  m_signer.GenerateKey (CryptoCostModel::SECP160R1);
+
+  NodeContainer n;
+  n.Create (2);
+  InternetStackHelper internet;
+  internet.Install (n);
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  NetDeviceContainer d;
+  for (uint32_t i = 0; i < n.GetN (); i++)
+    {
+      Ptr<SimpleNetDevice> dev = CreateObject<SimpleNetDevice> ();
+      dev->SetAddress (Mac48Address::Allocate ());
+      dev->SetChannel (channel);
+      n.Get (i)->AddDevice (dev);
+      d.Add (dev);
+    }
+  Ipv4AddressHelper ipv4;
+  ipv4.SetBase ("10.1.1.0", "255.255.255.0");
+  Ipv4InterfaceContainer i = ipv4.Assign (d);
+
+  if (m_batch)
+    {
+      Ptr<CryptoCostModel> costModel = CreateObject<CryptoCostModel> ();
+      costModel->SetAttribute ("VerifyLatency", TimeValue (MilliSeconds (100)));
+      costModel->SetAttribute ("BatchVerifyFactor", DoubleValue (0.5));
+      n.Get (0)->AggregateObject (costModel);
+    }
+
+  uint16_t port = 9126;
+  PacketSinkHelperTs helper ("ns3::UdpSocketFactory", InetSocketAddress (i.GetAddress (0), port));
+  helper.SetAttribute ("Verify", BooleanValue (true));
+  helper.SetAttribute ("VerifyInterval", TimeValue (m_batch ? Seconds (0.5) : Seconds (0)));
+  ApplicationContainer apps = helper.Install (n.Get (0));
+  apps.Start (Seconds (0.0));
+  apps.Stop (Seconds (3.2));
+  Ptr<PacketSinkTs> sink = DynamicCast<PacketSinkTs> (apps.Get (0));
+  sink->AddPublicKey (i.GetAddress (1), m_signer.GetPublicKey ());
+  sink->TraceConnectWithoutContext ("VerifyResult", MakeCallback (&PacketSinkTsVerifyTestCase::Verified, this));
+
+  Ptr<Socket> socket = Socket::CreateSocket (n.Get (1), TypeId::LookupByName ("ns3::UdpSocketFactory"));
+  socket->Bind ();
+  socket->Connect (InetSocketAddress (i.GetAddress (0), port));
+  Simulator::Schedule (Seconds (1.0), &PacketSinkTsVerifyTestCase::Send, this, socket, 0, false);
+  Simulator::Schedule (Seconds (1.1), &PacketSinkTsVerifyTestCase::Send, this, socket, 1, true);
+  Simulator::Schedule (Seconds (1.2), &PacketSinkTsVerifyTestCase::Send, this, socket, 2, false);
+  // Still waiting for its batch when the sink stops
+  Simulator::Schedule (Seconds (3.0), &PacketSinkTsVerifyTestCase::Send, this, socket, 3, false);
+
+  Simulator::Stop (Seconds (10.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (sink->GetVerified (), 3, "Wrong number of verified reports");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetVerificationFailures (), 1, "Wrong number of failed verifications");
+  NS_TEST_ASSERT_MSG_EQ (m_valid.size (), 4, "Wrong number of verifications");
+  NS_TEST_ASSERT_MSG_EQ (m_valid[0], true, "Valid report rejected");
+  NS_TEST_ASSERT_MSG_EQ (m_valid[1], false, "Tampered report accepted");
+  NS_TEST_ASSERT_MSG_EQ (m_valid[2], true, "Valid report rejected");
+  NS_TEST_ASSERT_MSG_EQ (m_valid[3], true, "Valid report rejected");
+  if (m_batch)
+    {
+      // The first three reports are one batch, reserved 0.5 s after the
+      // first of them: 100 ms for the first verification, 50 ms for each
+      // further one
+      for (uint32_t r = 0; r < 3; r++)
+        {
+          NS_TEST_ASSERT_MSG_EQ_TOL (m_verifiedAt[r].GetSeconds (), 1.7, 1e-6, "Report " << r << " not verified with its batch");
+        }
+      NS_TEST_ASSERT_MSG_EQ_TOL (m_verifiedAt[3].GetSeconds (), 3.2, 1e-6, "Pending report not verified when the sink stopped");
+    }
+  else
+    {
+      NS_TEST_ASSERT_MSG_EQ_TOL (m_verifiedAt[0].GetSeconds (), 1.0, 1e-6, "Report not verified on reception");
+      NS_TEST_ASSERT_MSG_EQ_TOL (m_verifiedAt[3].GetSeconds (), 3.0, 1e-6, "Report not verified on reception");
+    }
+}
+
+/**
+ * Test that the operations reserved on a CryptoCostModel are served one
+ * after the other, and that the crypto CPU is free again once they are
+ * done.
+ */
+class CryptoCostModelReserveTestCase : public TestCase
+{
+public:
+  CryptoCostModelReserveTestCase ();
+  virtual ~CryptoCostModelReserveTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void Reserve (CryptoCostModel::Operation operation, uint32_t count);
+
+  Ptr<CryptoCostModel> m_model;
+  std::vector<Time> m_delays;
+};
+
+CryptoCostModelReserveTestCase::CryptoCostModelReserveTestCase ()
+  : TestCase ("Check that the crypto operations of a node are queued")
+{
+}
+
+CryptoCostModelReserveTestCase::~CryptoCostModelReserveTestCase ()
+{
+}
+
+void
+CryptoCostModelReserveTestCase::Reserve (CryptoCostModel::Operation operation, uint32_t count)
+{
+  m_delays.push_back (m_model->Reserve (operation, count));
+}
+
+void
+CryptoCostModelReserveTestCase::DoRun (void)
+{
+  m_model = CreateObject<CryptoCostModel> ();
+  // The built-in figure of the default curve
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_model->GetLatency (CryptoCostModel::VERIFY).GetSeconds (), 0.011, 1e-9,
+                             "Wrong built-in verify latency");
+  m_model->SetAttribute ("SignLatency", TimeValue (MilliSeconds (10)));
+  m_model->SetAttribute ("VerifyLatency", TimeValue (MilliSeconds (100)));
+  m_model->SetAttribute ("BatchVerifyFactor", DoubleValue (0.25));
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_model->GetLatency (CryptoCostModel::SIGN).GetSeconds (), 0.01, 1e-9,
+                             "Sign latency not overridden");
+
+  // Two signatures and a batch of four verifications at once, then a
+  // signature while the batch is still running and one once it is done
+  Simulator::Schedule (Seconds (1.0), &CryptoCostModelReserveTestCase::Reserve, this, CryptoCostModel::SIGN, 1);
+  Simulator::Schedule (Seconds (1.0), &CryptoCostModelReserveTestCase::Reserve, this, CryptoCostModel::SIGN, 1);
+  Simulator::Schedule (Seconds (1.0), &CryptoCostModelReserveTestCase::Reserve, this, CryptoCostModel::VERIFY, 4);
+  Simulator::Schedule (Seconds (1.1), &CryptoCostModelReserveTestCase::Reserve, this, CryptoCostModel::SIGN, 1);
+  Simulator::Schedule (Seconds (2.0), &CryptoCostModelReserveTestCase::Reserve, this, CryptoCostModel::SIGN, 1);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_delays.size (), 5, "Wrong number of reservations");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_delays[0].GetSeconds (), 0.01, 1e-9, "First signature not started at once");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_delays[1].GetSeconds (), 0.02, 1e-9, "Second signature not queued");
+  // 100 ms for the first verification, 25 ms for each further one
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_delays[2].GetSeconds (), 0.195, 1e-9, "Batch not queued or not shared");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_delays[3].GetSeconds (), 0.105, 1e-9, "Signature not queued after the batch");
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_delays[4].GetSeconds (), 0.01, 1e-9, "Idle CPU not free again");
+  NS_TEST_ASSERT_MSG_EQ (m_model->GetOperations (CryptoCostModel::SIGN), 4, "Wrong number of signatures");
+  NS_TEST_ASSERT_MSG_EQ (m_model->GetOperations (CryptoCostModel::VERIFY), 4, "Wrong number of verifications");
+}
+
+class MeterCryptoTestSuite : public TestSuite
+{
+public:
+  MeterCryptoTestSuite ();
+};
+
+MeterCryptoTestSuite::MeterCryptoTestSuite ()
+  : TestSuite ("meter-crypto", UNIT)
+{
+  AddTestCase (new MeterSignerRoundTripTestCase, TestCase::QUICK);
+  AddTestCase (new PacketSinkTsVerifyTestCase (false), TestCase::QUICK);
+  AddTestCase (new PacketSinkTsVerifyTestCase (true), TestCase::QUICK);
+  AddTestCase (new CryptoCostModelReserveTestCase, TestCase::QUICK);
+}
+
+static MeterCryptoTestSuite meterCryptoTestSuite;
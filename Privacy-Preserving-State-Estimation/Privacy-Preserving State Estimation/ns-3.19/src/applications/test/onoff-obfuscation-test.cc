@@ -0,0 +1,191 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/uinteger.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/seq-ts-header.h"
+#include "ns3/obfuscation-vector.h"
+#include "ns3/onoff-helper-sgo.h"
+#include "ns3/onoff-helper-mlm.h"
+
+using namespace ns3;
+
+/**
+ * Test that the applications installed by one Install call of the meter
+ * helpers each send their own slice of the shared obfuscation values,
+ * and that the next Install call starts again at the configured offset.
+ * The applications given a std::vector all send the same values.
+ */
+
+class OnOffObfuscationSliceTestCase : public TestCase
+{
+public:
+  /**
+   * \param sgo true to test OnOffHelperSGO, false for OnOffHelperMLM
+   */
+  OnOffObfuscationSliceTestCase (bool sgo);
+  virtual ~OnOffObfuscationSliceTestCase ();
+
+private:
+  virtual void DoRun (void);
+  ApplicationContainer Install (NodeContainer c, Ptr<const ObfuscationVector> values);
+  ApplicationContainer Install (NodeContainer c, std::vector<int32_t> values);
+  void Tx (std::string context, Ptr<const Packet> packet);
+
+  bool m_sgo;
+  std::vector<std::vector<int32_t> > m_sent; // First values sent, by application
+};
+
+OnOffObfuscationSliceTestCase::OnOffObfuscationSliceTestCase (bool sgo)
+  : TestCase (sgo ? "Check the obfuscation values sent by the applications of OnOffHelperSGO"
+              : "Check the obfuscation values sent by the applications of OnOffHelperMLM"),
+    m_sgo (sgo)
+{
+}
+
+OnOffObfuscationSliceTestCase::~OnOffObfuscationSliceTestCase ()
+{
+}
+
+ApplicationContainer
+OnOffObfuscationSliceTestCase::Install (NodeContainer c, Ptr<const ObfuscationVector> values)
+{
+  Address remote = InetSocketAddress (Ipv4Address::GetLoopback (), 9);
+  if (m_sgo)
+    {
+      OnOffHelperSGO helper ("ns3::UdpSocketFactory", remote);
+      helper.SetAttribute ("FirstSent", TimeValue (Seconds (1.0)));
+      helper.SetObfuscationVector (values, 2, 3);
+      return helper.Install (c);
+    }
+  OnOffHelperMLM helper ("ns3::UdpSocketFactory", remote);
+  helper.SetAttribute ("FirstSent", TimeValue (Seconds (1.0)));
+  helper.SetObfuscationVector (values, 2, 3);
+  return helper.Install (c);
+}
+
+ApplicationContainer
+OnOffObfuscationSliceTestCase::Install (NodeContainer c, std::vector<int32_t> values)
+{
+  Address remote = InetSocketAddress (Ipv4Address::GetLoopback (), 9);
+  if (m_sgo)
+    {
+      OnOffHelperSGO helper ("ns3::UdpSocketFactory", remote);
+      helper.SetAttribute ("FirstSent", TimeValue (Seconds (1.0)));
+      helper.SetObfuscationVector (values);
+      return helper.Install (c);
+    }
+  OnOffHelperMLM helper ("ns3::UdpSocketFactory", remote);
+  helper.SetAttribute ("FirstSent", TimeValue (Seconds (1.0)));
+  helper.SetObfuscationVector (values);
+  return helper.Install (c);
+}
+
+void
+OnOffObfuscationSliceTestCase::Tx (std::string context, Ptr<const Packet> packet)
+{
+  uint32_t app;
+  std::istringstream (context) >> app;
+  if (!m_sent[app].empty ())
+    {
+      return;
+    }
+  Ptr<Packet> copy = packet->Copy ();
+  uint32_t offset = 0;
+  if (m_sgo)
+    {
+      // | SeqTsHeader | plainText length (2) | signature length (2) | readings |
+      SeqTsHeader seqTs;
+      copy->RemoveHeader (seqTs);
+      offset = 2 * sizeof (uint16_t);
+    }
+  std::vector<uint8_t> buffer (copy->GetSize ());
+  copy->CopyData (&buffer[0], buffer.size ());
+  for (uint32_t i = 0; i < 3 && offset + sizeof (int32_t) <= buffer.size (); i++)
+    {
+      int32_t value;
+      memcpy (&value, &buffer[offset], sizeof (int32_t));
+      m_sent[app].push_back (value);
+      offset += sizeof (int32_t);
+    }
+}
+
+void
+OnOffObfuscationSliceTestCase::DoRun (void)
+{
+  std::vector<int32_t> v;
+  for (int32_t i = 0; i < 10; i++)
+    {
+      v.push_back (100 + i);
+    }
+  Ptr<const ObfuscationVector> values = Create<ObfuscationVector> (v);
+
+  NodeContainer meters;
+  meters.Create (5);
+  InternetStackHelper internet;
+  internet.Install (meters);
+
+  // Two nodes installed together, then the third one on its own
+  ApplicationContainer apps = Install (NodeContainer (meters.Get (0), meters.Get (1)), values);
+  apps.Add (Install (NodeContainer (meters.Get (2)), values));
+  // Then two nodes sharing all the values
+  apps.Add (Install (NodeContainer (meters.Get (3), meters.Get (4)), v));
+  m_sent.resize (apps.GetN ());
+  for (uint32_t i = 0; i < apps.GetN (); i++)
+    {
+      std::ostringstream oss;
+      oss << i;
+      apps.Get (i)->TraceConnect ("Tx", oss.str (), MakeCallback (&OnOffObfuscationSliceTestCase::Tx, this));
+    }
+  apps.Start (Seconds (0.0));
+  apps.Stop (Seconds (1.5));
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  uint32_t first[] = { 2, 5, 2, 0, 0 };
+  for (uint32_t app = 0; app < apps.GetN (); app++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (m_sent[app].size (), 3, "Application " << app << " sent no report");
+      for (uint32_t i = 0; i < m_sent[app].size (); i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (m_sent[app][i], v[first[app] + i],
+                                 "Wrong value " << i << " sent by application " << app);
+        }
+    }
+}
+
+class OnOffObfuscationTestSuite : public TestSuite
+{
+public:
+  OnOffObfuscationTestSuite ();
+};
+
+OnOffObfuscationTestSuite::OnOffObfuscationTestSuite ()
+  : TestSuite ("onoff-obfuscation", UNIT)
+{
+  AddTestCase (new OnOffObfuscationSliceTestCase (true), TestCase::QUICK);
+  AddTestCase (new OnOffObfuscationSliceTestCase (false), TestCase::QUICK);
+}
+
+static OnOffObfuscationTestSuite onOffObfuscationTestSuite;
@@ -0,0 +1,374 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstring>
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/socket.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+#include "ns3/ipv4.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simple-channel.h"
+#include "ns3/seq-ts-header.h"
+#include "ns3/state-estimation-aggregator.h"
+#include "ns3/state-estimation-aggregator-helper.h"
+
+using namespace ns3;
+
+/**
+ * Base of the aggregator tests: a gateway running a
+ * StateEstimationAggregator and a few meters on one SimpleChannel, the
+ * meters sending hand-made reports through UDP sockets.
+ */
+class StateEstimationAggregatorTestCase : public TestCase
+{
+public:
+  StateEstimationAggregatorTestCase (std::string name);
+  virtual ~StateEstimationAggregatorTestCase ();
+
+protected:
+  /**
+   * Create the gateway and the meters, and register the meters with the
+   * aggregator.
+   */
+  void Setup (uint32_t meters, Time roundTimeout);
+  /**
+   * Schedule a report in the layout written by OnOffSGO.
+   */
+  void SendReport (Time at, uint32_t meter, uint32_t round, std::vector<int32_t> readings);
+  /**
+   * Schedule an arbitrary payload.
+   */
+  void SendRaw (Time at, uint32_t meter, Ptr<Packet> packet);
+
+  struct Closed
+  {
+    uint32_t round;
+    Time at;
+    Time latency;
+    uint32_t reports;
+    uint32_t missing;
+    uint32_t duplicates;
+    std::vector<int64_t> estimate;
+  };
+
+  Ptr<StateEstimationAggregator> m_aggregator;
+  std::vector<Closed> m_closed;
+
+private:
+  void Send (Ptr<Socket> socket, uint32_t round, std::vector<int32_t> readings);
+  void RoundComplete (uint32_t round, Time latency, uint32_t reports, uint32_t missing, uint32_t duplicates);
+
+  std::vector<Ptr<Socket> > m_sockets;
+};
+
+StateEstimationAggregatorTestCase::StateEstimationAggregatorTestCase (std::string name)
+  : TestCase (name)
+{
+}
+
+StateEstimationAggregatorTestCase::~StateEstimationAggregatorTestCase ()
+{
+}
+
+void
+StateEstimationAggregatorTestCase::Setup (uint32_t meters, Time roundTimeout)
+{
+  NodeContainer n;
+  n.Create (meters + 1);
+  InternetStackHelper internet;
+  internet.Install (n);
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  NetDeviceContainer d;
+  for (uint32_t i = 0; i < n.GetN (); i++)
+    {
+      Ptr<SimpleNetDevice> dev = CreateObject<SimpleNetDevice> ();
+      dev->SetAddress (Mac48Address::Allocate ());
+      dev->SetChannel (channel);
+      n.Get (i)->AddDevice (dev);
+      // Without ARP a unicast is broadcast on the channel: keep the other
+      // meters from forwarding it again
+      n.Get (i)->GetObject<Ipv4> ()->SetAttribute ("IpForward", BooleanValue (false));
+      d.Add (dev);
+    }
+  Ipv4AddressHelper ipv4;
+  ipv4.SetBase ("10.1.1.0", "255.255.255.0");
+  Ipv4InterfaceContainer i = ipv4.Assign (d);
+
+  uint16_t port = 9125;
+  StateEstimationAggregatorHelper helper ("ns3::UdpSocketFactory", InetSocketAddress (i.GetAddress (0), port));
+  helper.SetAttribute ("RoundTimeout", TimeValue (roundTimeout));
+  ApplicationContainer apps = helper.Install (n.Get (0));
+  apps.Start (Seconds (0.0));
+  apps.Stop (Seconds (100.0));
+  m_aggregator = DynamicCast<StateEstimationAggregator> (apps.Get (0));
+  m_aggregator->TraceConnectWithoutContext ("RoundComplete",
+                                            MakeCallback (&StateEstimationAggregatorTestCase::RoundComplete, this));
+
+  for (uint32_t meter = 1; meter <= meters; meter++)
+    {
+      m_aggregator->AddMeter (i.GetAddress (meter));
+      Ptr<Socket> socket = Socket::CreateSocket (n.Get (meter), TypeId::LookupByName ("ns3::UdpSocketFactory"));
+      socket->Bind ();
+      socket->Connect (InetSocketAddress (i.GetAddress (0), port));
+      m_sockets.push_back (socket);
+    }
+}
+
+void
+StateEstimationAggregatorTestCase::SendReport (Time at, uint32_t meter, uint32_t round, std::vector<int32_t> readings)
+{
+  Simulator::Schedule (at, &StateEstimationAggregatorTestCase::Send, this, m_sockets[meter], round, readings);
+}
+
+void
+StateEstimationAggregatorTestCase::SendRaw (Time at, uint32_t meter, Ptr<Packet> packet)
+{
+  int (Socket::*send) (Ptr<Packet>) = &Socket::Send;
+  Simulator::Schedule (at, send, m_sockets[meter], packet);
+}
+
+void
+StateEstimationAggregatorTestCase::Send (Ptr<Socket> socket, uint32_t round, std::vector<int32_t> readings)
+{
+  // | plainText length (2) | signature length (2) | readings | Tx time (8) |
+  uint16_t plainTextLength = readings.size () * sizeof (int32_t) + sizeof (uint64_t);
+  uint16_t signatureLength = 0;
+  uint64_t txTime = Simulator::Now ().GetTimeStep ();
+  std::vector<uint8_t> buffer (2 * sizeof (uint16_t) + plainTextLength);
+  memcpy (&buffer[0], &plainTextLength, sizeof (uint16_t));
+  memcpy (&buffer[sizeof (uint16_t)], &signatureLength, sizeof (uint16_t));
+  if (!readings.empty ())
+    {
+      memcpy (&buffer[2 * sizeof (uint16_t)], &readings[0], readings.size () * sizeof (int32_t));
+    }
+  memcpy (&buffer[buffer.size () - sizeof (uint64_t)], &txTime, sizeof (uint64_t));
+  Ptr<Packet> packet = Create<Packet> (&buffer[0], buffer.size ());
+  SeqTsHeader seqTs;
+  seqTs.SetSeq (round);
+  packet->AddHeader (seqTs);
+  socket->Send (packet);
+}
+
+void
+StateEstimationAggregatorTestCase::RoundComplete (uint32_t round, Time latency, uint32_t reports, uint32_t missing, uint32_t duplicates)
+{
+  Closed closed;
+  closed.round = round;
+  closed.at = Simulator::Now ();
+  closed.latency = latency;
+  closed.reports = reports;
+  closed.missing = missing;
+  closed.duplicates = duplicates;
+  closed.estimate = m_aggregator->GetEstimate ();
+  m_closed.push_back (closed);
+}
+
+static std::vector<int32_t>
+Readings (int32_t a, int32_t b, int32_t c)
+{
+  std::vector<int32_t> readings;
+  readings.push_back (a);
+  readings.push_back (b);
+  readings.push_back (c);
+  return readings;
+}
+
+/**
+ * Test that a round closes as soon as every meter reported, with the
+ * element-wise sums of the readings.
+ */
+class StateEstimationAggregatorCompleteTestCase : public StateEstimationAggregatorTestCase
+{
+public:
+  StateEstimationAggregatorCompleteTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+StateEstimationAggregatorCompleteTestCase::StateEstimationAggregatorCompleteTestCase ()
+  : StateEstimationAggregatorTestCase ("Check the sums and the latency of a round with all its reports")
+{
+}
+
+void
+StateEstimationAggregatorCompleteTestCase::DoRun (void)
+{
+  Setup (3, Seconds (5.0));
+  // The masks cancel out, and the sums do not overflow at 32 bits
+  SendReport (Seconds (1.0), 0, 0, Readings (17, -20, 2000000000));
+  SendReport (Seconds (1.1), 1, 0, Readings (-12, 25, 2000000000));
+  SendReport (Seconds (1.2), 2, 0, Readings (-5, -5, 2000000000));
+  SendReport (Seconds (2.0), 2, 1, Readings (1, 2, 3));
+  SendReport (Seconds (2.1), 0, 1, Readings (10, 20, 30));
+  SendReport (Seconds (2.2), 1, 1, Readings (100, 200, 300));
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_aggregator->GetCompleteRounds (), 2, "Wrong number of complete rounds");
+  NS_TEST_ASSERT_MSG_EQ (m_aggregator->GetIncompleteRounds (), 0, "Wrong number of incomplete rounds");
+  NS_TEST_ASSERT_MSG_EQ (m_closed.size (), 2, "Wrong number of closed rounds");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].round, 0, "Wrong first round");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].reports, 3, "Wrong number of reports");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].missing, 0, "Wrong number of missing meters");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].duplicates, 0, "Wrong number of duplicate reports");
+  // Closed on the last report, not on the timeout
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].at, Seconds (1.2), "Round not closed on its last report");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].latency, Seconds (1.2) - Seconds (1.0), "Latency not measured from the first report");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].estimate.size (), 3, "Wrong number of sums");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].estimate[0], 0, "Wrong first sum");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].estimate[1], 0, "Wrong second sum");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].estimate[2], 6000000000LL, "Wrong third sum");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[1].round, 1, "Wrong second round");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[1].at, Seconds (2.2), "Second round not closed on its last report");
+
+  std::vector<int64_t> estimate = m_aggregator->GetEstimate ();
+  NS_TEST_ASSERT_MSG_EQ (estimate.size (), 3, "Wrong number of sums");
+  NS_TEST_ASSERT_MSG_EQ (estimate[0], 111, "Wrong first sum");
+  NS_TEST_ASSERT_MSG_EQ (estimate[1], 222, "Wrong second sum");
+  NS_TEST_ASSERT_MSG_EQ (estimate[2], 333, "Wrong third sum");
+}
+
+/**
+ * Test that a round missing a meter is closed by the timeout with the
+ * sums of the reports it received.
+ */
+class StateEstimationAggregatorTimeoutTestCase : public StateEstimationAggregatorTestCase
+{
+public:
+  StateEstimationAggregatorTimeoutTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+StateEstimationAggregatorTimeoutTestCase::StateEstimationAggregatorTimeoutTestCase ()
+  : StateEstimationAggregatorTestCase ("Check that a round missing a meter is closed by the timeout")
+{
+}
+
+void
+StateEstimationAggregatorTimeoutTestCase::DoRun (void)
+{
+  Setup (3, Seconds (1.0));
+  SendReport (Seconds (1.0), 0, 0, Readings (17, -20, 2000000000));
+  SendReport (Seconds (1.5), 2, 0, Readings (-5, -5, 2000000000));
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_aggregator->GetCompleteRounds (), 0, "Wrong number of complete rounds");
+  NS_TEST_ASSERT_MSG_EQ (m_aggregator->GetIncompleteRounds (), 1, "Wrong number of incomplete rounds");
+  NS_TEST_ASSERT_MSG_EQ (m_closed.size (), 1, "Wrong number of closed rounds");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].reports, 2, "Wrong number of reports");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].missing, 1, "Wrong number of missing meters");
+  // The timeout runs from the first report of the round
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].at, Seconds (2.0), "Round not closed by its timeout");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].latency, Seconds (1.0), "Wrong latency");
+
+  std::vector<int64_t> estimate = m_aggregator->GetEstimate ();
+  NS_TEST_ASSERT_MSG_EQ (estimate.size (), 3, "Wrong number of sums");
+  NS_TEST_ASSERT_MSG_EQ (estimate[0], 12, "Wrong first sum");
+  NS_TEST_ASSERT_MSG_EQ (estimate[1], -25, "Wrong second sum");
+  NS_TEST_ASSERT_MSG_EQ (estimate[2], 4000000000LL, "Wrong third sum");
+}
+
+/**
+ * Test that duplicate, late and malformed reports are not accumulated.
+ */
+class StateEstimationAggregatorDropTestCase : public StateEstimationAggregatorTestCase
+{
+public:
+  StateEstimationAggregatorDropTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+StateEstimationAggregatorDropTestCase::StateEstimationAggregatorDropTestCase ()
+  : StateEstimationAggregatorTestCase ("Check that duplicate, late and malformed reports are dropped")
+{
+}
+
+void
+StateEstimationAggregatorDropTestCase::DoRun (void)
+{
+  Setup (2, Seconds (1.0));
+  // A duplicate is neither added again nor completes the round
+  SendReport (Seconds (1.0), 0, 0, Readings (1, 2, 3));
+  SendReport (Seconds (1.1), 0, 0, Readings (1, 2, 3));
+  // Too short to hold the lengths of a report
+  SendRaw (Seconds (1.2), 1, Create<Packet> (3));
+  // Readings which are not a whole number of int32_t
+  uint8_t payload[16] = { 0 };
+  uint16_t plainTextLength = sizeof (uint64_t) + 3;
+  memcpy (payload, &plainTextLength, sizeof (uint16_t));
+  Ptr<Packet> odd = Create<Packet> (payload, sizeof (payload));
+  odd->AddHeader (SeqTsHeader ());
+  SendRaw (Seconds (1.3), 1, odd);
+  // A plain text longer than the packet
+  plainTextLength = 200;
+  memcpy (payload, &plainTextLength, sizeof (uint16_t));
+  Ptr<Packet> truncated = Create<Packet> (payload, sizeof (payload));
+  truncated->AddHeader (SeqTsHeader ());
+  SendRaw (Seconds (1.4), 1, truncated);
+  SendReport (Seconds (1.5), 1, 0, Readings (10, 20, 30));
+  // Round 0 was closed by the report above
+  SendReport (Seconds (1.6), 1, 0, Readings (1000, 1000, 1000));
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_aggregator->GetCompleteRounds (), 1, "Wrong number of complete rounds");
+  NS_TEST_ASSERT_MSG_EQ (m_aggregator->GetIncompleteRounds (), 0, "Wrong number of incomplete rounds");
+  NS_TEST_ASSERT_MSG_EQ (m_aggregator->GetMalformedReports (), 3, "Wrong number of malformed reports");
+  NS_TEST_ASSERT_MSG_EQ (m_aggregator->GetLateReports (), 1, "Wrong number of late reports");
+  NS_TEST_ASSERT_MSG_EQ (m_aggregator->GetDuplicateReports (), 1, "Wrong number of duplicate reports");
+  NS_TEST_ASSERT_MSG_EQ (m_closed.size (), 1, "Wrong number of closed rounds");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].at, Seconds (1.5), "Duplicate report completed the round");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].reports, 2, "Wrong number of reports");
+  NS_TEST_ASSERT_MSG_EQ (m_closed[0].duplicates, 1, "Duplicate report not in the round statistics");
+
+  std::vector<int64_t> estimate = m_aggregator->GetEstimate ();
+  NS_TEST_ASSERT_MSG_EQ (estimate.size (), 3, "Wrong number of sums");
+  NS_TEST_ASSERT_MSG_EQ (estimate[0], 11, "Wrong first sum");
+  NS_TEST_ASSERT_MSG_EQ (estimate[1], 22, "Wrong second sum");
+  NS_TEST_ASSERT_MSG_EQ (estimate[2], 33, "Wrong third sum");
+}
+
+class StateEstimationAggregatorTestSuite : public TestSuite
+{
+public:
+  StateEstimationAggregatorTestSuite ();
+};
+
+StateEstimationAggregatorTestSuite::StateEstimationAggregatorTestSuite ()
+  : TestSuite ("state-estimation-aggregator", UNIT)
+{
+  AddTestCase (new StateEstimationAggregatorCompleteTestCase, TestCase::QUICK);
+  AddTestCase (new StateEstimationAggregatorTimeoutTestCase, TestCase::QUICK);
+  AddTestCase (new StateEstimationAggregatorDropTestCase, TestCase::QUICK);
+}
+
+static StateEstimationAggregatorTestSuite stateEstimationAggregatorTestSuite;
@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Benchmark of the creation and release of events.
+//
+// A constant population of pending events is kept, every event
+// scheduling the next one, with the events made by MakeEvent for a
+// function, for a member function with two arguments and for a member
+// function with five arguments. The "heap" row schedules an EventImpl
+// subclass which allocates its objects from the global heap, the way
+// every event was allocated before EventImpl pooled its storage. The
+// fastest of several runs is reported for each kind of event.
+//
+// ./waf --run "bench-events --population=10000 --events=5000000"
+
+#include "ns3/core-module.h"
+
+#include <algorithm>
+#include <iostream>
+#include <new>
+
+using namespace ns3;
+
+static uint64_t g_remaining = 0;
+
+static void
+Function (void)
+{
+  if (g_remaining != 0)
+    {
+      g_remaining--;
+      Simulator::Schedule (NanoSeconds (g_remaining % 1000), &Function);
+    }
+}
+
+class Model
+{
+public:
+  void Member (uint32_t a, double b)
+  {
+    if (g_remaining != 0)
+      {
+        g_remaining--;
+        Simulator::Schedule (NanoSeconds (g_remaining % 1000), &Model::Member, this, a, b);
+      }
+  }
+  void Wide (uint32_t a, double b, uint64_t c, double d, Time e)
+  {
+    if (g_remaining != 0)
+      {
+        g_remaining--;
+        Simulator::Schedule (NanoSeconds (g_remaining % 1000), &Model::Wide, this, a, b, c, d, e);
+      }
+  }
+};
+
+class HeapEvent : public EventImpl
+{
+public:
+  static void *operator new (size_t size)
+  {
+    return ::operator new (size);
+  }
+  static void operator delete (void *p)
+  {
+    ::operator delete (p);
+  }
+protected:
+  virtual void Notify (void)
+  {
+    if (g_remaining != 0)
+      {
+        g_remaining--;
+        Simulator::Schedule (NanoSeconds (g_remaining % 1000), Ptr<EventImpl> (new HeapEvent (), false));
+      }
+  }
+};
+
+static int64_t
+Run (std::string kind, uint32_t population, uint64_t events)
+{
+  Model model;
+  g_remaining = events;
+  for (uint32_t i = 0; i < population; i++)
+    {
+      g_remaining--;
+      if (kind == "function")
+        {
+          Simulator::Schedule (NanoSeconds (i), &Function);
+        }
+      else if (kind == "member")
+        {
+          Simulator::Schedule (NanoSeconds (i), &Model::Member, &model, i, 1.0);
+        }
+      else if (kind == "wide")
+        {
+          Simulator::Schedule (NanoSeconds (i), &Model::Wide, &model, i, 1.0, 2, 3.0, Seconds (4.0));
+        }
+      else
+        {
+          Simulator::Schedule (NanoSeconds (i), Ptr<EventImpl> (new HeapEvent (), false));
+        }
+    }
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  Simulator::Destroy ();
+  return ms;
+}
+
+static void
+Report (std::string kind, uint32_t population, uint64_t events, uint32_t runs)
+{
+  int64_t ms = Run (kind, population, events);
+  for (uint32_t i = 1; i < runs; i++)
+    {
+      ms = std::min (ms, Run (kind, population, events));
+    }
+  std::cout << kind << "\t" << ms << "\t"
+            << (ms > 0 ? events * 1000.0 / ms : 0) << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t population = 10000;
+  uint64_t events = 5000000;
+  uint32_t runs = 3;
+
+  CommandLine cmd;
+  cmd.AddValue ("population", "Number of pending events", population);
+  cmd.AddValue ("events", "Number of events to run of each kind", events);
+  cmd.AddValue ("runs", "Number of runs of each kind", runs);
+  cmd.Parse (argc, argv);
+
+  std::cout << "event\tms\tevents/s" << std::endl;
+  Report ("function", population, events, runs);
+  Report ("member", population, events, runs);
+  Report ("wide", population, events, runs);
+  Report ("heap", population, events, runs);
+  return 0;
+}
@@ -0,0 +1,216 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Benchmark of the event schedulers on the event delays of a simulation.
+//
+// The delays are replayed with the hold model: a constant population of
+// pending events is kept, every event scheduling the next one with the
+// next delay of the trace. The trace is either a file of delays in time
+// steps, one per line, or the function log of DefaultSimulatorImpl, from
+// which the delays of Schedule, ScheduleWithContext and ScheduleNow are
+// taken. To capture the log of a script, run it from a build with logging
+// enabled:
+//
+// NS_LOG="DefaultSimulatorImpl=level_function" ./waf --run mesh 2> mesh.log
+// ./waf --run "bench-scheduler --trace=mesh.log"
+//
+// Without a trace, a synthetic one is generated which mixes bursts of
+// zero delays with short, periodic and long delays, roughly like the
+// MAC, beacon and application events of a mesh.
+
+#include "ns3/core-module.h"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("BenchScheduler");
+
+static std::vector<uint64_t> g_delays;
+static uint32_t g_next = 0;
+static uint64_t g_remaining = 0;
+
+static void
+Hold (void)
+{
+  if (g_remaining == 0)
+    {
+      return;
+    }
+  g_remaining--;
+  uint64_t delay = g_delays[g_next];
+  g_next = (g_next + 1) % g_delays.size ();
+  Simulator::Schedule (TimeStep (delay), &Hold);
+}
+
+// Delay of a log line of DefaultSimulatorImpl, false if it is not one
+static bool
+ParseLogLine (const std::string &line, uint64_t &delay)
+{
+  std::string::size_type pos;
+  uint32_t argument;
+  if ((pos = line.find ("DefaultSimulatorImpl:ScheduleNow(")) != std::string::npos)
+    {
+      delay = 0;
+      return true;
+    }
+  else if ((pos = line.find ("DefaultSimulatorImpl:ScheduleWithContext(")) != std::string::npos)
+    {
+      argument = 2;
+    }
+  else if ((pos = line.find ("DefaultSimulatorImpl:Schedule(")) != std::string::npos)
+    {
+      argument = 1;
+    }
+  else
+    {
+      return false;
+    }
+  pos = line.find ('(', pos);
+  for (uint32_t i = 0; i < argument; i++)
+    {
+      pos = line.find (',', pos + 1);
+      if (pos == std::string::npos)
+        {
+          return false;
+        }
+    }
+  std::istringstream iss (line.substr (pos + 1));
+  iss >> delay;
+  return !iss.fail ();
+}
+
+static bool
+LoadTrace (const std::string &fileName)
+{
+  std::ifstream input (fileName.c_str ());
+  if (!input.is_open ())
+    {
+      return false;
+    }
+  std::string line;
+  while (std::getline (input, line))
+    {
+      uint64_t delay;
+      if (ParseLogLine (line, delay))
+        {
+          g_delays.push_back (delay);
+          continue;
+        }
+      std::istringstream iss (line);
+      if (iss >> delay)
+        {
+          g_delays.push_back (delay);
+        }
+    }
+  return !g_delays.empty ();
+}
+
+static void
+GenerateTrace (uint32_t n)
+{
+  Ptr<UniformRandomVariable> uniform = CreateObject<UniformRandomVariable> ();
+  Ptr<ExponentialRandomVariable> shortDelay = CreateObject<ExponentialRandomVariable> ();
+  shortDelay->SetAttribute ("Mean", DoubleValue (Seconds (0.0005).GetTimeStep ()));
+  while (g_delays.size () < n)
+    {
+      double u = uniform->GetValue ();
+      if (u < 0.1)
+        {
+          // A burst of events at the same time, like a frame reaching
+          // every PHY of the channel
+          uint32_t burst = uniform->GetInteger (1, 50);
+          for (uint32_t i = 0; i < burst; i++)
+            {
+              g_delays.push_back (0);
+            }
+        }
+      else if (u < 0.7)
+        {
+          g_delays.push_back (shortDelay->GetValue ());
+        }
+      else if (u < 0.9)
+        {
+          g_delays.push_back (Seconds (0.1024).GetTimeStep ());
+        }
+      else
+        {
+          g_delays.push_back (Seconds (uniform->GetValue (0.5, 5.0)).GetTimeStep ());
+        }
+    }
+}
+
+static void
+Run (const std::string &scheduler, uint32_t population, uint64_t events)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (scheduler);
+  Simulator::SetScheduler (factory);
+
+  g_next = 0;
+  g_remaining = events;
+  for (uint32_t i = 0; i < population; i++)
+    {
+      Hold ();
+    }
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  Simulator::Destroy ();
+
+  std::cout << scheduler << "\t" << ms << "\t"
+            << (ms > 0 ? events * 1000.0 / ms : 0) << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string trace;
+  std::string schedulers = "ns3::MapScheduler,ns3::HeapScheduler,ns3::CalendarScheduler,ns3::LadderScheduler";
+  uint32_t population = 10000;
+  uint64_t events = 2000000;
+
+  CommandLine cmd;
+  cmd.AddValue ("trace", "File of delays or DefaultSimulatorImpl log to replay, empty for a synthetic trace", trace);
+  cmd.AddValue ("schedulers", "Comma separated list of the schedulers to compare", schedulers);
+  cmd.AddValue ("population", "Number of pending events", population);
+  cmd.AddValue ("events", "Number of events to run with each scheduler", events);
+  cmd.Parse (argc, argv);
+
+  if (trace.empty ())
+    {
+      GenerateTrace (100000);
+    }
+  else if (!LoadTrace (trace))
+    {
+      NS_FATAL_ERROR ("No delays could be read from " << trace);
+    }
+  NS_LOG_INFO (g_delays.size () << " delays");
+
+  std::cout << "scheduler\tms\tevents/s" << std::endl;
+  std::istringstream iss (schedulers);
+  std::string scheduler;
+  while (std::getline (iss, scheduler, ','))
+    {
+      Run (scheduler, population, events);
+    }
+  return 0;
+}
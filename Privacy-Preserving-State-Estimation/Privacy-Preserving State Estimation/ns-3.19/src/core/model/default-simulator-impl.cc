@@ -271,6 +271,7 @@ DefaultSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &time, E
 EventId
 DefaultSimulatorImpl::ScheduleNow (EventImpl *event)
 {
+  NS_LOG_FUNCTION (this << event);
   NS_ASSERT_MSG (SystemThread::Equals (m_main), "Simulator::ScheduleNow Thread-unsafe invocation!");
 
   Scheduler::Event ev;
@@ -20,11 +20,238 @@
 
 #include "event-impl.h"
 #include "log.h"
+#include "ns3/core-config.h"
+#include <new>
 
 NS_LOG_COMPONENT_DEFINE ("EventImpl");
 
+#if defined (HAVE_PTHREAD_H) && defined (HAVE_TLS)
+#define EVENT_POOL_STORAGE static __thread
+#define EVENT_POOL_THREADED
+#include <pthread.h>
+#elif !defined (HAVE_PTHREAD_H)
+#define EVENT_POOL_STORAGE static
+#endif
+
 namespace ns3 {
 
+#ifdef EVENT_POOL_STORAGE
+
+/// Size classes are multiples of this, which keeps the objects aligned
+static const std::size_t EVENT_ALIGN = 16;
+/// Larger objects come from the global heap
+static const std::size_t EVENT_MAX_SIZE = 256;
+/// Number of size classes
+static const std::size_t EVENT_CLASSES = EVENT_MAX_SIZE / EVENT_ALIGN;
+/// Size of the slabs the free lists are refilled from
+static const std::size_t EVENT_SLAB_SIZE = 16384;
+/// Objects moved at once between a thread and the shared free lists
+static const uint32_t EVENT_BATCH = 64;
+
+struct EventFreeObject
+{
+  EventFreeObject *next;
+};
+
+/// Free objects of each size class, private to the thread
+EVENT_POOL_STORAGE EventFreeObject *g_eventFreeLists[EVENT_CLASSES];
+/// Length of the private free lists
+EVENT_POOL_STORAGE uint32_t g_eventFreeCounts[EVENT_CLASSES];
+
+/// Free objects of each size class given back by the threads
+static EventFreeObject *g_eventSharedLists[EVENT_CLASSES];
+/// Size of all the slabs allocated
+static std::size_t g_eventPoolMemory = 0;
+
+#ifdef EVENT_POOL_THREADED
+// The pool is used before main, so the mutex cannot be a SystemMutex
+// with a constructor
+static pthread_mutex_t g_eventPoolMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t g_eventPoolKeyOnce = PTHREAD_ONCE_INIT;
+/// Key whose destructor gives the free lists of an exiting thread back
+static pthread_key_t g_eventPoolKey;
+EVENT_POOL_STORAGE bool g_eventPoolRegistered = false;
+#endif /* EVENT_POOL_THREADED */
+
+static void
+LockEventPool (void)
+{
+#ifdef EVENT_POOL_THREADED
+  pthread_mutex_lock (&g_eventPoolMutex);
+#endif /* EVENT_POOL_THREADED */
+}
+
+static void
+UnlockEventPool (void)
+{
+#ifdef EVENT_POOL_THREADED
+  pthread_mutex_unlock (&g_eventPoolMutex);
+#endif /* EVENT_POOL_THREADED */
+}
+
+/**
+ * Move the first count objects of the private free list of a size class
+ * to its shared free list.
+ */
+static void
+ReleaseEventObjects (std::size_t sizeClass, uint32_t count)
+{
+  if (count == 0)
+    {
+      return;
+    }
+  EventFreeObject *first = g_eventFreeLists[sizeClass];
+  EventFreeObject *last = first;
+  for (uint32_t i = 1; i < count; i++)
+    {
+      last = last->next;
+    }
+  g_eventFreeLists[sizeClass] = last->next;
+  g_eventFreeCounts[sizeClass] -= count;
+  LockEventPool ();
+  last->next = g_eventSharedLists[sizeClass];
+  g_eventSharedLists[sizeClass] = first;
+  UnlockEventPool ();
+}
+
+#ifdef EVENT_POOL_THREADED
+static void
+ReleaseEventFreeLists (void *)
+{
+  for (std::size_t sizeClass = 0; sizeClass < EVENT_CLASSES; sizeClass++)
+    {
+      ReleaseEventObjects (sizeClass, g_eventFreeCounts[sizeClass]);
+    }
+}
+
+static void
+CreateEventPoolKey (void)
+{
+  pthread_key_create (&g_eventPoolKey, &ReleaseEventFreeLists);
+}
+#endif /* EVENT_POOL_THREADED */
+
+/**
+ * Make sure the free lists of the thread are given back when it exits,
+ * whether it allocated events or only released them.
+ */
+static void
+RegisterEventPoolThread (void)
+{
+#ifdef EVENT_POOL_THREADED
+  if (!g_eventPoolRegistered)
+    {
+      pthread_once (&g_eventPoolKeyOnce, &CreateEventPoolKey);
+      // The destructor of the key only runs for a non-null value
+      pthread_setspecific (g_eventPoolKey, &g_eventPoolRegistered);
+      g_eventPoolRegistered = true;
+    }
+#endif /* EVENT_POOL_THREADED */
+}
+
+/**
+ * Refill the empty private free list of a size class with a batch of
+ * the shared free list, itself refilled from a new slab when empty.
+ */
+static void
+AcquireEventObjects (std::size_t sizeClass)
+{
+  RegisterEventPoolThread ();
+  LockEventPool ();
+  if (g_eventSharedLists[sizeClass] == 0)
+    {
+      std::size_t objectSize = (sizeClass + 1) * EVENT_ALIGN;
+      char *slab = static_cast<char *> (::operator new (EVENT_SLAB_SIZE));
+      g_eventPoolMemory += EVENT_SLAB_SIZE;
+      EventFreeObject *head = 0;
+      for (std::size_t i = EVENT_SLAB_SIZE / objectSize; i > 0; i--)
+        {
+          EventFreeObject *object = reinterpret_cast<EventFreeObject *> (slab + (i - 1) * objectSize);
+          object->next = head;
+          head = object;
+        }
+      g_eventSharedLists[sizeClass] = head;
+    }
+  EventFreeObject *first = g_eventSharedLists[sizeClass];
+  EventFreeObject *last = first;
+  uint32_t count = 1;
+  while (count < EVENT_BATCH && last->next != 0)
+    {
+      last = last->next;
+      count++;
+    }
+  g_eventSharedLists[sizeClass] = last->next;
+  UnlockEventPool ();
+  last->next = 0;
+  g_eventFreeLists[sizeClass] = first;
+  g_eventFreeCounts[sizeClass] = count;
+}
+
+#endif /* EVENT_POOL_STORAGE */
+
+void *
+EventImpl::operator new (std::size_t size)
+{
+#ifdef EVENT_POOL_STORAGE
+  if (size <= EVENT_MAX_SIZE)
+    {
+      std::size_t sizeClass = (size + EVENT_ALIGN - 1) / EVENT_ALIGN - 1;
+      if (g_eventFreeLists[sizeClass] == 0)
+        {
+          AcquireEventObjects (sizeClass);
+        }
+      EventFreeObject *object = g_eventFreeLists[sizeClass];
+      g_eventFreeLists[sizeClass] = object->next;
+      g_eventFreeCounts[sizeClass]--;
+      return object;
+    }
+#endif /* EVENT_POOL_STORAGE */
+  return ::operator new (size);
+}
+
+void
+EventImpl::operator delete (void *p, std::size_t size)
+{
+  if (p == 0)
+    {
+      return;
+    }
+#ifdef EVENT_POOL_STORAGE
+  if (size <= EVENT_MAX_SIZE)
+    {
+      std::size_t sizeClass = (size + EVENT_ALIGN - 1) / EVENT_ALIGN - 1;
+      if (g_eventFreeCounts[sizeClass] == 0)
+        {
+          RegisterEventPoolThread ();
+        }
+      EventFreeObject *object = static_cast<EventFreeObject *> (p);
+      object->next = g_eventFreeLists[sizeClass];
+      g_eventFreeLists[sizeClass] = object;
+      // Events released by another thread than the one which allocated
+      // them go back to the shared free lists once the thread holds too many
+      if (++g_eventFreeCounts[sizeClass] >= 2 * EVENT_BATCH)
+        {
+          ReleaseEventObjects (sizeClass, EVENT_BATCH);
+        }
+      return;
+    }
+#endif /* EVENT_POOL_STORAGE */
+  ::operator delete (p);
+}
+
+std::size_t
+EventImpl::GetPoolMemory (void)
+{
+#ifdef EVENT_POOL_STORAGE
+  LockEventPool ();
+  std::size_t memory = g_eventPoolMemory;
+  UnlockEventPool ();
+  return memory;
+#else
+  return 0;
+#endif /* EVENT_POOL_STORAGE */
+}
+
 EventImpl::~EventImpl ()
 {
   NS_LOG_FUNCTION (this);
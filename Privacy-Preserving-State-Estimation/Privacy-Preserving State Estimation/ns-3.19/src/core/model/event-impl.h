@@ -21,6 +21,7 @@
 #define EVENT_IMPL_H
 
 #include <stdint.h>
+#include <cstddef>
 #include "simple-ref-count.h"
 
 namespace ns3 {
@@ -35,6 +36,16 @@ namespace ns3 {
  * obviously (there are Ref and Unref methods) reference-counted and
  * most subclasses are usually created by one of the many Simulator::Schedule
  * methods.
+ *
+ * Events are created and released at a high rate, so the storage of
+ * EventImpl objects does not come from the global heap: it is taken from
+ * free lists of size classes which are private to each thread. These are
+ * refilled in batches from free lists shared by all the threads, and
+ * give their excess back to them, as does a thread when it exits. The
+ * shared free lists are refilled a slab at a time. Slabs are never
+ * returned, so the memory held is that of the largest number of events
+ * alive at once. Threaded builds on platforms without thread local
+ * storage use the global heap.
  */
 class EventImpl : public SimpleRefCount<EventImpl>
 {
@@ -58,6 +69,21 @@ public:
    */
   bool IsCancelled (void);
 
+  /**
+   * \param size the size of the object to allocate
+   * \returns storage for the object, from the free list of its size class
+   */
+  static void *operator new (std::size_t size);
+  /**
+   * \param p storage returned by operator new
+   * \param size the size of the object
+   */
+  static void operator delete (void *p, std::size_t size);
+  /**
+   * \returns the size of the slabs allocated for the events so far
+   */
+  static std::size_t GetPoolMemory (void);
+
 protected:
   virtual void Notify (void) = 0;
 
@@ -0,0 +1,321 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ladder-scheduler.h"
+#include "event-impl.h"
+#include "uinteger.h"
+#include "assert.h"
+#include "log.h"
+#include <algorithm>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE ("LadderScheduler");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (LadderScheduler)
+  ;
+
+TypeId
+LadderScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LadderScheduler")
+    .SetParent<Scheduler> ()
+    .AddConstructor<LadderScheduler> ()
+    .AddAttribute ("Threshold", "The number of events in a bucket above which "
+                   "they are spread over a new rung.",
+                   UintegerValue (50),
+                   MakeUintegerAccessor (&LadderScheduler::m_threshold),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("MaxRungs", "The maximum number of rungs of the ladder.",
+                   UintegerValue (8),
+                   MakeUintegerAccessor (&LadderScheduler::m_maxRungs),
+                   MakeUintegerChecker<uint32_t> (1))
+  ;
+  return tid;
+}
+
+LadderScheduler::LadderScheduler ()
+  : m_topMin (std::numeric_limits<uint64_t>::max ()),
+    m_topMax (0),
+    m_topStart (0),
+    m_nRungs (0),
+    m_bottomHead (0),
+    m_threshold (50),
+    m_maxRungs (8)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+LadderScheduler::~LadderScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint64_t
+LadderScheduler::GetCurrentStart (const Rung &rung) const
+{
+  if (rung.current < rung.nBuckets)
+    {
+      return rung.start + rung.current * rung.width;
+    }
+  return rung.end;
+}
+
+uint32_t
+LadderScheduler::GetBucket (const Rung &rung, uint64_t ts) const
+{
+  uint64_t i = (ts - rung.start) / rung.width;
+  return i < rung.nBuckets ? i : rung.nBuckets - 1;
+}
+
+void
+LadderScheduler::Spawn (Bucket::const_iterator begin, Bucket::const_iterator end,
+                        uint64_t min, uint64_t max, uint64_t rungEnd)
+{
+  NS_LOG_FUNCTION (this << (end - begin) << min << max << rungEnd);
+  if (m_rungs.size () < m_maxRungs)
+    {
+      m_rungs.resize (m_maxRungs);
+    }
+  Rung &rung = m_rungs[m_nRungs];
+  m_nRungs++;
+  rung.start = min;
+  rung.end = rungEnd;
+  rung.width = std::max<uint64_t> (1, (max - min) / (end - begin));
+  rung.nBuckets = (max - min) / rung.width + 1;
+  rung.current = 0;
+  if (rung.buckets.size () < rung.nBuckets)
+    {
+      rung.buckets.resize (rung.nBuckets);
+    }
+  for (Bucket::const_iterator i = begin; i != end; ++i)
+    {
+      rung.buckets[GetBucket (rung, i->key.m_ts)].push_back (*i);
+    }
+}
+
+void
+LadderScheduler::TopToLadder (void)
+{
+  NS_LOG_FUNCTION (this << m_top.size () << m_topMin << m_topMax);
+  m_topStart = m_topMax + 1;
+  if (m_top.size () <= m_threshold || m_topMin == m_topMax)
+    {
+      BucketToBottom (m_top);
+    }
+  else
+    {
+      Spawn (m_top.begin (), m_top.end (), m_topMin, m_topMax, m_topStart);
+      m_top.clear ();
+    }
+  m_topMin = std::numeric_limits<uint64_t>::max ();
+  m_topMax = 0;
+}
+
+void
+LadderScheduler::BucketToBottom (Bucket &bucket)
+{
+  NS_ASSERT (m_bottomHead == m_bottom.size ());
+  m_bottom.clear ();
+  m_bottomHead = 0;
+  m_bottom.swap (bucket);
+  std::sort (m_bottom.begin (), m_bottom.end ());
+}
+
+void
+LadderScheduler::BottomToLadder (void)
+{
+  NS_LOG_FUNCTION (this << m_bottom.size () - m_bottomHead);
+  uint64_t min = m_bottom[m_bottomHead].key.m_ts;
+  uint64_t max = m_bottom.back ().key.m_ts;
+  if (min == max)
+    {
+      return;
+    }
+  uint64_t end = m_nRungs == 0 ? m_topStart : GetCurrentStart (m_rungs[m_nRungs - 1]);
+  Spawn (m_bottom.begin () + m_bottomHead, m_bottom.end (), min, max, end);
+  m_bottom.clear ();
+  m_bottomHead = 0;
+  Refill ();
+}
+
+void
+LadderScheduler::Refill (void)
+{
+  NS_LOG_FUNCTION (this);
+  while (m_bottomHead == m_bottom.size ())
+    {
+      if (m_nRungs == 0)
+        {
+          if (m_top.empty ())
+            {
+              // Empty: the next events are used to tune the ladder again
+              m_bottom.clear ();
+              m_bottomHead = 0;
+              m_topStart = 0;
+              return;
+            }
+          TopToLadder ();
+          continue;
+        }
+      Rung &rung = m_rungs[m_nRungs - 1];
+      while (rung.current < rung.nBuckets && rung.buckets[rung.current].empty ())
+        {
+          rung.current++;
+        }
+      if (rung.current == rung.nBuckets)
+        {
+          m_nRungs--;
+          continue;
+        }
+      Bucket &bucket = rung.buckets[rung.current];
+      rung.current++;
+      if (bucket.size () > m_threshold && m_nRungs < m_maxRungs)
+        {
+          uint64_t min = std::numeric_limits<uint64_t>::max ();
+          uint64_t max = 0;
+          for (Bucket::const_iterator i = bucket.begin (); i != bucket.end (); ++i)
+            {
+              min = std::min (min, i->key.m_ts);
+              max = std::max (max, i->key.m_ts);
+            }
+          if (min != max)
+            {
+              Spawn (bucket.begin (), bucket.end (), min, max, GetCurrentStart (rung));
+              bucket.clear ();
+              continue;
+            }
+        }
+      BucketToBottom (bucket);
+    }
+}
+
+void
+LadderScheduler::Insert (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  uint64_t ts = ev.key.m_ts;
+  if (ts >= m_topStart)
+    {
+      m_top.push_back (ev);
+      m_topMin = std::min (m_topMin, ts);
+      m_topMax = std::max (m_topMax, ts);
+      if (IsEmpty ())
+        {
+          Refill ();
+        }
+      return;
+    }
+  for (uint32_t r = 0; r < m_nRungs; r++)
+    {
+      Rung &rung = m_rungs[r];
+      if (ts >= GetCurrentStart (rung))
+        {
+          rung.buckets[GetBucket (rung, ts)].push_back (ev);
+          return;
+        }
+    }
+  m_bottom.insert (std::upper_bound (m_bottom.begin () + m_bottomHead, m_bottom.end (), ev), ev);
+  if (m_bottom.size () - m_bottomHead > m_threshold && m_nRungs < m_maxRungs)
+    {
+      // Keep the sorted insertions cheap
+      BottomToLadder ();
+    }
+}
+
+bool
+LadderScheduler::IsEmpty (void) const
+{
+  NS_LOG_FUNCTION (this);
+  // The bottom is only ever empty when the whole queue is.
+  return m_bottomHead == m_bottom.size ();
+}
+
+Scheduler::Event
+LadderScheduler::PeekNext (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  return m_bottom[m_bottomHead];
+}
+
+Scheduler::Event
+LadderScheduler::RemoveNext (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  Event ev = m_bottom[m_bottomHead];
+  m_bottomHead++;
+  if (m_bottomHead == m_bottom.size ())
+    {
+      Refill ();
+    }
+  else if (m_bottomHead >= 1024 && m_bottomHead * 2 >= m_bottom.size ())
+    {
+      m_bottom.erase (m_bottom.begin (), m_bottom.begin () + m_bottomHead);
+      m_bottomHead = 0;
+    }
+  NS_LOG_DEBUG (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  return ev;
+}
+
+void
+LadderScheduler::RemoveFrom (Bucket &bucket, const Event &ev)
+{
+  for (Bucket::iterator i = bucket.begin (); i != bucket.end (); ++i)
+    {
+      if (i->key.m_uid == ev.key.m_uid)
+        {
+          NS_ASSERT (i->impl == ev.impl);
+          *i = bucket.back ();
+          bucket.pop_back ();
+          return;
+        }
+    }
+  NS_ASSERT (false);
+}
+
+void
+LadderScheduler::Remove (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  NS_ASSERT (!IsEmpty ());
+  uint64_t ts = ev.key.m_ts;
+  if (ts >= m_topStart)
+    {
+      RemoveFrom (m_top, ev);
+      return;
+    }
+  for (uint32_t r = 0; r < m_nRungs; r++)
+    {
+      Rung &rung = m_rungs[r];
+      if (ts >= GetCurrentStart (rung))
+        {
+          RemoveFrom (rung.buckets[GetBucket (rung, ts)], ev);
+          return;
+        }
+    }
+  Bucket::iterator i = std::lower_bound (m_bottom.begin () + m_bottomHead, m_bottom.end (), ev);
+  NS_ASSERT (i != m_bottom.end () && i->key.m_uid == ev.key.m_uid && i->impl == ev.impl);
+  m_bottom.erase (i);
+  if (IsEmpty ())
+    {
+      Refill ();
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LADDER_SCHEDULER_H
+#define LADDER_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup scheduler
+ * \brief a ladder queue event scheduler
+ *
+ * This event scheduler implements the ladder queue of "Ladder Queue: An
+ * O(1) Priority Queue Structure for Large-Scale Discrete Event Simulation"
+ * by Tang, Goh and Thng (2005). Events are held in three tiers:
+ *
+ * - Top: an unsorted list of the events later than any event below it.
+ * - Ladder: rungs of buckets. When the bottom runs dry, the top is moved
+ *   to the first rung, the bucket width being the spread of the top
+ *   events divided by their number, so that the width follows the
+ *   timestamps actually observed. A bucket holding more than Threshold
+ *   events is in turn spread over a new, finer rung, up to MaxRungs.
+ * - Bottom: a sorted list of the earliest events, filled from the first
+ *   non-empty bucket of the finest rung. When insertions grow it past
+ *   Threshold events, it is spread over a new rung as well.
+ *
+ * Unlike the calendar queue, it never resizes a structure holding all
+ * the events, and unlike the map scheduler it does not allocate per
+ * event once its vectors have grown to the size of the workload.
+ */
+class LadderScheduler : public Scheduler
+{
+public:
+  static TypeId GetTypeId (void);
+
+  LadderScheduler ();
+  virtual ~LadderScheduler ();
+
+  virtual void Insert (const Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Event PeekNext (void) const;
+  virtual Event RemoveNext (void);
+  virtual void Remove (const Event &ev);
+
+private:
+  typedef std::vector<Scheduler::Event> Bucket;
+
+  /// A rung of the ladder
+  struct Rung
+  {
+    uint64_t start;    //!< Timestamp of the start of the first bucket
+    uint64_t width;    //!< Width of every bucket but the last one
+    uint64_t end;      //!< Timestamp past the end of the last bucket
+    uint32_t nBuckets; //!< Number of buckets in use
+    uint32_t current;  //!< First bucket not yet moved down the ladder
+    std::vector<Bucket> buckets; //!< Buckets, the last one up to end
+  };
+
+  uint64_t GetCurrentStart (const Rung &rung) const;
+  uint32_t GetBucket (const Rung &rung, uint64_t ts) const;
+  void Spawn (Bucket::const_iterator begin, Bucket::const_iterator end,
+              uint64_t min, uint64_t max, uint64_t rungEnd);
+  void TopToLadder (void);
+  void BottomToLadder (void);
+  void BucketToBottom (Bucket &bucket);
+  void Refill (void);
+  static void RemoveFrom (Bucket &bucket, const Event &ev);
+
+  Bucket m_top;          //!< Unsorted events from m_topStart on
+  uint64_t m_topMin;     //!< Earliest timestamp in the top
+  uint64_t m_topMax;     //!< Latest timestamp in the top
+  uint64_t m_topStart;   //!< Events from this timestamp on go to the top
+  std::vector<Rung> m_rungs; //!< The rungs, coarsest first
+  uint32_t m_nRungs;     //!< Number of rungs in use
+  Bucket m_bottom;       //!< Sorted earliest events, from m_bottomHead on
+  uint32_t m_bottomHead; //!< Index of the next event in the bottom
+  uint32_t m_threshold;  //!< Bucket size above which a rung is spawned
+  uint32_t m_maxRungs;   //!< Maximum number of rungs
+};
+
+} // namespace ns3
+
+#endif /* LADDER_SCHEDULER_H */
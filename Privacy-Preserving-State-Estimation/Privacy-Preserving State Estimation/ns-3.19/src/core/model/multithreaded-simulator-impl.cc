@@ -0,0 +1,729 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "simulator.h"
+#include "multithreaded-simulator-impl.h"
+#include "scheduler.h"
+#include "event-impl.h"
+#include "map-scheduler.h"
+
+#include "ptr.h"
+#include "uinteger.h"
+#include "assert.h"
+#include "log.h"
+
+#include <algorithm>
+#include <limits>
+#include <sched.h>
+#include <unistd.h>
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the possibility
+// of causing recursions leading to stack overflow
+
+NS_LOG_COMPONENT_DEFINE ("MultithreadedSimulatorImpl");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (MultithreadedSimulatorImpl)
+  ;
+
+/// The MultithreadedSimulatorImpl whose Run is in progress, if any
+static MultithreadedSimulatorImpl *g_running = 0;
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::MultithreadedSimulatorImpl")
+    .SetParent<SimulatorImpl> ()
+    .AddConstructor<MultithreadedSimulatorImpl> ()
+    .AddAttribute ("Lookahead",
+                   "The smallest delay of an event scheduled for a node of another partition.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&MultithreadedSimulatorImpl::m_lookahead),
+                   MakeTimeChecker ())
+    .AddAttribute ("MaxThreads",
+                   "The number of threads to run the partitions, zero for one per core.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&MultithreadedSimulatorImpl::m_maxThreads),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+  m_schedulerFactory.SetTypeId (MapScheduler::GetTypeId ());
+  InitPartition (m_global, 0xffffffff);
+  InitPartition (m_staging, 0xffffffff);
+  m_blockContexts = 0;
+  m_maxThreads = 0;
+  m_stop = false;
+  m_exit = false;
+  m_running = false;
+  g_running = 0;
+  m_windowEnd = 0;
+  m_nextWorker = 0;
+  m_barrierCount = 0;
+  m_barrierGeneration = 0;
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+// The partition whose event the calling thread runs; zero in the main
+// thread outside of the events.
+static __thread void *g_currentPartition = 0;
+
+void
+MultithreadedSimulatorImpl::InitPartition (Partition &partition, uint32_t index)
+{
+  partition.index = index;
+  partition.events = m_schedulerFactory.Create<Scheduler> ();
+  partition.currentTs = 0;
+  // before ::Run is entered, the currentUid will be zero
+  partition.currentUid = 0;
+  partition.currentContext = 0xffffffff;
+  // uids are allocated from 4.
+  // uid 0 is "invalid" events
+  // uid 1 is "now" events
+  // uid 2 is "destroy" events
+  partition.uid = 4;
+  partition.sent = 0;
+  partition.sequence = 0;
+  partition.unscheduledEvents = 0;
+  partition.inbox = 0;
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  std::vector<Partition *> all = m_partitions;
+  all.push_back (&m_global);
+  all.push_back (&m_staging);
+  for (std::vector<Partition *>::iterator i = all.begin (); i != all.end (); ++i)
+    {
+      Drain (**i);
+      while (!(*i)->events->IsEmpty ())
+        {
+          Scheduler::Event next = (*i)->events->RemoveNext ();
+          next.impl->Unref ();
+        }
+      (*i)->events = 0;
+    }
+  for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+    {
+      delete *i;
+    }
+  m_partitions.clear ();
+  if (g_running == this)
+    {
+      g_running = 0;
+    }
+  SimulatorImpl::DoDispose ();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy ()
+{
+  NS_LOG_FUNCTION (this);
+  while (!m_destroyEvents.empty ())
+    {
+      Ptr<EventImpl> ev = m_destroyEvents.front ().PeekEventImpl ();
+      m_destroyEvents.pop_front ();
+      NS_LOG_LOGIC ("handle destroy " << ev);
+      if (!ev->IsCancelled ())
+        {
+          ev->Invoke ();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler (ObjectFactory schedulerFactory)
+{
+  NS_LOG_FUNCTION (this << schedulerFactory);
+  NS_ASSERT_MSG (!m_running, "Cannot change the scheduler of a running simulation");
+  m_schedulerFactory = schedulerFactory;
+  std::vector<Partition *> all = m_partitions;
+  all.push_back (&m_global);
+  all.push_back (&m_staging);
+  for (std::vector<Partition *>::iterator i = all.begin (); i != all.end (); ++i)
+    {
+      Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler> ();
+      while (!(*i)->events->IsEmpty ())
+        {
+          scheduler->Insert ((*i)->events->RemoveNext ());
+        }
+      (*i)->events = scheduler;
+    }
+}
+
+// System ID for non-distributed simulation is always zero
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId (void) const
+{
+  return 0;
+}
+
+MultithreadedSimulatorImpl::Partition *
+MultithreadedSimulatorImpl::GetCurrent (void) const
+{
+  Partition *current = static_cast<Partition *> (g_currentPartition);
+  if (current == 0)
+    {
+      NS_ASSERT_MSG (!m_running, "MultithreadedSimulatorImpl: thread-unsafe invocation from a foreign thread");
+      return const_cast<Partition *> (&m_global);
+    }
+  return current;
+}
+
+MultithreadedSimulatorImpl::Partition *
+MultithreadedSimulatorImpl::GetPartition (uint32_t context) const
+{
+  if (context == 0xffffffff)
+    {
+      return const_cast<Partition *> (&m_global);
+    }
+  if (m_partitions.empty ())
+    {
+      return const_cast<Partition *> (&m_staging);
+    }
+  uint32_t n = m_partitions.size ();
+  if (context < m_blockContexts)
+    {
+      return m_partitions[static_cast<uint64_t> (context) * n / m_blockContexts];
+    }
+  return m_partitions[context % n];
+}
+
+bool
+MultithreadedSimulatorImpl::IsRemote (uint32_t context)
+{
+  MultithreadedSimulatorImpl *impl = g_running;
+  if (impl == 0)
+    {
+      return false;
+    }
+  return impl->GetPartition (context) != impl->GetCurrent ();
+}
+
+bool
+MultithreadedSimulatorImpl::AllocateSequence (uint32_t &partition, uint32_t &sequence)
+{
+  Partition *current = static_cast<Partition *> (g_currentPartition);
+  if (g_running == 0 || current == 0 || current->index == 0xffffffff)
+    {
+      // The main thread, alone
+      return false;
+    }
+  partition = current->index + 1;
+  sequence = current->sequence++;
+  return true;
+}
+
+void
+MultithreadedSimulatorImpl::CreatePartitions (void)
+{
+  NS_LOG_FUNCTION (this);
+  uint32_t n = m_maxThreads;
+  if (n == 0)
+    {
+      long cores = sysconf (_SC_NPROCESSORS_ONLN);
+      n = cores > 0 ? cores : 1;
+    }
+  // No more threads than there are contexts to run
+  n = std::max<uint32_t> (1, std::min (n, m_blockContexts));
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Partition *partition = new Partition ();
+      InitPartition (*partition, i);
+      // The staged events keep their uids
+      partition->uid = m_staging.uid;
+      m_partitions.push_back (partition);
+    }
+  NS_LOG_INFO (n << " partitions for " << m_blockContexts << " contexts");
+  while (!m_staging.events->IsEmpty ())
+    {
+      Scheduler::Event ev = m_staging.events->RemoveNext ();
+      Partition *partition = GetPartition (ev.key.m_context);
+      partition->events->Insert (ev);
+      partition->unscheduledEvents++;
+    }
+  m_staging.unscheduledEvents = 0;
+}
+
+void
+MultithreadedSimulatorImpl::Insert (Partition &partition, EventImpl *event, uint64_t ts, uint32_t context)
+{
+  Scheduler::Event ev;
+  ev.impl = event;
+  ev.key.m_ts = ts;
+  ev.key.m_context = context;
+  ev.key.m_uid = partition.uid;
+  partition.uid++;
+  partition.unscheduledEvents++;
+  partition.events->Insert (ev);
+}
+
+void
+MultithreadedSimulatorImpl::Push (Partition &from, Partition &to, EventImpl *event, uint64_t ts, uint32_t context)
+{
+  if (ts < m_windowEnd)
+    {
+      NS_FATAL_ERROR ("Event for context " << context << " at " << TimeStep (ts) <<
+                      " is within the lookahead of the current window, which ends at " <<
+                      TimeStep (m_windowEnd) << "; decrease the Lookahead attribute");
+    }
+  InboxEvent *inboxEvent = new InboxEvent ();
+  inboxEvent->impl = event;
+  inboxEvent->ts = ts;
+  inboxEvent->context = context;
+  inboxEvent->sender = from.index;
+  inboxEvent->sequence = from.sent;
+  from.sent++;
+  InboxEvent *head;
+  do
+    {
+      head = to.inbox;
+      inboxEvent->next = head;
+    }
+  while (!__sync_bool_compare_and_swap (&to.inbox, head, inboxEvent));
+}
+
+bool
+MultithreadedSimulatorImpl::CompareInboxEvents (const InboxEvent *a, const InboxEvent *b)
+{
+  if (a->ts != b->ts)
+    {
+      return a->ts < b->ts;
+    }
+  if (a->sender != b->sender)
+    {
+      return a->sender < b->sender;
+    }
+  return a->sequence < b->sequence;
+}
+
+void
+MultithreadedSimulatorImpl::Drain (Partition &partition)
+{
+  InboxEvent *head = __sync_lock_test_and_set (&partition.inbox, static_cast<InboxEvent *> (0));
+  if (head == 0)
+    {
+      return;
+    }
+  // Insert the events in an order which does not depend on the order
+  // they were pushed in, so that they get the same uids at every run.
+  m_drained.clear ();
+  for (InboxEvent *i = head; i != 0; i = i->next)
+    {
+      m_drained.push_back (i);
+    }
+  std::sort (m_drained.begin (), m_drained.end (), &MultithreadedSimulatorImpl::CompareInboxEvents);
+  for (std::vector<InboxEvent *>::const_iterator i = m_drained.begin (); i != m_drained.end (); ++i)
+    {
+      Insert (partition, (*i)->impl, (*i)->ts, (*i)->context);
+      delete *i;
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessOneEvent (Partition &partition)
+{
+  Scheduler::Event next = partition.events->RemoveNext ();
+
+  NS_ASSERT (next.key.m_ts >= partition.currentTs);
+  partition.unscheduledEvents--;
+
+  partition.currentTs = next.key.m_ts;
+  partition.currentContext = next.key.m_context;
+  partition.currentUid = next.key.m_uid;
+  next.impl->Invoke ();
+  next.impl->Unref ();
+}
+
+void
+MultithreadedSimulatorImpl::ProcessWindow (Partition &partition)
+{
+  g_currentPartition = &partition;
+  while (!partition.events->IsEmpty ()
+         && partition.events->PeekNext ().key.m_ts < m_windowEnd)
+    {
+      ProcessOneEvent (partition);
+    }
+  g_currentPartition = 0;
+}
+
+void
+MultithreadedSimulatorImpl::Barrier (void)
+{
+  uint32_t generation = m_barrierGeneration;
+  if (__sync_add_and_fetch (&m_barrierCount, 1) == m_partitions.size ())
+    {
+      m_barrierCount = 0;
+      __sync_fetch_and_add (&m_barrierGeneration, 1);
+      return;
+    }
+  // Windows are short, so spin rather than sleep, but leave the core
+  // to others when there are more threads than cores.
+  uint32_t spins = 0;
+  while (m_barrierGeneration == generation)
+    {
+      if (++spins > 1000)
+        {
+          sched_yield ();
+        }
+    }
+  __sync_synchronize ();
+}
+
+void
+MultithreadedSimulatorImpl::Work (void)
+{
+  Partition &partition = *m_partitions[__sync_add_and_fetch (&m_nextWorker, 1)];
+  while (true)
+    {
+      Barrier ();
+      if (m_exit)
+        {
+          return;
+        }
+      ProcessWindow (partition);
+      Barrier ();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished (void) const
+{
+  if (m_stop)
+    {
+      return true;
+    }
+  if (!m_global.events->IsEmpty () || !m_staging.events->IsEmpty ())
+    {
+      return false;
+    }
+  for (std::vector<Partition *>::const_iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+    {
+      if (!(*i)->events->IsEmpty () || (*i)->inbox != 0)
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+void
+MultithreadedSimulatorImpl::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_lookahead <= Seconds (0))
+    {
+      NS_FATAL_ERROR ("MultithreadedSimulatorImpl needs a positive Lookahead");
+    }
+  if (m_partitions.empty ())
+    {
+      CreatePartitions ();
+    }
+  m_stop = false;
+  m_exit = false;
+  m_running = true;
+  g_running = this;
+  m_nextWorker = 0;
+  for (uint32_t i = 1; i < m_partitions.size (); i++)
+    {
+      Ptr<SystemThread> worker = Create<SystemThread> (MakeCallback (&MultithreadedSimulatorImpl::Work, this));
+      worker->Start ();
+      m_workers.push_back (worker);
+    }
+
+  uint64_t lookahead = m_lookahead.GetTimeStep ();
+  while (true)
+    {
+      Drain (m_global);
+      for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+        {
+          Drain (**i);
+        }
+      if (m_stop)
+        {
+          break;
+        }
+      bool empty = true;
+      uint64_t next = 0;
+      for (std::vector<Partition *>::const_iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+        {
+          if (!(*i)->events->IsEmpty ())
+            {
+              uint64_t ts = (*i)->events->PeekNext ().key.m_ts;
+              next = empty ? ts : std::min (next, ts);
+              empty = false;
+            }
+        }
+      if (!m_global.events->IsEmpty ()
+          && (empty || m_global.events->PeekNext ().key.m_ts <= next))
+        {
+          // Global events run alone, ahead of the partitions
+          g_currentPartition = &m_global;
+          ProcessOneEvent (m_global);
+          g_currentPartition = 0;
+          continue;
+        }
+      if (empty)
+        {
+          break;
+        }
+      m_windowEnd = next + lookahead < next ? std::numeric_limits<uint64_t>::max () : next + lookahead;
+      if (!m_global.events->IsEmpty ())
+        {
+          m_windowEnd = std::min (m_windowEnd, m_global.events->PeekNext ().key.m_ts);
+        }
+      Barrier ();
+      ProcessWindow (*m_partitions[0]);
+      Barrier ();
+    }
+
+  m_exit = true;
+  Barrier ();
+  for (std::vector<Ptr<SystemThread> >::iterator i = m_workers.begin (); i != m_workers.end (); ++i)
+    {
+      (*i)->Join ();
+    }
+  m_workers.clear ();
+  m_running = false;
+  g_running = 0;
+  m_windowEnd = 0;
+
+  // Now () is the time of the last event, whichever partition ran it
+  int unscheduledEvents = m_global.unscheduledEvents;
+  for (std::vector<Partition *>::const_iterator i = m_partitions.begin (); i != m_partitions.end (); ++i)
+    {
+      m_global.currentTs = std::max (m_global.currentTs, (*i)->currentTs);
+      unscheduledEvents += (*i)->unscheduledEvents;
+    }
+  // If the simulator stopped naturally by lack of events, make a
+  // consistency test to check that we didn't lose any events along the way.
+  NS_ASSERT (m_stop || unscheduledEvents == 0);
+}
+
+void
+MultithreadedSimulatorImpl::Stop (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_stop = true;
+}
+
+void
+MultithreadedSimulatorImpl::Stop (Time const &time)
+{
+  NS_LOG_FUNCTION (this << time.GetTimeStep ());
+  Partition *current = GetCurrent ();
+  Time delay = time;
+  if (m_running && current != &m_global
+      && (time + TimeStep (current->currentTs)).GetTimeStep () < m_windowEnd)
+    {
+      // The global partition cannot get an event within the window of a
+      // node: stop at its end
+      delay = TimeStep (m_windowEnd - current->currentTs);
+    }
+  Simulator::ScheduleWithContext (0xffffffff, delay, &Simulator::Stop);
+}
+
+//
+// Schedule an event for a _relative_ time in the future.
+//
+EventId
+MultithreadedSimulatorImpl::Schedule (Time const &time, EventImpl *event)
+{
+  Partition *current = GetCurrent ();
+  Time tAbsolute = time + TimeStep (current->currentTs);
+
+  NS_ASSERT (tAbsolute.IsPositive ());
+  NS_ASSERT (tAbsolute >= TimeStep (current->currentTs));
+  uint64_t ts = tAbsolute.GetTimeStep ();
+  uint32_t uid = current->uid;
+  Insert (*current, event, ts, current->currentContext);
+  return EventId (event, ts, current->currentContext, uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &time, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << context << time.GetTimeStep () << event);
+  Partition *current = GetCurrent ();
+  uint64_t ts = (time + TimeStep (current->currentTs)).GetTimeStep ();
+  if (m_partitions.empty () && context != 0xffffffff)
+    {
+      // Before the first run: the partitions are not known yet
+      m_blockContexts = std::max (m_blockContexts, context + 1);
+      m_staging.uid = std::max (m_staging.uid, current->uid);
+      Insert (m_staging, event, ts, context);
+      current->uid = m_staging.uid;
+      return;
+    }
+  Partition *target = GetPartition (context);
+  if (target == current || !m_running || current == &m_global)
+    {
+      // The target partition is not running concurrently
+      Insert (*target, event, ts, context);
+    }
+  else
+    {
+      Push (*current, *target, event, ts, context);
+    }
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow (EventImpl *event)
+{
+  Partition *current = GetCurrent ();
+  uint32_t uid = current->uid;
+  Insert (*current, event, current->currentTs, current->currentContext);
+  return EventId (event, current->currentTs, current->currentContext, uid);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy (EventImpl *event)
+{
+  EventId id (Ptr<EventImpl> (event, false), GetCurrent ()->currentTs, 0xffffffff, 2);
+  CriticalSection cs (m_destroyMutex);
+  m_destroyEvents.push_back (id);
+  return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now (void) const
+{
+  // Do not add function logging here, to avoid stack overflow
+  return TimeStep (GetCurrent ()->currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft (const EventId &id) const
+{
+  if (IsExpired (id))
+    {
+      return TimeStep (0);
+    }
+  else
+    {
+      return TimeStep (id.GetTs () - GetCurrent ()->currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Remove (const EventId &id)
+{
+  if (id.GetUid () == 2)
+    {
+      // destroy events.
+      CriticalSection cs (m_destroyMutex);
+      for (DestroyEvents::iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              m_destroyEvents.erase (i);
+              break;
+            }
+        }
+      return;
+    }
+  if (IsExpired (id))
+    {
+      return;
+    }
+  Partition *partition = GetPartition (id.GetContext ());
+  NS_ASSERT_MSG (!m_running || partition == GetCurrent () || GetCurrent () == &m_global,
+                 "Cannot remove an event of another partition");
+  Scheduler::Event event;
+  event.impl = id.PeekEventImpl ();
+  event.key.m_ts = id.GetTs ();
+  event.key.m_context = id.GetContext ();
+  event.key.m_uid = id.GetUid ();
+  partition->events->Remove (event);
+  event.impl->Cancel ();
+  // whenever we remove an event from the event list, we have to unref it.
+  event.impl->Unref ();
+
+  partition->unscheduledEvents--;
+}
+
+void
+MultithreadedSimulatorImpl::Cancel (const EventId &id)
+{
+  if (!IsExpired (id))
+    {
+      id.PeekEventImpl ()->Cancel ();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired (const EventId &ev) const
+{
+  if (ev.GetUid () == 2)
+    {
+      if (ev.PeekEventImpl () == 0 ||
+          ev.PeekEventImpl ()->IsCancelled ())
+        {
+          return true;
+        }
+      // destroy events.
+      CriticalSection cs (const_cast<SystemMutex &> (m_destroyMutex));
+      for (DestroyEvents::const_iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == ev)
+            {
+              return false;
+            }
+        }
+      return true;
+    }
+  const Partition *partition = GetPartition (ev.GetContext ());
+  if (ev.PeekEventImpl () == 0 ||
+      ev.GetTs () < partition->currentTs ||
+      (ev.GetTs () == partition->currentTs &&
+       ev.GetUid () <= partition->currentUid) ||
+      ev.PeekEventImpl ()->IsCancelled ())
+    {
+      return true;
+    }
+  else
+    {
+      return false;
+    }
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime (void) const
+{
+  /// \todo I am fairly certain other compilers use other non-standard
+  /// post-fixes to indicate 64 bit constants.
+  return TimeStep (0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext (void) const
+{
+  return GetCurrent ()->currentContext;
+}
+
+} // namespace ns3
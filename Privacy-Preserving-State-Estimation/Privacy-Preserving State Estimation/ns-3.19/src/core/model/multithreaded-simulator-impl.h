@@ -0,0 +1,192 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "simulator-impl.h"
+#include "scheduler.h"
+#include "event-impl.h"
+#include "object-factory.h"
+#include "system-thread.h"
+#include "system-mutex.h"
+#include "nstime.h"
+#include "ptr.h"
+
+#include <list>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ *
+ * \brief Conservative parallel simulator for the cores of a single host
+ *
+ * The events are split into partitions by their context, that is by
+ * node, and each partition is run by a thread of its own. The partitions
+ * advance together through windows of simulation time as long as the
+ * Lookahead attribute: the events of one window cannot affect the other
+ * partitions within the same window, provided that no event schedules
+ * an event for a node of another partition less than Lookahead from
+ * now. For nodes which only talk over a wireless channel, the lookahead
+ * is the smallest propagation delay between two of them, as returned by
+ * YansWifiChannel::GetMinimumDelay. An event which breaks the lookahead
+ * is a fatal error.
+ *
+ * An event for another partition is pushed to a lock-free inbox of that
+ * partition, and moved to its scheduler at the end of the window in an
+ * order which does not depend on the timing of the threads, so that a
+ * run is repeatable for a given number of threads.
+ *
+ * Events without a context, such as those scheduled by the main program,
+ * are global: each of them runs alone, in the thread which called
+ * Simulator::Run, before the events of the partitions at the same time.
+ * Stop takes effect at the end of the current window, and a Stop (Time)
+ * asked by the event of a node no earlier than that end.
+ *
+ * The contexts scheduled before the first Simulator::Run are dealt to
+ * the partitions in contiguous blocks, so that nodes created together,
+ * which are often neighbours, share a partition. Contexts seen later
+ * are dealt round robin.
+ *
+ * The state shared by the models of different partitions must be
+ * read-only or guarded. ns-3 must be configured with
+ * --enable-multithreaded-simulator, which makes reference counts atomic
+ * and packets safe to create from several threads; models which hand
+ * packets to other nodes copy them across partitions (see IsRemote).
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+public:
+  static TypeId GetTypeId (void);
+
+  MultithreadedSimulatorImpl ();
+  ~MultithreadedSimulatorImpl ();
+
+  virtual void Destroy ();
+  virtual bool IsFinished (void) const;
+  virtual void Stop (void);
+  virtual void Stop (Time const &time);
+  virtual EventId Schedule (Time const &time, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, Time const &time, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+  virtual EventId ScheduleDestroy (EventImpl *event);
+  virtual void Remove (const EventId &ev);
+  virtual void Cancel (const EventId &ev);
+  virtual bool IsExpired (const EventId &ev) const;
+  virtual void Run (void);
+  virtual Time Now (void) const;
+  virtual Time GetDelayLeft (const EventId &id) const;
+  virtual Time GetMaximumSimulationTime (void) const;
+  virtual void SetScheduler (ObjectFactory schedulerFactory);
+  virtual uint32_t GetSystemId (void) const;
+  virtual uint32_t GetContext (void) const;
+
+  /**
+   * \param context the context of an event
+   * \returns true if the events of that context run in another partition
+   *          than the calling event, hence possibly in another thread
+   *
+   * This is false for every context unless a MultithreadedSimulatorImpl
+   * is running. Objects handed to a remote context, such
+   * as packets, must share no state with the caller.
+   */
+  static bool IsRemote (uint32_t context);
+
+  /**
+   * \param [out] partition one plus the index of the partition of the
+   *        calling event
+   * \param [out] sequence the number of previous calls made by the events
+   *        of that partition
+   * \returns false, leaving the arguments untouched, unless called from
+   *          an event of a partition of a running MultithreadedSimulatorImpl
+   *
+   * Lets models number the objects created by the events, such as the
+   * uids of packets, in an order which does not depend on the timing of
+   * the threads, so that the numbers of a run are repeatable for a given
+   * number of threads.
+   */
+  static bool AllocateSequence (uint32_t &partition, uint32_t &sequence);
+
+private:
+  virtual void DoDispose (void);
+
+  /// An event sent to another partition
+  struct InboxEvent
+  {
+    InboxEvent *next;   //!< Next event of the inbox
+    EventImpl *impl;    //!< The event
+    uint64_t ts;        //!< Timestamp of the event
+    uint32_t context;   //!< Context of the event
+    uint32_t sender;    //!< Index of the sending partition
+    uint32_t sequence;  //!< Rank of the event among those of the sender
+  };
+  static bool CompareInboxEvents (const InboxEvent *a, const InboxEvent *b);
+
+  /// The events of a set of contexts, run by one thread
+  struct Partition
+  {
+    uint32_t index;                 //!< Index of the partition
+    Ptr<Scheduler> events;          //!< Pending events
+    uint64_t currentTs;             //!< Timestamp of the current event
+    uint32_t currentUid;            //!< Uid of the current event
+    uint32_t currentContext;        //!< Context of the current event
+    uint32_t uid;                   //!< Uid of the next event
+    uint32_t sent;                  //!< Events sent to other partitions
+    uint32_t sequence;              //!< Next number of AllocateSequence
+    int unscheduledEvents;          //!< Events inserted but not yet run
+    InboxEvent * volatile inbox;    //!< Events received from other partitions
+  };
+
+  Partition *GetCurrent (void) const;
+  Partition *GetPartition (uint32_t context) const;
+  void InitPartition (Partition &partition, uint32_t index);
+  void CreatePartitions (void);
+  void Insert (Partition &partition, EventImpl *event, uint64_t ts, uint32_t context);
+  void Push (Partition &from, Partition &to, EventImpl *event, uint64_t ts, uint32_t context);
+  void Drain (Partition &partition);
+  void ProcessOneEvent (Partition &partition);
+  void ProcessWindow (Partition &partition);
+  void Barrier (void);
+  void Work (void);
+
+  typedef std::list<EventId> DestroyEvents;
+  DestroyEvents m_destroyEvents;  //!< Events run by Destroy
+  SystemMutex m_destroyMutex;     //!< Guards m_destroyEvents
+
+  ObjectFactory m_schedulerFactory;      //!< Creates the schedulers
+  Partition m_global;                    //!< Events without a context
+  Partition m_staging;                   //!< Events with a context, before the first run
+  std::vector<Partition *> m_partitions; //!< The partitions, one per thread
+  uint32_t m_blockContexts;              //!< Contexts dealt in blocks
+  std::vector<InboxEvent *> m_drained;   //!< Reused by Drain
+
+  Time m_lookahead;           //!< Length of a window
+  uint32_t m_maxThreads;      //!< Threads to use, zero for all the cores
+  volatile bool m_stop;       //!< Stop at the end of the window
+  volatile bool m_exit;       //!< Workers return at the next window
+  bool m_running;             //!< Whether Run is in progress
+  uint64_t m_windowEnd;       //!< Events before this run in the current window
+  uint32_t m_nextWorker;      //!< Index of the partition of the next worker
+  uint32_t m_barrierCount;    //!< Threads waiting at the barrier
+  volatile uint32_t m_barrierGeneration; //!< Windows entered by the barrier
+  std::vector<Ptr<SystemThread> > m_workers; //!< Threads of the partitions but the first
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
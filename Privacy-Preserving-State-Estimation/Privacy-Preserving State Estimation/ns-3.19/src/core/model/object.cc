@@ -26,6 +26,7 @@
 #include "attribute.h"
 #include "log.h"
 #include "string.h"
+#include "ns3/core-config.h"
 #include <vector>
 #include <sstream>
 #include <cstdlib>
@@ -164,12 +165,16 @@ Object::DoGetObject (TypeId tid) const
           // the idea is that if we perform a lookup for a TypeId on this object,
           // we are likely to perform the same lookup later so, we make sure
           // that the aggregate array is sorted by the number of accesses
-          // to each object.
+          // to each object. The multithreaded simulator leaves the array
+          // alone, as the objects of a node may be looked up by several
+          // threads at once.
 
+#ifndef NS3_MULTITHREADED
           // first, increment the access count
           current->m_getObjectCount++;
           // then, update the sort
           UpdateSortedArray (m_aggregates, i);
+#endif /* NS3_MULTITHREADED */
           // finally, return the match
           return const_cast<Object *> (current);
         }
@@ -25,6 +25,7 @@
 #include "empty.h"
 #include "default-deleter.h"
 #include "assert.h"
+#include "ns3/core-config.h"
 #include <stdint.h>
 #include <limits>
 
@@ -92,7 +93,11 @@ public:
   inline void Ref (void) const
   {
     NS_ASSERT (m_count < std::numeric_limits<uint32_t>::max());
+#ifdef NS3_MULTITHREADED
+    __sync_fetch_and_add (&m_count, 1);
+#else
     m_count++;
+#endif
   }
   /**
    * Decrement the reference count. This method should not be called
@@ -102,8 +107,12 @@ public:
    */
   inline void Unref (void) const
   {
+#ifdef NS3_MULTITHREADED
+    if (__sync_sub_and_fetch (&m_count, 1) == 0)
+#else
     m_count--;
     if (m_count == 0)
+#endif
       {
         DELETER::Delete (static_cast<T*> (const_cast<SimpleRefCount *> (this)));
       }
@@ -124,7 +133,8 @@ public:
   static void Cleanup (void) {}
 private:
   // Note we make this mutable so that the const methods can still
-  // change it.
+  // change it. It is updated atomically when the multithreaded
+  // simulator is enabled, as objects may then be shared by threads.
   mutable uint32_t m_count;
 };
 
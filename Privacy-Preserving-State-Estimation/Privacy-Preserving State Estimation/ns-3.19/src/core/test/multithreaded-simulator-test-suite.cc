@@ -0,0 +1,306 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/default-simulator-impl.h"
+#include "ns3/event-impl.h"
+#include "ns3/object-factory.h"
+#include "ns3/nstime.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using namespace ns3;
+
+// The events of each context are logged by the thread which runs them,
+// into the log of that context only; the logs are checked once the
+// simulation is over.
+class MultithreadedSimulatorTestCase : public TestCase
+{
+public:
+  MultithreadedSimulatorTestCase ();
+  virtual void DoRun (void);
+private:
+  typedef std::vector<std::pair<uint64_t, uint32_t> > Log;
+  void Local (uint32_t context, uint32_t hops);
+  void Remote (uint32_t from, uint32_t hops);
+  void Global (void);
+  void Cancelled (uint32_t context);
+  std::vector<Log> Run (Ptr<SimulatorImpl> impl);
+  Ptr<SimulatorImpl> CreateMultithreaded (uint32_t threads) const;
+
+  static const uint32_t N_CONTEXTS = 16;
+  std::vector<Log> m_logs;
+  std::vector<int> m_contextOk; // not bool, whose elements share words
+  uint32_t m_globals;
+};
+
+MultithreadedSimulatorTestCase::MultithreadedSimulatorTestCase ()
+  : TestCase ("Check that MultithreadedSimulatorImpl runs the events of each context "
+              "like DefaultSimulatorImpl, and repeatably")
+{
+}
+
+void
+MultithreadedSimulatorTestCase::Local (uint32_t context, uint32_t hops)
+{
+  m_contextOk[context] = m_contextOk[context] && Simulator::GetContext () == context;
+  m_logs[context].push_back (std::make_pair (Simulator::Now ().GetTimeStep (), hops));
+  if (hops == 0)
+    {
+      return;
+    }
+  // Three local events and one for a context which is likely to be in
+  // another partition, no sooner than the lookahead
+  Simulator::Schedule (MicroSeconds (1 + hops % 3), &MultithreadedSimulatorTestCase::Local, this, context, hops - 1);
+  Simulator::Schedule (MicroSeconds (7), &MultithreadedSimulatorTestCase::Cancelled, this, context).Cancel ();
+  if (hops % 4 == 0)
+    {
+      Simulator::ScheduleWithContext ((context * 5 + 3) % N_CONTEXTS, MicroSeconds (10 + context),
+                                      &MultithreadedSimulatorTestCase::Remote, this, context, hops - 1);
+    }
+}
+
+void
+MultithreadedSimulatorTestCase::Remote (uint32_t from, uint32_t hops)
+{
+  uint32_t context = Simulator::GetContext ();
+  m_logs[context].push_back (std::make_pair (Simulator::Now ().GetTimeStep (), 1000 + from));
+  Simulator::Schedule (MicroSeconds (2), &MultithreadedSimulatorTestCase::Local, this, context, hops / 2);
+}
+
+void
+MultithreadedSimulatorTestCase::Global (void)
+{
+  m_globals++;
+}
+
+void
+MultithreadedSimulatorTestCase::Cancelled (uint32_t context)
+{
+  m_contextOk[context] = 0;
+}
+
+Ptr<SimulatorImpl>
+MultithreadedSimulatorTestCase::CreateMultithreaded (uint32_t threads) const
+{
+  ObjectFactory factory;
+  factory.SetTypeId (MultithreadedSimulatorImpl::GetTypeId ());
+  factory.Set ("Lookahead", TimeValue (MicroSeconds (10)));
+  factory.Set ("MaxThreads", UintegerValue (threads));
+  return factory.Create<SimulatorImpl> ();
+}
+
+std::vector<MultithreadedSimulatorTestCase::Log>
+MultithreadedSimulatorTestCase::Run (Ptr<SimulatorImpl> impl)
+{
+  Simulator::SetImplementation (impl);
+  m_logs.assign (N_CONTEXTS, Log ());
+  m_contextOk.assign (N_CONTEXTS, 1);
+  m_globals = 0;
+  for (uint32_t i = 0; i < N_CONTEXTS; i++)
+    {
+      Simulator::ScheduleWithContext (i, MicroSeconds (i), &MultithreadedSimulatorTestCase::Local, this, i, 40);
+    }
+  for (uint32_t i = 1; i <= 10; i++)
+    {
+      Simulator::Schedule (MicroSeconds (i * 13), &MultithreadedSimulatorTestCase::Global, this);
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+  return m_logs;
+}
+
+void
+MultithreadedSimulatorTestCase::DoRun (void)
+{
+  std::vector<Log> reference = Run (CreateObject<DefaultSimulatorImpl> ());
+  std::vector<Log> single = Run (CreateMultithreaded (1));
+  std::vector<Log> first = Run (CreateMultithreaded (4));
+  NS_TEST_ASSERT_MSG_EQ (m_globals, 10, "Global events lost");
+  for (uint32_t i = 0; i < N_CONTEXTS; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (m_contextOk[i], 1, "Event run in the wrong context, or after its cancellation");
+    }
+  std::vector<Log> second = Run (CreateMultithreaded (4));
+  for (uint32_t i = 0; i < N_CONTEXTS; i++)
+    {
+      // Events at the same time may run in another order than with
+      // DefaultSimulatorImpl, or with another number of threads, but in
+      // the same order at every run
+      NS_TEST_ASSERT_MSG_EQ ((first[i] == second[i]), true, "Runs differ for context " << i);
+      std::sort (reference[i].begin (), reference[i].end ());
+      std::sort (single[i].begin (), single[i].end ());
+      std::sort (first[i].begin (), first[i].end ());
+      NS_TEST_ASSERT_MSG_EQ (reference[i].size (), first[i].size (), "Events lost for context " << i);
+      NS_TEST_ASSERT_MSG_EQ ((reference[i] == single[i]), true, "Events differ for context " << i << " with one thread");
+      NS_TEST_ASSERT_MSG_EQ ((reference[i] == first[i]), true, "Events differ for context " << i);
+    }
+}
+
+class MultithreadedSimulatorStopTestCase : public TestCase
+{
+public:
+  MultithreadedSimulatorStopTestCase ();
+  virtual void DoRun (void);
+private:
+  void Tick (uint32_t context);
+  void StopNow (void);
+  std::vector<uint64_t> m_last;
+};
+
+MultithreadedSimulatorStopTestCase::MultithreadedSimulatorStopTestCase ()
+  : TestCase ("Check that MultithreadedSimulatorImpl stops at the time given to Stop")
+{
+}
+
+void
+MultithreadedSimulatorStopTestCase::Tick (uint32_t context)
+{
+  m_last[context] = Simulator::Now ().GetTimeStep ();
+  Simulator::Schedule (MicroSeconds (3), &MultithreadedSimulatorStopTestCase::Tick, this, context);
+}
+
+void
+MultithreadedSimulatorStopTestCase::StopNow (void)
+{
+  Simulator::Stop (Seconds (0));
+}
+
+void
+MultithreadedSimulatorStopTestCase::DoRun (void)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (MultithreadedSimulatorImpl::GetTypeId ());
+  factory.Set ("Lookahead", TimeValue (MicroSeconds (10)));
+  factory.Set ("MaxThreads", UintegerValue (3));
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+  m_last.assign (8, 0);
+  for (uint32_t i = 0; i < m_last.size (); i++)
+    {
+      Simulator::ScheduleWithContext (i, MicroSeconds (i), &MultithreadedSimulatorStopTestCase::Tick, this, i);
+    }
+  Simulator::Stop (MicroSeconds (1000));
+  Simulator::Run ();
+  NS_TEST_ASSERT_MSG_EQ (Simulator::Now (), MicroSeconds (1000), "Stopped at the wrong time");
+  for (uint32_t i = 0; i < m_last.size (); i++)
+    {
+      // The last tick before the stop, which runs ahead of the events
+      // of the partitions at the same time
+      uint64_t expected = i + 3 * ((999 - i) / 3);
+      NS_TEST_ASSERT_MSG_EQ (m_last[i], MicroSeconds (expected).GetTimeStep (), "Wrong last event of context " << i);
+    }
+  NS_TEST_ASSERT_MSG_EQ (Simulator::IsFinished (), true, "Not finished after Stop");
+  NS_TEST_ASSERT_MSG_EQ (MultithreadedSimulatorImpl::IsRemote (5), false, "Remote contexts once Run returned");
+  Simulator::Destroy ();
+
+  // Stopped by the event of a node, within a window: at the end of it
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+  for (uint32_t i = 0; i < m_last.size (); i++)
+    {
+      Simulator::ScheduleWithContext (i, MicroSeconds (i), &MultithreadedSimulatorStopTestCase::Tick, this, i);
+    }
+  Simulator::ScheduleWithContext (2, MicroSeconds (500), &MultithreadedSimulatorStopTestCase::StopNow, this);
+  Simulator::Run ();
+  NS_TEST_ASSERT_MSG_EQ ((Simulator::Now () >= MicroSeconds (500)), true, "Stopped before the Stop");
+  NS_TEST_ASSERT_MSG_EQ ((Simulator::Now () <= MicroSeconds (510)), true, "Stopped after the window");
+  Simulator::Destroy ();
+}
+
+// The workers of MultithreadedSimulatorImpl exit at the end of every
+// Run, and events cross the partitions: the events they release must
+// go back to the pool.
+class MultithreadedSimulatorPoolTestCase : public TestCase
+{
+public:
+  MultithreadedSimulatorPoolTestCase ();
+  virtual void DoRun (void);
+private:
+  void Hop (uint32_t context, uint32_t hops);
+  void Run (void);
+
+  static const uint32_t N_CONTEXTS = 8;
+};
+
+MultithreadedSimulatorPoolTestCase::MultithreadedSimulatorPoolTestCase ()
+  : TestCase ("Check that the event pool does not grow over the runs of MultithreadedSimulatorImpl")
+{
+}
+
+void
+MultithreadedSimulatorPoolTestCase::Hop (uint32_t context, uint32_t hops)
+{
+  if (hops == 0)
+    {
+      return;
+    }
+  for (uint32_t i = 0; i < 20; i++)
+    {
+      Simulator::Schedule (MicroSeconds (1 + i), &MultithreadedSimulatorPoolTestCase::Hop, this, context, 0);
+    }
+  Simulator::Schedule (MicroSeconds (3), &MultithreadedSimulatorPoolTestCase::Hop, this, context, hops - 1);
+  // Allocated in this partition, released in another one
+  Simulator::ScheduleWithContext ((context + 1) % N_CONTEXTS, MicroSeconds (10),
+                                  &MultithreadedSimulatorPoolTestCase::Hop, this, context, 0);
+}
+
+void
+MultithreadedSimulatorPoolTestCase::Run (void)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (MultithreadedSimulatorImpl::GetTypeId ());
+  factory.Set ("Lookahead", TimeValue (MicroSeconds (10)));
+  factory.Set ("MaxThreads", UintegerValue (4));
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+  for (uint32_t i = 0; i < N_CONTEXTS; i++)
+    {
+      Simulator::ScheduleWithContext (i, MicroSeconds (i), &MultithreadedSimulatorPoolTestCase::Hop, this, i, 500);
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+void
+MultithreadedSimulatorPoolTestCase::DoRun (void)
+{
+  Run ();
+  std::size_t first = EventImpl::GetPoolMemory ();
+  Run ();
+  std::size_t warm = EventImpl::GetPoolMemory ();
+  for (uint32_t i = 0; i < 8; i++)
+    {
+      Run ();
+    }
+  // Every run used to leak the free lists of its workers, about as much
+  // as the first run allocated
+  NS_TEST_ASSERT_MSG_LT (EventImpl::GetPoolMemory () - warm, first, "The event pool grows with the runs");
+}
+
+class MultithreadedSimulatorTestSuite : public TestSuite
+{
+public:
+  MultithreadedSimulatorTestSuite ()
+    : TestSuite ("multithreaded-simulator")
+  {
+    AddTestCase (new MultithreadedSimulatorTestCase (), TestCase::QUICK);
+    AddTestCase (new MultithreadedSimulatorStopTestCase (), TestCase::QUICK);
+    AddTestCase (new MultithreadedSimulatorPoolTestCase (), TestCase::QUICK);
+  }
+} g_multithreadedSimulatorTestSuite;
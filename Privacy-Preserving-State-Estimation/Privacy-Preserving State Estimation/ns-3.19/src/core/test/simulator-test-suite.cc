@@ -23,6 +23,9 @@
 #include "ns3/heap-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
+#include "ns3/ladder-scheduler.h"
+#include <set>
+#include <vector>
 
 using namespace ns3;
 
@@ -459,6 +462,157 @@ SimulatorTemplateTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+class SchedulerOrderTestCase : public TestCase
+{
+public:
+  SchedulerOrderTestCase (ObjectFactory schedulerFactory);
+  virtual void DoRun (void);
+private:
+  uint32_t Random (uint32_t n);
+  ObjectFactory m_schedulerFactory;
+  uint32_t m_state;
+};
+
+SchedulerOrderTestCase::SchedulerOrderTestCase (ObjectFactory schedulerFactory)
+  : TestCase ("Check that " + schedulerFactory.GetTypeId ().GetName () +
+              " returns events in order through bursts, removals and spread timestamps"),
+    m_schedulerFactory (schedulerFactory),
+    m_state (1)
+{
+}
+
+uint32_t
+SchedulerOrderTestCase::Random (uint32_t n)
+{
+  m_state = m_state * 1103515245 + 12345;
+  return (m_state >> 8) % n;
+}
+
+void
+SchedulerOrderTestCase::DoRun (void)
+{
+  Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler> ();
+  std::set<Scheduler::EventKey> reference;
+  uint64_t now = 0;
+  uint32_t uid = 0;
+  for (uint32_t round = 0; round < 2000; round++)
+    {
+      // Insert a burst: many events at the same time, or spread out
+      uint32_t burst = Random (20);
+      uint64_t spread = Random (4) == 0 ? 1000000000 : (Random (2) ? 1000 : 0);
+      uint64_t base = now + Random (100000);
+      for (uint32_t i = 0; i < burst; i++)
+        {
+          Scheduler::Event ev;
+          ev.impl = 0;
+          ev.key.m_ts = base + (spread ? Random (spread) : 0);
+          ev.key.m_uid = uid++;
+          ev.key.m_context = 0;
+          scheduler->Insert (ev);
+          reference.insert (ev.key);
+        }
+      // Remove a pending event, like a cancelled timer
+      if (!reference.empty () && Random (3) == 0)
+        {
+          std::set<Scheduler::EventKey>::iterator i = reference.begin ();
+          std::advance (i, Random (std::min<uint32_t> (reference.size (), 50)));
+          Scheduler::Event ev;
+          ev.impl = 0;
+          ev.key = *i;
+          scheduler->Remove (ev);
+          reference.erase (i);
+        }
+      // Process some events
+      uint32_t n = Random (20);
+      for (uint32_t i = 0; i < n && !reference.empty (); i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (scheduler->IsEmpty (), false, "Scheduler lost events");
+          Scheduler::Event ev = scheduler->RemoveNext ();
+          NS_TEST_ASSERT_MSG_EQ (ev.key.m_uid, reference.begin ()->m_uid, "Event out of order");
+          now = ev.key.m_ts;
+          reference.erase (reference.begin ());
+        }
+    }
+  while (!reference.empty ())
+    {
+      NS_TEST_ASSERT_MSG_EQ (scheduler->PeekNext ().key.m_uid, reference.begin ()->m_uid, "Event out of order");
+      NS_TEST_ASSERT_MSG_EQ (scheduler->RemoveNext ().key.m_uid, reference.begin ()->m_uid, "Event out of order");
+      reference.erase (reference.begin ());
+    }
+  NS_TEST_EXPECT_MSG_EQ (scheduler->IsEmpty (), true, "Scheduler has extra events");
+}
+
+class EventPoolTestCase : public TestCase
+{
+public:
+  EventPoolTestCase ();
+  virtual void DoRun (void);
+private:
+  struct Large
+  {
+    uint32_t values[100];
+  };
+  void Small (uint32_t value);
+  void Medium (uint32_t a, double b, uint64_t c, Time d, uint32_t value);
+  void Big (Large large, uint32_t value);
+  uint64_t m_sum;
+};
+
+EventPoolTestCase::EventPoolTestCase ()
+  : TestCase ("Check that events of every size are allocated, recycled and released")
+{
+}
+
+void
+EventPoolTestCase::Small (uint32_t value)
+{
+  m_sum += value;
+}
+
+void
+EventPoolTestCase::Medium (uint32_t a, double b, uint64_t c, Time d, uint32_t value)
+{
+  NS_TEST_EXPECT_MSG_EQ (a + c + d.GetSeconds (), 2 * value + 1, "Argument corrupted");
+  m_sum += value;
+}
+
+void
+EventPoolTestCase::Big (Large large, uint32_t value)
+{
+  NS_TEST_EXPECT_MSG_EQ (large.values[99], value, "Argument corrupted");
+  m_sum += value;
+}
+
+void
+EventPoolTestCase::DoRun (void)
+{
+  // Events of the three sizes, the largest one beyond the pooled sizes,
+  // scheduled over several rounds so that their storage is reused
+  m_sum = 0;
+  uint64_t expected = 0;
+  Large large;
+  for (uint32_t round = 0; round < 3; round++)
+    {
+      std::vector<EventId> cancelled;
+      for (uint32_t i = 0; i < 1000; i++)
+        {
+          large.values[99] = i;
+          Simulator::Schedule (NanoSeconds (i), &EventPoolTestCase::Small, this, i);
+          Simulator::Schedule (NanoSeconds (i), &EventPoolTestCase::Medium, this, i, 0.5, i, Seconds (1), i);
+          Simulator::Schedule (NanoSeconds (i), &EventPoolTestCase::Big, this, large, i);
+          cancelled.push_back (Simulator::Schedule (NanoSeconds (i), &EventPoolTestCase::Small, this, 1));
+          expected += 3 * i;
+        }
+      for (std::vector<EventId>::iterator i = cancelled.begin (); i != cancelled.end (); ++i)
+        {
+          i->Cancel ();
+        }
+      Simulator::Run ();
+      NS_TEST_ASSERT_MSG_EQ (m_sum, expected, "Events lost or corrupted");
+    }
+  Simulator::Destroy ();
+}
+
 class SimulatorTestSuite : public TestSuite
 {
 public:
@@ -475,5 +629,18 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (CalendarScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (LadderScheduler::GetTypeId ());
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+
+    // HeapScheduler::Remove only sifts the replacement event down, so
+    // it is left out of the removals of SchedulerOrderTestCase
+    factory.SetTypeId (MapScheduler::GetTypeId ());
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (CalendarScheduler::GetTypeId ());
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (LadderScheduler::GetTypeId ());
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
+
+    AddTestCase (new EventPoolTestCase (), TestCase::QUICK);
   }
 } g_simulatorTestSuite;
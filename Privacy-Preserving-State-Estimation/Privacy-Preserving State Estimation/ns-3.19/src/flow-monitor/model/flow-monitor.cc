@@ -22,6 +22,7 @@
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include "ns3/double.h"
+#include "ns3/trace-source-accessor.h"
 #include <fstream>
 #include <sstream>
 
@@ -34,6 +35,197 @@ namespace ns3 {
 NS_LOG_COMPONENT_DEFINE ("FlowMonitor")
   ;
 
+/// Marks an empty slot, and the ends of the lists
+static const uint32_t NO_PACKET = 0xffffffff;
+/// The flows of lower identifiers are indexed, as the classifiers
+/// allocate them from 1 up
+static const FlowId MAX_INDEXED_FLOW_ID = 1 << 16;
+
+FlowMonitor::TrackedPacketTable::TrackedPacketTable ()
+  : m_shift (0),
+    m_size (0),
+    m_free (NO_PACKET),
+    m_oldest (NO_PACKET),
+    m_newest (NO_PACKET)
+{
+  Rehash (64);
+}
+
+uint32_t
+FlowMonitor::TrackedPacketTable::GetHome (FlowId flowId, FlowPacketId packetId) const
+{
+  // Fibonacci hashing of the pair, whose high bits are the best mixed
+  uint64_t key = (static_cast<uint64_t> (flowId) << 32) | packetId;
+  return static_cast<uint32_t> ((key * 0x9e3779b97f4a7c15ULL) >> m_shift);
+}
+
+void
+FlowMonitor::TrackedPacketTable::Rehash (uint32_t nSlots)
+{
+  uint32_t bits = 0;
+  while ((1U << bits) < nSlots)
+    {
+      bits++;
+    }
+  m_shift = 64 - bits;
+  m_slots.assign (1U << bits, NO_PACKET);
+  uint32_t mask = m_slots.size () - 1;
+  for (uint32_t i = m_oldest; i != NO_PACKET; i = m_packets[i].next)
+    {
+      uint32_t slot = GetHome (m_packets[i].flowId, m_packets[i].packetId);
+      while (m_slots[slot] != NO_PACKET)
+        {
+          slot = (slot + 1) & mask;
+        }
+      m_slots[slot] = i;
+    }
+}
+
+FlowMonitor::TrackedPacket *
+FlowMonitor::TrackedPacketTable::Find (FlowId flowId, FlowPacketId packetId)
+{
+  uint32_t mask = m_slots.size () - 1;
+  for (uint32_t slot = GetHome (flowId, packetId); m_slots[slot] != NO_PACKET; slot = (slot + 1) & mask)
+    {
+      TrackedPacket &packet = m_packets[m_slots[slot]];
+      if (packet.flowId == flowId && packet.packetId == packetId)
+        {
+          return &packet;
+        }
+    }
+  return 0;
+}
+
+FlowMonitor::TrackedPacket *
+FlowMonitor::TrackedPacketTable::Insert (FlowId flowId, FlowPacketId packetId)
+{
+  TrackedPacket *found = Find (flowId, packetId);
+  if (found != 0)
+    {
+      Touch (found);
+      return found;
+    }
+  // At most half of the slots are used, which keeps the probes short
+  if (2 * (m_size + 1) > m_slots.size ())
+    {
+      Rehash (2 * m_slots.size ());
+    }
+  uint32_t index;
+  if (m_free != NO_PACKET)
+    {
+      index = m_free;
+      m_free = m_packets[index].next;
+    }
+  else
+    {
+      index = m_packets.size ();
+      m_packets.push_back (TrackedPacket ());
+    }
+  TrackedPacket &packet = m_packets[index];
+  packet.flowId = flowId;
+  packet.packetId = packetId;
+  uint32_t mask = m_slots.size () - 1;
+  uint32_t slot = GetHome (flowId, packetId);
+  while (m_slots[slot] != NO_PACKET)
+    {
+      slot = (slot + 1) & mask;
+    }
+  m_slots[slot] = index;
+  m_size++;
+  Link (index);
+  return &packet;
+}
+
+void
+FlowMonitor::TrackedPacketTable::Link (uint32_t index)
+{
+  m_packets[index].previous = m_newest;
+  m_packets[index].next = NO_PACKET;
+  if (m_newest != NO_PACKET)
+    {
+      m_packets[m_newest].next = index;
+    }
+  else
+    {
+      m_oldest = index;
+    }
+  m_newest = index;
+}
+
+void
+FlowMonitor::TrackedPacketTable::Unlink (uint32_t index)
+{
+  TrackedPacket &packet = m_packets[index];
+  if (packet.previous != NO_PACKET)
+    {
+      m_packets[packet.previous].next = packet.next;
+    }
+  else
+    {
+      m_oldest = packet.next;
+    }
+  if (packet.next != NO_PACKET)
+    {
+      m_packets[packet.next].previous = packet.previous;
+    }
+  else
+    {
+      m_newest = packet.previous;
+    }
+}
+
+void
+FlowMonitor::TrackedPacketTable::Touch (TrackedPacket *packet)
+{
+  uint32_t index = packet - &m_packets[0];
+  if (index != m_newest)
+    {
+      Unlink (index);
+      Link (index);
+    }
+}
+
+void
+FlowMonitor::TrackedPacketTable::Erase (TrackedPacket *packet)
+{
+  uint32_t index = packet - &m_packets[0];
+  uint32_t mask = m_slots.size () - 1;
+  uint32_t hole = GetHome (packet->flowId, packet->packetId);
+  while (m_slots[hole] != index)
+    {
+      hole = (hole + 1) & mask;
+    }
+  // Shift back the following packets of the cluster which may not be
+  // found past the hole, rather than leave a tombstone
+  for (uint32_t slot = (hole + 1) & mask; m_slots[slot] != NO_PACKET; slot = (slot + 1) & mask)
+    {
+      const TrackedPacket &next = m_packets[m_slots[slot]];
+      uint32_t home = GetHome (next.flowId, next.packetId);
+      if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+          m_slots[hole] = m_slots[slot];
+          hole = slot;
+        }
+    }
+  m_slots[hole] = NO_PACKET;
+  m_size--;
+  Unlink (index);
+  packet->next = m_free;
+  m_free = index;
+}
+
+FlowMonitor::TrackedPacket *
+FlowMonitor::TrackedPacketTable::GetOldest (void)
+{
+  return m_oldest == NO_PACKET ? 0 : &m_packets[m_oldest];
+}
+
+uint32_t
+FlowMonitor::TrackedPacketTable::GetSize (void) const
+{
+  return m_size;
+}
+
 NS_OBJECT_ENSURE_REGISTERED (FlowMonitor)
   ;
 
@@ -73,6 +265,13 @@ FlowMonitor::GetTypeId (void)
                    TimeValue (Seconds (0.5)),
                    MakeTimeAccessor (&FlowMonitor::m_flowInterruptionsMinTime),
                    MakeTimeChecker ())
+    .AddAttribute ("SnapshotInterval", ("The interval between the snapshots of the flow statistics, "
+                                        "zero for no snapshots."),
+                   TimeValue (Seconds (0.0)),
+                   MakeTimeAccessor (&FlowMonitor::SetSnapshotInterval),
+                   MakeTimeChecker ())
+    .AddTraceSource ("Window", "The changes of the statistics of a flow between two snapshots.",
+                     MakeTraceSourceAccessor (&FlowMonitor::m_windowTrace))
   ;
   return tid;
 }
@@ -92,6 +291,8 @@ FlowMonitor::FlowMonitor ()
 void
 FlowMonitor::DoDispose (void)
 {
+  Simulator::Cancel (m_snapshotEvent);
+  m_windowSink = 0;
   m_classifier = 0;
   for (uint32_t i = 0; i < m_flowProbes.size (); i++)
     {
@@ -104,11 +305,23 @@ FlowMonitor::DoDispose (void)
 inline FlowMonitor::FlowStats&
 FlowMonitor::GetStatsForFlow (FlowId flowId)
 {
+  if (flowId < m_flowStatsIndex.size () && m_flowStatsIndex[flowId] != 0)
+    {
+      return *m_flowStatsIndex[flowId];
+    }
   std::map<FlowId, FlowStats>::iterator iter;
   iter = m_flowStats.find (flowId);
   if (iter == m_flowStats.end ())
     {
       FlowMonitor::FlowStats &ref = m_flowStats[flowId];
+      if (flowId < MAX_INDEXED_FLOW_ID)
+        {
+          if (flowId >= m_flowStatsIndex.size ())
+            {
+              m_flowStatsIndex.resize (flowId + 1, 0);
+            }
+          m_flowStatsIndex[flowId] = &ref;
+        }
       ref.delaySum = Seconds (0);
       ref.jitterSum = Seconds (0);
       ref.lastDelay = Seconds (0);
@@ -138,8 +351,11 @@ FlowMonitor::ReportFirstTx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t pack
     {
       return;
     }
+#ifdef NS3_MULTITHREADED
+  CriticalSection cs (m_mutex);
+#endif
   Time now = Simulator::Now ();
-  TrackedPacket &tracked = m_trackedPackets[std::make_pair (flowId, packetId)];
+  TrackedPacket &tracked = *m_trackedPackets.Insert (flowId, packetId);
   tracked.firstSeenTime = now;
   tracked.lastSeenTime = tracked.firstSeenTime;
   tracked.timesForwarded = 0;
@@ -166,19 +382,22 @@ FlowMonitor::ReportForwarding (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t p
     {
       return;
     }
-  std::pair<FlowId, FlowPacketId> key (flowId, packetId);
-  TrackedPacketMap::iterator tracked = m_trackedPackets.find (key);
-  if (tracked == m_trackedPackets.end ())
+#ifdef NS3_MULTITHREADED
+  CriticalSection cs (m_mutex);
+#endif
+  TrackedPacket *tracked = m_trackedPackets.Find (flowId, packetId);
+  if (tracked == 0)
     {
       NS_LOG_WARN ("Received packet forward report (flowId=" << flowId << ", packetId=" << packetId
                                                              << ") but not known to be transmitted.");
       return;
     }
 
-  tracked->second.timesForwarded++;
-  tracked->second.lastSeenTime = Simulator::Now ();
+  tracked->timesForwarded++;
+  tracked->lastSeenTime = Simulator::Now ();
+  m_trackedPackets.Touch (tracked);
 
-  Time delay = (Simulator::Now () - tracked->second.firstSeenTime);
+  Time delay = (Simulator::Now () - tracked->firstSeenTime);
   probe->AddPacketStats (flowId, packetSize, delay);
 }
 
@@ -190,8 +409,11 @@ FlowMonitor::ReportLastRx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packe
     {
       return;
     }
-  TrackedPacketMap::iterator tracked = m_trackedPackets.find (std::make_pair (flowId, packetId));
-  if (tracked == m_trackedPackets.end ())
+#ifdef NS3_MULTITHREADED
+  CriticalSection cs (m_mutex);
+#endif
+  TrackedPacket *tracked = m_trackedPackets.Find (flowId, packetId);
+  if (tracked == 0)
     {
       NS_LOG_WARN ("Received packet last-tx report (flowId=" << flowId << ", packetId=" << packetId
                                                              << ") but not known to be transmitted.");
@@ -199,7 +421,7 @@ FlowMonitor::ReportLastRx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packe
     }
 
   Time now = Simulator::Now ();
-  Time delay = (now - tracked->second.firstSeenTime);
+  Time delay = (now - tracked->firstSeenTime);
   probe->AddPacketStats (flowId, packetSize, delay);
 
   FlowStats &stats = GetStatsForFlow (flowId);
@@ -238,12 +460,12 @@ FlowMonitor::ReportLastRx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packe
         }
     }
   stats.timeLastRxPacket = now;
-  stats.timesForwarded += tracked->second.timesForwarded;
+  stats.timesForwarded += tracked->timesForwarded;
 
   NS_LOG_DEBUG ("ReportLastTx: removing tracked packet (flowId="
                 << flowId << ", packetId=" << packetId << ").");
 
-  m_trackedPackets.erase (tracked); // we don't need to track this packet anymore
+  m_trackedPackets.Erase (tracked); // we don't need to track this packet anymore
 }
 
 void
@@ -254,6 +476,9 @@ FlowMonitor::ReportDrop (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packetI
     {
       return;
     }
+#ifdef NS3_MULTITHREADED
+  CriticalSection cs (m_mutex);
+#endif
 
   probe->AddPacketDropStats (flowId, packetSize, reasonCode);
 
@@ -268,14 +493,14 @@ FlowMonitor::ReportDrop (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packetI
   stats.bytesDropped[reasonCode] += packetSize;
   NS_LOG_DEBUG ("++stats.packetsDropped[" << reasonCode<< "]; // becomes: " << stats.packetsDropped[reasonCode]);
 
-  TrackedPacketMap::iterator tracked = m_trackedPackets.find (std::make_pair (flowId, packetId));
-  if (tracked != m_trackedPackets.end ())
+  TrackedPacket *tracked = m_trackedPackets.Find (flowId, packetId);
+  if (tracked != 0)
     {
       // we don't need to track this packet anymore
       // FIXME: this will not necessarily be true with broadcast/multicast
       NS_LOG_DEBUG ("ReportDrop: removing tracked packet (flowId="
                     << flowId << ", packetId=" << packetId << ").");
-      m_trackedPackets.erase (tracked);
+      m_trackedPackets.Erase (tracked);
     }
 }
 
@@ -291,24 +516,20 @@ FlowMonitor::CheckForLostPackets (Time maxDelay)
 {
   Time now = Simulator::Now ();
 
-  for (TrackedPacketMap::iterator iter = m_trackedPackets.begin ();
-       iter != m_trackedPackets.end (); )
+  // The packets are in the order in which they were last seen, so the
+  // lost ones are at the front
+  for (TrackedPacket *oldest = m_trackedPackets.GetOldest ();
+       oldest != 0 && now - oldest->lastSeenTime >= maxDelay;
+       oldest = m_trackedPackets.GetOldest ())
     {
-      if (now - iter->second.lastSeenTime >= maxDelay)
-        {
-          // packet is considered lost, add it to the loss statistics
-          std::map<FlowId, FlowStats>::iterator
-            flow = m_flowStats.find (iter->first.first);
-          NS_ASSERT (flow != m_flowStats.end ());
-          flow->second.lostPackets++;
-
-          // we won't track it anymore
-          m_trackedPackets.erase (iter++);
-        }
-      else
-        {
-          iter++;
-        }
+      // packet is considered lost, add it to the loss statistics
+      std::map<FlowId, FlowStats>::iterator
+        flow = m_flowStats.find (oldest->flowId);
+      NS_ASSERT (flow != m_flowStats.end ());
+      flow->second.lostPackets++;
+
+      // we won't track it anymore
+      m_trackedPackets.Erase (oldest);
     }
 }
 
@@ -496,5 +717,103 @@ FlowMonitor::SerializeToXmlFile (std::string fileName, bool enableHistograms, bo
 }
 
 
+void
+FlowMonitor::SetSnapshotInterval (const Time &interval)
+{
+  Simulator::Cancel (m_snapshotEvent);
+  m_snapshotInterval = interval;
+  if (m_snapshotInterval.IsStrictlyPositive ())
+    {
+      m_snapshotEvent = Simulator::Schedule (m_snapshotInterval, &FlowMonitor::Snapshot, this);
+    }
+}
+
+void
+FlowMonitor::SetWindowSink (Ptr<ResultSink> sink)
+{
+  m_windowSink = sink;
+  const char *columns[] = { "time", "flow", "tx-packets", "rx-packets", "lost-packets", "tx-bytes", "rx-bytes",
+                            "times-forwarded", "delay-sum", "jitter-sum", "delay-histogram" };
+  for (uint32_t i = 0; i < sizeof (columns) / sizeof (columns[0]); i++)
+    {
+      m_windowSink->AddColumn (columns[i]);
+    }
+}
+
+void
+FlowMonitor::Snapshot ()
+{
+  Time now = Simulator::Now ();
+  for (std::map<FlowId, FlowStats>::iterator flowI = m_flowStats.begin ();
+       flowI != m_flowStats.end (); flowI++)
+    {
+      FlowStats &stats = flowI->second;
+      FlowSnapshot &last = m_lastSnapshots[flowI->first];
+      FlowWindow window;
+      window.flowId = flowI->first;
+      window.start = m_lastSnapshotTime;
+      window.end = now;
+      window.txBytes = stats.txBytes - last.txBytes;
+      window.rxBytes = stats.rxBytes - last.rxBytes;
+      window.txPackets = stats.txPackets - last.txPackets;
+      window.rxPackets = stats.rxPackets - last.rxPackets;
+      window.lostPackets = stats.lostPackets - last.lostPackets;
+      window.timesForwarded = stats.timesForwarded - last.timesForwarded;
+      window.delaySum = stats.delaySum - last.delaySum;
+      window.jitterSum = stats.jitterSum - last.jitterSum;
+      last.txBytes = stats.txBytes;
+      last.rxBytes = stats.rxBytes;
+      last.txPackets = stats.txPackets;
+      last.rxPackets = stats.rxPackets;
+      last.lostPackets = stats.lostPackets;
+      last.timesForwarded = stats.timesForwarded;
+      last.delaySum = stats.delaySum;
+      last.jitterSum = stats.jitterSum;
+      if (window.txPackets == 0 && window.rxPackets == 0 && window.lostPackets == 0)
+        {
+          continue;
+        }
+
+      uint32_t nBins = stats.delayHistogram.GetNBins ();
+      last.delayHistogram.resize (nBins, 0);
+      for (uint32_t i = 0; i < nBins; i++)
+        {
+          uint32_t count = stats.delayHistogram.GetBinCount (i);
+          window.delayHistogram.push_back (count - last.delayHistogram[i]);
+          last.delayHistogram[i] = count;
+        }
+      while (!window.delayHistogram.empty () && window.delayHistogram.back () == 0)
+        {
+          window.delayHistogram.pop_back ();
+        }
+      m_windowTrace (window);
+
+      if (m_windowSink != 0)
+        {
+          // The bins which are not empty, as bin:count;bin:count
+          std::ostringstream bins;
+          for (uint32_t i = 0; i < window.delayHistogram.size (); i++)
+            {
+              if (window.delayHistogram[i] != 0)
+                {
+                  bins << (bins.tellp () > 0 ? ";" : "") << i << ":" << window.delayHistogram[i];
+                }
+            }
+          m_windowSink->Add (now.GetSeconds ()).Add (window.flowId)
+            .Add (window.txPackets).Add (window.rxPackets).Add (window.lostPackets)
+            .Add (window.txBytes).Add (window.rxBytes).Add (window.timesForwarded)
+            .Add (window.delaySum.GetSeconds ()).Add (window.jitterSum.GetSeconds ())
+            .Add (bins.tellp () > 0 ? bins.str () : std::string ("-"))
+            .EndRow ();
+        }
+    }
+  if (m_windowSink != 0)
+    {
+      m_windowSink->Write ();
+    }
+  m_lastSnapshotTime = now;
+  m_snapshotEvent = Simulator::Schedule (m_snapshotInterval, &FlowMonitor::Snapshot, this);
+}
+
 } // namespace ns3
 
@@ -31,6 +31,12 @@
 #include "ns3/histogram.h"
 #include "ns3/nstime.h"
 #include "ns3/event-id.h"
+#include "ns3/traced-callback.h"
+#include "ns3/result-sink.h"
+#include "ns3/core-config.h"
+#ifdef NS3_MULTITHREADED
+#include "ns3/system-mutex.h"
+#endif
 
 namespace ns3 {
 
@@ -137,6 +143,26 @@ public:
     Histogram flowInterruptionsHistogram; //!< histogram of durations of flow interruptions
   };
 
+  /// \brief Structure that represents the changes of the metrics of a
+  /// flow during a window of time, between two snapshots
+  struct FlowWindow
+  {
+    FlowId flowId;           //!< the flow
+    Time start;              //!< the time of the previous snapshot
+    Time end;                //!< the time of this snapshot
+    uint64_t txBytes;        //!< bytes transmitted during the window
+    uint64_t rxBytes;        //!< bytes received during the window
+    uint32_t txPackets;      //!< packets transmitted during the window
+    uint32_t rxPackets;      //!< packets received during the window
+    uint32_t lostPackets;    //!< packets dropped or found lost during the window
+    uint32_t timesForwarded; //!< forwards of the packets received during the window
+    Time delaySum;           //!< sum of the delays of the packets received during the window
+    Time jitterSum;          //!< sum of the jitters of the packets received during the window
+    /// Number of packets received during the window in each bin of
+    /// the delay histogram, up to the last which is not empty
+    std::vector<uint32_t> delayHistogram;
+  };
+
   // --- basic methods ---
   /**
    * \brief Get the type ID.
@@ -240,6 +266,17 @@ public:
   /// \param enableProbes if true, include also the per-probe/flow pair statistics in the output
   void SerializeToXmlFile (std::string fileName, bool enableHistograms, bool enableProbes);
 
+  /// Set the interval between the snapshots of the flow statistics,
+  /// after each of which the changes of the statistics of each flow
+  /// during the window are reported.  A zero interval disables them.
+  /// \param interval the interval between snapshots
+  void SetSnapshotInterval (const Time &interval);
+  /// Write the changes of the statistics of each flow during each
+  /// window to a sink, as a row per flow whose statistics changed.  The
+  /// rows of a window are written when it ends.
+  /// \param sink the sink of the rows, to which columns are added
+  void SetWindowSink (Ptr<ResultSink> sink);
+
 
 protected:
 
@@ -254,14 +291,62 @@ private:
     Time firstSeenTime; //!< absolute time when the packet was first seen by a probe
     Time lastSeenTime; //!< absolute time when the packet was last seen by a probe
     uint32_t timesForwarded; //!< number of times the packet was reportedly forwarded
+    FlowId flowId; //!< flow of the packet
+    FlowPacketId packetId; //!< identifier of the packet in its flow
+    uint32_t previous; //!< index of the packet last seen before this one
+    uint32_t next; //!< index of the packet last seen after this one, or of the next free entry
+  };
+
+  /**
+   * \brief The tracked packets, by (FlowId,PacketId)
+   *
+   * The packets are stored in a pool, indexed by an open addressing
+   * hash table with linear probing, and linked in the order in which
+   * they were last seen.  Since they are always seen at the current
+   * time, this order is that of lastSeenTime, like a timer wheel with
+   * a single bucket: the packets which are lost are at its front, and
+   * are found without looking at the others.  Lookups, insertions,
+   * removals and updates of the order take a constant time.
+   *
+   * The pointers returned are valid until the next insertion.
+   */
+  class TrackedPacketTable
+  {
+public:
+    TrackedPacketTable ();
+    /// \return the packet, or 0 if it is not tracked
+    TrackedPacket *Find (FlowId flowId, FlowPacketId packetId);
+    /// \return the packet, tracked if it was not, and moved to the back of the order
+    TrackedPacket *Insert (FlowId flowId, FlowPacketId packetId);
+    /// Move a packet to the back of the order, once seen
+    void Touch (TrackedPacket *packet);
+    /// Stop tracking a packet
+    void Erase (TrackedPacket *packet);
+    /// \return the packet seen the longest time ago, or 0 if none is tracked
+    TrackedPacket *GetOldest (void);
+    /// \return the number of packets tracked
+    uint32_t GetSize (void) const;
+private:
+    uint32_t GetHome (FlowId flowId, FlowPacketId packetId) const;
+    void Link (uint32_t index);
+    void Unlink (uint32_t index);
+    void Rehash (uint32_t nSlots);
+
+    std::vector<TrackedPacket> m_packets; //!< the pool of packets
+    std::vector<uint32_t> m_slots; //!< the hash table of the indices of the packets
+    uint32_t m_shift; //!< 64 minus the log2 of the number of slots
+    uint32_t m_size; //!< number of packets tracked
+    uint32_t m_free; //!< first free entry of the pool
+    uint32_t m_oldest; //!< front of the order
+    uint32_t m_newest; //!< back of the order
   };
 
   /// FlowId --> FlowStats
   std::map<FlowId, FlowStats> m_flowStats;
+  /// The entries of m_flowStats, by FlowId, for the lower identifiers
+  std::vector<FlowStats *> m_flowStatsIndex;
 
-  /// (FlowId,PacketId) --> TrackedPacket
-  typedef std::map< std::pair<FlowId, FlowPacketId>, TrackedPacket> TrackedPacketMap;
-  TrackedPacketMap m_trackedPackets; //!< Tracked packets
+  TrackedPacketTable m_trackedPackets; //!< Tracked packets
   Time m_maxPerHopDelay; //!< Minimum per-hop delay
   std::vector< Ptr<FlowProbe> > m_flowProbes; //!< all the FlowProbes
 
@@ -271,6 +356,9 @@ private:
   EventId m_startEvent;     //!< Start event
   EventId m_stopEvent;      //!< Stop event
   bool m_enabled;           //!< FlowMon is enabled
+#ifdef NS3_MULTITHREADED
+  SystemMutex m_mutex;      //!< Serializes the reports of the probes of several threads
+#endif
   double m_delayBinWidth;   //!< Delay bin width (for histograms)
   double m_jitterBinWidth;  //!< Jitter bin width (for histograms)
   double m_packetSizeBinWidth;  //!< packet size bin width (for histograms)
@@ -284,6 +372,31 @@ private:
 
   /// Periodic function to check for lost packets and prune statistics
   void PeriodicCheckForLostPackets ();
+
+  /// The statistics of a flow at the last snapshot
+  struct FlowSnapshot
+  {
+    uint64_t txBytes;                    //!< bytes transmitted
+    uint64_t rxBytes;                    //!< bytes received
+    uint32_t txPackets;                  //!< packets transmitted
+    uint32_t rxPackets;                  //!< packets received
+    uint32_t lostPackets;                //!< packets lost
+    uint32_t timesForwarded;             //!< forwards of the packets received
+    Time delaySum;                       //!< sum of the delays
+    Time jitterSum;                      //!< sum of the jitters
+    std::vector<uint32_t> delayHistogram; //!< counts of the delay histogram
+  };
+
+  /// Periodic function to report the changes of the flow statistics
+  void Snapshot ();
+
+  Time m_snapshotInterval;  //!< interval between snapshots
+  EventId m_snapshotEvent;  //!< next snapshot
+  Time m_lastSnapshotTime;  //!< time of the previous snapshot
+  std::map<FlowId, FlowSnapshot> m_lastSnapshots; //!< statistics at the previous snapshot
+  Ptr<ResultSink> m_windowSink; //!< sink of the windows, if any
+  /// the changes of the statistics of each flow during each window
+  TracedCallback<const FlowWindow &> m_windowTrace;
 };
 
 
@@ -152,6 +152,9 @@ Ipv4FlowClassifier::Classify (const Ipv4Header &ipHeader, Ptr<const Packet> ipPa
   tuple.sourcePort = srcPort;
   tuple.destinationPort = dstPort;
 
+#ifdef NS3_MULTITHREADED
+  CriticalSection cs (m_mutex);
+#endif
   // try to insert the tuple, but check if it already exists
   std::pair<std::map<FiveTuple, FlowId>::iterator, bool> insert
     = m_flowMap.insert (std::pair<FiveTuple, FlowId> (tuple, 0));
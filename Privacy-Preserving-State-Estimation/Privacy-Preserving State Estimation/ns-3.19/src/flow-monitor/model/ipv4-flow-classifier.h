@@ -26,6 +26,10 @@
 
 #include "ns3/ipv4-header.h"
 #include "ns3/flow-classifier.h"
+#include "ns3/core-config.h"
+#ifdef NS3_MULTITHREADED
+#include "ns3/system-mutex.h"
+#endif
 
 namespace ns3 {
 
@@ -72,6 +76,9 @@ private:
 
   /// Map to Flows Identifiers to FlowIds
   std::map<FiveTuple, FlowId> m_flowMap;
+#ifdef NS3_MULTITHREADED
+  SystemMutex m_mutex; //!< Serializes the packets classified by several threads
+#endif
 
 };
 
@@ -0,0 +1,336 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "ns3/flow-monitor.h"
+#include "ns3/flow-probe.h"
+#include "ns3/simulator.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/result-sink.h"
+#include "ns3/test.h"
+
+namespace ns3 {
+
+/// A probe to which the test case reports the packets
+class TestFlowProbe : public FlowProbe
+{
+public:
+  TestFlowProbe (Ptr<FlowMonitor> monitor)
+    : FlowProbe (monitor)
+  {
+  }
+};
+
+/**
+ * Reports random packets to a FlowMonitor, with many of them in flight,
+ * and compares its statistics with those of a plain map of the packets.
+ */
+class FlowMonitorTrackingTestCase : public TestCase
+{
+public:
+  FlowMonitorTrackingTestCase ();
+  virtual void DoRun (void);
+
+private:
+  /// The reference of a tracked packet: last seen time and forwards
+  struct Tracked
+  {
+    Time lastSeen;
+    uint32_t timesForwarded;
+  };
+  /// The expected statistics of a flow
+  struct Expected
+  {
+    uint32_t txPackets;
+    uint32_t rxPackets;
+    uint32_t lostPackets;
+    uint32_t timesForwarded;
+  };
+  void Step (uint32_t remaining);
+  void CheckLost (Time maxDelay);
+
+  Ptr<FlowMonitor> m_monitor;
+  Ptr<FlowProbe> m_probe;
+  Ptr<UniformRandomVariable> m_random;
+  std::map<std::pair<FlowId, FlowPacketId>, Tracked> m_tracked;
+  std::map<FlowId, Expected> m_expected;
+  FlowPacketId m_nextPacketId;
+};
+
+FlowMonitorTrackingTestCase::FlowMonitorTrackingTestCase ()
+  : TestCase ("Check the tracking of the packets and of their losses by FlowMonitor")
+{
+}
+
+void
+FlowMonitorTrackingTestCase::CheckLost (Time maxDelay)
+{
+  Time now = Simulator::Now ();
+  for (std::map<std::pair<FlowId, FlowPacketId>, Tracked>::iterator i = m_tracked.begin (); i != m_tracked.end (); )
+    {
+      if (now - i->second.lastSeen >= maxDelay)
+        {
+          m_expected[i->first.first].lostPackets++;
+          m_tracked.erase (i++);
+        }
+      else
+        {
+          ++i;
+        }
+    }
+  m_monitor->CheckForLostPackets (maxDelay);
+}
+
+void
+FlowMonitorTrackingTestCase::Step (uint32_t remaining)
+{
+  for (uint32_t op = 0; op < 8; op++)
+    {
+      FlowId flowId = 1 + m_random->GetInteger (0, 4);
+      uint32_t kind = m_random->GetInteger (0, 9);
+      if (kind < 4 || m_tracked.empty ())
+        {
+          FlowPacketId packetId = m_nextPacketId++;
+          m_monitor->ReportFirstTx (m_probe, flowId, packetId, 100);
+          Tracked tracked = { Simulator::Now (), 0 };
+          m_tracked[std::make_pair (flowId, packetId)] = tracked;
+          m_expected[flowId].txPackets++;
+          continue;
+        }
+      // A tracked packet, likely among the recent ones, or an unknown one
+      std::map<std::pair<FlowId, FlowPacketId>, Tracked>::iterator i =
+        m_tracked.lower_bound (std::make_pair (flowId, m_nextPacketId - m_random->GetInteger (1, 200)));
+      if (i == m_tracked.end ())
+        {
+          i = m_tracked.begin ();
+        }
+      FlowId id = i->first.first;
+      FlowPacketId packetId = i->first.second;
+      if (kind == 9)
+        {
+          packetId = m_nextPacketId + 1000;
+        }
+      bool known = kind != 9;
+      if (kind < 7)
+        {
+          m_monitor->ReportForwarding (m_probe, id, packetId, 100);
+          if (known)
+            {
+              i->second.lastSeen = Simulator::Now ();
+              i->second.timesForwarded++;
+            }
+        }
+      else if (kind == 7)
+        {
+          m_monitor->ReportLastRx (m_probe, id, packetId, 100);
+          if (known)
+            {
+              m_expected[id].rxPackets++;
+              m_expected[id].timesForwarded += i->second.timesForwarded;
+              m_tracked.erase (i);
+            }
+        }
+      else
+        {
+          m_monitor->ReportDrop (m_probe, id, packetId, 100, 0);
+          m_expected[id].lostPackets++;
+          if (known)
+            {
+              m_tracked.erase (i);
+            }
+        }
+    }
+  if (remaining % 500 == 0)
+    {
+      CheckLost (MilliSeconds (m_random->GetInteger (100, 400)));
+    }
+  if (remaining > 1)
+    {
+      Simulator::Schedule (MilliSeconds (1), &FlowMonitorTrackingTestCase::Step, this, remaining - 1);
+    }
+}
+
+void
+FlowMonitorTrackingTestCase::DoRun (void)
+{
+  RngSeedManager::SetSeed (3);
+  RngSeedManager::SetRun (1);
+  m_monitor = CreateObject<FlowMonitor> ();
+  // The packets are checked for losses by the test case only
+  m_monitor->SetAttribute ("MaxPerHopDelay", TimeValue (Seconds (1000)));
+  m_probe = CreateObject<TestFlowProbe> (m_monitor);
+  m_random = CreateObject<UniformRandomVariable> ();
+  m_nextPacketId = 1;
+  m_monitor->StartRightNow ();
+  Simulator::Schedule (MilliSeconds (1), &FlowMonitorTrackingTestCase::Step, this, 20000);
+  Simulator::Stop (Seconds (21));
+  Simulator::Run ();
+  CheckLost (Seconds (2));
+
+  std::map<FlowId, FlowMonitor::FlowStats> stats = m_monitor->GetFlowStats ();
+  NS_TEST_ASSERT_MSG_EQ (stats.size (), m_expected.size (), "Wrong number of flows");
+  for (std::map<FlowId, Expected>::const_iterator i = m_expected.begin (); i != m_expected.end (); ++i)
+    {
+      const FlowMonitor::FlowStats &flow = stats[i->first];
+      NS_TEST_ASSERT_MSG_EQ (flow.txPackets, i->second.txPackets, "Wrong txPackets of flow " << i->first);
+      NS_TEST_ASSERT_MSG_EQ (flow.rxPackets, i->second.rxPackets, "Wrong rxPackets of flow " << i->first);
+      NS_TEST_ASSERT_MSG_EQ (flow.lostPackets, i->second.lostPackets, "Wrong lostPackets of flow " << i->first);
+      NS_TEST_ASSERT_MSG_EQ (flow.timesForwarded, i->second.timesForwarded, "Wrong timesForwarded of flow " << i->first);
+    }
+  // Every packet not received was lost after all
+  CheckLost (Seconds (0));
+  NS_TEST_ASSERT_MSG_EQ (m_tracked.empty (), true, "Packets still tracked");
+  stats = m_monitor->GetFlowStats ();
+  for (std::map<FlowId, Expected>::const_iterator i = m_expected.begin (); i != m_expected.end (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (stats[i->first].lostPackets, i->second.lostPackets, "Wrong final lostPackets of flow " << i->first);
+    }
+  m_monitor->Dispose ();
+  m_monitor = 0;
+  m_probe = 0;
+  Simulator::Destroy ();
+}
+
+/**
+ * Reports packets at known times to a FlowMonitor which takes a
+ * snapshot every second, and checks the windows reported.
+ */
+class FlowMonitorWindowTestCase : public TestCase
+{
+public:
+  FlowMonitorWindowTestCase ();
+  virtual void DoRun (void);
+
+private:
+  void Tx (FlowId flowId, FlowPacketId packetId);
+  void Rx (FlowId flowId, FlowPacketId packetId);
+  void Window (const FlowMonitor::FlowWindow &window);
+
+  Ptr<FlowMonitor> m_monitor;
+  Ptr<FlowProbe> m_probe;
+  std::vector<FlowMonitor::FlowWindow> m_windows;
+};
+
+FlowMonitorWindowTestCase::FlowMonitorWindowTestCase ()
+  : TestCase ("Check the windows of the flow statistics between the snapshots of FlowMonitor")
+{
+}
+
+void
+FlowMonitorWindowTestCase::Tx (FlowId flowId, FlowPacketId packetId)
+{
+  m_monitor->ReportFirstTx (m_probe, flowId, packetId, 100);
+}
+
+void
+FlowMonitorWindowTestCase::Rx (FlowId flowId, FlowPacketId packetId)
+{
+  m_monitor->ReportLastRx (m_probe, flowId, packetId, 100);
+}
+
+void
+FlowMonitorWindowTestCase::Window (const FlowMonitor::FlowWindow &window)
+{
+  m_windows.push_back (window);
+}
+
+void
+FlowMonitorWindowTestCase::DoRun (void)
+{
+  std::string fileName = CreateTempDirFilename ("flow-monitor-windows.txt");
+  std::remove (fileName.c_str ());
+  m_monitor = CreateObject<FlowMonitor> ();
+  m_monitor->SetAttribute ("SnapshotInterval", TimeValue (Seconds (1)));
+  m_monitor->TraceConnectWithoutContext ("Window", MakeCallback (&FlowMonitorWindowTestCase::Window, this));
+  Ptr<ResultSink> sink = CreateObject<ResultSink> (fileName);
+  m_monitor->SetWindowSink (sink);
+  m_probe = CreateObject<TestFlowProbe> (m_monitor);
+  m_monitor->StartRightNow ();
+
+  // Flow 1 sends a packet every 100 ms during 2 s, received after 5 ms
+  // during the first second and 25 ms during the second; flow 2 sends
+  // a packet at 2.5 s which is never received
+  for (uint32_t i = 0; i < 20; i++)
+    {
+      Time tx = MilliSeconds (50 + 100 * i);
+      Simulator::Schedule (tx, &FlowMonitorWindowTestCase::Tx, this, 1, i);
+      Simulator::Schedule (tx + MilliSeconds (i < 10 ? 5 : 25), &FlowMonitorWindowTestCase::Rx, this, 1, i);
+    }
+  Simulator::Schedule (MilliSeconds (2500), &FlowMonitorWindowTestCase::Tx, this, 2, 0);
+  Simulator::Stop (Seconds (3.5));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_windows.size (), 3, "Wrong number of windows");
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      const FlowMonitor::FlowWindow &window = m_windows[i];
+      NS_TEST_ASSERT_MSG_EQ (window.flowId, 1, "Wrong flow");
+      NS_TEST_ASSERT_MSG_EQ (window.start, Seconds (i), "Wrong start");
+      NS_TEST_ASSERT_MSG_EQ (window.end, Seconds (i + 1), "Wrong end");
+      NS_TEST_ASSERT_MSG_EQ (window.txPackets, 10, "Wrong txPackets");
+      NS_TEST_ASSERT_MSG_EQ (window.rxPackets, 10, "Wrong rxPackets");
+      NS_TEST_ASSERT_MSG_EQ (window.rxBytes, 1000, "Wrong rxBytes");
+      NS_TEST_ASSERT_MSG_EQ (window.delaySum, MilliSeconds (i == 0 ? 50 : 250), "Wrong delaySum");
+      // The delays fall in the bin of 5 ms, then of 25 ms
+      uint32_t bin = i == 0 ? 5 : 25;
+      NS_TEST_ASSERT_MSG_EQ (window.delayHistogram.size (), bin + 1, "Wrong delay histogram");
+      NS_TEST_ASSERT_MSG_EQ (window.delayHistogram[bin], 10, "Wrong delay histogram");
+    }
+  NS_TEST_ASSERT_MSG_EQ (m_windows[2].flowId, 2, "Wrong flow");
+  NS_TEST_ASSERT_MSG_EQ (m_windows[2].start, Seconds (2), "Wrong start");
+  NS_TEST_ASSERT_MSG_EQ (m_windows[2].txPackets, 1, "Wrong txPackets");
+  NS_TEST_ASSERT_MSG_EQ (m_windows[2].rxPackets, 0, "Wrong rxPackets");
+  NS_TEST_ASSERT_MSG_EQ (m_windows[2].delayHistogram.size (), 0, "Wrong delay histogram");
+
+  std::ifstream file (fileName.c_str ());
+  std::ostringstream text;
+  text << file.rdbuf ();
+  NS_TEST_ASSERT_MSG_EQ (text.str (),
+                         "# time flow tx-packets rx-packets lost-packets tx-bytes rx-bytes times-forwarded "
+                         "delay-sum jitter-sum delay-histogram\n"
+                         "1 1 10 10 0 1000 1000 0 0.05 0 5:10\n"
+                         "2 1 10 10 0 1000 1000 0 0.25 0.02 25:10\n"
+                         "3 2 1 0 0 100 0 0 0 0 -\n",
+                         "Wrong rows");
+
+  m_monitor->Dispose ();
+  m_monitor = 0;
+  m_probe = 0;
+  Simulator::Destroy ();
+  std::remove (fileName.c_str ());
+}
+
+class FlowMonitorTestSuite : public TestSuite
+{
+public:
+  FlowMonitorTestSuite ();
+};
+
+FlowMonitorTestSuite::FlowMonitorTestSuite ()
+  : TestSuite ("flow-monitor", UNIT)
+{
+  AddTestCase (new FlowMonitorTrackingTestCase, TestCase::QUICK);
+  AddTestCase (new FlowMonitorWindowTestCase, TestCase::QUICK);
+}
+
+static FlowMonitorTestSuite g_flowMonitorTestSuite;
+
+} // namespace ns3
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/node.h"
+#include "ns3/net-device.h"
+#include "ns3/ipv4-l3-protocol.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/arp-cache.h"
+#include "arp-cache-helper.h"
+
+NS_LOG_COMPONENT_DEFINE ("ArpCacheHelper");
+
+namespace ns3 {
+
+namespace {
+
+/// An address of an interface which uses ARP
+struct Neighbor
+{
+  Ipv4InterfaceAddress address;
+  Address mac;
+};
+
+std::vector<Neighbor>
+GetNeighbors (NodeContainer nodes)
+{
+  std::vector<Neighbor> neighbors;
+  for (NodeContainer::Iterator i = nodes.Begin (); i != nodes.End (); ++i)
+    {
+      Ptr<Ipv4L3Protocol> ipv4 = (*i)->GetObject<Ipv4L3Protocol> ();
+      NS_ASSERT_MSG (ipv4 != 0, "No IPv4 on node " << (*i)->GetId ());
+      for (uint32_t j = 0; j < ipv4->GetNInterfaces (); j++)
+        {
+          Ptr<Ipv4Interface> interface = ipv4->GetInterface (j);
+          if (interface->GetArpCache () == 0)
+            {
+              continue;
+            }
+          for (uint32_t k = 0; k < interface->GetNAddresses (); k++)
+            {
+              Neighbor neighbor;
+              neighbor.address = interface->GetAddress (k);
+              neighbor.mac = interface->GetDevice ()->GetAddress ();
+              neighbors.push_back (neighbor);
+            }
+        }
+    }
+  return neighbors;
+}
+
+} // anonymous namespace
+
+ArpCacheHelper::ArpCacheHelper ()
+  : m_permanent (true)
+{
+}
+
+void
+ArpCacheHelper::SetPermanent (bool permanent)
+{
+  m_permanent = permanent;
+}
+
+void
+ArpCacheHelper::PopulateStatic (NodeContainer nodes) const
+{
+  PopulateStatic (nodes, nodes);
+}
+
+void
+ArpCacheHelper::PopulateStatic (NodeContainer nodes, NodeContainer destinations) const
+{
+  NS_LOG_FUNCTION (this);
+  std::vector<Neighbor> neighbors = GetNeighbors (destinations);
+  for (NodeContainer::Iterator i = nodes.Begin (); i != nodes.End (); ++i)
+    {
+      Ptr<Ipv4L3Protocol> ipv4 = (*i)->GetObject<Ipv4L3Protocol> ();
+      NS_ASSERT_MSG (ipv4 != 0, "No IPv4 on node " << (*i)->GetId ());
+      for (uint32_t j = 0; j < ipv4->GetNInterfaces (); j++)
+        {
+          Ptr<Ipv4Interface> interface = ipv4->GetInterface (j);
+          Ptr<ArpCache> cache = interface->GetArpCache ();
+          if (cache == 0)
+            {
+              continue;
+            }
+          for (uint32_t k = 0; k < interface->GetNAddresses (); k++)
+            {
+              Ipv4InterfaceAddress local = interface->GetAddress (k);
+              for (std::vector<Neighbor>::const_iterator n = neighbors.begin (); n != neighbors.end (); ++n)
+                {
+                  if (n->address.GetLocal () == local.GetLocal ()
+                      || !local.GetMask ().IsMatch (n->address.GetLocal (), local.GetLocal ()))
+                    {
+                      continue;
+                    }
+                  ArpCache::Entry *entry = cache->Lookup (n->address.GetLocal ());
+                  if (entry == 0)
+                    {
+                      entry = cache->Add (n->address.GetLocal ());
+                    }
+                  else if (entry->IsWaitReply ())
+                    {
+                      NS_LOG_LOGIC ("Keep the entry of " << n->address.GetLocal () << " waiting for a reply");
+                      continue;
+                    }
+                  NS_LOG_LOGIC ("Node " << (*i)->GetId () << " learns " << n->address.GetLocal ()
+                                        << " at " << n->mac);
+                  entry->SetMacAddress (n->mac);
+                  if (m_permanent)
+                    {
+                      entry->MarkPermanent ();
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,74 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ARP_CACHE_HELPER_H
+#define ARP_CACHE_HELPER_H
+
+#include "ns3/node-container.h"
+
+namespace ns3 {
+
+/**
+ * \brief Helper class that fills the ARP caches of nodes, so that they
+ * send no ARP request
+ *
+ * Each interface of a node learns the IPv4 and MAC addresses of the
+ * interfaces of the destination nodes which are on the same subnet. The
+ * interfaces need an IPv4 address already, and the entries are added
+ * to the ArpCache of every interface which uses ARP.
+ *
+ * The entries are permanent by default: they never expire, and ARP
+ * replies do not change them.
+ */
+class ArpCacheHelper
+{
+public:
+  ArpCacheHelper ();
+
+  /**
+   * \param permanent true for entries which never expire, false for
+   * entries which expire after the AliveTimeout of their cache and are
+   * then refreshed by ARP, like the entries learnt from ARP replies
+   */
+  void SetPermanent (bool permanent);
+
+  /**
+   * \brief Have every node learn the addresses of every other node
+   *
+   * \param nodes the nodes
+   */
+  void PopulateStatic (NodeContainer nodes) const;
+
+  /**
+   * \brief Have some nodes learn the addresses of some destinations
+   *
+   * The cost is the number of interfaces of the nodes times that of the
+   * destinations, so a gateway and its meters are populated in linear
+   * time, with PopulateStatic (meters, gateway) and
+   * PopulateStatic (gateway, meters).
+   *
+   * \param nodes the nodes whose ARP caches are filled
+   * \param destinations the nodes whose addresses are added to them
+   */
+  void PopulateStatic (NodeContainer nodes, NodeContainer destinations) const;
+
+private:
+  bool m_permanent;
+};
+
+} // namespace ns3
+
+#endif /* ARP_CACHE_HELPER_H */
@@ -258,10 +258,10 @@ ArpCache::Entry *
 ArpCache::Lookup (Ipv4Address to)
 {
   NS_LOG_FUNCTION (this << to);
-  if (m_arpCache.find (to) != m_arpCache.end ()) 
+  CacheI it = m_arpCache.find (to);
+  if (it != m_arpCache.end ())
     {
-      ArpCache::Entry *entry = m_arpCache[to];
-      return entry;
+      return it->second;
     }
   return 0;
 }
@@ -305,6 +305,12 @@ ArpCache::Entry::IsWaitReply (void)
   NS_LOG_FUNCTION (this);
   return (m_state == WAIT_REPLY) ? true : false;
 }
+bool
+ArpCache::Entry::IsPermanent (void)
+{
+  NS_LOG_FUNCTION (this);
+  return (m_state == PERMANENT) ? true : false;
+}
 
 
 void 
@@ -353,12 +359,22 @@ ArpCache::Entry::MarkWaitReply (Ptr<Packet> waiting)
   UpdateSeen ();
   m_arp->StartWaitReplyTimer ();
 }
+void
+ArpCache::Entry::MarkPermanent (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (m_state != WAIT_REPLY);
+  NS_ASSERT (!m_macAddress.IsInvalid ());
+  m_state = PERMANENT;
+  ClearRetries ();
+  UpdateSeen ();
+}
 
 Address
 ArpCache::Entry::GetMacAddress (void) const
 {
   NS_LOG_FUNCTION (this);
-  NS_ASSERT (m_state == ALIVE);
+  NS_ASSERT (m_state == ALIVE || m_state == PERMANENT);
   return m_macAddress;
 }
 Ipv4Address 
@@ -384,6 +400,8 @@ ArpCache::Entry::GetTimeout (void) const
       return m_arp->GetDeadTimeout ();
     case ArpCache::Entry::ALIVE:
       return m_arp->GetAliveTimeout ();
+    case ArpCache::Entry::PERMANENT:
+      return Time::Max ();
     default:
       NS_ASSERT (false);
       return Seconds (0);
@@ -137,6 +137,13 @@ public:
      * \param waiting
      */
     void MarkWaitReply (Ptr<Packet> waiting);
+    /**
+     * \brief Changes the state of this entry to permanent
+     *
+     * A permanent entry never expires and is not changed by ARP replies.
+     * Its MAC address must have been set.
+     */
+    void MarkPermanent (void);
     /**
      * \param waiting
      * \return 
@@ -154,6 +161,10 @@ public:
      * \return True if the state of this entry is wait_reply; false otherwise.
      */
     bool IsWaitReply (void);
+    /**
+     * \return True if the state of this entry is permanent; false otherwise.
+     */
+    bool IsPermanent (void);
 
     /**
      * \return The MacAddress of this entry
@@ -201,7 +212,8 @@ public:
     enum ArpCacheEntryState_e {
       ALIVE,
       WAIT_REPLY,
-      DEAD
+      DEAD,
+      PERMANENT
     };
 
     void UpdateSeen (void);
@@ -301,6 +301,13 @@ ArpL3Protocol::Lookup (Ptr<Packet> packet, Ipv4Address destination,
               *hardwareDestination = entry->GetMacAddress ();
               return true;
             } 
+          else if (entry->IsPermanent ())
+            {
+              NS_LOG_LOGIC ("node="<<m_node->GetId ()<<
+                            ", permanent entry for " << destination << " -- send");
+              *hardwareDestination = entry->GetMacAddress ();
+              return true;
+            }
           else if (entry->IsWaitReply ()) 
             {
               NS_LOG_LOGIC ("node="<<m_node->GetId ()<<
@@ -377,6 +384,11 @@ ArpL3Protocol::AcceptArpFromHwmp( Ptr<MeshPointDevice> mp, Ipv4Address ip, Mac48
        NS_LOG_LOGIC ("Add new entry to the ARP cache" );
        entry = cache->Add (ip);
      }
+   else if (entry->IsPermanent ())
+     {
+       NS_LOG_LOGIC ("Keep the permanent entry of the ARP cache" );
+       return;
+     }
    entry->SetMacAddress (mac);
 }
 } // namespace ns3
@@ -0,0 +1,178 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/node-container.h"
+#include "ns3/net-device-container.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simple-channel.h"
+#include "ns3/error-model.h"
+#include "ns3/packet.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-interface-container.h"
+#include "ns3/ipv4-l3-protocol.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/arp-l3-protocol.h"
+#include "ns3/arp-cache.h"
+#include "ns3/arp-cache-helper.h"
+
+using namespace ns3;
+
+namespace {
+
+/// A SimpleNetDevice which resolves its addresses with ARP
+class ArpNetDevice : public SimpleNetDevice
+{
+public:
+  virtual bool NeedsArp (void) const
+  {
+    return true;
+  }
+};
+
+} // anonymous namespace
+
+class ArpCacheHelperTestCase : public TestCase
+{
+public:
+  ArpCacheHelperTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void CreateNodes (uint32_t n);
+  Ptr<ArpCache> GetCache (uint32_t node) const;
+  /// Whether node resolves the address of destination without an ARP request
+  bool Resolve (uint32_t node, uint32_t destination) const;
+  void CheckAfterTimeout (bool permanent);
+
+  NodeContainer m_nodes;
+  NetDeviceContainer m_devices;
+  Ipv4InterfaceContainer m_interfaces;
+};
+
+ArpCacheHelperTestCase::ArpCacheHelperTestCase ()
+  : TestCase ("Check the ARP entries installed by ArpCacheHelper")
+{
+}
+
+void
+ArpCacheHelperTestCase::CreateNodes (uint32_t n)
+{
+  m_nodes = NodeContainer ();
+  m_devices = NetDeviceContainer ();
+  m_nodes.Create (n);
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Ptr<ArpNetDevice> device = CreateObject<ArpNetDevice> ();
+      device->SetAddress (Mac48Address::Allocate ());
+      device->SetChannel (channel);
+      m_nodes.Get (i)->AddDevice (device);
+      m_devices.Add (device);
+    }
+  InternetStackHelper internet;
+  internet.Install (m_nodes);
+  Ipv4AddressHelper address ("10.1.1.0", "255.255.255.0");
+  m_interfaces = address.Assign (m_devices);
+}
+
+Ptr<ArpCache>
+ArpCacheHelperTestCase::GetCache (uint32_t node) const
+{
+  Ptr<Ipv4L3Protocol> ipv4 = m_nodes.Get (node)->GetObject<Ipv4L3Protocol> ();
+  return ipv4->GetInterface (ipv4->GetInterfaceForDevice (m_devices.Get (node)))->GetArpCache ();
+}
+
+bool
+ArpCacheHelperTestCase::Resolve (uint32_t node, uint32_t destination) const
+{
+  Ptr<ArpL3Protocol> arp = m_nodes.Get (node)->GetObject<ArpL3Protocol> ();
+  Address mac;
+  bool resolved = arp->Lookup (Create<Packet> (), m_interfaces.GetAddress (destination),
+                               m_devices.Get (node), GetCache (node), &mac);
+  return resolved && mac == m_devices.Get (destination)->GetAddress ();
+}
+
+void
+ArpCacheHelperTestCase::CheckAfterTimeout (bool permanent)
+{
+  ArpCache::Entry *entry = GetCache (1)->Lookup (m_interfaces.GetAddress (0));
+  NS_TEST_EXPECT_MSG_EQ (entry->IsExpired (), !permanent, "Entry after the AliveTimeout");
+  if (permanent)
+    {
+      NS_TEST_EXPECT_MSG_EQ (Resolve (1, 0), true, "Permanent entry not resolved");
+    }
+}
+
+void
+ArpCacheHelperTestCase::DoRun (void)
+{
+  // Every node learns every other one, and not itself
+  CreateNodes (4);
+  ArpCacheHelper helper;
+  helper.PopulateStatic (m_nodes);
+  for (uint32_t i = 0; i < m_nodes.GetN (); i++)
+    {
+      for (uint32_t j = 0; j < m_nodes.GetN (); j++)
+        {
+          ArpCache::Entry *entry = GetCache (i)->Lookup (m_interfaces.GetAddress (j));
+          if (i == j)
+            {
+              NS_TEST_EXPECT_MSG_EQ ((entry == 0), true, "Node " << i << " learnt itself");
+              continue;
+            }
+          NS_TEST_ASSERT_MSG_NE (entry, 0, "Node " << i << " did not learn node " << j);
+          NS_TEST_EXPECT_MSG_EQ (entry->IsPermanent (), true, "Entry not permanent");
+          NS_TEST_EXPECT_MSG_EQ (entry->GetMacAddress (), m_devices.Get (j)->GetAddress (), "Wrong MAC address");
+          NS_TEST_EXPECT_MSG_EQ (Resolve (i, j), true, "Address not resolved");
+        }
+    }
+  Simulator::Schedule (Seconds (500), &ArpCacheHelperTestCase::CheckAfterTimeout, this, true);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  // A gateway and its meters learn each other, the meters do not learn
+  // each other, and the entries expire like the learnt ones
+  CreateNodes (3);
+  NodeContainer gateway (m_nodes.Get (0));
+  NodeContainer meters (m_nodes.Get (1), m_nodes.Get (2));
+  helper.SetPermanent (false);
+  helper.PopulateStatic (gateway, meters);
+  helper.PopulateStatic (meters, gateway);
+  NS_TEST_EXPECT_MSG_EQ (Resolve (0, 1) && Resolve (0, 2) && Resolve (1, 0) && Resolve (2, 0), true,
+                         "Gateway and meters not resolved");
+  NS_TEST_EXPECT_MSG_EQ ((GetCache (1)->Lookup (m_interfaces.GetAddress (2)) == 0), true, "Meter learnt another meter");
+  NS_TEST_EXPECT_MSG_EQ (GetCache (1)->Lookup (m_interfaces.GetAddress (0))->IsAlive (), true, "Entry not alive");
+  Simulator::Schedule (Seconds (500), &ArpCacheHelperTestCase::CheckAfterTimeout, this, false);
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+class ArpCacheHelperTestSuite : public TestSuite
+{
+public:
+  ArpCacheHelperTestSuite ();
+};
+
+ArpCacheHelperTestSuite::ArpCacheHelperTestSuite ()
+  : TestSuite ("arp-cache-helper", UNIT)
+{
+  AddTestCase (new ArpCacheHelperTestCase, TestCase::QUICK);
+}
+
+static ArpCacheHelperTestSuite g_arpCacheHelperTestSuite;
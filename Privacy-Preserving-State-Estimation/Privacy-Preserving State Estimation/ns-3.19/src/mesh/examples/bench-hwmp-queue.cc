@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Benchmark of a burst of route discoveries by HWMP.
+//
+// The mesh points of a grid peer for --start seconds, then the first one
+// sends --packets packets to every other one at the same instant, and
+// every other one sends --packets packets to the first one, like the
+// meters and their gateway of the scratch scripts. The packets wait in
+// the queues of HWMP until the routes to their destinations are found,
+// which the queues can hold entirely. The wall clock time from the burst
+// until --duration seconds later is reported, the fastest of several
+// runs, with the number of packets delivered.
+//
+// ./waf --run "bench-hwmp-queue --xSize=5 --ySize=5 --packets=1000"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/mesh-module.h"
+#include "ns3/mesh-helper.h"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace ns3;
+
+static const uint16_t PROTOCOL = 0x88b5;
+static uint32_t g_delivered = 0;
+
+static void
+Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol,
+         const Address &from, const Address &to, NetDevice::PacketType type)
+{
+  g_delivered++;
+}
+
+static void
+Burst (NetDeviceContainer devices, uint32_t packets, uint32_t size)
+{
+  Ptr<NetDevice> gateway = devices.Get (0);
+  for (uint32_t i = 1; i < devices.GetN (); i++)
+    {
+      for (uint32_t j = 0; j < packets; j++)
+        {
+          gateway->Send (Create<Packet> (size), devices.Get (i)->GetAddress (), PROTOCOL);
+          devices.Get (i)->Send (Create<Packet> (size), gateway->GetAddress (), PROTOCOL);
+        }
+    }
+}
+
+static int64_t
+Run (uint32_t xSize, uint32_t ySize, uint32_t packets, uint32_t size, double start, double duration)
+{
+  NodeContainer nodes;
+  nodes.Create (xSize * ySize);
+  YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default ();
+  YansWifiChannelHelper wifiChannel = YansWifiChannelHelper::Default ();
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  MeshHelper mesh = MeshHelper::Default ();
+  mesh.SetStackInstaller ("ns3::Dot11sStack");
+  NetDeviceContainer devices = mesh.Install (wifiPhy, nodes);
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::GridPositionAllocator",
+                                 "MinX", DoubleValue (0.0),
+                                 "MinY", DoubleValue (0.0),
+                                 "DeltaX", DoubleValue (100.0),
+                                 "DeltaY", DoubleValue (100.0),
+                                 "GridWidth", UintegerValue (xSize),
+                                 "LayoutType", StringValue ("RowFirst"));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      nodes.Get (i)->RegisterProtocolHandler (MakeCallback (&Receive), PROTOCOL, devices.Get (i));
+    }
+
+  g_delivered = 0;
+  Simulator::Stop (Seconds (start));
+  Simulator::Run ();
+  SystemWallClockMs clock;
+  clock.Start ();
+  Burst (devices, packets, size);
+  Simulator::Stop (Seconds (duration));
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  Simulator::Destroy ();
+  return ms;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t xSize = 3;
+  uint32_t ySize = 3;
+  uint32_t packets = 1000;
+  uint32_t size = 100;
+  double start = 10;
+  double duration = 10;
+  uint32_t runs = 3;
+
+  CommandLine cmd;
+  cmd.AddValue ("xSize", "Number of mesh points in a row of the grid", xSize);
+  cmd.AddValue ("ySize", "Number of rows of the grid", ySize);
+  cmd.AddValue ("packets", "Number of packets sent to and from every mesh point by the first one", packets);
+  cmd.AddValue ("size", "Size of the packets, bytes", size);
+  cmd.AddValue ("start", "Time of the burst, seconds", start);
+  cmd.AddValue ("duration", "Time simulated after the burst, seconds", duration);
+  cmd.AddValue ("runs", "Number of runs", runs);
+  cmd.Parse (argc, argv);
+
+  Config::SetDefault ("ns3::dot11s::HwmpProtocol::MaxQueueSize",
+                      UintegerValue (std::min<uint32_t> (2 * xSize * ySize * packets, 65535)));
+
+  int64_t ms = Run (xSize, ySize, packets, size, start, duration);
+  for (uint32_t i = 1; i < runs; i++)
+    {
+      ms = std::min (ms, Run (xSize, ySize, packets, size, start, duration));
+    }
+  std::cout << "grid\tpackets\tms\tdelivered" << std::endl;
+  std::cout << xSize << "x" << ySize << "\t" << 2 * (xSize * ySize - 1) * packets << "\t"
+            << ms << "\t" << g_delivered << std::endl;
+  return 0;
+}
@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Benchmark of the 802.11s stack with and without packet metadata.
+//
+// Every mesh point of a grid but the first one sends a UDP echo request
+// of --size bytes to the first one every --interval seconds, like the
+// meters of the scratch scripts report to their gateway, and
+// Packet::EnablePrinting is called unless --printing=0, as the scripts
+// do. The wall clock time of --time simulated seconds is reported, the
+// fastest of several runs, with the number of IP packets delivered and
+// the number delivered per wall clock second, and the allocations of the
+// packets of the last run, as counted by the PacketArena.
+//
+// The packet metadata is switched off, printing included, by the
+// PacketMetadataEnabled global value, which is kept for a whole run of
+// the program:
+//
+// ./waf --run "bench-packet-metadata --xSize=5 --ySize=5"
+// ./waf --run "bench-packet-metadata --xSize=5 --ySize=5 --PacketMetadataEnabled=0"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/applications-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/mesh-module.h"
+#include "ns3/mesh-helper.h"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace ns3;
+
+static uint64_t g_delivered = 0;
+
+static void
+LocalDeliver (const Ipv4Header &header, Ptr<const Packet> packet, uint32_t interface)
+{
+  g_delivered++;
+}
+
+static int64_t
+Run (uint32_t xSize, uint32_t ySize, uint32_t size, double interval, double time)
+{
+  NodeContainer nodes;
+  nodes.Create (xSize * ySize);
+  YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default ();
+  YansWifiChannelHelper wifiChannel = YansWifiChannelHelper::Default ();
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  MeshHelper mesh = MeshHelper::Default ();
+  mesh.SetStackInstaller ("ns3::Dot11sStack");
+  NetDeviceContainer devices = mesh.Install (wifiPhy, nodes);
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::GridPositionAllocator",
+                                 "MinX", DoubleValue (0.0),
+                                 "MinY", DoubleValue (0.0),
+                                 "DeltaX", DoubleValue (100.0),
+                                 "DeltaY", DoubleValue (100.0),
+                                 "GridWidth", UintegerValue (xSize),
+                                 "LayoutType", StringValue ("RowFirst"));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+
+  InternetStackHelper internet;
+  internet.Install (nodes);
+  Ipv4AddressHelper address;
+  address.SetBase ("10.1.1.0", "255.255.255.0");
+  Ipv4InterfaceContainer interfaces = address.Assign (devices);
+
+  UdpEchoServerHelper server (9);
+  server.Install (nodes.Get (0));
+  UdpEchoClientHelper client (interfaces.GetAddress (0), 9);
+  client.SetAttribute ("MaxPackets", UintegerValue (0xffffffff));
+  client.SetAttribute ("Interval", TimeValue (Seconds (interval)));
+  client.SetAttribute ("PacketSize", UintegerValue (size));
+  for (uint32_t i = 1; i < nodes.GetN (); i++)
+    {
+      ApplicationContainer apps = client.Install (nodes.Get (i));
+      apps.Start (Seconds (1.0 + interval * i / nodes.GetN ()));
+    }
+  Config::ConnectWithoutContext ("/NodeList/*/$ns3::Ipv4L3Protocol/LocalDeliver",
+                                 MakeCallback (&LocalDeliver));
+
+  g_delivered = 0;
+  PacketArena::ResetStats ();
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Stop (Seconds (time));
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  Simulator::Destroy ();
+  return ms;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t xSize = 3;
+  uint32_t ySize = 3;
+  uint32_t size = 64;
+  double interval = 0.1;
+  double time = 60;
+  bool printing = true;
+  uint32_t runs = 3;
+
+  CommandLine cmd;
+  cmd.AddValue ("xSize", "Number of mesh points in a row of the grid", xSize);
+  cmd.AddValue ("ySize", "Number of rows of the grid", ySize);
+  cmd.AddValue ("size", "Size of the echo requests, bytes", size);
+  cmd.AddValue ("interval", "Time between two requests of a mesh point, seconds", interval);
+  cmd.AddValue ("time", "Simulation time, seconds", time);
+  cmd.AddValue ("printing", "Call Packet::EnablePrinting, like the scratch scripts", printing);
+  cmd.AddValue ("runs", "Number of runs", runs);
+  cmd.Parse (argc, argv);
+
+  if (printing)
+    {
+      Packet::EnablePrinting ();
+    }
+
+  int64_t ms = Run (xSize, ySize, size, interval, time);
+  for (uint32_t i = 1; i < runs; i++)
+    {
+      ms = std::min (ms, Run (xSize, ySize, size, interval, time));
+    }
+  std::cout << "metadata\tprinting\tms\tdelivered\tpackets/s" << std::endl;
+  std::cout << Packet::MetadataEnabled () << "\t" << printing << "\t" << ms << "\t"
+            << g_delivered << "\t" << (ms > 0 ? g_delivered * 1000.0 / ms : 0) << std::endl;
+  std::cout << std::endl;
+  PacketArena::PrintStats (std::cout);
+  return 0;
+}
@@ -176,6 +176,7 @@ HwmpProtocol::HwmpProtocol () :
   m_preqId (0),
   m_rtable (CreateObject<HwmpRtable> ()),
   m_randomStart (Seconds (0.1)),
+  m_rqueueSize (0),
   m_maxQueueSize (255),
   m_dot11MeshHWMPmaxPREQretries (3),
   m_dot11MeshHWMPnetDiameterTraversalTime (MicroSeconds (1024*100)),
@@ -221,11 +222,18 @@ HwmpProtocol::DoDispose ()
       i->second.preqTimeout.Cancel ();
     }
   m_proactivePreqTimer.Cancel ();
+  for (std::list<EventId>::iterator i = m_proactivePreqRestarts.begin (); i != m_proactivePreqRestarts.end (); i++)
+    {
+      i->Cancel ();
+    }
+  m_proactivePreqRestarts.clear ();
   m_preqTimeouts.clear ();
   m_lastDataSeqno.clear ();
   m_hwmpSeqnoMetricDatabase.clear ();
   m_interfaces.clear ();
   m_rqueue.clear ();
+  m_rqueueByDst.clear ();
+  m_rqueueSize = 0;
   m_rtable = 0;
   m_mp = 0;
 }
@@ -875,11 +883,12 @@ HwmpProtocol::GetBroadcastReceivers (uint32_t interface)
 bool
 HwmpProtocol::QueuePacket (QueuedPacket packet)
 {
-  if (m_rqueue.size () > m_maxQueueSize)
+  if (m_rqueueSize > m_maxQueueSize)
     {
       return false;
     }
-  m_rqueue.push_back (packet);
+  m_rqueueByDst[packet.dst].push_back (m_rqueue.insert (m_rqueue.end (), packet));
+  m_rqueueSize++;
   return true;
 }
 
@@ -888,29 +897,34 @@ HwmpProtocol::DequeueFirstPacketByDst (Mac48Address dst)
 {
   QueuedPacket retval;
   retval.pkt = 0;
-  for (std::vector<QueuedPacket>::iterator i = m_rqueue.begin (); i != m_rqueue.end (); i++)
+  std::map<Mac48Address, std::deque<QueuedPacketList::iterator> >::iterator i = m_rqueueByDst.find (dst);
+  if (i == m_rqueueByDst.end ())
     {
-      if ((*i).dst == dst)
-        {
-          retval = (*i);
-          m_rqueue.erase (i);
-          break;
-        }
+      return retval;
+    }
+  QueuedPacketList::iterator packet = i->second.front ();
+  i->second.pop_front ();
+  if (i->second.empty ())
+    {
+      m_rqueueByDst.erase (i);
     }
+  retval = *packet;
+  m_rqueue.erase (packet);
+  m_rqueueSize--;
   return retval;
 }
 
 HwmpProtocol::QueuedPacket
 HwmpProtocol::DequeueFirstPacket ()
 {
-  QueuedPacket retval;
-  retval.pkt = 0;
-  if (m_rqueue.size () != 0)
+  if (m_rqueue.empty ())
     {
-      retval = m_rqueue[0];
-      m_rqueue.erase (m_rqueue.begin ());
+      QueuedPacket retval;
+      retval.pkt = 0;
+      return retval;
     }
-  return retval;
+  // The first packet queued is the first queued for its destination
+  return DequeueFirstPacketByDst (m_rqueue.front ().dst);
 }
 
 void
@@ -1026,6 +1040,9 @@ void
 HwmpProtocol::SetRoot ()
 {
   Time randomStart = Seconds (m_coefficient->GetValue ());
+  // SetRoot is called again when initialized, with the random start
+  // configured: keep a single periodic PREQ
+  m_proactivePreqTimer.Cancel ();
   m_proactivePreqTimer = Simulator::Schedule (randomStart, &HwmpProtocol::SendProactivePreq, this);
   NS_LOG_DEBUG ("ROOT IS: " << m_address);
   m_isRoot = true;
@@ -1036,6 +1053,32 @@ HwmpProtocol::UnsetRoot ()
   m_proactivePreqTimer.Cancel ();
 }
 void
+HwmpProtocol::ScheduleProactivePreq (Time delay)
+{
+  m_proactivePreqRestarts.push_back (Simulator::Schedule (delay, &HwmpProtocol::RestartProactivePreq, this));
+}
+void
+HwmpProtocol::RestartProactivePreq ()
+{
+  for (std::list<EventId>::iterator i = m_proactivePreqRestarts.begin (); i != m_proactivePreqRestarts.end (); )
+    {
+      if (i->IsExpired ())
+        {
+          i = m_proactivePreqRestarts.erase (i);
+        }
+      else
+        {
+          i++;
+        }
+    }
+  if (!m_isRoot || !m_proactivePreqTimer.IsRunning ())
+    {
+      return;
+    }
+  m_proactivePreqTimer.Cancel ();
+  SendProactivePreq ();
+}
+void
 HwmpProtocol::SendProactivePreq ()
 {
   IePreq preq;
@@ -1049,6 +1092,7 @@ HwmpProtocol::SendProactivePreq ()
   preq.SetOriginatorAddress (GetAddress ());
   preq.SetPreqID (GetNextPreqId ());
   preq.SetOriginatorSeqNumber (GetNextHwmpSeqno ());
+  m_stats.initiatedProactivePreq++;
   for (HwmpProtocolMacMap::const_iterator i = m_interfaces.begin (); i != m_interfaces.end (); i++)
     {
       i->second->SendPreq (preq);
@@ -1116,6 +1160,7 @@ HwmpProtocol::Statistics::Statistics () :
   totalQueued (0),
   totalDropped (0),
   initiatedPreq (0),
+  initiatedProactivePreq (0),
   initiatedPrep (0),
   initiatedPerr (0)
 {
@@ -1130,6 +1175,7 @@ void HwmpProtocol::Statistics::Print (std::ostream & os) const
   "totalQueued=\"" << totalQueued << "\" "
   "totalDropped=\"" << totalDropped << "\" "
   "initiatedPreq=\"" << initiatedPreq << "\" "
+  "initiatedProactivePreq=\"" << initiatedProactivePreq << "\" "
   "initiatedPrep=\"" << initiatedPrep << "\" "
   "initiatedPerr=\"" << initiatedPerr << "\"/>" << std::endl;
 }
@@ -1161,6 +1207,27 @@ HwmpProtocol::Report (std::ostream & os) const
     }
   os << "</Hwmp>" << std::endl;
 }
+HwmpProtocol::Overhead
+HwmpProtocol::GetOverhead () const
+{
+  Overhead overhead;
+  overhead.initiatedPreq = m_stats.initiatedPreq;
+  overhead.initiatedProactivePreq = m_stats.initiatedProactivePreq;
+  overhead.initiatedPrep = m_stats.initiatedPrep;
+  overhead.initiatedPerr = m_stats.initiatedPerr;
+  overhead.txPreq = 0;
+  overhead.txPrep = 0;
+  overhead.txPerr = 0;
+  overhead.txMgtBytes = 0;
+  for (HwmpProtocolMacMap::const_iterator plugin = m_interfaces.begin (); plugin != m_interfaces.end (); plugin++)
+    {
+      overhead.txPreq += plugin->second->m_stats.txPreq;
+      overhead.txPrep += plugin->second->m_stats.txPrep;
+      overhead.txPerr += plugin->second->m_stats.txPerr;
+      overhead.txMgtBytes += plugin->second->m_stats.txMgtBytes;
+    }
+  return overhead;
+}
 void
 HwmpProtocol::ResetStats ()
 {
@@ -27,6 +27,8 @@
 #include "ns3/traced-value.h"
 #include <vector>
 #include <map>
+#include <list>
+#include <deque>
 
 namespace ns3 {
 class MeshPointDevice;
@@ -82,10 +84,33 @@ public:
   ///\{
   void SetRoot ();
   void UnsetRoot ();
+  /**
+   * \brief Send the next proactive PREQ of a root after the given delay,
+   * and the following ones every Dot11MeshHWMPpathToRootInterval from it.
+   *
+   * Lets a root refresh the paths of the mesh points towards it just
+   * before a known burst of traffic, so that the burst needs no route
+   * discovery. The periodic PREQs go on until then. Does nothing if the
+   * mesh point is not a root when the delay expires.
+   */
+  void ScheduleProactivePreq (Time delay);
   ///\}
   ///\brief Statistics:
   void Report (std::ostream &) const;
   void ResetStats ();
+  /// Path selection frames of a mesh point since the last ResetStats
+  struct Overhead
+  {
+    uint32_t initiatedPreq;          ///< PREQs of route discoveries
+    uint32_t initiatedProactivePreq; ///< proactive PREQs, as a root
+    uint32_t initiatedPrep;
+    uint32_t initiatedPerr;
+    uint32_t txPreq;                 ///< on every interface, initiated or forwarded
+    uint32_t txPrep;
+    uint32_t txPerr;
+    uint32_t txMgtBytes;
+  };
+  Overhead GetOverhead () const;
   /**
    * Assign a fixed random variable stream number to the random variables
    * used by this model.  Return the number of streams (possibly zero) that
@@ -98,6 +123,7 @@ public:
 
 private:
   friend class HwmpProtocolMac;
+  friend class HwmpQueueTest;
 
   virtual void DoInitialize ();
 
@@ -174,8 +200,12 @@ private:
   TracedCallback<Time> m_routeDiscoveryTimeCallback;
   ///\name Methods related to Queue/Dequeue procedures
   ///\{
+  /// Queue a packet unless the queue is full
   bool QueuePacket (QueuedPacket packet);
+  /// \return the first packet queued for dst, whose pkt is null if none.
+  /// Costs O(log d), d being the number of destinations with packets queued.
   QueuedPacket  DequeueFirstPacketByDst (Mac48Address dst);
+  /// \return the first packet queued, whose pkt is null if none
   QueuedPacket  DequeueFirstPacket ();
   void ReactivePathResolved (Mac48Address dst);
   void ProactivePathResolved ();
@@ -197,6 +227,7 @@ private:
   void  RetryPathDiscovery (Mac48Address dst, uint8_t numOfRetry);
   /// Proactive Preq routines:
   void SendProactivePreq ();
+  void RestartProactivePreq ();
   ///\}
   ///\return address of MeshPointDevice
   Mac48Address GetAddress ();
@@ -224,6 +255,7 @@ private:
     uint16_t totalQueued;
     uint16_t totalDropped;
     uint16_t initiatedPreq;
+    uint16_t initiatedProactivePreq;
     uint16_t initiatedPrep;
     uint16_t initiatedPerr;
 
@@ -256,11 +288,21 @@ private:
   };
   std::map<Mac48Address, PreqEvent> m_preqTimeouts;
   EventId m_proactivePreqTimer;
+  /// PREQs scheduled by ScheduleProactivePreq
+  std::list<EventId> m_proactivePreqRestarts;
   /// Random start in Proactive PREQ propagation
   Time m_randomStart;
   ///\}
-  /// Packet Queue
-  std::vector<QueuedPacket> m_rqueue;
+  ///\name Packet Queue
+  ///\{
+  typedef std::list<QueuedPacket> QueuedPacketList;
+  /// The packets waiting their routing information, in the order they came
+  QueuedPacketList m_rqueue;
+  /// The packets of m_rqueue for each destination, in the order they came
+  std::map<Mac48Address, std::deque<QueuedPacketList::iterator> > m_rqueueByDst;
+  /// The number of packets of m_rqueue
+  uint32_t m_rqueueSize;
+  ///\}
   ///\name HWMP-protocol parameters (attributes of GetTypeId)
   ///\{
   uint16_t m_maxQueueSize;
@@ -26,6 +26,8 @@
 
 #include "hwmp-rtable.h"
 
+#include <algorithm>
+
 namespace ns3 {
 namespace dot11s {
 
@@ -34,6 +36,9 @@ NS_LOG_COMPONENT_DEFINE ("HwmpRtable");
 NS_OBJECT_ENSURE_REGISTERED (HwmpRtable)
   ;
 
+/// Marks an empty slot, as no address packs to it
+static const uint64_t EMPTY_KEY = ~static_cast<uint64_t> (0);
+
 TypeId
 HwmpRtable::GetTypeId ()
 {
@@ -42,9 +47,12 @@ HwmpRtable::GetTypeId ()
     .AddConstructor<HwmpRtable> ();
   return tid;
 }
-HwmpRtable::HwmpRtable ()
+HwmpRtable::HwmpRtable () :
+  m_nRoutes (0),
+  m_shift (0)
 {
   DeleteProactivePath ();
+  Rehash (16);
 }
 HwmpRtable::~HwmpRtable ()
 {
@@ -53,24 +61,113 @@ void
 HwmpRtable::DoDispose ()
 {
   m_routes.clear ();
+  m_nRoutes = 0;
+}
+uint64_t
+HwmpRtable::GetKey (Mac48Address address)
+{
+  uint8_t buffer[6];
+  address.CopyTo (buffer);
+  uint64_t key = 0;
+  for (uint32_t i = 0; i < 6; i++)
+    {
+      key = (key << 8) | buffer[i];
+    }
+  return key;
+}
+uint32_t
+HwmpRtable::GetHome (uint64_t key) const
+{
+  // Fibonacci hashing, whose high bits are the best mixed
+  return static_cast<uint32_t> ((key * 0x9e3779b97f4a7c15ULL) >> m_shift);
+}
+void
+HwmpRtable::Rehash (uint32_t nSlots)
+{
+  uint32_t bits = 0;
+  while ((1U << bits) < nSlots)
+    {
+      bits++;
+    }
+  std::vector<ReactiveRoute> routes (1U << bits);
+  for (uint32_t i = 0; i < routes.size (); i++)
+    {
+      routes[i].key = EMPTY_KEY;
+    }
+  routes.swap (m_routes);
+  m_shift = 64 - bits;
+  uint32_t mask = m_routes.size () - 1;
+  for (std::vector<ReactiveRoute>::iterator i = routes.begin (); i != routes.end (); i++)
+    {
+      if (i->key == EMPTY_KEY)
+        {
+          continue;
+        }
+      uint32_t slot = GetHome (i->key);
+      while (m_routes[slot].key != EMPTY_KEY)
+        {
+          slot = (slot + 1) & mask;
+        }
+      m_routes[slot] = *i;
+    }
+}
+HwmpRtable::ReactiveRoute *
+HwmpRtable::FindReactive (Mac48Address destination)
+{
+  if (m_nRoutes == 0)
+    {
+      return 0;
+    }
+  uint64_t key = GetKey (destination);
+  uint32_t mask = m_routes.size () - 1;
+  for (uint32_t slot = GetHome (key); m_routes[slot].key != EMPTY_KEY; slot = (slot + 1) & mask)
+    {
+      if (m_routes[slot].key == key)
+        {
+          return &m_routes[slot];
+        }
+    }
+  return 0;
+}
+HwmpRtable::Precursor &
+HwmpRtable::GetPrecursor (ReactiveRoute & route, uint32_t index)
+{
+  if (index < INLINE_PRECURSORS)
+    {
+      return route.precursors[index];
+    }
+  return route.morePrecursors[index - INLINE_PRECURSORS];
 }
 void
 HwmpRtable::AddReactivePath (Mac48Address destination, Mac48Address retransmitter, uint32_t interface,
                              uint32_t metric, Time lifetime, uint32_t seqnum)
 {
-  std::map<Mac48Address, ReactiveRoute>::iterator i = m_routes.find (destination);
-  if (i == m_routes.end ())
+  ReactiveRoute *route = FindReactive (destination);
+  if (route == 0)
     {
-      ReactiveRoute newroute;
-      m_routes[destination] = newroute;
+      // At most half of the slots are used, which keeps the probes short
+      if (2 * (m_nRoutes + 1) > m_routes.size ())
+        {
+          Rehash (2 * m_routes.size ());
+        }
+      uint64_t key = GetKey (destination);
+      uint32_t mask = m_routes.size () - 1;
+      uint32_t slot = GetHome (key);
+      while (m_routes[slot].key != EMPTY_KEY)
+        {
+          slot = (slot + 1) & mask;
+        }
+      route = &m_routes[slot];
+      route->key = key;
+      route->destination = destination;
+      route->nPrecursors = 0;
+      m_nRoutes++;
     }
-  i = m_routes.find (destination);
-  NS_ASSERT (i != m_routes.end ());
-  i->second.retransmitter = retransmitter;
-  i->second.interface = interface;
-  i->second.metric = metric;
-  i->second.whenExpire = Simulator::Now () + lifetime;
-  i->second.seqnum = seqnum;
+  route->retransmitter = retransmitter;
+  route->interface = interface;
+  route->metric = metric;
+  route->whenExpire = Simulator::Now () + lifetime;
+  route->seqnum = seqnum;
 }
 void
 HwmpRtable::AddProactivePath (uint32_t metric, Mac48Address root, Mac48Address retransmitter,
@@ -91,24 +188,33 @@ HwmpRtable::AddPrecursor (Mac48Address destination, uint32_t precursorInterface,
   precursor.interface = precursorInterface;
   precursor.address = precursorAddress;
   precursor.whenExpire = Simulator::Now () + lifetime;
-  std::map<Mac48Address, ReactiveRoute>::iterator i = m_routes.find (destination);
-  if (i != m_routes.end ())
+  ReactiveRoute *route = FindReactive (destination);
+  if (route != 0)
     {
       bool should_add = true;
-      for (unsigned int j = 0; j < i->second.precursors.size (); j++)
+      for (unsigned int j = 0; j < route->nPrecursors; j++)
         {
           //NB: Only one active route may exist, so do not check
           //interface ID, just address
-          if (i->second.precursors[j].address == precursorAddress)
+          Precursor &existing = GetPrecursor (*route, j);
+          if (existing.address == precursorAddress)
             {
               should_add = false;
-              i->second.precursors[j].whenExpire = precursor.whenExpire;
+              existing.whenExpire = precursor.whenExpire;
               break;
             }
         }
       if (should_add)
         {
-          i->second.precursors.push_back (precursor);
+          if (route->nPrecursors < INLINE_PRECURSORS)
+            {
+              route->precursors[route->nPrecursors] = precursor;
+            }
+          else
+            {
+              route->morePrecursors.push_back (precursor);
+            }
+          route->nPrecursors++;
         }
     }
 }
@@ -133,37 +239,54 @@ HwmpRtable::DeleteProactivePath (Mac48Address root)
 void
 HwmpRtable::DeleteReactivePath (Mac48Address destination)
 {
-  std::map<Mac48Address, ReactiveRoute>::iterator i = m_routes.find (destination);
-  if (i != m_routes.end ())
+  ReactiveRoute *route = FindReactive (destination);
+  if (route == 0)
+    {
+      return;
+    }
+  uint32_t mask = m_routes.size () - 1;
+  uint32_t hole = route - &m_routes[0];
+  // Shift back the following routes of the cluster which may not be
+  // found past the hole, rather than leave a tombstone
+  for (uint32_t slot = (hole + 1) & mask; m_routes[slot].key != EMPTY_KEY; slot = (slot + 1) & mask)
     {
-      m_routes.erase (i);
+      uint32_t home = GetHome (m_routes[slot].key);
+      if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+          m_routes[hole] = m_routes[slot];
+          hole = slot;
+        }
     }
+  m_routes[hole].key = EMPTY_KEY;
+  m_routes[hole].morePrecursors.clear ();
+  m_nRoutes--;
 }
 HwmpRtable::LookupResult
 HwmpRtable::LookupReactive (Mac48Address destination)
 {
-  std::map<Mac48Address, ReactiveRoute>::iterator i = m_routes.find (destination);
-  if (i == m_routes.end ())
+  ReactiveRoute *route = FindReactive (destination);
+  if (route == 0)
     {
       return LookupResult ();
     }
-  if ((i->second.whenExpire < Simulator::Now ()) && (i->second.whenExpire != Seconds (0)))
+  if ((route->whenExpire < Simulator::Now ()) && (route->whenExpire != Seconds (0)))
     {
       NS_LOG_DEBUG ("Reactive route has expired, sorry.");
       return LookupResult ();
     }
-  return LookupReactiveExpired (destination);
+  return LookupResult (route->retransmitter, route->interface, route->metric, route->seqnum,
+                       route->whenExpire - Simulator::Now ());
 }
 HwmpRtable::LookupResult
 HwmpRtable::LookupReactiveExpired (Mac48Address destination)
 {
-  std::map<Mac48Address, ReactiveRoute>::iterator i = m_routes.find (destination);
-  if (i == m_routes.end ())
+  ReactiveRoute *route = FindReactive (destination);
+  if (route == 0)
     {
       return LookupResult ();
     }
-  return LookupResult (i->second.retransmitter, i->second.interface, i->second.metric, i->second.seqnum,
-                       i->second.whenExpire - Simulator::Now ());
+  return LookupResult (route->retransmitter, route->interface, route->metric, route->seqnum,
+                       route->whenExpire - Simulator::Now ());
 }
 HwmpRtable::LookupResult
 HwmpRtable::LookupProactive ()
@@ -186,16 +309,24 @@ HwmpRtable::GetUnreachableDestinations (Mac48Address peerAddress)
 {
   HwmpProtocol::FailedDestination dst;
   std::vector<HwmpProtocol::FailedDestination> retval;
-  for (std::map<Mac48Address, ReactiveRoute>::iterator i = m_routes.begin (); i != m_routes.end (); i++)
+  // The destinations are reported in the order of their addresses
+  std::vector<std::pair<uint64_t, ReactiveRoute *> > unreachable;
+  for (std::vector<ReactiveRoute>::iterator i = m_routes.begin (); i != m_routes.end (); i++)
     {
-      if (i->second.retransmitter == peerAddress)
+      if (i->key != EMPTY_KEY && i->retransmitter == peerAddress)
         {
-          dst.destination = i->first;
-          i->second.seqnum++;
-          dst.seqnum = i->second.seqnum;
-          retval.push_back (dst);
+          unreachable.push_back (std::make_pair (i->key, &*i));
         }
     }
+  std::sort (unreachable.begin (), unreachable.end ());
+  for (std::vector<std::pair<uint64_t, ReactiveRoute *> >::iterator i = unreachable.begin ();
+       i != unreachable.end (); i++)
+    {
+      dst.destination = i->second->destination;
+      i->second->seqnum++;
+      dst.seqnum = i->second->seqnum;
+      retval.push_back (dst);
+    }
   //Lookup a path to root
   if (m_root.retransmitter == peerAddress)
     {
@@ -210,15 +341,15 @@ HwmpRtable::GetPrecursors (Mac48Address destination)
 {
   //We suppose that no duplicates here can be
   PrecursorList retval;
-  std::map<Mac48Address, ReactiveRoute>::iterator route = m_routes.find (destination);
-  if (route != m_routes.end ())
+  ReactiveRoute *route = FindReactive (destination);
+  if (route != 0)
     {
-      for (std::vector<Precursor>::const_iterator i = route->second.precursors.begin ();
-           i != route->second.precursors.end (); i++)
+      for (uint32_t j = 0; j < route->nPrecursors; j++)
         {
-          if (i->whenExpire > Simulator::Now ())
+          const Precursor &precursor = GetPrecursor (*route, j);
+          if (precursor.whenExpire > Simulator::Now ())
             {
-              retval.push_back (std::make_pair (i->interface, i->address));
+              retval.push_back (std::make_pair (precursor.interface, precursor.address));
             }
         }
     }
@@ -21,7 +21,7 @@
 #ifndef HWMP_RTABLE_H
 #define HWMP_RTABLE_H
 
-#include <map>
+#include <vector>
 #include "ns3/nstime.h"
 #include "ns3/mac48-address.h"
 #include "ns3/hwmp-protocol.h"
@@ -31,6 +31,11 @@ namespace dot11s {
  * \ingroup dot11s
  *
  * \brief Routing table for HWMP -- 802.11s routing protocol
+ *
+ * The reactive routes are looked up for every data frame forwarded, so
+ * they are kept in a flat hash table with open addressing, keyed by the
+ * 48 bits of their destination, and their first precursors are kept in
+ * the routes themselves.
  */
 class HwmpRtable : public Object
 {
@@ -115,14 +120,20 @@ private:
     uint32_t interface;
     Time whenExpire;
   };
+  /// Number of precursors of a reactive route kept in the route itself
+  static const uint32_t INLINE_PRECURSORS = 4;
   struct ReactiveRoute
   {
+    uint64_t key; ///< destination as packed by GetKey, or EMPTY_KEY for an empty slot
+    Mac48Address destination;
     Mac48Address retransmitter;
     uint32_t interface;
     uint32_t metric;
     Time whenExpire;
     uint32_t seqnum;
-    std::vector<Precursor> precursors;
+    uint32_t nPrecursors;
+    Precursor precursors[INLINE_PRECURSORS]; ///< the first precursors
+    std::vector<Precursor> morePrecursors; ///< the others, in the order they were added
   };
   /// Route fond in proactive mode
   struct ProactiveRoute
@@ -136,8 +147,23 @@ private:
     std::vector<Precursor> precursors;
   };
 
-  /// List of routes
-  std::map<Mac48Address, ReactiveRoute>  m_routes;
+  /// \return the 48 bits of an address, the first byte highest, which
+  /// sort like the addresses
+  static uint64_t GetKey (Mac48Address address);
+  /// \return the slot where the route to a destination would be if
+  /// the slot were empty
+  uint32_t GetHome (uint64_t key) const;
+  /// \return the route to a destination, or 0 if there is none
+  ReactiveRoute * FindReactive (Mac48Address destination);
+  void Rehash (uint32_t nSlots);
+  Precursor & GetPrecursor (ReactiveRoute & route, uint32_t index);
+
+  /// Hash table of the reactive routes, with linear probing
+  std::vector<ReactiveRoute> m_routes;
+  /// Number of reactive routes
+  uint32_t m_nRoutes;
+  /// 64 minus the log2 of the number of slots of m_routes
+  uint32_t m_shift;
   /// Path to proactive tree root MP
   ProactiveRoute  m_root;
 };
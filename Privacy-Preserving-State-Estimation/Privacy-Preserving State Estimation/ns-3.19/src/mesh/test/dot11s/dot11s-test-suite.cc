@@ -25,6 +25,15 @@
 #include "ns3/hwmp-rtable.h"
 #include "ns3/peer-link-frame.h"
 #include "ns3/ie-dot11s-peer-management.h"
+#include "ns3/hwmp-protocol.h"
+#include "ns3/mesh-helper.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/yans-wifi-helper.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/string.h"
+
+#include <algorithm>
 
 namespace ns3 {
 namespace dot11s {
@@ -207,6 +216,308 @@ HwmpRtableTest::DoRun ()
   Simulator::Destroy ();
 }
 //-----------------------------------------------------------------------------
+/// Unit test for HwmpRtable with many destinations and precursors
+struct HwmpRtableManyTest : public TestCase
+{
+  HwmpRtableManyTest () :
+    TestCase ("HWMP routing table with many destinations")
+  {
+  }
+  virtual void DoRun ();
+  /// \return the i-th destination, spread over the address space
+  static Mac48Address GetDestination (uint32_t i);
+};
+
+Mac48Address
+HwmpRtableManyTest::GetDestination (uint32_t i)
+{
+  uint8_t buffer[6] = { (uint8_t)(i * 37), 0, (uint8_t)(i >> 8), 0, 0, (uint8_t) i };
+  Mac48Address address;
+  address.CopyFrom (buffer);
+  return address;
+}
+
+void
+HwmpRtableManyTest::DoRun ()
+{
+  Ptr<HwmpRtable> table = CreateObject<HwmpRtable> ();
+  Mac48Address even ("00:00:00:00:00:aa");
+  Mac48Address odd ("00:00:00:00:00:bb");
+  const uint32_t n = 1000;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      table->AddReactivePath (GetDestination (i), i % 2 ? odd : even, 1, i, Seconds (10), i);
+    }
+  // Removed routes are shifted over by the following ones
+  for (uint32_t i = 0; i < n; i += 3)
+    {
+      table->DeleteReactivePath (GetDestination (i));
+    }
+  std::vector<Mac48Address> unreachable;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      HwmpRtable::LookupResult result = table->LookupReactive (GetDestination (i));
+      if (i % 3 == 0)
+        {
+          NS_TEST_EXPECT_MSG_EQ (result.IsValid (), false, "Route " << i << " deleted");
+        }
+      else
+        {
+          NS_TEST_EXPECT_MSG_EQ ((result == HwmpRtable::LookupResult (i % 2 ? odd : even, 1, i, i)), true,
+                                 "Route " << i << " found");
+          if (i % 2 == 0)
+            {
+              unreachable.push_back (GetDestination (i));
+            }
+        }
+    }
+
+  // The precursors past those kept in the route are kept in order
+  Mac48Address destination = GetDestination (1);
+  for (uint32_t i = 0; i < 7; i++)
+    {
+      table->AddPrecursor (destination, i, GetDestination (n + i), Seconds (10));
+    }
+  table->AddPrecursor (destination, 2, GetDestination (n + 2), Seconds (20));
+  HwmpRtable::PrecursorList precursors = table->GetPrecursors (destination);
+  NS_TEST_ASSERT_MSG_EQ (precursors.size (), 7, "Precursors added once");
+  for (uint32_t i = 0; i < 7; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (precursors[i].first, i, "Precursor " << i << " in order");
+      NS_TEST_EXPECT_MSG_EQ (precursors[i].second, GetDestination (n + i), "Precursor " << i << " in order");
+    }
+
+  // The unreachable destinations are reported in the order of their addresses
+  std::sort (unreachable.begin (), unreachable.end ());
+  std::vector<HwmpProtocol::FailedDestination> failed = table->GetUnreachableDestinations (even);
+  NS_TEST_ASSERT_MSG_EQ (failed.size (), unreachable.size (), "Unreachable destinations");
+  for (uint32_t i = 0; i < failed.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (failed[i].destination, unreachable[i], "Unreachable destination " << i);
+    }
+  NS_TEST_EXPECT_MSG_EQ (table->LookupReactive (GetDestination (2)).seqnum, 3, "Sequence number incremented");
+  Simulator::Destroy ();
+}
+//-----------------------------------------------------------------------------
+/// Built-in self test for the proactive PREQs scheduled by a root
+class HwmpProactivePreqTest : public TestCase
+{
+public:
+  HwmpProactivePreqTest ();
+  virtual void DoRun ();
+
+private:
+  /// Proactive PREQs of the root of a line of mesh points at 5.5 s and 7.1 s
+  std::pair<uint32_t, uint32_t> Run (bool warmUp);
+};
+
+HwmpProactivePreqTest::HwmpProactivePreqTest () :
+  TestCase ("HWMP proactive PREQs scheduled before a burst")
+{
+}
+
+std::pair<uint32_t, uint32_t>
+HwmpProactivePreqTest::Run (bool warmUp)
+{
+  NodeContainer nodes;
+  nodes.Create (3);
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::GridPositionAllocator",
+                                 "DeltaX", DoubleValue (100),
+                                 "GridWidth", UintegerValue (3),
+                                 "LayoutType", StringValue ("RowFirst"));
+  mobility.Install (nodes);
+  YansWifiPhyHelper wifiPhy = YansWifiPhyHelper::Default ();
+  wifiPhy.SetChannel (YansWifiChannelHelper::Default ().Create ());
+  MeshHelper mesh = MeshHelper::Default ();
+  mesh.SetStackInstaller ("ns3::Dot11sStack");
+  NetDeviceContainer devices = mesh.Install (wifiPhy, nodes);
+  Ptr<HwmpProtocol> root = devices.Get (0)->GetObject<HwmpProtocol> ();
+  Ptr<HwmpProtocol> meter = devices.Get (2)->GetObject<HwmpProtocol> ();
+  root->SetRoot ();
+  if (warmUp)
+    {
+      root->ScheduleProactivePreq (Seconds (5));
+      // Not a root
+      meter->ScheduleProactivePreq (Seconds (5));
+    }
+
+  Simulator::Stop (Seconds (5.5));
+  Simulator::Run ();
+  std::pair<uint32_t, uint32_t> preqs;
+  preqs.first = root->GetOverhead ().initiatedProactivePreq;
+  NS_TEST_EXPECT_MSG_EQ (meter->GetOverhead ().initiatedProactivePreq, 0, "PREQ of a mesh point which is not a root");
+  NS_TEST_EXPECT_MSG_GT (meter->GetOverhead ().txPreq, 0, "Proactive PREQ not forwarded");
+  Simulator::Stop (Seconds (1.6));
+  Simulator::Run ();
+  preqs.second = root->GetOverhead ().initiatedProactivePreq;
+  Simulator::Destroy ();
+  return preqs;
+}
+
+void
+HwmpProactivePreqTest::DoRun ()
+{
+  // The periodic PREQs, every 2.048 s after a random start below 0.1 s
+  std::pair<uint32_t, uint32_t> preqs = Run (false);
+  NS_TEST_EXPECT_MSG_EQ (preqs.first, 3, "Periodic PREQs until 5.5 s");
+  NS_TEST_EXPECT_MSG_EQ (preqs.second, 4, "Periodic PREQs until 7.1 s");
+  // The PREQ at 5 s is followed by the next one at 7.048 s
+  preqs = Run (true);
+  NS_TEST_EXPECT_MSG_EQ (preqs.first, 4, "PREQ scheduled at 5 s");
+  NS_TEST_EXPECT_MSG_EQ (preqs.second, 5, "Periodic PREQs after the scheduled one");
+}
+//-----------------------------------------------------------------------------
+/// Unit test for the queue of the packets waiting for a route
+class HwmpQueueTest : public TestCase
+{
+public:
+  HwmpQueueTest ();
+  virtual void DoRun ();
+
+private:
+  /// Queues a packet to dst, told apart by its protocol number
+  bool Queue (Mac48Address dst, uint16_t id);
+  /// Checks that the index by destination matches the list of packets
+  void CheckIndex ();
+  /// Checks the protocol number of a dequeued packet, 0 if none
+  void CheckPacket (HwmpProtocol::QueuedPacket packet, uint16_t id);
+  /// Checks the queue and empties it
+  void TestOrder ();
+  /// Checks the limit of the number of packets of all destinations
+  void TestMaxQueueSize ();
+
+  Ptr<HwmpProtocol> m_hwmp;
+  Mac48Address m_a;
+  Mac48Address m_b;
+  Mac48Address m_c;
+};
+
+HwmpQueueTest::HwmpQueueTest () :
+  TestCase ("HWMP queue of the packets waiting for a route"),
+  m_a ("00:00:00:00:00:0a"),
+  m_b ("00:00:00:00:00:0b"),
+  m_c ("00:00:00:00:00:0c")
+{
+}
+
+bool
+HwmpQueueTest::Queue (Mac48Address dst, uint16_t id)
+{
+  HwmpProtocol::QueuedPacket packet;
+  packet.pkt = Create<Packet> ();
+  packet.dst = dst;
+  packet.protocol = id;
+  return m_hwmp->QueuePacket (packet);
+}
+
+void
+HwmpQueueTest::CheckIndex ()
+{
+  std::map<const HwmpProtocol::QueuedPacket *, uint32_t> positions;
+  uint32_t position = 0;
+  for (HwmpProtocol::QueuedPacketList::const_iterator i = m_hwmp->m_rqueue.begin (); i != m_hwmp->m_rqueue.end (); ++i)
+    {
+      positions[&*i] = position++;
+    }
+  NS_TEST_EXPECT_MSG_EQ (m_hwmp->m_rqueueSize, m_hwmp->m_rqueue.size (), "Wrong number of packets");
+  uint32_t indexed = 0;
+  for (std::map<Mac48Address, std::deque<HwmpProtocol::QueuedPacketList::iterator> >::const_iterator i = m_hwmp->m_rqueueByDst.begin ();
+       i != m_hwmp->m_rqueueByDst.end (); ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (i->second.empty (), false, "Destination left without packets");
+      for (uint32_t j = 0; j < i->second.size (); j++)
+        {
+          std::map<const HwmpProtocol::QueuedPacket *, uint32_t>::const_iterator k = positions.find (&*i->second[j]);
+          NS_TEST_ASSERT_MSG_EQ ((k != positions.end ()), true, "Index of a packet not queued");
+          NS_TEST_EXPECT_MSG_EQ (i->second[j]->dst, i->first, "Packet indexed under another destination");
+          if (j > 0)
+            {
+              NS_TEST_EXPECT_MSG_GT (k->second, positions[&*i->second[j - 1]], "Index out of the order of the queue");
+            }
+          indexed++;
+        }
+    }
+  NS_TEST_EXPECT_MSG_EQ (indexed, m_hwmp->m_rqueue.size (), "Packets missing from the index");
+}
+
+void
+HwmpQueueTest::CheckPacket (HwmpProtocol::QueuedPacket packet, uint16_t id)
+{
+  if (id == 0)
+    {
+      NS_TEST_EXPECT_MSG_EQ ((packet.pkt == 0), true, "Packet dequeued from an empty queue");
+      return;
+    }
+  NS_TEST_ASSERT_MSG_EQ ((packet.pkt != 0), true, "Packet " << id << " not dequeued");
+  NS_TEST_EXPECT_MSG_EQ (packet.protocol, id, "Wrong packet dequeued");
+  CheckIndex ();
+}
+
+void
+HwmpQueueTest::TestOrder ()
+{
+  Queue (m_a, 1);
+  Queue (m_b, 2);
+  Queue (m_a, 3);
+  Queue (m_c, 4);
+  Queue (m_b, 5);
+  Queue (m_a, 6);
+  Queue (m_a, 7);
+  CheckIndex ();
+
+  // Each destination in the order its packets came, the others untouched
+  CheckPacket (m_hwmp->DequeueFirstPacketByDst (m_b), 2);
+  CheckPacket (m_hwmp->DequeueFirstPacketByDst (m_a), 1);
+  CheckPacket (m_hwmp->DequeueFirstPacketByDst (m_a), 3);
+  NS_TEST_EXPECT_MSG_EQ (m_hwmp->m_rqueueSize, 4, "Packets of other destinations dequeued");
+  CheckPacket (m_hwmp->DequeueFirstPacket (), 4);
+  CheckPacket (m_hwmp->DequeueFirstPacketByDst (m_c), 0);
+  Queue (m_c, 8);
+  CheckPacket (m_hwmp->DequeueFirstPacket (), 5);
+  CheckPacket (m_hwmp->DequeueFirstPacketByDst (m_b), 0);
+  CheckPacket (m_hwmp->DequeueFirstPacketByDst (m_a), 6);
+  CheckPacket (m_hwmp->DequeueFirstPacket (), 7);
+  CheckPacket (m_hwmp->DequeueFirstPacketByDst (m_c), 8);
+  CheckPacket (m_hwmp->DequeueFirstPacket (), 0);
+  NS_TEST_EXPECT_MSG_EQ (m_hwmp->m_rqueueByDst.empty (), true, "Index of an empty queue");
+}
+
+void
+HwmpQueueTest::TestMaxQueueSize ()
+{
+  m_hwmp->SetAttribute ("MaxQueueSize", UintegerValue (4));
+  // A packet is dropped once the queue holds more than MaxQueueSize,
+  // whatever its destination
+  uint16_t id = 1;
+  for (; id <= 5; id++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (Queue (id % 2 ? m_a : m_b, id), true, "Packet " << id << " dropped");
+    }
+  NS_TEST_EXPECT_MSG_EQ (Queue (m_c, id), false, "Packet queued beyond MaxQueueSize");
+  NS_TEST_EXPECT_MSG_EQ (m_hwmp->m_rqueueSize, 5, "Wrong number of packets");
+  NS_TEST_EXPECT_MSG_EQ ((m_hwmp->m_rqueueByDst.find (m_c) == m_hwmp->m_rqueueByDst.end ()), true,
+                         "Dropped packet indexed");
+  CheckIndex ();
+
+  CheckPacket (m_hwmp->DequeueFirstPacketByDst (m_b), 2);
+  NS_TEST_EXPECT_MSG_EQ (Queue (m_c, id), true, "Packet dropped after a dequeue");
+  NS_TEST_EXPECT_MSG_EQ (Queue (m_c, id + 1), false, "Packet queued beyond MaxQueueSize");
+  CheckIndex ();
+  CheckPacket (m_hwmp->DequeueFirstPacketByDst (m_c), id);
+  CheckPacket (m_hwmp->DequeueFirstPacketByDst (m_c), 0);
+}
+
+void
+HwmpQueueTest::DoRun ()
+{
+  m_hwmp = CreateObject<HwmpProtocol> ();
+  TestOrder ();
+  TestMaxQueueSize ();
+  m_hwmp->Dispose ();
+  m_hwmp = 0;
+}
+//-----------------------------------------------------------------------------
 /// Built-in self test for PeerLinkFrameStart
 struct PeerLinkFrameStartTest : public TestCase
 {
@@ -281,6 +592,9 @@ Dot11sTestSuite::Dot11sTestSuite ()
 {
   AddTestCase (new MeshHeaderTest, TestCase::QUICK);
   AddTestCase (new HwmpRtableTest, TestCase::QUICK);
+  AddTestCase (new HwmpRtableManyTest, TestCase::QUICK);
+  AddTestCase (new HwmpProactivePreqTest, TestCase::QUICK);
+  AddTestCase (new HwmpQueueTest, TestCase::QUICK);
   AddTestCase (new PeerLinkFrameStartTest, TestCase::QUICK);
 }
 
@@ -104,6 +104,15 @@ void
 DelayJitterEstimation::PrepareTx (Ptr<const Packet> packet)
 {
   DelayJitterEstimationTimestampTag tag;
+  if (!Packet::MetadataEnabled ())
+    {
+      // Byte tags are dropped: keep the first timestamp in a packet tag
+      if (!packet->PeekPacketTag (tag))
+        {
+          packet->AddPacketTag (tag);
+        }
+      return;
+    }
   packet->AddByteTag (tag);
 }
 void
@@ -112,6 +121,10 @@ DelayJitterEstimation::RecordRx (Ptr<const Packet> packet)
   DelayJitterEstimationTimestampTag tag;
   bool found;
   found = packet->FindFirstMatchingByteTag (tag);
+  if (!found)
+    {
+      found = packet->PeekPacketTag (tag);
+    }
   if (!found)
     {
       return;
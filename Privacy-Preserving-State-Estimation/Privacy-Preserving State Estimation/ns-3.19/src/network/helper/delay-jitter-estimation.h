@@ -45,6 +45,8 @@ public:
    * tx time is stored in the packet as an ns3::Tag which means
    * that it does not use any network resources and is not
    * taken into account in transmission delay calculations.
+   * The tag is a byte tag, or a packet tag when the
+   * "PacketMetadataEnabled" global value drops the byte tags.
    */
   static void PrepareTx (Ptr<const Packet> packet);
   /**
@@ -18,6 +18,7 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 #include "buffer.h"
+#include "packet-arena.h"
 #include "ns3/assert.h"
 #include "ns3/log.h"
 
@@ -165,9 +166,11 @@ Buffer::Allocate (uint32_t reqSize)
     }
   NS_ASSERT (reqSize >= 1);
   uint32_t size = reqSize - 1 + sizeof (struct Buffer::Data);
-  uint8_t *b = new uint8_t [size];
-  struct Buffer::Data *data = reinterpret_cast<struct Buffer::Data*>(b);
-  data->m_size = reqSize;
+  uint32_t capacity;
+  void *b = PacketArena::Allocate (size, PacketArena::BUFFER, &capacity);
+  struct Buffer::Data *data = static_cast<struct Buffer::Data*>(b);
+  // the rest of the block of the arena is usable too
+  data->m_size = capacity + 1 - sizeof (struct Buffer::Data);
   data->m_count = 1;
   return data;
 }
@@ -177,8 +180,7 @@ Buffer::Deallocate (struct Buffer::Data *data)
 {
   NS_LOG_FUNCTION (data);
   NS_ASSERT (data->m_count == 0);
-  uint8_t *buf = reinterpret_cast<uint8_t *> (data);
-  delete [] buf;
+  PacketArena::Deallocate (data, data->m_size - 1 + sizeof (struct Buffer::Data), PacketArena::BUFFER);
 }
 
 Buffer::Buffer ()
@@ -240,7 +242,7 @@ void
 Buffer::Initialize (uint32_t zeroSize)
 {
   NS_LOG_FUNCTION (this << zeroSize);
-  m_data = Buffer::Create (0);
+  m_data = Buffer::Create (g_recommendedStart);
   m_start = std::min (m_data->m_size, g_recommendedStart);
   m_maxZeroAreaStart = m_start;
   m_zeroAreaStart = m_start;
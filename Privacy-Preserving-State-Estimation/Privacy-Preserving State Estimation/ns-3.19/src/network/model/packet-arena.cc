@@ -0,0 +1,204 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "packet-arena.h"
+#include "ns3/assert.h"
+#include "ns3/core-config.h"
+#include <cstring>
+
+namespace ns3 {
+
+namespace {
+
+/**
+ * The sizes of the blocks of each class, multiples of 16 bytes so that
+ * the blocks are aligned like the heap:
+ *  - up to 128 bytes: the Packet objects (96 bytes), the nodes of the
+ *    packet tag lists (48 bytes), the byte tag lists, and the buffers of
+ *    the control frames;
+ *  - up to 384 bytes: the buffers of the reports of the meters and of
+ *    the HWMP and peering management frames;
+ *  - up to 2560 bytes: the buffers of larger frames, up to an MSDU of
+ *    2304 bytes with its headers.
+ */
+const uint32_t g_classSizes[] = {
+  32, 48, 64, 96, 128, 160, 192, 256, 320, 384, 512, 768, 1024, 1536, 2048, 2560
+};
+const uint32_t N_CLASSES = sizeof (g_classSizes) / sizeof (g_classSizes[0]);
+/// The size of a slab, in bytes
+const uint32_t SLAB_SIZE = 64 * 1024;
+/// The size of the header of a slab, which keeps the blocks aligned
+const uint32_t SLAB_HEADER_SIZE = 16;
+
+struct FreeBlock
+{
+  struct FreeBlock *next;
+};
+
+struct Slab
+{
+  struct Slab *next;
+};
+
+#ifndef NS3_MULTITHREADED
+struct SizeClass
+{
+  /// The blocks released
+  struct FreeBlock *free;
+  /// The part of the last slab which is not carved yet
+  uint8_t *current;
+  uint8_t *end;
+};
+
+/* These are zero-initialized before any constructor runs, so that
+ * packets may be created and destroyed by static constructors and
+ * destructors.
+ */
+struct SizeClass g_classes[N_CLASSES];
+/// All the slabs, kept reachable for the memory checkers
+struct Slab *g_slabs;
+#endif /* NS3_MULTITHREADED */
+struct PacketArena::Stats g_stats;
+
+inline void
+Count (uint64_t *counter)
+{
+#ifdef NS3_MULTITHREADED
+  __sync_fetch_and_add (counter, 1);
+#else
+  (*counter)++;
+#endif
+}
+
+#ifndef NS3_MULTITHREADED
+/// \returns the index of the smallest class of at least size bytes, or N_CLASSES
+inline uint32_t
+GetClass (uint32_t size)
+{
+  uint32_t i = 0;
+  while (i < N_CLASSES && g_classSizes[i] < size)
+    {
+      i++;
+    }
+  return i;
+}
+
+uint8_t *
+AllocateSlab (void)
+{
+  uint8_t *buffer = new uint8_t [SLAB_SIZE];
+  struct Slab *slab = reinterpret_cast<struct Slab *> (buffer);
+  slab->next = g_slabs;
+  g_slabs = slab;
+  g_stats.slabs++;
+  g_stats.slabBytes += SLAB_SIZE;
+  return buffer + SLAB_HEADER_SIZE;
+}
+#endif /* NS3_MULTITHREADED */
+
+} // anonymous namespace
+
+void *
+PacketArena::Allocate (uint32_t size, enum Kind kind, uint32_t *capacity)
+{
+  Count (&g_stats.allocations[kind]);
+#ifndef NS3_MULTITHREADED
+  uint32_t i = GetClass (size);
+  if (i < N_CLASSES)
+    {
+      struct SizeClass *sizeClass = &g_classes[i];
+      uint32_t blockSize = g_classSizes[i];
+      if (capacity != 0)
+        {
+          *capacity = blockSize;
+        }
+      if (sizeClass->free != 0)
+        {
+          struct FreeBlock *block = sizeClass->free;
+          sizeClass->free = block->next;
+          return block;
+        }
+      if (static_cast<uint32_t> (sizeClass->end - sizeClass->current) < blockSize)
+        {
+          sizeClass->current = AllocateSlab ();
+          sizeClass->end = sizeClass->current + (SLAB_SIZE - SLAB_HEADER_SIZE);
+        }
+      uint8_t *block = sizeClass->current;
+      sizeClass->current += blockSize;
+      return block;
+    }
+#endif /* NS3_MULTITHREADED */
+  Count (&g_stats.heapAllocations[kind]);
+  if (capacity != 0)
+    {
+      *capacity = size;
+    }
+  return new uint8_t [size];
+}
+
+void
+PacketArena::Deallocate (void *block, uint32_t size, enum Kind kind)
+{
+  Count (&g_stats.deallocations[kind]);
+#ifndef NS3_MULTITHREADED
+  uint32_t i = GetClass (size);
+  if (i < N_CLASSES)
+    {
+      struct FreeBlock *freeBlock = static_cast<struct FreeBlock *> (block);
+      freeBlock->next = g_classes[i].free;
+      g_classes[i].free = freeBlock;
+      return;
+    }
+#endif /* NS3_MULTITHREADED */
+  delete [] static_cast<uint8_t *> (block);
+}
+
+struct PacketArena::Stats
+PacketArena::GetStats (void)
+{
+  return g_stats;
+}
+
+void
+PacketArena::ResetStats (void)
+{
+  std::memset (&g_stats, 0, sizeof (g_stats));
+}
+
+void
+PacketArena::PrintStats (std::ostream &os)
+{
+  static const char *names[N_KINDS] = { "packet", "buffer", "byte-tags", "packet-tags" };
+  uint64_t packets = g_stats.allocations[PACKET];
+  uint64_t total = 0;
+  uint64_t heap = 0;
+  std::streamsize oldPrecision = os.precision (3);
+  os << "kind\tallocations\theap\tdeallocations\tper packet" << std::endl;
+  for (uint32_t i = 0; i < N_KINDS; i++)
+    {
+      total += g_stats.allocations[i];
+      heap += g_stats.heapAllocations[i];
+      os << names[i] << "\t" << g_stats.allocations[i] << "\t" << g_stats.heapAllocations[i]
+         << "\t" << g_stats.deallocations[i] << "\t"
+         << (packets > 0 ? double (g_stats.allocations[i]) / packets : 0)
+         << std::endl;
+    }
+  os << "total\t" << total << "\t" << heap << "\t\t"
+     << (packets > 0 ? double (total) / packets : 0) << std::endl;
+  os << "slabs\t" << g_stats.slabs << "\t" << g_stats.slabBytes << " bytes" << std::endl;
+  os.precision (oldPrecision);
+}
+
+} // namespace ns3
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef PACKET_ARENA_H
+#define PACKET_ARENA_H
+
+#include <stdint.h>
+#include <ostream>
+
+namespace ns3 {
+
+/**
+ * \ingroup packet
+ *
+ * \brief The slab allocator of the packets, of their buffer data and of
+ * their tag lists.
+ *
+ * The blocks are carved out of slabs, one list of slabs per size class,
+ * and are kept on a free list of their class when they are released, so
+ * that the packets of a simulation reuse the memory of the packets
+ * before them rather than going to the heap. The size classes follow the
+ * frames of an 802.11s mesh: small blocks for the Packet objects, the
+ * packet tags and the byte tags, blocks of a few hundred bytes for the
+ * buffers of the reports of the meters and of the management frames,
+ * and blocks for the buffers of full-sized frames. The larger blocks
+ * come from the heap.
+ *
+ * The slabs are never returned to the heap, as packets may outlive the
+ * simulation which created them: the memory of a simulation is reused
+ * by the next one of the same program.
+ *
+ * When ns-3 is built with the multithreaded simulator, all the blocks
+ * come from the heap, as the free lists are not shared by the threads.
+ *
+ * The allocations are counted for each kind of block, which tells how
+ * many allocations a packet costs:
+ * \code
+ * PacketArena::ResetStats ();
+ * Simulator::Run ();
+ * PacketArena::PrintStats (std::cout);
+ * \endcode
+ */
+class PacketArena
+{
+public:
+  /// The kinds of blocks, which are counted apart
+  enum Kind
+  {
+    PACKET = 0,  /**< Packet objects */
+    BUFFER,      /**< Data of the Buffer of a packet */
+    BYTE_TAGS,   /**< Data of a ByteTagList */
+    PACKET_TAGS, /**< Nodes of a PacketTagList */
+    N_KINDS
+  };
+
+  /// The allocation counts, since the start or the last ResetStats
+  struct Stats
+  {
+    /// Blocks allocated, from the slabs or from the heap
+    uint64_t allocations[N_KINDS];
+    /// Blocks allocated from the heap, larger than the size classes
+    uint64_t heapAllocations[N_KINDS];
+    /// Blocks released
+    uint64_t deallocations[N_KINDS];
+    /// Slabs allocated from the heap
+    uint64_t slabs;
+    /// Bytes of the slabs allocated from the heap
+    uint64_t slabBytes;
+  };
+
+  /**
+   * \param size the size of the block, in bytes
+   * \param kind the kind of the block
+   * \param capacity if not null, set to the size which can be used in
+   * the block, at least size
+   * \returns a block of at least size bytes, aligned like the heap
+   */
+  static void * Allocate (uint32_t size, enum Kind kind, uint32_t *capacity = 0);
+  /**
+   * \param block a block returned by Allocate
+   * \param size the size requested for the block, or its capacity
+   * \param kind the kind of the block
+   */
+  static void Deallocate (void *block, uint32_t size, enum Kind kind);
+
+  /**
+   * \returns the allocation counts
+   */
+  static struct Stats GetStats (void);
+  /**
+   * Zero the allocation counts, for example at the start of a
+   * simulation. The blocks which are allocated before and released
+   * after are counted in the deallocations only.
+   */
+  static void ResetStats (void);
+  /**
+   * Print the allocation counts of each kind of block, and the
+   * allocations per Packet object.
+   *
+   * \param os the output stream
+   */
+  static void PrintStats (std::ostream &os);
+};
+
+} // namespace ns3
+
+#endif /* PACKET_ARENA_H */
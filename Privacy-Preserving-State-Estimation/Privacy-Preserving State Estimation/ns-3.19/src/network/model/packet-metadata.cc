@@ -22,6 +22,7 @@
 #include "ns3/assert.h"
 #include "ns3/fatal-error.h"
 #include "ns3/log.h"
+#include "ns3/core-config.h"
 #include "packet-metadata.h"
 #include "buffer.h"
 #include "header.h"
@@ -582,6 +583,10 @@ struct PacketMetadata::Data *
 PacketMetadata::Create (uint32_t size)
 {
   NS_LOG_FUNCTION (size);
+#ifdef NS3_MULTITHREADED
+  // The free list is shared by all the threads of the multithreaded simulator
+  return PacketMetadata::Allocate (size);
+#else
   NS_LOG_LOGIC ("create size="<<size<<", max="<<m_maxSize);
   if (size > m_maxSize)
     {
@@ -602,12 +607,16 @@ PacketMetadata::Create (uint32_t size)
     }
   NS_LOG_LOGIC ("create alloc size="<<m_maxSize);
   return PacketMetadata::Allocate (m_maxSize);
+#endif
 }
 
 void
 PacketMetadata::Recycle (struct PacketMetadata::Data *data)
 {
   NS_LOG_FUNCTION (data);
+#ifdef NS3_MULTITHREADED
+  PacketMetadata::Deallocate (data);
+#else
   if (!m_enable)
     {
       PacketMetadata::Deallocate (data);
@@ -624,6 +633,7 @@ PacketMetadata::Recycle (struct PacketMetadata::Data *data)
     {
       m_freeList.push_back (data);
     }
+#endif
 }
 
 struct PacketMetadata::Data *
@@ -134,7 +134,7 @@ PacketTagList::COWTraverse (Tag & tag, PacketTagList::COWWriter Writer)
       NS_ASSERT (cur != 0);
       NS_ASSERT (cur->count > 1);
       cur->count--;                       // unmerge cur
-      struct TagData * copy = new struct TagData ();
+      struct TagData * copy = CreateTagData ();
       copy->tid = cur->tid;
       copy->count = 1;
       memcpy (copy->data, cur->data, TagData::MAX_SIZE);
@@ -178,7 +178,7 @@ PacketTagList::RemoveWriter (Tag & tag, bool preMerge,
   if (preMerge)
     {
       // found tid before first merge, so delete cur
-      delete cur;
+      FreeTagData (cur);
     }
   else
     {
@@ -226,7 +226,7 @@ PacketTagList::ReplaceWriter (Tag & tag, bool preMerge,
       // cur is always a merge at this point
       // need to copy, replace, and link past cur
       cur->count--;                     // unmerge cur
-      struct TagData * copy = new struct TagData ();
+      struct TagData * copy = CreateTagData ();
       copy->tid = tag.GetInstanceTypeId ();
       copy->count = 1;
       tag.Serialize (TagBuffer (copy->data,
@@ -250,7 +250,7 @@ PacketTagList::Add (const Tag &tag) const
     {
       NS_ASSERT (cur->tid != tag.GetInstanceTypeId ());
     }
-  struct TagData * head = new struct TagData ();
+  struct TagData * head = CreateTagData ();
   head->count = 1;
   head->next = 0;
   head->tid = tag.GetInstanceTypeId ();
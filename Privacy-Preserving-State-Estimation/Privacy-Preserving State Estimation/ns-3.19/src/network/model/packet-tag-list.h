@@ -27,7 +27,9 @@
 
 #include <stdint.h>
 #include <ostream>
+#include <new>
 #include "ns3/type-id.h"
+#include "packet-arena.h"
 
 namespace ns3 {
 
@@ -286,6 +288,17 @@ private:
    */
   bool ReplaceWriter (Tag & tag, bool preMerge, struct TagData * cur, struct TagData ** prevNext);
 
+  /**
+   * \returns a new TagData from the PacketArena, zeroed like by new
+   */
+  static inline struct TagData * CreateTagData (void);
+  /**
+   * Release a TagData to the PacketArena.
+   *
+   * \param [in] data The TagData
+   */
+  static inline void FreeTagData (struct TagData * data);
+
   /**
    * Pointer to first \ref TagData on the list
    */
@@ -300,6 +313,20 @@ private:
 
 namespace ns3 {
 
+struct PacketTagList::TagData *
+PacketTagList::CreateTagData (void)
+{
+  void *block = PacketArena::Allocate (sizeof (struct TagData), PacketArena::PACKET_TAGS);
+  return new (block) struct TagData ();
+}
+
+void
+PacketTagList::FreeTagData (struct TagData * data)
+{
+  data->~TagData ();
+  PacketArena::Deallocate (data, sizeof (struct TagData), PacketArena::PACKET_TAGS);
+}
+
 PacketTagList::PacketTagList ()
   : m_next ()
 {
@@ -349,13 +376,13 @@ PacketTagList::RemoveAll (void)
         }
       if (prev != 0) 
         {
-	  delete prev;
+	  FreeTagData (prev);
         }
       prev = cur;
     }
   if (prev != 0) 
     {
-      delete prev;
+      FreeTagData (prev);
     }
   m_next = 0;
 }
@@ -18,10 +18,18 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 #include "packet.h"
+#include "packet-arena.h"
 #include "ns3/assert.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
+#include "ns3/core-config.h"
+#include "ns3/global-value.h"
+#include "ns3/boolean.h"
+#ifdef NS3_MULTITHREADED
+#include "ns3/multithreaded-simulator-impl.h"
+#endif
 #include <string>
+#include <vector>
 #include <cstdarg>
 
 NS_LOG_COMPONENT_DEFINE ("Packet");
@@ -30,6 +38,107 @@ namespace ns3 {
 
 uint32_t Packet::m_globalUid = 0;
 
+static GlobalValue g_packetMetadataEnabled = GlobalValue ("PacketMetadataEnabled",
+                                                          "A global switch which, when false, drops the metadata, "
+                                                          "the byte tags and the uids of all packets",
+                                                          BooleanValue (true),
+                                                          MakeBooleanChecker ());
+
+static bool
+ReadMetadataEnabled (void)
+{
+  BooleanValue val;
+  g_packetMetadataEnabled.GetValue (val);
+  return val.Get ();
+}
+
+/* The switch is read when it is first needed in a simulation, usually by
+ * the first packet, and is kept until Simulator::Destroy, as packets with
+ * and without uids could not be mixed within one simulation.
+ */
+enum MetadataState
+{
+  METADATA_UNREAD = 0,
+  METADATA_ENABLED,
+  METADATA_DISABLED
+};
+static int g_metadataState = METADATA_UNREAD;
+
+static void
+CheckMetadataEnabled (void)
+{
+  if (g_metadataState != METADATA_UNREAD
+      && ReadMetadataEnabled () != (g_metadataState == METADATA_ENABLED))
+    {
+      NS_FATAL_ERROR ("PacketMetadataEnabled was changed after it was read by the simulation. "
+                      "Set it before the first packet is created, or after Simulator::Destroy.");
+    }
+}
+
+static void
+ResetMetadataEnabled (void)
+{
+  CheckMetadataEnabled ();
+  g_metadataState = METADATA_UNREAD;
+}
+
+static void
+ReadMetadataState (void)
+{
+  int state = ReadMetadataEnabled () ? METADATA_ENABLED : METADATA_DISABLED;
+#ifdef NS3_MULTITHREADED
+  if (!__sync_bool_compare_and_swap (&g_metadataState, METADATA_UNREAD, state))
+    {
+      // Another partition read it first
+      return;
+    }
+#else
+  g_metadataState = state;
+#endif
+  Simulator::ScheduleDestroy (&ResetMetadataEnabled);
+}
+
+bool
+Packet::MetadataEnabled (void)
+{
+  if (g_metadataState == METADATA_UNREAD)
+    {
+      ReadMetadataState ();
+    }
+  return g_metadataState == METADATA_ENABLED;
+}
+
+uint64_t
+Packet::AllocateUid (void)
+{
+  if (!MetadataEnabled ())
+    {
+      return 0;
+    }
+  /* The upper 32 bits of the packet id in 
+   * metadata is for the system id. For non-
+   * distributed simulations, this is simply 
+   * zero.  The lower 32 bits are for the 
+   * global UID
+   */
+#ifdef NS3_MULTITHREADED
+  // Packets may be created by the threads of several partitions at once:
+  // number them per partition, the partition taking the place of the
+  // system id, so that the uids of a run do not depend on the timing of
+  // the threads
+  uint32_t partition;
+  uint32_t sequence;
+  if (MultithreadedSimulatorImpl::AllocateSequence (partition, sequence))
+    {
+      return static_cast<uint64_t> (partition) << 32 | sequence;
+    }
+  uint32_t uid = __sync_fetch_and_add (&m_globalUid, 1);
+#else
+  uint32_t uid = m_globalUid++;
+#endif
+  return static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | uid;
+}
+
 TypeId 
 ByteTagIterator::Item::GetTypeId (void) const
 {
@@ -127,20 +236,57 @@ Packet::Copy (void) const
   return Ptr<Packet> (new Packet (*this), false);
 }
 
+Ptr<Packet>
+Packet::DeepCopy (void) const
+{
+  NS_LOG_FUNCTION (this);
+  // The buffer, the metadata and the nix-vector are serialized, the tags
+  // are not: copy them one at a time.
+  uint32_t size = GetSerializedSize ();
+  std::vector<uint8_t> serialized (size);
+  Serialize (&serialized[0], size);
+  Ptr<Packet> copy = Create<Packet> (&serialized[0], size, true);
+
+  int32_t start = m_buffer.GetCurrentStartOffset ();
+  int32_t copyStart = copy->m_buffer.GetCurrentStartOffset ();
+  ByteTagList::Iterator i = m_byteTagList.Begin (start, m_buffer.GetCurrentEndOffset ());
+  while (i.HasNext ())
+    {
+      ByteTagList::Iterator::Item item = i.Next ();
+      TagBuffer buffer = copy->m_byteTagList.Add (item.tid, item.size,
+                                                  item.start - start + copyStart,
+                                                  item.end - start + copyStart);
+      buffer.CopyFrom (item.buf);
+    }
+
+  // The head of the list is the last tag added: add them back in order
+  std::vector<const struct PacketTagList::TagData *> tags;
+  for (const struct PacketTagList::TagData *cur = m_packetTagList.Head (); cur != 0; cur = cur->next)
+    {
+      tags.push_back (cur);
+    }
+  for (std::vector<const struct PacketTagList::TagData *>::reverse_iterator j = tags.rbegin ();
+       j != tags.rend (); ++j)
+    {
+      Callback<ObjectBase *> constructor = (*j)->tid.GetConstructor ();
+      NS_ASSERT_MSG (!constructor.IsNull (), "No constructor for the packet tag " << (*j)->tid.GetName ());
+      Tag *tag = dynamic_cast<Tag *> (constructor ());
+      NS_ASSERT (tag != 0);
+      uint8_t *data = const_cast<uint8_t *> ((*j)->data);
+      tag->Deserialize (TagBuffer (data, data + PacketTagList::TagData::MAX_SIZE));
+      copy->m_packetTagList.Add (*tag);
+      delete tag;
+    }
+  return copy;
+}
+
 Packet::Packet ()
   : m_buffer (),
     m_byteTagList (),
     m_packetTagList (),
-    /* The upper 32 bits of the packet id in 
-     * metadata is for the system id. For non-
-     * distributed simulations, this is simply 
-     * zero.  The lower 32 bits are for the 
-     * global UID
-     */
-    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, 0),
+    m_metadata (AllocateUid (), 0),
     m_nixVector (0)
 {
-  m_globalUid++;
 }
 
 Packet::Packet (const Packet &o)
@@ -173,16 +319,9 @@ Packet::Packet (uint32_t size)
   : m_buffer (size),
     m_byteTagList (),
     m_packetTagList (),
-    /* The upper 32 bits of the packet id in 
-     * metadata is for the system id. For non-
-     * distributed simulations, this is simply 
-     * zero.  The lower 32 bits are for the 
-     * global UID
-     */
-    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, size),
+    m_metadata (AllocateUid (), size),
     m_nixVector (0)
 {
-  m_globalUid++;
 }
 Packet::Packet (uint8_t const *buffer, uint32_t size, bool magic)
   : m_buffer (0, false),
@@ -199,21 +338,26 @@ Packet::Packet (uint8_t const*buffer, uint32_t size)
   : m_buffer (),
     m_byteTagList (),
     m_packetTagList (),
-    /* The upper 32 bits of the packet id in 
-     * metadata is for the system id. For non-
-     * distributed simulations, this is simply 
-     * zero.  The lower 32 bits are for the 
-     * global UID
-     */
-    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, size),
+    m_metadata (AllocateUid (), size),
     m_nixVector (0)
 {
-  m_globalUid++;
   m_buffer.AddAtStart (size);
   Buffer::Iterator i = m_buffer.Begin ();
   i.Write (buffer, size);
 }
 
+void *
+Packet::operator new (size_t size)
+{
+  return PacketArena::Allocate (size, PacketArena::PACKET);
+}
+
+void
+Packet::operator delete (void *block, size_t size)
+{
+  PacketArena::Deallocate (block, size, PacketArena::PACKET);
+}
+
 Packet::Packet (const Buffer &buffer,  const ByteTagList &byteTagList, 
                 const PacketTagList &packetTagList, const PacketMetadata &metadata)
   : m_buffer (buffer),
@@ -552,6 +696,12 @@ void
 Packet::EnablePrinting (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
+  CheckMetadataEnabled ();
+  if (!MetadataEnabled ())
+    {
+      NS_LOG_LOGIC ("Packet metadata disabled by PacketMetadataEnabled");
+      return;
+    }
   PacketMetadata::Enable ();
 }
 
@@ -559,6 +709,12 @@ void
 Packet::EnableChecking (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
+  CheckMetadataEnabled ();
+  if (!MetadataEnabled ())
+    {
+      NS_LOG_LOGIC ("Packet metadata disabled by PacketMetadataEnabled");
+      return;
+    }
   PacketMetadata::EnableChecking ();
 }
 
@@ -808,6 +964,10 @@ void
 Packet::AddByteTag (const Tag &tag) const
 {
   NS_LOG_FUNCTION (this << tag.GetInstanceTypeId ().GetName () << tag.GetSerializedSize ());
+  if (!MetadataEnabled ())
+    {
+      return;
+    }
   ByteTagList *list = const_cast<ByteTagList *> (&m_byteTagList);
   TagBuffer buffer = list->Add (tag.GetInstanceTypeId (), tag.GetSerializedSize (), 
                                 m_buffer.GetCurrentStartOffset (),
@@ -173,6 +173,11 @@ private:
  * call Packet::EnableChecking: its runtime cost is lower than
  * Packet::EnablePrinting.
  *
+ * - Production runs which never look at the metadata, the byte tags or
+ * the uids can drop all of them with the "PacketMetadataEnabled" global
+ * value, e.g. --PacketMetadataEnabled=0 on the command line: see
+ * Packet::MetadataEnabled.
+ *
  * - The set of tags contain simulation-specific information which cannot
  * be stored in the packet byte buffer because the protocol headers or trailers
  * have no standard-conformant field for this information. So-called
@@ -242,6 +247,18 @@ public:
    * \param size the size of the input buffer.
    */
   Packet (uint8_t const*buffer, uint32_t size);
+  /**
+   * Packets are allocated from the PacketArena.
+   *
+   * \param size the size of a Packet
+   * \returns the memory of a new Packet
+   */
+  static void * operator new (size_t size);
+  /**
+   * \param block the memory of a Packet
+   * \param size the size of a Packet
+   */
+  static void operator delete (void *block, size_t size);
   /**
    * Create a new packet which contains a fragment of the original
    * packet. The returned packet shares the same uid as this packet.
@@ -381,6 +398,14 @@ public:
    */
   Ptr<Packet> Copy (void) const;
 
+  /**
+   * \returns a copy of the packet which shares no storage with it.
+   *
+   * Unlike Copy, the buffer, the metadata and the tags of the packet are
+   * all copied, so that the copy can be handed over to another thread.
+   */
+  Ptr<Packet> DeepCopy (void) const;
+
   /**
    * A packet is allocated a new uid when it is created
    * empty or with zero-filled payload.
@@ -395,8 +420,14 @@ public:
    * sequence numbers, or other packet or frame counters at other
    * protocol layers.
    *
+   * With the MultithreadedSimulatorImpl, the packets created by the
+   * events of a partition are numbered by that partition, which is held
+   * in the upper 32 bits of the uid, so that the uids of a run are
+   * repeatable for a given number of threads.
+   *
    * \returns an integer identifier which uniquely
-   *          identifies this packet.
+   *          identifies this packet, or zero when the packet
+   *          metadata is disabled.
    */
   uint64_t GetUid (void) const;
 
@@ -426,6 +457,8 @@ public:
    * want to be able the Packet::Print method, 
    * you need to invoke this method at least once during the 
    * simulation setup and before any packet is created.
+   *
+   * This method does nothing when the packet metadata is disabled.
    */
   static void EnablePrinting (void);
   /**
@@ -435,8 +468,34 @@ public:
    * when you remove a header from a packet, this same header
    * was actually present at the front of the packet. These
    * errors will be detected and will abort the program.
+   *
+   * This method does nothing when the packet metadata is disabled.
    */
   static void EnableChecking (void);
+  /**
+   * The "PacketMetadataEnabled" global value, true by default, is a
+   * single switch for the per-packet bookkeeping which the simulated
+   * protocols do not need. When it is false:
+   *  - EnablePrinting and EnableChecking do nothing, so that the helpers
+   *    which call them for their ASCII traces respect the switch;
+   *  - AddByteTag drops the tags;
+   *  - the uids of all packets are zero, so the protocols which tell
+   *    packets apart by their uid, like AODV, DSDV, DSR, the duplicate
+   *    address detection of IPv6 or the ListErrorModel, cannot be used.
+   * Packet tags, on which the FlowMonitor relies, are kept, and
+   * DelayJitterEstimation falls back to a packet tag. The other users of
+   * byte tags, like the statistics of the LTE RLC and PDCP, NetAnim and
+   * the visualizer, lose them.
+   *
+   * The switch is read when it is first needed in a simulation, usually
+   * by the first packet, and is kept until Simulator::Destroy. Changing it
+   * in between is a fatal error, reported by EnablePrinting,
+   * EnableChecking or Simulator::Destroy. Printing, once enabled by a
+   * simulation, stays enabled in the next ones of the same program.
+   *
+   * \returns true unless the packet metadata is disabled
+   */
+  static bool MetadataEnabled (void);
 
   /**
    * \returns number of bytes required for packet
@@ -473,6 +532,8 @@ public:
    * trace sources should use const packets because it would be
    * totally evil to allow a trace sink to modify the content of a
    * packet).
+   *
+   * The tag is dropped when the packet metadata is disabled.
    */
   void AddByteTag (const Tag &tag) const;
   /**
@@ -583,6 +644,10 @@ private:
           const PacketTagList &packetTagList, const PacketMetadata &metadata);
 
   uint32_t Deserialize (uint8_t const*buffer, uint32_t size);
+  /**
+   * \returns the uid of a new packet, system id included
+   */
+  static uint64_t AllocateUid (void);
 
   Buffer m_buffer;
   ByteTagList m_byteTagList;
@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/core-config.h"
+#include "ns3/packet.h"
+#include "ns3/packet-arena.h"
+#include "ns3/flow-id-tag.h"
+
+using namespace ns3;
+
+/**
+ * Allocate and release blocks of all sizes, and check that they do not
+ * overlap, that they are reused, and that they are counted.
+ */
+class PacketArenaBlocksTest : public TestCase
+{
+public:
+  PacketArenaBlocksTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+PacketArenaBlocksTest::PacketArenaBlocksTest ()
+  : TestCase ("Check the blocks of the PacketArena")
+{
+}
+
+void
+PacketArenaBlocksTest::DoRun (void)
+{
+  PacketArena::ResetStats ();
+  std::vector<uint8_t *> blocks;
+  std::vector<uint32_t> sizes;
+  for (uint32_t size = 1; size < 4000; size += 37)
+    {
+      uint32_t capacity;
+      uint8_t *block = static_cast<uint8_t *> (PacketArena::Allocate (size, PacketArena::BUFFER, &capacity));
+      NS_TEST_ASSERT_MSG_EQ ((capacity >= size), true, "Block of " << size << " bytes too small");
+      // Fill the whole block: the blocks must not overlap
+      std::memset (block, sizes.size () & 0xff, capacity);
+      blocks.push_back (block);
+      sizes.push_back (capacity);
+    }
+  for (uint32_t i = 0; i < blocks.size (); i++)
+    {
+      for (uint32_t j = 0; j < sizes[i]; j++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (uint32_t (blocks[i][j]), (i & 0xff), "Block " << i << " overwritten");
+        }
+    }
+
+  struct PacketArena::Stats stats = PacketArena::GetStats ();
+  NS_TEST_EXPECT_MSG_EQ (stats.allocations[PacketArena::BUFFER], blocks.size (), "Allocations");
+  NS_TEST_EXPECT_MSG_GT (stats.heapAllocations[PacketArena::BUFFER], 0, "Large blocks from the heap");
+#ifndef NS3_MULTITHREADED
+  NS_TEST_EXPECT_MSG_LT (stats.heapAllocations[PacketArena::BUFFER], blocks.size (), "Small blocks from the heap");
+#endif /* NS3_MULTITHREADED */
+  NS_TEST_EXPECT_MSG_EQ (stats.allocations[PacketArena::PACKET], 0, "Packets counted as buffers");
+
+  for (uint32_t i = 0; i < blocks.size (); i++)
+    {
+      PacketArena::Deallocate (blocks[i], sizes[i], PacketArena::BUFFER);
+    }
+  stats = PacketArena::GetStats ();
+  NS_TEST_EXPECT_MSG_EQ (stats.deallocations[PacketArena::BUFFER], blocks.size (), "Deallocations");
+
+#ifndef NS3_MULTITHREADED
+  // The last block released is the next one of its class
+  uint32_t capacity;
+  void *block = PacketArena::Allocate (100, PacketArena::BYTE_TAGS, &capacity);
+  PacketArena::Deallocate (block, 100, PacketArena::BYTE_TAGS);
+  bool reused = PacketArena::Allocate (capacity, PacketArena::BYTE_TAGS) == block;
+  NS_TEST_EXPECT_MSG_EQ (reused, true, "Block not reused");
+  PacketArena::Deallocate (block, capacity, PacketArena::BYTE_TAGS);
+#endif /* NS3_MULTITHREADED */
+}
+
+/**
+ * Check the allocations counted for the packets, their buffers and their
+ * tags.
+ */
+class PacketArenaStatsTest : public TestCase
+{
+public:
+  PacketArenaStatsTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+PacketArenaStatsTest::PacketArenaStatsTest ()
+  : TestCase ("Check the allocations counted for the packets")
+{
+}
+
+void
+PacketArenaStatsTest::DoRun (void)
+{
+  PacketArena::ResetStats ();
+  {
+    Ptr<Packet> packet = Create<Packet> (64);
+    packet->AddPacketTag (FlowIdTag (1));
+    Ptr<Packet> copy = packet->Copy ();
+    FlowIdTag tag;
+    copy->RemovePacketTag (tag);
+  }
+  struct PacketArena::Stats stats = PacketArena::GetStats ();
+  NS_TEST_EXPECT_MSG_EQ (stats.allocations[PacketArena::PACKET], 2, "A packet and its copy");
+  NS_TEST_EXPECT_MSG_EQ (stats.deallocations[PacketArena::PACKET], 2, "Packets released");
+  // The copy shares the buffer of the packet
+  NS_TEST_EXPECT_MSG_EQ (stats.allocations[PacketArena::BUFFER], 1, "Buffers");
+  NS_TEST_EXPECT_MSG_EQ (stats.allocations[PacketArena::PACKET_TAGS], 1, "Packet tags");
+  NS_TEST_EXPECT_MSG_EQ (stats.deallocations[PacketArena::PACKET_TAGS], 1, "Packet tags released");
+#ifndef NS3_MULTITHREADED
+  NS_TEST_EXPECT_MSG_EQ (stats.heapAllocations[PacketArena::PACKET], 0, "Packets from the heap");
+#endif /* NS3_MULTITHREADED */
+
+  // The results printed after the stats keep their precision
+  std::ostringstream os;
+  os.precision (8);
+  PacketArena::PrintStats (os);
+  NS_TEST_EXPECT_MSG_EQ (os.precision (), 8, "Precision of the stream changed");
+}
+
+class PacketArenaTestSuite : public TestSuite
+{
+public:
+  PacketArenaTestSuite ();
+};
+
+PacketArenaTestSuite::PacketArenaTestSuite ()
+  : TestSuite ("packet-arena", UNIT)
+{
+  AddTestCase (new PacketArenaBlocksTest, TestCase::QUICK);
+  AddTestCase (new PacketArenaStatsTest, TestCase::QUICK);
+}
+
+static PacketArenaTestSuite g_packetArenaTestSuite;
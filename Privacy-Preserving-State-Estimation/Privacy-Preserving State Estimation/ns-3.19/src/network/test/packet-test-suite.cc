@@ -19,6 +19,10 @@
  */
 #include "ns3/packet.h"
 #include "ns3/packet-tag-list.h"
+#include "ns3/delay-jitter-estimation.h"
+#include "ns3/simulator.h"
+#include "ns3/config.h"
+#include "ns3/boolean.h"
 #include "ns3/test.h"
 #include "ns3/unused.h"
 #include <limits>     // std:numeric_limits
@@ -716,6 +720,69 @@ PacketTagListTest::DoRun (void)
     
 }
 
+//--------------------------------------
+class PacketMetadataEnabledTest : public TestCase
+{
+public:
+  PacketMetadataEnabledTest ();
+private:
+  void DoRun (void);
+  bool IsPrinting (void);
+};
+
+PacketMetadataEnabledTest::PacketMetadataEnabledTest ()
+  : TestCase ("PacketMetadataEnabled")
+{
+}
+
+bool
+PacketMetadataEnabledTest::IsPrinting (void)
+{
+  Ptr<Packet> p = Create<Packet> (10);
+  return p->BeginItem ().HasNext ();
+}
+
+void
+PacketMetadataEnabledTest::DoRun (void)
+{
+  // The switch is kept until the end of a simulation
+  Simulator::Destroy ();
+  Config::SetGlobal ("PacketMetadataEnabled", BooleanValue (false));
+  bool printing = IsPrinting ();
+  NS_TEST_EXPECT_MSG_EQ (Packet::MetadataEnabled (), false, "Switch not read");
+
+  Ptr<Packet> p1 = Create<Packet> (10);
+  Ptr<Packet> p2 = Create<Packet> (10);
+  NS_TEST_EXPECT_MSG_EQ (p1->GetUid (), 0, "uid allocated");
+  NS_TEST_EXPECT_MSG_EQ (p2->GetUid (), 0, "uid allocated");
+
+  ATestTag<4> tag;
+  p1->AddByteTag (ATestTag<4> (1));
+  NS_TEST_EXPECT_MSG_EQ (p1->FindFirstMatchingByteTag (tag), false, "Byte tag kept");
+  p1->AddPacketTag (ATestTag<4> (2));
+  NS_TEST_EXPECT_MSG_EQ (p1->PeekPacketTag (tag), true, "Packet tag dropped");
+  NS_TEST_EXPECT_MSG_EQ (tag.GetData (), 2, "Packet tag changed");
+
+  Packet::EnablePrinting ();
+  NS_TEST_EXPECT_MSG_EQ (IsPrinting (), printing, "EnablePrinting not ignored");
+
+  // DelayJitterEstimation falls back to a packet tag
+  DelayJitterEstimation estimation;
+  DelayJitterEstimation::PrepareTx (p2);
+  Simulator::Schedule (Seconds (1.0), &DelayJitterEstimation::RecordRx, &estimation, p2);
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (estimation.GetLastDelay (), Seconds (1.0), "Delay not recorded");
+
+  Simulator::Destroy ();
+  Config::SetGlobal ("PacketMetadataEnabled", BooleanValue (true));
+  Ptr<Packet> p3 = Create<Packet> (10);
+  Ptr<Packet> p4 = Create<Packet> (10);
+  NS_TEST_EXPECT_MSG_NE (p3->GetUid (), p4->GetUid (), "uids not allocated after Simulator::Destroy");
+  p3->AddByteTag (ATestTag<4> (3));
+  NS_TEST_EXPECT_MSG_EQ (p3->FindFirstMatchingByteTag (tag), true, "Byte tag dropped");
+  Simulator::Destroy ();
+}
+
 //-----------------------------------------------------------------------------
 class PacketTestSuite : public TestSuite
 {
@@ -728,6 +795,7 @@ PacketTestSuite::PacketTestSuite ()
 {
   AddTestCase (new PacketTest, TestCase::QUICK);
   AddTestCase (new PacketTagListTest, TestCase::QUICK);
+  AddTestCase (new PacketMetadataEnabledTest, TestCase::QUICK);
 }
 
 static PacketTestSuite g_packetTestSuite;
@@ -0,0 +1,223 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "static-link-budget-cache.h"
+#include "propagation-loss-model.h"
+#include "propagation-delay-model.h"
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/pointer.h"
+
+NS_LOG_COMPONENT_DEFINE ("StaticLinkBudgetCache");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (StaticLinkBudgetCache)
+  ;
+
+TypeId
+StaticLinkBudgetCache::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::StaticLinkBudgetCache")
+    .SetParent<Object> ()
+    .AddConstructor<StaticLinkBudgetCache> ()
+    .AddAttribute ("PropagationLossModel", "A pointer to the propagation loss model of the paths.",
+                   PointerValue (),
+                   MakePointerAccessor (&StaticLinkBudgetCache::SetPropagationLossModel),
+                   MakePointerChecker<PropagationLossModel> ())
+    .AddAttribute ("PropagationDelayModel", "A pointer to the propagation delay model of the paths.",
+                   PointerValue (),
+                   MakePointerAccessor (&StaticLinkBudgetCache::SetPropagationDelayModel),
+                   MakePointerChecker<PropagationDelayModel> ())
+  ;
+  return tid;
+}
+
+StaticLinkBudgetCache::StaticLinkBudgetCache ()
+  : m_valid (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+StaticLinkBudgetCache::~StaticLinkBudgetCache ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+StaticLinkBudgetCache::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::vector<Ptr<MobilityModel> >::const_iterator i = m_mobility.begin (); i != m_mobility.end (); i++)
+    {
+      (*i)->TraceDisconnectWithoutContext ("CourseChange",
+                                           MakeCallback (&StaticLinkBudgetCache::CourseChanged, this));
+    }
+  m_mobility.clear ();
+  m_index.clear ();
+  m_links.clear ();
+  m_loss = 0;
+  m_delay = 0;
+  Object::DoDispose ();
+}
+
+void
+StaticLinkBudgetCache::SetPropagationLossModel (Ptr<PropagationLossModel> loss)
+{
+  m_loss = loss;
+  Invalidate ();
+}
+
+void
+StaticLinkBudgetCache::SetPropagationDelayModel (Ptr<PropagationDelayModel> delay)
+{
+  m_delay = delay;
+  Invalidate ();
+}
+
+uint32_t
+StaticLinkBudgetCache::Add (Ptr<MobilityModel> mobility)
+{
+  NS_LOG_FUNCTION (this << mobility);
+  std::map<const MobilityModel *, uint32_t>::const_iterator i = m_index.find (PeekPointer (mobility));
+  if (i != m_index.end ())
+    {
+      return i->second;
+    }
+  uint32_t index = m_mobility.size ();
+  m_mobility.push_back (mobility);
+  m_index[PeekPointer (mobility)] = index;
+  mobility->TraceConnectWithoutContext ("CourseChange",
+                                        MakeCallback (&StaticLinkBudgetCache::CourseChanged, this));
+  Invalidate ();
+  return index;
+}
+
+uint32_t
+StaticLinkBudgetCache::GetN (void) const
+{
+  return m_mobility.size ();
+}
+
+void
+StaticLinkBudgetCache::Invalidate (void)
+{
+  m_valid = false;
+}
+
+double
+StaticLinkBudgetCache::CalcRxPower (double txPowerDbm, uint32_t a, uint32_t b)
+{
+  Update ();
+  if (m_moving[a] || m_moving[b])
+    {
+      return m_loss->CalcRxPower (txPowerDbm, m_mobility[a], m_mobility[b]);
+    }
+  return txPowerDbm + m_links[a * m_mobility.size () + b].gainDb;
+}
+
+Time
+StaticLinkBudgetCache::GetDelay (uint32_t a, uint32_t b)
+{
+  Update ();
+  if (m_moving[a] || m_moving[b])
+    {
+      return m_delay->GetDelay (m_mobility[a], m_mobility[b]);
+    }
+  return m_links[a * m_mobility.size () + b].delay;
+}
+
+StaticLinkBudgetCache::Link
+StaticLinkBudgetCache::Compute (uint32_t a, uint32_t b) const
+{
+  Link link;
+  link.gainDb = m_loss->CalcRxPower (0.0, m_mobility[a], m_mobility[b]);
+  link.delay = m_delay->GetDelay (m_mobility[a], m_mobility[b]);
+  return link;
+}
+
+void
+StaticLinkBudgetCache::Update (void)
+{
+  if (m_valid && m_stale.empty ())
+    {
+      return;
+    }
+  NS_ASSERT_MSG (m_loss != 0 && m_delay != 0, "StaticLinkBudgetCache needs its propagation models");
+  uint32_t n = m_mobility.size ();
+  if (!m_valid)
+    {
+      NS_LOG_LOGIC ("computing the budgets of " << n << " nodes");
+      m_stale.clear ();
+      m_moving.resize (n);
+      m_links.resize (n * n);
+      for (uint32_t a = 0; a < n; a++)
+        {
+          Vector velocity = m_mobility[a]->GetVelocity ();
+          m_moving[a] = velocity.x != 0 || velocity.y != 0 || velocity.z != 0;
+        }
+      for (uint32_t a = 0; a < n; a++)
+        {
+          for (uint32_t b = 0; b < n; b++)
+            {
+              if (a != b && !m_moving[a] && !m_moving[b])
+                {
+                  m_links[a * n + b] = Compute (a, b);
+                }
+            }
+        }
+      m_valid = true;
+      return;
+    }
+
+  std::vector<uint32_t> stale;
+  stale.swap (m_stale);
+  for (std::vector<uint32_t>::const_iterator i = stale.begin (); i != stale.end (); i++)
+    {
+      Vector velocity = m_mobility[*i]->GetVelocity ();
+      m_moving[*i] = velocity.x != 0 || velocity.y != 0 || velocity.z != 0;
+    }
+  for (std::vector<uint32_t>::const_iterator i = stale.begin (); i != stale.end (); i++)
+    {
+      uint32_t a = *i;
+      NS_LOG_LOGIC ("recomputing the budgets of node " << a);
+      if (m_moving[a])
+        {
+          continue;
+        }
+      for (uint32_t b = 0; b < n; b++)
+        {
+          if (a != b && !m_moving[b])
+            {
+              m_links[a * n + b] = Compute (a, b);
+              m_links[b * n + a] = Compute (b, a);
+            }
+        }
+    }
+}
+
+void
+StaticLinkBudgetCache::CourseChanged (Ptr<const MobilityModel> mobility)
+{
+  std::map<const MobilityModel *, uint32_t>::const_iterator i = m_index.find (PeekPointer (mobility));
+  NS_ASSERT (i != m_index.end ());
+  if (m_valid)
+    {
+      m_stale.push_back (i->second);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef STATIC_LINK_BUDGET_CACHE_H
+#define STATIC_LINK_BUDGET_CACHE_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/mobility-model.h"
+#include <vector>
+#include <map>
+
+namespace ns3 {
+
+class PropagationLossModel;
+class PropagationDelayModel;
+
+/**
+ * \ingroup propagation
+ * \brief Caches the gain and the delay of every link between a set of
+ * stationary nodes.
+ *
+ * Where PropagationCache keeps arbitrary per-path objects in a map, this
+ * cache keeps the link budget of all the N x N paths between the nodes
+ * added to it in one contiguous array, row by row by transmitter, so that
+ * a broadcast reads a single row. The matrix is computed at first use
+ * and a row and a column are recomputed after the CourseChange trace of
+ * their node fires.
+ *
+ * The gain of a path is the received power of a 0 dBm transmission, so
+ * the cache is exact only for deterministic loss and delay models whose
+ * loss does not depend on the transmitted power; this excludes
+ * RandomPropagationLossModel, NakagamiPropagationLossModel,
+ * FixedRssLossModel, RangePropagationLossModel and
+ * RandomPropagationDelayModel. Paths to or from a node which is moving
+ * when the matrix is computed are not cached but computed on every call.
+ */
+class StaticLinkBudgetCache : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  StaticLinkBudgetCache ();
+  virtual ~StaticLinkBudgetCache ();
+
+  /**
+   * \param loss the propagation loss model of the paths
+   */
+  void SetPropagationLossModel (Ptr<PropagationLossModel> loss);
+  /**
+   * \param delay the propagation delay model of the paths
+   */
+  void SetPropagationDelayModel (Ptr<PropagationDelayModel> delay);
+
+  /**
+   * \param mobility the mobility model of a node
+   * \return the index of the node in the cache
+   */
+  uint32_t Add (Ptr<MobilityModel> mobility);
+  /**
+   * \return the number of nodes in the cache
+   */
+  uint32_t GetN (void) const;
+
+  /**
+   * \param txPowerDbm the transmitted power
+   * \param a index of the transmitter
+   * \param b index of the receiver
+   * \return the received power
+   */
+  double CalcRxPower (double txPowerDbm, uint32_t a, uint32_t b);
+  /**
+   * \param a index of the transmitter
+   * \param b index of the receiver
+   * \return the propagation delay
+   */
+  Time GetDelay (uint32_t a, uint32_t b);
+
+  /**
+   * Recompute the whole matrix at next use, e.g. after the attributes of
+   * the propagation models changed.
+   */
+  void Invalidate (void);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /// Budget of a path
+  struct Link
+  {
+    double gainDb; //!< Received power of a 0 dBm transmission
+    Time delay;    //!< Propagation delay
+  };
+
+  /**
+   * Recompute the stale part of the matrix, if any.
+   */
+  void Update (void);
+  /**
+   * \param a index of the transmitter
+   * \param b index of the receiver
+   * \return the budget of the path, computed from the models
+   */
+  Link Compute (uint32_t a, uint32_t b) const;
+  /**
+   * \param mobility the mobility model which changed course
+   */
+  void CourseChanged (Ptr<const MobilityModel> mobility);
+
+  Ptr<PropagationLossModel> m_loss; //!< Propagation loss model
+  Ptr<PropagationDelayModel> m_delay; //!< Propagation delay model
+  std::vector<Ptr<MobilityModel> > m_mobility; //!< Mobility model of each node
+  std::map<const MobilityModel *, uint32_t> m_index; //!< Index of each mobility model
+  std::vector<Link> m_links; //!< N x N budgets, row by transmitter
+  std::vector<bool> m_moving; //!< Nodes whose paths are not cached
+  std::vector<uint32_t> m_stale; //!< Nodes which changed course
+  bool m_valid; //!< Whether the matrix was computed for all the nodes
+};
+
+} // namespace ns3
+
+#endif /* STATIC_LINK_BUDGET_CACHE_H */
@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/static-link-budget-cache.h"
+#include "ns3/propagation-loss-model.h"
+#include "ns3/propagation-delay-model.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/simulator.h"
+
+namespace ns3 {
+
+class StaticLinkBudgetCacheTestCase : public TestCase
+{
+public:
+  StaticLinkBudgetCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void Check (const char *what);
+
+  Ptr<PropagationLossModel> m_loss;
+  Ptr<PropagationDelayModel> m_delay;
+  Ptr<StaticLinkBudgetCache> m_cache;
+  std::vector<Ptr<MobilityModel> > m_nodes;
+};
+
+StaticLinkBudgetCacheTestCase::StaticLinkBudgetCacheTestCase ()
+  : TestCase ("Check that the cached link budgets match the propagation models")
+{
+}
+
+void
+StaticLinkBudgetCacheTestCase::Check (const char *what)
+{
+  for (uint32_t a = 0; a < m_nodes.size (); a++)
+    {
+      for (uint32_t b = 0; b < m_nodes.size (); b++)
+        {
+          if (a == b)
+            {
+              continue;
+            }
+          NS_TEST_EXPECT_MSG_EQ_TOL (m_cache->CalcRxPower (16.0, a, b),
+                                     m_loss->CalcRxPower (16.0, m_nodes[a], m_nodes[b]),
+                                     1e-9, what << ": rx power from " << a << " to " << b);
+          NS_TEST_EXPECT_MSG_EQ (m_cache->GetDelay (a, b),
+                                 m_delay->GetDelay (m_nodes[a], m_nodes[b]),
+                                 what << ": delay from " << a << " to " << b);
+        }
+    }
+}
+
+void
+StaticLinkBudgetCacheTestCase::DoRun (void)
+{
+  m_loss = CreateObject<LogDistancePropagationLossModel> ();
+  m_delay = CreateObject<ConstantSpeedPropagationDelayModel> ();
+  m_cache = CreateObject<StaticLinkBudgetCache> ();
+  m_cache->SetPropagationLossModel (m_loss);
+  m_cache->SetPropagationDelayModel (m_delay);
+
+  Vector positions[] = { Vector (0.0, 0.0, 0.0), Vector (10.0, 0.0, 0.0), Vector (0.0, 250.0, 1.5) };
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      Ptr<MobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+      mobility->SetPosition (positions[i]);
+      m_nodes.push_back (mobility);
+      NS_TEST_EXPECT_MSG_EQ (m_cache->Add (mobility), i, "index of node " << i);
+    }
+  NS_TEST_EXPECT_MSG_EQ (m_cache->Add (m_nodes[1]), 1, "a node added twice keeps its index");
+  NS_TEST_EXPECT_MSG_EQ (m_cache->GetN (), 3, "number of nodes");
+  Check ("initial positions");
+
+  m_nodes[2]->SetPosition (Vector (30.0, 40.0, 0.0));
+  Check ("after a course change");
+
+  Ptr<ConstantVelocityMobilityModel> moving = CreateObject<ConstantVelocityMobilityModel> ();
+  moving->SetPosition (Vector (5.0, 5.0, 0.0));
+  moving->SetVelocity (Vector (1.0, 0.0, 0.0));
+  m_nodes.push_back (moving);
+  m_cache->Add (moving);
+  Check ("with a moving node");
+
+  m_cache->Dispose ();
+  Simulator::Destroy ();
+}
+
+class StaticLinkBudgetCacheTestSuite : public TestSuite
+{
+public:
+  StaticLinkBudgetCacheTestSuite ();
+};
+
+StaticLinkBudgetCacheTestSuite::StaticLinkBudgetCacheTestSuite ()
+  : TestSuite ("static-link-budget-cache", UNIT)
+{
+  AddTestCase (new StaticLinkBudgetCacheTestCase, TestCase::QUICK);
+}
+
+static StaticLinkBudgetCacheTestSuite g_staticLinkBudgetCacheTestSuite;
+
+} // namespace ns3
@@ -0,0 +1,294 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstdio>
+#include <fstream>
+
+#include "result-sink.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("ResultSink");
+
+NS_OBJECT_ENSURE_REGISTERED (ResultSink)
+  ;
+
+TypeId
+ResultSink::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ResultSink")
+    .SetParent<Object> ()
+    .AddAttribute ("Append",
+                   "Whether the rows are appended to the previous content of the file, "
+                   "instead of replacing it at the first write.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&ResultSink::m_append),
+                   MakeBooleanChecker ())
+    .AddAttribute ("Precision",
+                   "The number of significant digits of the real values.",
+                   UintegerValue (6),
+                   MakeUintegerAccessor (&ResultSink::m_precision),
+                   MakeUintegerChecker<uint32_t> (1, 17))
+  ;
+  return tid;
+}
+
+ResultSink::ResultSink (const std::string &fileName, enum FileType fileType)
+  : m_fileName (fileName),
+    m_written (false)
+{
+  NS_LOG_FUNCTION (this << fileName << fileType);
+  switch (fileType)
+    {
+    case COMMA_SEPARATED:
+      m_separator = ",";
+      break;
+    case TAB_SEPARATED:
+      m_separator = "\t";
+      break;
+    default:
+      m_separator = " ";
+      break;
+    }
+}
+
+ResultSink::~ResultSink ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+ResultSink::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (!Write ())
+    {
+      NS_LOG_ERROR ("Lost " << m_rowEnds.size () << " rows not written to " << m_fileName);
+    }
+  Object::DoDispose ();
+}
+
+void
+ResultSink::AddColumn (const std::string &name)
+{
+  NS_LOG_FUNCTION (this << name);
+  NS_ASSERT_MSG (m_rowEnds.empty () && m_cells.empty (), "Columns must be named before the first row");
+  m_columns.push_back (name);
+}
+
+uint32_t
+ResultSink::GetNColumns (void) const
+{
+  return m_columns.size ();
+}
+
+ResultSink &
+ResultSink::AddCell (const Cell &cell)
+{
+  m_cells.push_back (cell);
+  return *this;
+}
+
+ResultSink &
+ResultSink::Add (int value)
+{
+  return Add (static_cast<long long> (value));
+}
+
+ResultSink &
+ResultSink::Add (unsigned int value)
+{
+  return Add (static_cast<unsigned long long> (value));
+}
+
+ResultSink &
+ResultSink::Add (long value)
+{
+  return Add (static_cast<long long> (value));
+}
+
+ResultSink &
+ResultSink::Add (unsigned long value)
+{
+  return Add (static_cast<unsigned long long> (value));
+}
+
+ResultSink &
+ResultSink::Add (long long value)
+{
+  Cell cell;
+  cell.type = INTEGER;
+  cell.integer = value;
+  return AddCell (cell);
+}
+
+ResultSink &
+ResultSink::Add (unsigned long long value)
+{
+  Cell cell;
+  cell.type = UNSIGNED;
+  cell.unsignedInteger = value;
+  return AddCell (cell);
+}
+
+ResultSink &
+ResultSink::Add (double value)
+{
+  Cell cell;
+  cell.type = REAL;
+  cell.real = value;
+  return AddCell (cell);
+}
+
+ResultSink &
+ResultSink::Add (const std::string &value)
+{
+  Cell cell;
+  cell.type = TEXT;
+  cell.text = m_texts.size ();
+  m_texts.push_back (value);
+  return AddCell (cell);
+}
+
+ResultSink &
+ResultSink::Add (const char *value)
+{
+  return Add (std::string (value));
+}
+
+void
+ResultSink::EndRow (void)
+{
+  NS_ASSERT_MSG (m_columns.empty ()
+                 || m_cells.size () - (m_rowEnds.empty () ? 0 : m_rowEnds.back ()) == m_columns.size (),
+                 "Row of the wrong number of values for " << m_columns.size () << " columns");
+  m_rowEnds.push_back (m_cells.size ());
+}
+
+uint32_t
+ResultSink::GetNRows (void) const
+{
+  return m_rowEnds.size ();
+}
+
+bool
+ResultSink::Write (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (m_rowEnds.empty () ? m_cells.empty () : m_cells.size () == m_rowEnds.back (),
+                 "Row not ended");
+  if (m_rowEnds.empty ())
+    {
+      return true;
+    }
+  if (!DoWrite ())
+    {
+      NS_LOG_WARN ("Keeping " << m_rowEnds.size () << " rows not written to " << m_fileName);
+      return false;
+    }
+  m_written = true;
+  Clear ();
+  return true;
+}
+
+void
+ResultSink::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_cells.clear ();
+  m_rowEnds.clear ();
+  m_texts.clear ();
+}
+
+bool
+ResultSink::DoWrite (void)
+{
+  NS_LOG_FUNCTION (this);
+  bool append = m_append || m_written;
+  bool empty = true;
+  if (append)
+    {
+      std::ifstream previous (m_fileName.c_str (), std::ios::in | std::ios::binary | std::ios::ate);
+      empty = !previous.is_open () || previous.tellg () <= 0;
+    }
+
+  std::string buffer;
+  if (empty && !m_columns.empty ())
+    {
+      buffer += "#";
+      for (std::vector<std::string>::const_iterator i = m_columns.begin (); i != m_columns.end (); ++i)
+        {
+          buffer += " ";
+          buffer += *i;
+        }
+      buffer += "\n";
+    }
+  char number[32];
+  uint32_t cell = 0;
+  for (std::vector<uint32_t>::const_iterator end = m_rowEnds.begin (); end != m_rowEnds.end (); ++end)
+    {
+      for (uint32_t first = cell; cell < *end; cell++)
+        {
+          if (cell != first)
+            {
+              buffer += m_separator;
+            }
+          const Cell &c = m_cells[cell];
+          switch (c.type)
+            {
+            case INTEGER:
+              std::snprintf (number, sizeof (number), "%lld", static_cast<long long> (c.integer));
+              buffer += number;
+              break;
+            case UNSIGNED:
+              std::snprintf (number, sizeof (number), "%llu", static_cast<unsigned long long> (c.unsignedInteger));
+              buffer += number;
+              break;
+            case REAL:
+              // Like the default format of std::ostream
+              std::snprintf (number, sizeof (number), "%.*g", static_cast<int> (m_precision), c.real);
+              buffer += number;
+              break;
+            case TEXT:
+              buffer += m_texts[c.text];
+              break;
+            }
+        }
+      buffer += "\n";
+    }
+
+  std::ios::openmode mode = std::ios::out | std::ios::binary | (append ? std::ios::app : std::ios::trunc);
+  std::ofstream file (m_fileName.c_str (), mode);
+  if (!file.is_open ())
+    {
+      NS_LOG_ERROR ("Could not open " << m_fileName);
+      return false;
+    }
+  file.write (buffer.data (), buffer.size ());
+  file.close ();
+  if (file.fail ())
+    {
+      NS_LOG_ERROR ("Could not write to " << m_fileName);
+      return false;
+    }
+  NS_LOG_INFO ("Wrote " << m_rowEnds.size () << " rows to " << m_fileName);
+  return true;
+}
+
+} // namespace ns3
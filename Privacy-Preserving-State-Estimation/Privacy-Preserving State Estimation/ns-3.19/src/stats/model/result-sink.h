@@ -0,0 +1,178 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef RESULT_SINK_H
+#define RESULT_SINK_H
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ns3/object.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup dataoutput
+ *
+ * \brief Buffers rows of results in memory and writes them at once
+ *
+ * The values of a row are added in the order of the columns, and the
+ * row is closed by EndRow.  Nothing is written until Write is called,
+ * or the sink is disposed: the rows are then formatted in a single
+ * buffer and appended to the file with one write, preceded by a
+ * header line naming the columns, starting with '#', when the file
+ * is empty.  The rows a failed write could not store are kept for the
+ * next one, until Clear forgets them; those still not written when the
+ * sink is disposed are lost, with an error logged.  Numbers are
+ * formatted like the default of std::ostream, so that the files are the
+ * same as those written by operator<<.
+ *
+ * \code
+ * Ptr<ResultSink> sink = CreateObject<ResultSink> ("flows.txt");
+ * sink->AddColumn ("flow");
+ * sink->AddColumn ("delay");
+ * sink->Add (1).Add (0.0125).EndRow ();
+ * sink->Write ();
+ * \endcode
+ */
+class ResultSink : public Object
+{
+public:
+  /// The separator of the values of the text files
+  enum FileType
+  {
+    SPACE_SEPARATED,
+    COMMA_SEPARATED,
+    TAB_SEPARATED
+  };
+
+  static TypeId GetTypeId (void);
+
+  /**
+   * \param fileName name of the file to write
+   * \param fileType separator of the values of the file
+   */
+  ResultSink (const std::string &fileName, enum FileType fileType = SPACE_SEPARATED);
+  virtual ~ResultSink ();
+
+  /**
+   * \param name the name of the next column
+   *
+   * Once columns are named, every row must have a value for each.
+   */
+  void AddColumn (const std::string &name);
+  /**
+   * \return the number of columns named
+   */
+  uint32_t GetNColumns (void) const;
+
+  ResultSink &Add (int value);
+  ResultSink &Add (unsigned int value);
+  ResultSink &Add (long value);
+  ResultSink &Add (unsigned long value);
+  ResultSink &Add (long long value);
+  ResultSink &Add (unsigned long long value);
+  ResultSink &Add (double value);
+  ResultSink &Add (const std::string &value);
+  ResultSink &Add (const char *value);
+  /**
+   * \param value a value printed with operator<<, like an address
+   *
+   * Adds the value as text.
+   */
+  template <typename T>
+  ResultSink &AddText (const T &value);
+  /**
+   * Closes the current row.
+   */
+  void EndRow (void);
+
+  /**
+   * \return the number of rows not written yet
+   */
+  uint32_t GetNRows (void) const;
+  /**
+   * Writes the rows added since the last write, and forgets them.
+   *
+   * \return false if the rows could not be written; they are then
+   * kept for the next write
+   */
+  bool Write (void);
+  /**
+   * Forgets the rows not written yet, such as those of a failed write.
+   */
+  void Clear (void);
+
+protected:
+  virtual void DoDispose (void);
+
+  /// The type of a value
+  enum CellType
+  {
+    INTEGER,
+    UNSIGNED,
+    REAL,
+    TEXT
+  };
+  /// A value of a row; the text values are kept aside
+  struct Cell
+  {
+    enum CellType type;
+    union
+    {
+      int64_t integer;
+      uint64_t unsignedInteger;
+      double real;
+      uint32_t text;
+    };
+  };
+
+  /**
+   * Writes the rows, which are never empty.  The text of the values
+   * is in m_texts.
+   *
+   * \return false if none of the rows were written
+   */
+  virtual bool DoWrite (void);
+
+  std::string m_fileName;
+  std::vector<std::string> m_columns;
+  std::vector<Cell> m_cells;       //!< The values of the rows, row after row
+  std::vector<uint32_t> m_rowEnds; //!< The index in m_cells past each row
+  std::vector<std::string> m_texts;
+  bool m_append;                   //!< Whether to keep the previous content of the file
+  bool m_written;                  //!< Whether the file was written already
+
+private:
+  ResultSink &AddCell (const Cell &cell);
+
+  std::string m_separator;
+  uint32_t m_precision;
+};
+
+template <typename T>
+ResultSink &
+ResultSink::AddText (const T &value)
+{
+  std::ostringstream oss;
+  oss << value;
+  return Add (oss.str ());
+}
+
+} // namespace ns3
+
+#endif /* RESULT_SINK_H */
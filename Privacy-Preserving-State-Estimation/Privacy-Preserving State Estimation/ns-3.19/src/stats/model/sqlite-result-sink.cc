@@ -0,0 +1,202 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <sstream>
+
+#include <sqlite3.h>
+
+#include "sqlite-result-sink.h"
+#include "ns3/string.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SqliteResultSink");
+
+NS_OBJECT_ENSURE_REGISTERED (SqliteResultSink)
+  ;
+
+// Quotes the name of a table or of a column
+static std::string
+Quote (const std::string &name)
+{
+  std::string quoted = "\"";
+  for (std::string::const_iterator i = name.begin (); i != name.end (); ++i)
+    {
+      if (*i == '"')
+        {
+          quoted += '"';
+        }
+      quoted += *i;
+    }
+  return quoted + "\"";
+}
+
+TypeId
+SqliteResultSink::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SqliteResultSink")
+    .SetParent<ResultSink> ()
+    .AddAttribute ("Table",
+                   "The name of the table of the rows.",
+                   StringValue ("results"),
+                   MakeStringAccessor (&SqliteResultSink::m_table),
+                   MakeStringChecker ())
+  ;
+  return tid;
+}
+
+SqliteResultSink::SqliteResultSink (const std::string &fileName)
+  : ResultSink (fileName)
+{
+  NS_LOG_FUNCTION (this << fileName);
+}
+
+SqliteResultSink::~SqliteResultSink ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+bool
+SqliteResultSink::Exec (sqlite3 *db, const std::string &sql) const
+{
+  NS_LOG_INFO ("executing '" << sql << "'");
+  char *errMsg = 0;
+  if (sqlite3_exec (db, sql.c_str (), 0, 0, &errMsg) != SQLITE_OK)
+    {
+      NS_LOG_ERROR ("sqlite3 error: \"" << errMsg << "\"");
+      sqlite3_free (errMsg);
+      return false;
+    }
+  return true;
+}
+
+bool
+SqliteResultSink::DoWrite (void)
+{
+  NS_LOG_FUNCTION (this);
+  sqlite3 *db;
+  if (sqlite3_open (m_fileName.c_str (), &db) != SQLITE_OK)
+    {
+      NS_LOG_ERROR ("Could not open sqlite3 database \"" << m_fileName << "\": " << sqlite3_errmsg (db));
+      sqlite3_close (db);
+      return false;
+    }
+
+  // Without named columns, the rows may differ in length: the table has
+  // as many columns as the longest row, each typed after the first value
+  // written in it
+  std::vector<enum CellType> types;
+  uint32_t cell = 0;
+  for (std::vector<uint32_t>::const_iterator end = m_rowEnds.begin (); end != m_rowEnds.end (); ++end)
+    {
+      for (uint32_t column = 0; cell < *end; cell++, column++)
+        {
+          if (column == types.size ())
+            {
+              types.push_back (m_cells[cell].type);
+            }
+        }
+    }
+  std::ostringstream create;
+  std::ostringstream insert;
+  create << "create table if not exists " << Quote (m_table) << " (";
+  insert << "insert into " << Quote (m_table) << " values (";
+  for (uint32_t i = 0; i < types.size (); i++)
+    {
+      std::ostringstream name;
+      if (i < m_columns.size ())
+        {
+          name << m_columns[i];
+        }
+      else
+        {
+          name << "c" << i + 1;
+        }
+      static const char *typeNames[] = { "integer", "integer", "real", "text" };
+      create << (i == 0 ? "" : ", ") << Quote (name.str ()) << " " << typeNames[types[i]];
+      insert << (i == 0 ? "?" : ", ?");
+    }
+  create << ")";
+  insert << ")";
+
+  if (!m_append && !m_written)
+    {
+      Exec (db, "drop table if exists " + Quote (m_table));
+    }
+  sqlite3_stmt *statement = 0;
+  if (!Exec (db, create.str ()) || !Exec (db, "begin")
+      || sqlite3_prepare_v2 (db, insert.str ().c_str (), -1, &statement, 0) != SQLITE_OK)
+    {
+      NS_LOG_ERROR ("Could not insert into " << m_table << ": " << sqlite3_errmsg (db));
+      sqlite3_close (db);
+      return false;
+    }
+
+  // The values of a row shorter than the table are left NULL, as
+  // sqlite3_clear_bindings left them
+  bool ok = true;
+  cell = 0;
+  for (std::vector<uint32_t>::const_iterator end = m_rowEnds.begin (); ok && end != m_rowEnds.end (); ++end)
+    {
+      for (int column = 1; cell < *end; cell++, column++)
+        {
+          const Cell &c = m_cells[cell];
+          switch (c.type)
+            {
+            case INTEGER:
+              sqlite3_bind_int64 (statement, column, c.integer);
+              break;
+            case UNSIGNED:
+              sqlite3_bind_int64 (statement, column, static_cast<sqlite3_int64> (c.unsignedInteger));
+              break;
+            case REAL:
+              sqlite3_bind_double (statement, column, c.real);
+              break;
+            case TEXT:
+              sqlite3_bind_text (statement, column, m_texts[c.text].c_str (), -1, SQLITE_STATIC);
+              break;
+            }
+        }
+      if (sqlite3_step (statement) != SQLITE_DONE)
+        {
+          NS_LOG_ERROR ("sqlite3 error: \"" << sqlite3_errmsg (db) << "\"");
+          ok = false;
+        }
+      sqlite3_reset (statement);
+      sqlite3_clear_bindings (statement);
+    }
+  sqlite3_finalize (statement);
+  if (!ok)
+    {
+      // None of the rows of this write are stored; the sink keeps them
+      // for the next one
+      Exec (db, "rollback");
+      sqlite3_close (db);
+      return false;
+    }
+  if (!Exec (db, "commit"))
+    {
+      Exec (db, "rollback");
+      sqlite3_close (db);
+      return false;
+    }
+  sqlite3_close (db);
+  NS_LOG_INFO ("Wrote " << m_rowEnds.size () << " rows to " << m_fileName);
+  return true;
+}
+
+} // namespace ns3
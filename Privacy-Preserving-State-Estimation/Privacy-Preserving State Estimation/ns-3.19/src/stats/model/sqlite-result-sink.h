@@ -0,0 +1,61 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SQLITE_RESULT_SINK_H
+#define SQLITE_RESULT_SINK_H
+
+#include "result-sink.h"
+
+struct sqlite3;
+
+namespace ns3 {
+
+/**
+ * \ingroup dataoutput
+ *
+ * \brief A ResultSink which writes its rows to a table of an SQLite
+ * database
+ *
+ * The table is created with the columns of the sink, typed after the
+ * values of the first row written, if it does not exist.  Each write
+ * inserts its rows with one prepared statement, in a single
+ * transaction, which is rolled back if a row cannot be inserted.
+ * Columns which are not named are named c1, c2, ...; rows shorter than
+ * the longest one are padded with NULL.
+ */
+class SqliteResultSink : public ResultSink
+{
+public:
+  static TypeId GetTypeId (void);
+
+  /**
+   * \param fileName name of the database file
+   */
+  SqliteResultSink (const std::string &fileName);
+  virtual ~SqliteResultSink ();
+
+protected:
+  virtual bool DoWrite (void);
+
+private:
+  bool Exec (sqlite3 *db, const std::string &sql) const;
+
+  std::string m_table;
+};
+
+} // namespace ns3
+
+#endif /* SQLITE_RESULT_SINK_H */
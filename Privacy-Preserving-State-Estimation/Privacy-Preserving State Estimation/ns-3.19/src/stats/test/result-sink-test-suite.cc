@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "ns3/test.h"
+#include "ns3/result-sink.h"
+#include "ns3/boolean.h"
+#include "ns3/system-path.h"
+
+using namespace ns3;
+
+static std::string
+ReadFile (const std::string &fileName)
+{
+  std::ifstream file (fileName.c_str (), std::ios::binary);
+  std::ostringstream oss;
+  oss << file.rdbuf ();
+  return oss.str ();
+}
+
+// ===========================================================================
+// Test case for the text written, compared with that of operator<<.
+// ===========================================================================
+
+class ResultSinkFormatTestCase : public TestCase
+{
+public:
+  ResultSinkFormatTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+ResultSinkFormatTestCase::ResultSinkFormatTestCase ()
+  : TestCase ("Check that ResultSink writes the values like operator<<")
+{
+}
+
+void
+ResultSinkFormatTestCase::DoRun (void)
+{
+  std::string fileName = CreateTempDirFilename ("result-sink-format.txt");
+  std::remove (fileName.c_str ());
+
+  double reals[] = { 0.0, 12.5, 100.0 / 3, 1e-5, -2.5e12, 123456789.0 };
+  std::ostringstream expected;
+  Ptr<ResultSink> sink = CreateObject<ResultSink> (fileName);
+  for (uint32_t i = 0; i < sizeof (reals) / sizeof (reals[0]); i++)
+    {
+      uint64_t big = 18446744073709551615ULL - i;
+      sink->Add ("5x5").Add (-3 - int (i)).Add (i).Add (big).Add (reals[i]).AddText ('c').EndRow ();
+      expected << "5x5" << " " << -3 - int (i) << " " << i << " " << big << " " << reals[i] << " " << 'c' << "\n";
+    }
+  NS_TEST_ASSERT_MSG_EQ (sink->GetNRows (), 6, "Rows lost");
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (fileName), "", "Written before Write");
+  sink->Write ();
+  NS_TEST_ASSERT_MSG_EQ (sink->GetNRows (), 0, "Rows not forgotten");
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (fileName), expected.str (), "Wrong text");
+  sink->Dispose ();
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (fileName), expected.str (), "Rows written twice");
+  std::remove (fileName.c_str ());
+}
+
+// ===========================================================================
+// Test case for the header and for the appending of the rows.
+// ===========================================================================
+
+class ResultSinkAppendTestCase : public TestCase
+{
+public:
+  ResultSinkAppendTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+ResultSinkAppendTestCase::ResultSinkAppendTestCase ()
+  : TestCase ("Check that ResultSink writes its header once and appends its rows")
+{
+}
+
+void
+ResultSinkAppendTestCase::DoRun (void)
+{
+  std::string fileName = CreateTempDirFilename ("result-sink-append.csv");
+  std::remove (fileName.c_str ());
+
+  for (int run = 0; run < 2; run++)
+    {
+      Ptr<ResultSink> sink = CreateObject<ResultSink> (fileName, ResultSink::COMMA_SEPARATED);
+      sink->AddColumn ("run");
+      sink->AddColumn ("pdf");
+      sink->Add (run).Add (99.5).EndRow ();
+      sink->Write ();
+      sink->Add (run).Add (100).EndRow ();
+      // Written when disposed
+      sink->Dispose ();
+    }
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (fileName), "# run pdf\n0,99.5\n0,100\n1,99.5\n1,100\n", "Wrong appended file");
+
+  Ptr<ResultSink> sink = CreateObject<ResultSink> (fileName, ResultSink::TAB_SEPARATED);
+  sink->SetAttribute ("Append", BooleanValue (false));
+  sink->AddColumn ("run");
+  sink->AddColumn ("pdf");
+  sink->Add (2).Add (50).EndRow ();
+  sink->Write ();
+  sink->Add (3).Add (25).EndRow ();
+  sink->Write ();
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (fileName), "# run pdf\n2\t50\n3\t25\n", "Wrong replaced file");
+  sink->Dispose ();
+  std::remove (fileName.c_str ());
+}
+
+// ===========================================================================
+// Test case for the rows of a write that failed, which are kept.
+// ===========================================================================
+
+class ResultSinkFailureTestCase : public TestCase
+{
+public:
+  ResultSinkFailureTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+ResultSinkFailureTestCase::ResultSinkFailureTestCase ()
+  : TestCase ("Check that ResultSink keeps the rows it could not write")
+{
+}
+
+void
+ResultSinkFailureTestCase::DoRun (void)
+{
+  std::string dirName = CreateTempDirFilename ("result-sink-missing");
+  std::string fileName = SystemPath::Append (dirName, "failure.txt");
+  std::remove (fileName.c_str ());
+  std::remove (dirName.c_str ());
+
+  Ptr<ResultSink> sink = CreateObject<ResultSink> (fileName);
+  sink->Add (1).Add (0.5).EndRow ();
+  NS_TEST_ASSERT_MSG_EQ (sink->Write (), false, "Written to a missing directory");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetNRows (), 1, "Rows of the failed write lost");
+  sink->Add (2).Add (0.25).EndRow ();
+
+  SystemPath::MakeDirectories (dirName);
+  NS_TEST_ASSERT_MSG_EQ (sink->Write (), true, "Not written once the directory exists");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetNRows (), 0, "Rows not forgotten");
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (fileName), "1 0.5\n2 0.25\n", "Wrong rows after the failed write");
+  sink->Dispose ();
+  std::remove (fileName.c_str ());
+  std::remove (dirName.c_str ());
+}
+
+class ResultSinkTestSuite : public TestSuite
+{
+public:
+  ResultSinkTestSuite ();
+};
+
+ResultSinkTestSuite::ResultSinkTestSuite ()
+  : TestSuite ("result-sink", UNIT)
+{
+  AddTestCase (new ResultSinkFormatTestCase, TestCase::QUICK);
+  AddTestCase (new ResultSinkAppendTestCase, TestCase::QUICK);
+  AddTestCase (new ResultSinkFailureTestCase, TestCase::QUICK);
+}
+
+static ResultSinkTestSuite resultSinkTestSuite;
@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstdio>
+#include <sstream>
+
+#include <sqlite3.h>
+
+#include "ns3/test.h"
+#include "ns3/sqlite-result-sink.h"
+#include "ns3/boolean.h"
+#include "ns3/string.h"
+
+using namespace ns3;
+
+// Runs a query on a database, and returns its rows, one line per row,
+// with the values separated by '|', or the error of sqlite
+static std::string
+Query (const std::string &fileName, const std::string &sql)
+{
+  sqlite3 *db;
+  if (sqlite3_open (fileName.c_str (), &db) != SQLITE_OK)
+    {
+      sqlite3_close (db);
+      return "cannot open";
+    }
+  std::ostringstream oss;
+  sqlite3_stmt *statement = 0;
+  if (sqlite3_prepare_v2 (db, sql.c_str (), -1, &statement, 0) != SQLITE_OK)
+    {
+      oss << sqlite3_errmsg (db);
+      sqlite3_close (db);
+      return oss.str ();
+    }
+  while (sqlite3_step (statement) == SQLITE_ROW)
+    {
+      for (int i = 0; i < sqlite3_column_count (statement); i++)
+        {
+          const unsigned char *text = sqlite3_column_text (statement, i);
+          oss << (i == 0 ? "" : "|") << (text == 0 ? "NULL" : reinterpret_cast<const char *> (text));
+        }
+      oss << "\n";
+    }
+  sqlite3_finalize (statement);
+  sqlite3_close (db);
+  return oss.str ();
+}
+
+// ===========================================================================
+// Test case for the table created and the rows inserted, read back from
+// the database.
+// ===========================================================================
+
+class SqliteResultSinkTestCase : public TestCase
+{
+public:
+  SqliteResultSinkTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SqliteResultSinkTestCase::SqliteResultSinkTestCase ()
+  : TestCase ("Check the table and the rows written by SqliteResultSink")
+{
+}
+
+void
+SqliteResultSinkTestCase::DoRun (void)
+{
+  std::string fileName = CreateTempDirFilename ("sqlite-result-sink.db");
+  std::remove (fileName.c_str ());
+
+  for (int run = 0; run < 2; run++)
+    {
+      Ptr<SqliteResultSink> sink = CreateObject<SqliteResultSink> (fileName);
+      sink->SetAttribute ("Table", StringValue ("flows"));
+      sink->AddColumn ("flow");
+      sink->AddColumn ("delay");
+      sink->AddColumn ("source");
+      sink->AddColumn ("bytes");
+      sink->Add (run).Add (0.0125).Add ("10.1.1.2").Add (18446744073709551615ULL).EndRow ();
+      sink->Write ();
+      sink->Add (run + 10).Add (2.5).Add ("10.1.1.3").Add (7u).EndRow ();
+      // Written when disposed
+      sink->Dispose ();
+    }
+
+  // The columns are typed after the values of the first row
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "select sql from sqlite_master where name = 'flows'"),
+                         "CREATE TABLE \"flows\" (\"flow\" integer, \"delay\" real, \"source\" text, \"bytes\" integer)\n",
+                         "Wrong schema");
+  // The unsigned values above the range of sqlite wrap around
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "select * from flows"),
+                         "0|0.0125|10.1.1.2|-1\n"
+                         "10|2.5|10.1.1.3|7\n"
+                         "1|0.0125|10.1.1.2|-1\n"
+                         "11|2.5|10.1.1.3|7\n", "Wrong appended rows");
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "select sum (flow), typeof (delay) from flows"),
+                         "22|real\n", "Wrong types of the values");
+
+  // Without Append, the table is replaced by the first write only
+  Ptr<SqliteResultSink> sink = CreateObject<SqliteResultSink> (fileName);
+  sink->SetAttribute ("Table", StringValue ("flows"));
+  sink->SetAttribute ("Append", BooleanValue (false));
+  sink->AddColumn ("flow");
+  sink->Add (2).EndRow ();
+  sink->Write ();
+  sink->Add (3).EndRow ();
+  sink->Write ();
+  sink->Dispose ();
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "select * from flows"), "2\n3\n", "Wrong replaced table");
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "select sql from sqlite_master where name = 'flows'"),
+                         "CREATE TABLE \"flows\" (\"flow\" integer)\n", "Wrong replaced schema");
+
+  // The columns which are not named are named c1, c2, ...
+  sink = CreateObject<SqliteResultSink> (fileName);
+  sink->Add ("a").Add (1.5).EndRow ();
+  sink->Dispose ();
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "select sql from sqlite_master where name = 'results'"),
+                         "CREATE TABLE \"results\" (\"c1\" text, \"c2\" real)\n", "Wrong default schema");
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "select * from results"), "a|1.5\n", "Wrong default table");
+
+  // Without named columns the rows may differ in length: the shorter ones
+  // are padded with NULL, not with the values of the previous row
+  sink = CreateObject<SqliteResultSink> (fileName);
+  sink->SetAttribute ("Table", StringValue ("uneven"));
+  sink->Add (1).Add ("b").EndRow ();
+  sink->Add (2).Add ("c").Add (0.5).EndRow ();
+  sink->Add (3).EndRow ();
+  sink->Add (4).Add ("d").EndRow ();
+  sink->Dispose ();
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "select sql from sqlite_master where name = 'uneven'"),
+                         "CREATE TABLE \"uneven\" (\"c1\" integer, \"c2\" text, \"c3\" real)\n",
+                         "Wrong schema of rows of different lengths");
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "select * from uneven"),
+                         "1|b|NULL\n"
+                         "2|c|0.5\n"
+                         "3|NULL|NULL\n"
+                         "4|d|NULL\n", "Wrong rows of different lengths");
+
+  // A row which cannot be inserted rolls the whole write back
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "create table checked (c1 integer check (c1 < 10))"), "",
+                         "Could not create the checked table");
+  sink = CreateObject<SqliteResultSink> (fileName);
+  sink->SetAttribute ("Table", StringValue ("checked"));
+  sink->Add (1).EndRow ();
+  sink->Add (20).EndRow ();
+  sink->Add (3).EndRow ();
+  NS_TEST_ASSERT_MSG_EQ (sink->Write (), false, "Write of a row out of the check succeeded");
+  NS_TEST_ASSERT_MSG_EQ (Query (fileName, "select count (*) from checked"), "0\n", "Write not rolled back");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetNRows (), 3, "Rows of the rolled back write not kept");
+  sink->Clear ();
+  NS_TEST_ASSERT_MSG_EQ (sink->GetNRows (), 0, "Rows not cleared");
+  sink->Dispose ();
+  std::remove (fileName.c_str ());
+}
+
+class SqliteResultSinkTestSuite : public TestSuite
+{
+public:
+  SqliteResultSinkTestSuite ();
+};
+
+SqliteResultSinkTestSuite::SqliteResultSinkTestSuite ()
+  : TestSuite ("sqlite-result-sink", UNIT)
+{
+  AddTestCase (new SqliteResultSinkTestCase, TestCase::QUICK);
+}
+
+static SqliteResultSinkTestSuite sqliteResultSinkTestSuite;
@@ -0,0 +1,200 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+
+#include "ns3/boolean.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+#include "ns3/object-factory.h"
+#include "ns3/multithreaded-simulator-impl.h"
+
+#include "ns3/inet-socket-address.h"
+#include "ns3/ipv4-static-routing-helper.h"
+#include "ns3/wifi-helper.h"
+#include "ns3/nqos-wifi-mac-helper.h"
+#include "ns3/yans-wifi-helper.h"
+#include "ns3/yans-wifi-channel.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/point-to-point-helper.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/packet-sink-helper.h"
+#include "ns3/on-off-helper.h"
+#include "ns3/flow-monitor-helper.h"
+#include "ns3/ipv4-flow-classifier.h"
+#include "ns3/ipv4-flow-probe.h"
+
+#include <map>
+
+NS_LOG_COMPONENT_DEFINE ("WifiParallelFlowMonitorTest");
+
+using namespace ns3;
+
+/**
+ * A wifi sender whose frames are relayed over a slow point-to-point
+ * link, run with one and with two threads of MultithreadedSimulatorImpl.
+ * The sender runs in another partition than the relay and the sink, so
+ * its frames are copied between the threads. The queue of the relay
+ * drops some of them, which FlowMonitor only attributes to the queue
+ * through the tag the sender's probe put on the packet.
+ */
+class WifiParallelFlowMonitorTest : public TestCase
+{
+public:
+  WifiParallelFlowMonitorTest ();
+  virtual void DoRun (void);
+
+private:
+  typedef std::map<Ipv4FlowClassifier::FiveTuple, FlowMonitor::FlowStats> Stats;
+  Stats Run (uint32_t threads);
+};
+
+WifiParallelFlowMonitorTest::WifiParallelFlowMonitorTest ()
+  : TestCase ("Check that FlowMonitor gives the same statistics with one and two threads")
+{
+}
+
+WifiParallelFlowMonitorTest::Stats
+WifiParallelFlowMonitorTest::Run (uint32_t threads)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (MultithreadedSimulatorImpl::GetTypeId ());
+  factory.Set ("MaxThreads", UintegerValue (threads));
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+
+  // The contexts are split into contiguous blocks: the relay and the sink
+  // share the first partition, the sender is alone in the second one
+  NodeContainer nodes;
+  nodes.Create (3);
+  Ptr<Node> relay = nodes.Get (0);
+  Ptr<Node> sink = nodes.Get (1);
+  Ptr<Node> sender = nodes.Get (2);
+  NodeContainer wifiNodes (relay, sender);
+
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator> ();
+  positions->Add (Vector (0.0, 0.0, 0.0));
+  positions->Add (Vector (50.0, 0.0, 0.0));
+  mobility.SetPositionAllocator (positions);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (wifiNodes);
+
+  WifiHelper wifi = WifiHelper::Default ();
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211a);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager",
+                                "DataMode", StringValue ("OfdmRate6Mbps"));
+  YansWifiPhyHelper phy = YansWifiPhyHelper::Default ();
+  Ptr<YansWifiChannel> channel = YansWifiChannelHelper::Default ().Create ();
+  phy.SetChannel (channel);
+  NqosWifiMacHelper mac = NqosWifiMacHelper::Default ();
+  mac.SetType ("ns3::AdhocWifiMac");
+  NetDeviceContainer wifiDevices = wifi.Install (phy, mac, wifiNodes);
+
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute ("DataRate", StringValue ("200kbps"));
+  p2p.SetChannelAttribute ("Delay", StringValue ("1ms"));
+  p2p.SetQueue ("ns3::DropTailQueue", "MaxPackets", UintegerValue (5));
+  NetDeviceContainer p2pDevices = p2p.Install (relay, sink);
+
+  InternetStackHelper internet;
+  internet.Install (nodes);
+  Ipv4AddressHelper ipv4;
+  ipv4.SetBase ("10.1.1.0", "255.255.255.0");
+  Ipv4InterfaceContainer wifiInterfaces = ipv4.Assign (wifiDevices);
+  ipv4.SetBase ("10.1.2.0", "255.255.255.0");
+  Ipv4InterfaceContainer p2pInterfaces = ipv4.Assign (p2pDevices);
+  Ipv4StaticRoutingHelper routing;
+  routing.GetStaticRouting (sender->GetObject<Ipv4> ())->AddNetworkRouteTo (Ipv4Address ("10.1.2.0"),
+                                                                            Ipv4Mask ("255.255.255.0"),
+                                                                            wifiInterfaces.GetAddress (0), 1);
+
+  uint16_t port = 9;
+  OnOffHelper onoff ("ns3::UdpSocketFactory", InetSocketAddress (p2pInterfaces.GetAddress (1), port));
+  onoff.SetConstantRate (DataRate ("1Mbps"), 500);
+  ApplicationContainer source = onoff.Install (sender);
+  source.Start (Seconds (1.0));
+  source.Stop (Seconds (1.5));
+  PacketSinkHelper packetSink ("ns3::UdpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), port));
+  ApplicationContainer receiver = packetSink.Install (sink);
+  receiver.Start (Seconds (0.0));
+
+  // The automatic streams go on across the runs of the test
+  wifi.AssignStreams (wifiDevices, 0);
+  internet.AssignStreams (nodes, 100);
+  onoff.AssignStreams (NodeContainer (sender), 200);
+
+  FlowMonitorHelper flowmon;
+  Ptr<FlowMonitor> monitor = flowmon.InstallAll ();
+
+  Simulator::GetImplementation ()->SetAttribute ("Lookahead", TimeValue (channel->GetMinimumDelay ()));
+  Simulator::Stop (Seconds (3.0));
+  Simulator::Run ();
+
+  monitor->CheckForLostPackets ();
+  Ptr<Ipv4FlowClassifier> classifier = DynamicCast<Ipv4FlowClassifier> (flowmon.GetClassifier ());
+  std::map<FlowId, FlowMonitor::FlowStats> flowStats = monitor->GetFlowStats ();
+  // Flows first seen at once by two threads may be numbered either way
+  Stats stats;
+  for (std::map<FlowId, FlowMonitor::FlowStats>::const_iterator i = flowStats.begin (); i != flowStats.end (); ++i)
+    {
+      stats[classifier->FindFlow (i->first)] = i->second;
+    }
+  Simulator::Destroy ();
+  return stats;
+}
+
+void
+WifiParallelFlowMonitorTest::DoRun (void)
+{
+  Stats single = Run (1);
+  Stats parallel = Run (2);
+
+  NS_TEST_ASSERT_MSG_EQ (single.size (), 1, "Wrong number of flows");
+  NS_TEST_ASSERT_MSG_EQ (parallel.size (), single.size (), "Flows differ");
+  const FlowMonitor::FlowStats &a = single.begin ()->second;
+  const FlowMonitor::FlowStats &b = parallel.begin ()->second;
+  NS_TEST_ASSERT_MSG_EQ ((single.begin ()->first == parallel.begin ()->first), true, "Flows differ");
+  NS_TEST_ASSERT_MSG_GT (a.packetsDropped.size (), static_cast<uint32_t> (Ipv4FlowProbe::DROP_QUEUE),
+                         "No queue drop, the scenario does not check the tags");
+  NS_TEST_ASSERT_MSG_GT (a.packetsDropped[Ipv4FlowProbe::DROP_QUEUE], 0, "No queue drop");
+  NS_TEST_ASSERT_MSG_EQ (b.txPackets, a.txPackets, "Transmitted packets differ");
+  NS_TEST_ASSERT_MSG_EQ (b.rxPackets, a.rxPackets, "Received packets differ");
+  NS_TEST_ASSERT_MSG_EQ (b.txBytes, a.txBytes, "Transmitted bytes differ");
+  NS_TEST_ASSERT_MSG_EQ (b.rxBytes, a.rxBytes, "Received bytes differ");
+  NS_TEST_ASSERT_MSG_EQ (b.lostPackets, a.lostPackets, "Lost packets differ");
+  NS_TEST_ASSERT_MSG_EQ (b.timesForwarded, a.timesForwarded, "Forwardings differ");
+  NS_TEST_ASSERT_MSG_EQ (b.delaySum, a.delaySum, "Delays differ");
+  NS_TEST_ASSERT_MSG_EQ (b.jitterSum, a.jitterSum, "Jitters differ");
+  NS_TEST_ASSERT_MSG_EQ ((b.packetsDropped == a.packetsDropped), true, "Drops differ");
+  NS_TEST_ASSERT_MSG_EQ ((b.bytesDropped == a.bytesDropped), true, "Dropped bytes differ");
+}
+
+class WifiParallelFlowMonitorTestSuite : public TestSuite
+{
+public:
+  WifiParallelFlowMonitorTestSuite ();
+};
+
+WifiParallelFlowMonitorTestSuite::WifiParallelFlowMonitorTestSuite ()
+  : TestSuite ("ns3-wifi-parallel-flow-monitor", SYSTEM)
+{
+  AddTestCase (new WifiParallelFlowMonitorTest, TestCase::QUICK);
+}
+
+static WifiParallelFlowMonitorTestSuite wifiParallelFlowMonitorTestSuite;
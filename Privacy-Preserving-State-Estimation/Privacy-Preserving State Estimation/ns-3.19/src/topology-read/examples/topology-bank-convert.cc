@@ -0,0 +1,53 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * This program converts a CSV topology bank ("nodes,topology,node,x,y"
+ * per line) to the binary format, which TopologyBank maps into memory
+ * instead of parsing, and prints the content of the result.
+ */
+
+#include <iostream>
+#include <cstdlib>
+
+#include "ns3/core-module.h"
+#include "ns3/topology-read-module.h"
+
+using namespace ns3;
+
+int main (int argc, char *argv[])
+{
+  std::string input ("scratch/n_eq_topologies.csv");
+  std::string output ("scratch/n_eq_topologies.bin");
+
+  CommandLine cmd;
+  cmd.AddValue ("input", "Name of the CSV bank.", input);
+  cmd.AddValue ("output", "Name of the binary bank to write.", output);
+  cmd.Parse (argc, argv);
+
+  if (!TopologyBank::WriteBinary (input, output))
+    {
+      std::cerr << "Error: could not convert " << input << " to " << output << std::endl;
+      return EXIT_FAILURE;
+    }
+
+  Ptr<TopologyBank> bank = CreateObject<TopologyBank> ();
+  bank->SetFileName (output);
+  std::vector<uint32_t> counts = bank->GetNodeCounts ();
+  for (std::vector<uint32_t>::const_iterator i = counts.begin (); i != counts.end (); ++i)
+    {
+      std::cout << *i << " nodes: " << bank->GetNTopologies (*i) << " topologies" << std::endl;
+    }
+  return 0;
+}
@@ -24,6 +24,7 @@
 #include "ns3/inet-topology-reader.h"
 #include "ns3/orbis-topology-reader.h"
 #include "ns3/rocketfuel-topology-reader.h"
+#include "ns3/topology-bank.h"
 #include "ns3/log.h"
 
 namespace ns3 {
@@ -72,6 +73,11 @@ TopologyReaderHelper::GetTopologyReader ()
           NS_LOG_INFO ("Creating Rocketfuel formatted data input.");
           m_inputModel = CreateObject<RocketfuelTopologyReader> ();
         }
+      else if (m_fileType == "Bank")
+        {
+          NS_LOG_INFO ("Creating topology bank data input.");
+          m_inputModel = CreateObject<TopologyBank> ();
+        }
       else
         {
           NS_ASSERT_MSG (false, "Wrong (unknown) File Type");
@@ -44,7 +44,7 @@ public:
   void SetFileName (const std::string fileName);
 
   /**
-   * \brief Sets the input file type. Supported file types are "Orbis", "Inet", "Rocketfuel".
+   * \brief Sets the input file type. Supported file types are "Orbis", "Inet", "Rocketfuel", "Bank".
    * \param fileType the input file type.
    */
   void SetFileType (const std::string fileType);
@@ -0,0 +1,411 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <limits>
+#include <map>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ns3/constant-position-mobility-model.h"
+
+#include "topology-bank.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("TopologyBank")
+  ;
+
+NS_OBJECT_ENSURE_REGISTERED (TopologyBank)
+  ;
+
+static const char g_magic[8] = { 'N', 'S', '3', 'T', 'O', 'P', 'O', 'B' };
+static const uint32_t g_version = 1;
+
+// Size of the fixed header and of one directory entry of a binary bank
+static const uint32_t g_headerSize = sizeof (g_magic) + 2 * sizeof (uint32_t);
+static const uint32_t g_entrySize = 2 * sizeof (uint32_t) + sizeof (uint64_t);
+
+/**
+ * Parse a CSV bank into one array of x, y per node count, the
+ * coordinates of topology t and node n being at 2 * (t * nodes + n).
+ */
+static bool
+ReadCsv (const std::string &fileName, std::map<uint32_t, std::vector<double> > &banks)
+{
+  std::ifstream input (fileName.c_str ());
+  if (!input.is_open ())
+    {
+      NS_LOG_WARN ("Topology bank " << fileName << " could not be opened");
+      return false;
+    }
+  std::string line;
+  uint32_t lineNumber = 0;
+  while (getline (input, line))
+    {
+      lineNumber++;
+      if (line.empty () || line[0] == '#' || line[0] == '\r')
+        {
+          continue;
+        }
+      std::istringstream lineBuffer (line);
+      uint32_t nodes;
+      uint32_t topology;
+      uint32_t node;
+      double x;
+      double y;
+      char c1, c2, c3, c4;
+      lineBuffer >> nodes >> c1 >> topology >> c2 >> node >> c3 >> x >> c4 >> y;
+      if (lineBuffer.fail () || c1 != ',' || c2 != ',' || c3 != ',' || c4 != ','
+          || nodes == 0 || node >= nodes)
+        {
+          NS_LOG_WARN (fileName << ":" << lineNumber << ": malformed line");
+          return false;
+        }
+      std::vector<double> &coords = banks[nodes];
+      uint64_t index = 2 * (uint64_t (topology) * nodes + node);
+      if (coords.size () <= index)
+        {
+          coords.resize (2 * (uint64_t (topology) + 1) * nodes, std::numeric_limits<double>::quiet_NaN ());
+        }
+      coords[index] = x;
+      coords[index + 1] = y;
+    }
+  for (std::map<uint32_t, std::vector<double> >::const_iterator i = banks.begin (); i != banks.end (); ++i)
+    {
+      for (uint64_t j = 0; j < i->second.size (); j++)
+        {
+          if (i->second[j] != i->second[j])
+            {
+              NS_LOG_WARN (fileName << ": topology " << j / (2 * i->first) << " of "
+                                    << i->first << " nodes is incomplete");
+              return false;
+            }
+        }
+    }
+  return true;
+}
+
+TypeId TopologyBank::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::TopologyBank")
+    .SetParent<TopologyReader> ()
+    .AddConstructor<TopologyBank> ()
+    .AddAttribute ("Nodes",
+                   "Number of nodes of the topology created by Read.",
+                   UintegerValue (25),
+                   MakeUintegerAccessor (&TopologyBank::m_nodes),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("Topology",
+                   "Index of the topology created by Read.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TopologyBank::m_topology),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+TopologyBank::TopologyBank ()
+  : m_open (false),
+    m_map (0),
+    m_mapLength (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+TopologyBank::~TopologyBank ()
+{
+  NS_LOG_FUNCTION (this);
+  Close ();
+}
+
+void
+TopologyBank::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  Close ();
+  TopologyReader::DoDispose ();
+}
+
+void
+TopologyBank::Close (void)
+{
+  if (m_map != 0)
+    {
+      munmap (m_map, m_mapLength);
+      m_map = 0;
+      m_mapLength = 0;
+    }
+  m_entries.clear ();
+  m_csv.clear ();
+  m_open = false;
+}
+
+bool
+TopologyBank::Open (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_open)
+    {
+      return true;
+    }
+  char magic[sizeof (g_magic)];
+  std::ifstream input (GetFileName ().c_str (), std::ios::in | std::ios::binary);
+  if (!input.is_open ())
+    {
+      NS_LOG_WARN ("Topology bank " << GetFileName () << " could not be opened");
+      return false;
+    }
+  input.read (magic, sizeof (magic));
+  bool binary = input.gcount () == sizeof (magic) && memcmp (magic, g_magic, sizeof (magic)) == 0;
+  input.close ();
+
+  m_open = binary ? OpenBinary () : OpenCsv ();
+  if (!m_open)
+    {
+      Close ();
+    }
+  return m_open;
+}
+
+bool
+TopologyBank::OpenBinary (void)
+{
+  NS_LOG_FUNCTION (this);
+  int fd = open (GetFileName ().c_str (), O_RDONLY);
+  if (fd < 0)
+    {
+      NS_LOG_WARN ("Topology bank " << GetFileName () << " could not be opened");
+      return false;
+    }
+  struct stat st;
+  if (fstat (fd, &st) != 0 || uint64_t (st.st_size) < g_headerSize)
+    {
+      close (fd);
+      NS_LOG_WARN ("Topology bank " << GetFileName () << " is truncated");
+      return false;
+    }
+  void *map = mmap (0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+  if (map == MAP_FAILED)
+    {
+      NS_LOG_WARN ("Topology bank " << GetFileName () << " could not be mapped");
+      return false;
+    }
+  m_map = map;
+  m_mapLength = st.st_size;
+
+  const uint8_t *base = static_cast<const uint8_t *> (m_map);
+  uint32_t version;
+  uint32_t entries;
+  memcpy (&version, base + sizeof (g_magic), sizeof (uint32_t));
+  memcpy (&entries, base + sizeof (g_magic) + sizeof (uint32_t), sizeof (uint32_t));
+  if (version != g_version || g_headerSize + uint64_t (entries) * g_entrySize > m_mapLength)
+    {
+      NS_LOG_WARN ("Topology bank " << GetFileName () << " has an unknown version or is truncated");
+      return false;
+    }
+  for (uint32_t i = 0; i < entries; i++)
+    {
+      const uint8_t *p = base + g_headerSize + i * g_entrySize;
+      Entry entry;
+      uint64_t offset;
+      memcpy (&entry.nodes, p, sizeof (uint32_t));
+      memcpy (&entry.topologies, p + sizeof (uint32_t), sizeof (uint32_t));
+      memcpy (&offset, p + 2 * sizeof (uint32_t), sizeof (uint64_t));
+      uint64_t length = 2 * sizeof (double) * uint64_t (entry.nodes) * entry.topologies;
+      if (offset % sizeof (double) != 0 || offset + length > m_mapLength)
+        {
+          NS_LOG_WARN ("Topology bank " << GetFileName () << ": entry " << i << " is out of bounds");
+          return false;
+        }
+      entry.coords = reinterpret_cast<const double *> (base + offset);
+      m_entries.push_back (entry);
+    }
+  NS_LOG_INFO ("Mapped topology bank " << GetFileName () << " with " << entries << " node counts");
+  return true;
+}
+
+bool
+TopologyBank::OpenCsv (void)
+{
+  NS_LOG_FUNCTION (this);
+  std::map<uint32_t, std::vector<double> > banks;
+  if (!ReadCsv (GetFileName (), banks))
+    {
+      return false;
+    }
+  for (std::map<uint32_t, std::vector<double> >::const_iterator i = banks.begin (); i != banks.end (); ++i)
+    {
+      Entry entry;
+      entry.nodes = i->first;
+      entry.topologies = i->second.size () / (2 * i->first);
+      entry.coords = 0;
+      m_csv.insert (m_csv.end (), i->second.begin (), i->second.end ());
+      m_entries.push_back (entry);
+    }
+  // The pointers can only be taken once m_csv holds its final content
+  uint64_t offset = 0;
+  for (std::vector<Entry>::iterator i = m_entries.begin (); i != m_entries.end (); ++i)
+    {
+      i->coords = &m_csv[offset];
+      offset += 2 * uint64_t (i->nodes) * i->topologies;
+    }
+  NS_LOG_INFO ("Parsed topology bank " << GetFileName () << " with " << m_entries.size () << " node counts");
+  return true;
+}
+
+const TopologyBank::Entry *
+TopologyBank::Find (uint32_t nodes) const
+{
+  for (std::vector<Entry>::const_iterator i = m_entries.begin (); i != m_entries.end (); ++i)
+    {
+      if (i->nodes == nodes)
+        {
+          return &(*i);
+        }
+    }
+  return 0;
+}
+
+std::vector<uint32_t>
+TopologyBank::GetNodeCounts (void)
+{
+  NS_LOG_FUNCTION (this);
+  std::vector<uint32_t> counts;
+  if (Open ())
+    {
+      for (std::vector<Entry>::const_iterator i = m_entries.begin (); i != m_entries.end (); ++i)
+        {
+          counts.push_back (i->nodes);
+        }
+    }
+  return counts;
+}
+
+uint32_t
+TopologyBank::GetNTopologies (uint32_t nodes)
+{
+  NS_LOG_FUNCTION (this << nodes);
+  if (!Open ())
+    {
+      return 0;
+    }
+  const Entry *entry = Find (nodes);
+  return entry == 0 ? 0 : entry->topologies;
+}
+
+bool
+TopologyBank::GetPositions (uint32_t nodes, uint32_t topology, std::vector<Vector> &positions)
+{
+  NS_LOG_FUNCTION (this << nodes << topology);
+  if (!Open ())
+    {
+      return false;
+    }
+  const Entry *entry = Find (nodes);
+  if (entry == 0 || topology >= entry->topologies)
+    {
+      NS_LOG_WARN ("Topology bank " << GetFileName () << " has no topology " << topology
+                                    << " of " << nodes << " nodes");
+      return false;
+    }
+  const double *coords = entry->coords + 2 * uint64_t (topology) * nodes;
+  positions.resize (nodes);
+  for (uint32_t i = 0; i < nodes; i++)
+    {
+      positions[i] = Vector (coords[2 * i], coords[2 * i + 1], 0.0);
+    }
+  return true;
+}
+
+NodeContainer
+TopologyBank::Read (void)
+{
+  NS_LOG_FUNCTION (this);
+  NodeContainer nodes;
+  std::vector<Vector> positions;
+  if (!GetPositions (m_nodes, m_topology, positions))
+    {
+      return nodes;
+    }
+  nodes.Create (m_nodes);
+  for (uint32_t i = 0; i < m_nodes; i++)
+    {
+      Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+      mobility->SetPosition (positions[i]);
+      nodes.Get (i)->AggregateObject (mobility);
+    }
+  NS_LOG_INFO ("Topology " << m_topology << " created with " << m_nodes << " nodes");
+  return nodes;
+}
+
+bool
+TopologyBank::WriteBinary (const std::string &csvFileName, const std::string &fileName)
+{
+  NS_LOG_FUNCTION (csvFileName << fileName);
+  std::map<uint32_t, std::vector<double> > banks;
+  if (!ReadCsv (csvFileName, banks))
+    {
+      return false;
+    }
+  std::ofstream output (fileName.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!output.is_open ())
+    {
+      NS_LOG_WARN ("Topology bank " << fileName << " could not be created");
+      return false;
+    }
+  uint32_t entries = banks.size ();
+  output.write (g_magic, sizeof (g_magic));
+  output.write (reinterpret_cast<const char *> (&g_version), sizeof (uint32_t));
+  output.write (reinterpret_cast<const char *> (&entries), sizeof (uint32_t));
+
+  // The coordinates start on a double boundary after the directory
+  uint64_t offset = g_headerSize + uint64_t (entries) * g_entrySize;
+  uint64_t padding = (sizeof (double) - offset % sizeof (double)) % sizeof (double);
+  offset += padding;
+  for (std::map<uint32_t, std::vector<double> >::const_iterator i = banks.begin (); i != banks.end (); ++i)
+    {
+      uint32_t nodes = i->first;
+      uint32_t topologies = i->second.size () / (2 * nodes);
+      output.write (reinterpret_cast<const char *> (&nodes), sizeof (uint32_t));
+      output.write (reinterpret_cast<const char *> (&topologies), sizeof (uint32_t));
+      output.write (reinterpret_cast<const char *> (&offset), sizeof (uint64_t));
+      offset += i->second.size () * sizeof (double);
+    }
+  const char zero[sizeof (double)] = { 0 };
+  output.write (zero, padding);
+  for (std::map<uint32_t, std::vector<double> >::const_iterator i = banks.begin (); i != banks.end (); ++i)
+    {
+      output.write (reinterpret_cast<const char *> (&i->second[0]), i->second.size () * sizeof (double));
+    }
+  output.close ();
+  if (output.fail ())
+    {
+      NS_LOG_WARN ("Topology bank " << fileName << " could not be written");
+      return false;
+    }
+  return true;
+}
+
+} /* namespace ns3 */
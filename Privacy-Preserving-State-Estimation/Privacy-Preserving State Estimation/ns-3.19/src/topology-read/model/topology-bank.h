@@ -0,0 +1,152 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TOPOLOGY_BANK_H
+#define TOPOLOGY_BANK_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "ns3/vector.h"
+#include "topology-reader.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup topology
+ *
+ * \brief Bank of node placements, indexed by number of nodes and topology.
+ *
+ * A bank holds any number of placements (topologies) for any number of
+ * node counts, so that a script selects its layout at run time rather
+ * than compiling coordinate tables in. Two file formats are understood:
+ *
+ * - CSV, one node per line: "nodes,topology,node,x,y". Empty lines and
+ *   lines starting with '#' are ignored. The file is parsed into memory.
+ * - Binary, as written by WriteBinary. The file is mapped read-only and
+ *   positions are served straight from the mapping, so opening a bank of
+ *   thousands of topologies costs nothing until they are used.
+ *
+ * The binary layout, in host byte order, is:
+ * \verbatim
+   | magic "NS3TOPOB" (8) | version (4) | entries (4) |
+   | entries x { nodes (4) | topologies (4) | offset (8) } |
+   | for each entry, topologies x nodes x { x (8) | y (8) } |
+   \endverbatim
+ * where offset is the position of the first coordinate of the entry from
+ * the start of the file.
+ *
+ * Read () creates the nodes of the topology selected by the Nodes and
+ * Topology attributes, each with a ConstantPositionMobilityModel at its
+ * stored position. The bank has no links.
+ */
+class TopologyBank : public TopologyReader
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  TopologyBank ();
+  virtual ~TopologyBank ();
+
+  /**
+   * \brief Open the bank named by SetFileName.
+   * \return false if the file could not be read or is malformed
+   *
+   * Called by the other methods on first use.
+   */
+  bool Open (void);
+
+  /**
+   * \return the node counts the bank holds topologies for
+   */
+  std::vector<uint32_t> GetNodeCounts (void);
+
+  /**
+   * \param nodes number of nodes of the topologies
+   * \return the number of topologies of that many nodes in the bank
+   */
+  uint32_t GetNTopologies (uint32_t nodes);
+
+  /**
+   * \param nodes number of nodes of the topology
+   * \param topology index of the topology, below GetNTopologies (nodes)
+   * \param positions receives the position of each node, z being zero
+   * \return false if the bank holds no such topology
+   */
+  bool GetPositions (uint32_t nodes, uint32_t topology, std::vector<Vector> &positions);
+
+  /**
+   * \brief Create the nodes of the topology selected by the attributes,
+   * placed at their stored positions.
+   * \return the container of the nodes created (or empty container if there was an error)
+   */
+  virtual NodeContainer Read (void);
+
+  /**
+   * \brief Convert a CSV bank to the binary format.
+   * \param csvFileName the CSV bank to read
+   * \param fileName the binary bank to write
+   * \return false if the CSV bank could not be read or the output written
+   */
+  static bool WriteBinary (const std::string &csvFileName, const std::string &fileName);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * \brief Copy constructor
+   *
+   * Defined and unimplemented to avoid misuse
+   */
+  TopologyBank (const TopologyBank&);
+  /**
+   * \brief Copy constructor
+   *
+   * Defined and unimplemented to avoid misuse
+   * \returns
+   */
+  TopologyBank& operator= (const TopologyBank&);
+
+  /// Topologies of one node count
+  struct Entry
+  {
+    uint32_t nodes;       //!< Nodes per topology
+    uint32_t topologies;  //!< Number of topologies
+    const double *coords; //!< x, y of every node of every topology
+  };
+
+  bool OpenBinary (void);
+  bool OpenCsv (void);
+  void Close (void);
+  const Entry *Find (uint32_t nodes) const;
+
+  uint32_t m_nodes;              //!< Nodes of the topology created by Read
+  uint32_t m_topology;           //!< Index of the topology created by Read
+  bool m_open;                   //!< True once the bank was opened
+  std::vector<Entry> m_entries;  //!< One entry per node count
+  void *m_map;                   //!< Mapping of a binary bank
+  uint64_t m_mapLength;          //!< Length of m_map
+  std::vector<double> m_csv;     //!< Coordinates parsed from a CSV bank
+};
+
+} // namespace ns3
+
+#endif /* TOPOLOGY_BANK_H */
@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <fstream>
+#include <cstdio>
+
+#include "ns3/test.h"
+#include "ns3/topology-bank.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/mobility-model.h"
+
+namespace ns3 {
+
+class TopologyBankTest : public TestCase
+{
+public:
+  TopologyBankTest ();
+private:
+  void Check (std::string fileName);
+  virtual void DoRun (void);
+};
+
+TopologyBankTest::TopologyBankTest ()
+  : TestCase ("TopologyBankTest")
+{
+}
+
+void
+TopologyBankTest::Check (std::string fileName)
+{
+  Ptr<TopologyBank> bank = CreateObject<TopologyBank> ();
+  bank->SetFileName (fileName);
+  NS_TEST_ASSERT_MSG_EQ (bank->Open (), true, "Could not open " << fileName);
+
+  NS_TEST_EXPECT_MSG_EQ (bank->GetNTopologies (2), 2, "topologies of 2 nodes");
+  NS_TEST_EXPECT_MSG_EQ (bank->GetNTopologies (3), 1, "topologies of 3 nodes");
+  NS_TEST_EXPECT_MSG_EQ (bank->GetNTopologies (4), 0, "topologies of 4 nodes");
+
+  std::vector<Vector> positions;
+  NS_TEST_ASSERT_MSG_EQ (bank->GetPositions (2, 1, positions), true, "topology 1 of 2 nodes");
+  NS_TEST_ASSERT_MSG_EQ (positions.size (), 2, "positions");
+  NS_TEST_EXPECT_MSG_EQ_TOL (positions[0].x, 10.5, 1e-12, "x");
+  NS_TEST_EXPECT_MSG_EQ_TOL (positions[1].y, 13.25, 1e-12, "y");
+  NS_TEST_ASSERT_MSG_EQ (bank->GetPositions (3, 0, positions), true, "topology 0 of 3 nodes");
+  NS_TEST_EXPECT_MSG_EQ_TOL (positions[2].x, 318.47771677784675, 1e-12, "x");
+  NS_TEST_EXPECT_MSG_EQ (bank->GetPositions (3, 1, positions), false, "topology 1 of 3 nodes");
+
+  bank->SetAttribute ("Nodes", UintegerValue (3));
+  NodeContainer nodes = bank->Read ();
+  NS_TEST_ASSERT_MSG_EQ (nodes.GetN (), 3, "nodes");
+  Ptr<MobilityModel> mobility = nodes.Get (2)->GetObject<MobilityModel> ();
+  NS_TEST_ASSERT_MSG_NE (mobility, 0, "node without a position");
+  NS_TEST_EXPECT_MSG_EQ_TOL (mobility->GetPosition ().x, 318.47771677784675, 1e-12, "x of the node");
+  NS_TEST_EXPECT_MSG_EQ_TOL (mobility->GetPosition ().y, 53.851167292794685, 1e-12, "y of the node");
+  NS_TEST_EXPECT_MSG_EQ (bank->LinksSize (), 0, "links");
+}
+
+void
+TopologyBankTest::DoRun (void)
+{
+  std::string csv = CreateTempDirFilename ("topology-bank.csv");
+  std::string binary = CreateTempDirFilename ("topology-bank.bin");
+  std::ofstream output (csv.c_str ());
+  output << "# nodes,topology,node,x,y\n"
+         << "2,0,0,0.0,0.0\n"
+         << "2,0,1,1.0,1.0\n"
+         << "3,0,2,318.47771677784675,53.851167292794685\n"
+         << "2,1,1,12.0,13.25\n"
+         << "3,0,0,1.0,2.0\n"
+         << "\n"
+         << "2,1,0,10.5,11.0\n"
+         << "3,0,1,3.0,4.0\n";
+  output.close ();
+
+  Check (csv);
+  NS_TEST_ASSERT_MSG_EQ (TopologyBank::WriteBinary (csv, binary), true, "Could not write " << binary);
+  Check (binary);
+
+  // A topology with a missing node is rejected
+  output.open (csv.c_str ());
+  output << "2,0,0,0.0,0.0\n";
+  output.close ();
+  Ptr<TopologyBank> bank = CreateObject<TopologyBank> ();
+  bank->SetFileName (csv);
+  NS_TEST_EXPECT_MSG_EQ (bank->Open (), false, "Incomplete topology accepted");
+
+  std::remove (csv.c_str ());
+  std::remove (binary.c_str ());
+  Simulator::Destroy ();
+}
+
+class TopologyBankTestSuite : public TestSuite
+{
+public:
+  TopologyBankTestSuite ();
+private:
+};
+
+TopologyBankTestSuite::TopologyBankTestSuite ()
+  : TestSuite ("topology-bank", UNIT)
+{
+  AddTestCase (new TopologyBankTest (), TestCase::QUICK);
+}
+
+static TopologyBankTestSuite topologyBankTestSuite;
+}
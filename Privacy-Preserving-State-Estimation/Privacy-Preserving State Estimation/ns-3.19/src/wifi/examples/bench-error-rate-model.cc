@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Benchmark of the chunk success rates of the error rate models.
+//
+// Chunks of random SNRs, between --min-snr and --max-snr dB, and of random
+// sizes, up to a 1500 bytes frame, are evaluated in the mode --mode by
+// the NistErrorRateModel and by a TabulatedErrorRateModel of it. The
+// fastest of several runs is reported for each, with the largest
+// difference of the tabulated success rates.
+//
+// ./waf --run "bench-error-rate-model --mode=OfdmRate6Mbps --chunks=10000000"
+
+#include "ns3/core-module.h"
+#include "ns3/wifi-module.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+using namespace ns3;
+
+static std::vector<double> g_snr;
+static std::vector<uint32_t> g_nbits;
+static std::vector<double> g_rates;
+
+static int64_t
+Run (Ptr<ErrorRateModel> model, WifiMode mode, uint64_t chunks)
+{
+  SystemWallClockMs clock;
+  clock.Start ();
+  for (uint64_t i = 0; i < chunks; i++)
+    {
+      uint32_t j = i % g_snr.size ();
+      g_rates[j] = model->GetChunkSuccessRate (mode, g_snr[j], g_nbits[j]);
+    }
+  return clock.End ();
+}
+
+static void
+Report (std::string kind, int64_t ms, uint64_t chunks, double error)
+{
+  std::cout << kind << "\t" << ms << "\t"
+            << (ms > 0 ? chunks * 1000.0 / ms : 0) << "\t" << error << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string modeName = "OfdmRate6Mbps";
+  double minSnrDb = -5.0;
+  double maxSnrDb = 30.0;
+  uint64_t chunks = 10000000;
+  uint32_t runs = 3;
+
+  CommandLine cmd;
+  cmd.AddValue ("mode", "Wi-Fi mode of the chunks", modeName);
+  cmd.AddValue ("min-snr", "Lowest SNR of the chunks (dB)", minSnrDb);
+  cmd.AddValue ("max-snr", "Highest SNR of the chunks (dB)", maxSnrDb);
+  cmd.AddValue ("chunks", "Number of chunks of each kind", chunks);
+  cmd.AddValue ("runs", "Number of runs of each kind", runs);
+  cmd.Parse (argc, argv);
+
+  WifiMode mode (modeName);
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  for (uint32_t i = 0; i < 65536; i++)
+    {
+      g_snr.push_back (std::pow (10.0, random->GetValue (minSnrDb, maxSnrDb) / 10.0));
+      g_nbits.push_back (random->GetInteger (1, 12000));
+    }
+  g_rates.resize (g_snr.size ());
+
+  Ptr<NistErrorRateModel> nist = CreateObject<NistErrorRateModel> ();
+  Ptr<TabulatedErrorRateModel> tabulated = CreateObject<TabulatedErrorRateModel> ();
+  SystemWallClockMs clock;
+  clock.Start ();
+  tabulated->Tabulate (mode);
+  std::cout << "tabulated " << mode << " in " << clock.End () << " ms" << std::endl;
+
+  double error = 0;
+  for (uint32_t i = 0; i < g_snr.size (); i++)
+    {
+      error = std::max (error, std::fabs (tabulated->GetChunkSuccessRate (mode, g_snr[i], g_nbits[i])
+                                          - nist->GetChunkSuccessRate (mode, g_snr[i], g_nbits[i])));
+    }
+
+  int64_t nistMs = Run (nist, mode, chunks);
+  int64_t tabulatedMs = Run (tabulated, mode, chunks);
+  for (uint32_t i = 1; i < runs; i++)
+    {
+      nistMs = std::min (nistMs, Run (nist, mode, chunks));
+      tabulatedMs = std::min (tabulatedMs, Run (tabulated, mode, chunks));
+    }
+  std::cout << "model\tms\tchunks/s\tmax error" << std::endl;
+  Report ("nist", nistMs, chunks, 0);
+  Report ("tabulated", tabulatedMs, chunks, error);
+  return 0;
+}
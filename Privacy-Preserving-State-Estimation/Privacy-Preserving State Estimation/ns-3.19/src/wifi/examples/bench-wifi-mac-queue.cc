@@ -0,0 +1,165 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Benchmark of the WifiMacQueue at a given depth.
+//
+// The queue is filled with --depth QoS data packets to --destinations
+// receivers, like the queue of a gateway which answers its meters, and
+// then kept at that depth while the packets are served:
+//  - fifo: a packet is enqueued and the head of the queue is dequeued;
+//  - by-tid-address: a packet is enqueued, the packets of a receiver are
+//    counted, and its first packet is peeked and dequeued, the way the
+//    EdcaTxopN and the BlockAckManager look up the queue.
+// The simulation time advances by --interval per packet, in steps of a
+// thousand packets, so that the packets expire when they stay more than
+// the MaxDelay of the queue. The fastest of several runs is reported for
+// each kind.
+//
+// ./waf --run "bench-wifi-mac-queue --depth=400 --ops=1000000"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/wifi-mac-queue.h"
+
+#include <algorithm>
+#include <iostream>
+
+using namespace ns3;
+
+static std::vector<Mac48Address> g_destinations;
+static Ptr<Packet> g_packet;
+static uint32_t g_next;
+
+static WifiMacHeader
+CreateHeader (uint32_t destination)
+{
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetQosTid (0);
+  hdr.SetAddr1 (g_destinations[destination]);
+  return hdr;
+}
+
+static Ptr<WifiMacQueue>
+CreateQueue (uint32_t depth)
+{
+  Ptr<WifiMacQueue> queue = CreateObject<WifiMacQueue> ();
+  queue->SetMaxSize (depth + 1);
+  for (uint32_t i = 0; i < depth; i++)
+    {
+      queue->Enqueue (g_packet, CreateHeader (g_next++ % g_destinations.size ()));
+    }
+  return queue;
+}
+
+static void
+Fifo (Ptr<WifiMacQueue> queue, uint64_t ops)
+{
+  WifiMacHeader hdr;
+  for (uint64_t i = 0; i < ops; i++)
+    {
+      queue->Enqueue (g_packet, CreateHeader (g_next++ % g_destinations.size ()));
+      queue->Dequeue (&hdr);
+    }
+}
+
+static void
+ByTidAndAddress (Ptr<WifiMacQueue> queue, uint64_t ops)
+{
+  WifiMacHeader hdr;
+  for (uint64_t i = 0; i < ops; i++)
+    {
+      Mac48Address destination = g_destinations[(i * 7) % g_destinations.size ()];
+      queue->Enqueue (g_packet, CreateHeader (g_next++ % g_destinations.size ()));
+      if (queue->GetNPacketsByTidAndAddress (0, WifiMacHeader::ADDR1, destination) > 0
+          && queue->PeekByTidAndAddress (&hdr, 0, WifiMacHeader::ADDR1, destination) != 0)
+        {
+          queue->DequeueByTidAndAddress (&hdr, 0, WifiMacHeader::ADDR1, destination);
+        }
+      else
+        {
+          queue->Dequeue (&hdr);
+        }
+    }
+}
+
+typedef void (*Workload)(Ptr<WifiMacQueue>, uint64_t);
+
+/// Run a workload in batches, between which the simulation time advances
+static int64_t
+Run (Workload workload, uint32_t depth, uint64_t ops, Time interval, uint32_t *size)
+{
+  Ptr<WifiMacQueue> queue = CreateQueue (depth);
+  uint64_t batch = 1000;
+  Time step = NanoSeconds (interval.GetNanoSeconds () * batch);
+  SystemWallClockMs clock;
+  clock.Start ();
+  for (uint64_t i = 0; i < ops; i += batch)
+    {
+      Simulator::Schedule (step, workload, queue, std::min (batch, ops - i));
+      Simulator::Run ();
+    }
+  int64_t ms = clock.End ();
+  *size = queue->GetSize ();
+  Simulator::Destroy ();
+  return ms;
+}
+
+static void
+Report (std::string kind, int64_t ms, uint64_t ops, uint32_t size)
+{
+  std::cout << kind << "\t" << ms << "\t"
+            << (ms > 0 ? ops * 1000.0 / ms : 0) << "\t" << size << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t depth = 400;
+  uint32_t destinations = 25;
+  uint64_t ops = 1000000;
+  Time interval = MicroSeconds (100);
+  uint32_t runs = 3;
+
+  CommandLine cmd;
+  cmd.AddValue ("depth", "Number of packets in the queue", depth);
+  cmd.AddValue ("destinations", "Number of receivers of the packets", destinations);
+  cmd.AddValue ("ops", "Number of packets served by each kind", ops);
+  cmd.AddValue ("interval", "Simulation time between two packets", interval);
+  cmd.AddValue ("runs", "Number of runs of each kind", runs);
+  cmd.Parse (argc, argv);
+
+  for (uint32_t i = 0; i < destinations; i++)
+    {
+      g_destinations.push_back (Mac48Address::Allocate ());
+    }
+  g_packet = Create<Packet> (100);
+
+  uint32_t fifoSize;
+  uint32_t byTidSize;
+  int64_t fifoMs = Run (&Fifo, depth, ops, interval, &fifoSize);
+  int64_t byTidMs = Run (&ByTidAndAddress, depth, ops, interval, &byTidSize);
+  for (uint32_t i = 1; i < runs; i++)
+    {
+      fifoMs = std::min (fifoMs, Run (&Fifo, depth, ops, interval, &fifoSize));
+      byTidMs = std::min (byTidMs, Run (&ByTidAndAddress, depth, ops, interval, &byTidSize));
+    }
+  std::cout << "kind\tms\tpackets/s\tfinal depth" << std::endl;
+  Report ("fifo", fifoMs, ops, fifoSize);
+  Report ("by-tid-address", byTidMs, ops, byTidSize);
+  return 0;
+}
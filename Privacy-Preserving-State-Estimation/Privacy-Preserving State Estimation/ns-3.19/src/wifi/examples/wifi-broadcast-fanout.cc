@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Benchmark of the fan-out of broadcast frames by YansWifiChannel.
+//
+// The nodes are laid out on a square grid, like meters in a mesh, and
+// each of them broadcasts the same number of frames. The program counts
+// the heap allocations made while the simulation runs and reports them
+// per broadcast frame, along with the number of PHYs which synchronized
+// on each frame and the number which received it successfully. Every
+// other PHY of the channel drops the frame as too weak.
+//
+// ./waf --run "wifi-broadcast-fanout --nodes=100 --spacing=50"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/wifi-module.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+using namespace ns3;
+
+static uint64_t g_allocations = 0;
+
+void *
+operator new (size_t size) throw (std::bad_alloc)
+{
+  g_allocations++;
+  void *p = std::malloc (size == 0 ? 1 : size);
+  if (p == 0)
+    {
+      throw std::bad_alloc ();
+    }
+  return p;
+}
+
+void
+operator delete (void *p) throw ()
+{
+  std::free (p);
+}
+
+static uint32_t g_tx = 0;
+static uint32_t g_rxBegin = 0;
+static uint32_t g_rxOk = 0;
+
+static void
+TxBegin (Ptr<const Packet> p)
+{
+  g_tx++;
+}
+
+static void
+RxBegin (Ptr<const Packet> p)
+{
+  g_rxBegin++;
+}
+
+static void
+RxEnd (Ptr<const Packet> p)
+{
+  g_rxOk++;
+}
+
+static void
+Broadcast (Ptr<NetDevice> device, uint32_t size)
+{
+  device->Send (Create<Packet> (size), device->GetBroadcast (), 0x88b5);
+}
+
+static void
+Run (uint32_t nNodes, double spacing, uint32_t frames, uint32_t size)
+{
+  NodeContainer nodes;
+  nodes.Create (nNodes);
+
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::GridPositionAllocator",
+                                 "DeltaX", DoubleValue (spacing),
+                                 "DeltaY", DoubleValue (spacing),
+                                 "GridWidth", UintegerValue (std::ceil (std::sqrt (nNodes))),
+                                 "LayoutType", StringValue ("RowFirst"));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+
+  WifiHelper wifi = WifiHelper::Default ();
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211a);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager",
+                                "DataMode", StringValue ("OfdmRate6Mbps"));
+  YansWifiPhyHelper phy = YansWifiPhyHelper::Default ();
+  YansWifiChannelHelper channel = YansWifiChannelHelper::Default ();
+  phy.SetChannel (channel.Create ());
+  NqosWifiMacHelper mac = NqosWifiMacHelper::Default ();
+  mac.SetType ("ns3::AdhocWifiMac");
+  NetDeviceContainer devices = wifi.Install (phy, mac, nodes);
+
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/Phy/PhyTxBegin", MakeCallback (&TxBegin));
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/Phy/PhyRxBegin", MakeCallback (&RxBegin));
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/Phy/PhyRxEnd", MakeCallback (&RxEnd));
+
+  // Space the frames of the nodes 2 ms apart so that few of them collide
+  for (uint32_t i = 0; i < frames; i++)
+    {
+      for (uint32_t j = 0; j < nNodes; j++)
+        {
+          Simulator::Schedule (Seconds (1.0 + (i * nNodes + j) * 0.002),
+                               &Broadcast, devices.Get (j), size);
+        }
+    }
+
+  g_tx = 0;
+  g_rxBegin = 0;
+  g_rxOk = 0;
+  uint64_t allocations = g_allocations;
+  Simulator::Run ();
+  allocations = g_allocations - allocations;
+  Simulator::Destroy ();
+
+  std::cout << nNodes << "\t" << g_tx << "\t"
+            << (g_tx ? double (g_rxBegin) / g_tx : 0) << "\t"
+            << (g_tx ? double (g_rxOk) / g_tx : 0) << "\t"
+            << (g_tx ? double (allocations) / g_tx : 0) << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t nNodes = 0;
+  double spacing = 50.0;
+  uint32_t frames = 20;
+  uint32_t size = 100;
+
+  CommandLine cmd;
+  cmd.AddValue ("nodes", "Number of nodes, zero for 25, 50, 75 and 100 in turn", nNodes);
+  cmd.AddValue ("spacing", "Distance between neighbour nodes of the grid (m)", spacing);
+  cmd.AddValue ("frames", "Number of frames broadcast by each node", frames);
+  cmd.AddValue ("size", "Size of the frames (bytes)", size);
+  cmd.Parse (argc, argv);
+
+  std::cout << "nodes\tframes\tsynchronized/frame\tdelivered/frame\tallocations/frame" << std::endl;
+  if (nNodes != 0)
+    {
+      Run (nNodes, spacing, frames, size);
+    }
+  else
+    {
+      for (nNodes = 25; nNodes <= 100; nNodes += 25)
+        {
+          Run (nNodes, spacing, frames, size);
+        }
+    }
+  return 0;
+}
@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// A grid of stationary wifi nodes which broadcast frames, run with the
+// default simulator and with the multithreaded one.
+//
+// The nodes are laid out on a square grid, like meters in a mesh, and
+// each of them broadcasts frames at random times. The frames received by
+// each node are counted by a trace sink of its own, so that the nodes of
+// different threads share no state. The lookahead of the multithreaded
+// simulator is the smallest propagation delay of the channel, which uses
+// its spatial index and static link budgets.
+//
+// The multithreaded simulator requires ns-3 to be configured with
+// --enable-multithreaded-simulator:
+//
+// ./waf --run "wifi-parallel-grid --nodes=400 --threads=4"
+//
+// With --threads=0, the default simulator is used.
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/wifi-module.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("WifiParallelGrid");
+
+static std::vector<uint32_t> g_received;
+
+static void
+RxEnd (uint32_t node, Ptr<const Packet> p)
+{
+  g_received[node]++;
+}
+
+static void
+Broadcast (Ptr<NetDevice> device, uint32_t size, Time interval, uint32_t remaining)
+{
+  device->Send (Create<Packet> (size), device->GetBroadcast (), 0x88b5);
+  if (remaining > 1)
+    {
+      Simulator::Schedule (interval, &Broadcast, device, size, interval, remaining - 1);
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t nNodes = 400;
+  double spacing = 50.0;
+  uint32_t frames = 50;
+  uint32_t size = 100;
+  uint32_t threads = 4;
+
+  CommandLine cmd;
+  cmd.AddValue ("nodes", "Number of nodes", nNodes);
+  cmd.AddValue ("spacing", "Distance between neighbour nodes of the grid (m)", spacing);
+  cmd.AddValue ("frames", "Number of frames broadcast by each node", frames);
+  cmd.AddValue ("size", "Size of the frames (bytes)", size);
+  cmd.AddValue ("threads", "Threads of the multithreaded simulator, zero for the default simulator", threads);
+  cmd.Parse (argc, argv);
+
+  // The simulator must be chosen before the first event is scheduled,
+  // which the creation of the nodes does
+  if (threads != 0)
+    {
+      TypeId tid;
+      if (!TypeId::LookupByNameFailSafe ("ns3::MultithreadedSimulatorImpl", &tid))
+        {
+          NS_FATAL_ERROR ("ns-3 was not configured with --enable-multithreaded-simulator");
+        }
+      ObjectFactory factory;
+      factory.SetTypeId (tid);
+      factory.Set ("MaxThreads", UintegerValue (threads));
+      Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+    }
+
+  NodeContainer nodes;
+  nodes.Create (nNodes);
+
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::GridPositionAllocator",
+                                 "DeltaX", DoubleValue (spacing),
+                                 "DeltaY", DoubleValue (spacing),
+                                 "GridWidth", UintegerValue (std::ceil (std::sqrt (nNodes))),
+                                 "LayoutType", StringValue ("RowFirst"));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+
+  WifiHelper wifi = WifiHelper::Default ();
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211a);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager",
+                                "DataMode", StringValue ("OfdmRate6Mbps"));
+  YansWifiPhyHelper phy = YansWifiPhyHelper::Default ();
+  YansWifiChannelHelper channelHelper = YansWifiChannelHelper::Default ();
+  Ptr<YansWifiChannel> channel = channelHelper.Create ();
+  channel->SetAttribute ("SpatialIndex", BooleanValue (true));
+  channel->SetAttribute ("StaticLinkBudget", BooleanValue (true));
+  phy.SetChannel (channel);
+  NqosWifiMacHelper mac = NqosWifiMacHelper::Default ();
+  mac.SetType ("ns3::AdhocWifiMac");
+  NetDeviceContainer devices = wifi.Install (phy, mac, nodes);
+
+  g_received.assign (nNodes, 0);
+  Ptr<UniformRandomVariable> start = CreateObject<UniformRandomVariable> ();
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      Ptr<WifiNetDevice> device = DynamicCast<WifiNetDevice> (devices.Get (i));
+      device->GetPhy ()->TraceConnectWithoutContext ("PhyRxEnd", MakeBoundCallback (&RxEnd, i));
+      // Events of a node must carry its context to run in its partition
+      Simulator::ScheduleWithContext (nodes.Get (i)->GetId (), Seconds (1.0 + start->GetValue (0.0, 0.1)),
+                                      &Broadcast, devices.Get (i), size, MilliSeconds (100), frames);
+    }
+
+  if (threads != 0)
+    {
+      Simulator::GetImplementation ()->SetAttribute ("Lookahead", TimeValue (channel->GetMinimumDelay ()));
+      NS_LOG_INFO ("lookahead " << channel->GetMinimumDelay ());
+    }
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  Simulator::Destroy ();
+
+  uint64_t received = 0;
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      received += g_received[i];
+    }
+  std::cout << "threads\tms\treceived/frame" << std::endl;
+  std::cout << threads << "\t" << ms << "\t" << double (received) / (nNodes * frames) << std::endl;
+  return 0;
+}
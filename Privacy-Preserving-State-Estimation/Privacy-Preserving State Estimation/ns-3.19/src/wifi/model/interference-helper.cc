@@ -236,20 +236,24 @@ InterferenceHelper::CalculateSnr (double signal, double noiseInterference, WifiM
 }
 
 double
-InterferenceHelper::CalculateNoiseInterferenceW (Ptr<InterferenceHelper::Event> event, NiChanges *ni) const
+InterferenceHelper::CalculateNoiseInterferenceW (Ptr<InterferenceHelper::Event> event, NiChanges::const_iterator *end) const
 {
   double noiseInterference = m_firstPower;
   NS_ASSERT (m_rxing);
-  for (NiChanges::const_iterator i = m_niChanges.begin () + 1; i != m_niChanges.end (); i++)
+  // The changes are sorted by time, and the end of the event is the first
+  // change of its power at its end time
+  NiChanges::const_iterator i = std::lower_bound (m_niChanges.begin () + 1, m_niChanges.end (),
+                                                  NiChange (event->GetEndTime (), 0));
+  while (i != m_niChanges.end () && i->GetTime () == event->GetEndTime ()
+         && event->GetRxPowerW () != -i->GetDelta ())
     {
-      if ((event->GetEndTime () == i->GetTime ()) && event->GetRxPowerW () == -i->GetDelta ())
-        {
-          break;
-        }
-      ni->push_back (*i);
+      i++;
+    }
+  if (i != m_niChanges.end () && i->GetTime () != event->GetEndTime ())
+    {
+      i = m_niChanges.end ();
     }
-  ni->insert (ni->begin (), NiChange (event->GetStartTime (), noiseInterference));
-  ni->push_back (NiChange (event->GetEndTime (), 0));
+  *end = i;
   return noiseInterference;
 }
 
@@ -267,11 +271,12 @@ InterferenceHelper::CalculateChunkSuccessRate (double snir, Time duration, WifiM
 }
 
 double
-InterferenceHelper::CalculatePer (Ptr<const InterferenceHelper::Event> event, NiChanges *ni) const
+InterferenceHelper::CalculatePer (Ptr<const InterferenceHelper::Event> event, double noiseInterferenceW,
+                                  NiChanges::const_iterator begin, NiChanges::const_iterator end) const
 {
   double psr = 1.0; /* Packet Success Rate */
-  NiChanges::iterator j = ni->begin ();
-  Time previous = (*j).GetTime ();
+  NiChanges::const_iterator j = begin;
+  Time previous = event->GetStartTime ();
   WifiMode payloadMode = event->GetPayloadMode ();
   WifiPreamble preamble = event->GetPreambleType ();
  WifiMode MfHeaderMode ;
@@ -281,16 +286,15 @@ InterferenceHelper::CalculatePer (Ptr<const InterferenceHelper::Event> event, Ni
 
    }
   WifiMode headerMode = WifiPhy::GetPlcpHeaderMode (payloadMode, preamble);
-  Time plcpHeaderStart = (*j).GetTime () + MicroSeconds (WifiPhy::GetPlcpPreambleDurationMicroSeconds (payloadMode, preamble)); //packet start time+ preamble
+  Time plcpHeaderStart = previous + MicroSeconds (WifiPhy::GetPlcpPreambleDurationMicroSeconds (payloadMode, preamble)); //packet start time+ preamble
   Time plcpHsigHeaderStart=plcpHeaderStart+ MicroSeconds (WifiPhy::GetPlcpHeaderDurationMicroSeconds (payloadMode, preamble));//packet start time+ preamble+L SIG
   Time plcpHtTrainingSymbolsStart = plcpHsigHeaderStart + MicroSeconds (WifiPhy::GetPlcpHtSigHeaderDurationMicroSeconds (payloadMode, preamble));//packet start time+ preamble+L SIG+HT SIG
   Time plcpPayloadStart =plcpHtTrainingSymbolsStart + MicroSeconds (WifiPhy::GetPlcpHtTrainingSymbolDurationMicroSeconds (payloadMode, preamble,event->GetTxVector())); //packet start time+ preamble+L SIG+HT SIG+Training
-  double noiseInterferenceW = (*j).GetDelta ();
   double powerW = event->GetRxPowerW ();
-    j++;
-  while (ni->end () != j)
+  while (true)
     {
-      Time current = (*j).GetTime ();
+      // The last chunk ends with the event
+      Time current = j != end ? (*j).GetTime () : event->GetEndTime ();
       NS_ASSERT (current >= previous);
       //Case 1: Both prev and curr point to the payload
       if (previous >= plcpPayloadStart)
@@ -528,6 +532,10 @@ InterferenceHelper::CalculatePer (Ptr<const InterferenceHelper::Event> event, Ni
             }
         }
 
+      if (j == end)
+        {
+          break;
+        }
       noiseInterferenceW += (*j).GetDelta ();
       previous = (*j).GetTime ();
       j++;
@@ -541,16 +549,17 @@ InterferenceHelper::CalculatePer (Ptr<const InterferenceHelper::Event> event, Ni
 struct InterferenceHelper::SnrPer
 InterferenceHelper::CalculateSnrPer (Ptr<InterferenceHelper::Event> event)
 {
-  NiChanges ni;
-  double noiseInterferenceW = CalculateNoiseInterferenceW (event, &ni);
+  NiChanges::const_iterator end;
+  double noiseInterferenceW = CalculateNoiseInterferenceW (event, &end);
   double snr = CalculateSnr (event->GetRxPowerW (),
                              noiseInterferenceW,
                              event->GetPayloadMode ());
 
   /* calculate the SNIR at the start of the packet and accumulate
-   * all SNIR changes in the snir vector.
+   * the SNIR changes from the start of the packet, which is the
+   * first change, up to its end.
    */
-  double per = CalculatePer (event, &ni);
+  double per = CalculatePer (event, noiseInterferenceW, m_niChanges.begin () + 1, end);
 
   struct SnrPer snrPer;
   snrPer.snr = snr;
@@ -585,5 +594,14 @@ void
 InterferenceHelper::NotifyRxEnd ()
 {
   m_rxing = false;
+  // The changes before now are only needed for their power, which is
+  // added to the first power in the order GetEnergyDuration adds them
+  NiChanges::iterator nowIterator = std::lower_bound (m_niChanges.begin (), m_niChanges.end (),
+                                                      NiChange (Simulator::Now (), 0));
+  for (NiChanges::iterator i = m_niChanges.begin (); i != nowIterator; i++)
+    {
+      m_firstPower += i->GetDelta ();
+    }
+  m_niChanges.erase (m_niChanges.begin (), nowIterator);
 }
 } // namespace ns3
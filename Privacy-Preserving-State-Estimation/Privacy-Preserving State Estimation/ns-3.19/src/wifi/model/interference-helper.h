@@ -21,7 +21,7 @@
 #define INTERFERENCE_HELPER_H
 
 #include <stdint.h>
-#include <vector>
+#include <deque>
 #include <list>
 #include "wifi-mode.h"
 #include "wifi-preamble.h"
@@ -239,9 +239,10 @@ private:
     double m_delta;
   };
   /**
-   * typedef for a vector of NiChanges
+   * typedef for a deque of NiChanges, sorted by time, which is pruned
+   * from its front as the changes pass
    */
-  typedef std::vector <NiChange> NiChanges;
+  typedef std::deque <NiChange> NiChanges;
   /**
    * typedef for a list of Events
    */
@@ -256,13 +257,15 @@ private:
    */
   void AppendEvent (Ptr<Event> event);
   /**
-   * Calculate noise and interference power in W.
+   * Calculate noise and interference power in W at the start of the
+   * event being received, and find the changes during the event.
    *
    * \param event
-   * \param ni
+   * \param end the change of the end of the event, which follows the
+   *        changes during the event
    * \return noise and interference power
    */
-  double CalculateNoiseInterferenceW (Ptr<Event> event, NiChanges *ni) const;
+  double CalculateNoiseInterferenceW (Ptr<Event> event, NiChanges::const_iterator *end) const;
   /**
    * Calculate SNR (linear ratio) from the given signal power and noise+interference power.
    * (Mode is not currently used)
@@ -288,10 +291,13 @@ private:
    * multiple chunks (e.g. due to interference from other transmissions).
    *
    * \param event
-   * \param ni
+   * \param noiseInterferenceW noise and interference power at the start of the event
+   * \param begin the first change after the start of the event
+   * \param end the change of the end of the event
    * \return the error rate of the packet
    */
-  double CalculatePer (Ptr<const Event> event, NiChanges *ni) const;
+  double CalculatePer (Ptr<const Event> event, double noiseInterferenceW,
+                       NiChanges::const_iterator begin, NiChanges::const_iterator end) const;
 
   double m_noiseFigure; /**< noise figure (linear) */
   Ptr<ErrorRateModel> m_errorRateModel;
@@ -0,0 +1,444 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include "tabulated-error-rate-model.h"
+#include "nist-error-rate-model.h"
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/double.h"
+#include "ns3/string.h"
+#include "ns3/pointer.h"
+
+NS_LOG_COMPONENT_DEFINE ("TabulatedErrorRateModel");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (TabulatedErrorRateModel)
+  ;
+
+namespace {
+
+/// ln (-ln (s)) of a bit which is always received: exp (-800) is 0
+const double LOG_FAILURE_MIN = -800.0;
+/// ln (-ln (s)) of a bit which is never received: exp (-exp (7)) is 0
+const double LOG_FAILURE_MAX = 7.0;
+/// ln (-ln (s)) of a bit received half of the time: below it, the
+/// success rates are interpolated rather than their ln (-ln (s)), which
+/// is too steep where the models reach no success
+const double LOG_FAILURE_SPLIT = -0.36651292058166435;
+/// The first bytes of the table files
+const char FILE_MAGIC[8] = { 'n', 's', '3', 't', 'e', 'r', 'm', '1' };
+
+template <typename T>
+void
+Write (std::ofstream &os, const T &value)
+{
+  os.write (reinterpret_cast<const char *> (&value), sizeof (value));
+}
+
+template <typename T>
+bool
+Read (std::ifstream &is, T &value)
+{
+  is.read (reinterpret_cast<char *> (&value), sizeof (value));
+  return is.good ();
+}
+
+void
+WriteString (std::ofstream &os, const std::string &value)
+{
+  Write (os, static_cast<uint32_t> (value.size ()));
+  os.write (value.data (), value.size ());
+}
+
+bool
+ReadString (std::ifstream &is, std::string &value)
+{
+  uint32_t size;
+  if (!Read (is, size) || size > 1024)
+    {
+      return false;
+    }
+  value.resize (size);
+  if (size > 0)
+    {
+      is.read (&value[0], size);
+    }
+  return is.good ();
+}
+
+} // anonymous namespace
+
+TypeId
+TabulatedErrorRateModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::TabulatedErrorRateModel")
+    .SetParent<ErrorRateModel> ()
+    .AddConstructor<TabulatedErrorRateModel> ()
+    .AddAttribute ("ErrorRateModel",
+                   "The error rate model which is tabulated, a NistErrorRateModel if null.",
+                   PointerValue (),
+                   MakePointerAccessor (&TabulatedErrorRateModel::SetErrorRateModel,
+                                        &TabulatedErrorRateModel::GetErrorRateModel),
+                   MakePointerChecker<ErrorRateModel> ())
+    .AddAttribute ("MinSnr",
+                   "The SNR of the first point of the grid (dB).",
+                   DoubleValue (-20.0),
+                   MakeDoubleAccessor (&TabulatedErrorRateModel::SetMinSnr,
+                                       &TabulatedErrorRateModel::GetMinSnr),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("MaxSnr",
+                   "The SNR of the last point of the grid (dB).",
+                   DoubleValue (50.0),
+                   MakeDoubleAccessor (&TabulatedErrorRateModel::SetMaxSnr,
+                                       &TabulatedErrorRateModel::GetMaxSnr),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("Step",
+                   "The SNR between two points of the grid (dB).",
+                   DoubleValue (0.02),
+                   MakeDoubleAccessor (&TabulatedErrorRateModel::SetStep,
+                                       &TabulatedErrorRateModel::GetStep),
+                   MakeDoubleChecker<double> (0.0001))
+    .AddAttribute ("TableFile",
+                   "The file the tables are loaded from at the first chunk, if any. "
+                   "The file is written by TabulatedErrorRateModel::Save.",
+                   StringValue (""),
+                   MakeStringAccessor (&TabulatedErrorRateModel::SetTableFile,
+                                       &TabulatedErrorRateModel::GetTableFile),
+                   MakeStringChecker ())
+  ;
+  return tid;
+}
+
+TabulatedErrorRateModel::TabulatedErrorRateModel ()
+  : m_model (CreateObject<NistErrorRateModel> ()),
+    m_setup (false),
+    m_minLnSnr (0),
+    m_pointsPerLnSnr (0),
+    m_nPoints (0)
+{
+}
+
+TabulatedErrorRateModel::~TabulatedErrorRateModel ()
+{
+}
+
+void
+TabulatedErrorRateModel::DoDispose (void)
+{
+  m_model = 0;
+  m_tables.clear ();
+  m_loaded.clear ();
+  ErrorRateModel::DoDispose ();
+}
+
+void
+TabulatedErrorRateModel::SetErrorRateModel (Ptr<ErrorRateModel> model)
+{
+  if (model == 0)
+    {
+      model = CreateObject<NistErrorRateModel> ();
+    }
+  m_model = model;
+  Reset ();
+}
+
+Ptr<ErrorRateModel>
+TabulatedErrorRateModel::GetErrorRateModel (void) const
+{
+  return m_model;
+}
+
+void
+TabulatedErrorRateModel::SetMinSnr (double snrDb)
+{
+  m_minSnrDb = snrDb;
+  Reset ();
+}
+
+double
+TabulatedErrorRateModel::GetMinSnr (void) const
+{
+  return m_minSnrDb;
+}
+
+void
+TabulatedErrorRateModel::SetMaxSnr (double snrDb)
+{
+  m_maxSnrDb = snrDb;
+  Reset ();
+}
+
+double
+TabulatedErrorRateModel::GetMaxSnr (void) const
+{
+  return m_maxSnrDb;
+}
+
+void
+TabulatedErrorRateModel::SetStep (double stepDb)
+{
+  m_stepDb = stepDb;
+  Reset ();
+}
+
+double
+TabulatedErrorRateModel::GetStep (void) const
+{
+  return m_stepDb;
+}
+
+void
+TabulatedErrorRateModel::SetTableFile (std::string filename)
+{
+  m_tableFile = filename;
+  Reset ();
+}
+
+std::string
+TabulatedErrorRateModel::GetTableFile (void) const
+{
+  return m_tableFile;
+}
+
+void
+TabulatedErrorRateModel::Reset (void)
+{
+  if (m_setup)
+    {
+      NS_LOG_DEBUG ("Drop the tables of " << m_tables.size () << " modes");
+    }
+  m_tables.clear ();
+  m_loaded.clear ();
+  m_setup = false;
+}
+
+void
+TabulatedErrorRateModel::Setup (void) const
+{
+  if (m_setup)
+    {
+      return;
+    }
+  if (m_maxSnrDb <= m_minSnrDb)
+    {
+      NS_FATAL_ERROR ("MaxSnr " << m_maxSnrDb << " dB is not above MinSnr " << m_minSnrDb << " dB");
+    }
+  m_setup = true;
+  m_minLnSnr = m_minSnrDb / 10.0 * std::log (10.0);
+  m_pointsPerLnSnr = 10.0 / std::log (10.0) / m_stepDb;
+  m_nPoints = static_cast<uint32_t> ((m_maxSnrDb - m_minSnrDb) / m_stepDb + 0.5) + 1;
+  if (!m_tableFile.empty ())
+    {
+      DoLoad (m_tableFile);
+    }
+}
+
+const TabulatedErrorRateModel::Table &
+TabulatedErrorRateModel::GetTable (WifiMode mode) const
+{
+  Setup ();
+  uint32_t uid = mode.GetUid ();
+  if (uid >= m_tables.size ())
+    {
+      m_tables.resize (uid + 1);
+    }
+  Table &table = m_tables[uid];
+  if (!table.logFailure.empty ())
+    {
+      return table;
+    }
+  table.mode = mode.GetUniqueName ();
+  std::map<std::string, std::vector<double> >::iterator loaded = m_loaded.find (table.mode);
+  if (loaded != m_loaded.end ())
+    {
+      NS_LOG_DEBUG ("Mode " << table.mode << " loaded from " << m_tableFile);
+      table.logFailure.swap (loaded->second);
+      m_loaded.erase (loaded);
+      return table;
+    }
+  NS_LOG_DEBUG ("Tabulate mode " << table.mode << " on " << m_nPoints << " points");
+  table.logFailure.resize (m_nPoints);
+  for (uint32_t i = 0; i < m_nPoints; i++)
+    {
+      double snr = std::pow (10.0, (m_minSnrDb + i * m_stepDb) / 10.0);
+      double success = m_model->GetChunkSuccessRate (mode, snr, 1);
+      double logFailure = LOG_FAILURE_MIN;
+      if (success <= 0)
+        {
+          logFailure = LOG_FAILURE_MAX;
+        }
+      else if (success < 1)
+        {
+          logFailure = std::max (LOG_FAILURE_MIN, std::min (std::log (-std::log (success)), LOG_FAILURE_MAX));
+        }
+      table.logFailure[i] = logFailure;
+    }
+  return table;
+}
+
+void
+TabulatedErrorRateModel::Tabulate (WifiMode mode) const
+{
+  GetTable (mode);
+}
+
+double
+TabulatedErrorRateModel::GetChunkSuccessRate (WifiMode mode, double snr, uint32_t nbits) const
+{
+  const std::vector<double> &logFailure = GetTable (mode).logFailure;
+  double last = m_nPoints - 1;
+  // NaN for a negative SNR, which the model evaluates below
+  double position = (std::log (snr) - m_minLnSnr) * m_pointsPerLnSnr;
+  if (position >= 0 && position < last)
+    {
+      uint32_t point = static_cast<uint32_t> (position);
+      double lower = logFailure[point];
+      double upper = logFailure[point + 1];
+      if (lower > LOG_FAILURE_MIN && lower < LOG_FAILURE_MAX
+          && upper > LOG_FAILURE_MIN && upper < LOG_FAILURE_MAX)
+        {
+          double weight = position - point;
+          if (lower < LOG_FAILURE_SPLIT && upper < LOG_FAILURE_SPLIT)
+            {
+              double y = lower + weight * (upper - lower);
+              return std::exp (-static_cast<double> (nbits) * std::exp (y));
+            }
+          double lowerSuccess = std::exp (-std::exp (lower));
+          double upperSuccess = std::exp (-std::exp (upper));
+          double success = lowerSuccess + weight * (upperSuccess - lowerSuccess);
+          return std::pow (success, static_cast<double> (nbits));
+        }
+      if (lower == upper)
+        {
+          return lower == LOG_FAILURE_MIN || nbits == 0 ? 1.0 : 0.0;
+        }
+      // The model steps into or out of the bounds of the table, which
+      // cannot be interpolated
+    }
+  else if (position >= last && logFailure.back () == LOG_FAILURE_MIN)
+    {
+      return 1.0;
+    }
+  return m_model->GetChunkSuccessRate (mode, snr, nbits);
+}
+
+bool
+TabulatedErrorRateModel::Save (std::string filename) const
+{
+  NS_LOG_FUNCTION (this << filename);
+  Setup ();
+  std::ofstream os (filename.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!os.is_open ())
+    {
+      NS_LOG_WARN ("Cannot write the tables to " << filename);
+      return false;
+    }
+  uint32_t nTables = m_loaded.size ();
+  for (std::vector<Table>::const_iterator i = m_tables.begin (); i != m_tables.end (); ++i)
+    {
+      nTables += i->logFailure.empty () ? 0 : 1;
+    }
+  os.write (FILE_MAGIC, sizeof (FILE_MAGIC));
+  WriteString (os, m_model->GetInstanceTypeId ().GetName ());
+  Write (os, m_minSnrDb);
+  Write (os, m_stepDb);
+  Write (os, m_nPoints);
+  Write (os, nTables);
+  for (std::vector<Table>::const_iterator i = m_tables.begin (); i != m_tables.end (); ++i)
+    {
+      if (!i->logFailure.empty ())
+        {
+          WriteString (os, i->mode);
+          os.write (reinterpret_cast<const char *> (&i->logFailure[0]), m_nPoints * sizeof (double));
+        }
+    }
+  for (std::map<std::string, std::vector<double> >::const_iterator i = m_loaded.begin (); i != m_loaded.end (); ++i)
+    {
+      WriteString (os, i->first);
+      os.write (reinterpret_cast<const char *> (&i->second[0]), m_nPoints * sizeof (double));
+    }
+  return os.good ();
+}
+
+bool
+TabulatedErrorRateModel::Load (std::string filename)
+{
+  NS_LOG_FUNCTION (this << filename);
+  Setup ();
+  return DoLoad (filename);
+}
+
+bool
+TabulatedErrorRateModel::DoLoad (std::string filename) const
+{
+  std::ifstream is (filename.c_str (), std::ios::in | std::ios::binary);
+  if (!is.is_open ())
+    {
+      NS_LOG_WARN ("Cannot read the tables from " << filename);
+      return false;
+    }
+  char magic[sizeof (FILE_MAGIC)];
+  std::string model;
+  double minSnrDb;
+  double stepDb;
+  uint32_t nPoints;
+  uint32_t nTables;
+  is.read (magic, sizeof (magic));
+  if (!is.good () || std::memcmp (magic, FILE_MAGIC, sizeof (magic)) != 0
+      || !ReadString (is, model) || !Read (is, minSnrDb) || !Read (is, stepDb)
+      || !Read (is, nPoints) || !Read (is, nTables))
+    {
+      NS_LOG_WARN (filename << " is not a table file");
+      return false;
+    }
+  if (model != m_model->GetInstanceTypeId ().GetName ()
+      || minSnrDb != m_minSnrDb || stepDb != m_stepDb || nPoints != m_nPoints)
+    {
+      NS_LOG_WARN ("The tables of " << filename << " are for another model or another grid");
+      return false;
+    }
+  std::map<std::string, std::vector<double> > loaded;
+  for (uint32_t i = 0; i < nTables; i++)
+    {
+      std::string mode;
+      std::vector<double> logFailure (m_nPoints);
+      if (!ReadString (is, mode))
+        {
+          NS_LOG_WARN (filename << " is truncated");
+          return false;
+        }
+      is.read (reinterpret_cast<char *> (&logFailure[0]), m_nPoints * sizeof (double));
+      if (!is.good ())
+        {
+          NS_LOG_WARN (filename << " is truncated");
+          return false;
+        }
+      loaded[mode].swap (logFailure);
+    }
+  for (std::vector<Table>::const_iterator i = m_tables.begin (); i != m_tables.end (); ++i)
+    {
+      loaded.erase (i->mode);
+    }
+  m_loaded.insert (loaded.begin (), loaded.end ());
+  NS_LOG_DEBUG (loaded.size () << " tables loaded from " << filename);
+  return true;
+}
+
+} // namespace ns3
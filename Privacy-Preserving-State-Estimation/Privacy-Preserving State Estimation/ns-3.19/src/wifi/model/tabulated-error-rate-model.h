@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef TABULATED_ERROR_RATE_MODEL_H
+#define TABULATED_ERROR_RATE_MODEL_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <map>
+#include "wifi-mode.h"
+#include "error-rate-model.h"
+#include "ns3/ptr.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * An error rate model which looks up the chunk success rates of another
+ * error rate model, the NistErrorRateModel by default, in tables.
+ *
+ * The error rate models of Wi-Fi receive each bit of a chunk
+ * independently, so that the success rate of a chunk of n bits is that
+ * of one bit to the power n. For each mode, the table holds
+ * ln (-ln (s)), where s is the success rate of one bit, on a grid of
+ * SNRs evenly spaced in dB, which is tabulated at the first chunk of
+ * the mode or by Tabulate. A chunk is then evaluated with a linear
+ * interpolation in the table, rather than with the erfc and the
+ * polynomials of the model. Where a bit is lost more than half of the
+ * time, the success rates of a bit are interpolated instead, as the
+ * models reach no success too steeply for their ln (-ln (s)).
+ *
+ * The chunks below the grid are evaluated by the model. The chunks above
+ * it are received when the last point of the grid has no error left,
+ * and are evaluated by the model otherwise.
+ *
+ * The grid is set up by the attributes at the first chunk. Setting
+ * MinSnr, MaxSnr, Step or TableFile afterwards drops the tables, which
+ * are then tabulated, or loaded, again on the new grid.
+ *
+ * With the default grid, the chunk success rates differ from those of
+ * the NistErrorRateModel and the YansErrorRateModel by less than 1e-3,
+ * and by less than 1e-4 for chunks of more than a few bits, except
+ * around the steps of the CCK modes of the DsssErrorRateModel when it is
+ * built without GSL.
+ */
+class TabulatedErrorRateModel : public ErrorRateModel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  TabulatedErrorRateModel ();
+  virtual ~TabulatedErrorRateModel ();
+
+  /**
+   * \param model the error rate model to tabulate, or null for a
+   * NistErrorRateModel
+   *
+   * The tables of the previous model are dropped.
+   */
+  void SetErrorRateModel (Ptr<ErrorRateModel> model);
+  /**
+   * \return the error rate model which is tabulated
+   */
+  Ptr<ErrorRateModel> GetErrorRateModel (void) const;
+
+  virtual double GetChunkSuccessRate (WifiMode mode, double snr, uint32_t nbits) const;
+
+  /**
+   * Tabulate a mode now, rather than at its first chunk.
+   *
+   * \param mode the Wi-Fi mode
+   */
+  void Tabulate (WifiMode mode) const;
+  /**
+   * Save the tables of the modes tabulated so far, in the byte order of
+   * this host.
+   *
+   * \param filename the name of the file
+   * \return true if the file is written
+   */
+  bool Save (std::string filename) const;
+  /**
+   * Load the tables saved by a model with the same grid and the same
+   * type of tabulated model. The modes which are not in the file are
+   * still tabulated at their first chunk.
+   *
+   * \param filename the name of the file
+   * \return true if the tables are loaded
+   */
+  bool Load (std::string filename);
+
+private:
+  virtual void DoDispose (void);
+
+  /// The table of a mode, empty until the mode is tabulated
+  struct Table
+  {
+    std::string mode;
+    std::vector<double> logFailure;
+  };
+
+  void SetMinSnr (double snrDb);
+  double GetMinSnr (void) const;
+  void SetMaxSnr (double snrDb);
+  double GetMaxSnr (void) const;
+  void SetStep (double stepDb);
+  double GetStep (void) const;
+  void SetTableFile (std::string filename);
+  std::string GetTableFile (void) const;
+  /// Drop the tables and the grid, set up again at the next chunk
+  void Reset (void);
+  /// Set up the grid from the attributes, and load the TableFile
+  void Setup (void) const;
+  bool DoLoad (std::string filename) const;
+  const Table & GetTable (WifiMode mode) const;
+
+  Ptr<ErrorRateModel> m_model;
+  double m_minSnrDb;
+  double m_maxSnrDb;
+  double m_stepDb;
+  std::string m_tableFile;
+  mutable bool m_setup;
+  /// ln of the SNR of the first point of the grid
+  mutable double m_minLnSnr;
+  /// Points of the grid per unit of ln of the SNR
+  mutable double m_pointsPerLnSnr;
+  mutable uint32_t m_nPoints;
+  /// The tables, indexed by the uid of their mode
+  mutable std::vector<Table> m_tables;
+  /// The tables of the loaded file, until their mode is first used
+  mutable std::map<std::string, std::vector<double> > m_loaded;
+};
+
+} // namespace ns3
+
+#endif /* TABULATED_ERROR_RATE_MODEL_H */
@@ -23,6 +23,7 @@
 #include "ns3/simulator.h"
 #include "ns3/packet.h"
 #include "ns3/uinteger.h"
+#include <algorithm>
 
 #include "wifi-mac-queue.h"
 #include "qos-blocked-destinations.h"
@@ -34,10 +35,12 @@ NS_OBJECT_ENSURE_REGISTERED (WifiMacQueue)
 
 WifiMacQueue::Item::Item (Ptr<const Packet> packet,
                           const WifiMacHeader &hdr,
-                          Time tstamp)
+                          Time tstamp,
+                          uint64_t arrival)
   : packet (packet),
     hdr (hdr),
-    tstamp (tstamp)
+    tstamp (tstamp),
+    arrival (arrival)
 {
 }
 
@@ -60,7 +63,9 @@ WifiMacQueue::GetTypeId (void)
 }
 
 WifiMacQueue::WifiMacQueue ()
-  : m_size (0)
+  : m_first (0),
+    m_nextArrival (0),
+    m_size (0)
 {
 }
 
@@ -101,34 +106,151 @@ WifiMacQueue::Enqueue (Ptr<const Packet> packet, const WifiMacHeader &hdr)
     {
       return;
     }
+  Insert (packet, hdr, false);
+}
+
+void
+WifiMacQueue::Insert (Ptr<const Packet> packet, const WifiMacHeader &hdr, bool front)
+{
   Time now = Simulator::Now ();
-  m_queue.push_back (Item (packet, hdr, now));
+  uint64_t seq;
+  if (front)
+    {
+      m_queue.push_front (Item (packet, hdr, now, m_nextArrival));
+      seq = --m_first;
+    }
+  else
+    {
+      seq = m_first + m_queue.size ();
+      m_queue.push_back (Item (packet, hdr, now, m_nextArrival));
+    }
+  // The timestamps grow with the arrivals, wherever the packets are
+  m_arrivals.push_back (std::make_pair (seq, m_nextArrival));
+  m_nextArrival++;
+  if (hdr.IsQosData ())
+    {
+      std::deque<uint64_t> &seqs = m_tidAddress[TidAddress (hdr.GetQosTid (), hdr.GetAddr1 ())];
+      if (front)
+        {
+          seqs.push_front (seq);
+        }
+      else
+        {
+          seqs.push_back (seq);
+        }
+    }
   m_size++;
 }
 
+struct WifiMacQueue::Item *
+WifiMacQueue::GetItem (uint64_t seq)
+{
+  uint64_t index = seq - m_first;
+  if (index >= m_queue.size () || m_queue[index].packet == 0)
+    {
+      return 0;
+    }
+  return &m_queue[index];
+}
+
+void
+WifiMacQueue::Erase (uint64_t seq)
+{
+  struct Item *item = GetItem (seq);
+  NS_ASSERT (item != 0);
+  if (item->hdr.IsQosData ())
+    {
+      TidAddressIndex::iterator it = m_tidAddress.find (TidAddress (item->hdr.GetQosTid (), item->hdr.GetAddr1 ()));
+      NS_ASSERT (it != m_tidAddress.end ());
+      std::deque<uint64_t> &seqs = it->second;
+      if (seqs.front () == seq)
+        {
+          seqs.pop_front ();
+        }
+      else
+        {
+          seqs.erase (std::find (seqs.begin (), seqs.end (), seq));
+        }
+    }
+  item->packet = 0;
+  m_size--;
+  while (!m_queue.empty () && m_queue.front ().packet == 0)
+    {
+      m_queue.pop_front ();
+      m_first++;
+    }
+  while (!m_queue.empty () && m_queue.back ().packet == 0)
+    {
+      m_queue.pop_back ();
+    }
+  if (m_queue.size () + m_arrivals.size () > 4 * m_size + 64)
+    {
+      Compact ();
+    }
+}
+
+void
+WifiMacQueue::Compact (void)
+{
+  std::vector<uint64_t> seqs (m_queue.size ());
+  PacketQueue queue;
+  for (uint32_t i = 0; i < m_queue.size (); i++)
+    {
+      if (m_queue[i].packet != 0)
+        {
+          seqs[i] = queue.size ();
+          queue.push_back (m_queue[i]);
+        }
+    }
+  std::deque<std::pair<uint64_t, uint64_t> > arrivals;
+  for (uint32_t i = 0; i < m_arrivals.size (); i++)
+    {
+      struct Item *item = GetItem (m_arrivals[i].first);
+      if (item != 0 && item->arrival == m_arrivals[i].second)
+        {
+          arrivals.push_back (std::make_pair (seqs[m_arrivals[i].first - m_first], m_arrivals[i].second));
+        }
+    }
+  for (TidAddressIndex::iterator it = m_tidAddress.begin (); it != m_tidAddress.end (); it++)
+    {
+      for (std::deque<uint64_t>::iterator j = it->second.begin (); j != it->second.end (); j++)
+        {
+          *j = seqs[*j - m_first];
+        }
+    }
+  m_queue.swap (queue);
+  m_arrivals.swap (arrivals);
+  m_first = 0;
+}
+
 void
 WifiMacQueue::Cleanup (void)
 {
-  if (m_queue.empty ())
+  if (m_arrivals.empty ())
     {
       return;
     }
 
   Time now = Simulator::Now ();
-  uint32_t n = 0;
-  for (PacketQueueI i = m_queue.begin (); i != m_queue.end ();)
+  while (!m_arrivals.empty ())
     {
-      if (i->tstamp + m_maxDelay > now)
+      std::pair<uint64_t, uint64_t> arrival = m_arrivals.front ();
+      struct Item *item = GetItem (arrival.first);
+      if (item == 0 || item->arrival != arrival.second)
         {
-          i++;
+          // Removed already
+          m_arrivals.pop_front ();
+        }
+      else if (item->tstamp + m_maxDelay <= now)
+        {
+          m_arrivals.pop_front ();
+          Erase (arrival.first);
         }
       else
         {
-          i = m_queue.erase (i);
-          n++;
+          break;
         }
     }
-  m_size -= n;
 }
 
 Ptr<const Packet>
@@ -137,11 +259,10 @@ WifiMacQueue::Dequeue (WifiMacHeader *hdr)
   Cleanup ();
   if (!m_queue.empty ())
     {
-      Item i = m_queue.front ();
-      m_queue.pop_front ();
-      m_size--;
-      *hdr = i.hdr;
-      return i.packet;
+      Ptr<const Packet> packet = m_queue.front ().packet;
+      *hdr = m_queue.front ().hdr;
+      Erase (m_first);
+      return packet;
     }
   return 0;
 }
@@ -152,9 +273,8 @@ WifiMacQueue::Peek (WifiMacHeader *hdr)
   Cleanup ();
   if (!m_queue.empty ())
     {
-      Item i = m_queue.front ();
-      *hdr = i.hdr;
-      return i.packet;
+      *hdr = m_queue.front ().hdr;
+      return m_queue.front ().packet;
     }
   return 0;
 }
@@ -165,22 +285,30 @@ WifiMacQueue::DequeueByTidAndAddress (WifiMacHeader *hdr, uint8_t tid,
 {
   Cleanup ();
   Ptr<const Packet> packet = 0;
-  if (!m_queue.empty ())
+  if (type == WifiMacHeader::ADDR1)
+    {
+      TidAddressIndex::const_iterator it = m_tidAddress.find (TidAddress (tid, dest));
+      if (it != m_tidAddress.end () && !it->second.empty ())
+        {
+          uint64_t seq = it->second.front ();
+          struct Item *item = GetItem (seq);
+          packet = item->packet;
+          *hdr = item->hdr;
+          Erase (seq);
+        }
+      return packet;
+    }
+  for (PacketQueueI it = m_queue.begin (); it != m_queue.end (); ++it)
     {
-      PacketQueueI it;
-      for (it = m_queue.begin (); it != m_queue.end (); ++it)
+      if (it->packet != 0 && it->hdr.IsQosData ())
         {
-          if (it->hdr.IsQosData ())
+          if (GetAddressForPacket (type, it) == dest
+              && it->hdr.GetQosTid () == tid)
             {
-              if (GetAddressForPacket (type, it) == dest
-                  && it->hdr.GetQosTid () == tid)
-                {
-                  packet = it->packet;
-                  *hdr = it->hdr;
-                  m_queue.erase (it);
-                  m_size--;
-                  break;
-                }
+              packet = it->packet;
+              *hdr = it->hdr;
+              Erase (m_first + (it - m_queue.begin ()));
+              break;
             }
         }
     }
@@ -192,19 +320,26 @@ WifiMacQueue::PeekByTidAndAddress (WifiMacHeader *hdr, uint8_t tid,
                                    WifiMacHeader::AddressType type, Mac48Address dest)
 {
   Cleanup ();
-  if (!m_queue.empty ())
+  if (type == WifiMacHeader::ADDR1)
     {
-      PacketQueueI it;
-      for (it = m_queue.begin (); it != m_queue.end (); ++it)
+      TidAddressIndex::const_iterator it = m_tidAddress.find (TidAddress (tid, dest));
+      if (it != m_tidAddress.end () && !it->second.empty ())
         {
-          if (it->hdr.IsQosData ())
+          struct Item *item = GetItem (it->second.front ());
+          *hdr = item->hdr;
+          return item->packet;
+        }
+      return 0;
+    }
+  for (PacketQueueI it = m_queue.begin (); it != m_queue.end (); ++it)
+    {
+      if (it->packet != 0 && it->hdr.IsQosData ())
+        {
+          if (GetAddressForPacket (type, it) == dest
+              && it->hdr.GetQosTid () == tid)
             {
-              if (GetAddressForPacket (type, it) == dest
-                  && it->hdr.GetQosTid () == tid)
-                {
-                  *hdr = it->hdr;
-                  return it->packet;
-                }
+              *hdr = it->hdr;
+              return it->packet;
             }
         }
     }
@@ -215,7 +350,7 @@ bool
 WifiMacQueue::IsEmpty (void)
 {
   Cleanup ();
-  return m_queue.empty ();
+  return m_size == 0;
 }
 
 uint32_t
@@ -227,7 +362,10 @@ WifiMacQueue::GetSize (void)
 void
 WifiMacQueue::Flush (void)
 {
-  m_queue.erase (m_queue.begin (), m_queue.end ());
+  m_queue.clear ();
+  m_arrivals.clear ();
+  m_tidAddress.clear ();
+  m_first = 0;
   m_size = 0;
 }
 
@@ -252,13 +390,11 @@ WifiMacQueue::GetAddressForPacket (enum WifiMacHeader::AddressType type, PacketQ
 bool
 WifiMacQueue::Remove (Ptr<const Packet> packet)
 {
-  PacketQueueI it = m_queue.begin ();
-  for (; it != m_queue.end (); it++)
+  for (PacketQueueI it = m_queue.begin (); it != m_queue.end (); it++)
     {
       if (it->packet == packet)
         {
-          m_queue.erase (it);
-          m_size--;
+          Erase (m_first + (it - m_queue.begin ()));
           return true;
         }
     }
@@ -273,9 +409,7 @@ WifiMacQueue::PushFront (Ptr<const Packet> packet, const WifiMacHeader &hdr)
     {
       return;
     }
-  Time now = Simulator::Now ();
-  m_queue.push_front (Item (packet, hdr, now));
-  m_size++;
+  Insert (packet, hdr, true);
 }
 
 uint32_t
@@ -283,18 +417,19 @@ WifiMacQueue::GetNPacketsByTidAndAddress (uint8_t tid, WifiMacHeader::AddressTyp
                                           Mac48Address addr)
 {
   Cleanup ();
+  if (type == WifiMacHeader::ADDR1)
+    {
+      TidAddressIndex::const_iterator it = m_tidAddress.find (TidAddress (tid, addr));
+      return it != m_tidAddress.end () ? it->second.size () : 0;
+    }
   uint32_t nPackets = 0;
-  if (!m_queue.empty ())
+  for (PacketQueueI it = m_queue.begin (); it != m_queue.end (); it++)
     {
-      PacketQueueI it;
-      for (it = m_queue.begin (); it != m_queue.end (); it++)
+      if (it->packet != 0 && GetAddressForPacket (type, it) == addr)
         {
-          if (GetAddressForPacket (type, it) == addr)
+          if (it->hdr.IsQosData () && it->hdr.GetQosTid () == tid)
             {
-              if (it->hdr.IsQosData () && it->hdr.GetQosTid () == tid)
-                {
-                  nPackets++;
-                }
+              nPackets++;
             }
         }
     }
@@ -309,14 +444,14 @@ WifiMacQueue::DequeueFirstAvailable (WifiMacHeader *hdr, Time &timestamp,
   Ptr<const Packet> packet = 0;
   for (PacketQueueI it = m_queue.begin (); it != m_queue.end (); it++)
     {
-      if (!it->hdr.IsQosData ()
-          || !blockedPackets->IsBlocked (it->hdr.GetAddr1 (), it->hdr.GetQosTid ()))
+      if (it->packet != 0
+          && (!it->hdr.IsQosData ()
+              || !blockedPackets->IsBlocked (it->hdr.GetAddr1 (), it->hdr.GetQosTid ())))
         {
           *hdr = it->hdr;
           timestamp = it->tstamp;
           packet = it->packet;
-          m_queue.erase (it);
-          m_size--;
+          Erase (m_first + (it - m_queue.begin ()));
           return packet;
         }
     }
@@ -330,8 +465,9 @@ WifiMacQueue::PeekFirstAvailable (WifiMacHeader *hdr, Time &timestamp,
   Cleanup ();
   for (PacketQueueI it = m_queue.begin (); it != m_queue.end (); it++)
     {
-      if (!it->hdr.IsQosData ()
-          || !blockedPackets->IsBlocked (it->hdr.GetAddr1 (), it->hdr.GetQosTid ()))
+      if (it->packet != 0
+          && (!it->hdr.IsQosData ()
+              || !blockedPackets->IsBlocked (it->hdr.GetAddr1 (), it->hdr.GetQosTid ())))
         {
           *hdr = it->hdr;
           timestamp = it->tstamp;
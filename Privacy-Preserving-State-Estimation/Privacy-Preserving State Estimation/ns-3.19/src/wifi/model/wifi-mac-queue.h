@@ -22,7 +22,8 @@
 #ifndef WIFI_MAC_QUEUE_H
 #define WIFI_MAC_QUEUE_H
 
-#include <list>
+#include <deque>
+#include <map>
 #include <utility>
 #include "ns3/packet.h"
 #include "ns3/nstime.h"
@@ -46,6 +47,14 @@ class QosBlockedDestinations;
  * to verify whether or not it should be dropped. If
  * dot11EDCATableMSDULifetime has elapsed, it is dropped.
  * Otherwise, it is returned to the caller.
+ *
+ * The packets are held in a deque, where a packet removed from the
+ * middle of the queue leaves a hole until the holes are dropped from the
+ * ends of the deque or compacted. The packets expire in the order of
+ * their arrival, which is kept apart, so that the queue checks the
+ * timestamps of its oldest packets only. The QoS data packets are also
+ * indexed by TID and receiver address (Addr1), so that the lookups by
+ * TID and Addr1 do not walk the queue.
  */
 class WifiMacQueue : public Object
 {
@@ -143,8 +152,8 @@ public:
                                          Mac48Address addr);
   /**
    * If exists, removes <i>packet</i> from queue and returns true. Otherwise it
-   * takes no effects and return false. Deletion of the packet is
-   * performed in linear time (O(n)).
+   * takes no effects and return false. The packet is searched in
+   * linear time (O(n)).
    *
    * \param packet the packet to be removed
    * \return true if the packet was removed, false otherwise
@@ -214,17 +223,23 @@ protected:
   struct Item;
 
   /**
-   * typedef for packet (struct Item) queue.
+   * typedef for packet (struct Item) queue, with holes.
    */
-  typedef std::list<struct Item> PacketQueue;
+  typedef std::deque<struct Item> PacketQueue;
   /**
-   * typedef for packet (struct Item) queue reverse iterator.
+   * typedef for packet (struct Item) queue iterator.
    */
-  typedef std::list<struct Item>::reverse_iterator PacketQueueRI;
+  typedef std::deque<struct Item>::iterator PacketQueueI;
   /**
-   * typedef for packet (struct Item) queue iterator.
+   * typedef for the TID and the receiver address of a QoS data packet.
+   */
+  typedef std::pair<uint8_t, Mac48Address> TidAddress;
+  /**
+   * typedef for the sequence numbers of the QoS data packets of each
+   * TID and receiver address, in the order of the queue. The TIDs and
+   * addresses stay in the map when they have no packet left.
    */
-  typedef std::list<struct Item>::iterator PacketQueueI;
+  typedef std::map<TidAddress, std::deque<uint64_t> > TidAddressIndex;
   /**
    * Return the appropriate address for the given packet (given by PacketQueue iterator).
    *
@@ -246,16 +261,52 @@ protected:
      * \param packet
      * \param hdr
      * \param tstamp
+     * \param arrival
      */
     Item (Ptr<const Packet> packet,
           const WifiMacHeader &hdr,
-          Time tstamp);
-    Ptr<const Packet> packet; //!< Actual packet
+          Time tstamp,
+          uint64_t arrival);
+    Ptr<const Packet> packet; //!< Actual packet, or 0 for a hole
     WifiMacHeader hdr; //!< Wifi MAC header associated with the packet
     Time tstamp; //!< timestamp when the packet arrived at the queue
+    uint64_t arrival; //!< number of the packet in the order of arrival
   };
 
+  /**
+   * Insert a packet at either end of the queue.
+   *
+   * \param packet
+   * \param hdr
+   * \param front whether the packet is inserted at the front
+   */
+  void Insert (Ptr<const Packet> packet, const WifiMacHeader &hdr, bool front);
+  /**
+   * Return the packet with the given sequence number.
+   *
+   * \param seq the sequence number
+   * \return the packet, or 0 if it was removed
+   */
+  struct Item * GetItem (uint64_t seq);
+  /**
+   * Remove the packet with the given sequence number, which must be in
+   * the queue.
+   *
+   * \param seq the sequence number
+   */
+  void Erase (uint64_t seq);
+  /**
+   * Remove the holes, and number the packets again.
+   */
+  void Compact (void);
+
   PacketQueue m_queue; //!< Packet (struct Item) queue
+  uint64_t m_first; //!< Sequence number of the first item of m_queue
+  /// Sequence and arrival numbers of the packets in the order of their
+  /// arrival, which is that of their timestamps, with those removed since
+  std::deque<std::pair<uint64_t, uint64_t> > m_arrivals;
+  uint64_t m_nextArrival; //!< Arrival number of the next packet
+  TidAddressIndex m_tidAddress; //!< QoS data packets by TID and Addr1
   uint32_t m_size; //!< Current queue size
   uint32_t m_maxSize; //!< Queue capacity
   Time m_maxDelay; //!< Time to live for packets in the queue
@@ -25,10 +25,22 @@
 #include "ns3/log.h"
 #include "ns3/pointer.h"
 #include "ns3/object-factory.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/nstime.h"
+#include "ns3/constant-position-mobility-model.h"
 #include "yans-wifi-channel.h"
 #include "yans-wifi-phy.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/propagation-delay-model.h"
+#include "ns3/jakes-propagation-loss-model.h"
+#include "ns3/static-link-budget-cache.h"
+#ifdef NS3_MULTITHREADED
+#include "ns3/multithreaded-simulator-impl.h"
+#endif
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 NS_LOG_COMPONENT_DEFINE ("YansWifiChannel");
 
@@ -51,11 +63,51 @@ YansWifiChannel::GetTypeId (void)
                    PointerValue (),
                    MakePointerAccessor (&YansWifiChannel::m_delay),
                    MakePointerChecker<PropagationDelayModel> ())
+    .AddAttribute ("SpatialIndex", "Drop the receptions weaker than ReceiveCutoff, and only visit "
+                   "the PHYs within range of the sender.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&YansWifiChannel::m_spatialIndex),
+                   MakeBooleanChecker ())
+    .AddAttribute ("ReceiveCutoff", "The power (dBm) below which receptions are dropped "
+                   "when SpatialIndex is set.",
+                   DoubleValue (-100.0),
+                   MakeDoubleAccessor (&YansWifiChannel::m_cutoffDbm),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("MaxRange", "The distance (m) beyond which no PHY is visited when SpatialIndex "
+                   "is set. Zero probes the propagation loss model for the distance at which "
+                   "the signal falls below ReceiveCutoff, which is only allowed when the loss "
+                   "models of the chain are deterministic: with a RandomPropagationLossModel, "
+                   "NakagamiPropagationLossModel or JakesPropagationLossModel in the chain, "
+                   "probing would draw from their random streams and find a random range, "
+                   "so MaxRange must be set.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&YansWifiChannel::m_maxRange),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("StaticLinkBudget", "Compute the received power and the delay between every pair "
+                   "of PHYs once rather than for every frame. Only valid with stationary PHYs and "
+                   "deterministic propagation models.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&YansWifiChannel::m_staticLinkBudget),
+                   MakeBooleanChecker ())
+    .AddAttribute ("MinimumDelay", "The floor of the delay returned by GetMinimumDelay, used as the "
+                   "Lookahead of the MultithreadedSimulatorImpl. PHYs of different nodes which are "
+                   "closer than this in delay must be run in the same partition.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&YansWifiChannel::m_minimumDelayFloor),
+                   MakeTimeChecker ())
   ;
   return tid;
 }
 
 YansWifiChannel::YansWifiChannel ()
+  : m_spatialIndex (false),
+    m_cutoffDbm (-100.0),
+    m_maxRange (0.0),
+    m_indexValid (false),
+    m_cellSize (0.0),
+    m_tracked (0),
+    m_staticLinkBudget (false),
+    m_minimumDelayValid (false)
 {
 }
 YansWifiChannel::~YansWifiChannel ()
@@ -64,15 +116,49 @@ YansWifiChannel::~YansWifiChannel ()
   m_phyList.clear ();
 }
 
+void
+YansWifiChannel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (uint32_t j = 0; j < m_tracked; j++)
+    {
+      Ptr<Object> mobility = m_phyList[j]->GetMobility ();
+      if (mobility != 0)
+        {
+          mobility->GetObject<MobilityModel> ()->TraceDisconnectWithoutContext (
+            "CourseChange", MakeCallback (&YansWifiChannel::CourseChanged, this));
+        }
+    }
+  m_tracked = 0;
+  m_grid.clear ();
+  m_moving.clear ();
+  m_candidates.clear ();
+  if (m_budget != 0)
+    {
+      m_budget->Dispose ();
+      m_budget = 0;
+    }
+  WifiChannel::DoDispose ();
+}
+
 void
 YansWifiChannel::SetPropagationLossModel (Ptr<PropagationLossModel> loss)
 {
   m_loss = loss;
+  if (m_budget != 0)
+    {
+      m_budget->SetPropagationLossModel (loss);
+    }
 }
 void
 YansWifiChannel::SetPropagationDelayModel (Ptr<PropagationDelayModel> delay)
 {
   m_delay = delay;
+  m_minimumDelayValid = false;
+  if (m_budget != 0)
+    {
+      m_budget->SetPropagationDelayModel (delay);
+    }
 }
 
 void
@@ -81,42 +167,282 @@ YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const Packet> packet, double
 {
   Ptr<MobilityModel> senderMobility = sender->GetMobility ()->GetObject<MobilityModel> ();
   NS_ASSERT (senderMobility != 0);
-  uint32_t j = 0;
-  for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++, j++)
+  // One snapshot for all the receivers, as the sender may modify its packet.
+  Ptr<const Packet> shared = packet->Copy ();
+  uint32_t senderIndex = sender->GetChannelIndex ();
+  NS_ASSERT (senderIndex < m_phyList.size () && m_phyList[senderIndex] == sender);
+  std::vector<Reception> receptions;
+  {
+#ifdef NS3_MULTITHREADED
+    // The grid, the ranges, the link budgets and the random streams of the
+    // propagation models are shared by the senders of all the partitions.
+    // The receptions are scheduled once the lock is released.
+    CriticalSection cs (m_mutex);
+#endif
+    FindReceptions (sender, senderIndex, senderMobility, txPowerDbm, receptions);
+  }
+  for (std::vector<Reception>::const_iterator i = receptions.begin (); i != receptions.end (); i++)
     {
-      if (sender != (*i))
+      Deliver (*i, shared, txVector, preamble);
+    }
+}
+
+void
+YansWifiChannel::FindReceptions (Ptr<YansWifiPhy> sender, uint32_t senderIndex, Ptr<MobilityModel> senderMobility,
+                                 double txPowerDbm, std::vector<Reception> &receptions) const
+{
+  if (m_staticLinkBudget && m_budget == 0)
+    {
+      BuildLinkBudget ();
+    }
+  double range = m_spatialIndex ? GetRange (txPowerDbm) : 0.0;
+  if (!m_spatialIndex || range == std::numeric_limits<double>::infinity ())
+    {
+      receptions.reserve (m_phyList.size ());
+      for (uint32_t j = 0; j < m_phyList.size (); j++)
         {
-          // For now don't account for inter channel interference
-          if ((*i)->GetChannelNumber () != sender->GetChannelNumber ())
+          AddReception (j, senderIndex, sender, senderMobility, txPowerDbm, receptions);
+        }
+      return;
+    }
+
+  if (!m_indexValid)
+    {
+      BuildIndex (range);
+    }
+  Vector position = senderMobility->GetPosition ();
+  int64_t x = static_cast<int64_t> (std::floor (position.x / m_cellSize));
+  int64_t y = static_cast<int64_t> (std::floor (position.y / m_cellSize));
+  int64_t span = static_cast<int64_t> (std::ceil (range / m_cellSize));
+  m_candidates = m_moving;
+  if ((2.0 * span + 1) * (2.0 * span + 1) >= m_grid.size ())
+    {
+      for (Grid::const_iterator i = m_grid.begin (); i != m_grid.end (); i++)
+        {
+          if (std::abs (i->first.first - x) <= span && std::abs (i->first.second - y) <= span)
             {
-              continue;
+              m_candidates.insert (m_candidates.end (), i->second.begin (), i->second.end ());
             }
+        }
+    }
+  else
+    {
+      for (int64_t cx = x - span; cx <= x + span; cx++)
+        {
+          for (int64_t cy = y - span; cy <= y + span; cy++)
+            {
+              Grid::const_iterator i = m_grid.find (Cell (cx, cy));
+              if (i != m_grid.end ())
+                {
+                  m_candidates.insert (m_candidates.end (), i->second.begin (), i->second.end ());
+                }
+            }
+        }
+    }
+  // Keep the order of the PHY list so that receptions are scheduled as
+  // they would be without the index.
+  std::sort (m_candidates.begin (), m_candidates.end ());
+  NS_LOG_DEBUG ("visiting " << m_candidates.size () << " of " << m_phyList.size () << " phys");
+  receptions.reserve (m_candidates.size ());
+  for (std::vector<uint32_t>::const_iterator i = m_candidates.begin (); i != m_candidates.end (); i++)
+    {
+      AddReception (*i, senderIndex, sender, senderMobility, txPowerDbm, receptions);
+    }
+}
+
+void
+YansWifiChannel::AddReception (uint32_t j, uint32_t senderIndex, Ptr<YansWifiPhy> sender, Ptr<MobilityModel> senderMobility,
+                               double txPowerDbm, std::vector<Reception> &receptions) const
+{
+  Ptr<YansWifiPhy> receiver = m_phyList[j];
+  if (sender == receiver)
+    {
+      return;
+    }
+  // For now don't account for inter channel interference
+  if (receiver->GetChannelNumber () != sender->GetChannelNumber ())
+    {
+      return;
+    }
+
+  Reception reception;
+  reception.j = j;
+  if (m_budget != 0)
+    {
+      uint32_t a = m_budgetIndex[senderIndex];
+      uint32_t b = m_budgetIndex[j];
+      reception.delay = m_budget->GetDelay (a, b);
+      reception.rxPowerDbm = m_budget->CalcRxPower (txPowerDbm, a, b);
+      NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << reception.rxPowerDbm << "dbm, " <<
+                    "delay=" << reception.delay << " (cached)");
+    }
+  else
+    {
+      Ptr<MobilityModel> receiverMobility = receiver->GetMobility ()->GetObject<MobilityModel> ();
+      reception.delay = m_delay->GetDelay (senderMobility, receiverMobility);
+      reception.rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility);
+      NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << reception.rxPowerDbm << "dbm, " <<
+                    "distance=" << senderMobility->GetDistanceFrom (receiverMobility) << "m, delay=" << reception.delay);
+    }
+  if (m_spatialIndex && reception.rxPowerDbm < m_cutoffDbm)
+    {
+      NS_LOG_DEBUG ("drop reception below cutoff " << m_cutoffDbm << "dbm");
+      return;
+    }
+  receptions.push_back (reception);
+}
+
+void
+YansWifiChannel::Deliver (const Reception &reception, Ptr<const Packet> packet,
+                          WifiTxVector txVector, WifiPreamble preamble) const
+{
+  Ptr<Object> dstNetDevice = m_phyList[reception.j]->GetDevice ();
+  uint32_t dstNode;
+  if (dstNetDevice == 0)
+    {
+      dstNode = 0xffffffff;
+    }
+  else
+    {
+      dstNode = dstNetDevice->GetObject<NetDevice> ()->GetNode ()->GetId ();
+    }
+#ifdef NS3_MULTITHREADED
+  if (MultithreadedSimulatorImpl::IsRemote (dstNode))
+    {
+      // The reference counts of the buffers and the tags of a packet are
+      // not atomic: give the receiver a copy of its own, tags included.
+      packet = packet->DeepCopy ();
+    }
+#endif
+  Simulator::ScheduleWithContext (dstNode,
+                                  reception.delay, &YansWifiChannel::Receive, this,
+                                  reception.j, packet, reception.rxPowerDbm, txVector, preamble);
+}
+
+bool
+YansWifiChannel::IsDeterministicLoss (void) const
+{
+  for (Ptr<PropagationLossModel> model = m_loss; model != 0; model = model->GetNext ())
+    {
+      if (DynamicCast<RandomPropagationLossModel> (model) != 0
+          || DynamicCast<NakagamiPropagationLossModel> (model) != 0
+          || DynamicCast<JakesPropagationLossModel> (model) != 0)
+        {
+          return false;
+        }
+    }
+  return true;
+}
 
-          Ptr<MobilityModel> receiverMobility = (*i)->GetMobility ()->GetObject<MobilityModel> ();
-          Time delay = m_delay->GetDelay (senderMobility, receiverMobility);
-          double rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility);
-          NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, " <<
-                        "distance=" << senderMobility->GetDistanceFrom (receiverMobility) << "m, delay=" << delay);
-          Ptr<Packet> copy = packet->Copy ();
-          Ptr<Object> dstNetDevice = m_phyList[j]->GetDevice ();
-          uint32_t dstNode;
-          if (dstNetDevice == 0)
+double
+YansWifiChannel::GetRange (double txPowerDbm) const
+{
+  if (m_maxRange > 0)
+    {
+      return m_maxRange;
+    }
+  std::map<double, double>::const_iterator cached = m_ranges.find (txPowerDbm);
+  if (cached != m_ranges.end ())
+    {
+      return cached->second;
+    }
+  if (!IsDeterministicLoss ())
+    {
+      NS_FATAL_ERROR ("YansWifiChannel: SpatialIndex with a random propagation loss model requires MaxRange");
+    }
+
+  // Double the distance until the signal falls below the cutoff, then
+  // bisect, keeping the far end so that the range is never short.
+  Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel> ();
+  double near = 0.0;
+  double far = 1.0;
+  double range = std::numeric_limits<double>::infinity ();
+  b->SetPosition (Vector (far, 0.0, 0.0));
+  while (far <= 1e7 && m_loss->CalcRxPower (txPowerDbm, a, b) >= m_cutoffDbm)
+    {
+      near = far;
+      far *= 2;
+      b->SetPosition (Vector (far, 0.0, 0.0));
+    }
+  if (far <= 1e7)
+    {
+      for (uint32_t k = 0; k < 32; k++)
+        {
+          double middle = (near + far) / 2;
+          b->SetPosition (Vector (middle, 0.0, 0.0));
+          if (m_loss->CalcRxPower (txPowerDbm, a, b) >= m_cutoffDbm)
             {
-              dstNode = 0xffffffff;
+              near = middle;
             }
           else
             {
-              dstNode = dstNetDevice->GetObject<NetDevice> ()->GetNode ()->GetId ();
+              far = middle;
             }
-          Simulator::ScheduleWithContext (dstNode,
-                                          delay, &YansWifiChannel::Receive, this,
-                                          j, copy, rxPowerDbm, txVector, preamble);
         }
+      range = far;
     }
+  NS_LOG_DEBUG ("range at txPower=" << txPowerDbm << "dbm is " << range << "m");
+  m_ranges[txPowerDbm] = range;
+  return range;
 }
 
 void
-YansWifiChannel::Receive (uint32_t i, Ptr<Packet> packet, double rxPowerDbm,
+YansWifiChannel::BuildIndex (double cellSize) const
+{
+  NS_LOG_FUNCTION (this << cellSize);
+  m_cellSize = cellSize;
+  m_grid.clear ();
+  m_moving.clear ();
+  for (uint32_t j = 0; j < m_phyList.size (); j++)
+    {
+      Ptr<MobilityModel> mobility = m_phyList[j]->GetMobility ()->GetObject<MobilityModel> ();
+      if (j >= m_tracked)
+        {
+          mobility->TraceConnectWithoutContext ("CourseChange",
+                                                MakeCallback (&YansWifiChannel::CourseChanged, this));
+        }
+      Vector velocity = mobility->GetVelocity ();
+      if (velocity.x != 0 || velocity.y != 0 || velocity.z != 0)
+        {
+          m_moving.push_back (j);
+          continue;
+        }
+      Vector position = mobility->GetPosition ();
+      Cell cell (static_cast<int64_t> (std::floor (position.x / m_cellSize)),
+                 static_cast<int64_t> (std::floor (position.y / m_cellSize)));
+      m_grid[cell].push_back (j);
+    }
+  m_tracked = m_phyList.size ();
+  m_indexValid = true;
+}
+
+void
+YansWifiChannel::BuildLinkBudget (void) const
+{
+  NS_LOG_FUNCTION (this);
+  m_budget = CreateObject<StaticLinkBudgetCache> ();
+  m_budget->SetPropagationLossModel (m_loss);
+  m_budget->SetPropagationDelayModel (m_delay);
+  m_budgetIndex.clear ();
+  for (uint32_t j = 0; j < m_phyList.size (); j++)
+    {
+      // PHYs of the same node share a mobility model, hence an index
+      m_budgetIndex.push_back (m_budget->Add (m_phyList[j]->GetMobility ()->GetObject<MobilityModel> ()));
+    }
+}
+
+void
+YansWifiChannel::CourseChanged (Ptr<const MobilityModel> mobility) const
+{
+#ifdef NS3_MULTITHREADED
+  CriticalSection cs (m_mutex);
+#endif
+  m_indexValid = false;
+}
+
+void
+YansWifiChannel::Receive (uint32_t i, Ptr<const Packet> packet, double rxPowerDbm,
                           WifiTxVector txVector, WifiPreamble preamble) const
 {
   m_phyList[i]->StartReceivePacket (packet, rxPowerDbm, txVector, preamble);
@@ -133,10 +459,55 @@ YansWifiChannel::GetDevice (uint32_t i) const
   return m_phyList[i]->GetDevice ()->GetObject<NetDevice> ();
 }
 
-void
+uint32_t
 YansWifiChannel::Add (Ptr<YansWifiPhy> phy)
 {
   m_phyList.push_back (phy);
+  m_indexValid = false;
+  m_minimumDelayValid = false;
+  if (m_budget != 0)
+    {
+      // The mobility of the PHY may not be set yet; rebuild at next use.
+      m_budget->Dispose ();
+      m_budget = 0;
+    }
+  return m_phyList.size () - 1;
+}
+
+Time
+YansWifiChannel::GetMinimumDelay (void) const
+{
+  if (DynamicCast<RandomPropagationDelayModel> (m_delay) != 0)
+    {
+      NS_FATAL_ERROR ("YansWifiChannel: a RandomPropagationDelayModel has no minimum delay to use as a lookahead");
+    }
+  // The mobility models may not be set yet when the PHYs are added, so
+  // the minimum is computed at the first call after an Add.
+  if (!m_minimumDelayValid)
+    {
+      m_minimumDelay = Simulator::GetMaximumSimulationTime ();
+      for (uint32_t a = 0; a < m_phyList.size (); a++)
+        {
+          Ptr<MobilityModel> ma = m_phyList[a]->GetMobility ()->GetObject<MobilityModel> ();
+          for (uint32_t b = 0; b < m_phyList.size (); b++)
+            {
+              Ptr<MobilityModel> mb = m_phyList[b]->GetMobility ()->GetObject<MobilityModel> ();
+              // PHYs of the same node share a mobility model
+              if (ma != mb)
+                {
+                  m_minimumDelay = std::min (m_minimumDelay, m_delay->GetDelay (ma, mb));
+                }
+            }
+        }
+      m_minimumDelayValid = true;
+    }
+  Time minimum = std::max (m_minimumDelay, m_minimumDelayFloor);
+  if (minimum <= Seconds (0))
+    {
+      NS_FATAL_ERROR ("YansWifiChannel: the PHYs of two nodes are co-located, set the MinimumDelay attribute "
+                      "and run such nodes in the same partition");
+    }
+  return minimum;
 }
 
 int64_t
@@ -21,8 +21,14 @@
 #define YANS_WIFI_CHANNEL_H
 
 #include <vector>
+#include <map>
 #include <stdint.h>
 #include "ns3/packet.h"
+#include "ns3/nstime.h"
+#include "ns3/core-config.h"
+#ifdef NS3_MULTITHREADED
+#include "ns3/system-mutex.h"
+#endif
 #include "wifi-channel.h"
 #include "wifi-mode.h"
 #include "wifi-preamble.h"
@@ -33,6 +39,8 @@ namespace ns3 {
 class NetDevice;
 class PropagationLossModel;
 class PropagationDelayModel;
+class MobilityModel;
+class StaticLinkBudgetCache;
 class YansWifiPhy;
 
 /**
@@ -46,6 +54,35 @@ class YansWifiPhy;
  * class and contains a ns3::PropagationLossModel and a ns3::PropagationDelayModel.
  * By default, no propagation models are set so, it is the caller's responsability
  * to set them before using the channel.
+ *
+ * By default, every frame sent is scheduled for reception at every other
+ * PHY on the same channel number, however weak it arrives. When the
+ * SpatialIndex attribute is set, receptions weaker than ReceiveCutoff are
+ * dropped by the channel instead, neither received nor accounted as
+ * interference, and the PHYs are kept in a grid over their positions so
+ * that a frame only visits the PHYs which lie within range of its sender.
+ * The range is the MaxRange attribute if set, otherwise the distance at
+ * which the propagation loss model brings the transmitted power down to
+ * the cutoff, found by probing the model along a straight line. Probing
+ * requires a deterministic loss model which decreases with distance; use
+ * MaxRange with any other model. The channel refuses to probe a chain
+ * holding one of the random loss models of the propagation module, whose
+ * draws would shift the random streams of the run. The grid is rebuilt
+ * whenever a PHY is added or one of them changes course; PHYs moving at
+ * the time the grid is built are visited by every frame.
+ *
+ * When the StaticLinkBudget attribute is set, the received powers and the
+ * delays between the PHYs are looked up in a StaticLinkBudgetCache built
+ * at the first transmission, rather than computed by the propagation
+ * models for every frame. This suits stationary nodes and deterministic
+ * propagation models only; see StaticLinkBudgetCache.
+ *
+ * With the MultithreadedSimulatorImpl, the frames sent to the nodes of
+ * other partitions are delivered as deep copies of their own. The
+ * receivers of a frame, with their received power and delay, are found
+ * under a lock which guards the grid, the link budgets and the
+ * propagation models; the receptions are scheduled, and the copies made,
+ * once it is released. The PHYs must be stationary.
  */
 class YansWifiChannel : public WifiChannel
 {
@@ -63,8 +100,11 @@ public:
    * Adds the given YansWifiPhy to the PHY list
    *
    * \param phy the YansWifiPhy to be added to the PHY list
+   * \return the index of the PHY in the PHY list, which the PHY keeps so
+   *         that its frames are looked up in the link budgets in constant
+   *         time
    */
-  void Add (Ptr<YansWifiPhy> phy);
+  uint32_t Add (Ptr<YansWifiPhy> phy);
 
   /**
    * \param loss the new propagation loss model.
@@ -75,6 +115,22 @@ public:
    */
   void SetPropagationDelayModel (Ptr<PropagationDelayModel> delay);
 
+  /**
+   * \return the smallest propagation delay between the PHYs of two
+   *         different nodes, but not less than the MinimumDelay
+   *         attribute, or the maximum simulation time if there are not
+   *         two of them
+   *
+   * This is a valid Lookahead for the MultithreadedSimulatorImpl when
+   * the nodes only interact through this channel, the PHYs are
+   * stationary and the nodes closer in delay than MinimumDelay run in
+   * the same partition. The delay model must be deterministic: a
+   * RandomPropagationDelayModel is a fatal error, and so is a minimum of
+   * zero, i.e., co-located nodes without a MinimumDelay. The minimum is
+   * computed once, and again after a PHY is added.
+   */
+  Time GetMinimumDelay (void) const;
+
   /**
    * \param sender the device from which the packet is originating.
    * \param packet the packet to send
@@ -86,6 +142,10 @@ public:
    * currently invoked only from WifiPhy::Send. YansWifiChannel
    * delivers packets only between PHYs with the same m_channelNumber,
    * e.g. PHYs that are operating on the same channel.
+   *
+   * The packet is copied once, and the copy is shared by all the
+   * receivers; each YansWifiPhy copies it again only if it receives
+   * it successfully.
    */
   void Send (Ptr<YansWifiPhy> sender, Ptr<const Packet> packet, double txPowerDbm,
              WifiTxVector txVector, WifiPreamble preamble) const;
@@ -100,6 +160,9 @@ public:
   */
   int64_t AssignStreams (int64_t stream);
 
+protected:
+  virtual void DoDispose (void);
+
 private:
   //YansWifiChannel& operator = (const YansWifiChannel &);
   //YansWifiChannel (const YansWifiChannel &);
@@ -119,13 +182,106 @@ private:
    * \param txVector the TXVECTOR of the packet
    * \param preamble the type of preamble being used to send the packet
    */
-  void Receive (uint32_t i, Ptr<Packet> packet, double rxPowerDbm,
+  void Receive (uint32_t i, Ptr<const Packet> packet, double rxPowerDbm,
                 WifiTxVector txVector, WifiPreamble preamble) const;
+  /// A reception of the frame being sent
+  struct Reception
+  {
+    uint32_t j; //!< Index of the receiving YansWifiPhy in the PHY list
+    Time delay; //!< Propagation delay to the receiver
+    double rxPowerDbm; //!< Received power
+  };
+  /**
+   * Find the PHYs which receive a frame, with their received power and
+   * propagation delay. Under the MultithreadedSimulatorImpl, this is
+   * called with m_mutex held.
+   *
+   * \param sender the device from which the packet is originating
+   * \param senderIndex index of the sender in the PHY list
+   * \param senderMobility the mobility model of the sender
+   * \param txPowerDbm the tx power associated to the packet
+   * \param receptions the receptions found, in the order of the PHY list
+   */
+  void FindReceptions (Ptr<YansWifiPhy> sender, uint32_t senderIndex, Ptr<MobilityModel> senderMobility,
+                       double txPowerDbm, std::vector<Reception> &receptions) const;
+  /**
+   * Compute the reception of a frame by one YansWifiPhy, if any.
+   *
+   * \param j index of the receiving YansWifiPhy in the PHY list
+   * \param senderIndex index of the sender in the PHY list
+   * \param sender the device from which the packet is originating
+   * \param senderMobility the mobility model of the sender
+   * \param txPowerDbm the tx power associated to the packet
+   * \param receptions the receptions found so far
+   */
+  void AddReception (uint32_t j, uint32_t senderIndex, Ptr<YansWifiPhy> sender, Ptr<MobilityModel> senderMobility,
+                     double txPowerDbm, std::vector<Reception> &receptions) const;
+  /**
+   * Schedule the reception of a packet by one YansWifiPhy.
+   *
+   * \param reception the receiver, received power and delay
+   * \param packet the packet being sent, shared by all the receivers
+   * \param txVector the TXVECTOR of the packet
+   * \param preamble the type of preamble being used to send the packet
+   */
+  void Deliver (const Reception &reception, Ptr<const Packet> packet,
+                WifiTxVector txVector, WifiPreamble preamble) const;
+  /**
+   * \param txPowerDbm the tx power of a packet
+   * \return the distance beyond which the packet arrives below the cutoff,
+   *         or infinity if there is no such distance
+   */
+  double GetRange (double txPowerDbm) const;
+  /**
+   * \return false if a loss model of the chain draws random variables
+   */
+  bool IsDeterministicLoss (void) const;
+  /**
+   * Rebuild the grid from the current positions of the PHYs.
+   *
+   * \param cellSize the length of the side of a grid cell
+   */
+  void BuildIndex (double cellSize) const;
+  /**
+   * Invalidate the grid when a PHY changes course.
+   *
+   * \param mobility the mobility model which changed course
+   */
+  void CourseChanged (Ptr<const MobilityModel> mobility) const;
+  /**
+   * Create the link budget cache and add the PHYs to it.
+   */
+  void BuildLinkBudget (void) const;
+
+  /// Coordinates of a grid cell
+  typedef std::pair<int64_t, int64_t> Cell;
+  /// Indices of the PHYs located in each non-empty grid cell
+  typedef std::map<Cell, std::vector<uint32_t> > Grid;
 
 
   PhyList m_phyList; //!< List of YansWifiPhys connected to this YansWifiChannel
   Ptr<PropagationLossModel> m_loss; //!< Propagation loss model
   Ptr<PropagationDelayModel> m_delay; //!< Propagation delay model
+
+  bool m_spatialIndex; //!< Whether receptions are looked up in the grid
+  double m_cutoffDbm; //!< Receptions weaker than this are dropped
+  double m_maxRange; //!< Range of a frame, zero to probe the loss model
+  mutable bool m_indexValid; //!< Whether the grid matches the PHY positions
+  mutable double m_cellSize; //!< Length of the side of a grid cell
+  mutable Grid m_grid; //!< PHYs by grid cell
+  mutable std::vector<uint32_t> m_moving; //!< PHYs which were moving when the grid was built
+  mutable uint32_t m_tracked; //!< Number of PHYs whose course changes are tracked
+  mutable std::map<double, double> m_ranges; //!< Probed range by tx power
+  mutable std::vector<uint32_t> m_candidates; //!< PHYs visited by the current frame
+  bool m_staticLinkBudget; //!< Whether link budgets are cached
+  mutable Ptr<StaticLinkBudgetCache> m_budget; //!< Link budgets between the PHYs
+  mutable std::vector<uint32_t> m_budgetIndex; //!< Index in m_budget of each PHY
+  Time m_minimumDelayFloor; //!< Floor of the minimum delay
+  mutable bool m_minimumDelayValid; //!< Whether m_minimumDelay matches the PHYs
+  mutable Time m_minimumDelay; //!< Smallest delay between the PHYs of two nodes
+#ifdef NS3_MULTITHREADED
+  mutable SystemMutex m_mutex; //!< Serializes the frames sent from several threads
+#endif
 };
 
 } // namespace ns3
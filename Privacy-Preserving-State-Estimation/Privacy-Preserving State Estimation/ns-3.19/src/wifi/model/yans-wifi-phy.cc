@@ -170,6 +170,7 @@ YansWifiPhy::GetTypeId (void)
 
 YansWifiPhy::YansWifiPhy ()
   :  m_channelNumber (1),
+    m_channelIndex (0),
     m_endRxEvent (),
     m_channelStartingFrequency (0)
 {
@@ -368,7 +369,7 @@ void
 YansWifiPhy::SetChannel (Ptr<YansWifiChannel> channel)
 {
   m_channel = channel;
-  m_channel->Add (this);
+  m_channelIndex = m_channel->Add (this);
 }
 
 void
@@ -426,6 +427,12 @@ YansWifiPhy::GetChannelNumber () const
   return m_channelNumber;
 }
 
+uint32_t
+YansWifiPhy::GetChannelIndex () const
+{
+  return m_channelIndex;
+}
+
 double
 YansWifiPhy::GetChannelFrequencyMhz () const
 {
@@ -443,7 +450,7 @@ YansWifiPhy::SetReceiveErrorCallback (RxErrorCallback callback)
   m_state->SetReceiveErrorCallback (callback);
 }
 void
-YansWifiPhy::StartReceivePacket (Ptr<Packet> packet,
+YansWifiPhy::StartReceivePacket (Ptr<const Packet> packet,
                                  double rxPowerDbm,
                                  WifiTxVector txVector,
                                  enum WifiPreamble preamble)
@@ -785,7 +792,7 @@ YansWifiPhy::GetPowerDbm (uint8_t power) const
 }
 
 void
-YansWifiPhy::EndReceive (Ptr<Packet> packet, Ptr<InterferenceHelper::Event> event)
+YansWifiPhy::EndReceive (Ptr<const Packet> packet, Ptr<InterferenceHelper::Event> event)
 {
   NS_LOG_FUNCTION (this << packet << event);
   NS_ASSERT (IsStateRx ());
@@ -805,7 +812,7 @@ YansWifiPhy::EndReceive (Ptr<Packet> packet, Ptr<InterferenceHelper::Event> even
       double signalDbm = RatioToDb (event->GetRxPowerW ()) + 30;
       double noiseDbm = RatioToDb (event->GetRxPowerW () / snrPer.snr) - GetRxNoiseFigure () + 30;
       NotifyMonitorSniffRx (packet, (uint16_t)GetChannelFrequencyMhz (), GetChannelNumber (), dataRate500KbpsUnits, isShortPreamble, signalDbm, noiseDbm);
-      m_state->SwitchFromRxEndOk (packet, snrPer.snr, event->GetPayloadMode (), event->GetPreambleType ());
+      m_state->SwitchFromRxEndOk (packet->Copy (), snrPer.snr, event->GetPayloadMode (), event->GetPreambleType ());
     }
   else
     {
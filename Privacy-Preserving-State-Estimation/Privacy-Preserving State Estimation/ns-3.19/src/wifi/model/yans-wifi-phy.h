@@ -88,6 +88,12 @@ public:
    * \return the current channel number
    */
   uint16_t GetChannelNumber () const;
+  /**
+   * Return the index of this YansWifiPhy in the PHY list of its channel.
+   *
+   * \return the index of this YansWifiPhy on its YansWifiChannel
+   */
+  uint32_t GetChannelIndex () const;
   /**
    * Return current center channel frequency in MHz.
    *
@@ -98,12 +104,16 @@ public:
   /**
    * Starting receiving the packet (i.e. the first bit of the preamble has arrived).
    *
+   * The packet may be shared by all the receivers of a transmission: it
+   * is only copied once received successfully, before being handed to
+   * the upper layers which may modify it.
+   *
    * \param packet the arriving packet
    * \param rxPowerDbm the receive power in dBm
    * \param txVector the TXVECTOR of the arriving packet
    * \param preamble the preamble of the arriving packet
    */
-  void StartReceivePacket (Ptr<Packet> packet,
+  void StartReceivePacket (Ptr<const Packet> packet,
                            double rxPowerDbm,
                            WifiTxVector txVector,
                            WifiPreamble preamble);
@@ -450,7 +460,7 @@ private:
    * \param packet the packet that the last bit has arrived
    * \param event the corresponding event of the first time the packet arrives
    */
-  void EndReceive (Ptr<Packet> packet, Ptr<InterferenceHelper::Event> event);
+  void EndReceive (Ptr<const Packet> packet, Ptr<InterferenceHelper::Event> event);
 
 private:
   double   m_edThresholdW;        //!< Energy detection threshold in watts
@@ -463,6 +473,7 @@ private:
 
   Ptr<YansWifiChannel> m_channel;        //!< YansWifiChannel that this YansWifiPhy is connected to
   uint16_t             m_channelNumber;  //!< Operating channel number
+  uint32_t             m_channelIndex;   //!< Index in the PHY list of m_channel
   Ptr<Object>          m_device;         //!< Pointer to the device
   Ptr<Object>          m_mobility;       //!< Pointer to the mobility model
 
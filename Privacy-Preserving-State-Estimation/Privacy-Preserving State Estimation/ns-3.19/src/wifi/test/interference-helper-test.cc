@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/nist-error-rate-model.h"
+#include "ns3/interference-helper.h"
+
+namespace ns3 {
+
+/**
+ * Replay the operations recorded on the InterferenceHelper of a mesh
+ * point, and check that the SNRs, the PERs and the energy durations are
+ * those recorded, to the last bit.
+ */
+class InterferenceHelperTraceTest : public TestCase
+{
+public:
+  InterferenceHelperTraceTest ();
+
+private:
+  virtual void DoRun (void);
+  void Replay (std::string line);
+
+  InterferenceHelper m_interference;
+  std::vector<Ptr<InterferenceHelper::Event> > m_events;
+  uint32_t m_receptions;
+};
+
+InterferenceHelperTraceTest::InterferenceHelperTraceTest ()
+  : TestCase ("Check the PERs of a recorded trace of receptions"),
+    m_receptions (0)
+{
+}
+
+void
+InterferenceHelperTraceTest::Replay (std::string line)
+{
+  std::istringstream is (line);
+  int64_t ns;
+  std::string op;
+  is >> ns >> op;
+  if (op == "add")
+    {
+      uint32_t event;
+      uint32_t size;
+      std::string mode;
+      int preamble;
+      int64_t duration;
+      double power;
+      is >> event >> size >> mode >> preamble >> duration >> power;
+      NS_TEST_ASSERT_MSG_EQ (event, m_events.size (), "Events out of order");
+      WifiTxVector txVector;
+      txVector.SetMode (WifiMode (mode));
+      m_events.push_back (m_interference.Add (size, WifiMode (mode), (enum WifiPreamble) preamble,
+                                              NanoSeconds (duration), power, txVector));
+    }
+  else if (op == "snrper")
+    {
+      uint32_t event;
+      double snr;
+      double per;
+      is >> event >> snr >> per;
+      NS_TEST_ASSERT_MSG_LT (event, m_events.size (), "Unknown event");
+      struct InterferenceHelper::SnrPer snrPer = m_interference.CalculateSnrPer (m_events[event]);
+      NS_TEST_EXPECT_MSG_EQ (snrPer.snr, snr, "SNR of event " << event);
+      NS_TEST_EXPECT_MSG_EQ (snrPer.per, per, "PER of event " << event);
+      m_receptions++;
+    }
+  else if (op == "energy")
+    {
+      double energyW;
+      int64_t duration;
+      is >> energyW >> duration;
+      NS_TEST_EXPECT_MSG_EQ (m_interference.GetEnergyDuration (energyW), NanoSeconds (duration),
+                             "Energy duration at " << ns << " ns");
+    }
+  else if (op == "rxstart")
+    {
+      m_interference.NotifyRxStart ();
+    }
+  else if (op == "rxend")
+    {
+      m_interference.NotifyRxEnd ();
+    }
+  else if (op == "erase")
+    {
+      m_interference.EraseEvents ();
+    }
+  else
+    {
+      NS_TEST_ASSERT_MSG_EQ (op, "", "Unknown operation");
+    }
+}
+
+void
+InterferenceHelperTraceTest::DoRun (void)
+{
+  // The modes are registered when they are first used
+  WifiPhy::GetDsssRate1Mbps ();
+  WifiPhy::GetErpOfdmRate6Mbps ();
+
+  m_interference.SetNoiseFigure (std::pow (10.0, 7.0 / 10.0));
+  m_interference.SetErrorRateModel (CreateObject<NistErrorRateModel> ());
+
+  std::ifstream trace (CreateDataDirFilename ("interference-helper-trace.txt").c_str ());
+  NS_TEST_ASSERT_MSG_EQ (trace.good (), true, "Cannot open the trace");
+  std::string line;
+  while (std::getline (trace, line))
+    {
+      if (line.empty () || line[0] == '#')
+        {
+          continue;
+        }
+      int64_t ns;
+      std::istringstream (line) >> ns;
+      // Operations at the same time are run in the order of the trace
+      Simulator::Schedule (NanoSeconds (ns), &InterferenceHelperTraceTest::Replay, this, line);
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+  NS_TEST_EXPECT_MSG_GT (m_receptions, 0, "No reception in the trace");
+}
+
+class InterferenceHelperTestSuite : public TestSuite
+{
+public:
+  InterferenceHelperTestSuite ();
+};
+
+InterferenceHelperTestSuite::InterferenceHelperTestSuite ()
+  : TestSuite ("devices-wifi-interference-helper", UNIT)
+{
+  SetDataDir (NS_TEST_SOURCEDIR);
+  AddTestCase (new InterferenceHelperTraceTest, TestCase::QUICK);
+}
+
+static InterferenceHelperTestSuite g_interferenceHelperTestSuite;
+
+} // namespace ns3
@@ -0,0 +1,222 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/double.h"
+#include "ns3/string.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/nist-error-rate-model.h"
+#include "ns3/yans-error-rate-model.h"
+#include "ns3/tabulated-error-rate-model.h"
+
+namespace ns3 {
+
+static std::vector<WifiMode>
+GetModes (void)
+{
+  std::vector<WifiMode> modes;
+  modes.push_back (WifiPhy::GetOfdmRate6Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate9Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate12Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate18Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate24Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate36Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate48Mbps ());
+  modes.push_back (WifiPhy::GetOfdmRate54Mbps ());
+  modes.push_back (WifiPhy::GetDsssRate1Mbps ());
+  modes.push_back (WifiPhy::GetDsssRate2Mbps ());
+  modes.push_back (WifiPhy::GetDsssRate5_5Mbps ());
+  modes.push_back (WifiPhy::GetDsssRate11Mbps ());
+  return modes;
+}
+
+static double
+DbToRatio (double db)
+{
+  return std::pow (10.0, db / 10.0);
+}
+
+/**
+ * Compare the chunk success rates of a TabulatedErrorRateModel with
+ * those of the model it tabulates, from -5 dB, where the DSSS models
+ * still return probabilities, to above the grid.
+ */
+class TabulatedErrorRateAccuracyTest : public TestCase
+{
+public:
+  TabulatedErrorRateAccuracyTest (Ptr<ErrorRateModel> model, std::string name);
+
+private:
+  virtual void DoRun (void);
+  Ptr<ErrorRateModel> m_model;
+};
+
+TabulatedErrorRateAccuracyTest::TabulatedErrorRateAccuracyTest (Ptr<ErrorRateModel> model, std::string name)
+  : TestCase ("Check the chunk success rates tabulated from the " + name),
+    m_model (model)
+{
+}
+
+void
+TabulatedErrorRateAccuracyTest::DoRun (void)
+{
+  Ptr<TabulatedErrorRateModel> tabulated = CreateObject<TabulatedErrorRateModel> ();
+  tabulated->SetErrorRateModel (m_model);
+  std::vector<WifiMode> modes = GetModes ();
+  uint32_t nbits[] = { 0, 1, 8, 100, 1000, 12000 };
+  for (std::vector<WifiMode>::const_iterator mode = modes.begin (); mode != modes.end (); ++mode)
+    {
+      double worst = 0;
+      double worstSnrDb = 0;
+      for (double snrDb = -5.0; snrDb < 55.0; snrDb += 0.037)
+        {
+          for (uint32_t i = 0; i < sizeof (nbits) / sizeof (nbits[0]); i++)
+            {
+              double expected = m_model->GetChunkSuccessRate (*mode, DbToRatio (snrDb), nbits[i]);
+              double error = std::fabs (tabulated->GetChunkSuccessRate (*mode, DbToRatio (snrDb), nbits[i]) - expected);
+              if (error > worst)
+                {
+                  worst = error;
+                  worstSnrDb = snrDb;
+                }
+            }
+        }
+      NS_TEST_EXPECT_MSG_LT (worst, 1e-3, "Mode " << *mode << " at " << worstSnrDb << " dB");
+    }
+
+  // Below the grid, the model itself is used
+  WifiMode mode = WifiPhy::GetDsssRate1Mbps ();
+  double snr = DbToRatio (-25.0);
+  NS_TEST_EXPECT_MSG_EQ (tabulated->GetChunkSuccessRate (mode, snr, 100), m_model->GetChunkSuccessRate (mode, snr, 100),
+                         "Chunk below the grid");
+}
+
+/**
+ * Check that the tables survive a file, and that they follow the grid
+ * when it changes.
+ */
+class TabulatedErrorRateFileTest : public TestCase
+{
+public:
+  TabulatedErrorRateFileTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TabulatedErrorRateFileTest::TabulatedErrorRateFileTest ()
+  : TestCase ("Check the table files and the grid changes of TabulatedErrorRateModel")
+{
+}
+
+void
+TabulatedErrorRateFileTest::DoRun (void)
+{
+  std::vector<WifiMode> modes = GetModes ();
+  Ptr<TabulatedErrorRateModel> tabulated = CreateObject<TabulatedErrorRateModel> ();
+  std::vector<double> snr;
+  std::vector<uint32_t> nbits;
+  for (double snrDb = -30.0; snrDb < 60.0; snrDb += 0.7)
+    {
+      snr.push_back (DbToRatio (snrDb));
+      nbits.push_back (8 * snr.size ());
+    }
+
+  std::string filename = CreateTempDirFilename ("tabulated-error-rate-model.bin");
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      tabulated->Tabulate (modes[i]);
+    }
+  NS_TEST_ASSERT_MSG_EQ (tabulated->Save (filename), true, "Cannot save the tables");
+
+  // The tables of the file are used as they are, and the modes which are
+  // not in it are tabulated
+  Ptr<TabulatedErrorRateModel> loaded = CreateObject<TabulatedErrorRateModel> ();
+  loaded->SetAttribute ("TableFile", StringValue (filename));
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      for (uint32_t j = 0; j < snr.size (); j++)
+        {
+          NS_TEST_EXPECT_MSG_EQ (loaded->GetChunkSuccessRate (modes[i], snr[j], nbits[j]),
+                                 tabulated->GetChunkSuccessRate (modes[i], snr[j], nbits[j]),
+                                 "Mode " << modes[i] << " at " << snr[j]);
+        }
+    }
+
+  // The tables of another grid, or of another model, are not loaded
+  Ptr<TabulatedErrorRateModel> other = CreateObject<TabulatedErrorRateModel> ();
+  other->SetAttribute ("Step", DoubleValue (0.1));
+  NS_TEST_EXPECT_MSG_EQ (other->Load (filename), false, "Tables of another grid loaded");
+  other = CreateObject<TabulatedErrorRateModel> ();
+  other->SetErrorRateModel (CreateObject<YansErrorRateModel> ());
+  NS_TEST_EXPECT_MSG_EQ (other->Load (filename), false, "Tables of another model loaded");
+  NS_TEST_EXPECT_MSG_EQ (other->Load (filename + ".missing"), false, "Missing file loaded");
+
+  // A grid changed after the first chunk is tabulated again: below the
+  // new grid the model itself is used, and the saved tables are those of
+  // the new grid
+  Ptr<NistErrorRateModel> nist = CreateObject<NistErrorRateModel> ();
+  Ptr<TabulatedErrorRateModel> changed = CreateObject<TabulatedErrorRateModel> ();
+  changed->Tabulate (modes[0]);
+  changed->SetAttribute ("MinSnr", DoubleValue (15.0));
+  changed->SetAttribute ("Step", DoubleValue (0.1));
+  for (uint32_t i = 0; i < snr.size () && snr[i] < DbToRatio (15.0); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (changed->GetChunkSuccessRate (modes[0], snr[i], nbits[i]),
+                             nist->GetChunkSuccessRate (modes[0], snr[i], nbits[i]),
+                             "Chunk below the new grid at " << snr[i]);
+    }
+  NS_TEST_ASSERT_MSG_EQ (changed->Save (filename), true, "Cannot save the tables");
+  loaded = CreateObject<TabulatedErrorRateModel> ();
+  loaded->SetAttribute ("MinSnr", DoubleValue (15.0));
+  loaded->SetAttribute ("Step", DoubleValue (0.1));
+  NS_TEST_EXPECT_MSG_EQ (loaded->Load (filename), true, "Tables of the new grid not loaded");
+  loaded->Tabulate (modes[1]);
+  changed->Tabulate (modes[1]);
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      for (uint32_t j = 0; j < snr.size (); j++)
+        {
+          NS_TEST_EXPECT_MSG_EQ (loaded->GetChunkSuccessRate (modes[i], snr[j], nbits[j]),
+                                 changed->GetChunkSuccessRate (modes[i], snr[j], nbits[j]),
+                                 "Mode " << modes[i] << " at " << snr[j] << " on the new grid");
+        }
+    }
+  std::remove (filename.c_str ());
+}
+
+class TabulatedErrorRateModelTestSuite : public TestSuite
+{
+public:
+  TabulatedErrorRateModelTestSuite ();
+};
+
+TabulatedErrorRateModelTestSuite::TabulatedErrorRateModelTestSuite ()
+  : TestSuite ("devices-wifi-tabulated-error-rate", UNIT)
+{
+  AddTestCase (new TabulatedErrorRateAccuracyTest (CreateObject<NistErrorRateModel> (), "NistErrorRateModel"),
+               TestCase::QUICK);
+  AddTestCase (new TabulatedErrorRateAccuracyTest (CreateObject<YansErrorRateModel> (), "YansErrorRateModel"),
+               TestCase::QUICK);
+  AddTestCase (new TabulatedErrorRateFileTest, TestCase::QUICK);
+}
+
+static TabulatedErrorRateModelTestSuite g_tabulatedErrorRateModelTestSuite;
+
+} // namespace ns3
@@ -0,0 +1,367 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <list>
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/wifi-mac-queue.h"
+#include "ns3/qos-blocked-destinations.h"
+
+namespace ns3 {
+
+/**
+ * The queue of packets which expire, walked from its head by every
+ * operation, against which the WifiMacQueue is checked.
+ */
+class ReferenceMacQueue
+{
+public:
+  struct Item
+  {
+    Ptr<const Packet> packet;
+    WifiMacHeader hdr;
+    Time tstamp;
+  };
+  typedef std::list<Item>::iterator Iterator;
+
+  ReferenceMacQueue (uint32_t maxSize, Time maxDelay)
+    : m_maxSize (maxSize),
+      m_maxDelay (maxDelay)
+  {
+  }
+  void SetMaxDelay (Time maxDelay)
+  {
+    m_maxDelay = maxDelay;
+  }
+  void Insert (Ptr<const Packet> packet, const WifiMacHeader &hdr, bool front)
+  {
+    Cleanup ();
+    if (m_queue.size () == m_maxSize)
+      {
+        return;
+      }
+    Item item;
+    item.packet = packet;
+    item.hdr = hdr;
+    item.tstamp = Simulator::Now ();
+    if (front)
+      {
+        m_queue.push_front (item);
+      }
+    else
+      {
+        m_queue.push_back (item);
+      }
+  }
+  /// Return the first packet which matches, or end () if none
+  Iterator Find (bool byTidAndAddress, uint8_t tid, WifiMacHeader::AddressType type, Mac48Address addr,
+                 const QosBlockedDestinations *blocked)
+  {
+    Cleanup ();
+    for (Iterator it = m_queue.begin (); it != m_queue.end (); it++)
+      {
+        if (blocked != 0)
+          {
+            if (!it->hdr.IsQosData () || !blocked->IsBlocked (it->hdr.GetAddr1 (), it->hdr.GetQosTid ()))
+              {
+                return it;
+              }
+          }
+        else if (!byTidAndAddress
+                 || (it->hdr.IsQosData () && it->hdr.GetQosTid () == tid && GetAddress (type, it->hdr) == addr))
+          {
+            return it;
+          }
+      }
+    return m_queue.end ();
+  }
+  uint32_t Count (uint8_t tid, WifiMacHeader::AddressType type, Mac48Address addr)
+  {
+    Cleanup ();
+    uint32_t n = 0;
+    for (Iterator it = m_queue.begin (); it != m_queue.end (); it++)
+      {
+        if (it->hdr.IsQosData () && it->hdr.GetQosTid () == tid && GetAddress (type, it->hdr) == addr)
+          {
+            n++;
+          }
+      }
+    return n;
+  }
+  bool Remove (Ptr<const Packet> packet)
+  {
+    for (Iterator it = m_queue.begin (); it != m_queue.end (); it++)
+      {
+        if (it->packet == packet)
+          {
+            m_queue.erase (it);
+            return true;
+          }
+      }
+    return false;
+  }
+  static Mac48Address GetAddress (WifiMacHeader::AddressType type, const WifiMacHeader &hdr)
+  {
+    if (type == WifiMacHeader::ADDR1)
+      {
+        return hdr.GetAddr1 ();
+      }
+    return hdr.GetAddr2 ();
+  }
+  void Cleanup (void)
+  {
+    for (Iterator it = m_queue.begin (); it != m_queue.end (); )
+      {
+        if (it->tstamp + m_maxDelay > Simulator::Now ())
+          {
+            it++;
+          }
+        else
+          {
+            it = m_queue.erase (it);
+          }
+      }
+  }
+
+  std::list<Item> m_queue;
+  uint32_t m_maxSize;
+  Time m_maxDelay;
+};
+
+/**
+ * Run random operations on a WifiMacQueue and on a ReferenceMacQueue,
+ * while the time advances, and check that they return the same packets.
+ * Unless the head of the queue is dequeued, the packets are dequeued
+ * from the middle of the queue, and stay there until they expire.
+ */
+class WifiMacQueueRandomTest : public TestCase
+{
+public:
+  WifiMacQueueRandomTest (uint32_t maxSize, Time maxDelay, bool dequeueHead);
+
+private:
+  virtual void DoRun (void);
+  void Step (uint32_t remaining);
+  WifiMacHeader CreateHeader (void);
+  void Check (Ptr<const Packet> packet, const WifiMacHeader &hdr,
+              ReferenceMacQueue::Iterator expected, std::string operation);
+
+  uint32_t m_maxSize;
+  Time m_maxDelay;
+  bool m_dequeueHead;
+  Ptr<WifiMacQueue> m_queue;
+  ReferenceMacQueue m_reference;
+  Ptr<UniformRandomVariable> m_random;
+  std::vector<Mac48Address> m_addresses;
+  std::vector<Ptr<Packet> > m_packets;
+  QosBlockedDestinations m_blocked;
+};
+
+WifiMacQueueRandomTest::WifiMacQueueRandomTest (uint32_t maxSize, Time maxDelay, bool dequeueHead)
+  : TestCase ("Check the packets of a WifiMacQueue against a list walked from its head"),
+    m_maxSize (maxSize),
+    m_maxDelay (maxDelay),
+    m_dequeueHead (dequeueHead),
+    m_reference (maxSize, maxDelay)
+{
+}
+
+WifiMacHeader
+WifiMacQueueRandomTest::CreateHeader (void)
+{
+  WifiMacHeader hdr;
+  if (m_random->GetInteger (0, 4) == 0)
+    {
+      hdr.SetType (WIFI_MAC_DATA);
+    }
+  else
+    {
+      hdr.SetType (WIFI_MAC_QOSDATA);
+      hdr.SetQosTid (m_random->GetInteger (0, 2));
+    }
+  hdr.SetAddr1 (m_addresses[m_random->GetInteger (0, 3)]);
+  hdr.SetAddr2 (m_addresses[m_random->GetInteger (4, 5)]);
+  return hdr;
+}
+
+void
+WifiMacQueueRandomTest::Check (Ptr<const Packet> packet, const WifiMacHeader &hdr,
+                               ReferenceMacQueue::Iterator expected, std::string operation)
+{
+  if (expected == m_reference.m_queue.end ())
+    {
+      NS_TEST_EXPECT_MSG_EQ ((packet == 0), true, operation << " at " << Simulator::Now ().GetSeconds ());
+      return;
+    }
+  NS_TEST_EXPECT_MSG_EQ (packet, expected->packet, operation << " at " << Simulator::Now ().GetSeconds ());
+  NS_TEST_EXPECT_MSG_EQ (hdr.GetAddr1 (), expected->hdr.GetAddr1 (), operation << " header");
+}
+
+void
+WifiMacQueueRandomTest::Step (uint32_t remaining)
+{
+  WifiMacHeader hdr;
+  uint8_t tid = m_random->GetInteger (0, 2);
+  Mac48Address addr = m_addresses[m_random->GetInteger (0, 5)];
+  WifiMacHeader::AddressType type = m_random->GetInteger (0, 3) == 0 ? WifiMacHeader::ADDR2 : WifiMacHeader::ADDR1;
+  uint32_t operation = m_random->GetInteger (0, 19);
+  if (operation < 7)
+    {
+      Ptr<Packet> packet = Create<Packet> (10);
+      m_packets.push_back (packet);
+      hdr = CreateHeader ();
+      m_queue->Enqueue (packet, hdr);
+      m_reference.Insert (packet, hdr, false);
+    }
+  else if (operation == 7)
+    {
+      Ptr<Packet> packet = Create<Packet> (10);
+      m_packets.push_back (packet);
+      hdr = CreateHeader ();
+      m_queue->PushFront (packet, hdr);
+      m_reference.Insert (packet, hdr, true);
+    }
+  else if (operation == 8)
+    {
+      ReferenceMacQueue::Iterator expected = m_reference.Find (false, 0, type, addr, 0);
+      Check (m_queue->Peek (&hdr), hdr, expected, "Peek");
+    }
+  else if (operation < 11 && m_dequeueHead)
+    {
+      ReferenceMacQueue::Iterator expected = m_reference.Find (false, 0, type, addr, 0);
+      Check (m_queue->Dequeue (&hdr), hdr, expected, "Dequeue");
+      if (expected != m_reference.m_queue.end ())
+        {
+          m_reference.m_queue.erase (expected);
+        }
+    }
+  else if (operation == 11)
+    {
+      ReferenceMacQueue::Iterator expected = m_reference.Find (true, tid, type, addr, 0);
+      Check (m_queue->PeekByTidAndAddress (&hdr, tid, type, addr), hdr, expected, "PeekByTidAndAddress");
+    }
+  else if (operation < 13)
+    {
+      ReferenceMacQueue::Iterator expected = m_reference.Find (true, tid, type, addr, 0);
+      Check (m_queue->DequeueByTidAndAddress (&hdr, tid, type, addr), hdr, expected, "DequeueByTidAndAddress");
+      if (expected != m_reference.m_queue.end ())
+        {
+          m_reference.m_queue.erase (expected);
+        }
+    }
+  else if (operation == 13)
+    {
+      NS_TEST_EXPECT_MSG_EQ (m_queue->GetNPacketsByTidAndAddress (tid, type, addr), m_reference.Count (tid, type, addr),
+                             "GetNPacketsByTidAndAddress at " << Simulator::Now ().GetSeconds ());
+    }
+  else if (operation == 14)
+    {
+      Ptr<Packet> packet = m_packets[m_random->GetInteger (0, m_packets.size () - 1)];
+      NS_TEST_EXPECT_MSG_EQ (m_queue->Remove (packet), m_reference.Remove (packet), "Remove");
+    }
+  else if (operation < 17)
+    {
+      if (m_random->GetInteger (0, 1) == 0)
+        {
+          m_blocked.Block (m_addresses[m_random->GetInteger (0, 3)], tid);
+        }
+      else
+        {
+          m_blocked.Unblock (m_addresses[m_random->GetInteger (0, 3)], tid);
+        }
+      Time tstamp;
+      ReferenceMacQueue::Iterator expected = m_reference.Find (false, 0, type, addr, &m_blocked);
+      if (operation == 15)
+        {
+          Check (m_queue->PeekFirstAvailable (&hdr, tstamp, &m_blocked), hdr, expected, "PeekFirstAvailable");
+        }
+      else
+        {
+          Check (m_queue->DequeueFirstAvailable (&hdr, tstamp, &m_blocked), hdr, expected, "DequeueFirstAvailable");
+          if (expected != m_reference.m_queue.end ())
+            {
+              m_reference.m_queue.erase (expected);
+            }
+        }
+      if (expected != m_reference.m_queue.end ())
+        {
+          NS_TEST_EXPECT_MSG_EQ (tstamp, expected->tstamp, "Timestamp");
+        }
+    }
+  else if (operation == 17)
+    {
+      bool empty = m_reference.Find (false, 0, type, addr, 0) == m_reference.m_queue.end ();
+      NS_TEST_EXPECT_MSG_EQ (m_queue->IsEmpty (), empty, "IsEmpty");
+    }
+  else if (operation == 18 && m_random->GetInteger (0, 99) == 0)
+    {
+      Time maxDelay = MilliSeconds (m_random->GetInteger (m_maxDelay.GetMilliSeconds () / 5,
+                                                          m_maxDelay.GetMilliSeconds () * 2));
+      m_queue->SetMaxDelay (maxDelay);
+      m_reference.SetMaxDelay (maxDelay);
+    }
+  else if (operation == 19 && m_random->GetInteger (0, 199) == 0)
+    {
+      m_queue->Flush ();
+      m_reference.m_queue.clear ();
+    }
+  NS_TEST_EXPECT_MSG_EQ (m_queue->GetSize (), m_reference.m_queue.size (), "Size at " << Simulator::Now ().GetSeconds ());
+
+  if (remaining > 0)
+    {
+      // Several operations happen at the same time, and the packets of
+      // up to a few seconds are in the queue
+      Time delay = m_random->GetInteger (0, 2) == 0 ? Seconds (0) : MilliSeconds (m_random->GetInteger (1, 100));
+      Simulator::Schedule (delay, &WifiMacQueueRandomTest::Step, this, remaining - 1);
+    }
+}
+
+void
+WifiMacQueueRandomTest::DoRun (void)
+{
+  m_random = CreateObject<UniformRandomVariable> ();
+  m_random->SetStream (1);
+  for (uint32_t i = 0; i < 6; i++)
+    {
+      m_addresses.push_back (Mac48Address::Allocate ());
+    }
+  m_queue = CreateObject<WifiMacQueue> ();
+  m_queue->SetMaxSize (m_maxSize);
+  m_queue->SetMaxDelay (m_maxDelay);
+  Simulator::Schedule (Seconds (0), &WifiMacQueueRandomTest::Step, this, 200000);
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+class WifiMacQueueTestSuite : public TestSuite
+{
+public:
+  WifiMacQueueTestSuite ();
+};
+
+WifiMacQueueTestSuite::WifiMacQueueTestSuite ()
+  : TestSuite ("devices-wifi-mac-queue", UNIT)
+{
+  AddTestCase (new WifiMacQueueRandomTest (40, Seconds (1), true), TestCase::QUICK);
+  AddTestCase (new WifiMacQueueRandomTest (400, Seconds (60), false), TestCase::QUICK);
+}
+
+static WifiMacQueueTestSuite g_wifiMacQueueTestSuite;
+
+} // namespace ns3
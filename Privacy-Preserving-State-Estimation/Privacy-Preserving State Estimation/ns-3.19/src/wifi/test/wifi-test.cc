@@ -41,6 +41,8 @@
 #include "ns3/edca-txop-n.h"
 #include "ns3/config.h"
 #include "ns3/boolean.h"
+#include "ns3/double.h"
+#include <cstdlib>
 
 namespace ns3 {
 
@@ -478,6 +480,228 @@ Bug555TestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ (m_secondTransmissionTime, expectedSecondTransmissionTime, "The second transmission time not correct!");
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * Make sure that with the spatial index set, a YansWifiChannel schedules
+ * the receptions of the PHYs in range of the sender and only those, and
+ * that the index follows a PHY which changes position. The grid must
+ * deliver to the same PHYs as a loop over all of them, and skip the PHYs
+ * beyond MaxRange which the cutoff alone would deliver to.
+ */
+class YansWifiChannelSpatialIndexTest : public TestCase
+{
+public:
+  YansWifiChannelSpatialIndexTest ();
+
+  virtual void DoRun (void);
+private:
+  void RunOne (bool spatialIndex, bool staticLinkBudget);
+  double RunGrid (double maxRange, bool staticLinkBudget, const std::vector<Vector> &positions);
+  std::vector<uint32_t> InRange (double txPowerDbm, const std::vector<Vector> &positions) const;
+  Ptr<Node> CreateOne (Vector pos, Ptr<YansWifiChannel> channel, uint32_t index);
+  void SendOnePacket (Ptr<WifiNetDevice> dev);
+  void NotifyRx (std::string context, Ptr<const Packet> p);
+
+  ObjectFactory m_manager;
+  ObjectFactory m_mac;
+  std::vector<uint32_t> m_received;
+};
+
+YansWifiChannelSpatialIndexTest::YansWifiChannelSpatialIndexTest ()
+  : TestCase ("YansWifiChannel spatial index")
+{
+}
+
+void
+YansWifiChannelSpatialIndexTest::SendOnePacket (Ptr<WifiNetDevice> dev)
+{
+  Ptr<Packet> p = Create<Packet> (100);
+  dev->Send (p, dev->GetBroadcast (), 1);
+}
+
+void
+YansWifiChannelSpatialIndexTest::NotifyRx (std::string context, Ptr<const Packet> p)
+{
+  m_received[std::atoi (context.c_str ())]++;
+}
+
+Ptr<Node>
+YansWifiChannelSpatialIndexTest::CreateOne (Vector pos, Ptr<YansWifiChannel> channel, uint32_t index)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  Ptr<WifiNetDevice> dev = CreateObject<WifiNetDevice> ();
+
+  Ptr<WifiMac> mac = m_mac.Create<WifiMac> ();
+  mac->ConfigureStandard (WIFI_PHY_STANDARD_80211a);
+  Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<YansWifiPhy> phy = CreateObject<YansWifiPhy> ();
+  Ptr<ErrorRateModel> error = CreateObject<YansErrorRateModel> ();
+  phy->SetErrorRateModel (error);
+  phy->SetChannel (channel);
+  phy->SetDevice (dev);
+  phy->SetMobility (node);
+  phy->ConfigureStandard (WIFI_PHY_STANDARD_80211a);
+  std::ostringstream context;
+  context << index;
+  // A reception is either started or dropped by the PHY
+  phy->TraceConnect ("PhyRxBegin", context.str (),
+                     MakeCallback (&YansWifiChannelSpatialIndexTest::NotifyRx, this));
+  phy->TraceConnect ("PhyRxDrop", context.str (),
+                     MakeCallback (&YansWifiChannelSpatialIndexTest::NotifyRx, this));
+
+  mobility->SetPosition (pos);
+  node->AggregateObject (mobility);
+  mac->SetAddress (Mac48Address::Allocate ());
+  dev->SetMac (mac);
+  dev->SetPhy (phy);
+  dev->SetRemoteStationManager (m_manager.Create<WifiRemoteStationManager> ());
+  node->AddDevice (dev);
+
+  return node;
+}
+
+void
+YansWifiChannelSpatialIndexTest::RunOne (bool spatialIndex, bool staticLinkBudget)
+{
+  Ptr<YansWifiChannel> channel = CreateObject<YansWifiChannel> ();
+  channel->SetPropagationDelayModel (CreateObject<ConstantSpeedPropagationDelayModel> ());
+  channel->SetPropagationLossModel (CreateObject<LogDistancePropagationLossModel> ());
+  channel->SetAttribute ("SpatialIndex", BooleanValue (spatialIndex));
+  channel->SetAttribute ("ReceiveCutoff", DoubleValue (-100.0));
+  channel->SetAttribute ("StaticLinkBudget", BooleanValue (staticLinkBudget));
+
+  m_received.assign (3, 0);
+  Ptr<Node> sender = CreateOne (Vector (0.0, 0.0, 0.0), channel, 0);
+  CreateOne (Vector (10.0, 0.0, 0.0), channel, 1);
+  Ptr<Node> far = CreateOne (Vector (0.0, 2000.0, 0.0), channel, 2);
+  Ptr<WifiNetDevice> dev = DynamicCast<WifiNetDevice> (sender->GetDevice (0));
+
+  Simulator::Schedule (Seconds (1.0), &YansWifiChannelSpatialIndexTest::SendOnePacket, this, dev);
+  Simulator::Schedule (Seconds (2.0), &MobilityModel::SetPosition,
+                       far->GetObject<MobilityModel> (), Vector (0.0, 20.0, 0.0));
+  Simulator::Schedule (Seconds (3.0), &YansWifiChannelSpatialIndexTest::SendOnePacket, this, dev);
+  Simulator::Stop (Seconds (4.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+// Sends one packet from the first of the PHYs at the positions, and
+// returns its transmit power
+double
+YansWifiChannelSpatialIndexTest::RunGrid (double maxRange, bool staticLinkBudget, const std::vector<Vector> &positions)
+{
+  Ptr<YansWifiChannel> channel = CreateObject<YansWifiChannel> ();
+  channel->SetPropagationDelayModel (CreateObject<ConstantSpeedPropagationDelayModel> ());
+  channel->SetPropagationLossModel (CreateObject<LogDistancePropagationLossModel> ());
+  channel->SetAttribute ("SpatialIndex", BooleanValue (true));
+  channel->SetAttribute ("ReceiveCutoff", DoubleValue (-100.0));
+  channel->SetAttribute ("MaxRange", DoubleValue (maxRange));
+  channel->SetAttribute ("StaticLinkBudget", BooleanValue (staticLinkBudget));
+
+  m_received.assign (positions.size (), 0);
+  Ptr<Node> sender;
+  for (uint32_t i = 0; i < positions.size (); i++)
+    {
+      Ptr<Node> node = CreateOne (positions[i], channel, i);
+      if (i == 0)
+        {
+          sender = node;
+        }
+    }
+  Ptr<WifiNetDevice> dev = DynamicCast<WifiNetDevice> (sender->GetDevice (0));
+  Ptr<YansWifiPhy> phy = DynamicCast<YansWifiPhy> (dev->GetPhy ());
+  double txPowerDbm = phy->GetTxPowerStart () + phy->GetTxGain ();
+
+  Simulator::Schedule (Seconds (1.0), &YansWifiChannelSpatialIndexTest::SendOnePacket, this, dev);
+  Simulator::Stop (Seconds (2.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+  return txPowerDbm;
+}
+
+// Visits every PHY: whether each receives a packet of the first one
+// above the cutoff
+std::vector<uint32_t>
+YansWifiChannelSpatialIndexTest::InRange (double txPowerDbm, const std::vector<Vector> &positions) const
+{
+  Ptr<PropagationLossModel> loss = CreateObject<LogDistancePropagationLossModel> ();
+  Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel> ();
+  a->SetPosition (positions[0]);
+  std::vector<uint32_t> received (positions.size (), 0);
+  for (uint32_t i = 1; i < positions.size (); i++)
+    {
+      b->SetPosition (positions[i]);
+      received[i] = loss->CalcRxPower (txPowerDbm, a, b) >= -100.0 ? 1 : 0;
+    }
+  return received;
+}
+
+void
+YansWifiChannelSpatialIndexTest::DoRun (void)
+{
+  m_mac.SetTypeId ("ns3::AdhocWifiMac");
+  m_manager.SetTypeId ("ns3::ConstantRateWifiManager");
+
+  RunOne (false, false);
+  NS_TEST_EXPECT_MSG_EQ (m_received[0], 0, "The sender received its own packet");
+  NS_TEST_EXPECT_MSG_EQ (m_received[1], 2, "Without the index, a near PHY receives every packet");
+  NS_TEST_EXPECT_MSG_EQ (m_received[2], 2, "Without the index, a far PHY receives every packet");
+
+  RunOne (true, false);
+  NS_TEST_EXPECT_MSG_EQ (m_received[0], 0, "The sender received its own packet");
+  NS_TEST_EXPECT_MSG_EQ (m_received[1], 2, "With the index, a near PHY receives every packet");
+  NS_TEST_EXPECT_MSG_EQ (m_received[2], 1, "With the index, a PHY receives only once in range");
+
+  // The cached link budget of the far PHY must follow its course change
+  RunOne (true, true);
+  NS_TEST_EXPECT_MSG_EQ (m_received[0], 0, "The sender received its own packet");
+  NS_TEST_EXPECT_MSG_EQ (m_received[1], 2, "With cached budgets, a near PHY receives every packet");
+  NS_TEST_EXPECT_MSG_EQ (m_received[2], 1, "With cached budgets, a PHY receives only once in range");
+
+  // PHYs scattered over many cells around the sender, some of them next
+  // to the edges of the cells, some in range and some not: the grid, with
+  // the range probed from the loss model, delivers to the PHYs a loop
+  // over all of them finds above the cutoff
+  std::vector<Vector> positions;
+  positions.push_back (Vector (30.0, 30.0, 0.0));
+  for (uint32_t i = 1; i < 60; i++)
+    {
+      positions.push_back (Vector ((i * 137) % 1000 - 500.0, (i * 311) % 1000 - 500.0, 0.0));
+    }
+  for (uint32_t staticLinkBudget = 0; staticLinkBudget < 2; staticLinkBudget++)
+    {
+      double txPowerDbm = RunGrid (0.0, staticLinkBudget, positions);
+      std::vector<uint32_t> expected = InRange (txPowerDbm, positions);
+      uint32_t nInRange = 0;
+      for (uint32_t i = 0; i < positions.size (); i++)
+        {
+          nInRange += expected[i];
+          NS_TEST_EXPECT_MSG_EQ (m_received[i], expected[i], "The grid and a loop over all the PHYs differ for PHY " << i);
+        }
+      NS_TEST_EXPECT_MSG_GT (nInRange, 0, "No PHY in range: the grid is not checked");
+      NS_TEST_EXPECT_MSG_LT (nInRange, positions.size () - 1, "Every PHY in range: the grid is not checked");
+    }
+
+  // With a MaxRange of 50 m, the cells are 50 m wide: the grid keeps the
+  // PHYs of the neighbouring cells, and skips a PHY three cells away which
+  // the cutoff alone would deliver to
+  positions.clear ();
+  positions.push_back (Vector (45.0, 5.0, 0.0));
+  positions.push_back (Vector (60.0, 5.0, 0.0));  // next cell, right
+  positions.push_back (Vector (-5.0, 5.0, 0.0));  // next cell, left of the origin
+  positions.push_back (Vector (45.0, -40.0, 0.0)); // next cell, below the origin
+  positions.push_back (Vector (160.0, 5.0, 0.0)); // three cells away
+  double txPowerDbm = RunGrid (50.0, false, positions);
+  std::vector<uint32_t> expected = InRange (txPowerDbm, positions);
+  NS_TEST_EXPECT_MSG_EQ (m_received[0], 0, "The sender received its own packet");
+  NS_TEST_EXPECT_MSG_EQ (m_received[1], 1, "A PHY of the next cell was skipped");
+  NS_TEST_EXPECT_MSG_EQ (m_received[2], 1, "A PHY of the next cell at negative coordinates was skipped");
+  NS_TEST_EXPECT_MSG_EQ (m_received[3], 1, "A PHY of the next cell at negative coordinates was skipped");
+  NS_TEST_EXPECT_MSG_EQ (expected[4], 1, "The far PHY is below the cutoff: the grid is not checked");
+  NS_TEST_EXPECT_MSG_EQ (m_received[4], 0, "A PHY beyond MaxRange was not skipped by the grid");
+}
+
 //-----------------------------------------------------------------------------
 class WifiTestSuite : public TestSuite
 {
@@ -492,6 +716,7 @@ WifiTestSuite::WifiTestSuite ()
   AddTestCase (new QosUtilsIsOldPacketTest, TestCase::QUICK);
   AddTestCase (new InterferenceHelperSequenceTest, TestCase::QUICK); // Bug 991
   AddTestCase (new Bug555TestCase, TestCase::QUICK); // Bug 555
+  AddTestCase (new YansWifiChannelSpatialIndexTest, TestCase::QUICK);
 }
 
 static WifiTestSuite g_wifiTestSuite;